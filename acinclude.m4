@@ -6,6 +6,13 @@ dnl Function to detect if libfshfs dependencies are available
 AC_DEFUN([AX_LIBFSHFS_CHECK_LOCAL],
   [dnl Check for internationalization functions in libfshfs/libfshfs_i18n.c
   AC_CHECK_FUNCS([bindtextdomain])
+
+  dnl Check for memory mapping functions in libfshfs/libfshfs_memory_map.c
+  AC_CHECK_HEADERS([fcntl.h sys/mman.h sys/stat.h unistd.h])
+  AC_CHECK_FUNCS([mmap munmap])
+
+  dnl Check for monotonic clock functions in libfshfs/libfshfs_statistics.c
+  AC_CHECK_FUNCS([clock_gettime])
 ])
 
 dnl Function to check if DLL support is needed
@@ -0,0 +1,852 @@
+/*
+ * Catalog entries functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "catalog_entries.h"
+#include "fshfstools_libcerror.h"
+#include "fshfstools_libfshfs.h"
+#include "fshfstools_libuna.h"
+
+/* Creates catalog entries
+ * Make sure the value catalog_entries is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int catalog_entries_initialize(
+     catalog_entries_t **catalog_entries,
+     uint8_t file_system_type,
+     libcerror_error_t **error )
+{
+	static char *function = "catalog_entries_initialize";
+
+	if( catalog_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( *catalog_entries != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid catalog entries value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*catalog_entries = memory_allocate_structure(
+	                    catalog_entries_t );
+
+	if( *catalog_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create catalog entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *catalog_entries,
+	     0,
+	     sizeof( catalog_entries_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear catalog entries.",
+		 function );
+
+		goto on_error;
+	}
+	( *catalog_entries )->file_system_type = file_system_type;
+
+	return( 1 );
+
+on_error:
+	if( *catalog_entries != NULL )
+	{
+		memory_free(
+		 *catalog_entries );
+
+		*catalog_entries = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees catalog entries
+ * Returns 1 if successful or -1 on error
+ */
+int catalog_entries_free(
+     catalog_entries_t **catalog_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "catalog_entries_free";
+
+	if( catalog_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( *catalog_entries != NULL )
+	{
+		if( ( *catalog_entries )->names != NULL )
+		{
+			memory_free(
+			 ( *catalog_entries )->names );
+		}
+		if( ( *catalog_entries )->entries != NULL )
+		{
+			memory_free(
+			 ( *catalog_entries )->entries );
+		}
+		memory_free(
+		 *catalog_entries );
+
+		*catalog_entries = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends a name as stored in the catalog to the names string
+ * The name is converted into a system string where / is replaced by : and U+0 by U+2400
+ * Returns 1 if successful or -1 on error
+ */
+int catalog_entries_append_name(
+     catalog_entries_t *catalog_entries,
+     const uint8_t *name_data,
+     size_t name_size,
+     size_t *name_offset,
+     size_t *name_length,
+     libcerror_error_t **error )
+{
+	system_character_t *reallocation            = NULL;
+	static char *function                        = "catalog_entries_append_name";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t maximum_name_length                   = 0;
+	size_t name_data_index                       = 0;
+	size_t names_allocated_size                  = 0;
+	size_t names_index                           = 0;
+	int result                                   = 0;
+
+	if( catalog_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_data == NULL )
+	 && ( name_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name data.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 3 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name length.",
+		 function );
+
+		return( -1 );
+	}
+	/* A single byte of name data is at most 3 UTF-8 characters or 1 UTF-16 character
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	maximum_name_length = name_size;
+#else
+	maximum_name_length = name_size * 3;
+#endif
+	if( ( catalog_entries->names_allocated_size - catalog_entries->names_size ) < maximum_name_length )
+	{
+		names_allocated_size = catalog_entries->names_allocated_size;
+
+		if( names_allocated_size == 0 )
+		{
+			names_allocated_size = 65536;
+		}
+		while( ( names_allocated_size - catalog_entries->names_size ) < maximum_name_length )
+		{
+			if( names_allocated_size > (size_t) ( ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) / 2 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid names allocated size value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			names_allocated_size *= 2;
+		}
+		reallocation = (system_character_t *) memory_reallocate(
+		                catalog_entries->names,
+		                sizeof( system_character_t ) * names_allocated_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize names.",
+			 function );
+
+			return( -1 );
+		}
+		catalog_entries->names                = reallocation;
+		catalog_entries->names_allocated_size = names_allocated_size;
+	}
+	names_index = catalog_entries->names_size;
+
+	while( name_data_index < name_size )
+	{
+		if( catalog_entries->file_system_type == LIBFSHFS_FILE_SYSTEM_TYPE_HFS )
+		{
+/* TODO add support for Mac OS codepages */
+			result = libuna_unicode_character_copy_from_byte_stream(
+			          &unicode_character,
+			          name_data,
+			          name_size,
+			          &name_data_index,
+			          LIBUNA_CODEPAGE_ASCII,
+			          error );
+		}
+		else
+		{
+			result = libuna_unicode_character_copy_from_utf16_stream(
+			          &unicode_character,
+			          name_data,
+			          name_size,
+			          &name_data_index,
+			          LIBUNA_ENDIAN_BIG,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from name data.",
+			 function );
+
+			return( -1 );
+		}
+		/* ':' is stored as '/'
+		 */
+		if( unicode_character == (libuna_unicode_character_t) '/' )
+		{
+			unicode_character = (libuna_unicode_character_t) ':';
+		}
+		/* U+2400 is stored as U+0
+		 */
+		else if( unicode_character == (libuna_unicode_character_t) 0x00000000UL )
+		{
+			unicode_character = (libuna_unicode_character_t) 0x00002400UL;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libuna_unicode_character_copy_to_utf16(
+		          unicode_character,
+		          (libuna_utf16_character_t *) catalog_entries->names,
+		          catalog_entries->names_allocated_size,
+		          &names_index,
+		          error );
+#else
+		result = libuna_unicode_character_copy_to_utf8(
+		          unicode_character,
+		          (libuna_utf8_character_t *) catalog_entries->names,
+		          catalog_entries->names_allocated_size,
+		          &names_index,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+			 "%s: unable to copy Unicode character to names.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*name_offset = catalog_entries->names_size;
+	*name_length = names_index - catalog_entries->names_size;
+
+	catalog_entries->names_size = names_index;
+
+	return( 1 );
+}
+
+/* Appends a catalog directory or file record
+ * Returns 1 if successful or -1 on error
+ */
+int catalog_entries_append_entry(
+     catalog_entries_t *catalog_entries,
+     uint32_t parent_identifier,
+     const uint8_t *name_data,
+     size_t name_size,
+     const libfshfs_file_entry_stat_t *stat_value,
+     libcerror_error_t **error )
+{
+	catalog_entry_t *catalog_entry  = NULL;
+	catalog_entry_t *reallocation   = NULL;
+	static char *function           = "catalog_entries_append_entry";
+	size_t entries_size             = 0;
+	int number_of_allocated_entries = 0;
+
+	if( catalog_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( stat_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stat value.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog_entries->number_of_entries >= catalog_entries->number_of_allocated_entries )
+	{
+		if( catalog_entries->number_of_allocated_entries == 0 )
+		{
+			number_of_allocated_entries = 1024;
+		}
+		else if( catalog_entries->number_of_allocated_entries < ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_entries = catalog_entries->number_of_allocated_entries * 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated entries value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		entries_size = sizeof( catalog_entry_t ) * number_of_allocated_entries;
+
+		if( entries_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid entries size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = (catalog_entry_t *) memory_reallocate(
+		                catalog_entries->entries,
+		                entries_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		catalog_entries->entries                     = reallocation;
+		catalog_entries->number_of_allocated_entries = number_of_allocated_entries;
+	}
+	catalog_entry = &( catalog_entries->entries[ catalog_entries->number_of_entries ] );
+
+	if( memory_set(
+	     catalog_entry,
+	     0,
+	     sizeof( catalog_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear catalog entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog_entries_append_name(
+	     catalog_entries,
+	     name_data,
+	     name_size,
+	     &( catalog_entry->name_offset ),
+	     &( catalog_entry->name_length ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append name.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( catalog_entry->stat_value ),
+	     stat_value,
+	     sizeof( libfshfs_file_entry_stat_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy stat value.",
+		 function );
+
+		return( -1 );
+	}
+	catalog_entry->parent_identifier = parent_identifier;
+
+	catalog_entries->number_of_entries += 1;
+
+	return( 1 );
+}
+
+/* Compares 2 catalog entries by identifier
+ * Returns -1 if first is less than second, 0 if equal or 1 if greater
+ */
+int catalog_entries_entry_compare(
+     const void *first_entry,
+     const void *second_entry )
+{
+	uint32_t first_identifier  = ( (catalog_entry_t *) first_entry )->stat_value.identifier;
+	uint32_t second_identifier = ( (catalog_entry_t *) second_entry )->stat_value.identifier;
+
+	if( first_identifier < second_identifier )
+	{
+		return( -1 );
+	}
+	else if( first_identifier > second_identifier )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Compares 2 references to catalog entries by extent offset
+ * Returns -1 if first is less than second, 0 if equal or 1 if greater
+ */
+int catalog_entries_entry_reference_compare_by_extent_offset(
+     const void *first_entry_reference,
+     const void *second_entry_reference )
+{
+	off64_t first_extent_offset  = ( *( (catalog_entry_t **) first_entry_reference ) )->extent_offset;
+	off64_t second_extent_offset = ( *( (catalog_entry_t **) second_entry_reference ) )->extent_offset;
+
+	if( first_extent_offset < second_extent_offset )
+	{
+		return( -1 );
+	}
+	else if( first_extent_offset > second_extent_offset )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Sorts the catalog entries by identifier
+ * Returns 1 if successful or -1 on error
+ */
+int catalog_entries_sort(
+     catalog_entries_t *catalog_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "catalog_entries_sort";
+
+	if( catalog_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog_entries->number_of_entries > 1 )
+	{
+		qsort(
+		 catalog_entries->entries,
+		 (size_t) catalog_entries->number_of_entries,
+		 sizeof( catalog_entry_t ),
+		 &catalog_entries_entry_compare );
+	}
+	return( 1 );
+}
+
+/* Retrieves the catalog entry of a specific identifier
+ * The catalog entries must be sorted
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int catalog_entries_get_entry_by_identifier(
+     catalog_entries_t *catalog_entries,
+     uint32_t identifier,
+     catalog_entry_t **catalog_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "catalog_entries_get_entry_by_identifier";
+	int lower_index       = 0;
+	int middle_index      = 0;
+	int upper_index       = 0;
+
+	if( catalog_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog entry.",
+		 function );
+
+		return( -1 );
+	}
+	upper_index = catalog_entries->number_of_entries;
+
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( identifier < catalog_entries->entries[ middle_index ].stat_value.identifier )
+		{
+			upper_index = middle_index;
+		}
+		else if( identifier > catalog_entries->entries[ middle_index ].stat_value.identifier )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			*catalog_entry = &( catalog_entries->entries[ middle_index ] );
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves the path of the parent directory of a catalog entry
+ * The path starts and ends with a separator and is reconstructed by following
+ * the parent identifiers up to the root directory, parents that are not
+ * in the catalog entries are omitted. The path buffer is resized if needed
+ * The catalog entries must be sorted
+ * Returns 1 if successful or -1 on error
+ */
+int catalog_entries_get_parent_path(
+     catalog_entries_t *catalog_entries,
+     catalog_entry_t *catalog_entry,
+     system_character_t **path,
+     size_t *path_size,
+     size_t *path_length,
+     libcerror_error_t **error )
+{
+	catalog_entry_t *parent_catalog_entry = NULL;
+	system_character_t *reallocation      = NULL;
+	static char *function                 = "catalog_entries_get_parent_path";
+	size_t path_index                     = 0;
+	size_t safe_path_length               = 0;
+	uint32_t parent_identifier            = 0;
+	int number_of_parents                 = 0;
+	int result                            = 0;
+
+	if( catalog_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path length.",
+		 function );
+
+		return( -1 );
+	}
+	/* Determine the length of the path
+	 */
+	safe_path_length  = 1;
+	parent_identifier = catalog_entry->parent_identifier;
+
+	while( parent_identifier > 2 )
+	{
+		if( number_of_parents >= catalog_entries->number_of_entries )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of parents value out of bounds - possible loop in parent identifiers.",
+			 function );
+
+			return( -1 );
+		}
+		result = catalog_entries_get_entry_by_identifier(
+		          catalog_entries,
+		          parent_identifier,
+		          &parent_catalog_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve parent catalog entry: %" PRIu32 ".",
+			 function,
+			 parent_identifier );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		safe_path_length += parent_catalog_entry->name_length + 1;
+
+		parent_identifier = parent_catalog_entry->parent_identifier;
+
+		number_of_parents++;
+	}
+	if( ( safe_path_length + 1 ) > *path_size )
+	{
+		if( ( safe_path_length + 1 ) > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid path size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = (system_character_t *) memory_reallocate(
+		                *path,
+		                sizeof( system_character_t ) * ( safe_path_length + 1 ) );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize path.",
+			 function );
+
+			return( -1 );
+		}
+		*path      = reallocation;
+		*path_size = safe_path_length + 1;
+	}
+	/* Fill the path from the end, the parents are known to be available
+	 */
+	path_index        = safe_path_length;
+	parent_identifier = catalog_entry->parent_identifier;
+
+	( *path )[ 0 ]          = (system_character_t) LIBFSHFS_SEPARATOR;
+	( *path )[ path_index ] = 0;
+
+	while( number_of_parents > 0 )
+	{
+		if( catalog_entries_get_entry_by_identifier(
+		     catalog_entries,
+		     parent_identifier,
+		     &parent_catalog_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve parent catalog entry: %" PRIu32 ".",
+			 function,
+			 parent_identifier );
+
+			return( -1 );
+		}
+		path_index -= 1;
+
+		( *path )[ path_index ] = (system_character_t) LIBFSHFS_SEPARATOR;
+
+		if( parent_catalog_entry->name_length > 0 )
+		{
+			path_index -= parent_catalog_entry->name_length;
+
+			if( system_string_copy(
+			     &( ( *path )[ path_index ] ),
+			     &( catalog_entries->names[ parent_catalog_entry->name_offset ] ),
+			     parent_catalog_entry->name_length ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy name to path.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		parent_identifier = parent_catalog_entry->parent_identifier;
+
+		number_of_parents--;
+	}
+	*path_length = safe_path_length;
+
+	return( 1 );
+}
+
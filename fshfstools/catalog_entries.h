@@ -0,0 +1,157 @@
+/*
+ * Catalog entries functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _CATALOG_ENTRIES_H )
+#define _CATALOG_ENTRIES_H
+
+#include <common.h>
+#include <types.h>
+
+#include "fshfstools_libcerror.h"
+#include "fshfstools_libfshfs.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct catalog_entry catalog_entry_t;
+
+struct catalog_entry
+{
+	/* The parent identifier
+	 */
+	uint32_t parent_identifier;
+
+	/* The offset of the name in the names string
+	 */
+	size_t name_offset;
+
+	/* The length of the name
+	 */
+	size_t name_length;
+
+	/* The stat values
+	 */
+	libfshfs_file_entry_stat_t stat_value;
+
+	/* The offset of the first extent, used to order data reads
+	 */
+	off64_t extent_offset;
+
+	/* The MD5 hash
+	 */
+	uint8_t md5_hash[ 16 ];
+
+	/* Value to indicate the MD5 hash was set
+	 */
+	uint8_t has_md5_hash;
+};
+
+typedef struct catalog_entries catalog_entries_t;
+
+struct catalog_entries
+{
+	/* The file system type
+	 */
+	uint8_t file_system_type;
+
+	/* The entries
+	 */
+	catalog_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+
+	/* The names string
+	 */
+	system_character_t *names;
+
+	/* The size of the names string
+	 */
+	size_t names_size;
+
+	/* The allocated size of the names string
+	 */
+	size_t names_allocated_size;
+};
+
+int catalog_entries_initialize(
+     catalog_entries_t **catalog_entries,
+     uint8_t file_system_type,
+     libcerror_error_t **error );
+
+int catalog_entries_free(
+     catalog_entries_t **catalog_entries,
+     libcerror_error_t **error );
+
+int catalog_entries_append_name(
+     catalog_entries_t *catalog_entries,
+     const uint8_t *name_data,
+     size_t name_size,
+     size_t *name_offset,
+     size_t *name_length,
+     libcerror_error_t **error );
+
+int catalog_entries_append_entry(
+     catalog_entries_t *catalog_entries,
+     uint32_t parent_identifier,
+     const uint8_t *name_data,
+     size_t name_size,
+     const libfshfs_file_entry_stat_t *stat_value,
+     libcerror_error_t **error );
+
+int catalog_entries_entry_compare(
+     const void *first_entry,
+     const void *second_entry );
+
+int catalog_entries_entry_reference_compare_by_extent_offset(
+     const void *first_entry_reference,
+     const void *second_entry_reference );
+
+int catalog_entries_sort(
+     catalog_entries_t *catalog_entries,
+     libcerror_error_t **error );
+
+int catalog_entries_get_entry_by_identifier(
+     catalog_entries_t *catalog_entries,
+     uint32_t identifier,
+     catalog_entry_t **catalog_entry,
+     libcerror_error_t **error );
+
+int catalog_entries_get_parent_path(
+     catalog_entries_t *catalog_entries,
+     catalog_entry_t *catalog_entry,
+     system_character_t **path,
+     size_t *path_size,
+     size_t *path_length,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _CATALOG_ENTRIES_H ) */
+
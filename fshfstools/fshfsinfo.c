@@ -56,6 +56,8 @@ enum FSHFSINFO_MODES
 	FSHFSINFO_MODE_FILE_ENTRY_BY_IDENTIFIER,
 	FSHFSINFO_MODE_FILE_ENTRY_BY_PATH,
 	FSHFSINFO_MODE_FILE_SYSTEM_HIERARCHY,
+	FSHFSINFO_MODE_FILE_SYSTEM_HIERARCHY_SINGLE_PASS,
+	FSHFSINFO_MODE_UNALLOCATED_SPACE,
 	FSHFSINFO_MODE_VOLUME
 };
 
@@ -124,7 +126,10 @@ int main( int argc, char * const argv[] )
 		{ 'F', "path", "show information about a specific file entry path" },
 		{ 'h', NULL, "shows this help" },
 		{ 'H', NULL, "shows the file system hierarchy" },
+		{ 'j', "jobs", "specify the number of concurrent read threads used to calculate MD5 hashes with -S (default is 4)" },
 		{ 'o', "offset", "specify the volume offset in bytes" },
+		{ 'S', NULL, "shows the file system hierarchy using a single pass over the catalog" },
+		{ 'U', "file", "writes the unallocated space to a file and shows the unallocated block runs" },
 		{ 'v', NULL, "verbose output to stderr" },
 		{ 'V', NULL, "print version" },
 		{ 0, "source", "the source volume" },
@@ -135,6 +140,8 @@ int main( int argc, char * const argv[] )
 	system_character_t *option_bodyfile              = NULL;
 	system_character_t *option_file_entry_identifier = NULL;
 	system_character_t *option_file_entry_path       = NULL;
+	system_character_t *option_number_of_threads     = NULL;
+	system_character_t *option_unallocated_file      = NULL;
 	system_character_t *option_volume_offset         = NULL;
 	system_character_t *source                       = NULL;
 	char *program                                    = "fshfsinfo";
@@ -253,11 +260,27 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'j':
+				option_number_of_threads = optarg;
+
+				break;
+
 			case (system_integer_t) 'o':
 				option_volume_offset = optarg;
 
 				break;
 
+			case (system_integer_t) 'S':
+				option_mode = FSHFSINFO_MODE_FILE_SYSTEM_HIERARCHY_SINGLE_PASS;
+
+				break;
+
+			case (system_integer_t) 'U':
+				option_mode             = FSHFSINFO_MODE_UNALLOCATED_SPACE;
+				option_unallocated_file = optarg;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
@@ -323,6 +346,20 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
+	if( option_unallocated_file != NULL )
+	{
+		if( info_handle_set_unallocated_file(
+		     fshfsinfo_info_handle,
+		     option_unallocated_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set unallocated space file.\n" );
+
+			goto on_error;
+		}
+	}
 	if( option_volume_offset != NULL )
 	{
 		if( info_handle_set_volume_offset(
@@ -341,6 +378,24 @@ int main( int argc, char * const argv[] )
 			 fshfsinfo_info_handle->volume_offset );
 		}
 	}
+	if( option_number_of_threads != NULL )
+	{
+		if( info_handle_set_number_of_threads(
+		     fshfsinfo_info_handle,
+		     option_number_of_threads,
+		     &error ) != 1 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads defaulting to: %d.\n",
+			 fshfsinfo_info_handle->number_of_threads );
+		}
+	}
 	if( info_handle_open_input(
 	     fshfsinfo_info_handle,
 	     source,
@@ -452,6 +507,32 @@ int main( int argc, char * const argv[] )
 			}
 			break;
 
+		case FSHFSINFO_MODE_FILE_SYSTEM_HIERARCHY_SINGLE_PASS:
+			if( info_handle_file_system_hierarchy_fprint_single_pass(
+			     fshfsinfo_info_handle,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to print file system hierarchy.\n" );
+
+				goto on_error;
+			}
+			break;
+
+		case FSHFSINFO_MODE_UNALLOCATED_SPACE:
+			if( info_handle_unallocated_space_fprint(
+			     fshfsinfo_info_handle,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to print unallocated space.\n" );
+
+				goto on_error;
+			}
+			break;
+
 		case FSHFSINFO_MODE_VOLUME:
 		default:
 			if( info_handle_volume_fprint(
@@ -27,6 +27,11 @@
 #include <types.h>
 #include <wide_string.h>
 
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "catalog_entries.h"
 #include "digest_hash.h"
 #include "fshfstools_libbfio.h"
 #include "fshfstools_libcerror.h"
@@ -56,7 +61,11 @@ int libfshfs_volume_open_file_io_handle(
 #endif /* !defined( LIBFSHFS_HAVE_BFIO ) */
 
 #define DIGEST_HASH_STRING_SIZE_MD5	33
+#define INFO_HANDLE_DEFAULT_NUMBER_OF_THREADS	4
+#define INFO_HANDLE_MAXIMUM_NUMBER_OF_THREADS	32
 #define INFO_HANDLE_NOTIFY_STREAM	stdout
+#define INFO_HANDLE_READ_BUFFER_SIZE	1048576
+#define INFO_HANDLE_UNALLOCATED_READ_SIZE	16777216
 
 /* Copies a string of a decimal value to a 64-bit value
  * Returns 1 if successful or -1 on error
@@ -242,8 +251,9 @@ int info_handle_initialize(
 
 		goto on_error;
 	}
-	( *info_handle )->calculate_md5 = calculate_md5;
-	( *info_handle )->notify_stream = INFO_HANDLE_NOTIFY_STREAM;
+	( *info_handle )->calculate_md5     = calculate_md5;
+	( *info_handle )->number_of_threads = INFO_HANDLE_DEFAULT_NUMBER_OF_THREADS;
+	( *info_handle )->notify_stream     = INFO_HANDLE_NOTIFY_STREAM;
 
 	return( 1 );
 
@@ -332,6 +342,22 @@ int info_handle_free(
 			}
 			( *info_handle )->bodyfile_stream = NULL;
 		}
+		if( ( *info_handle )->unallocated_stream != NULL )
+		{
+			if( file_stream_close(
+			     ( *info_handle )->unallocated_stream ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close unallocated space stream.",
+				 function );
+
+				result = -1;
+			}
+			( *info_handle )->unallocated_stream = NULL;
+		}
 		memory_free(
 		 *info_handle );
 
@@ -447,6 +473,72 @@ int info_handle_set_bodyfile(
 	return( 1 );
 }
 
+/* Sets the unallocated space file
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_set_unallocated_file(
+     info_handle_t *info_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_set_unallocated_file";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->unallocated_stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid info handle - unallocated space stream value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	info_handle->unallocated_stream = file_stream_open_wide(
+	                                   filename,
+	                                   L"wb" );
+#else
+	info_handle->unallocated_stream = file_stream_open(
+	                                   filename,
+	                                   "wb" );
+#endif
+	if( info_handle->unallocated_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open unallocated space stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Sets the volume offset
  * Returns 1 if successful or -1 on error
  */
@@ -493,6 +585,63 @@ int info_handle_set_volume_offset(
 	return( 1 );
 }
 
+/* Sets the number of threads
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_set_number_of_threads(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_set_number_of_threads";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( info_handle_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit decimal.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit > (uint64_t) INFO_HANDLE_MAXIMUM_NUMBER_OF_THREADS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	info_handle->number_of_threads = (int) value_64bit;
+
+	return( 1 );
+}
+
 /* Opens the input
  * Returns 1 if successful or -1 on error
  */
@@ -635,22 +784,21 @@ int info_handle_close_input(
 	return( 0 );
 }
 
-/* Calculates the MD5 of the contents of a file entry
+/* Calculates the MD5 hash of the contents of a file entry
  * Returns 1 if successful or -1 on error
  */
-int info_handle_file_entry_calculate_md5(
+int info_handle_file_entry_calculate_md5_hash(
      info_handle_t *info_handle,
      libfshfs_file_entry_t *file_entry,
-     char *md5_string,
-     size_t md5_string_size,
+     uint8_t *md5_hash,
+     size_t md5_hash_size,
      libcerror_error_t **error )
 {
-	uint8_t md5_hash[ LIBHMAC_MD5_HASH_SIZE ];
-	uint8_t read_buffer[ 4096 ];
-
 	libhmac_md5_context_t *md5_context = NULL;
-	static char *function              = "info_handle_file_entry_calculate_md5";
+	uint8_t *read_buffer               = NULL;
+	static char *function              = "info_handle_file_entry_calculate_md5_hash";
 	size64_t data_size                 = 0;
+	size_t read_buffer_size            = 0;
 	size_t read_size                   = 0;
 	ssize_t read_count                 = 0;
 
@@ -707,9 +855,32 @@ int info_handle_file_entry_calculate_md5(
 
 		goto on_error;
 	}
+	if( data_size > 0 )
+	{
+		read_buffer_size = INFO_HANDLE_READ_BUFFER_SIZE;
+
+		if( (size64_t) read_buffer_size > data_size )
+		{
+			read_buffer_size = (size_t) data_size;
+		}
+		read_buffer = (uint8_t *) memory_allocate(
+		                           sizeof( uint8_t ) * read_buffer_size );
+
+		if( read_buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create read buffer.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	while( data_size > 0 )
 	{
-		read_size = 4096;
+		read_size = read_buffer_size;
 
 		if( (size64_t) read_size > data_size )
 		{
@@ -750,10 +921,17 @@ int info_handle_file_entry_calculate_md5(
 			goto on_error;
 		}
 	}
+	if( read_buffer != NULL )
+	{
+		memory_free(
+		 read_buffer );
+
+		read_buffer = NULL;
+	}
 	if( libhmac_md5_finalize(
 	     md5_context,
 	     md5_hash,
-	     LIBHMAC_MD5_HASH_SIZE,
+	     md5_hash_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -778,6 +956,53 @@ int info_handle_file_entry_calculate_md5(
 
 		goto on_error;
 	}
+	return( 1 );
+
+on_error:
+	if( read_buffer != NULL )
+	{
+		memory_free(
+		 read_buffer );
+	}
+	if( md5_context != NULL )
+	{
+		libhmac_md5_free(
+		 &md5_context,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Calculates the MD5 of the contents of a file entry
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_file_entry_calculate_md5(
+     info_handle_t *info_handle,
+     libfshfs_file_entry_t *file_entry,
+     char *md5_string,
+     size_t md5_string_size,
+     libcerror_error_t **error )
+{
+	uint8_t md5_hash[ LIBHMAC_MD5_HASH_SIZE ];
+
+	static char *function = "info_handle_file_entry_calculate_md5";
+
+	if( info_handle_file_entry_calculate_md5_hash(
+	     info_handle,
+	     file_entry,
+	     md5_hash,
+	     LIBHMAC_MD5_HASH_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate MD5 hash.",
+		 function );
+
+		return( -1 );
+	}
 	if( digest_hash_copy_to_string(
 	     md5_hash,
 	     LIBHMAC_MD5_HASH_SIZE,
@@ -792,18 +1017,9 @@ int info_handle_file_entry_calculate_md5(
 		 "%s: unable to set MD5 hash string.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	return( 1 );
-
-on_error:
-	if( md5_context != NULL )
-	{
-		libhmac_md5_free(
-		 &md5_context,
-		 NULL );
-	}
-	return( -1 );
 }
 
 /* Prints a file entry or data stream name
@@ -1233,82 +1449,199 @@ on_error:
 	return( -1 );
 }
 
-/* Prints a file entry value with name
- * Returns 1 if successful, 0 if not or -1 on error
+/* Copies the file mode to a string, such as "drwxr-xr-x"
+ * Returns 1 if successful or -1 on error
  */
-int info_handle_file_entry_value_with_name_fprint(
-     info_handle_t *info_handle,
-     libfshfs_file_entry_t *file_entry,
-     const system_character_t *path,
-     size_t path_length,
-     const system_character_t *file_entry_name,
-     size_t file_entry_name_length,
+int info_handle_file_mode_string_copy(
+     uint16_t file_mode,
+     char *file_mode_string,
+     size_t file_mode_string_size,
      libcerror_error_t **error )
 {
-	char md5_string[ DIGEST_HASH_STRING_SIZE_MD5 ]    = {
-		'0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0',
-		'0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0',
-		0 };
-
-	char file_mode_string[ 11 ]                       = { '-', '-', '-', '-', '-', '-', '-', '-', '-', '-', 0 };
-
-	libfshfs_extended_attribute_t *extended_attribute = NULL;
-	system_character_t *extended_attribute_name       = NULL;
-	system_character_t *symbolic_link_target          = NULL;
-	static char *function                             = "info_handle_file_entry_value_with_name_fprint";
-	size64_t size                                     = 0;
-	size_t extended_attribute_name_size               = 0;
-	size_t symbolic_link_target_size                  = 0;
-	uint32_t access_time                              = 0;
-	uint32_t backup_time                              = 0;
-	uint32_t creation_time                            = 0;
-	uint32_t entry_modification_time                  = 0;
-	uint32_t file_entry_identifier                    = 0;
-	uint32_t group_identifier                         = 0;
-	uint32_t link_identifier                          = 0;
-	uint32_t major_device_number                      = 0;
-	uint32_t minor_device_number                      = 0;
-	uint32_t modification_time                        = 0;
-	uint32_t number_of_links                          = 0;
-	uint32_t owner_identifier                         = 0;
-	uint32_t parent_identifier                        = 0;
-	int32_t added_time                                = 0;
-	uint16_t file_mode                                = 0;
-	int extended_attribute_index                      = 0;
-	int has_access_time                               = 0;
-	int has_entry_modification_time                   = 0;
-	int number_of_extended_attributes                 = 0;
-	int result                                        = 0;
+	static char *function = "info_handle_file_mode_string_copy";
 
-	if( info_handle == NULL )
+	if( file_mode_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid info handle.",
+		 "%s: invalid file mode string.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfshfs_file_entry_get_identifier(
-	     file_entry,
-	     &file_entry_identifier,
-	     error ) != 1 )
+	if( file_mode_string_size < 11 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve identifier.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid file mode string size value too small.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfshfs_file_entry_get_modification_time(
-	     file_entry,
-	     &modification_time,
-	     error ) != 1 )
+	if( memory_set(
+	     file_mode_string,
+	     (int) '-',
+	     10 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file mode string.",
+		 function );
+
+		return( -1 );
+	}
+	file_mode_string[ 10 ] = 0;
+
+	if( ( file_mode & 0x0001 ) != 0 )
+	{
+		file_mode_string[ 9 ] = 'x';
+	}
+	if( ( file_mode & 0x0002 ) != 0 )
+	{
+		file_mode_string[ 8 ] = 'w';
+	}
+	if( ( file_mode & 0x0004 ) != 0 )
+	{
+		file_mode_string[ 7 ] = 'r';
+	}
+	if( ( file_mode & 0x0008 ) != 0 )
+	{
+		file_mode_string[ 6 ] = 'x';
+	}
+	if( ( file_mode & 0x0010 ) != 0 )
+	{
+		file_mode_string[ 5 ] = 'w';
+	}
+	if( ( file_mode & 0x0020 ) != 0 )
+	{
+		file_mode_string[ 4 ] = 'r';
+	}
+	if( ( file_mode & 0x0040 ) != 0 )
+	{
+		file_mode_string[ 3 ] = 'x';
+	}
+	if( ( file_mode & 0x0080 ) != 0 )
+	{
+		file_mode_string[ 2 ] = 'w';
+	}
+	if( ( file_mode & 0x0100 ) != 0 )
+	{
+		file_mode_string[ 1 ] = 'r';
+	}
+	switch( file_mode & 0xf000 )
+	{
+		case 0x1000:
+			file_mode_string[ 0 ] = 'p';
+			break;
+
+		case 0x2000:
+			file_mode_string[ 0 ] = 'c';
+			break;
+
+		case 0x4000:
+			file_mode_string[ 0 ] = 'd';
+			break;
+
+		case 0x6000:
+			file_mode_string[ 0 ] = 'b';
+			break;
+
+		case 0xa000:
+			file_mode_string[ 0 ] = 'l';
+			break;
+
+		case 0xc000:
+			file_mode_string[ 0 ] = 's';
+			break;
+
+		default:
+			break;
+	}
+	return( 1 );
+}
+
+/* Prints a file entry value with name
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int info_handle_file_entry_value_with_name_fprint(
+     info_handle_t *info_handle,
+     libfshfs_file_entry_t *file_entry,
+     const system_character_t *path,
+     size_t path_length,
+     const system_character_t *file_entry_name,
+     size_t file_entry_name_length,
+     libcerror_error_t **error )
+{
+	char md5_string[ DIGEST_HASH_STRING_SIZE_MD5 ]    = {
+		'0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0',
+		'0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0',
+		0 };
+
+	char file_mode_string[ 11 ]                       = { '-', '-', '-', '-', '-', '-', '-', '-', '-', '-', 0 };
+
+	libfshfs_extended_attribute_t *extended_attribute = NULL;
+	system_character_t *extended_attribute_name       = NULL;
+	system_character_t *symbolic_link_target          = NULL;
+	static char *function                             = "info_handle_file_entry_value_with_name_fprint";
+	size64_t size                                     = 0;
+	size_t extended_attribute_name_size               = 0;
+	size_t symbolic_link_target_size                  = 0;
+	uint32_t access_time                              = 0;
+	uint32_t backup_time                              = 0;
+	uint32_t creation_time                            = 0;
+	uint32_t entry_modification_time                  = 0;
+	uint32_t file_entry_identifier                    = 0;
+	uint32_t group_identifier                         = 0;
+	uint32_t link_identifier                          = 0;
+	uint32_t major_device_number                      = 0;
+	uint32_t minor_device_number                      = 0;
+	uint32_t modification_time                        = 0;
+	uint32_t number_of_links                          = 0;
+	uint32_t owner_identifier                         = 0;
+	uint32_t parent_identifier                        = 0;
+	int32_t added_time                                = 0;
+	uint16_t file_mode                                = 0;
+	int extended_attribute_index                      = 0;
+	int has_access_time                               = 0;
+	int has_entry_modification_time                   = 0;
+	int number_of_extended_attributes                 = 0;
+	int result                                        = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfshfs_file_entry_get_identifier(
+	     file_entry,
+	     &file_entry_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfshfs_file_entry_get_modification_time(
+	     file_entry,
+	     &modification_time,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -1417,71 +1750,20 @@ int info_handle_file_entry_value_with_name_fprint(
 
 		goto on_error;
 	}
-/* TODO move into function */
-	if( ( file_mode & 0x0001 ) != 0 )
-	{
-		file_mode_string[ 9 ] = 'x';
-	}
-	if( ( file_mode & 0x0002 ) != 0 )
-	{
-		file_mode_string[ 8 ] = 'w';
-	}
-	if( ( file_mode & 0x0004 ) != 0 )
-	{
-		file_mode_string[ 7 ] = 'r';
-	}
-	if( ( file_mode & 0x0008 ) != 0 )
-	{
-		file_mode_string[ 6 ] = 'x';
-	}
-	if( ( file_mode & 0x0010 ) != 0 )
-	{
-		file_mode_string[ 5 ] = 'w';
-	}
-	if( ( file_mode & 0x0020 ) != 0 )
-	{
-		file_mode_string[ 4 ] = 'r';
-	}
-	if( ( file_mode & 0x0040 ) != 0 )
-	{
-		file_mode_string[ 3 ] = 'x';
-	}
-	if( ( file_mode & 0x0080 ) != 0 )
-	{
-		file_mode_string[ 2 ] = 'w';
-	}
-	if( ( file_mode & 0x0100 ) != 0 )
-	{
-		file_mode_string[ 1 ] = 'r';
-	}
-	switch( file_mode & 0xf000 )
+	if( info_handle_file_mode_string_copy(
+	     file_mode,
+	     file_mode_string,
+	     11,
+	     error ) != 1 )
 	{
-		case 0x1000:
-			file_mode_string[ 0 ] = 'p';
-			break;
-
-		case 0x2000:
-			file_mode_string[ 0 ] = 'c';
-			break;
-
-		case 0x4000:
-			file_mode_string[ 0 ] = 'd';
-			break;
-
-		case 0x6000:
-			file_mode_string[ 0 ] = 'b';
-			break;
-
-		case 0xa000:
-			file_mode_string[ 0 ] = 'l';
-			break;
-
-		case 0xc000:
-			file_mode_string[ 0 ] = 's';
-			break;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set file mode string.",
+		 function );
 
-		default:
-			break;
+		goto on_error;
 	}
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 	result = libfshfs_file_entry_get_utf16_symbolic_link_target_size(
@@ -2499,11 +2781,22 @@ int info_handle_file_entries_fprint(
      info_handle_t *info_handle,
      libcerror_error_t **error )
 {
-	static char *function           = "info_handle_file_entries_fprint";
-	uint64_t file_entry_identifier  = 0;
-	uint32_t number_of_file_entries = 0;
+	static char *function      = "info_handle_file_entries_fprint";
+	uint32_t identifier        = 0;
+	int file_entry_index       = 0;
+	int number_of_file_entries = 0;
 
-/* TODO
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
 	if( libfshfs_volume_get_number_of_file_entries(
 	     info_handle->input_volume,
 	     &number_of_file_entries,
@@ -2518,23 +2811,42 @@ int info_handle_file_entries_fprint(
 
 		return( -1 );
 	}
-*/
-	for( file_entry_identifier = 0;
-	     file_entry_identifier < (uint64_t) number_of_file_entries;
-	     file_entry_identifier++ )
+	for( file_entry_index = 0;
+	     file_entry_index < number_of_file_entries;
+	     file_entry_index++ )
 	{
+		if( info_handle->abort != 0 )
+		{
+			break;
+		}
+		if( libfshfs_volume_get_file_entry_identifier_by_index(
+		     info_handle->input_volume,
+		     file_entry_index,
+		     &identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve identifier of file entry: %d.",
+			 function,
+			 file_entry_index );
+
+			return( -1 );
+		}
 		if( info_handle_file_entry_fprint_by_identifier(
 		     info_handle,
-		     (uint32_t) file_entry_identifier,
-		     error ) != 1 )
+		     identifier,
+		     error ) == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-			 "%s: unable to print file entry: %" PRIu64 " information.",
+			 "%s: unable to print file entry: %" PRIu32 " information.",
 			 function,
-			 file_entry_identifier );
+			 identifier );
 
 			return( -1 );
 		}
@@ -2983,6 +3295,1541 @@ on_error:
 	return( -1 );
 }
 
+/* Appends a catalog record to the catalog entries
+ * Callback function for libfshfs_volume_iterate_catalog_records
+ * Returns 1 to continue, 0 to stop or -1 on error
+ */
+int info_handle_catalog_record_callback(
+     uint32_t parent_identifier,
+     const uint8_t *name_data,
+     size_t name_size,
+     const libfshfs_file_entry_stat_t *stat_value,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_catalog_record_callback";
+
+	if( catalog_entries_append_entry(
+	     (catalog_entries_t *) callback_data,
+	     parent_identifier,
+	     name_data,
+	     name_size,
+	     stat_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append catalog entry: %" PRIu32 ".",
+		 function,
+		 stat_value->identifier );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Closes the file entry and MD5 context of a MD5 hash job
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_md5_hash_job_close(
+     info_handle_md5_hash_job_t *md5_hash_job,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_md5_hash_job_close";
+	int result            = 1;
+
+	if( md5_hash_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MD5 hash job.",
+		 function );
+
+		return( -1 );
+	}
+	if( md5_hash_job->md5_context != NULL )
+	{
+		if( libhmac_md5_free(
+		     &( md5_hash_job->md5_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free MD5 context.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( md5_hash_job->file_entry != NULL )
+	{
+		if( libfshfs_file_entry_free(
+		     &( md5_hash_job->file_entry ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file entry.",
+			 function );
+
+			result = -1;
+		}
+	}
+	md5_hash_job->catalog_entry = NULL;
+
+	return( result );
+}
+
+/* Finalizes the MD5 hash of the catalog entry of a MD5 hash job
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_md5_hash_job_finalize(
+     info_handle_md5_hash_job_t *md5_hash_job,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_md5_hash_job_finalize";
+
+	if( md5_hash_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MD5 hash job.",
+		 function );
+
+		return( -1 );
+	}
+	if( md5_hash_job->catalog_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid MD5 hash job - missing catalog entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libhmac_md5_finalize(
+	     md5_hash_job->md5_context,
+	     md5_hash_job->catalog_entry->md5_hash,
+	     LIBHMAC_MD5_HASH_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize MD5 hash.",
+		 function );
+
+		return( -1 );
+	}
+	md5_hash_job->catalog_entry->has_md5_hash = 1;
+
+	if( info_handle_md5_hash_job_close(
+	     md5_hash_job,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to close MD5 hash job.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Submits a read of the next part of the data of the file entry of a MD5 hash job
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_md5_hash_job_submit_read(
+     info_handle_md5_hash_job_t *md5_hash_job,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_md5_hash_job_submit_read";
+	size_t read_size      = 0;
+
+	if( md5_hash_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MD5 hash job.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) md5_hash_job->data_offset >= md5_hash_job->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid MD5 hash job - data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	read_size = md5_hash_job->read_buffer_size;
+
+	if( (size64_t) read_size > ( md5_hash_job->data_size - md5_hash_job->data_offset ) )
+	{
+		read_size = (size_t) ( md5_hash_job->data_size - md5_hash_job->data_offset );
+	}
+	if( libfshfs_read_queue_submit_file_entry_read(
+	     md5_hash_job->read_queue,
+	     md5_hash_job->file_entry,
+	     md5_hash_job->read_buffer,
+	     read_size,
+	     md5_hash_job->data_offset,
+	     &info_handle_md5_hash_job_read_completed,
+	     (void *) md5_hash_job,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to submit read of file entry: %" PRIu32 " at offset: %" PRIi64 ".",
+		 function,
+		 md5_hash_job->catalog_entry->stat_value.identifier,
+		 md5_hash_job->data_offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Starts calculating the MD5 hash of the next regular file in a MD5 hash job
+ * Returns 1 if a read was submitted, 0 if no regular files remain or -1 on error
+ */
+int info_handle_md5_hash_job_start(
+     info_handle_md5_hash_job_t *md5_hash_job,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_md5_hash_job_start";
+
+	if( md5_hash_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MD5 hash job.",
+		 function );
+
+		return( -1 );
+	}
+	if( md5_hash_job->info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid MD5 hash job - missing info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( md5_hash_job->next_reference_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid MD5 hash job - missing next reference index.",
+		 function );
+
+		return( -1 );
+	}
+	while( *( md5_hash_job->next_reference_index ) < md5_hash_job->number_of_references )
+	{
+		if( md5_hash_job->info_handle->abort != 0 )
+		{
+			break;
+		}
+		md5_hash_job->catalog_entry = md5_hash_job->catalog_entry_references[ *( md5_hash_job->next_reference_index ) ];
+
+		*( md5_hash_job->next_reference_index ) += 1;
+
+		if( libfshfs_volume_get_file_entry_by_identifier(
+		     md5_hash_job->info_handle->input_volume,
+		     md5_hash_job->catalog_entry->stat_value.identifier,
+		     &( md5_hash_job->file_entry ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file entry: %" PRIu32 ".",
+			 function,
+			 md5_hash_job->catalog_entry->stat_value.identifier );
+
+			goto on_error;
+		}
+		if( libfshfs_file_entry_get_size(
+		     md5_hash_job->file_entry,
+		     &( md5_hash_job->data_size ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size.",
+			 function );
+
+			goto on_error;
+		}
+		if( libhmac_md5_initialize(
+		     &( md5_hash_job->md5_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize MD5 context.",
+			 function );
+
+			goto on_error;
+		}
+		md5_hash_job->data_offset = 0;
+
+		if( md5_hash_job->data_size > 0 )
+		{
+			if( info_handle_md5_hash_job_submit_read(
+			     md5_hash_job,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to submit read.",
+				 function );
+
+				goto on_error;
+			}
+			return( 1 );
+		}
+		if( info_handle_md5_hash_job_finalize(
+		     md5_hash_job,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize MD5 hash job.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 0 );
+
+on_error:
+	info_handle_md5_hash_job_close(
+	 md5_hash_job,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Updates the MD5 hash with the data read by the read queue
+ * Completion function for libfshfs_read_queue_submit_file_entry_read
+ * The read of the next part of the data, or of the next regular file,
+ * is submitted to the read queue from this function
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_md5_hash_job_read_completed(
+     uint8_t *buffer,
+     ssize_t read_count,
+     void *completion_data,
+     libcerror_error_t **error )
+{
+	info_handle_md5_hash_job_t *md5_hash_job = NULL;
+	static char *function                    = "info_handle_md5_hash_job_read_completed";
+
+	if( completion_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid completion data.",
+		 function );
+
+		return( -1 );
+	}
+	md5_hash_job = (info_handle_md5_hash_job_t *) completion_data;
+
+	if( md5_hash_job->catalog_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid MD5 hash job - missing catalog entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_count <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data of file entry: %" PRIu32 " at offset: %" PRIi64 ".",
+		 function,
+		 md5_hash_job->catalog_entry->stat_value.identifier,
+		 md5_hash_job->data_offset );
+
+		return( -1 );
+	}
+	if( libhmac_md5_update(
+	     md5_hash_job->md5_context,
+	     buffer,
+	     (size_t) read_count,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update MD5 hash.",
+		 function );
+
+		return( -1 );
+	}
+	md5_hash_job->data_offset += (off64_t) read_count;
+
+	if( md5_hash_job->info_handle->abort != 0 )
+	{
+		return( 1 );
+	}
+	if( (size64_t) md5_hash_job->data_offset < md5_hash_job->data_size )
+	{
+		if( info_handle_md5_hash_job_submit_read(
+		     md5_hash_job,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to submit read.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( info_handle_md5_hash_job_finalize(
+	     md5_hash_job,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize MD5 hash job.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle_md5_hash_job_start(
+	     md5_hash_job,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to start MD5 hash job.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Calculates the MD5 hashes of the regular files in the catalog entries
+ * The files are read in order of the offset of their first extent
+ * to reduce seeking in the volume
+ * The data is read by the worker threads of a read queue, multiple files
+ * are hashed concurrently and the MD5 hashes are updated as the reads complete
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_catalog_entries_calculate_md5(
+     info_handle_t *info_handle,
+     catalog_entries_t *catalog_entries,
+     libcerror_error_t **error )
+{
+	catalog_entry_t **catalog_entry_references = NULL;
+	catalog_entry_t *catalog_entry             = NULL;
+	info_handle_md5_hash_job_t *md5_hash_jobs  = NULL;
+	libfshfs_file_entry_t *file_entry          = NULL;
+	libfshfs_read_queue_t *read_queue          = NULL;
+	static char *function                      = "info_handle_catalog_entries_calculate_md5";
+	size64_t extent_size                       = 0;
+	uint32_t extent_flags                      = 0;
+	int entry_index                            = 0;
+	int job_index                              = 0;
+	int next_reference_index                   = 0;
+	int number_of_completed_requests           = 0;
+	int number_of_extents                      = 0;
+	int number_of_jobs                         = 0;
+	int number_of_references                   = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog_entries->number_of_entries == 0 )
+	{
+		return( 1 );
+	}
+	catalog_entry_references = (catalog_entry_t **) memory_allocate(
+	                                                 sizeof( catalog_entry_t * ) * catalog_entries->number_of_entries );
+
+	if( catalog_entry_references == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create catalog entry references.",
+		 function );
+
+		goto on_error;
+	}
+	/* Determine the offset of the first extent of every regular file
+	 */
+	for( entry_index = 0;
+	     entry_index < catalog_entries->number_of_entries;
+	     entry_index++ )
+	{
+		if( info_handle->abort != 0 )
+		{
+			break;
+		}
+		catalog_entry = &( catalog_entries->entries[ entry_index ] );
+
+		if( ( catalog_entry->stat_value.file_mode & 0xf000 ) != LIBFSHFS_FILE_TYPE_REGULAR_FILE )
+		{
+			continue;
+		}
+		if( libfshfs_volume_get_file_entry_by_identifier(
+		     info_handle->input_volume,
+		     catalog_entry->stat_value.identifier,
+		     &file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file entry: %" PRIu32 ".",
+			 function,
+			 catalog_entry->stat_value.identifier );
+
+			goto on_error;
+		}
+		if( libfshfs_file_entry_get_number_of_extents(
+		     file_entry,
+		     &number_of_extents,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of extents.",
+			 function );
+
+			goto on_error;
+		}
+		if( number_of_extents > 0 )
+		{
+			if( libfshfs_file_entry_get_extent_by_index(
+			     file_entry,
+			     0,
+			     &( catalog_entry->extent_offset ),
+			     &extent_size,
+			     &extent_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve extent: 0.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libfshfs_file_entry_free(
+		     &file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file entry.",
+			 function );
+
+			goto on_error;
+		}
+		catalog_entry_references[ number_of_references++ ] = catalog_entry;
+	}
+	if( number_of_references > 1 )
+	{
+		qsort(
+		 catalog_entry_references,
+		 (size_t) number_of_references,
+		 sizeof( catalog_entry_t * ),
+		 &catalog_entries_entry_reference_compare_by_extent_offset );
+	}
+	if( number_of_references == 0 )
+	{
+		memory_free(
+		 catalog_entry_references );
+
+		return( 1 );
+	}
+	/* Every MD5 hash job has at most 1 outstanding read, use twice the number
+	 * of threads so that the worker threads remain busy while the MD5 hashes
+	 * are updated
+	 */
+	number_of_jobs = info_handle->number_of_threads * 2;
+
+	if( number_of_jobs < 1 )
+	{
+		number_of_jobs = 1;
+	}
+	else if( number_of_jobs > number_of_references )
+	{
+		number_of_jobs = number_of_references;
+	}
+	if( libfshfs_read_queue_initialize(
+	     &read_queue,
+	     info_handle->number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read queue.",
+		 function );
+
+		goto on_error;
+	}
+	md5_hash_jobs = (info_handle_md5_hash_job_t *) memory_allocate(
+	                                                sizeof( info_handle_md5_hash_job_t ) * number_of_jobs );
+
+	if( md5_hash_jobs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create MD5 hash jobs.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     md5_hash_jobs,
+	     0,
+	     sizeof( info_handle_md5_hash_job_t ) * number_of_jobs ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear MD5 hash jobs.",
+		 function );
+
+		memory_free(
+		 md5_hash_jobs );
+
+		md5_hash_jobs = NULL;
+
+		goto on_error;
+	}
+	for( job_index = 0;
+	     job_index < number_of_jobs;
+	     job_index++ )
+	{
+		md5_hash_jobs[ job_index ].info_handle              = info_handle;
+		md5_hash_jobs[ job_index ].read_queue               = read_queue;
+		md5_hash_jobs[ job_index ].catalog_entry_references = catalog_entry_references;
+		md5_hash_jobs[ job_index ].number_of_references     = number_of_references;
+		md5_hash_jobs[ job_index ].next_reference_index     = &next_reference_index;
+		md5_hash_jobs[ job_index ].read_buffer_size         = INFO_HANDLE_READ_BUFFER_SIZE;
+
+		md5_hash_jobs[ job_index ].read_buffer = (uint8_t *) memory_allocate(
+		                                                      sizeof( uint8_t ) * INFO_HANDLE_READ_BUFFER_SIZE );
+
+		if( md5_hash_jobs[ job_index ].read_buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create read buffer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( job_index = 0;
+	     job_index < number_of_jobs;
+	     job_index++ )
+	{
+		if( info_handle_md5_hash_job_start(
+		     &( md5_hash_jobs[ job_index ] ),
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to start MD5 hash job: %d.",
+			 function,
+			 job_index );
+
+			goto on_error;
+		}
+	}
+	/* The completion function of the MD5 hash jobs submits the next read,
+	 * hence wait returns when all regular files have been hashed
+	 */
+	if( libfshfs_read_queue_wait(
+	     read_queue,
+	     &number_of_completed_requests,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to calculate MD5 hashes.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfshfs_read_queue_free(
+	     &read_queue,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free read queue.",
+		 function );
+
+		goto on_error;
+	}
+	for( job_index = 0;
+	     job_index < number_of_jobs;
+	     job_index++ )
+	{
+		/* The MD5 hash job can still be open if abort was signalled
+		 */
+		if( info_handle_md5_hash_job_close(
+		     &( md5_hash_jobs[ job_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to close MD5 hash job: %d.",
+			 function,
+			 job_index );
+
+			goto on_error;
+		}
+		memory_free(
+		 md5_hash_jobs[ job_index ].read_buffer );
+
+		md5_hash_jobs[ job_index ].read_buffer = NULL;
+	}
+	memory_free(
+	 md5_hash_jobs );
+
+	memory_free(
+	 catalog_entry_references );
+
+	return( 1 );
+
+on_error:
+	/* The read queue is freed before the MD5 hash jobs since outstanding
+	 * reads use the read buffers of the MD5 hash jobs
+	 */
+	if( read_queue != NULL )
+	{
+		libfshfs_read_queue_free(
+		 &read_queue,
+		 NULL );
+	}
+	if( md5_hash_jobs != NULL )
+	{
+		for( job_index = 0;
+		     job_index < number_of_jobs;
+		     job_index++ )
+		{
+			info_handle_md5_hash_job_close(
+			 &( md5_hash_jobs[ job_index ] ),
+			 NULL );
+
+			if( md5_hash_jobs[ job_index ].read_buffer != NULL )
+			{
+				memory_free(
+				 md5_hash_jobs[ job_index ].read_buffer );
+			}
+		}
+		memory_free(
+		 md5_hash_jobs );
+	}
+	if( file_entry != NULL )
+	{
+		libfshfs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	if( catalog_entry_references != NULL )
+	{
+		memory_free(
+		 catalog_entry_references );
+	}
+	return( -1 );
+}
+
+/* Prints a catalog entry
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_catalog_entry_fprint(
+     info_handle_t *info_handle,
+     catalog_entries_t *catalog_entries,
+     catalog_entry_t *catalog_entry,
+     const system_character_t *path,
+     size_t path_length,
+     libcerror_error_t **error )
+{
+	char md5_string[ DIGEST_HASH_STRING_SIZE_MD5 ] = {
+		'0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0',
+		'0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0',
+		0 };
+
+	char file_mode_string[ 11 ];
+
+	libfshfs_file_entry_t *file_entry              = NULL;
+	system_character_t *symbolic_link_target       = NULL;
+	static char *function                          = "info_handle_catalog_entry_fprint";
+	size_t symbolic_link_target_size               = 0;
+	int result                                     = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->bodyfile_stream != NULL )
+	{
+		/* The symbolic link target is stored in the data fork
+		 */
+		if( ( catalog_entry->stat_value.file_mode & 0xf000 ) == LIBFSHFS_FILE_TYPE_SYMBOLIC_LINK )
+		{
+			if( libfshfs_volume_get_file_entry_by_identifier(
+			     info_handle->input_volume,
+			     catalog_entry->stat_value.identifier,
+			     &file_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve file entry: %" PRIu32 ".",
+				 function,
+				 catalog_entry->stat_value.identifier );
+
+				goto on_error;
+			}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libfshfs_file_entry_get_utf16_symbolic_link_target_size(
+			          file_entry,
+			          &symbolic_link_target_size,
+			          error );
+#else
+			result = libfshfs_file_entry_get_utf8_symbolic_link_target_size(
+			          file_entry,
+			          &symbolic_link_target_size,
+			          error );
+#endif
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve symbolic link target string size.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				symbolic_link_target = system_string_allocate(
+				                        symbolic_link_target_size );
+
+				if( symbolic_link_target == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create symbolic link target string.",
+					 function );
+
+					goto on_error;
+				}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+				result = libfshfs_file_entry_get_utf16_symbolic_link_target(
+				          file_entry,
+				          (uint16_t *) symbolic_link_target,
+				          symbolic_link_target_size,
+				          error );
+#else
+				result = libfshfs_file_entry_get_utf8_symbolic_link_target(
+				          file_entry,
+				          (uint8_t *) symbolic_link_target,
+				          symbolic_link_target_size,
+				          error );
+#endif
+				if( result != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve symbolic link target string.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( libfshfs_file_entry_free(
+			     &file_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file entry.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( info_handle->calculate_md5 == 0 )
+		{
+			md5_string[ 1 ] = 0;
+		}
+		else if( catalog_entry->has_md5_hash != 0 )
+		{
+			if( digest_hash_copy_to_string(
+			     catalog_entry->md5_hash,
+			     LIBHMAC_MD5_HASH_SIZE,
+			     md5_string,
+			     DIGEST_HASH_STRING_SIZE_MD5,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set MD5 hash string.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( info_handle_file_mode_string_copy(
+		     catalog_entry->stat_value.file_mode,
+		     file_mode_string,
+		     11,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set file mode string.",
+			 function );
+
+			goto on_error;
+		}
+		/* Colums in a Sleuthkit 3.x and later bodyfile
+		 * MD5|name|inode|mode_as_string|UID|GID|size|atime|mtime|ctime|crtime
+		 */
+		fprintf(
+		 info_handle->bodyfile_stream,
+		 "%s|",
+		 md5_string );
+	}
+	if( info_handle_name_value_fprint(
+	     info_handle,
+	     path,
+	     path_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print path string.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( catalog_entry->name_length > 0 )
+	 && ( catalog_entry->stat_value.identifier != 2 ) )
+	{
+		if( info_handle_name_value_fprint(
+		     info_handle,
+		     &( catalog_entries->names[ catalog_entry->name_offset ] ),
+		     catalog_entry->name_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print file entry name string.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( info_handle->bodyfile_stream != NULL )
+	{
+		if( symbolic_link_target != NULL )
+		{
+			fprintf(
+			 info_handle->bodyfile_stream,
+			 " -> %" PRIs_SYSTEM "",
+			 symbolic_link_target );
+
+			memory_free(
+			 symbolic_link_target );
+
+			symbolic_link_target = NULL;
+		}
+		fprintf(
+		 info_handle->bodyfile_stream,
+		 "|%" PRIu32 "|%s|%" PRIu32 "|%" PRIu32 "|%" PRIu64 "|%" PRIi64 "|%" PRIi64 "|%" PRIi64 "|%" PRIi64 "\n",
+		 catalog_entry->stat_value.identifier,
+		 file_mode_string,
+		 catalog_entry->stat_value.owner_identifier,
+		 catalog_entry->stat_value.group_identifier,
+		 catalog_entry->stat_value.data_fork_size,
+		 (int64_t) catalog_entry->stat_value.access_time - 2082844800,
+		 (int64_t) catalog_entry->stat_value.modification_time - 2082844800,
+		 (int64_t) catalog_entry->stat_value.entry_modification_time - 2082844800,
+		 (int64_t) catalog_entry->stat_value.creation_time - 2082844800 );
+	}
+	else
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "\n" );
+	}
+	return( 1 );
+
+on_error:
+	if( symbolic_link_target != NULL )
+	{
+		memory_free(
+		 symbolic_link_target );
+	}
+	if( file_entry != NULL )
+	{
+		libfshfs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Prints the file system hierarchy using a single pass over the catalog
+ * The paths are reconstructed from the parent identifiers of the catalog records
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_file_system_hierarchy_fprint_single_pass(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	catalog_entries_t *catalog_entries = NULL;
+	system_character_t *path           = NULL;
+	static char *function              = "info_handle_file_system_hierarchy_fprint_single_pass";
+	size_t path_length                 = 0;
+	size_t path_size                   = 0;
+	uint8_t file_system_type           = 0;
+	int entry_index                    = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->bodyfile_stream == NULL )
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "Hierarchical File System information:\n\n" );
+
+		fprintf(
+		 info_handle->notify_stream,
+		 "File system hierarchy:\n" );
+	}
+	if( libfshfs_volume_get_file_system_type(
+	     info_handle->input_volume,
+	     &file_system_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file system type.",
+		 function );
+
+		goto on_error;
+	}
+	if( catalog_entries_initialize(
+	     &catalog_entries,
+	     file_system_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create catalog entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfshfs_volume_iterate_catalog_records(
+	     info_handle->input_volume,
+	     &info_handle_catalog_record_callback,
+	     (void *) catalog_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to iterate catalog records.",
+		 function );
+
+		goto on_error;
+	}
+	if( catalog_entries_sort(
+	     catalog_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to sort catalog entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( info_handle->bodyfile_stream != NULL )
+	 && ( info_handle->calculate_md5 != 0 ) )
+	{
+		if( info_handle_catalog_entries_calculate_md5(
+		     info_handle,
+		     catalog_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate MD5 hashes.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( entry_index = 0;
+	     entry_index < catalog_entries->number_of_entries;
+	     entry_index++ )
+	{
+		if( info_handle->abort != 0 )
+		{
+			break;
+		}
+		if( catalog_entries_get_parent_path(
+		     catalog_entries,
+		     &( catalog_entries->entries[ entry_index ] ),
+		     &path,
+		     &path_size,
+		     &path_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve path of catalog entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( info_handle_catalog_entry_fprint(
+		     info_handle,
+		     catalog_entries,
+		     &( catalog_entries->entries[ entry_index ] ),
+		     path,
+		     path_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print catalog entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+	}
+	if( path != NULL )
+	{
+		memory_free(
+		 path );
+
+		path = NULL;
+	}
+	if( catalog_entries_free(
+	     &catalog_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free catalog entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( info_handle->bodyfile_stream == NULL )
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "\n" );
+	}
+	return( 1 );
+
+on_error:
+	if( path != NULL )
+	{
+		memory_free(
+		 path );
+	}
+	if( catalog_entries != NULL )
+	{
+		catalog_entries_free(
+		 &catalog_entries,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Prints the current unallocated run
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_unallocated_run_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_unallocated_run_fprint";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->unallocated_run_size == 0 )
+	{
+		return( 1 );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tOffset: 0x%08" PRIx64 " - 0x%08" PRIx64 " (size: %" PRIu64 ")\tfile offset: 0x%08" PRIx64 "\n",
+	 info_handle->unallocated_run_offset,
+	 info_handle->unallocated_run_offset + (off64_t) info_handle->unallocated_run_size,
+	 info_handle->unallocated_run_size,
+	 info_handle->unallocated_run_output_offset );
+
+	info_handle->unallocated_run_output_offset += (off64_t) info_handle->unallocated_run_size;
+	info_handle->unallocated_run_size           = 0;
+
+	return( 1 );
+}
+
+/* Writes unallocated blocks to the unallocated space stream
+ * Callback function for libfshfs_volume_read_unallocated_blocks
+ * Returns 1 to continue, 0 to stop or -1 on error
+ */
+int info_handle_unallocated_blocks_callback(
+     off64_t volume_offset,
+     const uint8_t *data,
+     size_t data_size,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	info_handle_t *info_handle = NULL;
+	static char *function      = "info_handle_unallocated_blocks_callback";
+	ssize_t write_count        = 0;
+
+	if( callback_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback data.",
+		 function );
+
+		return( -1 );
+	}
+	info_handle = (info_handle_t *) callback_data;
+
+	if( info_handle->unallocated_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid info handle - missing unallocated space stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->abort != 0 )
+	{
+		return( 0 );
+	}
+	/* A run is read with multiple reads when it is larger than the read size
+	 */
+	if( ( info_handle->unallocated_run_size != 0 )
+	 && ( volume_offset != ( info_handle->unallocated_run_offset + (off64_t) info_handle->unallocated_run_size ) ) )
+	{
+		if( info_handle_unallocated_run_fprint(
+		     info_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print unallocated run.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( info_handle->unallocated_run_size == 0 )
+	{
+		info_handle->unallocated_run_offset = volume_offset;
+	}
+	write_count = file_stream_write(
+	               info_handle->unallocated_stream,
+	               data,
+	               data_size );
+
+	if( write_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write unallocated space.",
+		 function );
+
+		return( -1 );
+	}
+	info_handle->unallocated_run_size += (size64_t) data_size;
+
+	return( 1 );
+}
+
+/* Prints the unallocated space and writes it to the unallocated space stream
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_unallocated_space_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_unallocated_space_fprint";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "Hierarchical File System information:\n\n" );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "Unallocated space:\n" );
+
+	info_handle->unallocated_run_offset        = 0;
+	info_handle->unallocated_run_size          = 0;
+	info_handle->unallocated_run_output_offset = 0;
+
+	if( libfshfs_volume_read_unallocated_blocks(
+	     info_handle->input_volume,
+	     INFO_HANDLE_UNALLOCATED_READ_SIZE,
+	     &info_handle_unallocated_blocks_callback,
+	     (void *) info_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read unallocated blocks.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle_unallocated_run_fprint(
+	     info_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print unallocated run.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tTotal size\t\t\t\t: %" PRIu64 " bytes\n",
+	 (size64_t) info_handle->unallocated_run_output_offset );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	return( 1 );
+}
+
 /* Prints the volume information
  * Returns 1 if successful or -1 on error
  */
@@ -27,8 +27,10 @@
 #include <types.h>
 
 #include "fshfstools_libbfio.h"
+#include "catalog_entries.h"
 #include "fshfstools_libcerror.h"
 #include "fshfstools_libfshfs.h"
+#include "fshfstools_libhmac.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -54,10 +56,30 @@ struct info_handle
 	 */
 	uint8_t calculate_md5;
 
+	/* The number of threads used to read the data of which the MD5 hash is calculated
+	 */
+	int number_of_threads;
+
 	/* The bodyfile output stream
 	 */
 	FILE *bodyfile_stream;
 
+	/* The unallocated space output stream
+	 */
+	FILE *unallocated_stream;
+
+	/* The volume offset of the current unallocated run
+	 */
+	off64_t unallocated_run_offset;
+
+	/* The size of the current unallocated run
+	 */
+	size64_t unallocated_run_size;
+
+	/* The offset of the current unallocated run in the unallocated space output stream
+	 */
+	off64_t unallocated_run_output_offset;
+
 	/* The notification output stream
 	 */
 	FILE *notify_stream;
@@ -67,6 +89,59 @@ struct info_handle
 	int abort;
 };
 
+typedef struct info_handle_md5_hash_job info_handle_md5_hash_job_t;
+
+struct info_handle_md5_hash_job
+{
+	/* The info handle
+	 */
+	info_handle_t *info_handle;
+
+	/* The read queue
+	 */
+	libfshfs_read_queue_t *read_queue;
+
+	/* The catalog entry references, sorted by extent offset
+	 */
+	catalog_entry_t **catalog_entry_references;
+
+	/* The number of catalog entry references
+	 */
+	int number_of_references;
+
+	/* The index of the next catalog entry reference, shared by all jobs
+	 */
+	int *next_reference_index;
+
+	/* The catalog entry of which the MD5 hash is calculated
+	 */
+	catalog_entry_t *catalog_entry;
+
+	/* The file entry of which the MD5 hash is calculated
+	 */
+	libfshfs_file_entry_t *file_entry;
+
+	/* The MD5 context
+	 */
+	libhmac_md5_context_t *md5_context;
+
+	/* The read buffer
+	 */
+	uint8_t *read_buffer;
+
+	/* The read buffer size
+	 */
+	size_t read_buffer_size;
+
+	/* The data size of the file entry
+	 */
+	size64_t data_size;
+
+	/* The offset of the next read in the data of the file entry
+	 */
+	off64_t data_offset;
+};
+
 int info_handle_system_string_copy_from_64_bit_in_decimal(
      const system_character_t *string,
      size_t string_size,
@@ -91,11 +166,21 @@ int info_handle_set_bodyfile(
      const system_character_t *filename,
      libcerror_error_t **error );
 
+int info_handle_set_unallocated_file(
+     info_handle_t *info_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
 int info_handle_set_volume_offset(
      info_handle_t *info_handle,
      const system_character_t *string,
      libcerror_error_t **error );
 
+int info_handle_set_number_of_threads(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
 int info_handle_open_input(
      info_handle_t *info_handle,
      const system_character_t *filename,
@@ -105,6 +190,13 @@ int info_handle_close_input(
      info_handle_t *info_handle,
      libcerror_error_t **error );
 
+int info_handle_file_entry_calculate_md5_hash(
+     info_handle_t *info_handle,
+     libfshfs_file_entry_t *file_entry,
+     uint8_t *md5_hash,
+     size_t md5_hash_size,
+     libcerror_error_t **error );
+
 int info_handle_file_entry_calculate_md5(
      info_handle_t *info_handle,
      libfshfs_file_entry_t *file_entry,
@@ -130,6 +222,12 @@ int info_handle_posix_time_in_seconds_value_fprint(
      int32_t value_32bit,
      libcerror_error_t **error );
 
+int info_handle_file_mode_string_copy(
+     uint16_t file_mode,
+     char *file_mode_string,
+     size_t file_mode_string_size,
+     libcerror_error_t **error );
+
 int info_handle_file_entry_value_with_name_fprint(
      info_handle_t *info_handle,
      libfshfs_file_entry_t *file_entry,
@@ -164,6 +262,68 @@ int info_handle_file_system_hierarchy_fprint(
      info_handle_t *info_handle,
      libcerror_error_t **error );
 
+int info_handle_catalog_record_callback(
+     uint32_t parent_identifier,
+     const uint8_t *name_data,
+     size_t name_size,
+     const libfshfs_file_entry_stat_t *stat_value,
+     void *callback_data,
+     libcerror_error_t **error );
+
+int info_handle_md5_hash_job_close(
+     info_handle_md5_hash_job_t *md5_hash_job,
+     libcerror_error_t **error );
+
+int info_handle_md5_hash_job_finalize(
+     info_handle_md5_hash_job_t *md5_hash_job,
+     libcerror_error_t **error );
+
+int info_handle_md5_hash_job_submit_read(
+     info_handle_md5_hash_job_t *md5_hash_job,
+     libcerror_error_t **error );
+
+int info_handle_md5_hash_job_start(
+     info_handle_md5_hash_job_t *md5_hash_job,
+     libcerror_error_t **error );
+
+int info_handle_md5_hash_job_read_completed(
+     uint8_t *buffer,
+     ssize_t read_count,
+     void *completion_data,
+     libcerror_error_t **error );
+
+int info_handle_catalog_entries_calculate_md5(
+     info_handle_t *info_handle,
+     catalog_entries_t *catalog_entries,
+     libcerror_error_t **error );
+
+int info_handle_catalog_entry_fprint(
+     info_handle_t *info_handle,
+     catalog_entries_t *catalog_entries,
+     catalog_entry_t *catalog_entry,
+     const system_character_t *path,
+     size_t path_length,
+     libcerror_error_t **error );
+
+int info_handle_file_system_hierarchy_fprint_single_pass(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int info_handle_unallocated_run_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int info_handle_unallocated_blocks_callback(
+     off64_t volume_offset,
+     const uint8_t *data,
+     size_t data_size,
+     void *callback_data,
+     libcerror_error_t **error );
+
+int info_handle_unallocated_space_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
 int info_handle_volume_fprint(
      info_handle_t *info_handle,
      libcerror_error_t **error );
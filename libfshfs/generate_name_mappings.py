@@ -0,0 +1,332 @@
+#!/usr/bin/env python3
+#
+# Script to generate the name case folding and decomposition mappings.
+#
+# Version: 20261018
+
+import argparse
+import os
+import re
+import sys
+
+
+LICENSE = """/*
+ * {description}
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+"""
+
+GENERATED_NOTICE = """/* This file was generated by generate_name_mappings.py, do not edit
+ */
+"""
+
+
+def ReadCaseFoldingMappings(path):
+  """Reads the case folding mappings.
+
+  Args:
+    path (str): path of the case folding mappings definitions.
+
+  Returns:
+    dict[int, int]: case folded character per Unicode character.
+  """
+  mappings = {}
+  with open(path, "r", encoding="utf-8") as file_object:
+    for match in re.finditer(
+        r"\{ 0x([0-9a-f]{8}), 0x([0-9a-f]{8}) \}", file_object.read()):
+      unicode_character = int(match.group(1), 16)
+      character = int(match.group(2), 16)
+      if character != unicode_character:
+        mappings[unicode_character] = character
+
+  return mappings
+
+
+def ReadDecompositionMappings(path):
+  """Reads the decomposition mappings.
+
+  Args:
+    path (str): path of the decomposition mappings definitions.
+
+  Returns:
+    dict[int, list[int]]: decomposed characters per Unicode character.
+  """
+  mappings = {}
+  with open(path, "r", encoding="utf-8") as file_object:
+    for match in re.finditer(
+        r"\{ 0x([0-9a-f]{8}), (\d+), \{ ([0-9a-fx, ]+) \} \}",
+        file_object.read()):
+      unicode_character = int(match.group(1), 16)
+      characters = [
+          int(value, 16) for value in match.group(3).split(", ")]
+      if characters != [unicode_character]:
+        mappings[unicode_character] = characters
+
+  return mappings
+
+
+def GetPages(mappings):
+  """Determines the pages that contain mappings.
+
+  Args:
+    mappings (dict[int, object]): mappings per Unicode character.
+
+  Returns:
+    tuple[list[int], int]: page numbers that contain mappings and the number
+        of pages in the page table.
+  """
+  page_numbers = sorted(set(
+      unicode_character >> 8 for unicode_character in mappings.keys()))
+  return page_numbers, page_numbers[-1] + 1
+
+
+def WriteHeader(output_path, case_folding_pages, decomposition_pages):
+  """Writes the mappings header file.
+
+  Args:
+    output_path (str): path of the output directory.
+    case_folding_pages (tuple[list[int], int]): case folding pages.
+    decomposition_pages (tuple[list[int], int]): decomposition pages.
+  """
+  lines = [
+      LICENSE.format(description="Name case folding and decomposition mappings"),
+      GENERATED_NOTICE,
+      "#if !defined( _LIBFSHFS_NAME_MAPPINGS_H )",
+      "#define _LIBFSHFS_NAME_MAPPINGS_H",
+      "",
+      "#include <common.h>",
+      "#include <types.h>",
+      "",
+      '#include "libfshfs_extern.h"',
+      "",
+      "#if defined( __cplusplus )",
+      'extern "C" {',
+      "#endif",
+      "",
+      "#define LIBFSHFS_NAME_CASE_FOLDING_MAPPINGS_NUMBER_OF_PAGES\t\t"
+      "0x{0:04x}UL".format(case_folding_pages[1]),
+      "#define LIBFSHFS_NAME_DECOMPOSITION_MAPPINGS_NUMBER_OF_PAGES\t\t"
+      "0x{0:04x}UL".format(decomposition_pages[1]),
+      "",
+      "typedef struct libfshfs_name_decomposition_mapping "
+      "libfshfs_name_decomposition_mapping_t;",
+      "",
+      "struct libfshfs_name_decomposition_mapping",
+      "{",
+      "\t/* The number of characters",
+      "\t */",
+      "\tuint8_t number_of_characters;",
+      "",
+      "\t/* The characters",
+      "\t */",
+      "\tuint32_t characters[ 4 ];",
+      "};",
+      "",
+      "/* The case folding mappings, per page of 256 characters, where a page",
+      " * without mappings is NULL",
+      " */",
+      "LIBFSHFS_EXTERN_VARIABLE \\",
+      "uint32_t *libfshfs_name_case_folding_mappings[ {0:d} ];".format(
+          case_folding_pages[1]),
+      "",
+      "/* The decomposition mappings, per page of 256 characters, where a page",
+      " * without mappings is NULL",
+      " */",
+      "LIBFSHFS_EXTERN_VARIABLE \\",
+      ("libfshfs_name_decomposition_mapping_t "
+       "*libfshfs_name_decomposition_mappings[ {0:d} ];").format(
+           decomposition_pages[1]),
+      "",
+      "#if defined( __cplusplus )",
+      "}",
+      "#endif",
+      "",
+      "#endif /* !defined( _LIBFSHFS_NAME_MAPPINGS_H ) */",
+      "",
+      ""]
+
+  path = os.path.join(output_path, "libfshfs_name_mappings.h")
+  with open(path, "w", encoding="utf-8") as file_object:
+    file_object.write("\n".join(lines))
+
+
+def WritePageTable(lines, type_name, table_name, pages):
+  """Writes a page table.
+
+  Args:
+    lines (list[str]): output lines.
+    type_name (str): C type of the mappings.
+    table_name (str): name of the page table.
+    pages (tuple[list[int], int]): pages.
+  """
+  page_numbers, number_of_pages = pages
+
+  lines.append("{0:s} *{1:s}[ {2:d} ] = {{".format(
+      type_name, table_name, number_of_pages))
+
+  for page_number in range(number_of_pages):
+    if page_number in page_numbers:
+      value = "{0:s}_0x{1:08x}".format(table_name, page_number << 8)
+    else:
+      value = "NULL"
+
+    separator = "," if page_number + 1 < number_of_pages else ""
+    lines.append("\t/* 0x{0:08x} */ {1:s}{2:s}".format(
+        page_number << 8, value, separator))
+
+  lines.extend(["};", ""])
+
+
+def WriteSource(
+    output_path, case_folding_mappings, case_folding_pages,
+    decomposition_mappings, decomposition_pages):
+  """Writes the mappings source file.
+
+  Args:
+    output_path (str): path of the output directory.
+    case_folding_mappings (dict[int, int]): case folding mappings.
+    case_folding_pages (tuple[list[int], int]): case folding pages.
+    decomposition_mappings (dict[int, list[int]]): decomposition mappings.
+    decomposition_pages (tuple[list[int], int]): decomposition pages.
+  """
+  lines = [
+      LICENSE.format(description="Name case folding and decomposition mappings"),
+      GENERATED_NOTICE,
+      "#include <common.h>",
+      "#include <types.h>",
+      "",
+      '#include "libfshfs_name_mappings.h"',
+      "",
+      "/* The data below was derived from "
+      "ftp://ftp.unicode.org/Public/9.0.0/ucd/CaseFolding.txt",
+      " */",
+      ""]
+
+  for page_number in case_folding_pages[0]:
+    lines.append((
+        "static uint32_t "
+        "libfshfs_name_case_folding_mappings_0x{0:08x}[ 256 ] = {{").format(
+            page_number << 8))
+
+    for unicode_character in range(page_number << 8, (page_number + 1) << 8):
+      character = case_folding_mappings.get(
+          unicode_character, unicode_character)
+      separator = "," if unicode_character & 0xff != 0xff else ""
+      lines.append("\t/* 0x{0:08x} */ 0x{1:08x}{2:s}".format(
+          unicode_character, character, separator))
+
+    lines.extend(["};", ""])
+
+  WritePageTable(
+      lines, "uint32_t", "libfshfs_name_case_folding_mappings",
+      case_folding_pages)
+
+  lines.extend([
+      "/* The data below was derived from "
+      "ftp://ftp.unicode.org/Public/9.0.0/ucd/UnicodeData.txt",
+      " */",
+      ""])
+
+  for page_number in decomposition_pages[0]:
+    lines.append((
+        "static libfshfs_name_decomposition_mapping_t "
+        "libfshfs_name_decomposition_mappings_0x{0:08x}[ 256 ] = {{").format(
+            page_number << 8))
+
+    for unicode_character in range(page_number << 8, (page_number + 1) << 8):
+      characters = decomposition_mappings.get(
+          unicode_character, [unicode_character])
+      separator = "," if unicode_character & 0xff != 0xff else ""
+      lines.append("\t/* 0x{0:08x} */ {{ {1:d}, {{ {2:s} }} }}{3:s}".format(
+          unicode_character, len(characters), ", ".join([
+              "0x{0:08x}".format(character) for character in characters]),
+          separator))
+
+    lines.extend(["};", ""])
+
+  WritePageTable(
+      lines, "libfshfs_name_decomposition_mapping_t",
+      "libfshfs_name_decomposition_mappings", decomposition_pages)
+
+  lines.append("")
+
+  path = os.path.join(output_path, "libfshfs_name_mappings.c")
+  with open(path, "w", encoding="utf-8") as file_object:
+    file_object.write("\n".join(lines))
+
+
+def Main():
+  """The main program function.
+
+  Returns:
+    bool: True if successful or False if not.
+  """
+  script_path = os.path.dirname(os.path.abspath(__file__))
+  tests_path = os.path.join(os.path.dirname(script_path), "tests")
+
+  argument_parser = argparse.ArgumentParser(description=(
+      "Generates the name case folding and decomposition mappings."))
+
+  argument_parser.add_argument(
+      "--case-folding", dest="case_folding", type=str, action="store",
+      default=os.path.join(
+          tests_path, "fshfs_test_unicode_case_folding_mappings.h"),
+      help="path of the case folding mappings definitions.")
+
+  argument_parser.add_argument(
+      "--decomposition", dest="decomposition", type=str, action="store",
+      default=os.path.join(
+          tests_path, "fshfs_test_unicode_decomposition_mappings.h"),
+      help="path of the decomposition mappings definitions.")
+
+  argument_parser.add_argument(
+      "--output", dest="output", type=str, action="store",
+      default=script_path, help="path of the output directory.")
+
+  options = argument_parser.parse_args()
+
+  case_folding_mappings = ReadCaseFoldingMappings(options.case_folding)
+  decomposition_mappings = ReadDecompositionMappings(options.decomposition)
+
+  if not case_folding_mappings or not decomposition_mappings:
+    print("Missing mappings.")
+    return False
+
+  for characters in decomposition_mappings.values():
+    if len(characters) > 4:
+      print("Unsupported number of decomposed characters.")
+      return False
+
+  case_folding_pages = GetPages(case_folding_mappings)
+  decomposition_pages = GetPages(decomposition_mappings)
+
+  WriteHeader(options.output, case_folding_pages, decomposition_pages)
+
+  WriteSource(
+      options.output, case_folding_mappings, case_folding_pages,
+      decomposition_mappings, decomposition_pages)
+
+  return True
+
+
+if __name__ == "__main__":
+  if not Main():
+    sys.exit(1)
+  else:
+    sys.exit(0)
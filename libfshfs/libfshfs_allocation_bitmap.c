@@ -0,0 +1,1101 @@
+/*
+ * Allocation bitmap functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfshfs_allocation_bitmap.h"
+#include "libfshfs_definitions.h"
+#include "libfshfs_libbfio.h"
+#include "libfshfs_libcerror.h"
+#include "libfshfs_libcnotify.h"
+#include "libfshfs_libfdata.h"
+
+/* Creates an allocation bitmap
+ * Make sure the value allocation_bitmap is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_allocation_bitmap_initialize(
+     libfshfs_allocation_bitmap_t **allocation_bitmap,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_allocation_bitmap_initialize";
+
+	if( allocation_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocation bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	if( *allocation_bitmap != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid allocation bitmap value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*allocation_bitmap = memory_allocate_structure(
+	                      libfshfs_allocation_bitmap_t );
+
+	if( *allocation_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create allocation bitmap.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *allocation_bitmap,
+	     0,
+	     sizeof( libfshfs_allocation_bitmap_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear allocation bitmap.",
+		 function );
+
+		goto on_error;
+	}
+	( *allocation_bitmap )->chunk_size = LIBFSHFS_ALLOCATION_BITMAP_CHUNK_SIZE;
+
+	return( 1 );
+
+on_error:
+	if( *allocation_bitmap != NULL )
+	{
+		memory_free(
+		 *allocation_bitmap );
+
+		*allocation_bitmap = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an allocation bitmap
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_allocation_bitmap_free(
+     libfshfs_allocation_bitmap_t **allocation_bitmap,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_allocation_bitmap_free";
+	int result            = 1;
+
+	if( allocation_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocation bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	if( *allocation_bitmap != NULL )
+	{
+		if( libfshfs_allocation_bitmap_free_data(
+		     *allocation_bitmap,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free data.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *allocation_bitmap );
+
+		*allocation_bitmap = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves the number of bits set in a 64-bit value
+ * Returns the number of bits set
+ */
+uint32_t libfshfs_allocation_bitmap_get_population_count(
+          uint64_t value )
+{
+#if defined( __GNUC__ ) || defined( __clang__ )
+	return( (uint32_t) __builtin_popcountll( (unsigned long long) value ) );
+#else
+	value = value - ( ( value >> 1 ) & 0x5555555555555555UL );
+	value = ( value & 0x3333333333333333UL ) + ( ( value >> 2 ) & 0x3333333333333333UL );
+	value = ( value + ( value >> 4 ) ) & 0x0f0f0f0f0f0f0f0fUL;
+
+	return( (uint32_t) ( ( value * 0x0101010101010101UL ) >> 56 ) );
+#endif
+}
+
+/* Retrieves the number of leading (most significant) bits not set in a 64-bit value
+ * Returns the number of leading bits not set
+ */
+uint32_t libfshfs_allocation_bitmap_get_leading_zero_count(
+          uint64_t value )
+{
+	uint32_t leading_zero_count = 0;
+
+	if( value == 0 )
+	{
+		return( 64 );
+	}
+#if defined( __GNUC__ ) || defined( __clang__ )
+	leading_zero_count = (uint32_t) __builtin_clzll( (unsigned long long) value );
+#else
+	while( ( value & 0xff00000000000000UL ) == 0 )
+	{
+		leading_zero_count += 8;
+		value             <<= 8;
+	}
+	while( ( value & 0x8000000000000000UL ) == 0 )
+	{
+		leading_zero_count += 1;
+		value             <<= 1;
+	}
+#endif
+	return( leading_zero_count );
+}
+
+/* Allocates the bitmap data
+ * The bitmap data is padded with unset bits to a multiple of 64-bit words
+ * and stored in chunks of the chunk size
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_allocation_bitmap_allocate_data(
+     libfshfs_allocation_bitmap_t *allocation_bitmap,
+     uint32_t number_of_blocks,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfshfs_allocation_bitmap_allocate_data";
+	size_t chunk_data_size = 0;
+	size_t data_offset     = 0;
+	size_t data_size       = 0;
+	int chunk_index        = 0;
+	int number_of_chunks   = 0;
+
+	if( allocation_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocation bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocation_bitmap->chunks != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid allocation bitmap - chunks value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( allocation_bitmap->chunk_size == 0 )
+	 || ( ( allocation_bitmap->chunk_size % 8 ) != 0 )
+	 || ( allocation_bitmap->chunk_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid allocation bitmap - chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_blocks == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of blocks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	data_size = ( (size_t) number_of_blocks / 64 ) * 8;
+
+	if( ( number_of_blocks % 64 ) != 0 )
+	{
+		data_size += 8;
+	}
+	if( ( data_size / allocation_bitmap->chunk_size ) >= (size_t) ( INT_MAX / sizeof( uint8_t * ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of chunks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_chunks = (int) ( data_size / allocation_bitmap->chunk_size );
+
+	if( ( data_size % allocation_bitmap->chunk_size ) != 0 )
+	{
+		number_of_chunks += 1;
+	}
+	allocation_bitmap->chunks = (uint8_t **) memory_allocate(
+	                                          sizeof( uint8_t * ) * number_of_chunks );
+
+	if( allocation_bitmap->chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunks.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     allocation_bitmap->chunks,
+	     0,
+	     sizeof( uint8_t * ) * number_of_chunks ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunks.",
+		 function );
+
+		memory_free(
+		 allocation_bitmap->chunks );
+
+		allocation_bitmap->chunks = NULL;
+
+		return( -1 );
+	}
+	allocation_bitmap->number_of_chunks = number_of_chunks;
+
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		chunk_data_size = data_size - data_offset;
+
+		if( chunk_data_size > allocation_bitmap->chunk_size )
+		{
+			chunk_data_size = allocation_bitmap->chunk_size;
+		}
+		allocation_bitmap->chunks[ chunk_index ] = (uint8_t *) memory_allocate(
+		                                                        sizeof( uint8_t ) * chunk_data_size );
+
+		if( allocation_bitmap->chunks[ chunk_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create chunk: %d.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     allocation_bitmap->chunks[ chunk_index ],
+		     0,
+		     chunk_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear chunk: %d.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		data_offset += chunk_data_size;
+	}
+	allocation_bitmap->data_size                  = data_size;
+	allocation_bitmap->number_of_blocks           = number_of_blocks;
+	allocation_bitmap->number_of_allocated_blocks = 0;
+
+	return( 1 );
+
+on_error:
+	libfshfs_allocation_bitmap_free_data(
+	 allocation_bitmap,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Frees the bitmap data
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_allocation_bitmap_free_data(
+     libfshfs_allocation_bitmap_t *allocation_bitmap,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_allocation_bitmap_free_data";
+	int chunk_index       = 0;
+
+	if( allocation_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocation bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocation_bitmap->chunks != NULL )
+	{
+		for( chunk_index = 0;
+		     chunk_index < allocation_bitmap->number_of_chunks;
+		     chunk_index++ )
+		{
+			if( allocation_bitmap->chunks[ chunk_index ] != NULL )
+			{
+				memory_free(
+				 allocation_bitmap->chunks[ chunk_index ] );
+			}
+		}
+		memory_free(
+		 allocation_bitmap->chunks );
+
+		allocation_bitmap->chunks = NULL;
+	}
+	allocation_bitmap->number_of_chunks = 0;
+	allocation_bitmap->data_size        = 0;
+	allocation_bitmap->number_of_blocks = 0;
+
+	return( 1 );
+}
+
+/* Clears the bits beyond the last block and determines the number of allocated blocks
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_allocation_bitmap_finalize_data(
+     libfshfs_allocation_bitmap_t *allocation_bitmap,
+     libcerror_error_t **error )
+{
+	static char *function               = "libfshfs_allocation_bitmap_finalize_data";
+	uint8_t *chunk_data                 = NULL;
+	size_t chunk_data_offset            = 0;
+	size_t chunk_data_size              = 0;
+	size_t data_offset                  = 0;
+	uint64_t value_64bit                = 0;
+	uint32_t number_of_allocated_blocks = 0;
+	uint8_t bit_index                   = 0;
+	int chunk_index                     = 0;
+
+	if( allocation_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocation bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocation_bitmap->chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid allocation bitmap - missing chunks.",
+		 function );
+
+		return( -1 );
+	}
+	/* The bits are stored most significant bit first, hence the last byte
+	 * contains unused bits in its least significant bits
+	 */
+	bit_index = (uint8_t) ( allocation_bitmap->number_of_blocks % 8 );
+
+	if( bit_index != 0 )
+	{
+		data_offset = (size_t) allocation_bitmap->number_of_blocks / 8;
+
+		allocation_bitmap->chunks[ data_offset / allocation_bitmap->chunk_size ][ data_offset % allocation_bitmap->chunk_size ] &= (uint8_t) ( 0xff << ( 8 - bit_index ) );
+	}
+	data_offset = 0;
+
+	for( chunk_index = 0;
+	     chunk_index < allocation_bitmap->number_of_chunks;
+	     chunk_index++ )
+	{
+		chunk_data      = allocation_bitmap->chunks[ chunk_index ];
+		chunk_data_size = allocation_bitmap->data_size - data_offset;
+
+		if( chunk_data_size > allocation_bitmap->chunk_size )
+		{
+			chunk_data_size = allocation_bitmap->chunk_size;
+		}
+		for( chunk_data_offset = 0;
+		     chunk_data_offset < chunk_data_size;
+		     chunk_data_offset += 8 )
+		{
+			byte_stream_copy_to_uint64_big_endian(
+			 &( chunk_data[ chunk_data_offset ] ),
+			 value_64bit );
+
+			number_of_allocated_blocks += libfshfs_allocation_bitmap_get_population_count(
+			                               value_64bit );
+		}
+		data_offset += chunk_data_size;
+	}
+	allocation_bitmap->number_of_allocated_blocks = number_of_allocated_blocks;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: number of blocks\t\t\t: %" PRIu32 "\n",
+		 function,
+		 allocation_bitmap->number_of_blocks );
+
+		libcnotify_printf(
+		 "%s: number of allocated blocks\t\t: %" PRIu32 "\n",
+		 function,
+		 allocation_bitmap->number_of_allocated_blocks );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	return( 1 );
+}
+
+/* Reads the allocation bitmap
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_allocation_bitmap_read_data(
+     libfshfs_allocation_bitmap_t *allocation_bitmap,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t number_of_blocks,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfshfs_allocation_bitmap_read_data";
+	size_t chunk_read_size = 0;
+	size_t data_offset     = 0;
+	size_t read_size       = 0;
+	int chunk_index        = 0;
+
+	if( allocation_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocation bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	read_size = ( (size_t) number_of_blocks / 8 ) + ( ( ( number_of_blocks % 8 ) != 0 ) ? 1 : 0 );
+
+	if( ( data_size < read_size )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfshfs_allocation_bitmap_allocate_data(
+	     allocation_bitmap,
+	     number_of_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to allocate data.",
+		 function );
+
+		goto on_error;
+	}
+	for( chunk_index = 0;
+	     chunk_index < allocation_bitmap->number_of_chunks;
+	     chunk_index++ )
+	{
+		if( data_offset >= read_size )
+		{
+			break;
+		}
+		chunk_read_size = read_size - data_offset;
+
+		if( chunk_read_size > allocation_bitmap->chunk_size )
+		{
+			chunk_read_size = allocation_bitmap->chunk_size;
+		}
+		if( memory_copy(
+		     allocation_bitmap->chunks[ chunk_index ],
+		     &( data[ data_offset ] ),
+		     chunk_read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to chunk: %d.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		data_offset += chunk_read_size;
+	}
+	if( libfshfs_allocation_bitmap_finalize_data(
+	     allocation_bitmap,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to finalize data.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libfshfs_allocation_bitmap_free_data(
+	 allocation_bitmap,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Reads the allocation bitmap from the allocation file data stream
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_allocation_bitmap_read_data_stream(
+     libfshfs_allocation_bitmap_t *allocation_bitmap,
+     libbfio_handle_t *file_io_handle,
+     libfdata_stream_t *data_stream,
+     uint32_t number_of_blocks,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfshfs_allocation_bitmap_read_data_stream";
+	size64_t stream_size   = 0;
+	size_t chunk_read_size = 0;
+	size_t data_offset     = 0;
+	size_t read_size       = 0;
+	ssize_t read_count     = 0;
+	int chunk_index        = 0;
+
+	if( allocation_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocation bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_stream_get_size(
+	     data_stream,
+	     &stream_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data stream size.",
+		 function );
+
+		return( -1 );
+	}
+	read_size = ( (size_t) number_of_blocks / 8 ) + ( ( ( number_of_blocks % 8 ) != 0 ) ? 1 : 0 );
+
+	if( stream_size < (size64_t) read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data stream size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfshfs_allocation_bitmap_allocate_data(
+	     allocation_bitmap,
+	     number_of_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to allocate data.",
+		 function );
+
+		goto on_error;
+	}
+	/* The bitmap is read a chunk at a time
+	 */
+	for( chunk_index = 0;
+	     chunk_index < allocation_bitmap->number_of_chunks;
+	     chunk_index++ )
+	{
+		if( data_offset >= read_size )
+		{
+			break;
+		}
+		chunk_read_size = read_size - data_offset;
+
+		if( chunk_read_size > allocation_bitmap->chunk_size )
+		{
+			chunk_read_size = allocation_bitmap->chunk_size;
+		}
+		read_count = libfdata_stream_read_buffer_at_offset(
+		              data_stream,
+		              (intptr_t *) file_io_handle,
+		              allocation_bitmap->chunks[ chunk_index ],
+		              chunk_read_size,
+		              (off64_t) data_offset,
+		              0,
+		              error );
+
+		if( read_count != (ssize_t) chunk_read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read allocation bitmap chunk: %d from data stream at offset: %" PRIzd " (0x%08" PRIzx ").",
+			 function,
+			 chunk_index,
+			 data_offset,
+			 data_offset );
+
+			goto on_error;
+		}
+		data_offset += chunk_read_size;
+	}
+	if( libfshfs_allocation_bitmap_finalize_data(
+	     allocation_bitmap,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to finalize data.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libfshfs_allocation_bitmap_free_data(
+	 allocation_bitmap,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Retrieves the number of free (unallocated) blocks
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_allocation_bitmap_get_number_of_free_blocks(
+     libfshfs_allocation_bitmap_t *allocation_bitmap,
+     uint32_t *number_of_free_blocks,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_allocation_bitmap_get_number_of_free_blocks";
+
+	if( allocation_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocation bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocation_bitmap->number_of_allocated_blocks > allocation_bitmap->number_of_blocks )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid allocation bitmap - number of allocated blocks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_free_blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of free blocks.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_free_blocks = allocation_bitmap->number_of_blocks - allocation_bitmap->number_of_allocated_blocks;
+
+	return( 1 );
+}
+
+/* Determines if a specific block is allocated
+ * Returns 1 if allocated, 0 if not or -1 on error
+ */
+int libfshfs_allocation_bitmap_is_block_allocated(
+     libfshfs_allocation_bitmap_t *allocation_bitmap,
+     uint32_t block_number,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_allocation_bitmap_is_block_allocated";
+	size_t data_offset    = 0;
+
+	if( allocation_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocation bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocation_bitmap->chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid allocation bitmap - missing chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_number >= allocation_bitmap->number_of_blocks )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	data_offset = (size_t) block_number / 8;
+
+	if( ( allocation_bitmap->chunks[ data_offset / allocation_bitmap->chunk_size ][ data_offset % allocation_bitmap->chunk_size ] & ( 0x80 >> ( block_number % 8 ) ) ) != 0 )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Finds the first block, at or after a specific block, that is allocated or unallocated
+ * The bitmap is scanned a 64-bit word at a time, chunk by chunk
+ * Returns 1 if successful, 0 if no such block or -1 on error
+ */
+int libfshfs_allocation_bitmap_find_block(
+     libfshfs_allocation_bitmap_t *allocation_bitmap,
+     uint32_t block_number,
+     uint8_t is_allocated,
+     uint32_t *found_block_number,
+     libcerror_error_t **error )
+{
+	static char *function    = "libfshfs_allocation_bitmap_find_block";
+	uint8_t *chunk_data      = NULL;
+	size_t chunk_data_offset = 0;
+	size_t chunk_data_size   = 0;
+	size_t data_offset       = 0;
+	uint64_t found_index     = 0;
+	uint64_t value_64bit     = 0;
+	int chunk_index          = 0;
+
+	if( allocation_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocation bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocation_bitmap->chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid allocation bitmap - missing chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( found_block_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid found block number.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_number >= allocation_bitmap->number_of_blocks )
+	{
+		return( 0 );
+	}
+	data_offset = ( (size_t) block_number / 64 ) * 8;
+
+	/* The chunk size is a multiple of 64-bit words, hence a word is never split between chunks
+	 */
+	chunk_index       = (int) ( data_offset / allocation_bitmap->chunk_size );
+	chunk_data_offset = data_offset % allocation_bitmap->chunk_size;
+	chunk_data        = allocation_bitmap->chunks[ chunk_index ];
+	chunk_data_size   = allocation_bitmap->data_size - ( data_offset - chunk_data_offset );
+
+	if( chunk_data_size > allocation_bitmap->chunk_size )
+	{
+		chunk_data_size = allocation_bitmap->chunk_size;
+	}
+	byte_stream_copy_to_uint64_big_endian(
+	 &( chunk_data[ chunk_data_offset ] ),
+	 value_64bit );
+
+	if( is_allocated == 0 )
+	{
+		value_64bit = ~value_64bit;
+	}
+	/* Ignore the blocks before the block number in the first word
+	 */
+	value_64bit &= (uint64_t) UINT64_MAX >> ( block_number % 64 );
+
+	while( value_64bit == 0 )
+	{
+		data_offset       += 8;
+		chunk_data_offset += 8;
+
+		if( data_offset >= allocation_bitmap->data_size )
+		{
+			return( 0 );
+		}
+		if( chunk_data_offset >= chunk_data_size )
+		{
+			chunk_index      += 1;
+			chunk_data_offset = 0;
+			chunk_data        = allocation_bitmap->chunks[ chunk_index ];
+			chunk_data_size   = allocation_bitmap->data_size - data_offset;
+
+			if( chunk_data_size > allocation_bitmap->chunk_size )
+			{
+				chunk_data_size = allocation_bitmap->chunk_size;
+			}
+		}
+		byte_stream_copy_to_uint64_big_endian(
+		 &( chunk_data[ chunk_data_offset ] ),
+		 value_64bit );
+
+		if( is_allocated == 0 )
+		{
+			value_64bit = ~value_64bit;
+		}
+	}
+	found_index = ( (uint64_t) data_offset * 8 ) + libfshfs_allocation_bitmap_get_leading_zero_count(
+	                                               value_64bit );
+
+	/* The padding bits beyond the last block are not set
+	 * and therefore can match when looking for an unallocated block
+	 */
+	if( found_index >= (uint64_t) allocation_bitmap->number_of_blocks )
+	{
+		return( 0 );
+	}
+	*found_block_number = (uint32_t) found_index;
+
+	return( 1 );
+}
+
+/* Retrieves the next run of allocated or unallocated blocks, at or after a specific block
+ * Returns 1 if successful, 0 if no such run or -1 on error
+ */
+int libfshfs_allocation_bitmap_get_next_block_run(
+     libfshfs_allocation_bitmap_t *allocation_bitmap,
+     uint32_t block_number,
+     uint8_t is_allocated,
+     uint32_t *run_block_number,
+     uint32_t *run_number_of_blocks,
+     libcerror_error_t **error )
+{
+	static char *function       = "libfshfs_allocation_bitmap_get_next_block_run";
+	uint32_t end_block_number   = 0;
+	uint32_t start_block_number = 0;
+	int result                  = 0;
+
+	if( allocation_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocation bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	if( run_block_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run block number.",
+		 function );
+
+		return( -1 );
+	}
+	if( run_number_of_blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run number of blocks.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfshfs_allocation_bitmap_find_block(
+	          allocation_bitmap,
+	          block_number,
+	          is_allocated,
+	          &start_block_number,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to find start of run.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	result = libfshfs_allocation_bitmap_find_block(
+	          allocation_bitmap,
+	          start_block_number,
+	          (uint8_t) ( is_allocated == 0 ),
+	          &end_block_number,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to find end of run.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		end_block_number = allocation_bitmap->number_of_blocks;
+	}
+	*run_block_number     = start_block_number;
+	*run_number_of_blocks = end_block_number - start_block_number;
+
+	return( 1 );
+}
+
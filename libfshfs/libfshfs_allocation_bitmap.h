@@ -0,0 +1,139 @@
+/*
+ * Allocation bitmap functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBFSHFS_ALLOCATION_BITMAP_H )
+#define _LIBFSHFS_ALLOCATION_BITMAP_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfshfs_libbfio.h"
+#include "libfshfs_libcerror.h"
+#include "libfshfs_libfdata.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfshfs_allocation_bitmap libfshfs_allocation_bitmap_t;
+
+struct libfshfs_allocation_bitmap
+{
+	/* The bitmap data chunks
+	 * The bitmap data is stored in chunks since the bitmap of a large volume
+	 * can exceed the maximum allocation size
+	 */
+	uint8_t **chunks;
+
+	/* The number of chunks
+	 */
+	int number_of_chunks;
+
+	/* The chunk size, a multiple of 64-bit words
+	 */
+	size_t chunk_size;
+
+	/* The bitmap data size, padded to a multiple of 64-bit words
+	 */
+	size_t data_size;
+
+	/* The number of (allocation) blocks
+	 */
+	uint32_t number_of_blocks;
+
+	/* The number of allocated blocks
+	 */
+	uint32_t number_of_allocated_blocks;
+};
+
+int libfshfs_allocation_bitmap_initialize(
+     libfshfs_allocation_bitmap_t **allocation_bitmap,
+     libcerror_error_t **error );
+
+int libfshfs_allocation_bitmap_free(
+     libfshfs_allocation_bitmap_t **allocation_bitmap,
+     libcerror_error_t **error );
+
+uint32_t libfshfs_allocation_bitmap_get_population_count(
+          uint64_t value );
+
+uint32_t libfshfs_allocation_bitmap_get_leading_zero_count(
+          uint64_t value );
+
+int libfshfs_allocation_bitmap_allocate_data(
+     libfshfs_allocation_bitmap_t *allocation_bitmap,
+     uint32_t number_of_blocks,
+     libcerror_error_t **error );
+
+int libfshfs_allocation_bitmap_free_data(
+     libfshfs_allocation_bitmap_t *allocation_bitmap,
+     libcerror_error_t **error );
+
+int libfshfs_allocation_bitmap_finalize_data(
+     libfshfs_allocation_bitmap_t *allocation_bitmap,
+     libcerror_error_t **error );
+
+int libfshfs_allocation_bitmap_read_data(
+     libfshfs_allocation_bitmap_t *allocation_bitmap,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t number_of_blocks,
+     libcerror_error_t **error );
+
+int libfshfs_allocation_bitmap_read_data_stream(
+     libfshfs_allocation_bitmap_t *allocation_bitmap,
+     libbfio_handle_t *file_io_handle,
+     libfdata_stream_t *data_stream,
+     uint32_t number_of_blocks,
+     libcerror_error_t **error );
+
+int libfshfs_allocation_bitmap_get_number_of_free_blocks(
+     libfshfs_allocation_bitmap_t *allocation_bitmap,
+     uint32_t *number_of_free_blocks,
+     libcerror_error_t **error );
+
+int libfshfs_allocation_bitmap_is_block_allocated(
+     libfshfs_allocation_bitmap_t *allocation_bitmap,
+     uint32_t block_number,
+     libcerror_error_t **error );
+
+int libfshfs_allocation_bitmap_find_block(
+     libfshfs_allocation_bitmap_t *allocation_bitmap,
+     uint32_t block_number,
+     uint8_t is_allocated,
+     uint32_t *found_block_number,
+     libcerror_error_t **error );
+
+int libfshfs_allocation_bitmap_get_next_block_run(
+     libfshfs_allocation_bitmap_t *allocation_bitmap,
+     uint32_t block_number,
+     uint8_t is_allocated,
+     uint32_t *run_block_number,
+     uint32_t *run_number_of_blocks,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSHFS_ALLOCATION_BITMAP_H ) */
+
@@ -31,6 +31,8 @@
 #include "libfshfs_io_handle.h"
 #include "libfshfs_libcdata.h"
 #include "libfshfs_libfdata.h"
+#include "libfshfs_mapped_data_handle.h"
+#include "libfshfs_read_ahead_data_handle.h"
 
 /* Creates an allocation block stream from a buffer of data
  * Make sure the value allocation_block_stream is referencing, is set to NULL
@@ -144,13 +146,14 @@ int libfshfs_allocation_block_stream_initialize_from_fork_descriptor(
      libfshfs_fork_descriptor_t *fork_descriptor,
      libcerror_error_t **error )
 {
-	libfdata_stream_t *safe_allocation_block_stream = NULL;
-	static char *function                           = "libfshfs_allocation_block_stream_initialize_from_fork_descriptor";
-	size64_t segment_size                           = 0;
-	off64_t segment_offset                          = 0;
-	int extent_index                                = 0;
-	int result                                      = 0;
-	int segment_index                               = 0;
+	libfdata_stream_t *safe_allocation_block_stream   = NULL;
+	libfshfs_mapped_data_handle_t *mapped_data_handle = NULL;
+	static char *function                             = "libfshfs_allocation_block_stream_initialize_from_fork_descriptor";
+	size64_t segment_size                             = 0;
+	off64_t segment_offset                            = 0;
+	int extent_index                                  = 0;
+	int result                                        = 0;
+	int segment_index                                 = 0;
 
 	if( allocation_block_stream == NULL )
 	{
@@ -222,26 +225,70 @@ int libfshfs_allocation_block_stream_initialize_from_fork_descriptor(
 
 		goto on_error;
 	}
-	if( libfdata_stream_initialize(
-	     &safe_allocation_block_stream,
-	     NULL,
-	     NULL,
-	     NULL,
-	     NULL,
-	     (ssize_t (*)(intptr_t *, intptr_t *, int, int, uint8_t *, size_t, uint32_t, uint8_t, libcerror_error_t **)) &libfshfs_block_data_handle_read_segment_data,
-	     NULL,
-	     (off64_t (*)(intptr_t *, intptr_t *, int, int, off64_t, libcerror_error_t **)) &libfshfs_block_data_handle_seek_segment_offset,
-	     0,
-	     error ) != 1 )
+	if( io_handle->mapped_data != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create allocation block stream.",
-		 function );
+		if( libfshfs_mapped_data_handle_initialize(
+		     &mapped_data_handle,
+		     io_handle->mapped_data,
+		     io_handle->mapped_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create mapped data handle.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
+		mapped_data_handle->statistics = io_handle->statistics;
+
+		if( libfdata_stream_initialize(
+		     &safe_allocation_block_stream,
+		     (intptr_t *) mapped_data_handle,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfshfs_mapped_data_handle_free,
+		     NULL,
+		     NULL,
+		     (ssize_t (*)(intptr_t *, intptr_t *, int, int, uint8_t *, size_t, uint32_t, uint8_t, libcerror_error_t **)) &libfshfs_mapped_data_handle_read_segment_data,
+		     NULL,
+		     (off64_t (*)(intptr_t *, intptr_t *, int, int, off64_t, libcerror_error_t **)) &libfshfs_mapped_data_handle_seek_segment_offset,
+		     LIBFDATA_DATA_HANDLE_FLAG_MANAGED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create allocation block stream.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( libfdata_stream_initialize(
+		     &safe_allocation_block_stream,
+		     (intptr_t *) io_handle->statistics,
+		     NULL,
+		     NULL,
+		     NULL,
+		     (ssize_t (*)(intptr_t *, intptr_t *, int, int, uint8_t *, size_t, uint32_t, uint8_t, libcerror_error_t **)) &libfshfs_block_data_handle_read_segment_data,
+		     NULL,
+		     (off64_t (*)(intptr_t *, intptr_t *, int, int, off64_t, libcerror_error_t **)) &libfshfs_block_data_handle_seek_segment_offset,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create allocation block stream.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	for( extent_index = 0;
 	     extent_index < 8;
@@ -325,6 +372,12 @@ on_error:
 		 &safe_allocation_block_stream,
 		 NULL );
 	}
+	else if( mapped_data_handle != NULL )
+	{
+		libfshfs_mapped_data_handle_free(
+		 &mapped_data_handle,
+		 NULL );
+	}
 	return( -1 );
 }
 
@@ -339,14 +392,16 @@ int libfshfs_allocation_block_stream_initialize_from_extents(
      size64_t data_size,
      libcerror_error_t **error )
 {
-	libfdata_stream_t *safe_allocation_block_stream = NULL;
-	libfshfs_extent_t *extent                       = NULL;
-	static char *function                           = "libfshfs_allocation_block_stream_initialize_from_extents";
-	size64_t segment_size                           = 0;
-	off64_t segment_offset                          = 0;
-	int extent_index                                = 0;
-	int number_of_extents                           = 0;
-	int segment_index                               = 0;
+	libfdata_stream_t *safe_allocation_block_stream   = NULL;
+	libfshfs_extent_t *extent                         = NULL;
+	libfshfs_mapped_data_handle_t *mapped_data_handle = NULL;
+	libfshfs_read_ahead_data_handle_t *data_handle    = NULL;
+	static char *function                             = "libfshfs_allocation_block_stream_initialize_from_extents";
+	size64_t segment_size                             = 0;
+	off64_t segment_offset                            = 0;
+	int extent_index                                  = 0;
+	int number_of_extents                             = 0;
+	int segment_index                                 = 0;
 
 	if( allocation_block_stream == NULL )
 	{
@@ -395,26 +450,115 @@ int libfshfs_allocation_block_stream_initialize_from_extents(
 
 		goto on_error;
 	}
-	if( libfdata_stream_initialize(
-	     &safe_allocation_block_stream,
-	     NULL,
-	     NULL,
-	     NULL,
-	     NULL,
-	     (ssize_t (*)(intptr_t *, intptr_t *, int, int, uint8_t *, size_t, uint32_t, uint8_t, libcerror_error_t **)) &libfshfs_block_data_handle_read_segment_data,
-	     NULL,
-	     (off64_t (*)(intptr_t *, intptr_t *, int, int, off64_t, libcerror_error_t **)) &libfshfs_block_data_handle_seek_segment_offset,
-	     0,
-	     error ) != 1 )
+	/* When the volume data is mapped into memory the data is copied directly
+	 * from the mapped data and read-ahead is not needed
+	 */
+	if( io_handle->mapped_data != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create allocation block stream.",
-		 function );
+		if( libfshfs_mapped_data_handle_initialize(
+		     &mapped_data_handle,
+		     io_handle->mapped_data,
+		     io_handle->mapped_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create mapped data handle.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
+		mapped_data_handle->statistics = io_handle->statistics;
+
+		if( libfdata_stream_initialize(
+		     &safe_allocation_block_stream,
+		     (intptr_t *) mapped_data_handle,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfshfs_mapped_data_handle_free,
+		     NULL,
+		     NULL,
+		     (ssize_t (*)(intptr_t *, intptr_t *, int, int, uint8_t *, size_t, uint32_t, uint8_t, libcerror_error_t **)) &libfshfs_mapped_data_handle_read_segment_data,
+		     NULL,
+		     (off64_t (*)(intptr_t *, intptr_t *, int, int, off64_t, libcerror_error_t **)) &libfshfs_mapped_data_handle_seek_segment_offset,
+		     LIBFDATA_DATA_HANDLE_FLAG_MANAGED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create allocation block stream.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( ( io_handle->maximum_read_ahead_size > 0 )
+	      && ( number_of_extents > 0 ) )
+	{
+		if( libfshfs_read_ahead_data_handle_initialize(
+		     &data_handle,
+		     io_handle->maximum_read_ahead_size,
+		     number_of_extents,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create read-ahead data handle.",
+			 function );
+
+			goto on_error;
+		}
+		data_handle->statistics = io_handle->statistics;
+
+		if( libfdata_stream_initialize(
+		     &safe_allocation_block_stream,
+		     (intptr_t *) data_handle,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfshfs_read_ahead_data_handle_free,
+		     NULL,
+		     NULL,
+		     (ssize_t (*)(intptr_t *, intptr_t *, int, int, uint8_t *, size_t, uint32_t, uint8_t, libcerror_error_t **)) &libfshfs_read_ahead_data_handle_read_segment_data,
+		     NULL,
+		     (off64_t (*)(intptr_t *, intptr_t *, int, int, off64_t, libcerror_error_t **)) &libfshfs_read_ahead_data_handle_seek_segment_offset,
+		     LIBFDATA_DATA_HANDLE_FLAG_MANAGED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create allocation block stream.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( libfdata_stream_initialize(
+		     &safe_allocation_block_stream,
+		     (intptr_t *) io_handle->statistics,
+		     NULL,
+		     NULL,
+		     NULL,
+		     (ssize_t (*)(intptr_t *, intptr_t *, int, int, uint8_t *, size_t, uint32_t, uint8_t, libcerror_error_t **)) &libfshfs_block_data_handle_read_segment_data,
+		     NULL,
+		     (off64_t (*)(intptr_t *, intptr_t *, int, int, off64_t, libcerror_error_t **)) &libfshfs_block_data_handle_seek_segment_offset,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create allocation block stream.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	for( extent_index = 0;
 	     extent_index < number_of_extents;
@@ -494,6 +638,26 @@ int libfshfs_allocation_block_stream_initialize_from_extents(
 
 			goto on_error;
 		}
+		if( data_handle != NULL )
+		{
+			if( libfshfs_read_ahead_data_handle_set_segment(
+			     data_handle,
+			     segment_index,
+			     segment_offset,
+			     segment_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set extent: %d read-ahead segment.",
+				 function,
+				 extent_index );
+
+				goto on_error;
+			}
+		}
 	}
 	if( libfdata_stream_set_mapped_size(
 	     safe_allocation_block_stream,
@@ -520,6 +684,18 @@ on_error:
 		 &safe_allocation_block_stream,
 		 NULL );
 	}
+	else if( mapped_data_handle != NULL )
+	{
+		libfshfs_mapped_data_handle_free(
+		 &mapped_data_handle,
+		 NULL );
+	}
+	else if( data_handle != NULL )
+	{
+		libfshfs_read_ahead_data_handle_free(
+		 &data_handle,
+		 NULL );
+	}
 	return( -1 );
 }
 
@@ -529,6 +705,7 @@ on_error:
  */
 int libfshfs_allocation_block_stream_initialize_from_compressed_stream(
      libfdata_stream_t **allocation_block_stream,
+     libfshfs_io_handle_t *io_handle,
      libfdata_stream_t *compressed_allocation_block_stream,
      size64_t uncompressed_data_size,
      int compression_method,
@@ -550,6 +727,17 @@ int libfshfs_allocation_block_stream_initialize_from_compressed_stream(
 
 		return( -1 );
 	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
 	if( libfshfs_compressed_data_handle_initialize(
 	     &data_handle,
 	     compressed_allocation_block_stream,
@@ -566,6 +754,8 @@ int libfshfs_allocation_block_stream_initialize_from_compressed_stream(
 
 		goto on_error;
 	}
+	data_handle->statistics = io_handle->statistics;
+
 	if( libfdata_stream_initialize(
 	     &safe_allocation_block_stream,
 	     (intptr_t *) data_handle,
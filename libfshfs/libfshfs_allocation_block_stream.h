@@ -56,6 +56,7 @@ int libfshfs_allocation_block_stream_initialize_from_extents(
 
 int libfshfs_allocation_block_stream_initialize_from_compressed_stream(
      libfdata_stream_t **allocation_block_stream,
+     libfshfs_io_handle_t *io_handle,
      libfdata_stream_t *compressed_allocation_block_stream,
      size64_t uncompressed_data_size,
      int compression_method,
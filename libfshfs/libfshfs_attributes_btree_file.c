@@ -26,6 +26,7 @@
 #include "libfshfs_attribute_record.h"
 #include "libfshfs_attributes_btree_file.h"
 #include "libfshfs_attributes_btree_key.h"
+#include "libfshfs_attributes_index.h"
 #include "libfshfs_btree_file.h"
 #include "libfshfs_btree_node_cache.h"
 #include "libfshfs_definitions.h"
@@ -34,6 +35,7 @@
 #include "libfshfs_libcdata.h"
 #include "libfshfs_libcerror.h"
 #include "libfshfs_libcnotify.h"
+#include "libfshfs_libuna.h"
 
 #include "fshfs_attributes_file.h"
 
@@ -823,3 +825,380 @@ on_error:
 	return( -1 );
 }
 
+
+/* Reads the attributes index from the attributes B-tree file
+ * The index is read with a single pass over the B-tree leaf nodes
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_attributes_btree_file_read_attributes_index(
+     libfshfs_btree_file_t *btree_file,
+     libbfio_handle_t *file_io_handle,
+     libfshfs_btree_node_cache_t *node_cache,
+     libfshfs_attributes_index_t *attributes_index,
+     libcerror_error_t **error )
+{
+	libfshfs_attributes_btree_key_t *node_key = NULL;
+	libfshfs_btree_node_t *node               = NULL;
+	static char *function                     = "libfshfs_attributes_btree_file_read_attributes_index";
+	uint32_t node_number                      = 0;
+	uint32_t number_of_leaf_nodes             = 0;
+	uint16_t record_index                     = 0;
+	uint8_t flags                             = 0;
+	int result                                = 0;
+
+	if( btree_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid B-tree file.",
+		 function );
+
+		return( -1 );
+	}
+	if( btree_file->header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid B-tree file - missing header.",
+		 function );
+
+		return( -1 );
+	}
+	if( btree_file->node_vector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid B-tree file - missing node vector.",
+		 function );
+
+		return( -1 );
+	}
+	if( attributes_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid attributes index.",
+		 function );
+
+		return( -1 );
+	}
+	node_number = btree_file->header->first_leaf_node_number;
+
+	while( node_number != 0 )
+	{
+		/* Protect against a loop in the leaf node chain
+		 */
+		if( number_of_leaf_nodes >= btree_file->node_vector->number_of_nodes )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of leaf nodes value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_leaf_nodes++;
+
+		if( libfshfs_btree_file_get_leaf_node_by_number(
+		     btree_file,
+		     file_io_handle,
+		     node_cache,
+		     node_number,
+		     &node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve B-tree leaf node: %" PRIu32 ".",
+			 function,
+			 node_number );
+
+			return( -1 );
+		}
+		for( record_index = 0;
+		     record_index < node->descriptor->number_of_records;
+		     record_index++ )
+		{
+			if( libfshfs_attributes_btree_file_get_key_from_node_by_index(
+			     node,
+			     record_index,
+			     &node_key,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve attributes B-tree key: %" PRIu16 " from node: %" PRIu32 ".",
+				 function,
+				 record_index,
+				 node_number );
+
+				return( -1 );
+			}
+			if( node_key == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing attributes B-tree key: %" PRIu16 " in node: %" PRIu32 ".",
+				 function,
+				 record_index,
+				 node_number );
+
+				return( -1 );
+			}
+			flags = 0;
+
+			if( node_key->name_size == 34 )
+			{
+				result = libfshfs_attributes_btree_key_compare_name_with_utf8_string(
+				          node_key,
+				          (uint8_t *) "com.apple.decmpfs",
+				          17,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to compare attributes B-tree key name.",
+					 function );
+
+					return( -1 );
+				}
+				else if( result == LIBUNA_COMPARE_EQUAL )
+				{
+					flags = LIBFSHFS_ATTRIBUTES_INDEX_FLAG_HAS_COMPRESSED_DATA;
+				}
+			}
+			else if( node_key->name_size == 44 )
+			{
+				result = libfshfs_attributes_btree_key_compare_name_with_utf8_string(
+				          node_key,
+				          (uint8_t *) "com.apple.ResourceFork",
+				          22,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to compare attributes B-tree key name.",
+					 function );
+
+					return( -1 );
+				}
+				else if( result == LIBUNA_COMPARE_EQUAL )
+				{
+					flags = LIBFSHFS_ATTRIBUTES_INDEX_FLAG_HAS_RESOURCE_FORK;
+				}
+			}
+			if( libfshfs_attributes_index_append_record(
+			     attributes_index,
+			     node_key->identifier,
+			     node_number,
+			     record_index,
+			     flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append record: %" PRIu16 " of node: %" PRIu32 " to attributes index.",
+				 function,
+				 record_index,
+				 node_number );
+
+				return( -1 );
+			}
+		}
+		node_number = node->descriptor->next_node_number;
+	}
+	return( 1 );
+}
+
+/* Retrieves the attributes of a specific attributes index entry from the attributes B-tree file
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_attributes_btree_file_get_attributes_from_index_entry(
+     libfshfs_btree_file_t *btree_file,
+     libbfio_handle_t *file_io_handle,
+     libfshfs_btree_node_cache_t *node_cache,
+     libfshfs_attributes_index_entry_t *attributes_index_entry,
+     libcdata_array_t *attributes,
+     libcerror_error_t **error )
+{
+	libfshfs_attribute_record_t *attribute_record = NULL;
+	libfshfs_attributes_btree_key_t *node_key     = NULL;
+	libfshfs_btree_node_t *node                   = NULL;
+	static char *function                         = "libfshfs_attributes_btree_file_get_attributes_from_index_entry";
+	uint32_t node_number                          = 0;
+	uint16_t number_of_records                    = 0;
+	uint16_t record_index                         = 0;
+	int entry_index                               = 0;
+
+	if( attributes_index_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid attributes index entry.",
+		 function );
+
+		return( -1 );
+	}
+	node_number  = attributes_index_entry->node_number;
+	record_index = attributes_index_entry->record_index;
+
+	while( number_of_records < attributes_index_entry->number_of_records )
+	{
+		if( node_number == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid node number value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfshfs_btree_file_get_leaf_node_by_number(
+		     btree_file,
+		     file_io_handle,
+		     node_cache,
+		     node_number,
+		     &node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve B-tree leaf node: %" PRIu32 ".",
+			 function,
+			 node_number );
+
+			goto on_error;
+		}
+		while( ( record_index < node->descriptor->number_of_records )
+		    && ( number_of_records < attributes_index_entry->number_of_records ) )
+		{
+			if( libfshfs_attributes_btree_file_get_key_from_node_by_index(
+			     node,
+			     record_index,
+			     &node_key,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve attributes B-tree key: %" PRIu16 " from node: %" PRIu32 ".",
+				 function,
+				 record_index,
+				 node_number );
+
+				goto on_error;
+			}
+			if( node_key == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing attributes B-tree key: %" PRIu16 " in node: %" PRIu32 ".",
+				 function,
+				 record_index,
+				 node_number );
+
+				goto on_error;
+			}
+			if( node_key->identifier != attributes_index_entry->identifier )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: mismatch in identifier of attributes B-tree key: %" PRIu16 " in node: %" PRIu32 ".",
+				 function,
+				 record_index,
+				 node_number );
+
+				goto on_error;
+			}
+			if( libfshfs_attributes_btree_file_get_attribute_from_record_data(
+			     btree_file,
+			     node_key,
+			     &attribute_record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve attribute from record data.",
+				 function );
+
+				goto on_error;
+			}
+			if( libcdata_array_append_entry(
+			     attributes,
+			     &entry_index,
+			     (intptr_t *) attribute_record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append attribute record to array.",
+				 function );
+
+				goto on_error;
+			}
+			attribute_record = NULL;
+
+			record_index++;
+			number_of_records++;
+		}
+		node_number  = node->descriptor->next_node_number;
+		record_index = 0;
+	}
+	return( 1 );
+
+on_error:
+	if( attribute_record != NULL )
+	{
+		libfshfs_attribute_record_free(
+		 &attribute_record,
+		 NULL );
+	}
+	libcdata_array_empty(
+	 attributes,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libfshfs_attribute_record_free,
+	 NULL );
+
+	return( -1 );
+}
+
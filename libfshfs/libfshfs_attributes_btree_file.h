@@ -27,6 +27,7 @@
 
 #include "libfshfs_attribute_record.h"
 #include "libfshfs_attributes_btree_key.h"
+#include "libfshfs_attributes_index.h"
 #include "libfshfs_btree_file.h"
 #include "libfshfs_btree_node_cache.h"
 #include "libfshfs_libbfio.h"
@@ -79,6 +80,21 @@ int libfshfs_attributes_btree_file_get_attributes(
      libcdata_array_t *attributes,
      libcerror_error_t **error );
 
+int libfshfs_attributes_btree_file_read_attributes_index(
+     libfshfs_btree_file_t *btree_file,
+     libbfio_handle_t *file_io_handle,
+     libfshfs_btree_node_cache_t *node_cache,
+     libfshfs_attributes_index_t *attributes_index,
+     libcerror_error_t **error );
+
+int libfshfs_attributes_btree_file_get_attributes_from_index_entry(
+     libfshfs_btree_file_t *btree_file,
+     libbfio_handle_t *file_io_handle,
+     libfshfs_btree_node_cache_t *node_cache,
+     libfshfs_attributes_index_entry_t *attributes_index_entry,
+     libcdata_array_t *attributes,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
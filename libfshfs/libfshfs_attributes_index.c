@@ -0,0 +1,327 @@
+/*
+ * Attributes index functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfshfs_attributes_index.h"
+#include "libfshfs_libcerror.h"
+
+/* Creates an attributes index
+ * Make sure the value attributes_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_attributes_index_initialize(
+     libfshfs_attributes_index_t **attributes_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_attributes_index_initialize";
+
+	if( attributes_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid attributes index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *attributes_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid attributes index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*attributes_index = memory_allocate_structure(
+	                     libfshfs_attributes_index_t );
+
+	if( *attributes_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create attributes index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *attributes_index,
+	     0,
+	     sizeof( libfshfs_attributes_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear attributes index.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *attributes_index != NULL )
+	{
+		memory_free(
+		 *attributes_index );
+
+		*attributes_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an attributes index
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_attributes_index_free(
+     libfshfs_attributes_index_t **attributes_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_attributes_index_free";
+
+	if( attributes_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid attributes index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *attributes_index != NULL )
+	{
+		if( ( *attributes_index )->entries != NULL )
+		{
+			memory_free(
+			 ( *attributes_index )->entries );
+		}
+		memory_free(
+		 *attributes_index );
+
+		*attributes_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends an attributes B-tree record to the index
+ * The records must be appended in B-tree key order, consecutive records
+ * of the same identifier are combined into a single entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_attributes_index_append_record(
+     libfshfs_attributes_index_t *attributes_index,
+     uint32_t identifier,
+     uint32_t node_number,
+     uint16_t record_index,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	libfshfs_attributes_index_entry_t *attributes_index_entry = NULL;
+	libfshfs_attributes_index_entry_t *reallocation           = NULL;
+	static char *function                                     = "libfshfs_attributes_index_append_record";
+	size_t entries_size                                       = 0;
+	int number_of_allocated_entries                           = 0;
+
+	if( attributes_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid attributes index.",
+		 function );
+
+		return( -1 );
+	}
+	if( attributes_index->number_of_entries > 0 )
+	{
+		attributes_index_entry = &( attributes_index->entries[ attributes_index->number_of_entries - 1 ] );
+
+		if( identifier < attributes_index_entry->identifier )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid identifier: %" PRIu32 " value out of bounds - not in key order.",
+			 function,
+			 identifier );
+
+			return( -1 );
+		}
+		if( identifier == attributes_index_entry->identifier )
+		{
+			if( attributes_index_entry->number_of_records == UINT16_MAX )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid attributes index entry: %" PRIu32 " - number of records value out of bounds.",
+				 function,
+				 identifier );
+
+				return( -1 );
+			}
+			attributes_index_entry->number_of_records += 1;
+			attributes_index_entry->flags             |= flags;
+
+			return( 1 );
+		}
+	}
+	if( attributes_index->number_of_entries >= attributes_index->number_of_allocated_entries )
+	{
+		if( attributes_index->number_of_allocated_entries == 0 )
+		{
+			number_of_allocated_entries = 256;
+		}
+		else if( attributes_index->number_of_allocated_entries < ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_entries = attributes_index->number_of_allocated_entries * 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated entries value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		entries_size = sizeof( libfshfs_attributes_index_entry_t ) * number_of_allocated_entries;
+
+		if( entries_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid entries size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = (libfshfs_attributes_index_entry_t *) memory_reallocate(
+		                attributes_index->entries,
+		                entries_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		attributes_index->entries                     = reallocation;
+		attributes_index->number_of_allocated_entries = number_of_allocated_entries;
+	}
+	attributes_index_entry = &( attributes_index->entries[ attributes_index->number_of_entries ] );
+
+	attributes_index_entry->identifier        = identifier;
+	attributes_index_entry->node_number       = node_number;
+	attributes_index_entry->record_index      = record_index;
+	attributes_index_entry->number_of_records = 1;
+	attributes_index_entry->flags             = flags;
+
+	attributes_index->number_of_entries += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the attributes index entry of a specific identifier
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libfshfs_attributes_index_get_entry_by_identifier(
+     libfshfs_attributes_index_t *attributes_index,
+     uint32_t identifier,
+     libfshfs_attributes_index_entry_t **attributes_index_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_attributes_index_get_entry_by_identifier";
+	int lower_index       = 0;
+	int middle_index      = 0;
+	int upper_index       = 0;
+
+	if( attributes_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid attributes index.",
+		 function );
+
+		return( -1 );
+	}
+	if( attributes_index_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid attributes index entry.",
+		 function );
+
+		return( -1 );
+	}
+	upper_index = attributes_index->number_of_entries;
+
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( identifier < attributes_index->entries[ middle_index ].identifier )
+		{
+			upper_index = middle_index;
+		}
+		else if( identifier > attributes_index->entries[ middle_index ].identifier )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			*attributes_index_entry = &( attributes_index->entries[ middle_index ] );
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
@@ -0,0 +1,103 @@
+/*
+ * Attributes index functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSHFS_ATTRIBUTES_INDEX_H )
+#define _LIBFSHFS_ATTRIBUTES_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfshfs_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfshfs_attributes_index_entry libfshfs_attributes_index_entry_t;
+
+struct libfshfs_attributes_index_entry
+{
+	/* The identifier (CNID)
+	 */
+	uint32_t identifier;
+
+	/* The number of the leaf node that contains the first record
+	 */
+	uint32_t node_number;
+
+	/* The index of the first record in the leaf node
+	 */
+	uint16_t record_index;
+
+	/* The number of records
+	 */
+	uint16_t number_of_records;
+
+	/* The flags
+	 */
+	uint8_t flags;
+};
+
+typedef struct libfshfs_attributes_index libfshfs_attributes_index_t;
+
+struct libfshfs_attributes_index
+{
+	/* The entries sorted by identifier
+	 */
+	libfshfs_attributes_index_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+};
+
+int libfshfs_attributes_index_initialize(
+     libfshfs_attributes_index_t **attributes_index,
+     libcerror_error_t **error );
+
+int libfshfs_attributes_index_free(
+     libfshfs_attributes_index_t **attributes_index,
+     libcerror_error_t **error );
+
+int libfshfs_attributes_index_append_record(
+     libfshfs_attributes_index_t *attributes_index,
+     uint32_t identifier,
+     uint32_t node_number,
+     uint16_t record_index,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+int libfshfs_attributes_index_get_entry_by_identifier(
+     libfshfs_attributes_index_t *attributes_index,
+     uint32_t identifier,
+     libfshfs_attributes_index_entry_t **attributes_index_entry,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSHFS_ATTRIBUTES_INDEX_H ) */
+
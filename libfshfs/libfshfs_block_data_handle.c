@@ -24,17 +24,20 @@
 #include <types.h>
 
 #include "libfshfs_block_data_handle.h"
+#include "libfshfs_definitions.h"
 #include "libfshfs_libbfio.h"
 #include "libfshfs_libcerror.h"
 #include "libfshfs_libfdata.h"
+#include "libfshfs_statistics.h"
 #include "libfshfs_unused.h"
 
 /* Reads data from the current offset into a buffer
- * Callback for the cluster block data stream
+ * Callback for the cluster block data stream, where the data handle
+ * is the statistics or NULL if not available
  * Returns the number of bytes read or -1 on error
  */
 ssize_t libfshfs_block_data_handle_read_segment_data(
-         intptr_t *data_handle LIBFSHFS_ATTRIBUTE_UNUSED,
+         libfshfs_statistics_t *statistics,
          libbfio_handle_t *file_io_handle,
          int segment_index LIBFSHFS_ATTRIBUTE_UNUSED,
          int segment_file_index LIBFSHFS_ATTRIBUTE_UNUSED,
@@ -47,7 +50,6 @@ ssize_t libfshfs_block_data_handle_read_segment_data(
 	static char *function = "libfshfs_block_data_handle_read_segment_data";
 	ssize_t read_count    = 0;
 
-	LIBFSHFS_UNREFERENCED_PARAMETER( data_handle )
 	LIBFSHFS_UNREFERENCED_PARAMETER( segment_index )
 	LIBFSHFS_UNREFERENCED_PARAMETER( segment_file_index )
 	LIBFSHFS_UNREFERENCED_PARAMETER( read_flags )
@@ -111,6 +113,24 @@ ssize_t libfshfs_block_data_handle_read_segment_data(
 
 			return( -1 );
 		}
+		if( statistics != NULL )
+		{
+			if( libfshfs_statistics_add_read(
+			     statistics,
+			     LIBFSHFS_STATISTICS_REGION_DATA,
+			     (uint64_t) read_count,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to add read to statistics.",
+				 function );
+
+				return( -1 );
+			}
+		}
 	}
 	return( read_count );
 }
@@ -29,13 +29,14 @@
 #include "libfshfs_libbfio.h"
 #include "libfshfs_libcerror.h"
 #include "libfshfs_libfdata.h"
+#include "libfshfs_statistics.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
 ssize_t libfshfs_block_data_handle_read_segment_data(
-         intptr_t *data_handle,
+         libfshfs_statistics_t *statistics,
          libbfio_handle_t *file_io_handle,
          int segment_index,
          int segment_file_index,
@@ -350,6 +350,24 @@ int libfshfs_btree_file_read_file_io_handle(
 
 			goto on_error;
 		}
+		if( io_handle->statistics != NULL )
+		{
+			if( libfshfs_statistics_add_read(
+			     io_handle->statistics,
+			     LIBFSHFS_STATISTICS_REGION_METADATA,
+			     (uint64_t) 512,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to add read to statistics.",
+				 function );
+
+				goto on_error;
+			}
+		}
 		if( libfshfs_btree_node_descriptor_initialize(
 		     &header_node_descriptor,
 		     error ) != 1 )
@@ -560,3 +578,107 @@ int libfshfs_btree_file_get_root_node(
 	return( 1 );
 }
 
+
+/* Retrieves a specific leaf node
+ * This function is intended for traversing the leaf nodes in order using
+ * the next node number of the node descriptor. The leaf nodes are cached
+ * at the deepest level, which has the largest cache.
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_btree_file_get_leaf_node_by_number(
+     libfshfs_btree_file_t *btree_file,
+     libbfio_handle_t *file_io_handle,
+     libfshfs_btree_node_cache_t *node_cache,
+     uint32_t node_number,
+     libfshfs_btree_node_t **leaf_node,
+     libcerror_error_t **error )
+{
+	libfshfs_btree_node_t *safe_leaf_node = NULL;
+	static char *function                 = "libfshfs_btree_file_get_leaf_node_by_number";
+	int is_leaf_node                      = 0;
+
+	if( btree_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid B-tree file.",
+		 function );
+
+		return( -1 );
+	}
+	if( leaf_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid leaf node.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_number == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid node number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfshfs_btree_node_vector_get_node_by_number(
+	     btree_file->node_vector,
+	     file_io_handle,
+	     node_cache,
+	     8,
+	     node_number,
+	     &safe_leaf_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve B-tree leaf node: %" PRIu32 ".",
+		 function,
+		 node_number );
+
+		return( -1 );
+	}
+	is_leaf_node = libfshfs_btree_node_is_leaf_node(
+	                safe_leaf_node,
+	                error );
+
+	if( is_leaf_node == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if B-tree node: %" PRIu32 " is a leaf node.",
+		 function,
+		 node_number );
+
+		return( -1 );
+	}
+	else if( is_leaf_node == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid B-tree node: %" PRIu32 " - not a leaf node.",
+		 function,
+		 node_number );
+
+		return( -1 );
+	}
+	*leaf_node = safe_leaf_node;
+
+	return( 1 );
+}
+
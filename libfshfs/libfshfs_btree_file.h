@@ -90,6 +90,14 @@ int libfshfs_btree_file_get_root_node(
      libfshfs_btree_node_t **root_node,
      libcerror_error_t **error );
 
+int libfshfs_btree_file_get_leaf_node_by_number(
+     libfshfs_btree_file_t *btree_file,
+     libbfio_handle_t *file_io_handle,
+     libfshfs_btree_node_cache_t *node_cache,
+     uint32_t node_number,
+     libfshfs_btree_node_t **leaf_node,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -27,9 +27,9 @@
 #include "libfshfs_btree_node.h"
 #include "libfshfs_btree_node_descriptor.h"
 #include "libfshfs_btree_node_record.h"
-#include "libfshfs_libcdata.h"
 #include "libfshfs_libcerror.h"
 #include "libfshfs_libcnotify.h"
+#include "libfshfs_libcthreads.h"
 
 #include "fshfs_btree.h"
 
@@ -140,30 +140,160 @@ int libfshfs_btree_node_initialize(
 	}
 	( *node )->data_size = data_size;
 
-	if( libcdata_array_initialize(
-	     &( ( *node )->records_array ),
+	return( 1 );
+
+on_error:
+	if( *node != NULL )
+	{
+		if( ( *node )->data != NULL )
+		{
+			memory_free(
+			 ( *node )->data );
+		}
+		if( ( *node )->descriptor != NULL )
+		{
+			libfshfs_btree_node_descriptor_free(
+			 &( ( *node )->descriptor ),
+			 NULL );
+		}
+		memory_free(
+		 *node );
+
+		*node = NULL;
+	}
+	return( -1 );
+}
+
+/* Creates a B-tree node that references its data in a memory mapping
+ * Make sure the value node is referencing, is set to NULL
+ * The memory mapping must remain available until the node is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_btree_node_initialize_from_mapped_data(
+     libfshfs_btree_node_t **node,
+     const uint8_t *mapped_data,
+     size64_t mapped_data_size,
+     off64_t data_offset,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_btree_node_initialize_from_mapped_data";
+
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid B-tree node.",
+		 function );
+
+		return( -1 );
+	}
+	if( *node != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid B-tree node value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( mapped_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_offset < 0 )
+	 || ( (size64_t) data_offset > mapped_data_size )
+	 || ( (size64_t) data_size > ( mapped_data_size - (size64_t) data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*node = memory_allocate_structure(
+	         libfshfs_btree_node_t );
+
+	if( *node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create B-tree node.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *node,
 	     0,
+	     sizeof( libfshfs_btree_node_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear B-tree node.",
+		 function );
+
+		memory_free(
+		 *node );
+
+		*node = NULL;
+
+		return( -1 );
+	}
+	if( libfshfs_btree_node_descriptor_initialize(
+	     &( ( *node )->descriptor ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create records array.",
+		 "%s: unable to create descriptor.",
 		 function );
 
 		goto on_error;
 	}
+	/* The node data is only read from and never modified
+	 */
+	( *node )->data           = (uint8_t *) &( mapped_data[ data_offset ] );
+	( *node )->data_size      = data_size;
+	( *node )->data_is_mapped = 1;
+
 	return( 1 );
 
 on_error:
 	if( *node != NULL )
 	{
-		if( ( *node )->data != NULL )
-		{
-			memory_free(
-			 ( *node )->data );
-		}
 		if( ( *node )->descriptor != NULL )
 		{
 			libfshfs_btree_node_descriptor_free(
@@ -179,14 +309,16 @@ on_error:
 }
 
 /* Frees a B-tree node
+ * If the node has additional references only a reference is released
  * Returns 1 if successful or -1 on error
  */
 int libfshfs_btree_node_free(
      libfshfs_btree_node_t **node,
      libcerror_error_t **error )
 {
-	static char *function = "libfshfs_btree_node_free";
-	int result            = 1;
+	static char *function    = "libfshfs_btree_node_free";
+	int number_of_references = 0;
+	int result               = 1;
 
 	if( node == NULL )
 	{
@@ -201,6 +333,56 @@ int libfshfs_btree_node_free(
 	}
 	if( *node != NULL )
 	{
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+		if( ( *node )->references_read_write_lock != NULL )
+		{
+			if( libcthreads_read_write_lock_grab_for_write(
+			     ( *node )->references_read_write_lock,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab read/write lock for writing.",
+				 function );
+
+				return( -1 );
+			}
+		}
+#endif
+		number_of_references = ( *node )->number_of_references;
+
+		if( number_of_references > 0 )
+		{
+			( *node )->number_of_references -= 1;
+		}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+		if( ( *node )->references_read_write_lock != NULL )
+		{
+			if( libcthreads_read_write_lock_release_for_write(
+			     ( *node )->references_read_write_lock,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release read/write lock for writing.",
+				 function );
+
+				return( -1 );
+			}
+		}
+#endif
+		/* The node is only freed when the last reference is released
+		 */
+		if( number_of_references > 0 )
+		{
+			*node = NULL;
+
+			return( 1 );
+		}
 		if( libfshfs_btree_node_descriptor_free(
 		     &( ( *node )->descriptor ),
 		     error ) != 1 )
@@ -214,21 +396,21 @@ int libfshfs_btree_node_free(
 
 			result = -1;
 		}
-		if( libcdata_array_free(
-		     &( ( *node )->records_array ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libfshfs_btree_node_record_free,
+		if( libfshfs_btree_node_free_records(
+		     *node,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free the records array.",
+			 "%s: unable to free records.",
 			 function );
 
 			result = -1;
 		}
-		if( ( *node )->data != NULL )
+		if( ( ( *node )->data != NULL )
+		 && ( ( *node )->data_is_mapped == 0 ) )
 		{
 			memory_free(
 			 ( *node )->data );
@@ -241,6 +423,135 @@ int libfshfs_btree_node_free(
 	return( result );
 }
 
+/* Adds a reference to a B-tree node
+ * Every reference must be released with libfshfs_btree_node_free
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_btree_node_add_reference(
+     libfshfs_btree_node_t *node,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_btree_node_add_reference";
+	int result            = 1;
+
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid B-tree node.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( node->references_read_write_lock != NULL )
+	{
+		if( libcthreads_read_write_lock_grab_for_write(
+		     node->references_read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	if( node->number_of_references == INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid B-tree node - number of references value exceeds maximum.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		node->number_of_references += 1;
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( node->references_read_write_lock != NULL )
+	{
+		if( libcthreads_read_write_lock_release_for_write(
+		     node->references_read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( result );
+}
+
+/* Frees the records of a B-tree node
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_btree_node_free_records(
+     libfshfs_btree_node_t *node,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_btree_node_free_records";
+	uint16_t record_index = 0;
+	int result            = 1;
+
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid B-tree node.",
+		 function );
+
+		return( -1 );
+	}
+	if( node->records != NULL )
+	{
+		for( record_index = 0;
+		     record_index < node->number_of_records;
+		     record_index++ )
+		{
+			if( libfshfs_btree_node_record_clear(
+			     &( node->records[ record_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to clear record: %" PRIu16 ".",
+				 function,
+				 record_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 node->records );
+
+		node->records = NULL;
+	}
+	node->number_of_records = 0;
+
+	return( result );
+}
+
 /* Reads a B-tree node
  * Returns 1 if successful or -1 on error
  */
@@ -250,15 +561,14 @@ int libfshfs_btree_node_read_data(
      size_t data_size,
      libcerror_error_t **error )
 {
-	uint16_t *record_offsets                  = NULL;
-	uint16_t *sorted_record_offsets           = NULL;
 	libfshfs_btree_node_record_t *node_record = NULL;
+	uint16_t *sorted_record_offsets           = NULL;
 	static char *function                     = "libfshfs_btree_node_read_data";
 	size_t records_data_offset                = 0;
 	size_t records_data_size                  = 0;
+	uint16_t number_of_records                = 0;
 	uint16_t record_offset                    = 0;
 	uint16_t sorted_record_offset             = 0;
-	int entry_index                           = 0;
 	int record_index                          = 0;
 	int sorted_record_index                   = 0;
 
@@ -277,6 +587,17 @@ int libfshfs_btree_node_read_data(
 
 		return( -1 );
 	}
+	if( node->records != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid B-tree node - records value already set.",
+		 function );
+
+		return( -1 );
+	}
 	if( data == NULL )
 	{
 		libcerror_error_set(
@@ -327,7 +648,9 @@ int libfshfs_btree_node_read_data(
 
 		goto on_error;
 	}
-	if( (size_t) node->descriptor->number_of_records > ( data_size / 2 ) - 1 )
+	number_of_records = node->descriptor->number_of_records;
+
+	if( (size_t) number_of_records > ( data_size / 2 ) - 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -338,7 +661,7 @@ int libfshfs_btree_node_read_data(
 
 		goto on_error;
 	}
-	records_data_size = ( (size_t) node->descriptor->number_of_records + 1 ) * 2;
+	records_data_size = ( (size_t) number_of_records + 1 ) * 2;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -352,64 +675,50 @@ int libfshfs_btree_node_read_data(
 		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 	}
 #endif
-	record_offsets = (uint16_t *) memory_allocate(
-	                               sizeof( uint16_t ) * node->descriptor->number_of_records );
+	if( number_of_records == 0 )
+	{
+		return( 1 );
+	}
+	/* The records are stored in a single allocation to limit the number
+	 * of allocations needed every time the node is read
+	 */
+	node->records = (libfshfs_btree_node_record_t *) memory_allocate(
+	                                                  sizeof( libfshfs_btree_node_record_t ) * number_of_records );
 
-	if( record_offsets == NULL )
+	if( node->records == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
 		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create record offsets.",
+		 "%s: unable to create records.",
 		 function );
 
 		goto on_error;
 	}
-	records_data_offset = data_size - 2;
-	data_size          -= records_data_size;
-
-	for( record_index = 0;
-	     record_index < (int) node->descriptor->number_of_records;
-	     record_index++ )
+	if( memory_set(
+	     node->records,
+	     0,
+	     sizeof( libfshfs_btree_node_record_t ) * number_of_records ) == NULL )
 	{
-		byte_stream_copy_to_uint16_big_endian(
-		 &( data[ records_data_offset ] ),
-		 record_offset );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear records.",
+		 function );
 
-		records_data_offset -= 2;
+		memory_free(
+		 node->records );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: record: % 2d offset\t\t\t: %" PRIu16 " (0x%04" PRIx16 ")\n",
-			 function,
-			 record_index,
-			 record_offset,
-			 record_offset );
-		}
-#endif
-		record_offsets[ record_index ] = record_offset;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		byte_stream_copy_to_uint16_big_endian(
-		 &( data[ records_data_offset ] ),
-		 value_16bit );
-		libcnotify_printf(
-		 "%s: free space offset\t\t\t: 0x%04" PRIx16 "\n",
-		 function,
-		 value_16bit );
+		node->records = NULL;
 
-		libcnotify_printf(
-		 "\n" );
+		goto on_error;
 	}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+	node->number_of_records = number_of_records;
 
 	sorted_record_offsets = (uint16_t *) memory_allocate(
-	                                      sizeof( uint16_t ) * node->descriptor->number_of_records );
+	                                      sizeof( uint16_t ) * number_of_records );
 
 	if( sorted_record_offsets == NULL )
 	{
@@ -422,26 +731,30 @@ int libfshfs_btree_node_read_data(
 
 		goto on_error;
 	}
-	if( memory_set(
-	     sorted_record_offsets,
-	     0,
-	     sizeof( uint16_t ) * node->descriptor->number_of_records ) == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear sorted record offsets.",
-		 function );
+	records_data_offset = data_size - 2;
+	data_size          -= records_data_size;
 
-		goto on_error;
-	}
 	for( record_index = 0;
-	     record_index < (int) node->descriptor->number_of_records;
+	     record_index < (int) number_of_records;
 	     record_index++ )
 	{
-		record_offset = record_offsets[ record_index ];
+		byte_stream_copy_to_uint16_big_endian(
+		 &( data[ records_data_offset ] ),
+		 record_offset );
+
+		records_data_offset -= 2;
 
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: record: % 2d offset\t\t\t: %" PRIu16 " (0x%04" PRIx16 ")\n",
+			 function,
+			 record_index,
+			 record_offset,
+			 record_offset );
+		}
+#endif
 		if( ( record_offset < sizeof( fshfs_btree_node_descriptor_t ) )
 		 || ( record_offset > data_size ) )
 		{
@@ -484,24 +797,13 @@ int libfshfs_btree_node_read_data(
 			sorted_record_offsets[ sorted_record_index ]     = record_offset;
 			sorted_record_offsets[ sorted_record_index + 1 ] = sorted_record_offset;
 		}
-		if( libfshfs_btree_node_record_initialize(
-		     &node_record,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create B-tree node record.",
-			 function );
+		node_record = &( node->records[ record_index ] );
 
-			goto on_error;
-		}
 		/* Note that record->data_size here is an approximation
 		 */
 		node_record->offset    = record_offset;
 		node_record->data      = &( data[ record_offset ] );
-		node_record->data_size = data_size - record_offset;
+		node_record->data_size = (uint16_t) ( data_size - record_offset );
 
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -515,59 +817,36 @@ int libfshfs_btree_node_read_data(
 			 node_record->data_size );
 		}
 #endif
-		if( libcdata_array_append_entry(
-		     node->records_array,
-		     &entry_index,
-		     (intptr_t *) node_record,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to append node record: %d.",
-			 function,
-			 record_index );
-
-			goto on_error;
-		}
-		node_record = NULL;
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
+		byte_stream_copy_to_uint16_big_endian(
+		 &( data[ records_data_offset ] ),
+		 value_16bit );
+		libcnotify_printf(
+		 "%s: free space offset\t\t\t: 0x%04" PRIx16 "\n",
+		 function,
+		 value_16bit );
+
 		libcnotify_printf(
 		 "\n" );
 	}
-#endif
-	memory_free(
-	 sorted_record_offsets );
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
 	memory_free(
-	 record_offsets );
+	 sorted_record_offsets );
 
 	return( 1 );
 
 on_error:
-	if( node_record != NULL )
-	{
-		libfshfs_btree_node_record_free(
-		 &node_record,
-		 NULL );
-	}
 	if( sorted_record_offsets != NULL )
 	{
 		memory_free(
 		 sorted_record_offsets );
 	}
-	if( record_offsets != NULL )
-	{
-		memory_free(
-		 record_offsets );
-	}
-	libcdata_array_empty(
-	 node->records_array,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libfshfs_btree_node_record_free,
+	libfshfs_btree_node_free_records(
+	 node,
 	 NULL );
 
 	return( -1 );
@@ -790,22 +1069,30 @@ int libfshfs_btree_node_get_record_by_index(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     node->records_array,
-	     (int) record_index,
-	     (intptr_t **) node_record,
-	     error ) != 1 )
+	if( node_record == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to retrieve node record: %" PRIu16 ".",
-		 function,
-		 record_index );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node record.",
+		 function );
 
 		return( -1 );
 	}
+	if( record_index >= node->number_of_records )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*node_record = &( node->records[ record_index ] );
+
 	return( 1 );
 }
 
@@ -855,34 +1142,19 @@ int libfshfs_btree_node_get_record_data_by_index(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     node->records_array,
-	     (int) record_index,
-	     (intptr_t **) &node_record,
-	     error ) != 1 )
+	if( record_index >= node->number_of_records )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to retrieve node record: %" PRIu16 ".",
-		 function,
-		 record_index );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record index value out of bounds.",
+		 function );
 
 		return( -1 );
 	}
-	if( node_record == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid node record: %" PRIu16 ".",
-		 function,
-		 record_index );
+	node_record = &( node->records[ record_index ] );
 
-		return( -1 );
-	}
 	*record_data      = node_record->data;
 	*record_data_size = node_record->data_size;
 
@@ -28,8 +28,8 @@
 #include "libfshfs_btree_node_descriptor.h"
 #include "libfshfs_btree_node_record.h"
 #include "libfshfs_libbfio.h"
-#include "libfshfs_libcdata.h"
 #include "libfshfs_libcerror.h"
+#include "libfshfs_libcthreads.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -51,9 +51,32 @@ struct libfshfs_btree_node
 	 */
 	size_t data_size;
 
-	/* The records array
+	/* Value to indicate the data is part of a memory mapping
+	 * and is not owned by the node
 	 */
-	libcdata_array_t *records_array;
+	uint8_t data_is_mapped;
+
+	/* The records
+	 * The records are stored in a single allocation
+	 */
+	libfshfs_btree_node_record_t *records;
+
+	/* The number of records
+	 */
+	uint16_t number_of_records;
+
+	/* The number of additional references to the node
+	 * such as directory entries that reference the node data
+	 */
+	int number_of_references;
+
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock that protects the number of references
+	 * The lock is owned by the node cache that contains the node
+	 * and is NULL if the node is not part of a node cache
+	 */
+	libcthreads_read_write_lock_t *references_read_write_lock;
+#endif
 };
 
 int libfshfs_btree_node_initialize(
@@ -61,10 +84,26 @@ int libfshfs_btree_node_initialize(
      size_t data_size,
      libcerror_error_t **error );
 
+int libfshfs_btree_node_initialize_from_mapped_data(
+     libfshfs_btree_node_t **node,
+     const uint8_t *mapped_data,
+     size64_t mapped_data_size,
+     off64_t data_offset,
+     size_t data_size,
+     libcerror_error_t **error );
+
 int libfshfs_btree_node_free(
      libfshfs_btree_node_t **node,
      libcerror_error_t **error );
 
+int libfshfs_btree_node_add_reference(
+     libfshfs_btree_node_t *node,
+     libcerror_error_t **error );
+
+int libfshfs_btree_node_free_records(
+     libfshfs_btree_node_t *node,
+     libcerror_error_t **error );
+
 int libfshfs_btree_node_read_data(
      libfshfs_btree_node_t *node,
      const uint8_t *data,
@@ -26,7 +26,9 @@
 #include "libfshfs_btree_node_cache.h"
 #include "libfshfs_definitions.h"
 #include "libfshfs_libcerror.h"
+#include "libfshfs_libcthreads.h"
 #include "libfshfs_libfcache.h"
+#include "libfshfs_types.h"
 
 /* Creates a B-tree node cache
  * Make sure the value btree_node_cache is referencing, is set to NULL
@@ -34,6 +36,7 @@
  */
 int libfshfs_btree_node_cache_initialize(
      libfshfs_btree_node_cache_t **btree_node_cache,
+     int statistics_region,
      libcerror_error_t **error )
 {
 	static char *function = "libfshfs_btree_node_cache_initialize";
@@ -62,6 +65,18 @@ int libfshfs_btree_node_cache_initialize(
 
 		return( -1 );
 	}
+	if( ( statistics_region < 0 )
+	 || ( statistics_region >= LIBFSHFS_STATISTICS_NUMBER_OF_BTREES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported statistics region.",
+		 function );
+
+		return( -1 );
+	}
 	*btree_node_cache = memory_allocate_structure(
 	                     libfshfs_btree_node_cache_t );
 
@@ -116,11 +131,60 @@ int libfshfs_btree_node_cache_initialize(
 		}
 		cache_size = LIBFSHFS_MAXIMUM_CACHE_ENTRIES_BTREE_FILE_NODES * ( depth + 1 );
 	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *btree_node_cache )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *btree_node_cache )->references_read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize references read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *btree_node_cache )->statistics_region = statistics_region;
+
 	return( 1 );
 
 on_error:
 	if( *btree_node_cache != NULL )
 	{
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+		if( ( *btree_node_cache )->read_write_lock != NULL )
+		{
+			libcthreads_read_write_lock_free(
+			 &( ( *btree_node_cache )->read_write_lock ),
+			 NULL );
+		}
+#endif
+		for( depth = 0;
+		     depth < 9;
+		     depth++ )
+		{
+			if( ( *btree_node_cache )->caches[ depth ] != NULL )
+			{
+				libfcache_cache_free(
+				 &( ( *btree_node_cache )->caches[ depth ] ),
+				 NULL );
+			}
+		}
 		memory_free(
 		 *btree_node_cache );
 
@@ -172,6 +236,37 @@ int libfshfs_btree_node_cache_free(
 				result = -1;
 			}
 		}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *btree_node_cache )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+		/* The references read/write lock is freed after the caches
+		 * since freeing the cached nodes uses it
+		 */
+		if( libcthreads_read_write_lock_free(
+		     &( ( *btree_node_cache )->references_read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free references read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		memory_free(
 		 *btree_node_cache );
 
@@ -180,3 +275,79 @@ int libfshfs_btree_node_cache_free(
 	return( result );
 }
 
+/* Grabs the B-tree node cache for the duration of a B-tree traversal
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_btree_node_cache_grab(
+     libfshfs_btree_node_cache_t *btree_node_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_btree_node_cache_grab";
+
+	if( btree_node_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid B-tree node cache.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     btree_node_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Releases the B-tree node cache after a B-tree traversal
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_btree_node_cache_release(
+     libfshfs_btree_node_cache_t *btree_node_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_btree_node_cache_release";
+
+	if( btree_node_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid B-tree node cache.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     btree_node_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
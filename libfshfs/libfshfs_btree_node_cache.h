@@ -26,6 +26,7 @@
 #include <types.h>
 
 #include "libfshfs_libcerror.h"
+#include "libfshfs_libcthreads.h"
 #include "libfshfs_libfcache.h"
 
 #if defined( __cplusplus )
@@ -39,16 +40,45 @@ struct libfshfs_btree_node_cache
 	/* One MRU cache for each level of the B-tree
 	 */
 	libfcache_cache_t *caches[ 9 ];
+
+	/* The statistics region of the B-tree
+	 */
+	int statistics_region;
+
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 * libfcache is not thread-safe and the nodes it returns are only valid
+	 * while no other B-tree traversal uses the cache, hence the lock is held
+	 * across an entire traversal
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+
+	/* The read/write lock that protects the number of references of
+	 * the cached nodes, shared by all the nodes in the cache
+	 * Nodes that are referenced by directory entries can be released
+	 * without holding the cache lock
+	 */
+	libcthreads_read_write_lock_t *references_read_write_lock;
+#endif
 };
 
 int libfshfs_btree_node_cache_initialize(
      libfshfs_btree_node_cache_t **btree_node_cache,
+     int statistics_region,
      libcerror_error_t **error );
 
 int libfshfs_btree_node_cache_free(
      libfshfs_btree_node_cache_t **btree_node_cache,
      libcerror_error_t **error );
 
+int libfshfs_btree_node_cache_grab(
+     libfshfs_btree_node_cache_t *btree_node_cache,
+     libcerror_error_t **error );
+
+int libfshfs_btree_node_cache_release(
+     libfshfs_btree_node_cache_t *btree_node_cache,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
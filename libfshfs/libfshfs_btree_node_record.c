@@ -127,32 +127,18 @@ int libfshfs_btree_node_record_free(
 	}
 	if( *node_record != NULL )
 	{
-		if( ( *node_record )->key_value != NULL )
+		if( libfshfs_btree_node_record_clear(
+		     *node_record,
+		     error ) != 1 )
 		{
-			if( ( *node_record )->key_value_free_function == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: invalid node record - missing key value free function.",
-				 function );
-
-				result = -1;
-			}
-			else if( ( *node_record )->key_value_free_function(
-				  &( ( *node_record )->key_value ),
-				  error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free key value.",
-				 function );
-
-				result = -1;
-			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear B-tree node record.",
+			 function );
+
+			result = -1;
 		}
 		memory_free(
 		 *node_record );
@@ -162,3 +148,58 @@ int libfshfs_btree_node_record_free(
 	return( result );
 }
 
+/* Clears a B-tree node record
+ * Frees the key value, if set, but not the node record itself
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_btree_node_record_clear(
+     libfshfs_btree_node_record_t *node_record,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_btree_node_record_clear";
+	int result            = 1;
+
+	if( node_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid B-tree node record.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_record->key_value != NULL )
+	{
+		if( node_record->key_value_free_function == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid node record - missing key value free function.",
+			 function );
+
+			result = -1;
+		}
+		else if( node_record->key_value_free_function(
+			  &( node_record->key_value ),
+			  error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free key value.",
+			 function );
+
+			result = -1;
+		}
+	}
+	node_record->key_value               = NULL;
+	node_record->key_value_free_function = NULL;
+
+	return( result );
+}
+
@@ -66,6 +66,10 @@ int libfshfs_btree_node_record_free(
      libfshfs_btree_node_record_t **node_record,
      libcerror_error_t **error );
 
+int libfshfs_btree_node_record_clear(
+     libfshfs_btree_node_record_t *node_record,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -34,6 +34,7 @@
 #include "libfshfs_libcnotify.h"
 #include "libfshfs_libfcache.h"
 #include "libfshfs_profiler.h"
+#include "libfshfs_statistics.h"
 #include "libfshfs_unused.h"
 
 /* Creates a B-tree node vector
@@ -235,11 +236,14 @@ int libfshfs_btree_node_vector_get_node_by_number(
 	libfcache_cache_value_t *cache_value = NULL;
 	libfshfs_btree_node_t *safe_node     = NULL;
 	libfshfs_extent_t *extent            = NULL;
+	libfshfs_statistics_t *statistics    = NULL;
 	static char *function                = "libfshfs_btree_node_vector_get_node_by_number";
 	size64_t extent_size                 = 0;
 	off64_t file_offset                  = 0;
 	off64_t node_offset                  = 0;
 	int extent_index                     = 0;
+	int number_of_cache_entries          = 0;
+	int number_of_cache_values           = 0;
 	int number_of_extents                = 0;
 	int result                           = 0;
 
@@ -314,6 +318,20 @@ int libfshfs_btree_node_vector_get_node_by_number(
 
 		return( -1 );
 	}
+	if( ( node_cache->statistics_region < 0 )
+	 || ( node_cache->statistics_region >= LIBFSHFS_STATISTICS_NUMBER_OF_BTREES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid B-tree node cache - statistics region value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	statistics = node_vector->io_handle->statistics;
+
 #if defined( HAVE_PROFILER )
 	if( node_vector->io_handle->profiler != NULL )
 	{
@@ -370,22 +388,48 @@ int libfshfs_btree_node_vector_get_node_by_number(
 
 			goto on_error;
 		}
+		if( statistics != NULL )
+		{
+			if( libfshfs_statistics_add_node_cache_values(
+			     statistics,
+			     node_cache->statistics_region,
+			     1,
+			     0,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to add node cache hit to statistics.",
+				 function );
+
+				goto on_error;
+			}
+		}
 	}
 	else
 	{
-		if( libfshfs_btree_node_initialize(
-		     &safe_node,
-		     (size_t) node_vector->node_size,
-		     error ) != 1 )
+		if( statistics != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create B-tree node.",
-			 function );
+			if( libfshfs_statistics_add_node_cache_values(
+			     statistics,
+			     node_cache->statistics_region,
+			     0,
+			     1,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to add node cache miss to statistics.",
+				 function );
 
-			goto on_error;
+				goto on_error;
+			}
 		}
 		if( libcdata_array_get_number_of_entries(
 		     node_vector->extents,
@@ -479,22 +523,154 @@ int libfshfs_btree_node_vector_get_node_by_number(
 
 			goto on_error;
 		}
-		if( libfshfs_btree_node_read_file_io_handle(
-		     safe_node,
-		     file_io_handle,
-		     file_offset,
-		     error ) != 1 )
+		/* Nodes that are contained in the memory mapped data are parsed in place
+		 */
+		if( ( node_vector->io_handle->mapped_data != NULL )
+		 && ( (size64_t) file_offset < node_vector->io_handle->mapped_data_size )
+		 && ( (size64_t) node_vector->node_size <= ( node_vector->io_handle->mapped_data_size - (size64_t) file_offset ) ) )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read element data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-			 function,
-			 file_offset,
-			 file_offset );
+			if( libfshfs_btree_node_initialize_from_mapped_data(
+			     &safe_node,
+			     node_vector->io_handle->mapped_data,
+			     node_vector->io_handle->mapped_data_size,
+			     file_offset,
+			     (size_t) node_vector->node_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create B-tree node.",
+				 function );
 
-			goto on_error;
+				goto on_error;
+			}
+			if( libfshfs_btree_node_read_data(
+			     safe_node,
+			     safe_node->data,
+			     safe_node->data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read B-tree node at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 file_offset,
+				 file_offset );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			if( libfshfs_btree_node_initialize(
+			     &safe_node,
+			     (size_t) node_vector->node_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create B-tree node.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfshfs_btree_node_read_file_io_handle(
+			     safe_node,
+			     file_io_handle,
+			     file_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read element data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 file_offset,
+				 file_offset );
+
+				goto on_error;
+			}
+			if( statistics != NULL )
+			{
+				if( libfshfs_statistics_add_read(
+				     statistics,
+				     node_cache->statistics_region,
+				     (uint64_t) node_vector->node_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to add read to statistics.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+		safe_node->references_read_write_lock = node_cache->references_read_write_lock;
+#endif
+		if( statistics != NULL )
+		{
+			if( libfcache_cache_get_number_of_entries(
+			     node_cache->caches[ depth ],
+			     &number_of_cache_entries,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of cache entries.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfcache_cache_get_number_of_cache_values(
+			     node_cache->caches[ depth ],
+			     &number_of_cache_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of cache values.",
+				 function );
+
+				goto on_error;
+			}
+			/* Setting a value in a full cache replaces the least recently used node
+			 */
+			if( number_of_cache_values >= number_of_cache_entries )
+			{
+				if( libfshfs_statistics_add_node_cache_values(
+				     statistics,
+				     node_cache->statistics_region,
+				     0,
+				     0,
+				     1,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to add node cache eviction to statistics.",
+					 function );
+
+					goto on_error;
+				}
+			}
 		}
 		if( libfcache_cache_set_value_by_identifier(
 		     node_cache->caches[ depth ],
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <byte_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #include "libfshfs_btree_file.h"
@@ -28,8 +29,10 @@
 #include "libfshfs_btree_node_cache.h"
 #include "libfshfs_btree_node_record.h"
 #include "libfshfs_catalog_btree_file.h"
+#include "libfshfs_catalog_index.h"
 #include "libfshfs_catalog_btree_key.h"
 #include "libfshfs_definitions.h"
+#include "libfshfs_directory_entries_page.h"
 #include "libfshfs_directory_entry.h"
 #include "libfshfs_directory_record.h"
 #include "libfshfs_file_record.h"
@@ -39,27 +42,39 @@
 #include "libfshfs_libcerror.h"
 #include "libfshfs_libcnotify.h"
 #include "libfshfs_libuna.h"
+#include "libfshfs_lookup_target.h"
+#include "libfshfs_memory_arena.h"
 #include "libfshfs_name.h"
+#include "libfshfs_path_cache.h"
 #include "libfshfs_thread_record.h"
 
 #include "fshfs_catalog_file.h"
+#include "fshfs_fork_descriptor.h"
 
-/* Retrieves the catalog B-tree key from a specific B-tree node record
+/* Reads the catalog B-tree key of a specific B-tree node record
  * Returns 1 if successful or -1 on error
  */
-int libfshfs_catalog_btree_file_get_key_from_node_by_index(
-     libfshfs_btree_node_t *node,
+int libfshfs_catalog_btree_file_read_key_from_node_record(
+     libfshfs_btree_node_record_t *node_record,
      libfshfs_io_handle_t *io_handle,
-     uint16_t record_index,
      int is_leaf_node,
-     libfshfs_catalog_btree_key_t **node_key,
+     libfshfs_catalog_btree_key_t *node_key,
      libcerror_error_t **error )
 {
-	libfshfs_btree_node_record_t *node_record   = NULL;
-	libfshfs_catalog_btree_key_t *safe_node_key = NULL;
-	static char *function                       = "libfshfs_catalog_btree_file_get_key_from_node_by_index";
-	size_t data_offset                          = 0;
+	static char *function = "libfshfs_catalog_btree_file_read_key_from_node_record";
+	size_t data_offset    = 0;
+
+	if( node_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid B-tree node record.",
+		 function );
 
+		return( -1 );
+	}
 	if( node_key == NULL )
 	{
 		libcerror_error_set(
@@ -82,6 +97,81 @@ int libfshfs_catalog_btree_file_get_key_from_node_by_index(
 
 		return( -1 );
 	}
+	if( libfshfs_catalog_btree_key_read_data(
+	     node_key,
+	     io_handle,
+	     node_record->data,
+	     node_record->data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read catalog B-tree key.",
+		 function );
+
+		return( -1 );
+	}
+	data_offset = (size_t) node_record->offset + node_key->data_size;
+
+	if( ( is_leaf_node != 0 )
+	 && ( io_handle->file_system_type == LIBFSHFS_FILE_SYSTEM_TYPE_HFS )
+	 && ( ( data_offset % 2 ) != 0 )
+	 && ( ( data_offset + 1 ) < node_record->data_size ) )
+	{
+		/* The HFS catalog index key of a leaf node can contain alignment padding data
+		 * that is not included in the key data size.
+		 */
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: alignment padding data:\n",
+			 function );
+			libcnotify_print_data(
+			 &( ( node_record->data )[ node_record->data_size ] ),
+			 1,
+			 0 );
+		}
+#endif
+		data_offset += 1;
+	}
+	data_offset -= node_record->offset;
+
+	node_key->record_data      = &( ( node_record->data )[ data_offset ] );
+	node_key->record_data_size = node_record->data_size - data_offset;
+
+	return( 1 );
+}
+
+/* Retrieves the catalog B-tree key from a specific B-tree node record
+ * The key is cached in the node record, including its folded name
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_catalog_btree_file_get_key_from_node_by_index(
+     libfshfs_btree_node_t *node,
+     libfshfs_io_handle_t *io_handle,
+     uint16_t record_index,
+     int is_leaf_node,
+     libfshfs_catalog_btree_key_t **node_key,
+     libcerror_error_t **error )
+{
+	libfshfs_btree_node_record_t *node_record   = NULL;
+	libfshfs_catalog_btree_key_t *safe_node_key = NULL;
+	static char *function                       = "libfshfs_catalog_btree_file_get_key_from_node_by_index";
+
+	if( node_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog B-tree key.",
+		 function );
+
+		return( -1 );
+	}
 	if( libfshfs_btree_node_get_record_by_index(
 	     node,
 	     record_index,
@@ -125,53 +215,25 @@ int libfshfs_catalog_btree_file_get_key_from_node_by_index(
 
 			goto on_error;
 		}
-		if( libfshfs_catalog_btree_key_read_data(
-		     safe_node_key,
+		if( libfshfs_catalog_btree_file_read_key_from_node_record(
+		     node_record,
 		     io_handle,
-		     node_record->data,
-		     node_record->data_size,
+		     is_leaf_node,
+		     safe_node_key,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read catalog B-tree key.",
-			 function );
+			 "%s: unable to read catalog B-tree key: %" PRIu16 ".",
+			 function,
+			 record_index );
 
 			goto on_error;
 		}
 		node_record->key_value               = (intptr_t *) safe_node_key;
 		node_record->key_value_free_function = (int (*)(intptr_t **, libcerror_error_t **)) &libfshfs_catalog_btree_key_free;
-
-		data_offset = (size_t) node_record->offset + safe_node_key->data_size;
-
-		if( ( is_leaf_node != 0 )
-		 && ( io_handle->file_system_type == LIBFSHFS_FILE_SYSTEM_TYPE_HFS )
-		 && ( ( data_offset % 2 ) != 0 )
-		 && ( ( data_offset + 1 ) < node_record->data_size ) )
-		{
-			/* The HFS catalog index key of a leaf node can contain alignment padding data
-			 * that is not included in the key data size.
-			 */
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: alignment padding data:\n",
-				 function );
-				libcnotify_print_data(
-				 &( ( node_record->data )[ node_record->data_size ] ),
-				 1,
-				 0 );
-			}
-#endif
-			data_offset += 1;
-		}
-		data_offset -= node_record->offset;
-
-		safe_node_key->record_data      = &( ( node_record->data )[ data_offset ] );
-		safe_node_key->record_data_size = node_record->data_size - data_offset;
 	}
 	*node_key = (libfshfs_catalog_btree_key_t *) node_record->key_value;
 
@@ -187,6 +249,96 @@ on_error:
 	return( -1 );
 }
 
+/* Retrieves a view of the catalog B-tree key from a specific B-tree node record
+ * The key is parsed into the caller provided key, without allocating or caching it,
+ * which is intended for sequential scans of leaf nodes. The view references the node
+ * data and has no folded name, hence it is valid as long as the node is
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_catalog_btree_file_get_key_view_from_node_by_index(
+     libfshfs_btree_node_t *node,
+     libfshfs_io_handle_t *io_handle,
+     uint16_t record_index,
+     int is_leaf_node,
+     libfshfs_catalog_btree_key_t *node_key,
+     libcerror_error_t **error )
+{
+	libfshfs_btree_node_record_t *node_record = NULL;
+	static char *function                     = "libfshfs_catalog_btree_file_get_key_view_from_node_by_index";
+
+	if( node_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog B-tree key.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfshfs_btree_node_get_record_by_index(
+	     node,
+	     record_index,
+	     &node_record,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve node record: %" PRIu16 ".",
+		 function,
+		 record_index );
+
+		return( -1 );
+	}
+	if( node_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing B-tree node record: %" PRIu16 ".",
+		 function,
+		 record_index );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     node_key,
+	     0,
+	     sizeof( libfshfs_catalog_btree_key_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear catalog B-tree key.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfshfs_catalog_btree_file_read_key_from_node_record(
+	     node_record,
+	     io_handle,
+	     is_leaf_node,
+	     node_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read catalog B-tree key: %" PRIu16 ".",
+		 function,
+		 record_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Retrieves a sub node number for from the catalog B-tree key
  * Returns 1 if successful or -1 on error
  */
@@ -910,10 +1062,14 @@ int libfshfs_catalog_btree_file_get_thread_record(
 }
 
 /* Retrieves a directory entry for from the catalog B-tree key
+ * If the node that contains the key is provided the name of the directory entry
+ * references the node data instead of being copied
  * Returns 1 if successful, 0 if not found or -1 on error
  */
 int libfshfs_catalog_btree_file_get_directory_entry_from_key(
+     libfshfs_btree_node_t *node,
      libfshfs_catalog_btree_key_t *node_key,
+     libfshfs_memory_arena_t *memory_arena,
      libfshfs_directory_entry_t **directory_entry,
      libcerror_error_t **error )
 {
@@ -988,9 +1144,21 @@ int libfshfs_catalog_btree_file_get_directory_entry_from_key(
 	{
 		case LIBFSHFS_RECORD_TYPE_HFSPLUS_DIRECTORY_RECORD:
 		case LIBFSHFS_RECORD_TYPE_HFS_DIRECTORY_RECORD:
-			if( libfshfs_directory_record_initialize(
-			     &directory_record,
-			     error ) != 1 )
+			if( memory_arena != NULL )
+			{
+				result = libfshfs_memory_arena_allocate(
+				          memory_arena,
+				          sizeof( libfshfs_directory_record_t ),
+				          (intptr_t **) &directory_record,
+				          error );
+			}
+			else
+			{
+				result = libfshfs_directory_record_initialize(
+				          &directory_record,
+				          error );
+			}
+			if( result != 1 )
 			{
 				libcerror_error_set(
 				 error,
@@ -1022,9 +1190,21 @@ int libfshfs_catalog_btree_file_get_directory_entry_from_key(
 
 		case LIBFSHFS_RECORD_TYPE_HFSPLUS_FILE_RECORD:
 		case LIBFSHFS_RECORD_TYPE_HFS_FILE_RECORD:
-			if( libfshfs_file_record_initialize(
-			     &file_record,
-			     error ) != 1 )
+			if( memory_arena != NULL )
+			{
+				result = libfshfs_memory_arena_allocate(
+				          memory_arena,
+				          sizeof( libfshfs_file_record_t ),
+				          (intptr_t **) &file_record,
+				          error );
+			}
+			else
+			{
+				result = libfshfs_file_record_initialize(
+				          &file_record,
+				          error );
+			}
+			if( result != 1 )
 			{
 				libcerror_error_set(
 				 error,
@@ -1035,6 +1215,8 @@ int libfshfs_catalog_btree_file_get_directory_entry_from_key(
 
 				goto on_error;
 			}
+			file_record->memory_arena = memory_arena;
+
 			if( libfshfs_file_record_read_data(
 			     file_record,
 			     node_key->record_data,
@@ -1057,11 +1239,25 @@ int libfshfs_catalog_btree_file_get_directory_entry_from_key(
 		default:
 			break;
 	}
+	result = 0;
+
 	if( catalog_record != NULL )
 	{
-		if( libfshfs_directory_entry_initialize(
-		     &safe_directory_entry,
-		     error ) != 1 )
+		if( memory_arena != NULL )
+		{
+			result = libfshfs_memory_arena_allocate(
+			          memory_arena,
+			          sizeof( libfshfs_directory_entry_t ),
+			          (intptr_t **) &safe_directory_entry,
+			          error );
+		}
+		else
+		{
+			result = libfshfs_directory_entry_initialize(
+			          &safe_directory_entry,
+			          error );
+		}
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -1072,12 +1268,28 @@ int libfshfs_catalog_btree_file_get_directory_entry_from_key(
 
 			goto on_error;
 		}
-		if( libfshfs_directory_entry_set_name(
-		     safe_directory_entry,
-		     node_key->name_data,
-		     node_key->name_size,
-		     node_key->codepage,
-		     error ) != 1 )
+		safe_directory_entry->memory_arena = memory_arena;
+
+		if( node != NULL )
+		{
+			result = libfshfs_directory_entry_set_name_from_node(
+			          safe_directory_entry,
+			          node,
+			          node_key->name_data,
+			          node_key->name_size,
+			          node_key->codepage,
+			          error );
+		}
+		else
+		{
+			result = libfshfs_directory_entry_set_name(
+			          safe_directory_entry,
+			          node_key->name_data,
+			          node_key->name_size,
+			          node_key->codepage,
+			          error );
+		}
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -1115,17 +1327,22 @@ int libfshfs_catalog_btree_file_get_directory_entry_from_key(
 	return( result );
 
 on_error:
-	if( file_record != NULL )
-	{
-		libfshfs_file_record_free(
-		 &file_record,
-		 NULL );
-	}
-	if( directory_record != NULL )
+	/* Records allocated from the memory arena are freed with the memory arena
+	 */
+	if( memory_arena == NULL )
 	{
-		libfshfs_directory_record_free(
-		 &directory_record,
-		 NULL );
+		if( file_record != NULL )
+		{
+			libfshfs_file_record_free(
+			 &file_record,
+			 NULL );
+		}
+		if( directory_record != NULL )
+		{
+			libfshfs_directory_record_free(
+			 &directory_record,
+			 NULL );
+		}
 	}
 	if( safe_directory_entry != NULL )
 	{
@@ -1323,7 +1540,9 @@ int libfshfs_catalog_btree_file_get_directory_entry_from_leaf_node_by_thread_rec
 			if( compare_result == LIBUNA_COMPARE_EQUAL )
 			{
 				result = libfshfs_catalog_btree_file_get_directory_entry_from_key(
+				          node,
 				          node_key,
+				          NULL,
 				          directory_entry,
 				          error );
 
@@ -2054,7 +2273,9 @@ int libfshfs_catalog_btree_file_get_directory_entry_from_leaf_node_by_utf8_name(
 					}
 				}
 				result = libfshfs_catalog_btree_file_get_directory_entry_from_key(
+				          node,
 				          node_key,
+				          NULL,
 				          directory_entry,
 				          error );
 
@@ -2537,6 +2758,7 @@ int libfshfs_catalog_btree_file_get_directory_entry_by_utf8_path(
      libfshfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libfshfs_btree_node_cache_t *node_cache,
+     libfshfs_path_cache_t *path_cache,
      const uint8_t *utf8_string,
      size_t utf8_string_length,
      uint8_t use_case_folding,
@@ -2550,9 +2772,11 @@ int libfshfs_catalog_btree_file_get_directory_entry_by_utf8_path(
 	libuna_unicode_character_t unicode_character     = 0;
 	size_t utf8_string_index                         = 0;
 	size_t utf8_string_segment_length                = 0;
+	uint32_t entry_identifier                        = 0;
 	uint32_t lookup_identifier                       = 0;
 	uint32_t segment_name_hash                       = 0;
 	uint8_t node_type                                = 0;
+	int cache_result                                 = 0;
 	int result                                       = 0;
 
 	if( btree_file == NULL )
@@ -2736,67 +2960,164 @@ int libfshfs_catalog_btree_file_get_directory_entry_by_utf8_path(
 
 				goto on_error;
 			}
-			if( node_type == LIBFSHFS_BTREE_NODE_TYPE_INDEX_NODE )
+			cache_result = 0;
+
+			if( path_cache != NULL )
 			{
-				result = libfshfs_catalog_btree_file_get_directory_entry_from_branch_node_by_utf8_name(
-					  btree_file,
-					  io_handle,
-					  file_io_handle,
-					  node_cache,
-					  root_node,
-					  lookup_identifier,
-					  segment_name_hash,
-					  utf8_string_segment,
-					  utf8_string_segment_length,
-					  use_case_folding,
-					  &safe_directory_entry,
-					  1,
-					  error );
+				cache_result = libfshfs_path_cache_get_identifier(
+				                path_cache,
+				                lookup_identifier,
+				                segment_name_hash,
+				                LIBFSHFS_PATH_CACHE_NAME_TYPE_UTF8,
+				                utf8_string_segment,
+				                utf8_string_segment_length,
+				                &entry_identifier,
+				                error );
+
+				if( cache_result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve identifier from path cache.",
+					 function );
+
+					goto on_error;
+				}
+				else if( cache_result != 0 )
+				{
+					/* The directory entry is retrieved by identifier after the last segment
+					 */
+					result = 0;
+
+					if( entry_identifier != 0 )
+					{
+						result = 1;
+					}
+				}
 			}
-			else if( node_type == LIBFSHFS_BTREE_NODE_TYPE_LEAF_NODE )
+			if( cache_result == 0 )
 			{
-				result = libfshfs_catalog_btree_file_get_directory_entry_from_leaf_node_by_utf8_name(
-					  btree_file,
-					  io_handle,
-					  root_node,
-					  lookup_identifier,
-					  segment_name_hash,
-					  utf8_string_segment,
-					  utf8_string_segment_length,
-					  use_case_folding,
-					  &safe_directory_entry,
-					  error );
-			}
-		}
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve directory entry by name.",
-			 function );
+				if( node_type == LIBFSHFS_BTREE_NODE_TYPE_INDEX_NODE )
+				{
+					result = libfshfs_catalog_btree_file_get_directory_entry_from_branch_node_by_utf8_name(
+						  btree_file,
+						  io_handle,
+						  file_io_handle,
+						  node_cache,
+						  root_node,
+						  lookup_identifier,
+						  segment_name_hash,
+						  utf8_string_segment,
+						  utf8_string_segment_length,
+						  use_case_folding,
+						  &safe_directory_entry,
+						  1,
+						  error );
+				}
+				else if( node_type == LIBFSHFS_BTREE_NODE_TYPE_LEAF_NODE )
+				{
+					result = libfshfs_catalog_btree_file_get_directory_entry_from_leaf_node_by_utf8_name(
+						  btree_file,
+						  io_handle,
+						  root_node,
+						  lookup_identifier,
+						  segment_name_hash,
+						  utf8_string_segment,
+						  utf8_string_segment_length,
+						  use_case_folding,
+						  &safe_directory_entry,
+						  error );
+				}
+				entry_identifier = 0;
 
-			goto on_error;
-		}
-		else if( result == 0 )
-		{
-			break;
-		}
-		if( libfshfs_directory_entry_get_identifier(
-		     safe_directory_entry,
-		     &lookup_identifier,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				if( result == 1 )
+				{
+					if( libfshfs_directory_entry_get_identifier(
+					     safe_directory_entry,
+					     &entry_identifier,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve directory entry identifier.",
+						 function );
+
+						goto on_error;
+					}
+				}
+				if( ( result != -1 )
+				 && ( path_cache != NULL ) )
+				{
+					if( libfshfs_path_cache_set_identifier(
+					     path_cache,
+					     lookup_identifier,
+					     segment_name_hash,
+					     LIBFSHFS_PATH_CACHE_NAME_TYPE_UTF8,
+					     utf8_string_segment,
+					     utf8_string_segment_length,
+					     entry_identifier,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+						 "%s: unable to set identifier in path cache.",
+						 function );
+
+						goto on_error;
+					}
+				}
+			}
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve directory entry identifier.",
+			 "%s: unable to retrieve directory entry by name.",
 			 function );
 
 			goto on_error;
 		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		lookup_identifier = entry_identifier;
+	}
+	if( ( result == 1 )
+	 && ( safe_directory_entry == NULL ) )
+	{
+		/* The last segment was found in the path cache
+		 */
+		result = libfshfs_catalog_btree_file_get_directory_entry_by_identifier(
+		          btree_file,
+		          io_handle,
+		          file_io_handle,
+		          node_cache,
+		          lookup_identifier,
+		          use_case_folding,
+		          &safe_directory_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry: %" PRIu32 " from catalog B-tree file.",
+			 function,
+			 lookup_identifier );
+
+			goto on_error;
+		}
 	}
 	if( result != 0 )
 	{
@@ -2814,252 +3135,534 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves a directory entry for an UTF-16 encoded name from the catalog B-tree leaf node
- * Returns 1 if successful, 0 if not found or -1 on error
+/* Compares a catalog B-tree key with the catalog key of a lookup target
+ * Returns LIBUNA_COMPARE_LESS, LIBUNA_COMPARE_EQUAL, LIBUNA_COMPARE_GREATER if successful or -1 on error
  */
-int libfshfs_catalog_btree_file_get_directory_entry_from_leaf_node_by_utf16_name(
-     libfshfs_btree_file_t *btree_file,
-     libfshfs_io_handle_t *io_handle,
-     libfshfs_btree_node_t *node,
-     uint32_t parent_identifier,
-     uint32_t name_hash,
-     const uint16_t *utf16_string,
-     size_t utf16_string_length,
+int libfshfs_catalog_btree_file_compare_key_with_lookup_target(
+     libfshfs_catalog_btree_key_t *node_key,
+     libfshfs_lookup_target_t *lookup_target,
      uint8_t use_case_folding,
-     libfshfs_directory_entry_t **directory_entry,
      libcerror_error_t **error )
 {
-	libfshfs_catalog_btree_key_t *node_key = NULL;
-	static char *function                  = "libfshfs_catalog_btree_file_get_directory_entry_from_leaf_node_by_utf16_name";
-	uint16_t record_index                  = 0;
-	uint16_t record_type                   = 0;
-	int compare_result                     = 0;
-	int is_leaf_node                       = 0;
-	int result                             = 0;
+	static char *function = "libfshfs_catalog_btree_file_compare_key_with_lookup_target";
+	int result            = 0;
 
-	if( btree_file == NULL )
+	if( node_key == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid B-tree file.",
+		 "%s: invalid catalog B-tree key.",
 		 function );
 
 		return( -1 );
 	}
-	if( node == NULL )
+	if( lookup_target == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid B-tree node.",
+		 "%s: invalid lookup target.",
 		 function );
 
 		return( -1 );
 	}
-	if( node->descriptor == NULL )
+	if( node_key->parent_identifier < lookup_target->parent_identifier )
+	{
+		return( LIBUNA_COMPARE_LESS );
+	}
+	else if( node_key->parent_identifier > lookup_target->parent_identifier )
+	{
+		return( LIBUNA_COMPARE_GREATER );
+	}
+	/* The key of a thread record has an empty name and sorts before the other keys of the same parent
+	 */
+	if( ( node_key->name_data == NULL )
+	 || ( node_key->name_size == 0 ) )
+	{
+		if( lookup_target->folded_name_length == 0 )
+		{
+			return( LIBUNA_COMPARE_EQUAL );
+		}
+		return( LIBUNA_COMPARE_LESS );
+	}
+	if( lookup_target->folded_name_length == 0 )
+	{
+		return( LIBUNA_COMPARE_GREATER );
+	}
+	if( libfshfs_catalog_btree_key_get_folded_name(
+	     node_key,
+	     use_case_folding,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid B-tree node - missing descriptor.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve folded name.",
 		 function );
 
 		return( -1 );
 	}
-	if( directory_entry == NULL )
+	result = libfshfs_name_compare_folded_names(
+	          node_key->folded_name,
+	          node_key->folded_name_length,
+	          lookup_target->folded_name,
+	          lookup_target->folded_name_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to compare folded names.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the leaf node that can contain the catalog key of a lookup target
+ * The B-tree is descended by following the last key that does not exceed the catalog key
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_catalog_btree_file_get_leaf_node_by_lookup_target(
+     libfshfs_btree_file_t *btree_file,
+     libfshfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfshfs_btree_node_cache_t *node_cache,
+     libfshfs_lookup_target_t *lookup_target,
+     uint8_t use_case_folding,
+     libfshfs_btree_node_t **leaf_node,
+     libcerror_error_t **error )
+{
+	libfshfs_btree_node_t *node                 = NULL;
+	libfshfs_catalog_btree_key_t *last_node_key = NULL;
+	libfshfs_catalog_btree_key_t *node_key      = NULL;
+	static char *function                       = "libfshfs_catalog_btree_file_get_leaf_node_by_lookup_target";
+	uint32_t node_number                        = 0;
+	uint16_t record_index                       = 0;
+	uint8_t node_type                           = 0;
+	int compare_result                          = 0;
+	int recursion_depth                         = 0;
+
+	if( btree_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory entry.",
+		 "%s: invalid B-tree file.",
 		 function );
 
 		return( -1 );
 	}
-	is_leaf_node = libfshfs_btree_node_is_leaf_node(
-	                node,
-	                error );
-
-	if( is_leaf_node == -1 )
+	if( btree_file->header == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine if B-tree node is a leaf node.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid B-tree file - missing header.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	else if( is_leaf_node == 0 )
+	if( leaf_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid leaf node.",
+		 function );
+
+		return( -1 );
+	}
+	node_number = btree_file->header->root_node_number;
+
+	if( libfshfs_btree_file_get_root_node(
+	     btree_file,
+	     file_io_handle,
+	     node_cache,
+	     &node,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid node - not a leaf node.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve B-tree root node.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	for( record_index = 0;
-	     record_index < node->descriptor->number_of_records;
-	     record_index++ )
+	while( node != NULL )
 	{
-		if( libfshfs_catalog_btree_file_get_key_from_node_by_index(
+		if( libfshfs_btree_node_get_node_type(
 		     node,
-		     io_handle,
-		     record_index,
-		     1,
-		     &node_key,
-		     error ) == -1 )
+		     &node_type,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve catalog B-tree key: %" PRIu16 ".",
+			 "%s: unable to determine if B-tree node: %" PRIu32 " type.",
 			 function,
-			 record_index );
+			 node_number );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( node_key == NULL )
+		if( node_type == LIBFSHFS_BTREE_NODE_TYPE_LEAF_NODE )
+		{
+			break;
+		}
+		if( node_type != LIBFSHFS_BTREE_NODE_TYPE_INDEX_NODE )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing catalog B-tree key: %" PRIu16 ".",
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported B-tree node: %" PRIu32 " type: 0x%02" PRIx8 ".",
 			 function,
-			 record_index );
+			 node_number,
+			 node_type );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( node_key->parent_identifier == parent_identifier )
+		if( recursion_depth >= LIBFSHFS_MAXIMUM_BTREE_NODE_RECURSION_DEPTH )
 		{
-			if( node_key->record_data_size < 2 )
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid recursion depth value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfshfs_catalog_btree_file_get_key_from_node_by_index(
+		     node,
+		     io_handle,
+		     0,
+		     0,
+		     &last_node_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve catalog B-tree key: 0 from node: %" PRIu32 ".",
+			 function,
+			 node_number );
+
+			return( -1 );
+		}
+		for( record_index = 1;
+		     record_index < node->descriptor->number_of_records;
+		     record_index++ )
+		{
+			if( libfshfs_catalog_btree_file_get_key_from_node_by_index(
+			     node,
+			     io_handle,
+			     record_index,
+			     0,
+			     &node_key,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid catalog B-tree key: %" PRIu16 " - record data size value out of bounds.",
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve catalog B-tree key: %" PRIu16 " from node: %" PRIu32 ".",
 				 function,
-				 record_index );
+				 record_index,
+				 node_number );
 
-				goto on_error;
+				return( -1 );
 			}
-			byte_stream_copy_to_uint16_big_endian(
-			 node_key->record_data,
-			 record_type );
+			compare_result = libfshfs_catalog_btree_file_compare_key_with_lookup_target(
+			                  node_key,
+			                  lookup_target,
+			                  use_case_folding,
+			                  error );
 
-			compare_result = LIBUNA_COMPARE_LESS;
+			if( compare_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare catalog B-tree key: %" PRIu16 " from node: %" PRIu32 " with lookup target.",
+				 function,
+				 record_index,
+				 node_number );
 
-			switch( record_type )
+				return( -1 );
+			}
+			else if( compare_result == LIBUNA_COMPARE_GREATER )
 			{
-				case LIBFSHFS_RECORD_TYPE_HFSPLUS_DIRECTORY_RECORD:
-				case LIBFSHFS_RECORD_TYPE_HFSPLUS_FILE_RECORD:
-				case LIBFSHFS_RECORD_TYPE_HFS_DIRECTORY_RECORD:
-				case LIBFSHFS_RECORD_TYPE_HFS_FILE_RECORD:
-					if( ( node_key->name_hash == 0 )
-					 || ( node_key->name_hash == name_hash ) )
-					{
-						compare_result = libfshfs_catalog_btree_key_compare_name_with_utf16_string(
-						                  node_key,
-						                  utf16_string,
-						                  utf16_string_length,
-						                  use_case_folding,
-						                  error );
+				break;
+			}
+			last_node_key = node_key;
+		}
+		if( libfshfs_catalog_btree_file_get_sub_node_number_from_key(
+		     last_node_key,
+		     &node_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub node number from catalog B-Tree key.",
+			 function );
 
-						if( compare_result == -1 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_GENERIC,
-							 "%s: unable to compare UTF-16 string with catalog B-tree key name.",
-							 function );
+			return( -1 );
+		}
+		recursion_depth++;
 
-							goto on_error;
-						}
-					}
-					break;
+		if( libfshfs_btree_file_get_node_by_number(
+		     btree_file,
+		     file_io_handle,
+		     node_cache,
+		     recursion_depth,
+		     node_number,
+		     &node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve B-tree sub node: %" PRIu32 ".",
+			 function,
+			 node_number );
 
-				default:
-					break;
-			}
-			if( compare_result == LIBUNA_COMPARE_EQUAL )
+			return( -1 );
+		}
+	}
+	*leaf_node = node;
+
+	return( 1 );
+}
+
+/* Retrieves the catalog records of the pending lookup targets from the catalog B-tree file
+ * The lookup targets must be sorted by libfshfs_lookup_target_compare_by_key
+ * Since the catalog keys are looked up in the order of the B-tree, consecutive targets
+ * that are stored in the same leaf node share the descent of the B-tree and the leaf node
+ * records are scanned only once
+ * For the key of a thread record the thread record is set and for other keys the directory entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_catalog_btree_file_get_records_by_lookup_targets(
+     libfshfs_btree_file_t *btree_file,
+     libfshfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfshfs_btree_node_cache_t *node_cache,
+     libfshfs_lookup_target_t *lookup_targets,
+     int number_of_lookup_targets,
+     uint8_t use_case_folding,
+     libcerror_error_t **error )
+{
+	libfshfs_btree_node_t *leaf_node        = NULL;
+	libfshfs_catalog_btree_key_t *node_key  = NULL;
+	libfshfs_lookup_target_t *lookup_target = NULL;
+	static char *function                   = "libfshfs_catalog_btree_file_get_records_by_lookup_targets";
+	uint16_t record_index                   = 0;
+	int compare_result                      = 0;
+	int is_shared_leaf_node                 = 0;
+	int lookup_target_index                 = 0;
+	int result                              = 0;
+
+	if( lookup_targets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lookup targets.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_lookup_targets < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of lookup targets value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	for( lookup_target_index = 0;
+	     lookup_target_index < number_of_lookup_targets;
+	     lookup_target_index++ )
+	{
+		lookup_target = &( lookup_targets[ lookup_target_index ] );
+
+		/* The pending targets are sorted before the other targets
+		 */
+		if( lookup_target->is_pending == 0 )
+		{
+			break;
+		}
+		if( ( lookup_target->thread_record != NULL )
+		 || ( lookup_target->directory_entry != NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid lookup target: %d - record value already set.",
+			 function,
+			 lookup_target->index );
+
+			return( -1 );
+		}
+		is_shared_leaf_node = ( leaf_node != NULL );
+
+		do
+		{
+			if( leaf_node == NULL )
 			{
-				if( node_key->name_hash == 0 )
+				if( libfshfs_catalog_btree_file_get_leaf_node_by_lookup_target(
+				     btree_file,
+				     io_handle,
+				     file_io_handle,
+				     node_cache,
+				     lookup_target,
+				     use_case_folding,
+				     &leaf_node,
+				     error ) != 1 )
 				{
-					if( libfshfs_name_calculate_hash(
-					     node_key->name_data,
-					     (size_t) node_key->name_size,
-					     node_key->codepage,
-					     use_case_folding,
-					     &( node_key->name_hash ),
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_GENERIC,
-						 "%s: unable to calculate name hash.",
-						 function );
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve leaf node of lookup target: %d.",
+					 function,
+					 lookup_target->index );
 
-						goto on_error;
-					}
+					return( -1 );
 				}
-				result = libfshfs_catalog_btree_file_get_directory_entry_from_key(
-				          node_key,
-				          directory_entry,
-				          error );
+				record_index = 0;
+			}
+			compare_result = LIBUNA_COMPARE_LESS;
 
-				if( result == -1 )
+			/* The records before record index are less than the key of the previous target
+			 */
+			while( record_index < leaf_node->descriptor->number_of_records )
+			{
+				if( libfshfs_catalog_btree_file_get_key_from_node_by_index(
+				     leaf_node,
+				     io_handle,
+				     record_index,
+				     1,
+				     &node_key,
+				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve directory entry from record data.",
-					 function );
+					 "%s: unable to retrieve catalog B-tree key: %" PRIu16 ".",
+					 function,
+					 record_index );
 
-					goto on_error;
+					return( -1 );
+				}
+				compare_result = libfshfs_catalog_btree_file_compare_key_with_lookup_target(
+				                  node_key,
+				                  lookup_target,
+				                  use_case_folding,
+				                  error );
+
+				if( compare_result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to compare catalog B-tree key: %" PRIu16 " with lookup target: %d.",
+					 function,
+					 record_index,
+					 lookup_target->index );
+
+					return( -1 );
+				}
+				else if( compare_result != LIBUNA_COMPARE_LESS )
+				{
+					break;
 				}
+				record_index++;
+			}
+			/* If all the keys of a shared leaf node are less than the key of the target
+			 * the target can be stored in a following leaf node
+			 */
+			if( ( compare_result == LIBUNA_COMPARE_LESS )
+			 && ( is_shared_leaf_node != 0 ) )
+			{
+				leaf_node           = NULL;
+				is_shared_leaf_node = 0;
+
+				continue;
 			}
+			break;
 		}
-		if( ( result == 1 )
-		 || ( node_key->parent_identifier > parent_identifier ) )
+		while( leaf_node == NULL );
+
+		if( compare_result != LIBUNA_COMPARE_EQUAL )
 		{
-			break;
+			continue;
 		}
-	}
-	return( result );
+		if( lookup_target->folded_name_length == 0 )
+		{
+			result = libfshfs_catalog_btree_file_get_thread_record_from_key(
+			          node_key,
+			          &( lookup_target->thread_record ),
+			          error );
+		}
+		else
+		{
+			result = libfshfs_catalog_btree_file_get_directory_entry_from_key(
+			          leaf_node,
+			          node_key,
+			          NULL,
+			          &( lookup_target->directory_entry ),
+			          error );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record of lookup target: %d.",
+			 function,
+			 lookup_target->index );
 
-on_error:
-	if( *directory_entry != NULL )
-	{
-		libfshfs_directory_entry_free(
-		 directory_entry,
-		 NULL );
+			return( -1 );
+		}
 	}
-	return( -1 );
+	return( 1 );
 }
 
-/* Retrieves a directory entry for an UTF-16 encoded name from the catalog B-tree branch node
+/* Retrieves a directory entry for an UTF-16 encoded name from the catalog B-tree leaf node
  * Returns 1 if successful, 0 if not found or -1 on error
  */
-int libfshfs_catalog_btree_file_get_directory_entry_from_branch_node_by_utf16_name(
+int libfshfs_catalog_btree_file_get_directory_entry_from_leaf_node_by_utf16_name(
      libfshfs_btree_file_t *btree_file,
      libfshfs_io_handle_t *io_handle,
-     libbfio_handle_t *file_io_handle,
-     libfshfs_btree_node_cache_t *node_cache,
      libfshfs_btree_node_t *node,
      uint32_t parent_identifier,
      uint32_t name_hash,
@@ -3067,23 +3670,15 @@ int libfshfs_catalog_btree_file_get_directory_entry_from_branch_node_by_utf16_na
      size_t utf16_string_length,
      uint8_t use_case_folding,
      libfshfs_directory_entry_t **directory_entry,
-     int recursion_depth,
      libcerror_error_t **error )
 {
-	libfshfs_btree_node_t *sub_node             = NULL;
-	libfshfs_catalog_btree_key_t *last_node_key = NULL;
-	libfshfs_catalog_btree_key_t *node_key      = NULL;
-	static char *function                       = "libfshfs_catalog_btree_file_get_directory_entry_from_branch_node_by_utf16_name";
-	uint32_t sub_node_number                    = 0;
-	uint16_t record_index                       = 0;
-	uint8_t node_type                           = 0;
-	int compare_result                          = 0;
-	int is_branch_node                          = 0;
-	int result                                  = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	uint16_t last_record_index                  = 0;
-#endif
+	libfshfs_catalog_btree_key_t *node_key = NULL;
+	static char *function                  = "libfshfs_catalog_btree_file_get_directory_entry_from_leaf_node_by_utf16_name";
+	uint16_t record_index                  = 0;
+	uint16_t record_type                   = 0;
+	int compare_result                     = 0;
+	int is_leaf_node                       = 0;
+	int result                             = 0;
 
 	if( btree_file == NULL )
 	{
@@ -3129,86 +3724,2205 @@ int libfshfs_catalog_btree_file_get_directory_entry_from_branch_node_by_utf16_na
 
 		return( -1 );
 	}
-	if( ( recursion_depth < 0 )
-	 || ( recursion_depth > LIBFSHFS_MAXIMUM_BTREE_NODE_RECURSION_DEPTH ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid recursion depth value out of bounds.",
-		 function );
-
-		return( -1 );
-	}
-	is_branch_node = libfshfs_btree_node_is_branch_node(
-	                  node,
-	                  error );
+	is_leaf_node = libfshfs_btree_node_is_leaf_node(
+	                node,
+	                error );
 
-	if( is_branch_node == -1 )
+	if( is_leaf_node == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine if B-tree node is a branch node.",
+		 "%s: unable to determine if B-tree node is a leaf node.",
 		 function );
 
 		goto on_error;
 	}
-	else if( is_branch_node == 0 )
+	else if( is_leaf_node == 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid node - not a branch node.",
-		 function );
-
-		goto on_error;
-	}
-	if( libfshfs_catalog_btree_file_get_key_from_node_by_index(
-	     node,
-	     io_handle,
-	     0,
-	     0,
-	     &last_node_key,
-	     error ) == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve catalog B-tree key: 0.",
+		 "%s: invalid node - not a leaf node.",
 		 function );
 
 		goto on_error;
 	}
-	node_key = last_node_key;
-
-	for( record_index = 1;
-	     record_index <= node->descriptor->number_of_records;
+	for( record_index = 0;
+	     record_index < node->descriptor->number_of_records;
 	     record_index++ )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		if( libfshfs_catalog_btree_file_get_key_from_node_by_index(
+		     node,
+		     io_handle,
+		     record_index,
+		     1,
+		     &node_key,
+		     error ) == -1 )
 		{
-			libcnotify_printf(
-			 "%s: B-tree record: %d\n",
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve catalog B-tree key: %" PRIu16 ".",
 			 function,
 			 record_index );
 
-			libcnotify_printf(
-			 "\n" );
+			goto on_error;
 		}
+		if( node_key == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing catalog B-tree key: %" PRIu16 ".",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		if( node_key->parent_identifier == parent_identifier )
+		{
+			if( node_key->record_data_size < 2 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid catalog B-tree key: %" PRIu16 " - record data size value out of bounds.",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+			byte_stream_copy_to_uint16_big_endian(
+			 node_key->record_data,
+			 record_type );
+
+			compare_result = LIBUNA_COMPARE_LESS;
+
+			switch( record_type )
+			{
+				case LIBFSHFS_RECORD_TYPE_HFSPLUS_DIRECTORY_RECORD:
+				case LIBFSHFS_RECORD_TYPE_HFSPLUS_FILE_RECORD:
+				case LIBFSHFS_RECORD_TYPE_HFS_DIRECTORY_RECORD:
+				case LIBFSHFS_RECORD_TYPE_HFS_FILE_RECORD:
+					if( ( node_key->name_hash == 0 )
+					 || ( node_key->name_hash == name_hash ) )
+					{
+						compare_result = libfshfs_catalog_btree_key_compare_name_with_utf16_string(
+						                  node_key,
+						                  utf16_string,
+						                  utf16_string_length,
+						                  use_case_folding,
+						                  error );
+
+						if( compare_result == -1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_GENERIC,
+							 "%s: unable to compare UTF-16 string with catalog B-tree key name.",
+							 function );
+
+							goto on_error;
+						}
+					}
+					break;
+
+				default:
+					break;
+			}
+			if( compare_result == LIBUNA_COMPARE_EQUAL )
+			{
+				if( node_key->name_hash == 0 )
+				{
+					if( libfshfs_name_calculate_hash(
+					     node_key->name_data,
+					     (size_t) node_key->name_size,
+					     node_key->codepage,
+					     use_case_folding,
+					     &( node_key->name_hash ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GENERIC,
+						 "%s: unable to calculate name hash.",
+						 function );
+
+						goto on_error;
+					}
+				}
+				result = libfshfs_catalog_btree_file_get_directory_entry_from_key(
+				          node,
+				          node_key,
+				          NULL,
+				          directory_entry,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve directory entry from record data.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
+		if( ( result == 1 )
+		 || ( node_key->parent_identifier > parent_identifier ) )
+		{
+			break;
+		}
+	}
+	return( result );
+
+on_error:
+	if( *directory_entry != NULL )
+	{
+		libfshfs_directory_entry_free(
+		 directory_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a directory entry for an UTF-16 encoded name from the catalog B-tree branch node
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libfshfs_catalog_btree_file_get_directory_entry_from_branch_node_by_utf16_name(
+     libfshfs_btree_file_t *btree_file,
+     libfshfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfshfs_btree_node_cache_t *node_cache,
+     libfshfs_btree_node_t *node,
+     uint32_t parent_identifier,
+     uint32_t name_hash,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint8_t use_case_folding,
+     libfshfs_directory_entry_t **directory_entry,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	libfshfs_btree_node_t *sub_node             = NULL;
+	libfshfs_catalog_btree_key_t *last_node_key = NULL;
+	libfshfs_catalog_btree_key_t *node_key      = NULL;
+	static char *function                       = "libfshfs_catalog_btree_file_get_directory_entry_from_branch_node_by_utf16_name";
+	uint32_t sub_node_number                    = 0;
+	uint16_t record_index                       = 0;
+	uint8_t node_type                           = 0;
+	int compare_result                          = 0;
+	int is_branch_node                          = 0;
+	int result                                  = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint16_t last_record_index                  = 0;
 #endif
-		if( record_index < node->descriptor->number_of_records )
+
+	if( btree_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid B-tree file.",
+		 function );
+
+		return( -1 );
+	}
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid B-tree node.",
+		 function );
+
+		return( -1 );
+	}
+	if( node->descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid B-tree node - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > LIBFSHFS_MAXIMUM_BTREE_NODE_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	is_branch_node = libfshfs_btree_node_is_branch_node(
+	                  node,
+	                  error );
+
+	if( is_branch_node == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if B-tree node is a branch node.",
+		 function );
+
+		goto on_error;
+	}
+	else if( is_branch_node == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid node - not a branch node.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfshfs_catalog_btree_file_get_key_from_node_by_index(
+	     node,
+	     io_handle,
+	     0,
+	     0,
+	     &last_node_key,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve catalog B-tree key: 0.",
+		 function );
+
+		goto on_error;
+	}
+	node_key = last_node_key;
+
+	for( record_index = 1;
+	     record_index <= node->descriptor->number_of_records;
+	     record_index++ )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: B-tree record: %d\n",
+			 function,
+			 record_index );
+
+			libcnotify_printf(
+			 "\n" );
+		}
+#endif
+		if( record_index < node->descriptor->number_of_records )
+		{
+			if( libfshfs_catalog_btree_file_get_key_from_node_by_index(
+			     node,
+			     io_handle,
+			     record_index,
+			     0,
+			     &node_key,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve catalog B-tree key: %" PRIu16 ".",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+			if( node_key == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing catalog B-tree key: %" PRIu16 ".",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+		}
+		compare_result = LIBUNA_COMPARE_LESS;
+
+		if( ( record_index == node->descriptor->number_of_records )
+		 || ( node_key->parent_identifier > parent_identifier ) )
+		{
+			compare_result = LIBUNA_COMPARE_GREATER;
+		}
+		else if( node_key->parent_identifier == parent_identifier )
+		{
+			if( node_key->name_data != NULL )
+			{
+				compare_result = libfshfs_catalog_btree_key_compare_name_with_utf16_string(
+				                  node_key,
+				                  utf16_string,
+				                  utf16_string_length,
+				                  use_case_folding,
+				                  error );
+
+				if( compare_result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to compare UTF-16 string with catalog B-tree key name.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
+		if( compare_result == LIBUNA_COMPARE_GREATER )
+		{
+			if( libfshfs_catalog_btree_file_get_sub_node_number_from_key(
+			     last_node_key,
+			     &sub_node_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub node number from catalog B-Tree key.",
+				 function );
+
+				goto on_error;
+			}
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: B-tree record: %d sub node number: %" PRIu32 "\n",
+				 function,
+				 last_record_index,
+				 sub_node_number );
+
+				libcnotify_printf(
+				 "\n" );
+			}
+#endif
+			if( libfshfs_btree_file_get_node_by_number(
+			     btree_file,
+			     file_io_handle,
+			     node_cache,
+			     recursion_depth,
+			     sub_node_number,
+			     &sub_node,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve B-tree sub node: %" PRIu32 ".",
+				 function,
+				 sub_node_number );
+
+				goto on_error;
+			}
+			if( libfshfs_btree_node_get_node_type(
+			     sub_node,
+			     &node_type,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine if B-tree sub node: %" PRIu32 " type.",
+				 function,
+				 sub_node_number );
+
+				goto on_error;
+			}
+			if( node_type == LIBFSHFS_BTREE_NODE_TYPE_INDEX_NODE )
+			{
+				result = libfshfs_catalog_btree_file_get_directory_entry_from_branch_node_by_utf16_name(
+				          btree_file,
+				          io_handle,
+				          file_io_handle,
+				          node_cache,
+				          sub_node,
+				          parent_identifier,
+				          name_hash,
+				          utf16_string,
+				          utf16_string_length,
+				          use_case_folding,
+				          directory_entry,
+				          recursion_depth + 1,
+				          error );
+			}
+			else if( node_type == LIBFSHFS_BTREE_NODE_TYPE_LEAF_NODE )
+			{
+				result = libfshfs_catalog_btree_file_get_directory_entry_from_leaf_node_by_utf16_name(
+				          btree_file,
+				          io_handle,
+				          sub_node,
+				          parent_identifier,
+				          name_hash,
+				          utf16_string,
+				          utf16_string_length,
+				          use_case_folding,
+				          directory_entry,
+				          error );
+			}
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve directory entry from catalog B-tree node: %" PRIu32 ".",
+				 function,
+				 sub_node_number );
+
+				goto on_error;
+			}
+			if( ( result == 1 )
+			 || ( node_key->parent_identifier > parent_identifier ) )
+			{
+				break;
+			}
+		}
+		last_node_key = node_key;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		last_record_index++;
+#endif
+	}
+	return( result );
+
+on_error:
+	if( *directory_entry != NULL )
+	{
+		libfshfs_directory_entry_free(
+		 directory_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a directory entry for an UTF-16 encoded name from the catalog B-tree file
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libfshfs_catalog_btree_file_get_directory_entry_by_utf16_name(
+     libfshfs_btree_file_t *btree_file,
+     libfshfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfshfs_btree_node_cache_t *node_cache,
+     uint32_t parent_identifier,
+     uint32_t name_hash,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint8_t use_case_folding,
+     libfshfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error )
+{
+	libfshfs_btree_node_t *root_node = NULL;
+	static char *function            = "libfshfs_catalog_btree_file_get_directory_entry_by_utf16_name";
+	uint8_t node_type                = 0;
+	int result                       = 0;
+
+	if( libfshfs_btree_file_get_root_node(
+	     btree_file,
+	     file_io_handle,
+	     node_cache,
+	     &root_node,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve B-tree root node.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfshfs_btree_node_get_node_type(
+	     root_node,
+	     &node_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if B-tree root node type.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_type == LIBFSHFS_BTREE_NODE_TYPE_INDEX_NODE )
+	{
+		result = libfshfs_catalog_btree_file_get_directory_entry_from_branch_node_by_utf16_name(
+		          btree_file,
+		          io_handle,
+		          file_io_handle,
+		          node_cache,
+		          root_node,
+		          parent_identifier,
+		          name_hash,
+		          utf16_string,
+		          utf16_string_length,
+		          use_case_folding,
+		          directory_entry,
+		          1,
+		          error );
+	}
+	else if( node_type == LIBFSHFS_BTREE_NODE_TYPE_LEAF_NODE )
+	{
+		result = libfshfs_catalog_btree_file_get_directory_entry_from_leaf_node_by_utf16_name(
+		          btree_file,
+		          io_handle,
+		          root_node,
+		          parent_identifier,
+		          name_hash,
+		          utf16_string,
+		          utf16_string_length,
+		          use_case_folding,
+		          directory_entry,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entry from catalog B-tree root node.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves a directory entry for an UTF-16 encoded path from the catalog B-tree file
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libfshfs_catalog_btree_file_get_directory_entry_by_utf16_path(
+     libfshfs_btree_file_t *btree_file,
+     libfshfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfshfs_btree_node_cache_t *node_cache,
+     libfshfs_path_cache_t *path_cache,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint8_t use_case_folding,
+     libfshfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error )
+{
+	libfshfs_btree_node_t *root_node                 = NULL;
+	libfshfs_directory_entry_t *safe_directory_entry = NULL;
+	const uint16_t *utf16_string_segment             = NULL;
+	static char *function                            = "libfshfs_catalog_btree_file_get_directory_entry_by_utf16_path";
+	libuna_unicode_character_t unicode_character     = 0;
+	size_t utf16_string_index                        = 0;
+	size_t utf16_string_segment_length               = 0;
+	uint32_t entry_identifier                        = 0;
+	uint32_t lookup_identifier                       = 0;
+	uint32_t segment_name_hash                       = 0;
+	uint8_t node_type                                = 0;
+	int cache_result                                 = 0;
+	int result                                       = 0;
+
+	if( btree_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid B-tree file.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfshfs_btree_file_get_root_node(
+	     btree_file,
+	     file_io_handle,
+	     node_cache,
+	     &root_node,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve B-tree root node.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfshfs_btree_node_get_node_type(
+	     root_node,
+	     &node_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if B-tree root node type.",
+		 function );
+
+		goto on_error;
+	}
+	lookup_identifier = LIBFSHFS_ROOT_DIRECTORY_IDENTIFIER;
+
+	if( utf16_string_length > 0 )
+	{
+		/* Ignore a leading separator
+		 */
+		if( utf16_string[ utf16_string_index ] == (uint16_t) LIBFSHFS_SEPARATOR )
+		{
+			utf16_string_index++;
+		}
+	}
+	if( ( utf16_string_length == 0 )
+	 || ( utf16_string_length == 1 ) )
+	{
+		result = libfshfs_catalog_btree_file_get_directory_entry_by_identifier(
+		          btree_file,
+		          io_handle,
+		          file_io_handle,
+		          node_cache,
+		          LIBFSHFS_ROOT_DIRECTORY_IDENTIFIER,
+		          use_case_folding,
+		          &safe_directory_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve root directory entry from catalog B-tree file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else while( utf16_string_index < utf16_string_length )
+	{
+		utf16_string_segment        = &( utf16_string[ utf16_string_index ] );
+		utf16_string_segment_length = utf16_string_index;
+
+		while( utf16_string_index < utf16_string_length )
+		{
+			if( libuna_unicode_character_copy_from_utf16(
+			     &unicode_character,
+			     utf16_string,
+			     utf16_string_length,
+			     &utf16_string_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy UTF-16 string to Unicode character.",
+				 function );
+
+				goto on_error;
+			}
+			if( ( unicode_character == (libuna_unicode_character_t) LIBFSHFS_SEPARATOR )
+			 || ( unicode_character == 0 ) )
+			{
+				utf16_string_segment_length += 1;
+
+				break;
+			}
+		}
+		utf16_string_segment_length = utf16_string_index - utf16_string_segment_length;
+
+		if( utf16_string_segment_length == 0 )
+		{
+			result = 0;
+		}
+		else
+		{
+			if( safe_directory_entry != NULL )
+			{
+				if( libfshfs_directory_entry_free(
+				     &safe_directory_entry,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free directory entry.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( libfshfs_name_calculate_hash_utf16_string(
+			     utf16_string_segment,
+			     utf16_string_segment_length,
+			     use_case_folding,
+			     &segment_name_hash,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to calculate name hash.",
+				 function );
+
+				goto on_error;
+			}
+			cache_result = 0;
+
+			if( path_cache != NULL )
+			{
+				cache_result = libfshfs_path_cache_get_identifier(
+				                path_cache,
+				                lookup_identifier,
+				                segment_name_hash,
+				                LIBFSHFS_PATH_CACHE_NAME_TYPE_UTF16,
+				                (const uint8_t *) utf16_string_segment,
+				                sizeof( uint16_t ) * utf16_string_segment_length,
+				                &entry_identifier,
+				                error );
+
+				if( cache_result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve identifier from path cache.",
+					 function );
+
+					goto on_error;
+				}
+				else if( cache_result != 0 )
+				{
+					/* The directory entry is retrieved by identifier after the last segment
+					 */
+					result = 0;
+
+					if( entry_identifier != 0 )
+					{
+						result = 1;
+					}
+				}
+			}
+			if( cache_result == 0 )
+			{
+				if( node_type == LIBFSHFS_BTREE_NODE_TYPE_INDEX_NODE )
+				{
+					result = libfshfs_catalog_btree_file_get_directory_entry_from_branch_node_by_utf16_name(
+						  btree_file,
+						  io_handle,
+						  file_io_handle,
+						  node_cache,
+						  root_node,
+						  lookup_identifier,
+						  segment_name_hash,
+						  utf16_string_segment,
+						  utf16_string_segment_length,
+						  use_case_folding,
+						  &safe_directory_entry,
+						  1,
+						  error );
+				}
+				else if( node_type == LIBFSHFS_BTREE_NODE_TYPE_LEAF_NODE )
+				{
+					result = libfshfs_catalog_btree_file_get_directory_entry_from_leaf_node_by_utf16_name(
+						  btree_file,
+						  io_handle,
+						  root_node,
+						  lookup_identifier,
+						  segment_name_hash,
+						  utf16_string_segment,
+						  utf16_string_segment_length,
+						  use_case_folding,
+						  &safe_directory_entry,
+						  error );
+				}
+				entry_identifier = 0;
+
+				if( result == 1 )
+				{
+					if( libfshfs_directory_entry_get_identifier(
+					     safe_directory_entry,
+					     &entry_identifier,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve directory entry identifier.",
+						 function );
+
+						goto on_error;
+					}
+				}
+				if( ( result != -1 )
+				 && ( path_cache != NULL ) )
+				{
+					if( libfshfs_path_cache_set_identifier(
+					     path_cache,
+					     lookup_identifier,
+					     segment_name_hash,
+					     LIBFSHFS_PATH_CACHE_NAME_TYPE_UTF16,
+					     (const uint8_t *) utf16_string_segment,
+					     sizeof( uint16_t ) * utf16_string_segment_length,
+					     entry_identifier,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+						 "%s: unable to set identifier in path cache.",
+						 function );
+
+						goto on_error;
+					}
+				}
+			}
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry by name.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		lookup_identifier = entry_identifier;
+	}
+	if( ( result == 1 )
+	 && ( safe_directory_entry == NULL ) )
+	{
+		/* The last segment was found in the path cache
+		 */
+		result = libfshfs_catalog_btree_file_get_directory_entry_by_identifier(
+		          btree_file,
+		          io_handle,
+		          file_io_handle,
+		          node_cache,
+		          lookup_identifier,
+		          use_case_folding,
+		          &safe_directory_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry: %" PRIu32 " from catalog B-tree file.",
+			 function,
+			 lookup_identifier );
+
+			goto on_error;
+		}
+	}
+	if( result != 0 )
+	{
+		*directory_entry = safe_directory_entry;
+	}
+	return( result );
+
+on_error:
+	if( *directory_entry != NULL )
+	{
+		libfshfs_directory_entry_free(
+		 directory_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves directory entries for a specific parent identifier from the catalog B-tree leaf node
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_catalog_btree_file_get_directory_entries_from_leaf_node(
+     libfshfs_btree_file_t *btree_file,
+     libfshfs_io_handle_t *io_handle,
+     libfshfs_btree_node_t *node,
+     uint32_t parent_identifier,
+     libfshfs_memory_arena_t *memory_arena,
+     libcdata_array_t *directory_entries,
+     libcerror_error_t **error )
+{
+	libfshfs_catalog_btree_key_t node_key;
+
+	libfshfs_directory_entry_t *directory_entry = NULL;
+	static char *function                       = "libfshfs_catalog_btree_file_get_directory_entries_from_leaf_node";
+	uint16_t record_index                       = 0;
+	int entry_index                             = 0;
+	int is_leaf_node                            = 0;
+	int result                                  = 0;
+
+	if( btree_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid B-tree file.",
+		 function );
+
+		return( -1 );
+	}
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid B-tree node.",
+		 function );
+
+		return( -1 );
+	}
+	if( node->descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid B-tree node - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	is_leaf_node = libfshfs_btree_node_is_leaf_node(
+	                node,
+	                error );
+
+	if( is_leaf_node == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if B-tree node is a leaf node.",
+		 function );
+
+		goto on_error;
+	}
+	else if( is_leaf_node == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid node - not a leaf node.",
+		 function );
+
+		goto on_error;
+	}
+	for( record_index = 0;
+	     record_index < node->descriptor->number_of_records;
+	     record_index++ )
+	{
+		if( libfshfs_catalog_btree_file_get_key_view_from_node_by_index(
+		     node,
+		     io_handle,
+		     record_index,
+		     1,
+		     &node_key,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve catalog B-tree key: %" PRIu16 ".",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		if( node_key.parent_identifier == parent_identifier )
+		{
+			result = libfshfs_catalog_btree_file_get_directory_entry_from_key(
+			          node,
+			          &node_key,
+			          memory_arena,
+			          &directory_entry,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve directory entry from record data.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				if( libcdata_array_append_entry(
+				     directory_entries,
+				     &entry_index,
+				     (intptr_t *) directory_entry,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append directory entry to array.",
+					 function );
+
+					goto on_error;
+				}
+				directory_entry = NULL;
+			}
+		}
+		if( node_key.parent_identifier > parent_identifier )
+		{
+			break;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( directory_entry != NULL )
+	{
+		libfshfs_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	libcdata_array_empty(
+	 directory_entries,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libfshfs_directory_entry_free,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Retrieves directory entries for a specific parent identifier from the catalog B-tree branch node
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_catalog_btree_file_get_directory_entries_from_branch_node(
+     libfshfs_btree_file_t *btree_file,
+     libfshfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfshfs_btree_node_cache_t *node_cache,
+     libfshfs_btree_node_t *node,
+     uint32_t parent_identifier,
+     libfshfs_memory_arena_t *memory_arena,
+     libcdata_array_t *directory_entries,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	libfshfs_btree_node_t *sub_node             = NULL;
+	libfshfs_catalog_btree_key_t *last_node_key = NULL;
+	libfshfs_catalog_btree_key_t *node_key      = NULL;
+	static char *function                       = "libfshfs_catalog_btree_file_get_directory_entries_from_branch_node";
+	uint32_t sub_node_number                    = 0;
+	uint16_t record_index                       = 0;
+	uint8_t node_type                           = 0;
+	int is_branch_node                          = 0;
+	int result                                  = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint16_t last_record_index                  = 0;
+#endif
+
+	if( btree_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid B-tree file.",
+		 function );
+
+		return( -1 );
+	}
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid B-tree node.",
+		 function );
+
+		return( -1 );
+	}
+	if( node->descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid B-tree node - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > LIBFSHFS_MAXIMUM_BTREE_NODE_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	is_branch_node = libfshfs_btree_node_is_branch_node(
+	                  node,
+	                  error );
+
+	if( is_branch_node == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if B-tree node is a branch node.",
+		 function );
+
+		goto on_error;
+	}
+	else if( is_branch_node == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid node - not a branch node.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfshfs_catalog_btree_file_get_key_from_node_by_index(
+	     node,
+	     io_handle,
+	     0,
+	     0,
+	     &last_node_key,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve catalog B-tree key: 0.",
+		 function );
+
+		goto on_error;
+	}
+	node_key = last_node_key;
+
+	for( record_index = 1;
+	     record_index <= node->descriptor->number_of_records;
+	     record_index++ )
+	{
+		if( record_index < node->descriptor->number_of_records )
+		{
+			if( libfshfs_catalog_btree_file_get_key_from_node_by_index(
+			     node,
+			     io_handle,
+			     record_index,
+			     0,
+			     &node_key,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve catalog B-tree key: %" PRIu16 ".",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+			if( node_key == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing catalog B-tree key: %" PRIu16 ".",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+		}
+		if( ( record_index == node->descriptor->number_of_records )
+		 || ( node_key->parent_identifier >= parent_identifier ) )
+		{
+			if( libfshfs_catalog_btree_file_get_sub_node_number_from_key(
+			     last_node_key,
+			     &sub_node_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub node number from catalog B-Tree key.",
+				 function );
+
+				goto on_error;
+			}
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: B-tree record: %d sub node number: %" PRIu32 "\n",
+				 function,
+				 last_record_index,
+				 sub_node_number );
+
+				libcnotify_printf(
+				 "\n" );
+			}
+#endif
+			if( libfshfs_btree_file_get_node_by_number(
+			     btree_file,
+			     file_io_handle,
+			     node_cache,
+			     recursion_depth,
+			     sub_node_number,
+			     &sub_node,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve B-tree sub node: %" PRIu32 ".",
+				 function,
+				 sub_node_number );
+
+				goto on_error;
+			}
+			if( libfshfs_btree_node_get_node_type(
+			     sub_node,
+			     &node_type,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine if B-tree sub node: %" PRIu32 " type.",
+				 function,
+				 sub_node_number );
+
+				goto on_error;
+			}
+			if( node_type == LIBFSHFS_BTREE_NODE_TYPE_INDEX_NODE )
+			{
+				result = libfshfs_catalog_btree_file_get_directory_entries_from_branch_node(
+				          btree_file,
+				          io_handle,
+				          file_io_handle,
+				          node_cache,
+				          sub_node,
+				          parent_identifier,
+				          memory_arena,
+				          directory_entries,
+				          recursion_depth + 1,
+				          error );
+			}
+			else if( node_type == LIBFSHFS_BTREE_NODE_TYPE_LEAF_NODE )
+			{
+				result = libfshfs_catalog_btree_file_get_directory_entries_from_leaf_node(
+				          btree_file,
+				          io_handle,
+				          sub_node,
+				          parent_identifier,
+				          memory_arena,
+				          directory_entries,
+				          error );
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve directory entries from catalog B-tree node: %" PRIu32 ".",
+				 function,
+				 sub_node_number );
+
+				goto on_error;
+			}
+			if( node_key->parent_identifier > parent_identifier )
+			{
+				break;
+			}
+		}
+		last_node_key = node_key;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		last_record_index++;
+#endif
+	}
+	return( 1 );
+
+on_error:
+	libcdata_array_empty(
+	 directory_entries,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libfshfs_directory_entry_free,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Retrieves directory entries for a specific parent identifier from the catalog B-tree file
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_catalog_btree_file_get_directory_entries(
+     libfshfs_btree_file_t *btree_file,
+     libfshfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfshfs_btree_node_cache_t *node_cache,
+     uint32_t parent_identifier,
+     libfshfs_memory_arena_t *memory_arena,
+     libcdata_array_t *directory_entries,
+     libcerror_error_t **error )
+{
+	libfshfs_btree_node_t *root_node = NULL;
+	static char *function            = "libfshfs_catalog_btree_file_get_directory_entries";
+	uint8_t node_type                = 0;
+	int result                       = 1;
+
+	if( libfshfs_btree_file_get_root_node(
+	     btree_file,
+	     file_io_handle,
+	     node_cache,
+	     &root_node,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve B-tree root node.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfshfs_btree_node_get_node_type(
+	     root_node,
+	     &node_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if B-tree root node is a branch node.",
+		 function );
+
+		goto on_error;
+	}
+	if( node_type == LIBFSHFS_BTREE_NODE_TYPE_INDEX_NODE )
+	{
+		result = libfshfs_catalog_btree_file_get_directory_entries_from_branch_node(
+		          btree_file,
+		          io_handle,
+		          file_io_handle,
+		          node_cache,
+		          root_node,
+		          parent_identifier,
+		          memory_arena,
+		          directory_entries,
+		          1,
+		          error );
+	}
+	else if( node_type == LIBFSHFS_BTREE_NODE_TYPE_LEAF_NODE )
+	{
+		result = libfshfs_catalog_btree_file_get_directory_entries_from_leaf_node(
+		          btree_file,
+		          io_handle,
+		          root_node,
+		          parent_identifier,
+		          memory_arena,
+		          directory_entries,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entries from catalog B-tree root node.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libcdata_array_empty(
+	 directory_entries,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libfshfs_directory_entry_free,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Reads the next page of directory entries for a specific parent identifier
+ * The leaf nodes are read sequentially from the cursor of the page until the page
+ * is filled or a record of a higher parent identifier is found
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_catalog_btree_file_read_directory_entries_page(
+     libfshfs_btree_file_t *btree_file,
+     libfshfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfshfs_btree_node_cache_t *node_cache,
+     uint32_t parent_identifier,
+     libfshfs_directory_entries_page_t *directory_entries_page,
+     libcerror_error_t **error )
+{
+	libfshfs_catalog_btree_key_t node_key;
+
+	libfshfs_btree_node_t *node                 = NULL;
+	libfshfs_directory_entry_t *directory_entry = NULL;
+	static char *function                       = "libfshfs_catalog_btree_file_read_directory_entries_page";
+	uint32_t node_number                        = 0;
+	uint32_t number_of_leaf_nodes               = 0;
+	uint16_t record_index                       = 0;
+	int entry_index                             = 0;
+	int number_of_entries                       = 0;
+	int result                                  = 0;
+
+	if( btree_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid B-tree file.",
+		 function );
+
+		return( -1 );
+	}
+	if( btree_file->node_vector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid B-tree file - missing node vector.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entries_page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entries page.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entries_page->is_last_page != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory entries page - already last page.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfshfs_directory_entries_page_empty(
+	     directory_entries_page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty directory entries page.",
+		 function );
+
+		return( -1 );
+	}
+	node_number  = directory_entries_page->next_node_number;
+	record_index = directory_entries_page->next_record_index;
+
+	if( node_number == 0 )
+	{
+		if( libfshfs_catalog_btree_file_get_first_leaf_node_number(
+		     btree_file,
+		     io_handle,
+		     file_io_handle,
+		     node_cache,
+		     parent_identifier,
+		     &node_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve first leaf node number.",
+			 function );
+
+			return( -1 );
+		}
+		record_index = 0;
+	}
+	while( node_number != 0 )
+	{
+		/* Protect against a loop in the leaf node chain
+		 */
+		if( number_of_leaf_nodes >= btree_file->node_vector->number_of_nodes )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of leaf nodes value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_leaf_nodes++;
+
+		if( libfshfs_btree_file_get_leaf_node_by_number(
+		     btree_file,
+		     file_io_handle,
+		     node_cache,
+		     node_number,
+		     &node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve B-tree leaf node: %" PRIu32 ".",
+			 function,
+			 node_number );
+
+			return( -1 );
+		}
+		while( record_index < node->descriptor->number_of_records )
+		{
+			if( number_of_entries >= directory_entries_page->maximum_number_of_entries )
+			{
+				directory_entries_page->next_node_number  = node_number;
+				directory_entries_page->next_record_index = record_index;
+
+				return( 1 );
+			}
+			if( libfshfs_catalog_btree_file_get_key_view_from_node_by_index(
+			     node,
+			     io_handle,
+			     record_index,
+			     1,
+			     &node_key,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve catalog B-tree key: %" PRIu16 " from node: %" PRIu32 ".",
+				 function,
+				 record_index,
+				 node_number );
+
+				return( -1 );
+			}
+			if( node_key.parent_identifier > parent_identifier )
+			{
+				directory_entries_page->is_last_page = 1;
+
+				return( 1 );
+			}
+			record_index++;
+
+			if( node_key.parent_identifier < parent_identifier )
+			{
+				continue;
+			}
+			result = libfshfs_catalog_btree_file_get_directory_entry_from_key(
+			          node,
+			          &node_key,
+			          NULL,
+			          &directory_entry,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve directory entry from catalog B-tree key.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				continue;
+			}
+			if( libcdata_array_append_entry(
+			     directory_entries_page->directory_entries,
+			     &entry_index,
+			     (intptr_t *) directory_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append directory entry to page.",
+				 function );
+
+				goto on_error;
+			}
+			directory_entry = NULL;
+
+			number_of_entries++;
+		}
+		node_number  = node->descriptor->next_node_number;
+		record_index = 0;
+	}
+	directory_entries_page->is_last_page = 1;
+
+	return( 1 );
+
+on_error:
+	if( directory_entry != NULL )
+	{
+		libfshfs_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the stat values from the catalog B-tree key
+ * Hard links are not resolved, the stat values contain the values of the record
+ * and the link reference contains the CNID of the indirect node file or 0 if not set
+ * Returns 1 if successful, 0 if not a directory or file record or -1 on error
+ */
+int libfshfs_catalog_btree_file_get_stat_from_key(
+     libfshfs_catalog_btree_key_t *node_key,
+     libfshfs_file_entry_stat_t *stat_value,
+     uint32_t *link_reference,
+     libcerror_error_t **error )
+{
+	fshfs_catalog_directory_record_hfs_t *directory_record_hfs         = NULL;
+	fshfs_catalog_directory_record_hfsplus_t *directory_record_hfsplus = NULL;
+	fshfs_catalog_file_record_hfs_t *file_record_hfs                   = NULL;
+	fshfs_catalog_file_record_hfsplus_t *file_record_hfsplus           = NULL;
+	static char *function                                              = "libfshfs_catalog_btree_file_get_stat_from_key";
+	size_t record_size                                                 = 0;
+	uint32_t number_of_blocks                                          = 0;
+	uint16_t flags                                                     = 0;
+	uint16_t record_type                                               = 0;
+
+	if( node_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog B-tree key.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_key->record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid catalog B-tree key - missing record data.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_key->record_data_size < 2 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid catalog B-tree key - record data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( stat_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stat value.",
+		 function );
+
+		return( -1 );
+	}
+	if( link_reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid link reference.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_big_endian(
+	 node_key->record_data,
+	 record_type );
+
+	if( record_type == LIBFSHFS_RECORD_TYPE_HFSPLUS_DIRECTORY_RECORD )
+	{
+		record_size = sizeof( fshfs_catalog_directory_record_hfsplus_t );
+	}
+	else if( record_type == LIBFSHFS_RECORD_TYPE_HFS_DIRECTORY_RECORD )
+	{
+		record_size = sizeof( fshfs_catalog_directory_record_hfs_t );
+	}
+	else if( record_type == LIBFSHFS_RECORD_TYPE_HFSPLUS_FILE_RECORD )
+	{
+		record_size = sizeof( fshfs_catalog_file_record_hfsplus_t );
+	}
+	else if( record_type == LIBFSHFS_RECORD_TYPE_HFS_FILE_RECORD )
+	{
+		record_size = sizeof( fshfs_catalog_file_record_hfs_t );
+	}
+	else
+	{
+		return( 0 );
+	}
+	if( node_key->record_data_size < record_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid catalog B-tree key - record data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     stat_value,
+	     0,
+	     sizeof( libfshfs_file_entry_stat_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear stat value.",
+		 function );
+
+		return( -1 );
+	}
+	stat_value->number_of_links = 1;
+
+	*link_reference = 0;
+
+	/* The stat values are decoded directly from the record data in the node
+	 * to prevent a directory or file record being allocated per record
+	 */
+	if( record_type == LIBFSHFS_RECORD_TYPE_HFSPLUS_DIRECTORY_RECORD )
+	{
+		directory_record_hfsplus = (fshfs_catalog_directory_record_hfsplus_t *) node_key->record_data;
+
+		byte_stream_copy_to_uint32_big_endian(
+		 directory_record_hfsplus->identifier,
+		 stat_value->identifier );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 directory_record_hfsplus->creation_time,
+		 stat_value->creation_time );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 directory_record_hfsplus->modification_time,
+		 stat_value->modification_time );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 directory_record_hfsplus->entry_modification_time,
+		 stat_value->entry_modification_time );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 directory_record_hfsplus->access_time,
+		 stat_value->access_time );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 directory_record_hfsplus->owner_identifier,
+		 stat_value->owner_identifier );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 directory_record_hfsplus->group_identifier,
+		 stat_value->group_identifier );
+
+		byte_stream_copy_to_uint16_big_endian(
+		 directory_record_hfsplus->file_mode,
+		 stat_value->file_mode );
+	}
+	else if( record_type == LIBFSHFS_RECORD_TYPE_HFS_DIRECTORY_RECORD )
+	{
+		directory_record_hfs = (fshfs_catalog_directory_record_hfs_t *) node_key->record_data;
+
+		byte_stream_copy_to_uint32_big_endian(
+		 directory_record_hfs->identifier,
+		 stat_value->identifier );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 directory_record_hfs->creation_time,
+		 stat_value->creation_time );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 directory_record_hfs->modification_time,
+		 stat_value->modification_time );
+
+		/* Traditional HFS does not have a file mode so we derive it from the record type
+		 */
+		stat_value->file_mode = LIBFSHFS_FILE_TYPE_DIRECTORY;
+	}
+	else if( record_type == LIBFSHFS_RECORD_TYPE_HFSPLUS_FILE_RECORD )
+	{
+		file_record_hfsplus = (fshfs_catalog_file_record_hfsplus_t *) node_key->record_data;
+
+		byte_stream_copy_to_uint16_big_endian(
+		 file_record_hfsplus->flags,
+		 flags );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 file_record_hfsplus->identifier,
+		 stat_value->identifier );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 file_record_hfsplus->creation_time,
+		 stat_value->creation_time );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 file_record_hfsplus->modification_time,
+		 stat_value->modification_time );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 file_record_hfsplus->entry_modification_time,
+		 stat_value->entry_modification_time );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 file_record_hfsplus->access_time,
+		 stat_value->access_time );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 file_record_hfsplus->owner_identifier,
+		 stat_value->owner_identifier );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 file_record_hfsplus->group_identifier,
+		 stat_value->group_identifier );
+
+		byte_stream_copy_to_uint16_big_endian(
+		 file_record_hfsplus->file_mode,
+		 stat_value->file_mode );
+
+		byte_stream_copy_to_uint64_big_endian(
+		 ( (fshfs_fork_descriptor_t *) file_record_hfsplus->data_fork_descriptor )->logical_size,
+		 stat_value->data_fork_size );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 ( (fshfs_fork_descriptor_t *) file_record_hfsplus->resource_fork_descriptor )->number_of_blocks,
+		 number_of_blocks );
+
+		if( number_of_blocks != 0 )
 		{
-			if( libfshfs_catalog_btree_file_get_key_from_node_by_index(
+			byte_stream_copy_to_uint64_big_endian(
+			 ( (fshfs_fork_descriptor_t *) file_record_hfsplus->resource_fork_descriptor )->logical_size,
+			 stat_value->resource_fork_size );
+		}
+		if( ( ( flags & 0x0020 ) != 0 )
+		 && ( memory_compare(
+		       file_record_hfsplus->file_information,
+		       "hlnkhfs+",
+		       8 ) == 0 ) )
+		{
+			byte_stream_copy_to_uint32_big_endian(
+			 file_record_hfsplus->special_permissions,
+			 *link_reference );
+		}
+	}
+	else
+	{
+		file_record_hfs = (fshfs_catalog_file_record_hfs_t *) node_key->record_data;
+
+		byte_stream_copy_to_uint32_big_endian(
+		 file_record_hfs->identifier,
+		 stat_value->identifier );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 file_record_hfs->data_fork_size,
+		 stat_value->data_fork_size );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 file_record_hfs->resource_fork_size,
+		 stat_value->resource_fork_size );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 file_record_hfs->creation_time,
+		 stat_value->creation_time );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 file_record_hfs->modification_time,
+		 stat_value->modification_time );
+
+		/* Traditional HFS does not have a file mode so we derive it from the record type
+		 */
+		stat_value->file_mode = LIBFSHFS_FILE_TYPE_REGULAR_FILE;
+	}
+	return( 1 );
+}
+
+/* Iterates over the directory and file records in the catalog B-tree file
+ * The leaf nodes are read sequentially by following their next node numbers
+ * The callback function is called with the parent identifier, the name data
+ * and the stat values of every directory and file record
+ * and should return 1 to continue, 0 to stop or -1 on error
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_catalog_btree_file_iterate_records(
+     libfshfs_btree_file_t *btree_file,
+     libfshfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfshfs_btree_node_cache_t *node_cache,
+     int (*callback_function)(
+            uint32_t parent_identifier,
+            const uint8_t *name_data,
+            size_t name_size,
+            const libfshfs_file_entry_stat_t *stat_value,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libfshfs_btree_node_t *node            = NULL;
+	libfshfs_catalog_btree_key_t node_key;
+	libfshfs_file_entry_stat_t stat_value;
+
+	static char *function                  = "libfshfs_catalog_btree_file_iterate_records";
+	uint32_t link_reference                = 0;
+	uint32_t node_number                   = 0;
+	uint32_t number_of_leaf_nodes          = 0;
+	uint16_t record_index                  = 0;
+	int result                             = 0;
+
+	if( btree_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid B-tree file.",
+		 function );
+
+		return( -1 );
+	}
+	if( btree_file->header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid B-tree file - missing header.",
+		 function );
+
+		return( -1 );
+	}
+	if( btree_file->node_vector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid B-tree file - missing node vector.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+	node_number = btree_file->header->first_leaf_node_number;
+
+	while( node_number != 0 )
+	{
+		if( io_handle->abort != 0 )
+		{
+			break;
+		}
+		/* Protect against a loop in the leaf node chain
+		 */
+		if( number_of_leaf_nodes >= btree_file->node_vector->number_of_nodes )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of leaf nodes value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_leaf_nodes++;
+
+		if( libfshfs_btree_file_get_leaf_node_by_number(
+		     btree_file,
+		     file_io_handle,
+		     node_cache,
+		     node_number,
+		     &node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve B-tree leaf node: %" PRIu32 ".",
+			 function,
+			 node_number );
+
+			return( -1 );
+		}
+		for( record_index = 0;
+		     record_index < node->descriptor->number_of_records;
+		     record_index++ )
+		{
+			if( libfshfs_catalog_btree_file_get_key_view_from_node_by_index(
 			     node,
 			     io_handle,
 			     record_index,
-			     0,
+			     1,
 			     &node_key,
 			     error ) == -1 )
 			{
@@ -3216,307 +5930,468 @@ int libfshfs_catalog_btree_file_get_directory_entry_from_branch_node_by_utf16_na
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve catalog B-tree key: %" PRIu16 ".",
+				 "%s: unable to retrieve catalog B-tree key: %" PRIu16 " from node: %" PRIu32 ".",
 				 function,
-				 record_index );
+				 record_index,
+				 node_number );
 
-				goto on_error;
+				return( -1 );
 			}
-			if( node_key == NULL )
+			result = libfshfs_catalog_btree_file_get_stat_from_key(
+			          &node_key,
+			          &stat_value,
+			          &link_reference,
+			          error );
+
+			if( result == -1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing catalog B-tree key: %" PRIu16 ".",
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve stat values from catalog B-tree key: %" PRIu16 " in node: %" PRIu32 ".",
 				 function,
-				 record_index );
+				 record_index,
+				 node_number );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				continue;
+			}
+			result = callback_function(
+			          node_key.parent_identifier,
+			          node_key.name_data,
+			          (size_t) node_key.name_size,
+			          &stat_value,
+			          callback_data,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: callback function failed for record: %" PRIu32 ".",
+				 function,
+				 stat_value.identifier );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				return( 1 );
+			}
+		}
+		node_number = node->descriptor->next_node_number;
+	}
+	return( 1 );
+}
+
+/* Iterates over the directory and file records of a specific parent identifier
+ * The leaf nodes are read sequentially from the first leaf node that can contain
+ * the records of the parent identifier until a record of a higher parent identifier is found
+ * The callback function is called with the catalog B-tree key, the stat values and
+ * the link reference of every directory and file record of the parent
+ * and should return 1 to continue, 0 to stop or -1 on error
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_catalog_btree_file_iterate_sub_records(
+     libfshfs_btree_file_t *btree_file,
+     libfshfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfshfs_btree_node_cache_t *node_cache,
+     uint32_t parent_identifier,
+     int (*callback_function)(
+            libfshfs_catalog_btree_key_t *node_key,
+            const libfshfs_file_entry_stat_t *stat_value,
+            uint32_t link_reference,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libfshfs_btree_node_t *node            = NULL;
+	libfshfs_catalog_btree_key_t node_key;
+	libfshfs_file_entry_stat_t stat_value;
+
+	static char *function                  = "libfshfs_catalog_btree_file_iterate_sub_records";
+	uint32_t link_reference                = 0;
+	uint32_t node_number                   = 0;
+	uint32_t number_of_leaf_nodes          = 0;
+	uint16_t record_index                  = 0;
+	int result                             = 0;
+
+	if( btree_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid B-tree file.",
+		 function );
+
+		return( -1 );
+	}
+	if( btree_file->node_vector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid B-tree file - missing node vector.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfshfs_catalog_btree_file_get_first_leaf_node_number(
+	     btree_file,
+	     io_handle,
+	     file_io_handle,
+	     node_cache,
+	     parent_identifier,
+	     &node_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first leaf node number.",
+		 function );
+
+		return( -1 );
+	}
+	while( node_number != 0 )
+	{
+		/* Protect against a loop in the leaf node chain
+		 */
+		if( number_of_leaf_nodes >= btree_file->node_vector->number_of_nodes )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of leaf nodes value out of bounds.",
+			 function );
 
-				goto on_error;
-			}
+			return( -1 );
 		}
-		compare_result = LIBUNA_COMPARE_LESS;
+		number_of_leaf_nodes++;
 
-		if( ( record_index == node->descriptor->number_of_records )
-		 || ( node_key->parent_identifier > parent_identifier ) )
-		{
-			compare_result = LIBUNA_COMPARE_GREATER;
-		}
-		else if( node_key->parent_identifier == parent_identifier )
+		if( libfshfs_btree_file_get_leaf_node_by_number(
+		     btree_file,
+		     file_io_handle,
+		     node_cache,
+		     node_number,
+		     &node,
+		     error ) != 1 )
 		{
-			if( node_key->name_data != NULL )
-			{
-				compare_result = libfshfs_catalog_btree_key_compare_name_with_utf16_string(
-				                  node_key,
-				                  utf16_string,
-				                  utf16_string_length,
-				                  use_case_folding,
-				                  error );
-
-				if( compare_result == -1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GENERIC,
-					 "%s: unable to compare UTF-16 string with catalog B-tree key name.",
-					 function );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve B-tree leaf node: %" PRIu32 ".",
+			 function,
+			 node_number );
 
-					goto on_error;
-				}
-			}
+			return( -1 );
 		}
-		if( compare_result == LIBUNA_COMPARE_GREATER )
+		for( record_index = 0;
+		     record_index < node->descriptor->number_of_records;
+		     record_index++ )
 		{
-			if( libfshfs_catalog_btree_file_get_sub_node_number_from_key(
-			     last_node_key,
-			     &sub_node_number,
+			if( libfshfs_catalog_btree_file_get_key_view_from_node_by_index(
+			     node,
+			     io_handle,
+			     record_index,
+			     1,
+			     &node_key,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve sub node number from catalog B-Tree key.",
-				 function );
+				 "%s: unable to retrieve catalog B-tree key: %" PRIu16 " from node: %" PRIu32 ".",
+				 function,
+				 record_index,
+				 node_number );
 
-				goto on_error;
+				return( -1 );
 			}
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
+			if( node_key.parent_identifier > parent_identifier )
 			{
-				libcnotify_printf(
-				 "%s: B-tree record: %d sub node number: %" PRIu32 "\n",
-				 function,
-				 last_record_index,
-				 sub_node_number );
-
-				libcnotify_printf(
-				 "\n" );
+				return( 1 );
 			}
-#endif
-			if( libfshfs_btree_file_get_node_by_number(
-			     btree_file,
-			     file_io_handle,
-			     node_cache,
-			     recursion_depth,
-			     sub_node_number,
-			     &sub_node,
-			     error ) == -1 )
+			if( node_key.parent_identifier < parent_identifier )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve B-tree sub node: %" PRIu32 ".",
-				 function,
-				 sub_node_number );
-
-				goto on_error;
+				continue;
 			}
-			if( libfshfs_btree_node_get_node_type(
-			     sub_node,
-			     &node_type,
-			     error ) != 1 )
+			result = libfshfs_catalog_btree_file_get_stat_from_key(
+			          &node_key,
+			          &stat_value,
+			          &link_reference,
+			          error );
+
+			if( result == -1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to determine if B-tree sub node: %" PRIu32 " type.",
+				 "%s: unable to retrieve stat values from catalog B-tree key: %" PRIu16 " in node: %" PRIu32 ".",
 				 function,
-				 sub_node_number );
+				 record_index,
+				 node_number );
 
-				goto on_error;
-			}
-			if( node_type == LIBFSHFS_BTREE_NODE_TYPE_INDEX_NODE )
-			{
-				result = libfshfs_catalog_btree_file_get_directory_entry_from_branch_node_by_utf16_name(
-				          btree_file,
-				          io_handle,
-				          file_io_handle,
-				          node_cache,
-				          sub_node,
-				          parent_identifier,
-				          name_hash,
-				          utf16_string,
-				          utf16_string_length,
-				          use_case_folding,
-				          directory_entry,
-				          recursion_depth + 1,
-				          error );
+				return( -1 );
 			}
-			else if( node_type == LIBFSHFS_BTREE_NODE_TYPE_LEAF_NODE )
+			else if( result == 0 )
 			{
-				result = libfshfs_catalog_btree_file_get_directory_entry_from_leaf_node_by_utf16_name(
-				          btree_file,
-				          io_handle,
-				          sub_node,
-				          parent_identifier,
-				          name_hash,
-				          utf16_string,
-				          utf16_string_length,
-				          use_case_folding,
-				          directory_entry,
-				          error );
+				continue;
 			}
+			result = callback_function(
+			          &node_key,
+			          &stat_value,
+			          link_reference,
+			          callback_data,
+			          error );
+
 			if( result == -1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve directory entry from catalog B-tree node: %" PRIu32 ".",
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: callback function failed for record: %" PRIu32 ".",
 				 function,
-				 sub_node_number );
+				 stat_value.identifier );
 
-				goto on_error;
+				return( -1 );
 			}
-			if( ( result == 1 )
-			 || ( node_key->parent_identifier > parent_identifier ) )
+			else if( result == 0 )
 			{
-				break;
+				return( 1 );
 			}
 		}
-		last_node_key = node_key;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-		last_record_index++;
-#endif
-	}
-	return( result );
-
-on_error:
-	if( *directory_entry != NULL )
-	{
-		libfshfs_directory_entry_free(
-		 directory_entry,
-		 NULL );
+		node_number = node->descriptor->next_node_number;
 	}
-	return( -1 );
+	return( 1 );
 }
 
-/* Retrieves a directory entry for an UTF-16 encoded name from the catalog B-tree file
- * Returns 1 if successful, 0 if not found or -1 on error
+/* Retrieves the number of directory and file records of a specific parent identifier
+ * The leaf nodes are read sequentially from the first leaf node that can contain
+ * the records of the parent identifier until a record of a higher parent identifier is found
+ * Only the record type of the records is read, the stat values are not decoded
+ * Returns 1 if successful or -1 on error
  */
-int libfshfs_catalog_btree_file_get_directory_entry_by_utf16_name(
+int libfshfs_catalog_btree_file_get_number_of_sub_records(
      libfshfs_btree_file_t *btree_file,
      libfshfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libfshfs_btree_node_cache_t *node_cache,
      uint32_t parent_identifier,
-     uint32_t name_hash,
-     const uint16_t *utf16_string,
-     size_t utf16_string_length,
-     uint8_t use_case_folding,
-     libfshfs_directory_entry_t **directory_entry,
+     int *number_of_sub_records,
      libcerror_error_t **error )
 {
-	libfshfs_btree_node_t *root_node = NULL;
-	static char *function            = "libfshfs_catalog_btree_file_get_directory_entry_by_utf16_name";
-	uint8_t node_type                = 0;
-	int result                       = 0;
+	libfshfs_btree_node_t *node            = NULL;
+	libfshfs_catalog_btree_key_t node_key;
 
-	if( libfshfs_btree_file_get_root_node(
-	     btree_file,
-	     file_io_handle,
-	     node_cache,
-	     &root_node,
-	     error ) == -1 )
+	static char *function                  = "libfshfs_catalog_btree_file_get_number_of_sub_records";
+	uint32_t node_number                   = 0;
+	uint32_t number_of_leaf_nodes          = 0;
+	uint16_t record_index                  = 0;
+	uint16_t record_type                   = 0;
+	int safe_number_of_sub_records         = 0;
+
+	if( btree_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve B-tree root node.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid B-tree file.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfshfs_btree_node_get_node_type(
-	     root_node,
-	     &node_type,
-	     error ) != 1 )
+	if( btree_file->node_vector == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine if B-tree root node type.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid B-tree file - missing node vector.",
 		 function );
 
 		return( -1 );
 	}
-	if( node_type == LIBFSHFS_BTREE_NODE_TYPE_INDEX_NODE )
-	{
-		result = libfshfs_catalog_btree_file_get_directory_entry_from_branch_node_by_utf16_name(
-		          btree_file,
-		          io_handle,
-		          file_io_handle,
-		          node_cache,
-		          root_node,
-		          parent_identifier,
-		          name_hash,
-		          utf16_string,
-		          utf16_string_length,
-		          use_case_folding,
-		          directory_entry,
-		          1,
-		          error );
-	}
-	else if( node_type == LIBFSHFS_BTREE_NODE_TYPE_LEAF_NODE )
+	if( number_of_sub_records == NULL )
 	{
-		result = libfshfs_catalog_btree_file_get_directory_entry_from_leaf_node_by_utf16_name(
-		          btree_file,
-		          io_handle,
-		          root_node,
-		          parent_identifier,
-		          name_hash,
-		          utf16_string,
-		          utf16_string_length,
-		          use_case_folding,
-		          directory_entry,
-		          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of sub records.",
+		 function );
+
+		return( -1 );
 	}
-	if( result == -1 )
+	if( libfshfs_catalog_btree_file_get_first_leaf_node_number(
+	     btree_file,
+	     io_handle,
+	     file_io_handle,
+	     node_cache,
+	     parent_identifier,
+	     &node_number,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve directory entry from catalog B-tree root node.",
+		 "%s: unable to retrieve first leaf node number.",
 		 function );
 
-		return( -1 );
+		return( -1 );
+	}
+	while( node_number != 0 )
+	{
+		/* Protect against a loop in the leaf node chain
+		 */
+		if( number_of_leaf_nodes >= btree_file->node_vector->number_of_nodes )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of leaf nodes value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_leaf_nodes++;
+
+		if( libfshfs_btree_file_get_leaf_node_by_number(
+		     btree_file,
+		     file_io_handle,
+		     node_cache,
+		     node_number,
+		     &node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve B-tree leaf node: %" PRIu32 ".",
+			 function,
+			 node_number );
+
+			return( -1 );
+		}
+		for( record_index = 0;
+		     record_index < node->descriptor->number_of_records;
+		     record_index++ )
+		{
+			if( libfshfs_catalog_btree_file_get_key_view_from_node_by_index(
+			     node,
+			     io_handle,
+			     record_index,
+			     1,
+			     &node_key,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve catalog B-tree key: %" PRIu16 " from node: %" PRIu32 ".",
+				 function,
+				 record_index,
+				 node_number );
+
+				return( -1 );
+			}
+			if( node_key.parent_identifier > parent_identifier )
+			{
+				*number_of_sub_records = safe_number_of_sub_records;
+
+				return( 1 );
+			}
+			if( ( node_key.parent_identifier < parent_identifier )
+			 || ( node_key.record_data == NULL )
+			 || ( node_key.record_data_size < 2 ) )
+			{
+				continue;
+			}
+			byte_stream_copy_to_uint16_big_endian(
+			 node_key.record_data,
+			 record_type );
+
+			if( ( record_type != LIBFSHFS_RECORD_TYPE_HFSPLUS_DIRECTORY_RECORD )
+			 && ( record_type != LIBFSHFS_RECORD_TYPE_HFSPLUS_FILE_RECORD )
+			 && ( record_type != LIBFSHFS_RECORD_TYPE_HFS_DIRECTORY_RECORD )
+			 && ( record_type != LIBFSHFS_RECORD_TYPE_HFS_FILE_RECORD ) )
+			{
+				continue;
+			}
+			if( safe_number_of_sub_records >= INT_MAX )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid number of sub records value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			safe_number_of_sub_records++;
+		}
+		node_number = node->descriptor->next_node_number;
 	}
-	return( result );
+	*number_of_sub_records = safe_number_of_sub_records;
+
+	return( 1 );
 }
 
-/* Retrieves a directory entry for an UTF-16 encoded path from the catalog B-tree file
- * Returns 1 if successful, 0 if not found or -1 on error
+/* Reads the catalog index
+ * The leaf nodes are read sequentially by following their next node numbers
+ * and the location of every directory and file record is stored in the index
+ * Returns 1 if successful or -1 on error
  */
-int libfshfs_catalog_btree_file_get_directory_entry_by_utf16_path(
+int libfshfs_catalog_btree_file_read_catalog_index(
      libfshfs_btree_file_t *btree_file,
      libfshfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libfshfs_btree_node_cache_t *node_cache,
-     const uint16_t *utf16_string,
-     size_t utf16_string_length,
-     uint8_t use_case_folding,
-     libfshfs_directory_entry_t **directory_entry,
+     libfshfs_catalog_index_t *catalog_index,
      libcerror_error_t **error )
 {
-	libfshfs_btree_node_t *root_node                 = NULL;
-	libfshfs_directory_entry_t *safe_directory_entry = NULL;
-	const uint16_t *utf16_string_segment             = NULL;
-	static char *function                            = "libfshfs_catalog_btree_file_get_directory_entry_by_utf16_path";
-	libuna_unicode_character_t unicode_character     = 0;
-	size_t utf16_string_index                        = 0;
-	size_t utf16_string_segment_length               = 0;
-	uint32_t lookup_identifier                       = 0;
-	uint32_t segment_name_hash                       = 0;
-	uint8_t node_type                                = 0;
-	int result                                       = 0;
+	libfshfs_catalog_btree_key_t node_key;
+
+	libfshfs_btree_node_t *node            = NULL;
+	static char *function                  = "libfshfs_catalog_btree_file_read_catalog_index";
+	uint32_t identifier                    = 0;
+	uint32_t node_number                   = 0;
+	uint32_t number_of_leaf_nodes          = 0;
+	uint16_t record_index                  = 0;
+	uint16_t record_type                   = 0;
 
 	if( btree_file == NULL )
 	{
@@ -3529,272 +6404,217 @@ int libfshfs_catalog_btree_file_get_directory_entry_by_utf16_path(
 
 		return( -1 );
 	}
-	if( utf16_string == NULL )
+	if( btree_file->header == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-16 string.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid B-tree file - missing header.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf16_string_length > (size_t) SSIZE_MAX )
+	if( btree_file->node_vector == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid B-tree file - missing node vector.",
 		 function );
 
 		return( -1 );
 	}
-	if( directory_entry == NULL )
+	if( catalog_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory entry.",
+		 "%s: invalid catalog index.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfshfs_btree_file_get_root_node(
-	     btree_file,
-	     file_io_handle,
-	     node_cache,
-	     &root_node,
-	     error ) == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve B-tree root node.",
-		 function );
-
-		goto on_error;
-	}
-	if( libfshfs_btree_node_get_node_type(
-	     root_node,
-	     &node_type,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine if B-tree root node type.",
-		 function );
-
-		goto on_error;
-	}
-	lookup_identifier = LIBFSHFS_ROOT_DIRECTORY_IDENTIFIER;
+	node_number = btree_file->header->first_leaf_node_number;
 
-	if( utf16_string_length > 0 )
+	while( node_number != 0 )
 	{
-		/* Ignore a leading separator
+		/* Protect against a loop in the leaf node chain
 		 */
-		if( utf16_string[ utf16_string_index ] == (uint16_t) LIBFSHFS_SEPARATOR )
+		if( number_of_leaf_nodes >= btree_file->node_vector->number_of_nodes )
 		{
-			utf16_string_index++;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of leaf nodes value out of bounds.",
+			 function );
+
+			return( -1 );
 		}
-	}
-	if( ( utf16_string_length == 0 )
-	 || ( utf16_string_length == 1 ) )
-	{
-		result = libfshfs_catalog_btree_file_get_directory_entry_by_identifier(
-		          btree_file,
-		          io_handle,
-		          file_io_handle,
-		          node_cache,
-		          LIBFSHFS_ROOT_DIRECTORY_IDENTIFIER,
-		          use_case_folding,
-		          &safe_directory_entry,
-		          error );
+		number_of_leaf_nodes++;
 
-		if( result == -1 )
+		if( libfshfs_btree_file_get_leaf_node_by_number(
+		     btree_file,
+		     file_io_handle,
+		     node_cache,
+		     node_number,
+		     &node,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve root directory entry from catalog B-tree file.",
-			 function );
+			 "%s: unable to retrieve B-tree leaf node: %" PRIu32 ".",
+			 function,
+			 node_number );
 
-			goto on_error;
+			return( -1 );
 		}
-	}
-	else while( utf16_string_index < utf16_string_length )
-	{
-		utf16_string_segment        = &( utf16_string[ utf16_string_index ] );
-		utf16_string_segment_length = utf16_string_index;
-
-		while( utf16_string_index < utf16_string_length )
+		for( record_index = 0;
+		     record_index < node->descriptor->number_of_records;
+		     record_index++ )
 		{
-			if( libuna_unicode_character_copy_from_utf16(
-			     &unicode_character,
-			     utf16_string,
-			     utf16_string_length,
-			     &utf16_string_index,
-			     error ) != 1 )
+			if( libfshfs_catalog_btree_file_get_key_view_from_node_by_index(
+			     node,
+			     io_handle,
+			     record_index,
+			     1,
+			     &node_key,
+			     error ) == -1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy UTF-16 string to Unicode character.",
-				 function );
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve catalog B-tree key: %" PRIu16 " from node: %" PRIu32 ".",
+				 function,
+				 record_index,
+				 node_number );
 
-				goto on_error;
+				return( -1 );
 			}
-			if( ( unicode_character == (libuna_unicode_character_t) LIBFSHFS_SEPARATOR )
-			 || ( unicode_character == 0 ) )
+			if( ( node_key.record_data == NULL )
+			 || ( node_key.record_data_size < 2 ) )
 			{
-				utf16_string_segment_length += 1;
-
-				break;
+				continue;
 			}
-		}
-		utf16_string_segment_length = utf16_string_index - utf16_string_segment_length;
+			byte_stream_copy_to_uint16_big_endian(
+			 node_key.record_data,
+			 record_type );
 
-		if( utf16_string_segment_length == 0 )
-		{
-			result = 0;
-		}
-		else
-		{
-			if( safe_directory_entry != NULL )
+			/* Only the directory and file records are stored in the index
+			 */
+			switch( record_type )
 			{
-				if( libfshfs_directory_entry_free(
-				     &safe_directory_entry,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-					 "%s: unable to free directory entry.",
-					 function );
+				case LIBFSHFS_RECORD_TYPE_HFSPLUS_DIRECTORY_RECORD:
+					if( node_key.record_data_size < sizeof( fshfs_catalog_directory_record_hfsplus_t ) )
+					{
+						continue;
+					}
+					byte_stream_copy_to_uint32_big_endian(
+					 ( (fshfs_catalog_directory_record_hfsplus_t *) node_key.record_data )->identifier,
+					 identifier );
 
-					goto on_error;
-				}
+					break;
+
+				case LIBFSHFS_RECORD_TYPE_HFSPLUS_FILE_RECORD:
+					if( node_key.record_data_size < sizeof( fshfs_catalog_file_record_hfsplus_t ) )
+					{
+						continue;
+					}
+					byte_stream_copy_to_uint32_big_endian(
+					 ( (fshfs_catalog_file_record_hfsplus_t *) node_key.record_data )->identifier,
+					 identifier );
+
+					break;
+
+				case LIBFSHFS_RECORD_TYPE_HFS_DIRECTORY_RECORD:
+					if( node_key.record_data_size < sizeof( fshfs_catalog_directory_record_hfs_t ) )
+					{
+						continue;
+					}
+					byte_stream_copy_to_uint32_big_endian(
+					 ( (fshfs_catalog_directory_record_hfs_t *) node_key.record_data )->identifier,
+					 identifier );
+
+					break;
+
+				case LIBFSHFS_RECORD_TYPE_HFS_FILE_RECORD:
+					if( node_key.record_data_size < sizeof( fshfs_catalog_file_record_hfs_t ) )
+					{
+						continue;
+					}
+					byte_stream_copy_to_uint32_big_endian(
+					 ( (fshfs_catalog_file_record_hfs_t *) node_key.record_data )->identifier,
+					 identifier );
+
+					break;
+
+				default:
+					continue;
 			}
-			if( libfshfs_name_calculate_hash_utf16_string(
-			     utf16_string_segment,
-			     utf16_string_segment_length,
-			     use_case_folding,
-			     &segment_name_hash,
+			if( libfshfs_catalog_index_append_record(
+			     catalog_index,
+			     identifier,
+			     node_number,
+			     record_index,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GENERIC,
-				 "%s: unable to calculate name hash.",
-				 function );
-
-				goto on_error;
-			}
-			if( node_type == LIBFSHFS_BTREE_NODE_TYPE_INDEX_NODE )
-			{
-				result = libfshfs_catalog_btree_file_get_directory_entry_from_branch_node_by_utf16_name(
-					  btree_file,
-					  io_handle,
-					  file_io_handle,
-					  node_cache,
-					  root_node,
-					  lookup_identifier,
-					  segment_name_hash,
-					  utf16_string_segment,
-					  utf16_string_segment_length,
-					  use_case_folding,
-					  &safe_directory_entry,
-					  1,
-					  error );
-			}
-			else if( node_type == LIBFSHFS_BTREE_NODE_TYPE_LEAF_NODE )
-			{
-				result = libfshfs_catalog_btree_file_get_directory_entry_from_leaf_node_by_utf16_name(
-					  btree_file,
-					  io_handle,
-					  root_node,
-					  lookup_identifier,
-					  segment_name_hash,
-					  utf16_string_segment,
-					  utf16_string_segment_length,
-					  use_case_folding,
-					  &safe_directory_entry,
-					  error );
-			}
-		}
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve directory entry by name.",
-			 function );
-
-			goto on_error;
-		}
-		else if( result == 0 )
-		{
-			break;
-		}
-		if( libfshfs_directory_entry_get_identifier(
-		     safe_directory_entry,
-		     &lookup_identifier,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve directory entry identifier.",
-			 function );
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append record: %" PRIu16 " of node: %" PRIu32 " to catalog index.",
+				 function,
+				 record_index,
+				 node_number );
 
-			goto on_error;
+				return( -1 );
+			}
 		}
+		node_number = node->descriptor->next_node_number;
 	}
-	if( result != 0 )
+	if( libfshfs_catalog_index_sort(
+	     catalog_index,
+	     error ) != 1 )
 	{
-		*directory_entry = safe_directory_entry;
-	}
-	return( result );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to sort catalog index.",
+		 function );
 
-on_error:
-	if( *directory_entry != NULL )
-	{
-		libfshfs_directory_entry_free(
-		 directory_entry,
-		 NULL );
+		return( -1 );
 	}
-	return( -1 );
+	return( 1 );
 }
 
-/* Retrieves directory entries for a specific parent identifier from the catalog B-tree leaf node
+/* Retrieves the number of the first leaf node that can contain the records of a specific parent identifier
+ * The B-tree is descended by following the last key that precedes the parent identifier
  * Returns 1 if successful or -1 on error
  */
-int libfshfs_catalog_btree_file_get_directory_entries_from_leaf_node(
+int libfshfs_catalog_btree_file_get_first_leaf_node_number(
      libfshfs_btree_file_t *btree_file,
      libfshfs_io_handle_t *io_handle,
-     libfshfs_btree_node_t *node,
+     libbfio_handle_t *file_io_handle,
+     libfshfs_btree_node_cache_t *node_cache,
      uint32_t parent_identifier,
-     libcdata_array_t *directory_entries,
+     uint32_t *leaf_node_number,
      libcerror_error_t **error )
 {
+	libfshfs_btree_node_t *node                 = NULL;
+	libfshfs_catalog_btree_key_t *last_node_key = NULL;
 	libfshfs_catalog_btree_key_t *node_key      = NULL;
-	libfshfs_directory_entry_t *directory_entry = NULL;
-	static char *function                       = "libfshfs_catalog_btree_file_get_directory_entries_from_leaf_node";
+	static char *function                       = "libfshfs_catalog_btree_file_get_first_leaf_node_number";
+	uint32_t node_number                        = 0;
 	uint16_t record_index                       = 0;
-	int entry_index                             = 0;
-	int is_leaf_node                            = 0;
-	int result                                  = 0;
+	uint8_t node_type                           = 0;
+	int recursion_depth                         = 0;
 
 	if( btree_file == NULL )
 	{
@@ -3807,175 +6627,216 @@ int libfshfs_catalog_btree_file_get_directory_entries_from_leaf_node(
 
 		return( -1 );
 	}
-	if( node == NULL )
+	if( btree_file->header == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid B-tree node.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid B-tree file - missing header.",
 		 function );
 
 		return( -1 );
 	}
-	if( node->descriptor == NULL )
+	if( leaf_node_number == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid B-tree node - missing descriptor.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid leaf node number.",
 		 function );
 
 		return( -1 );
 	}
-	is_leaf_node = libfshfs_btree_node_is_leaf_node(
-	                node,
-	                error );
+	node_number = btree_file->header->root_node_number;
 
-	if( is_leaf_node == -1 )
+	if( libfshfs_btree_file_get_root_node(
+	     btree_file,
+	     file_io_handle,
+	     node_cache,
+	     &node,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine if B-tree node is a leaf node.",
-		 function );
-
-		goto on_error;
-	}
-	else if( is_leaf_node == 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid node - not a leaf node.",
+		 "%s: unable to retrieve B-tree root node.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	for( record_index = 0;
-	     record_index < node->descriptor->number_of_records;
-	     record_index++ )
+	while( node != NULL )
 	{
-		if( libfshfs_catalog_btree_file_get_key_from_node_by_index(
+		if( libfshfs_btree_node_get_node_type(
 		     node,
-		     io_handle,
-		     record_index,
-		     1,
-		     &node_key,
-		     error ) == -1 )
+		     &node_type,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve catalog B-tree key: %" PRIu16 ".",
+			 "%s: unable to determine if B-tree node: %" PRIu32 " type.",
 			 function,
-			 record_index );
+			 node_number );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( node_key == NULL )
+		if( node_type == LIBFSHFS_BTREE_NODE_TYPE_LEAF_NODE )
+		{
+			break;
+		}
+		if( node_type != LIBFSHFS_BTREE_NODE_TYPE_INDEX_NODE )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing catalog B-tree key: %" PRIu16 ".",
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported B-tree node: %" PRIu32 " type: 0x%02" PRIx8 ".",
 			 function,
-			 record_index );
+			 node_number,
+			 node_type );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( node_key->parent_identifier == parent_identifier )
+		if( recursion_depth >= LIBFSHFS_MAXIMUM_BTREE_NODE_RECURSION_DEPTH )
 		{
-			result = libfshfs_catalog_btree_file_get_directory_entry_from_key(
-			          node_key,
-			          &directory_entry,
-			          error );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid recursion depth value out of bounds.",
+			 function );
 
-			if( result == -1 )
+			return( -1 );
+		}
+		if( libfshfs_catalog_btree_file_get_key_from_node_by_index(
+		     node,
+		     io_handle,
+		     0,
+		     0,
+		     &last_node_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve catalog B-tree key: 0 from node: %" PRIu32 ".",
+			 function,
+			 node_number );
+
+			return( -1 );
+		}
+		for( record_index = 1;
+		     record_index < node->descriptor->number_of_records;
+		     record_index++ )
+		{
+			if( libfshfs_catalog_btree_file_get_key_from_node_by_index(
+			     node,
+			     io_handle,
+			     record_index,
+			     0,
+			     &node_key,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve directory entry from record data.",
-				 function );
+				 "%s: unable to retrieve catalog B-tree key: %" PRIu16 " from node: %" PRIu32 ".",
+				 function,
+				 record_index,
+				 node_number );
 
-				goto on_error;
+				return( -1 );
 			}
-			else if( result != 0 )
+			if( node_key == NULL )
 			{
-				if( libcdata_array_append_entry(
-				     directory_entries,
-				     &entry_index,
-				     (intptr_t *) directory_entry,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-					 "%s: unable to append directory entry to array.",
-					 function );
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing catalog B-tree key: %" PRIu16 " in node: %" PRIu32 ".",
+				 function,
+				 record_index,
+				 node_number );
 
-					goto on_error;
-				}
-				directory_entry = NULL;
+				return( -1 );
 			}
+			if( node_key->parent_identifier >= parent_identifier )
+			{
+				break;
+			}
+			last_node_key = node_key;
 		}
-		if( node_key->parent_identifier > parent_identifier )
+		if( libfshfs_catalog_btree_file_get_sub_node_number_from_key(
+		     last_node_key,
+		     &node_number,
+		     error ) != 1 )
 		{
-			break;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub node number from catalog B-Tree key.",
+			 function );
+
+			return( -1 );
 		}
-	}
-	return( 1 );
+		recursion_depth++;
 
-on_error:
-	if( directory_entry != NULL )
-	{
-		libfshfs_directory_entry_free(
-		 &directory_entry,
-		 NULL );
+		if( libfshfs_btree_file_get_node_by_number(
+		     btree_file,
+		     file_io_handle,
+		     node_cache,
+		     recursion_depth,
+		     node_number,
+		     &node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve B-tree sub node: %" PRIu32 ".",
+			 function,
+			 node_number );
+
+			return( -1 );
+		}
 	}
-	libcdata_array_empty(
-	 directory_entries,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libfshfs_directory_entry_free,
-	 NULL );
+	*leaf_node_number = node_number;
 
-	return( -1 );
+	return( 1 );
 }
 
-/* Retrieves directory entries for a specific parent identifier from the catalog B-tree branch node
+/* Reads the indirect node index
+ * The leaf nodes are read sequentially from the first leaf node that can contain the
+ * records of the parent identifier and the location of every directory and file record
+ * of the parent is stored in the index
  * Returns 1 if successful or -1 on error
  */
-int libfshfs_catalog_btree_file_get_directory_entries_from_branch_node(
+int libfshfs_catalog_btree_file_read_indirect_node_index(
      libfshfs_btree_file_t *btree_file,
      libfshfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libfshfs_btree_node_cache_t *node_cache,
-     libfshfs_btree_node_t *node,
      uint32_t parent_identifier,
-     libcdata_array_t *directory_entries,
-     int recursion_depth,
+     libfshfs_catalog_index_t *catalog_index,
      libcerror_error_t **error )
 {
-	libfshfs_btree_node_t *sub_node             = NULL;
-	libfshfs_catalog_btree_key_t *last_node_key = NULL;
-	libfshfs_catalog_btree_key_t *node_key      = NULL;
-	static char *function                       = "libfshfs_catalog_btree_file_get_directory_entries_from_branch_node";
-	uint32_t sub_node_number                    = 0;
-	uint16_t record_index                       = 0;
-	uint8_t node_type                           = 0;
-	int is_branch_node                          = 0;
-	int result                                  = 0;
+	libfshfs_catalog_btree_key_t node_key;
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	uint16_t last_record_index                  = 0;
-#endif
+	libfshfs_btree_node_t *node            = NULL;
+	static char *function                  = "libfshfs_catalog_btree_file_read_indirect_node_index";
+	uint32_t identifier                    = 0;
+	uint32_t node_number                   = 0;
+	uint32_t number_of_leaf_nodes          = 0;
+	uint16_t record_index                  = 0;
+	uint16_t record_type                   = 0;
 
 	if( btree_file == NULL )
 	{
@@ -3988,332 +6849,298 @@ int libfshfs_catalog_btree_file_get_directory_entries_from_branch_node(
 
 		return( -1 );
 	}
-	if( node == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid B-tree node.",
-		 function );
-
-		return( -1 );
-	}
-	if( node->descriptor == NULL )
+	if( btree_file->header == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid B-tree node - missing descriptor.",
+		 "%s: invalid B-tree file - missing header.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( recursion_depth < 0 )
-	 || ( recursion_depth > LIBFSHFS_MAXIMUM_BTREE_NODE_RECURSION_DEPTH ) )
+	if( btree_file->node_vector == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid recursion depth value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid B-tree file - missing node vector.",
 		 function );
 
 		return( -1 );
 	}
-	is_branch_node = libfshfs_btree_node_is_branch_node(
-	                  node,
-	                  error );
-
-	if( is_branch_node == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine if B-tree node is a branch node.",
-		 function );
-
-		goto on_error;
-	}
-	else if( is_branch_node == 0 )
+	if( catalog_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid node - not a branch node.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog index.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfshfs_catalog_btree_file_get_key_from_node_by_index(
-	     node,
+	if( libfshfs_catalog_btree_file_get_first_leaf_node_number(
+	     btree_file,
 	     io_handle,
-	     0,
-	     0,
-	     &last_node_key,
-	     error ) == -1 )
+	     file_io_handle,
+	     node_cache,
+	     parent_identifier,
+	     &node_number,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve catalog B-tree key: 0.",
+		 "%s: unable to retrieve first leaf node number.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	node_key = last_node_key;
-
-	for( record_index = 1;
-	     record_index <= node->descriptor->number_of_records;
-	     record_index++ )
+	/* Sweep the leaf nodes until a record of a higher parent identifier is found
+	 */
+	while( node_number != 0 )
 	{
-		if( record_index < node->descriptor->number_of_records )
+		/* Protect against a loop in the leaf node chain
+		 */
+		if( number_of_leaf_nodes >= btree_file->node_vector->number_of_nodes )
 		{
-			if( libfshfs_catalog_btree_file_get_key_from_node_by_index(
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of leaf nodes value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_leaf_nodes++;
+
+		if( libfshfs_btree_file_get_leaf_node_by_number(
+		     btree_file,
+		     file_io_handle,
+		     node_cache,
+		     node_number,
+		     &node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve B-tree leaf node: %" PRIu32 ".",
+			 function,
+			 node_number );
+
+			return( -1 );
+		}
+		for( record_index = 0;
+		     record_index < node->descriptor->number_of_records;
+		     record_index++ )
+		{
+			if( libfshfs_catalog_btree_file_get_key_view_from_node_by_index(
 			     node,
 			     io_handle,
 			     record_index,
-			     0,
+			     1,
 			     &node_key,
-			     error ) == -1 )
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve catalog B-tree key: %" PRIu16 ".",
+				 "%s: unable to retrieve catalog B-tree key: %" PRIu16 " from node: %" PRIu32 ".",
 				 function,
-				 record_index );
+				 record_index,
+				 node_number );
 
-				goto on_error;
+				return( -1 );
 			}
-			if( node_key == NULL )
+			if( node_key.parent_identifier < parent_identifier )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing catalog B-tree key: %" PRIu16 ".",
-				 function,
-				 record_index );
-
-				goto on_error;
+				continue;
 			}
-		}
-		if( ( record_index == node->descriptor->number_of_records )
-		 || ( node_key->parent_identifier >= parent_identifier ) )
-		{
-			if( libfshfs_catalog_btree_file_get_sub_node_number_from_key(
-			     last_node_key,
-			     &sub_node_number,
-			     error ) != 1 )
+			if( node_key.parent_identifier > parent_identifier )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve sub node number from catalog B-Tree key.",
-				 function );
-
-				goto on_error;
+				break;
 			}
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
+			if( ( node_key.record_data == NULL )
+			 || ( node_key.record_data_size < 2 ) )
 			{
-				libcnotify_printf(
-				 "%s: B-tree record: %d sub node number: %" PRIu32 "\n",
-				 function,
-				 last_record_index,
-				 sub_node_number );
-
-				libcnotify_printf(
-				 "\n" );
+				continue;
 			}
-#endif
-			if( libfshfs_btree_file_get_node_by_number(
-			     btree_file,
-			     file_io_handle,
-			     node_cache,
-			     recursion_depth,
-			     sub_node_number,
-			     &sub_node,
-			     error ) == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve B-tree sub node: %" PRIu32 ".",
-				 function,
-				 sub_node_number );
+			byte_stream_copy_to_uint16_big_endian(
+			 node_key.record_data,
+			 record_type );
 
-				goto on_error;
-			}
-			if( libfshfs_btree_node_get_node_type(
-			     sub_node,
-			     &node_type,
-			     error ) != 1 )
+			/* The indirect nodes are stored as file records and the directory
+			 * hard link targets as directory records
+			 */
+			if( record_type == LIBFSHFS_RECORD_TYPE_HFSPLUS_FILE_RECORD )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to determine if B-tree sub node: %" PRIu32 " type.",
-				 function,
-				 sub_node_number );
-
-				goto on_error;
+				if( node_key.record_data_size < sizeof( fshfs_catalog_file_record_hfsplus_t ) )
+				{
+					continue;
+				}
+				byte_stream_copy_to_uint32_big_endian(
+				 ( (fshfs_catalog_file_record_hfsplus_t *) node_key.record_data )->identifier,
+				 identifier );
 			}
-			if( node_type == LIBFSHFS_BTREE_NODE_TYPE_INDEX_NODE )
+			else if( record_type == LIBFSHFS_RECORD_TYPE_HFSPLUS_DIRECTORY_RECORD )
 			{
-				result = libfshfs_catalog_btree_file_get_directory_entries_from_branch_node(
-				          btree_file,
-				          io_handle,
-				          file_io_handle,
-				          node_cache,
-				          sub_node,
-				          parent_identifier,
-				          directory_entries,
-				          recursion_depth + 1,
-				          error );
+				if( node_key.record_data_size < sizeof( fshfs_catalog_directory_record_hfsplus_t ) )
+				{
+					continue;
+				}
+				byte_stream_copy_to_uint32_big_endian(
+				 ( (fshfs_catalog_directory_record_hfsplus_t *) node_key.record_data )->identifier,
+				 identifier );
 			}
-			else if( node_type == LIBFSHFS_BTREE_NODE_TYPE_LEAF_NODE )
+			else
 			{
-				result = libfshfs_catalog_btree_file_get_directory_entries_from_leaf_node(
-				          btree_file,
-				          io_handle,
-				          sub_node,
-				          parent_identifier,
-				          directory_entries,
-				          error );
+				continue;
 			}
-			if( result != 1 )
+			if( libfshfs_catalog_index_append_record(
+			     catalog_index,
+			     identifier,
+			     node_number,
+			     record_index,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve directory entries from catalog B-tree node: %" PRIu32 ".",
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append record: %" PRIu16 " of node: %" PRIu32 " to indirect node index.",
 				 function,
-				 sub_node_number );
+				 record_index,
+				 node_number );
 
-				goto on_error;
-			}
-			if( node_key->parent_identifier > parent_identifier )
-			{
-				break;
+				return( -1 );
 			}
 		}
-		last_node_key = node_key;
+		if( record_index < node->descriptor->number_of_records )
+		{
+			break;
+		}
+		node_number = node->descriptor->next_node_number;
+	}
+	if( libfshfs_catalog_index_sort(
+	     catalog_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to sort indirect node index.",
+		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		last_record_index++;
-#endif
+		return( -1 );
 	}
 	return( 1 );
-
-on_error:
-	libcdata_array_empty(
-	 directory_entries,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libfshfs_directory_entry_free,
-	 NULL );
-
-	return( -1 );
 }
 
-/* Retrieves directory entries for a specific parent identifier from the catalog B-tree file
- * Returns 1 if successful or -1 on error
+/* Retrieves the directory entry of a specific catalog index entry from the catalog B-tree file
+ * Returns 1 if successful, 0 if not found or -1 on error
  */
-int libfshfs_catalog_btree_file_get_directory_entries(
+int libfshfs_catalog_btree_file_get_directory_entry_from_index_entry(
      libfshfs_btree_file_t *btree_file,
      libfshfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libfshfs_btree_node_cache_t *node_cache,
-     uint32_t parent_identifier,
-     libcdata_array_t *directory_entries,
+     libfshfs_catalog_index_entry_t *catalog_index_entry,
+     libfshfs_directory_entry_t **directory_entry,
      libcerror_error_t **error )
 {
-	libfshfs_btree_node_t *root_node = NULL;
-	static char *function            = "libfshfs_catalog_btree_file_get_directory_entries";
-	uint8_t node_type                = 0;
-	int result                       = 1;
+	libfshfs_catalog_btree_key_t *node_key = NULL;
+	libfshfs_btree_node_t *node            = NULL;
+	static char *function                  = "libfshfs_catalog_btree_file_get_directory_entry_from_index_entry";
+	int result                             = 0;
 
-	if( libfshfs_btree_file_get_root_node(
+	if( catalog_index_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog index entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfshfs_btree_file_get_leaf_node_by_number(
 	     btree_file,
 	     file_io_handle,
 	     node_cache,
-	     &root_node,
-	     error ) == -1 )
+	     catalog_index_entry->node_number,
+	     &node,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve B-tree root node.",
-		 function );
+		 "%s: unable to retrieve B-tree leaf node: %" PRIu32 ".",
+		 function,
+		 catalog_index_entry->node_number );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfshfs_btree_node_get_node_type(
-	     root_node,
-	     &node_type,
-	     error ) != 1 )
+	if( libfshfs_catalog_btree_file_get_key_from_node_by_index(
+	     node,
+	     io_handle,
+	     catalog_index_entry->record_index,
+	     1,
+	     &node_key,
+	     error ) == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine if B-tree root node is a branch node.",
-		 function );
+		 "%s: unable to retrieve catalog B-tree key: %" PRIu16 " from node: %" PRIu32 ".",
+		 function,
+		 catalog_index_entry->record_index,
+		 catalog_index_entry->node_number );
 
-		goto on_error;
-	}
-	if( node_type == LIBFSHFS_BTREE_NODE_TYPE_INDEX_NODE )
-	{
-		result = libfshfs_catalog_btree_file_get_directory_entries_from_branch_node(
-		          btree_file,
-		          io_handle,
-		          file_io_handle,
-		          node_cache,
-		          root_node,
-		          parent_identifier,
-		          directory_entries,
-		          1,
-		          error );
+		return( -1 );
 	}
-	else if( node_type == LIBFSHFS_BTREE_NODE_TYPE_LEAF_NODE )
+	if( node_key == NULL )
 	{
-		result = libfshfs_catalog_btree_file_get_directory_entries_from_leaf_node(
-		          btree_file,
-		          io_handle,
-		          root_node,
-		          parent_identifier,
-		          directory_entries,
-		          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing catalog B-tree key: %" PRIu16 " in node: %" PRIu32 ".",
+		 function,
+		 catalog_index_entry->record_index,
+		 catalog_index_entry->node_number );
+
+		return( -1 );
 	}
-	if( result != 1 )
+	result = libfshfs_catalog_btree_file_get_directory_entry_from_key(
+	          node,
+	          node_key,
+	          NULL,
+	          directory_entry,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve directory entries from catalog B-tree root node.",
+		 "%s: unable to retrieve directory entry from catalog B-tree key.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	return( 1 );
-
-on_error:
-	libcdata_array_empty(
-	 directory_entries,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libfshfs_directory_entry_free,
-	 NULL );
-
-	return( -1 );
+	return( result );
 }
 
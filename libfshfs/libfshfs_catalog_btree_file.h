@@ -26,19 +26,34 @@
 #include <types.h>
 
 #include "libfshfs_btree_file.h"
+#include "libfshfs_btree_node.h"
 #include "libfshfs_btree_node_cache.h"
+#include "libfshfs_btree_node_record.h"
 #include "libfshfs_catalog_btree_key.h"
+#include "libfshfs_catalog_index.h"
+#include "libfshfs_directory_entries_page.h"
 #include "libfshfs_directory_entry.h"
 #include "libfshfs_io_handle.h"
 #include "libfshfs_libbfio.h"
 #include "libfshfs_libcdata.h"
 #include "libfshfs_libcerror.h"
+#include "libfshfs_lookup_target.h"
+#include "libfshfs_memory_arena.h"
+#include "libfshfs_path_cache.h"
 #include "libfshfs_thread_record.h"
+#include "libfshfs_types.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+int libfshfs_catalog_btree_file_read_key_from_node_record(
+     libfshfs_btree_node_record_t *node_record,
+     libfshfs_io_handle_t *io_handle,
+     int is_leaf_node,
+     libfshfs_catalog_btree_key_t *node_key,
+     libcerror_error_t **error );
+
 int libfshfs_catalog_btree_file_get_key_from_node_by_index(
      libfshfs_btree_node_t *node,
      libfshfs_io_handle_t *io_handle,
@@ -47,6 +62,14 @@ int libfshfs_catalog_btree_file_get_key_from_node_by_index(
      libfshfs_catalog_btree_key_t **node_key,
      libcerror_error_t **error );
 
+int libfshfs_catalog_btree_file_get_key_view_from_node_by_index(
+     libfshfs_btree_node_t *node,
+     libfshfs_io_handle_t *io_handle,
+     uint16_t record_index,
+     int is_leaf_node,
+     libfshfs_catalog_btree_key_t *node_key,
+     libcerror_error_t **error );
+
 int libfshfs_catalog_btree_file_get_sub_node_number_from_key(
      libfshfs_catalog_btree_key_t *node_key,
      uint32_t *sub_node_number,
@@ -86,7 +109,9 @@ int libfshfs_catalog_btree_file_get_thread_record(
      libcerror_error_t **error );
 
 int libfshfs_catalog_btree_file_get_directory_entry_from_key(
+     libfshfs_btree_node_t *node,
      libfshfs_catalog_btree_key_t *node_key,
+     libfshfs_memory_arena_t *memory_arena,
      libfshfs_directory_entry_t **directory_entry,
      libcerror_error_t **error );
 
@@ -166,12 +191,39 @@ int libfshfs_catalog_btree_file_get_directory_entry_by_utf8_path(
      libfshfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libfshfs_btree_node_cache_t *node_cache,
+     libfshfs_path_cache_t *path_cache,
      const uint8_t *utf8_string,
      size_t utf8_string_length,
      uint8_t use_case_folding,
      libfshfs_directory_entry_t **directory_entry,
      libcerror_error_t **error );
 
+int libfshfs_catalog_btree_file_compare_key_with_lookup_target(
+     libfshfs_catalog_btree_key_t *node_key,
+     libfshfs_lookup_target_t *lookup_target,
+     uint8_t use_case_folding,
+     libcerror_error_t **error );
+
+int libfshfs_catalog_btree_file_get_leaf_node_by_lookup_target(
+     libfshfs_btree_file_t *btree_file,
+     libfshfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfshfs_btree_node_cache_t *node_cache,
+     libfshfs_lookup_target_t *lookup_target,
+     uint8_t use_case_folding,
+     libfshfs_btree_node_t **leaf_node,
+     libcerror_error_t **error );
+
+int libfshfs_catalog_btree_file_get_records_by_lookup_targets(
+     libfshfs_btree_file_t *btree_file,
+     libfshfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfshfs_btree_node_cache_t *node_cache,
+     libfshfs_lookup_target_t *lookup_targets,
+     int number_of_lookup_targets,
+     uint8_t use_case_folding,
+     libcerror_error_t **error );
+
 int libfshfs_catalog_btree_file_get_directory_entry_from_leaf_node_by_utf16_name(
      libfshfs_btree_file_t *btree_file,
      libfshfs_io_handle_t *io_handle,
@@ -217,6 +269,7 @@ int libfshfs_catalog_btree_file_get_directory_entry_by_utf16_path(
      libfshfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libfshfs_btree_node_cache_t *node_cache,
+     libfshfs_path_cache_t *path_cache,
      const uint16_t *utf16_string,
      size_t utf16_string_length,
      uint8_t use_case_folding,
@@ -228,6 +281,7 @@ int libfshfs_catalog_btree_file_get_directory_entries_from_leaf_node(
      libfshfs_io_handle_t *io_handle,
      libfshfs_btree_node_t *node,
      uint32_t parent_identifier,
+     libfshfs_memory_arena_t *memory_arena,
      libcdata_array_t *directory_entries,
      libcerror_error_t **error );
 
@@ -238,6 +292,7 @@ int libfshfs_catalog_btree_file_get_directory_entries_from_branch_node(
      libfshfs_btree_node_cache_t *node_cache,
      libfshfs_btree_node_t *node,
      uint32_t parent_identifier,
+     libfshfs_memory_arena_t *memory_arena,
      libcdata_array_t *directory_entries,
      int recursion_depth,
      libcerror_error_t **error );
@@ -248,9 +303,99 @@ int libfshfs_catalog_btree_file_get_directory_entries(
      libbfio_handle_t *file_io_handle,
      libfshfs_btree_node_cache_t *node_cache,
      uint32_t parent_identifier,
+     libfshfs_memory_arena_t *memory_arena,
      libcdata_array_t *directory_entries,
      libcerror_error_t **error );
 
+int libfshfs_catalog_btree_file_read_directory_entries_page(
+     libfshfs_btree_file_t *btree_file,
+     libfshfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfshfs_btree_node_cache_t *node_cache,
+     uint32_t parent_identifier,
+     libfshfs_directory_entries_page_t *directory_entries_page,
+     libcerror_error_t **error );
+
+int libfshfs_catalog_btree_file_get_stat_from_key(
+     libfshfs_catalog_btree_key_t *node_key,
+     libfshfs_file_entry_stat_t *stat_value,
+     uint32_t *link_reference,
+     libcerror_error_t **error );
+
+int libfshfs_catalog_btree_file_iterate_records(
+     libfshfs_btree_file_t *btree_file,
+     libfshfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfshfs_btree_node_cache_t *node_cache,
+     int (*callback_function)(
+            uint32_t parent_identifier,
+            const uint8_t *name_data,
+            size_t name_size,
+            const libfshfs_file_entry_stat_t *stat_value,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libfshfs_catalog_btree_file_iterate_sub_records(
+     libfshfs_btree_file_t *btree_file,
+     libfshfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfshfs_btree_node_cache_t *node_cache,
+     uint32_t parent_identifier,
+     int (*callback_function)(
+            libfshfs_catalog_btree_key_t *node_key,
+            const libfshfs_file_entry_stat_t *stat_value,
+            uint32_t link_reference,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libfshfs_catalog_btree_file_get_number_of_sub_records(
+     libfshfs_btree_file_t *btree_file,
+     libfshfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfshfs_btree_node_cache_t *node_cache,
+     uint32_t parent_identifier,
+     int *number_of_sub_records,
+     libcerror_error_t **error );
+
+int libfshfs_catalog_btree_file_read_catalog_index(
+     libfshfs_btree_file_t *btree_file,
+     libfshfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfshfs_btree_node_cache_t *node_cache,
+     libfshfs_catalog_index_t *catalog_index,
+     libcerror_error_t **error );
+
+int libfshfs_catalog_btree_file_get_first_leaf_node_number(
+     libfshfs_btree_file_t *btree_file,
+     libfshfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfshfs_btree_node_cache_t *node_cache,
+     uint32_t parent_identifier,
+     uint32_t *leaf_node_number,
+     libcerror_error_t **error );
+
+int libfshfs_catalog_btree_file_read_indirect_node_index(
+     libfshfs_btree_file_t *btree_file,
+     libfshfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfshfs_btree_node_cache_t *node_cache,
+     uint32_t parent_identifier,
+     libfshfs_catalog_index_t *catalog_index,
+     libcerror_error_t **error );
+
+int libfshfs_catalog_btree_file_get_directory_entry_from_index_entry(
+     libfshfs_btree_file_t *btree_file,
+     libfshfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfshfs_btree_node_cache_t *node_cache,
+     libfshfs_catalog_index_entry_t *catalog_index_entry,
+     libfshfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
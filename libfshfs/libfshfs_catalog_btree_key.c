@@ -132,6 +132,11 @@ int libfshfs_catalog_btree_key_free(
 	{
 		/* The name_data and record_data references are freed elsewhere
 		 */
+		if( ( *catalog_btree_key )->folded_name != NULL )
+		{
+			memory_free(
+			 ( *catalog_btree_key )->folded_name );
+		}
 		memory_free(
 		 *catalog_btree_key );
 
@@ -434,6 +439,110 @@ int libfshfs_catalog_btree_key_read_data(
 	return( 1 );
 }
 
+/* Determines the folded name of the catalog B-tree key if not already cached
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_catalog_btree_key_get_folded_name(
+     libfshfs_catalog_btree_key_t *catalog_btree_key,
+     uint8_t use_case_folding,
+     libcerror_error_t **error )
+{
+	static char *function   = "libfshfs_catalog_btree_key_get_folded_name";
+	size_t folded_name_size = 0;
+
+	if( catalog_btree_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog B-tree key.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog_btree_key->folded_name != NULL )
+	{
+		if( catalog_btree_key->folded_name_use_case_folding == use_case_folding )
+		{
+			return( 1 );
+		}
+		memory_free(
+		 catalog_btree_key->folded_name );
+
+		catalog_btree_key->folded_name        = NULL;
+		catalog_btree_key->folded_name_length = 0;
+	}
+	if( ( catalog_btree_key->name_data == NULL )
+	 || ( catalog_btree_key->name_size == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid catalog B-tree key - missing name data.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every character of the name is stored in at least 1 byte
+	 */
+	folded_name_size = (size_t) catalog_btree_key->name_size;
+
+	if( catalog_btree_key->codepage == LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN )
+	{
+		folded_name_size = ( folded_name_size + 1 ) / 2;
+	}
+	catalog_btree_key->folded_name = (libuna_unicode_character_t *) memory_allocate(
+	                                  sizeof( libuna_unicode_character_t ) * folded_name_size );
+
+	if( catalog_btree_key->folded_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create folded name.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfshfs_name_get_folded_name(
+	     catalog_btree_key->name_data,
+	     (size_t) catalog_btree_key->name_size,
+	     catalog_btree_key->codepage,
+	     use_case_folding,
+	     catalog_btree_key->folded_name,
+	     folded_name_size,
+	     &( catalog_btree_key->folded_name_length ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve folded name.",
+		 function );
+
+		goto on_error;
+	}
+	catalog_btree_key->folded_name_use_case_folding = use_case_folding;
+
+	return( 1 );
+
+on_error:
+	if( catalog_btree_key->folded_name != NULL )
+	{
+		memory_free(
+		 catalog_btree_key->folded_name );
+
+		catalog_btree_key->folded_name = NULL;
+	}
+	catalog_btree_key->folded_name_length = 0;
+
+	return( -1 );
+}
+
 /* Compares a name with the catalog B-tree key name
  * Returns LIBUNA_COMPARE_LESS, LIBUNA_COMPARE_EQUAL, LIBUNA_COMPARE_GREATER if successful or -1 on error
  */
@@ -505,10 +614,23 @@ int libfshfs_catalog_btree_key_compare_name_with_utf8_string(
 
 		return( -1 );
 	}
-	result = libfshfs_name_compare_with_utf8_string(
-	          catalog_btree_key->name_data,
-	          catalog_btree_key->name_size,
-	          catalog_btree_key->codepage,
+	if( libfshfs_catalog_btree_key_get_folded_name(
+	     catalog_btree_key,
+	     use_case_folding,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve folded name.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfshfs_name_compare_folded_name_with_utf8_string(
+	          catalog_btree_key->folded_name,
+	          catalog_btree_key->folded_name_length,
 	          utf8_string,
 	          utf8_string_length,
 	          use_case_folding,
@@ -552,10 +674,23 @@ int libfshfs_catalog_btree_key_compare_name_with_utf16_string(
 
 		return( -1 );
 	}
-	result = libfshfs_name_compare_with_utf16_string(
-	          catalog_btree_key->name_data,
-	          catalog_btree_key->name_size,
-	          catalog_btree_key->codepage,
+	if( libfshfs_catalog_btree_key_get_folded_name(
+	     catalog_btree_key,
+	     use_case_folding,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve folded name.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfshfs_name_compare_folded_name_with_utf16_string(
+	          catalog_btree_key->folded_name,
+	          catalog_btree_key->folded_name_length,
 	          utf16_string,
 	          utf16_string_length,
 	          use_case_folding,
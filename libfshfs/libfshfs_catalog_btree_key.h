@@ -27,6 +27,7 @@
 
 #include "libfshfs_io_handle.h"
 #include "libfshfs_libcerror.h"
+#include "libfshfs_libuna.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -60,6 +61,18 @@ struct libfshfs_catalog_btree_key
 	 */
 	int codepage;
 
+	/* Folded name, cached for repeated comparisons
+	 */
+	libuna_unicode_character_t *folded_name;
+
+	/* Folded name length
+	 */
+	size_t folded_name_length;
+
+	/* Value to indicate case folding was applied to the folded name
+	 */
+	uint8_t folded_name_use_case_folding;
+
 	/* Record data
 	 */
 	const uint8_t *record_data;
@@ -84,6 +97,11 @@ int libfshfs_catalog_btree_key_read_data(
      size_t data_size,
      libcerror_error_t **error );
 
+int libfshfs_catalog_btree_key_get_folded_name(
+     libfshfs_catalog_btree_key_t *catalog_btree_key,
+     uint8_t use_case_folding,
+     libcerror_error_t **error );
+
 int libfshfs_catalog_btree_key_compare_name(
      libfshfs_catalog_btree_key_t *catalog_btree_key,
      const uint8_t *name,
@@ -0,0 +1,441 @@
+/*
+ * Catalog index functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libfshfs_catalog_index.h"
+#include "libfshfs_libcerror.h"
+
+/* Creates an catalog index
+ * Make sure the value catalog_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_catalog_index_initialize(
+     libfshfs_catalog_index_t **catalog_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_catalog_index_initialize";
+
+	if( catalog_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *catalog_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid catalog index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*catalog_index = memory_allocate_structure(
+	                  libfshfs_catalog_index_t );
+
+	if( *catalog_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create catalog index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *catalog_index,
+	     0,
+	     sizeof( libfshfs_catalog_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear catalog index.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *catalog_index != NULL )
+	{
+		memory_free(
+		 *catalog_index );
+
+		*catalog_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an catalog index
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_catalog_index_free(
+     libfshfs_catalog_index_t **catalog_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_catalog_index_free";
+
+	if( catalog_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *catalog_index != NULL )
+	{
+		if( ( *catalog_index )->entries != NULL )
+		{
+			memory_free(
+			 ( *catalog_index )->entries );
+		}
+		memory_free(
+		 *catalog_index );
+
+		*catalog_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends a catalog B-tree record to the index
+ * The index needs to be sorted after the records have been appended
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_catalog_index_append_record(
+     libfshfs_catalog_index_t *catalog_index,
+     uint32_t identifier,
+     uint32_t node_number,
+     uint16_t record_index,
+     libcerror_error_t **error )
+{
+	libfshfs_catalog_index_entry_t *catalog_index_entry = NULL;
+	libfshfs_catalog_index_entry_t *reallocation        = NULL;
+	static char *function                               = "libfshfs_catalog_index_append_record";
+	size_t entries_size                                 = 0;
+	int number_of_allocated_entries                     = 0;
+
+	if( catalog_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog index.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog_index->number_of_entries >= catalog_index->number_of_allocated_entries )
+	{
+		if( catalog_index->number_of_allocated_entries == 0 )
+		{
+			number_of_allocated_entries = 256;
+		}
+		else if( catalog_index->number_of_allocated_entries < ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_entries = catalog_index->number_of_allocated_entries * 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated entries value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		entries_size = sizeof( libfshfs_catalog_index_entry_t ) * number_of_allocated_entries;
+
+		if( entries_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid entries size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = (libfshfs_catalog_index_entry_t *) memory_reallocate(
+		                catalog_index->entries,
+		                entries_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		catalog_index->entries                     = reallocation;
+		catalog_index->number_of_allocated_entries = number_of_allocated_entries;
+	}
+	catalog_index_entry = &( catalog_index->entries[ catalog_index->number_of_entries ] );
+
+	catalog_index_entry->identifier   = identifier;
+	catalog_index_entry->node_number  = node_number;
+	catalog_index_entry->record_index = record_index;
+
+	catalog_index->number_of_entries += 1;
+	catalog_index->is_sorted         = 0;
+
+	return( 1 );
+}
+
+/* Compares two catalog index entries by identifier
+ * Returns -1 if the first entry is less than the second, 0 if equal or 1 if greater
+ */
+int libfshfs_catalog_index_entry_compare(
+     const libfshfs_catalog_index_entry_t *first_entry,
+     const libfshfs_catalog_index_entry_t *second_entry )
+{
+	if( first_entry->identifier < second_entry->identifier )
+	{
+		return( -1 );
+	}
+	else if( first_entry->identifier > second_entry->identifier )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Sorts the catalog index entries by identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_catalog_index_sort(
+     libfshfs_catalog_index_t *catalog_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_catalog_index_sort";
+
+	if( catalog_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog index.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog_index->number_of_entries > 1 )
+	{
+		qsort(
+		 catalog_index->entries,
+		 (size_t) catalog_index->number_of_entries,
+		 sizeof( libfshfs_catalog_index_entry_t ),
+		 (int (*)(const void *, const void *)) &libfshfs_catalog_index_entry_compare );
+	}
+	catalog_index->is_sorted = 1;
+
+	return( 1 );
+}
+
+/* Retrieves the number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_catalog_index_get_number_of_entries(
+     libfshfs_catalog_index_t *catalog_index,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_catalog_index_get_number_of_entries";
+
+	if( catalog_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog index.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = catalog_index->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves a specific catalog index entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_catalog_index_get_entry_by_index(
+     libfshfs_catalog_index_t *catalog_index,
+     int entry_index,
+     libfshfs_catalog_index_entry_t **catalog_index_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_catalog_index_get_entry_by_index";
+
+	if( catalog_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= catalog_index->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog_index_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog index entry.",
+		 function );
+
+		return( -1 );
+	}
+	*catalog_index_entry = &( catalog_index->entries[ entry_index ] );
+
+	return( 1 );
+}
+
+/* Retrieves the catalog index entry of a specific identifier
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libfshfs_catalog_index_get_entry_by_identifier(
+     libfshfs_catalog_index_t *catalog_index,
+     uint32_t identifier,
+     libfshfs_catalog_index_entry_t **catalog_index_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_catalog_index_get_entry_by_identifier";
+	int lower_index       = 0;
+	int middle_index      = 0;
+	int upper_index       = 0;
+
+	if( catalog_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog index.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog_index_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog index entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog_index->is_sorted == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid catalog index - entries not sorted.",
+		 function );
+
+		return( -1 );
+	}
+	upper_index = catalog_index->number_of_entries;
+
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( identifier < catalog_index->entries[ middle_index ].identifier )
+		{
+			upper_index = middle_index;
+		}
+		else if( identifier > catalog_index->entries[ middle_index ].identifier )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			*catalog_index_entry = &( catalog_index->entries[ middle_index ] );
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
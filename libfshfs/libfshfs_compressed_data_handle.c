@@ -826,6 +826,8 @@ ssize_t libfshfs_compressed_data_handle_read_segment_data(
 	ssize_t read_count                = 0;
 	off64_t data_stream_offset        = 0;
 	off64_t uncompressed_block_offset = 0;
+	int64_t start_timestamp           = 0;
+	int64_t stop_timestamp            = 0;
 	uint32_t compressed_block_index   = 0;
 
 	LIBFSHFS_UNREFERENCED_PARAMETER( file_io_handle )
@@ -984,6 +986,22 @@ ssize_t libfshfs_compressed_data_handle_read_segment_data(
 #endif
 			data_handle->segment_data_size = LIBFSHFS_COMPRESSED_DATA_HANDLE_BLOCK_SIZE;
 
+			if( data_handle->statistics != NULL )
+			{
+				if( libfshfs_statistics_get_timestamp(
+				     &start_timestamp,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve start timestamp.",
+					 function );
+
+					return( -1 );
+				}
+			}
 			if( libfshfs_decompress_data(
 			     data_handle->compressed_segment_data,
 			     (size_t) read_count,
@@ -1001,6 +1019,46 @@ ssize_t libfshfs_compressed_data_handle_read_segment_data(
 
 				return( -1 );
 			}
+			if( data_handle->statistics != NULL )
+			{
+				if( libfshfs_statistics_get_timestamp(
+				     &stop_timestamp,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve stop timestamp.",
+					 function );
+
+					return( -1 );
+				}
+				if( stop_timestamp < start_timestamp )
+				{
+					stop_timestamp = start_timestamp;
+				}
+				if( ( data_handle->compression_method >= 0 )
+				 && ( data_handle->compression_method < LIBFSHFS_STATISTICS_NUMBER_OF_COMPRESSION_METHODS ) )
+				{
+					if( libfshfs_statistics_add_decompression(
+					     data_handle->statistics,
+					     data_handle->compression_method,
+					     (uint64_t) data_handle->segment_data_size,
+					     (uint64_t) ( stop_timestamp - start_timestamp ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+						 "%s: unable to add decompression to statistics.",
+						 function );
+
+						return( -1 );
+					}
+				}
+			}
 #if defined( HAVE_DEBUG_OUTPUT )
 			if( libcnotify_verbose != 0 )
 			{
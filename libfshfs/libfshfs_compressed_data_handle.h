@@ -28,6 +28,7 @@
 #include "libfshfs_libbfio.h"
 #include "libfshfs_libcerror.h"
 #include "libfshfs_libfdata.h"
+#include "libfshfs_statistics.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -76,6 +77,11 @@ struct libfshfs_compressed_data_handle
 	/* The compressed block offsets
 	 */
 	uint32_t *compressed_block_offsets;
+
+	/* The statistics, where NULL if not available
+	 * The statistics are not owned by the data handle
+	 */
+	libfshfs_statistics_t *statistics;
 };
 
 int libfshfs_compressed_data_handle_initialize(
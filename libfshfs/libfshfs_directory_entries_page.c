@@ -0,0 +1,405 @@
+/*
+ * Directory entries page functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfshfs_directory_entries_page.h"
+#include "libfshfs_directory_entry.h"
+#include "libfshfs_libcdata.h"
+#include "libfshfs_libcerror.h"
+
+/* Creates a directory entries page
+ * Make sure the value directory_entries_page is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_directory_entries_page_initialize(
+     libfshfs_directory_entries_page_t **directory_entries_page,
+     int maximum_number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_directory_entries_page_initialize";
+
+	if( directory_entries_page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entries page.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_entries_page != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory entries page value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_entries <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum number of entries value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	*directory_entries_page = memory_allocate_structure(
+	                           libfshfs_directory_entries_page_t );
+
+	if( *directory_entries_page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory entries page.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *directory_entries_page,
+	     0,
+	     sizeof( libfshfs_directory_entries_page_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear directory entries page.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( ( *directory_entries_page )->directory_entries ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory entries array.",
+		 function );
+
+		goto on_error;
+	}
+	( *directory_entries_page )->maximum_number_of_entries = maximum_number_of_entries;
+
+	return( 1 );
+
+on_error:
+	if( *directory_entries_page != NULL )
+	{
+		memory_free(
+		 *directory_entries_page );
+
+		*directory_entries_page = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a directory entries page
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_directory_entries_page_free(
+     libfshfs_directory_entries_page_t **directory_entries_page,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_directory_entries_page_free";
+	int result            = 1;
+
+	if( directory_entries_page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entries page.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_entries_page != NULL )
+	{
+		if( libcdata_array_free(
+		     &( ( *directory_entries_page )->directory_entries ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfshfs_directory_entry_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory entries array.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *directory_entries_page );
+
+		*directory_entries_page = NULL;
+	}
+	return( result );
+}
+
+/* Empties a directory entries page to make room for the entries of the next page
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_directory_entries_page_empty(
+     libfshfs_directory_entries_page_t *directory_entries_page,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_directory_entries_page_empty";
+	int number_of_entries = 0;
+
+	if( directory_entries_page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entries page.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     directory_entries_page->directory_entries,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of directory entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entries_page->first_entry_index > ( INT_MAX - number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_empty(
+	     directory_entries_page->directory_entries,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfshfs_directory_entry_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty directory entries array.",
+		 function );
+
+		return( -1 );
+	}
+	directory_entries_page->first_entry_index += number_of_entries;
+
+	return( 1 );
+}
+
+/* Resets a directory entries page to the start of the directory
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_directory_entries_page_reset(
+     libfshfs_directory_entries_page_t *directory_entries_page,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_directory_entries_page_reset";
+
+	if( directory_entries_page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entries page.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_empty(
+	     directory_entries_page->directory_entries,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfshfs_directory_entry_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty directory entries array.",
+		 function );
+
+		return( -1 );
+	}
+	directory_entries_page->first_entry_index = 0;
+	directory_entries_page->next_node_number  = 0;
+	directory_entries_page->next_record_index = 0;
+	directory_entries_page->is_last_page      = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the number of directory entries in the page
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_directory_entries_page_get_number_of_entries(
+     libfshfs_directory_entries_page_t *directory_entries_page,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_directory_entries_page_get_number_of_entries";
+
+	if( directory_entries_page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entries page.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     directory_entries_page->directory_entries,
+	     number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of directory entries.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific directory entry from the page
+ * The entry index is relative to the start of the directory
+ * Returns 1 if successful, 0 if the entry is not in the page or -1 on error
+ */
+int libfshfs_directory_entries_page_get_entry_by_index(
+     libfshfs_directory_entries_page_t *directory_entries_page,
+     int entry_index,
+     libfshfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_directory_entries_page_get_entry_by_index";
+	int number_of_entries = 0;
+
+	if( directory_entries_page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entries page.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid entry index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     directory_entries_page->directory_entries,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of directory entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < directory_entries_page->first_entry_index )
+	 || ( ( entry_index - directory_entries_page->first_entry_index ) >= number_of_entries ) )
+	{
+		return( 0 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     directory_entries_page->directory_entries,
+	     entry_index - directory_entries_page->first_entry_index,
+	     (intptr_t **) directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,99 @@
+/*
+ * Directory entries page functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSHFS_DIRECTORY_ENTRIES_PAGE_H )
+#define _LIBFSHFS_DIRECTORY_ENTRIES_PAGE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfshfs_directory_entry.h"
+#include "libfshfs_libcdata.h"
+#include "libfshfs_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfshfs_directory_entries_page libfshfs_directory_entries_page_t;
+
+struct libfshfs_directory_entries_page
+{
+	/* The directory entries
+	 */
+	libcdata_array_t *directory_entries;
+
+	/* The index of the first directory entry in the page
+	 */
+	int first_entry_index;
+
+	/* The maximum number of directory entries in the page
+	 */
+	int maximum_number_of_entries;
+
+	/* The leaf node number of the cursor, where the next page starts
+	 * A value of 0 represents the start of the directory
+	 */
+	uint32_t next_node_number;
+
+	/* The record index of the cursor, where the next page starts
+	 */
+	uint16_t next_record_index;
+
+	/* Value to indicate the page is the last page of the directory
+	 */
+	uint8_t is_last_page;
+};
+
+int libfshfs_directory_entries_page_initialize(
+     libfshfs_directory_entries_page_t **directory_entries_page,
+     int maximum_number_of_entries,
+     libcerror_error_t **error );
+
+int libfshfs_directory_entries_page_free(
+     libfshfs_directory_entries_page_t **directory_entries_page,
+     libcerror_error_t **error );
+
+int libfshfs_directory_entries_page_empty(
+     libfshfs_directory_entries_page_t *directory_entries_page,
+     libcerror_error_t **error );
+
+int libfshfs_directory_entries_page_reset(
+     libfshfs_directory_entries_page_t *directory_entries_page,
+     libcerror_error_t **error );
+
+int libfshfs_directory_entries_page_get_number_of_entries(
+     libfshfs_directory_entries_page_t *directory_entries_page,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+int libfshfs_directory_entries_page_get_entry_by_index(
+     libfshfs_directory_entries_page_t *directory_entries_page,
+     int entry_index,
+     libfshfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSHFS_DIRECTORY_ENTRIES_PAGE_H ) */
+
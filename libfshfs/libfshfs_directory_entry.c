@@ -23,6 +23,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfshfs_btree_node.h"
 #include "libfshfs_definitions.h"
 #include "libfshfs_directory_entry.h"
 #include "libfshfs_directory_record.h"
@@ -128,11 +129,35 @@ int libfshfs_directory_entry_free(
 	}
 	if( *directory_entry != NULL )
 	{
-		if( ( *directory_entry )->name != NULL )
+		if( ( *directory_entry )->node != NULL )
+		{
+			if( libfshfs_btree_node_free(
+			     &( ( *directory_entry )->node ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release B-tree node.",
+				 function );
+
+				result = -1;
+			}
+		}
+		else if( ( *directory_entry )->name != NULL )
 		{
 			memory_free(
 			 ( *directory_entry )->name );
 		}
+		/* The directory entry and catalog record are freed with the memory arena
+		 */
+		if( ( *directory_entry )->memory_arena != NULL )
+		{
+			*directory_entry = NULL;
+
+			return( result );
+		}
 		if( ( *directory_entry )->catalog_record != NULL )
 		{
 			if( ( ( *directory_entry )->record_type == LIBFSHFS_RECORD_TYPE_HFSPLUS_DIRECTORY_RECORD )
@@ -250,9 +275,29 @@ int libfshfs_directory_entry_clone(
 		return( -1 );
 	}
 	( *destination_directory_entry )->name           = NULL;
+	( *destination_directory_entry )->node           = NULL;
 	( *destination_directory_entry )->catalog_record = NULL;
+	( *destination_directory_entry )->memory_arena   = NULL;
 
-	if( source_directory_entry->name != NULL )
+	if( source_directory_entry->node != NULL )
+	{
+		if( libfshfs_btree_node_add_reference(
+		     source_directory_entry->node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add reference to source B-tree node.",
+			 function );
+
+			goto on_error;
+		}
+		( *destination_directory_entry )->name = source_directory_entry->name;
+		( *destination_directory_entry )->node = source_directory_entry->node;
+	}
+	else if( source_directory_entry->name != NULL )
 	{
 		( *destination_directory_entry )->name = (uint8_t *) memory_allocate(
 		                                                      sizeof( uint8_t ) * source_directory_entry->name_size );
@@ -324,7 +369,13 @@ int libfshfs_directory_entry_clone(
 on_error:
 	if( *destination_directory_entry != NULL )
 	{
-		if( ( *destination_directory_entry )->name != NULL )
+		if( ( *destination_directory_entry )->node != NULL )
+		{
+			libfshfs_btree_node_free(
+			 &( ( *destination_directory_entry )->node ),
+			 NULL );
+		}
+		else if( ( *destination_directory_entry )->name != NULL )
 		{
 			memory_free(
 			 ( *destination_directory_entry )->name );
@@ -454,6 +505,135 @@ on_error:
 	return( -1 );
 }
 
+/* Sets the name from the data of a B-tree node
+ * The name is not copied but references the node data, for which a reference
+ * to the node is retained until the directory entry is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_directory_entry_set_name_from_node(
+     libfshfs_directory_entry_t *directory_entry,
+     libfshfs_btree_node_t *node,
+     const uint8_t *name,
+     size_t name_size,
+     int codepage,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_directory_entry_set_name_from_node";
+
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry->name != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory entry - name value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid B-tree node.",
+		 function );
+
+		return( -1 );
+	}
+	if( node->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid B-tree node - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name < node->data )
+	 || ( name > &( node->data[ node->data_size ] ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_size > (size_t) ( &( node->data[ node->data_size ] ) - name ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( codepage != LIBUNA_CODEPAGE_ASCII )
+	 && ( codepage != LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported codepage.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_size > 0 )
+	{
+		if( libfshfs_btree_node_add_reference(
+		     node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add reference to B-tree node.",
+			 function );
+
+			return( -1 );
+		}
+		directory_entry->name = (uint8_t *) name;
+		directory_entry->node = node;
+	}
+	directory_entry->name_size = name_size;
+	directory_entry->codepage  = codepage;
+
+	return( 1 );
+}
+
 /* Sets the catalog record
  * Returns 1 if successful or -1 on error
  */
@@ -650,6 +830,50 @@ int libfshfs_directory_entry_get_identifier(
 	return( 1 );
 }
 
+/* Retrieves the number of entries
+ * The number of entries is only stored in directory records
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfshfs_directory_entry_get_number_of_entries(
+     libfshfs_directory_entry_t *directory_entry,
+     uint32_t *number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_directory_entry_get_number_of_entries";
+
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( directory_entry->record_type != LIBFSHFS_RECORD_TYPE_HFSPLUS_DIRECTORY_RECORD )
+	 && ( directory_entry->record_type != LIBFSHFS_RECORD_TYPE_HFS_DIRECTORY_RECORD ) )
+	{
+		return( 0 );
+	}
+	if( libfshfs_directory_record_get_number_of_entries(
+	     (libfshfs_directory_record_t *) directory_entry->catalog_record,
+	     number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from catalog record.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Retrieves the parent identifier
  * Returns 1 if successful or -1 on error
  */
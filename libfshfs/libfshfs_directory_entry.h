@@ -25,8 +25,10 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfshfs_btree_node.h"
 #include "libfshfs_fork_descriptor.h"
 #include "libfshfs_libcerror.h"
+#include "libfshfs_memory_arena.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -40,6 +42,11 @@ struct libfshfs_directory_entry
 	 */
 	uint8_t *name;
 
+	/* The B-tree node that contains the name
+	 * When set the name references the node data instead of being allocated
+	 */
+	libfshfs_btree_node_t *node;
+
 	/* Name size
 	 */
 	uint16_t name_size;
@@ -59,6 +66,11 @@ struct libfshfs_directory_entry
 	/* Parent identifier
 	 */
 	uint32_t parent_identifier;
+
+	/* The memory arena the directory entry and its catalog record were allocated from
+	 * When set the directory entry and catalog record are freed with the memory arena
+	 */
+	libfshfs_memory_arena_t *memory_arena;
 };
 
 int libfshfs_directory_entry_initialize(
@@ -81,6 +93,14 @@ int libfshfs_directory_entry_set_name(
      int codepage,
      libcerror_error_t **error );
 
+int libfshfs_directory_entry_set_name_from_node(
+     libfshfs_directory_entry_t *directory_entry,
+     libfshfs_btree_node_t *node,
+     const uint8_t *name,
+     size_t name_size,
+     int codepage,
+     libcerror_error_t **error );
+
 int libfshfs_directory_entry_set_catalog_record(
      libfshfs_directory_entry_t *directory_entry,
      uint16_t record_type,
@@ -97,6 +117,11 @@ int libfshfs_directory_entry_get_identifier(
      uint32_t *identifier,
      libcerror_error_t **error );
 
+int libfshfs_directory_entry_get_number_of_entries(
+     libfshfs_directory_entry_t *directory_entry,
+     uint32_t *number_of_entries,
+     libcerror_error_t **error );
+
 int libfshfs_directory_entry_get_parent_identifier(
      libfshfs_directory_entry_t *directory_entry,
      uint32_t *parent_identifier,
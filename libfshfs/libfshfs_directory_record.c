@@ -320,6 +320,10 @@ int libfshfs_directory_record_read_data(
 		 ( (fshfs_catalog_directory_record_hfsplus_t *) data )->flags,
 		 directory_record->flags );
 
+		byte_stream_copy_to_uint32_big_endian(
+		 ( (fshfs_catalog_directory_record_hfsplus_t *) data )->number_of_entries,
+		 directory_record->number_of_entries );
+
 		byte_stream_copy_to_uint32_big_endian(
 		 ( (fshfs_catalog_directory_record_hfsplus_t *) data )->identifier,
 		 directory_record->identifier );
@@ -369,6 +373,10 @@ int libfshfs_directory_record_read_data(
 		 ( (fshfs_catalog_directory_record_hfs_t *) data )->flags,
 		 directory_record->flags );
 
+		byte_stream_copy_to_uint16_big_endian(
+		 ( (fshfs_catalog_directory_record_hfs_t *) data )->number_of_entries,
+		 directory_record->number_of_entries );
+
 		byte_stream_copy_to_uint32_big_endian(
 		 ( (fshfs_catalog_directory_record_hfs_t *) data )->identifier,
 		 directory_record->identifier );
@@ -781,6 +789,43 @@ int libfshfs_directory_record_get_identifier(
 	return( 1 );
 }
 
+/* Retrieves the number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_directory_record_get_number_of_entries(
+     libfshfs_directory_record_t *directory_record,
+     uint32_t *number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_directory_record_get_number_of_entries";
+
+	if( directory_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory record.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = directory_record->number_of_entries;
+
+	return( 1 );
+}
+
 /* Retrieves the creation date and time
  * The timestamp is a unsigned 32-bit HFS date and time value in number of seconds
  * Returns 1 if successful or -1 on error
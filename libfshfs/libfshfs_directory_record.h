@@ -39,6 +39,10 @@ struct libfshfs_directory_record
 	 */
 	uint16_t flags;
 
+	/* The number of entries (valence)
+	 */
+	uint32_t number_of_entries;
+
 	/* The identifier
 	 */
 	uint32_t identifier;
@@ -109,6 +113,11 @@ int libfshfs_directory_record_get_identifier(
      uint32_t *identifier,
      libcerror_error_t **error );
 
+int libfshfs_directory_record_get_number_of_entries(
+     libfshfs_directory_record_t *directory_record,
+     uint32_t *number_of_entries,
+     libcerror_error_t **error );
+
 int libfshfs_directory_record_get_creation_time(
      libfshfs_directory_record_t *directory_record,
      uint32_t *hfs_time,
@@ -737,21 +737,91 @@ ssize_t libfshfs_extended_attribute_read_buffer(
 	return( read_count );
 }
 
-/* Reads data at a specific offset
+/* Determines the data stream if not already determined
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_internal_extended_attribute_determine_data_stream(
+     libfshfs_internal_extended_attribute_t *internal_extended_attribute,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_internal_extended_attribute_determine_data_stream";
+	int result            = 1;
+
+	if( internal_extended_attribute == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extended attribute.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_extended_attribute->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_extended_attribute->data_stream == NULL )
+	{
+		if( libfshfs_internal_extended_attribute_get_data_stream(
+		     internal_extended_attribute,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine data stream.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_extended_attribute->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads data at a specific offset using a specific file IO handle
  * Returns the number of bytes read or -1 on error
  */
-ssize_t libfshfs_extended_attribute_read_buffer_at_offset(
-         libfshfs_extended_attribute_t *extended_attribute,
+ssize_t libfshfs_internal_extended_attribute_read_buffer_at_offset(
+         libfshfs_internal_extended_attribute_t *internal_extended_attribute,
+         libbfio_handle_t *file_io_handle,
          void *buffer,
          size_t buffer_size,
          off64_t offset,
          libcerror_error_t **error )
 {
-	libfshfs_internal_extended_attribute_t *internal_extended_attribute = NULL;
-	static char *function                                               = "libfshfs_extended_attribute_read_buffer_at_offset";
-	ssize_t read_count                                                  = 0;
+	static char *function = "libfshfs_internal_extended_attribute_read_buffer_at_offset";
+	ssize_t read_count    = 0;
 
-	if( extended_attribute == NULL )
+	if( internal_extended_attribute == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -762,8 +832,6 @@ ssize_t libfshfs_extended_attribute_read_buffer_at_offset(
 
 		return( -1 );
 	}
-	internal_extended_attribute = (libfshfs_internal_extended_attribute_t *) extended_attribute;
-
 #if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_extended_attribute->read_write_lock,
@@ -799,7 +867,7 @@ ssize_t libfshfs_extended_attribute_read_buffer_at_offset(
 	{
 		read_count = libfdata_stream_read_buffer_at_offset(
 		              internal_extended_attribute->data_stream,
-		              (intptr_t *) internal_extended_attribute->file_io_handle,
+		              (intptr_t *) file_io_handle,
 		              (uint8_t *) buffer,
 		              buffer_size,
 		              offset,
@@ -836,6 +904,55 @@ ssize_t libfshfs_extended_attribute_read_buffer_at_offset(
 	return( read_count );
 }
 
+/* Reads data at a specific offset
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfshfs_extended_attribute_read_buffer_at_offset(
+         libfshfs_extended_attribute_t *extended_attribute,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libfshfs_internal_extended_attribute_t *internal_extended_attribute = NULL;
+	static char *function                                               = "libfshfs_extended_attribute_read_buffer_at_offset";
+	ssize_t read_count                                                  = 0;
+
+	if( extended_attribute == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extended attribute.",
+		 function );
+
+		return( -1 );
+	}
+	internal_extended_attribute = (libfshfs_internal_extended_attribute_t *) extended_attribute;
+
+	read_count = libfshfs_internal_extended_attribute_read_buffer_at_offset(
+	              internal_extended_attribute,
+	              internal_extended_attribute->file_io_handle,
+	              buffer,
+	              buffer_size,
+	              offset,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset.",
+		 function );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
 /* Seeks a certain offset
  * Returns the offset if seek is successful or -1 on error
  */
@@ -130,6 +130,18 @@ ssize_t libfshfs_extended_attribute_read_buffer(
          size_t buffer_size,
          libcerror_error_t **error );
 
+int libfshfs_internal_extended_attribute_determine_data_stream(
+     libfshfs_internal_extended_attribute_t *internal_extended_attribute,
+     libcerror_error_t **error );
+
+ssize_t libfshfs_internal_extended_attribute_read_buffer_at_offset(
+         libfshfs_internal_extended_attribute_t *internal_extended_attribute,
+         libbfio_handle_t *file_io_handle,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
 LIBFSHFS_EXTERN \
 ssize_t libfshfs_extended_attribute_read_buffer_at_offset(
          libfshfs_extended_attribute_t *extended_attribute,
@@ -28,6 +28,7 @@
 #include "libfshfs_compressed_data_header.h"
 #include "libfshfs_data_stream.h"
 #include "libfshfs_definitions.h"
+#include "libfshfs_directory_entries_page.h"
 #include "libfshfs_directory_entry.h"
 #include "libfshfs_extended_attribute.h"
 #include "libfshfs_extent.h"
@@ -39,7 +40,10 @@
 #include "libfshfs_libcthreads.h"
 #include "libfshfs_libfdata.h"
 #include "libfshfs_libuna.h"
+#include "libfshfs_memory_arena.h"
+#include "libfshfs_name.h"
 #include "libfshfs_types.h"
+#include "libfshfs_unused.h"
 
 /* Creates a file_entry
  * Make sure the value file_entry is referencing, is set to NULL
@@ -317,6 +321,38 @@ int libfshfs_file_entry_free(
 				result = -1;
 			}
 		}
+		if( internal_file_entry->sub_directory_entries_memory_arena != NULL )
+		{
+			if( libfshfs_memory_arena_free(
+			     &( internal_file_entry->sub_directory_entries_memory_arena ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free sub directory entries memory arena.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_file_entry->sub_directory_entries_page != NULL )
+		{
+			if( libfshfs_directory_entries_page_free(
+			     &( internal_file_entry->sub_directory_entries_page ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free sub directory entries page.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( internal_file_entry->data_stream != NULL )
 		{
 			if( libfdata_stream_free(
@@ -367,6 +403,11 @@ int libfshfs_file_entry_free(
 				result = -1;
 			}
 		}
+		if( internal_file_entry->read_runs != NULL )
+		{
+			memory_free(
+			 internal_file_entry->read_runs );
+		}
 		if( internal_file_entry->symbolic_link_data != NULL )
 		{
 			memory_free(
@@ -713,6 +754,7 @@ int libfshfs_internal_file_entry_get_data_stream(
 		}
 		if( libfshfs_allocation_block_stream_initialize_from_compressed_stream(
 		     &( internal_file_entry->data_stream ),
+		     internal_file_entry->io_handle,
 		     compressed_data_stream,
 		     internal_file_entry->compressed_data_header->uncompressed_data_size,
 		     compression_method,
@@ -4293,19 +4335,23 @@ int libfshfs_file_entry_get_extended_attribute_by_utf16_name(
 	return( result );
 }
 
-/* Retrieves the number of sub file entries
+/* Determines the number of sub file entries
+ * The number of entries (valence) in the directory record is used when available.
+ * Otherwise the sub catalog records are counted, without decoding their stat values.
+ * A valence that does not match the sub catalog records is corrected when
+ * the last sub directory entries page is read
  * Returns 1 if successful or -1 on error
  */
-int libfshfs_file_entry_get_number_of_sub_file_entries(
-     libfshfs_file_entry_t *file_entry,
-     int *number_of_sub_file_entries,
+int libfshfs_internal_file_entry_determine_number_of_sub_file_entries(
+     libfshfs_internal_file_entry_t *internal_file_entry,
      libcerror_error_t **error )
 {
-	libfshfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                               = "libfshfs_file_entry_get_number_of_sub_file_entries";
-	int result                                          = 1;
+	static char *function             = "libfshfs_internal_file_entry_determine_number_of_sub_file_entries";
+	uint32_t number_of_entries        = 0;
+	int number_of_sub_catalog_records = 0;
+	int result                        = 0;
 
-	if( file_entry == NULL )
+	if( internal_file_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -4316,93 +4362,71 @@ int libfshfs_file_entry_get_number_of_sub_file_entries(
 
 		return( -1 );
 	}
-	internal_file_entry = (libfshfs_internal_file_entry_t *) file_entry;
-
-#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_file_entry->read_write_lock,
-	     error ) != 1 )
+	if( internal_file_entry->directory_entry != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
-		 function );
+		result = libfshfs_directory_entry_get_number_of_entries(
+		          internal_file_entry->directory_entry,
+		          &number_of_entries,
+		          error );
 
-		return( -1 );
-	}
-#endif
-	if( internal_file_entry->sub_directory_entries == NULL )
-	{
-		if( libfshfs_file_system_get_directory_entries(
-		     internal_file_entry->file_system,
-		     internal_file_entry->io_handle,
-		     internal_file_entry->file_io_handle,
-		     internal_file_entry->identifier,
-		     &( internal_file_entry->sub_directory_entries ),
-		     error ) != 1 )
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sub directory entries for entry: %" PRIu32 " from file system.",
-			 function,
-			 internal_file_entry->identifier );
+			 "%s: unable to retrieve number of entries from directory entry.",
+			 function );
 
-			result = -1;
+			return( -1 );
+		}
+		else if( ( result != 0 )
+		      && ( number_of_entries > (uint32_t) INT_MAX ) )
+		{
+			result = 0;
 		}
 	}
-	if( result != -1 )
+	if( result != 0 )
 	{
-		if( libcdata_array_get_number_of_entries(
-		     internal_file_entry->sub_directory_entries,
-		     number_of_sub_file_entries,
+		internal_file_entry->number_of_sub_file_entries = (int) number_of_entries;
+	}
+	else
+	{
+		if( libfshfs_file_system_get_number_of_sub_catalog_records(
+		     internal_file_entry->file_system,
+		     internal_file_entry->io_handle,
+		     internal_file_entry->file_io_handle,
+		     internal_file_entry->identifier,
+		     &number_of_sub_catalog_records,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of sub directory entries.",
+			 "%s: unable to retrieve number of sub catalog records.",
 			 function );
 
-			result = -1;
+			return( -1 );
 		}
+		internal_file_entry->number_of_sub_file_entries = number_of_sub_catalog_records;
 	}
-#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_file_entry->read_write_lock,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
-		 function );
+	internal_file_entry->number_of_sub_file_entries_determined = 1;
 
-		return( -1 );
-	}
-#endif
-	return( result );
+	return( 1 );
 }
 
-/* Retrieves the sub file entry for the specific index
+/* Retrieves the number of sub file entries
  * Returns 1 if successful or -1 on error
  */
-int libfshfs_file_entry_get_sub_file_entry_by_index(
+int libfshfs_file_entry_get_number_of_sub_file_entries(
      libfshfs_file_entry_t *file_entry,
-     int sub_file_entry_index,
-     libfshfs_file_entry_t **sub_file_entry,
+     int *number_of_sub_file_entries,
      libcerror_error_t **error )
 {
-	libfshfs_directory_entry_t *sub_directory_entry     = NULL;
-	libfshfs_directory_entry_t *safe_directory_entry    = NULL;
 	libfshfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                               = "libfshfs_file_entry_get_sub_file_entry_by_index";
-	int result                                          = 1;
+	static char *function                               = "libfshfs_file_entry_get_number_of_sub_file_entries";
+	int result                                          = 0;
 
 	if( file_entry == NULL )
 	{
@@ -4417,24 +4441,13 @@ int libfshfs_file_entry_get_sub_file_entry_by_index(
 	}
 	internal_file_entry = (libfshfs_internal_file_entry_t *) file_entry;
 
-	if( sub_file_entry == NULL )
+	if( number_of_sub_file_entries == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sub file entry.",
-		 function );
-
-		return( -1 );
-	}
-	if( *sub_file_entry != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid sub file entry value already set.",
+		 "%s: invalid number of sub file entries.",
 		 function );
 
 		return( -1 );
@@ -4454,82 +4467,65 @@ int libfshfs_file_entry_get_sub_file_entry_by_index(
 		return( -1 );
 	}
 #endif
-	if( internal_file_entry->sub_directory_entries == NULL )
+	/* In paged mode the number of sub file entries is determined once
+	 * so that the sub directory entries do not need to be read
+	 */
+	if( ( internal_file_entry->sub_file_entries_page_size > 0 )
+	 && ( internal_file_entry->sub_directory_entries == NULL ) )
 	{
-		if( libfshfs_file_system_get_directory_entries(
-		     internal_file_entry->file_system,
-		     internal_file_entry->io_handle,
-		     internal_file_entry->file_io_handle,
-		     internal_file_entry->identifier,
-		     &( internal_file_entry->sub_directory_entries ),
-		     error ) != 1 )
+		if( ( internal_file_entry->number_of_sub_file_entries_determined == 0 )
+		 && ( libfshfs_internal_file_entry_determine_number_of_sub_file_entries(
+		       internal_file_entry,
+		       error ) != 1 ) )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sub directory entries for entry: %" PRIu32 " from file system.",
-			 function,
-			 internal_file_entry->identifier );
+			 "%s: unable to determine number of sub file entries.",
+			 function );
 
 			result = -1;
 		}
+		else
+		{
+			*number_of_sub_file_entries = internal_file_entry->number_of_sub_file_entries;
+
+			result = 1;
+		}
 	}
-	if( result != -1 )
+	else
 	{
-		if( libcdata_array_get_entry_by_index(
-		     internal_file_entry->sub_directory_entries,
-		     sub_file_entry_index,
-		     (intptr_t **) &sub_directory_entry,
+		if( libfshfs_internal_file_entry_get_sub_directory_entries(
+		     internal_file_entry,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sub directory entry: %d.",
-			 function,
-			 sub_file_entry_index );
+			 "%s: unable to retrieve sub directory entries.",
+			 function );
 
 			result = -1;
 		}
-		else if( libfshfs_directory_entry_clone(
-		          &safe_directory_entry,
-		          sub_directory_entry,
+		else if( libcdata_array_get_number_of_entries(
+		          internal_file_entry->sub_directory_entries,
+		          number_of_sub_file_entries,
 		          error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to clone sub directory entry: %d.",
-			 function,
-			 sub_file_entry_index );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of sub directory entries.",
+			 function );
 
 			result = -1;
 		}
-		/* libfshfs_file_entry_initialize takes over management of sub_directory_entry
-		 */
-		else if( libfshfs_file_entry_initialize(
-		          sub_file_entry,
-		          internal_file_entry->io_handle,
-		          internal_file_entry->file_io_handle,
-		          internal_file_entry->file_system,
-		          safe_directory_entry,
-		          error ) != 1 )
+		else
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create file entry.",
-			 function );
-
-			libfshfs_directory_entry_free(
-			 &safe_directory_entry,
-			 NULL );
-
-			result = -1;
+			result = 1;
 		}
 	}
 #if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
@@ -4550,19 +4546,18 @@ int libfshfs_file_entry_get_sub_file_entry_by_index(
 	return( result );
 }
 
-/* Retrieves the sub file entry for an UTF-8 encoded name
- * Returns 1 if successful, 0 if no such file entry or -1 on error
+/* Sets the number of sub file entries per page
+ * In paged mode the sub file entries are read incrementally, a page at a time,
+ * instead of reading all the sub file entries at once. A page size of 0 disables paged mode
+ * Returns 1 if successful or -1 on error
  */
-int libfshfs_file_entry_get_sub_file_entry_by_utf8_name(
+int libfshfs_file_entry_set_sub_file_entries_page_size(
      libfshfs_file_entry_t *file_entry,
-     const uint8_t *utf8_string,
-     size_t utf8_string_length,
-     libfshfs_file_entry_t **sub_file_entry,
+     int page_size,
      libcerror_error_t **error )
 {
-	libfshfs_directory_entry_t *sub_directory_entry     = NULL;
 	libfshfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                               = "libfshfs_file_entry_get_sub_file_entry_by_utf8_name";
+	static char *function                               = "libfshfs_file_entry_set_sub_file_entries_page_size";
 	int result                                          = 1;
 
 	if( file_entry == NULL )
@@ -4578,30 +4573,19 @@ int libfshfs_file_entry_get_sub_file_entry_by_utf8_name(
 	}
 	internal_file_entry = (libfshfs_internal_file_entry_t *) file_entry;
 
-	if( sub_file_entry == NULL )
+	if( page_size < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sub file entry.",
-		 function );
-
-		return( -1 );
-	}
-	if( *sub_file_entry != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid sub file entry value already set.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid page size value less than zero.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -4609,61 +4593,35 @@ int libfshfs_file_entry_get_sub_file_entry_by_utf8_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	result = libfshfs_file_system_get_directory_entry_by_utf8_name(
-	          internal_file_entry->file_system,
-	          internal_file_entry->io_handle,
-	          internal_file_entry->file_io_handle,
-	          internal_file_entry->parent_identifier,
-	          utf8_string,
-	          utf8_string_length,
-	          &sub_directory_entry,
-	          error );
-
-	if( result == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve directory entry.",
-		 function );
-
-		result = -1;
-	}
-	else if( result != 0 )
+	if( ( internal_file_entry->sub_directory_entries_page != NULL )
+	 && ( internal_file_entry->sub_file_entries_page_size != page_size ) )
 	{
-		/* libfshfs_file_entry_initialize takes over management of sub_directory_entry
-		 */
-		if( libfshfs_file_entry_initialize(
-		     sub_file_entry,
-		     internal_file_entry->io_handle,
-		     internal_file_entry->file_io_handle,
-		     internal_file_entry->file_system,
-		     sub_directory_entry,
+		if( libfshfs_directory_entries_page_free(
+		     &( internal_file_entry->sub_directory_entries_page ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create file entry.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub directory entries page.",
 			 function );
 
-			libfshfs_directory_entry_free(
-			 &sub_directory_entry,
-			 NULL );
-
 			result = -1;
 		}
 	}
+	if( result != -1 )
+	{
+		internal_file_entry->sub_file_entries_page_size = page_size;
+	}
 #if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -4671,7 +4629,7 @@ int libfshfs_file_entry_get_sub_file_entry_by_utf8_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
@@ -4680,19 +4638,181 @@ int libfshfs_file_entry_get_sub_file_entry_by_utf8_name(
 	return( result );
 }
 
-/* Retrieves the sub file entry for an UTF-16 encoded name
- * Returns 1 if successful, 0 if no such file entry or -1 on error
+/* Retrieves a specific sub directory entry from the sub directory entries page
+ * The pages are read forward from the catalog leaf nodes, the page is rewound
+ * to the start of the directory when a preceding sub directory entry is requested
+ * Returns 1 if successful or -1 on error
  */
-int libfshfs_file_entry_get_sub_file_entry_by_utf16_name(
+int libfshfs_internal_file_entry_get_sub_directory_entry_from_page(
+     libfshfs_internal_file_entry_t *internal_file_entry,
+     int sub_directory_entry_index,
+     libfshfs_directory_entry_t **sub_directory_entry,
+     libcerror_error_t **error )
+{
+	static char *function      = "libfshfs_internal_file_entry_get_sub_directory_entry_from_page";
+	int number_of_page_entries = 0;
+	int result                 = 0;
+
+	if( internal_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_directory_entry_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid sub directory entry index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file_entry->sub_directory_entries_page == NULL )
+	{
+		if( libfshfs_directory_entries_page_initialize(
+		     &( internal_file_entry->sub_directory_entries_page ),
+		     internal_file_entry->sub_file_entries_page_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create sub directory entries page.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	result = libfshfs_directory_entries_page_get_entry_by_index(
+	          internal_file_entry->sub_directory_entries_page,
+	          sub_directory_entry_index,
+	          sub_directory_entry,
+	          error );
+
+	if( ( result == 0 )
+	 && ( sub_directory_entry_index < internal_file_entry->sub_directory_entries_page->first_entry_index ) )
+	{
+		if( libfshfs_directory_entries_page_reset(
+		     internal_file_entry->sub_directory_entries_page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to reset sub directory entries page.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	while( result == 0 )
+	{
+		if( internal_file_entry->sub_directory_entries_page->is_last_page != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid sub directory entry index value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfshfs_file_system_read_directory_entries_page(
+		     internal_file_entry->file_system,
+		     internal_file_entry->io_handle,
+		     internal_file_entry->file_io_handle,
+		     internal_file_entry->identifier,
+		     internal_file_entry->sub_directory_entries_page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read sub directory entries page for entry: %" PRIu32 ".",
+			 function,
+			 internal_file_entry->identifier );
+
+			return( -1 );
+		}
+		if( internal_file_entry->sub_directory_entries_page->is_last_page != 0 )
+		{
+			if( libfshfs_directory_entries_page_get_number_of_entries(
+			     internal_file_entry->sub_directory_entries_page,
+			     &number_of_page_entries,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of sub directory entries in page.",
+				 function );
+
+				return( -1 );
+			}
+			if( number_of_page_entries > ( INT_MAX - internal_file_entry->sub_directory_entries_page->first_entry_index ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid number of sub directory entries value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			/* The last page determines the actual number of sub file entries
+			 */
+			internal_file_entry->number_of_sub_file_entries            = internal_file_entry->sub_directory_entries_page->first_entry_index
+			                                                           + number_of_page_entries;
+			internal_file_entry->number_of_sub_file_entries_determined = 1;
+		}
+		result = libfshfs_directory_entries_page_get_entry_by_index(
+		          internal_file_entry->sub_directory_entries_page,
+		          sub_directory_entry_index,
+		          sub_directory_entry,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub directory entry: %d from page.",
+		 function,
+		 sub_directory_entry_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the sub file entry for the specific index
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_file_entry_get_sub_file_entry_by_index(
      libfshfs_file_entry_t *file_entry,
-     const uint16_t *utf16_string,
-     size_t utf16_string_length,
+     int sub_file_entry_index,
      libfshfs_file_entry_t **sub_file_entry,
      libcerror_error_t **error )
 {
 	libfshfs_directory_entry_t *sub_directory_entry     = NULL;
+	libfshfs_directory_entry_t *safe_directory_entry    = NULL;
 	libfshfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                               = "libfshfs_file_entry_get_sub_file_entry_by_utf16_name";
+	static char *function                               = "libfshfs_file_entry_get_sub_file_entry_by_index";
 	int result                                          = 1;
 
 	if( file_entry == NULL )
@@ -4731,7 +4851,7 @@ int libfshfs_file_entry_get_sub_file_entry_by_utf16_name(
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -4739,44 +4859,87 @@ int libfshfs_file_entry_get_sub_file_entry_by_utf16_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	result = libfshfs_file_system_get_directory_entry_by_utf16_name(
-	          internal_file_entry->file_system,
-	          internal_file_entry->io_handle,
-	          internal_file_entry->file_io_handle,
-	          internal_file_entry->parent_identifier,
-	          utf16_string,
-	          utf16_string_length,
-	          &sub_directory_entry,
-	          error );
+	if( ( internal_file_entry->sub_file_entries_page_size > 0 )
+	 && ( internal_file_entry->sub_directory_entries == NULL ) )
+	{
+		if( libfshfs_internal_file_entry_get_sub_directory_entry_from_page(
+		     internal_file_entry,
+		     sub_file_entry_index,
+		     &sub_directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub directory entry: %d from page.",
+			 function,
+			 sub_file_entry_index );
 
-	if( result == -1 )
+			result = -1;
+		}
+	}
+	else if( libfshfs_internal_file_entry_get_sub_directory_entries(
+	          internal_file_entry,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve directory entry.",
+		 "%s: unable to retrieve sub directory entries.",
 		 function );
 
 		result = -1;
 	}
-	else if( result != 0 )
+	else if( libcdata_array_get_entry_by_index(
+	          internal_file_entry->sub_directory_entries,
+	          sub_file_entry_index,
+	          (intptr_t **) &sub_directory_entry,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub directory entry: %d.",
+		 function,
+		 sub_file_entry_index );
+
+		result = -1;
+	}
+	if( result != -1 )
 	{
+		if( libfshfs_directory_entry_clone(
+		          &safe_directory_entry,
+		          sub_directory_entry,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to clone sub directory entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			result = -1;
+		}
 		/* libfshfs_file_entry_initialize takes over management of sub_directory_entry
 		 */
-		if( libfshfs_file_entry_initialize(
-		     sub_file_entry,
-		     internal_file_entry->io_handle,
-		     internal_file_entry->file_io_handle,
-		     internal_file_entry->file_system,
-		     sub_directory_entry,
-		     error ) != 1 )
+		else if( libfshfs_file_entry_initialize(
+		          sub_file_entry,
+		          internal_file_entry->io_handle,
+		          internal_file_entry->file_io_handle,
+		          internal_file_entry->file_system,
+		          safe_directory_entry,
+		          error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -4786,14 +4949,14 @@ int libfshfs_file_entry_get_sub_file_entry_by_utf16_name(
 			 function );
 
 			libfshfs_directory_entry_free(
-			 &sub_directory_entry,
+			 &safe_directory_entry,
 			 NULL );
 
 			result = -1;
 		}
 	}
 #if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -4801,7 +4964,7 @@ int libfshfs_file_entry_get_sub_file_entry_by_utf16_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
@@ -4810,18 +4973,20 @@ int libfshfs_file_entry_get_sub_file_entry_by_utf16_name(
 	return( result );
 }
 
-/* Reads data at the current offset
- * Returns the number of bytes read or -1 on error
+/* Retrieves the sub file entry for an UTF-8 encoded name
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
  */
-ssize_t libfshfs_file_entry_read_buffer(
-         libfshfs_file_entry_t *file_entry,
-         void *buffer,
-         size_t buffer_size,
-         libcerror_error_t **error )
+int libfshfs_file_entry_get_sub_file_entry_by_utf8_name(
+     libfshfs_file_entry_t *file_entry,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfshfs_file_entry_t **sub_file_entry,
+     libcerror_error_t **error )
 {
+	libfshfs_directory_entry_t *sub_directory_entry     = NULL;
 	libfshfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                               = "libfshfs_file_entry_read_buffer";
-	ssize_t read_count                                  = 0;
+	static char *function                               = "libfshfs_file_entry_get_sub_file_entry_by_utf8_name";
+	int result                                          = 1;
 
 	if( file_entry == NULL )
 	{
@@ -4836,19 +5001,30 @@ ssize_t libfshfs_file_entry_read_buffer(
 	}
 	internal_file_entry = (libfshfs_internal_file_entry_t *) file_entry;
 
-	if( ( internal_file_entry->file_mode & 0xf000 ) != LIBFSHFS_FILE_TYPE_REGULAR_FILE )
+	if( sub_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sub_file_entry != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid file entry - unsupported file mode not a regular file.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sub file entry value already set.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -4856,52 +5032,61 @@ ssize_t libfshfs_file_entry_read_buffer(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( internal_file_entry->data_stream == NULL )
-	{
-		if( libfshfs_internal_file_entry_get_data_stream(
-		     internal_file_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve data stream.",
-			 function );
+	result = libfshfs_file_system_get_directory_entry_by_utf8_name(
+	          internal_file_entry->file_system,
+	          internal_file_entry->io_handle,
+	          internal_file_entry->file_io_handle,
+	          internal_file_entry->parent_identifier,
+	          utf8_string,
+	          utf8_string_length,
+	          &sub_directory_entry,
+	          error );
 
-			read_count = -1;
-		}
-	}
-	if( internal_file_entry->data_stream != NULL )
+	if( result == -1 )
 	{
-		read_count = libfdata_stream_read_buffer(
-		              internal_file_entry->data_stream,
-		              (intptr_t *) internal_file_entry->file_io_handle,
-		              buffer,
-		              buffer_size,
-		              0,
-		              error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entry.",
+		 function );
 
-		if( read_count < 0 )
+		result = -1;
+	}
+	else if( result != 0 )
+	{
+		/* libfshfs_file_entry_initialize takes over management of sub_directory_entry
+		 */
+		if( libfshfs_file_entry_initialize(
+		     sub_file_entry,
+		     internal_file_entry->io_handle,
+		     internal_file_entry->file_io_handle,
+		     internal_file_entry->file_system,
+		     sub_directory_entry,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read from data stream.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file entry.",
 			 function );
 
-			read_count = -1;
+			libfshfs_directory_entry_free(
+			 &sub_directory_entry,
+			 NULL );
+
+			result = -1;
 		}
 	}
 #if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -4909,28 +5094,29 @@ ssize_t libfshfs_file_entry_read_buffer(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	return( read_count );
+	return( result );
 }
 
-/* Reads data at a specific offset
- * Returns the number of bytes read or -1 on error
+/* Retrieves the sub file entry for an UTF-16 encoded name
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
  */
-ssize_t libfshfs_file_entry_read_buffer_at_offset(
-         libfshfs_file_entry_t *file_entry,
-         void *buffer,
-         size_t buffer_size,
-         off64_t offset,
-         libcerror_error_t **error )
+int libfshfs_file_entry_get_sub_file_entry_by_utf16_name(
+     libfshfs_file_entry_t *file_entry,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libfshfs_file_entry_t **sub_file_entry,
+     libcerror_error_t **error )
 {
+	libfshfs_directory_entry_t *sub_directory_entry     = NULL;
 	libfshfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                               = "libfshfs_file_entry_read_buffer_at_offset";
-	ssize_t read_count                                  = 0;
+	static char *function                               = "libfshfs_file_entry_get_sub_file_entry_by_utf16_name";
+	int result                                          = 1;
 
 	if( file_entry == NULL )
 	{
@@ -4945,19 +5131,30 @@ ssize_t libfshfs_file_entry_read_buffer_at_offset(
 	}
 	internal_file_entry = (libfshfs_internal_file_entry_t *) file_entry;
 
-	if( ( internal_file_entry->file_mode & 0xf000 ) != LIBFSHFS_FILE_TYPE_REGULAR_FILE )
+	if( sub_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sub_file_entry != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid file entry - unsupported file mode not a regular file.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sub file entry value already set.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -4965,15 +5162,2249 @@ ssize_t libfshfs_file_entry_read_buffer_at_offset(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( internal_file_entry->data_stream == NULL )
+	result = libfshfs_file_system_get_directory_entry_by_utf16_name(
+	          internal_file_entry->file_system,
+	          internal_file_entry->io_handle,
+	          internal_file_entry->file_io_handle,
+	          internal_file_entry->parent_identifier,
+	          utf16_string,
+	          utf16_string_length,
+	          &sub_directory_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entry.",
+		 function );
+
+		result = -1;
+	}
+	else if( result != 0 )
+	{
+		/* libfshfs_file_entry_initialize takes over management of sub_directory_entry
+		 */
+		if( libfshfs_file_entry_initialize(
+		     sub_file_entry,
+		     internal_file_entry->io_handle,
+		     internal_file_entry->file_io_handle,
+		     internal_file_entry->file_system,
+		     sub_directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file entry.",
+			 function );
+
+			libfshfs_directory_entry_free(
+			 &sub_directory_entry,
+			 NULL );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the sub directory entries
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_internal_file_entry_get_sub_directory_entries(
+     libfshfs_internal_file_entry_t *internal_file_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_internal_file_entry_get_sub_directory_entries";
+
+	if( internal_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file_entry->sub_directory_entries == NULL )
+	{
+		if( internal_file_entry->sub_directory_entries_memory_arena == NULL )
+		{
+			if( libfshfs_memory_arena_initialize(
+			     &( internal_file_entry->sub_directory_entries_memory_arena ),
+			     LIBFSHFS_MEMORY_ARENA_CHUNK_SIZE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create sub directory entries memory arena.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libfshfs_file_system_get_directory_entries(
+		     internal_file_entry->file_system,
+		     internal_file_entry->io_handle,
+		     internal_file_entry->file_io_handle,
+		     internal_file_entry->identifier,
+		     internal_file_entry->sub_directory_entries_memory_arena,
+		     &( internal_file_entry->sub_directory_entries ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub directory entries for entry: %" PRIu32 " from file system.",
+			 function,
+			 internal_file_entry->identifier );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( internal_file_entry->sub_directory_entries_memory_arena != NULL )
+	{
+		libfshfs_memory_arena_free(
+		 &( internal_file_entry->sub_directory_entries_memory_arena ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the stat values of the indirect node file of a hard link
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_internal_file_entry_get_indirect_node_stat(
+     libfshfs_internal_file_entry_t *internal_file_entry,
+     uint32_t link_reference,
+     libfshfs_file_entry_stat_t *stat_value,
+     libcerror_error_t **error )
+{
+	libfshfs_directory_entry_t *indirect_node_directory_entry = NULL;
+	libfshfs_fork_descriptor_t *fork_descriptor               = NULL;
+	static char *function                                     = "libfshfs_internal_file_entry_get_indirect_node_stat";
+	int result                                                = 0;
+
+	if( internal_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( stat_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stat value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfshfs_file_system_get_indirect_node_directory_entry_by_identifier(
+	     internal_file_entry->file_system,
+	     internal_file_entry->io_handle,
+	     internal_file_entry->file_io_handle,
+	     link_reference,
+	     &indirect_node_directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve indirect node directory entry: %" PRIu32 ".",
+		 function,
+		 link_reference );
+
+		goto on_error;
+	}
+	stat_value->identifier = link_reference;
+
+	if( libfshfs_directory_entry_get_special_permissions(
+	     indirect_node_directory_entry,
+	     &( stat_value->number_of_links ),
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve special permissions from indirect node directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfshfs_directory_entry_get_creation_time(
+	     indirect_node_directory_entry,
+	     &( stat_value->creation_time ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve creation time from indirect node directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfshfs_directory_entry_get_modification_time(
+	     indirect_node_directory_entry,
+	     &( stat_value->modification_time ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve modification time from indirect node directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfshfs_directory_entry_get_entry_modification_time(
+	     indirect_node_directory_entry,
+	     &( stat_value->entry_modification_time ),
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry modification time from indirect node directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfshfs_directory_entry_get_access_time(
+	     indirect_node_directory_entry,
+	     &( stat_value->access_time ),
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve access time from indirect node directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfshfs_directory_entry_get_file_mode(
+	     indirect_node_directory_entry,
+	     &( stat_value->file_mode ),
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file mode from indirect node directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfshfs_directory_entry_get_owner_identifier(
+	     indirect_node_directory_entry,
+	     &( stat_value->owner_identifier ),
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve owner identifier from indirect node directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfshfs_directory_entry_get_group_identifier(
+	     indirect_node_directory_entry,
+	     &( stat_value->group_identifier ),
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve group identifier from indirect node directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	stat_value->data_fork_size     = 0;
+	stat_value->resource_fork_size = 0;
+
+	result = libfshfs_directory_entry_get_data_fork_descriptor(
+	          indirect_node_directory_entry,
+	          &fork_descriptor,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data fork descriptor from indirect node directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	else if( ( result != 0 )
+	      && ( fork_descriptor != NULL ) )
+	{
+		stat_value->data_fork_size = fork_descriptor->size;
+	}
+	result = libfshfs_directory_entry_get_resource_fork_descriptor(
+	          indirect_node_directory_entry,
+	          &fork_descriptor,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve resource fork descriptor from indirect node directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	else if( ( result != 0 )
+	      && ( fork_descriptor != NULL ) )
+	{
+		stat_value->resource_fork_size = fork_descriptor->size;
+	}
+	if( libfshfs_directory_entry_free(
+	     &indirect_node_directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free indirect node directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( indirect_node_directory_entry != NULL )
+	{
+		libfshfs_directory_entry_free(
+		 &indirect_node_directory_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Adds the size of the UTF-8 encoded name of a sub catalog record to the names size
+ * and increments the number of sub catalog records
+ * Callback function for libfshfs_file_system_iterate_sub_catalog_records
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_internal_file_entry_add_sub_utf8_name_size(
+     libfshfs_catalog_btree_key_t *node_key,
+     const libfshfs_file_entry_stat_t *stat_value LIBFSHFS_ATTRIBUTE_UNUSED,
+     uint32_t link_reference LIBFSHFS_ATTRIBUTE_UNUSED,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libfshfs_internal_file_entry_stat_values_t *sub_stat_values = NULL;
+	static char *function                                        = "libfshfs_internal_file_entry_add_sub_utf8_name_size";
+	size_t utf8_name_size                                        = 0;
+
+	LIBFSHFS_UNREFERENCED_PARAMETER( stat_value )
+	LIBFSHFS_UNREFERENCED_PARAMETER( link_reference )
+
+	if( node_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog B-tree key.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback data.",
+		 function );
+
+		return( -1 );
+	}
+	sub_stat_values = (libfshfs_internal_file_entry_stat_values_t *) callback_data;
+
+	if( sub_stat_values->stat_value_index >= INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of stat values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfshfs_name_get_utf8_string_size(
+	     node_key->name_data,
+	     (size_t) node_key->name_size,
+	     node_key->codepage,
+	     &utf8_name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 name size.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_name_size > ( (size_t) UINT32_MAX - sub_stat_values->utf8_names_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 names size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	sub_stat_values->utf8_names_offset += utf8_name_size;
+
+	sub_stat_values->stat_value_index++;
+
+	return( 1 );
+}
+
+/* Sets the stat values and UTF-8 encoded name of a sub catalog record
+ * Callback function for libfshfs_file_system_iterate_sub_catalog_records
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_internal_file_entry_set_sub_stat_value(
+     libfshfs_catalog_btree_key_t *node_key,
+     const libfshfs_file_entry_stat_t *stat_value,
+     uint32_t link_reference,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libfshfs_file_entry_stat_t *safe_stat_value                  = NULL;
+	libfshfs_internal_file_entry_stat_values_t *sub_stat_values = NULL;
+	static char *function                                        = "libfshfs_internal_file_entry_set_sub_stat_value";
+	size_t utf8_name_size                                        = 0;
+
+	if( node_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog B-tree key.",
+		 function );
+
+		return( -1 );
+	}
+	if( stat_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stat value.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback data.",
+		 function );
+
+		return( -1 );
+	}
+	sub_stat_values = (libfshfs_internal_file_entry_stat_values_t *) callback_data;
+
+	if( sub_stat_values->stat_value_index >= sub_stat_values->number_of_stat_values )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid number of stat values value too small.",
+		 function );
+
+		return( -1 );
+	}
+	safe_stat_value = &( sub_stat_values->stat_values[ sub_stat_values->stat_value_index ] );
+
+	if( memory_copy(
+	     safe_stat_value,
+	     stat_value,
+	     sizeof( libfshfs_file_entry_stat_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy stat value.",
+		 function );
+
+		return( -1 );
+	}
+	/* Hard links store their values in the indirect node file
+	 */
+	if( link_reference > 2 )
+	{
+		if( libfshfs_internal_file_entry_get_indirect_node_stat(
+		     sub_stat_values->internal_file_entry,
+		     link_reference,
+		     safe_stat_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve stat values of indirect node: %" PRIu32 ".",
+			 function,
+			 link_reference );
+
+			return( -1 );
+		}
+	}
+	if( libfshfs_name_get_utf8_string_size(
+	     node_key->name_data,
+	     (size_t) node_key->name_size,
+	     node_key->codepage,
+	     &utf8_name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 name size.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_name_size > ( sub_stat_values->utf8_names_size - sub_stat_values->utf8_names_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid UTF-8 names size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfshfs_name_get_utf8_string(
+	     node_key->name_data,
+	     (size_t) node_key->name_size,
+	     node_key->codepage,
+	     &( sub_stat_values->utf8_names[ sub_stat_values->utf8_names_offset ] ),
+	     utf8_name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 name.",
+		 function );
+
+		return( -1 );
+	}
+	safe_stat_value->name_offset = (uint32_t) sub_stat_values->utf8_names_offset;
+	safe_stat_value->name_size   = (uint32_t) utf8_name_size;
+
+	sub_stat_values->utf8_names_offset += utf8_name_size;
+
+	sub_stat_values->stat_value_index++;
+
+	return( 1 );
+}
+
+/* Retrieves the number of sub file entries and the size of their UTF-8 encoded names
+ * The size includes the end of string character of each name
+ * Both values are determined in a single pass over the catalog records
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_file_entry_get_sub_file_entries_utf8_names_size(
+     libfshfs_file_entry_t *file_entry,
+     int *number_of_sub_file_entries,
+     size_t *utf8_names_size,
+     libcerror_error_t **error )
+{
+	libfshfs_internal_file_entry_stat_values_t sub_stat_values;
+
+	libfshfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfshfs_file_entry_get_sub_file_entries_utf8_names_size";
+	int result                                          = 1;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfshfs_internal_file_entry_t *) file_entry;
+
+	if( number_of_sub_file_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of sub file entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_names_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 names size.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &sub_stat_values,
+	     0,
+	     sizeof( libfshfs_internal_file_entry_stat_values_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear sub stat values.",
+		 function );
+
+		return( -1 );
+	}
+	sub_stat_values.internal_file_entry = internal_file_entry;
+
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfshfs_file_system_iterate_sub_catalog_records(
+	     internal_file_entry->file_system,
+	     internal_file_entry->io_handle,
+	     internal_file_entry->file_io_handle,
+	     internal_file_entry->identifier,
+	     &libfshfs_internal_file_entry_add_sub_utf8_name_size,
+	     (void *) &sub_stat_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number and UTF-8 names size of sub catalog records.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == 1 )
+	{
+		*number_of_sub_file_entries = sub_stat_values.stat_value_index;
+		*utf8_names_size            = sub_stat_values.utf8_names_offset;
+	}
+	return( result );
+}
+
+/* Retrieves the stat values of all the sub file entries
+ * The stat values are read directly from the directory and file records in the catalog
+ * The stat values array must contain at least the number of sub file entries
+ * The UTF-8 encoded names are stored, including an end of string character,
+ * in the names buffer and the stat values contain their offset and size
+ * Use libfshfs_file_entry_get_sub_file_entries_utf8_names_size to determine
+ * the number of stat values and the size of the names buffer
+ * The number of stat values filled is set to the number of sub file entries retrieved
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_file_entry_get_sub_file_entries_stat(
+     libfshfs_file_entry_t *file_entry,
+     libfshfs_file_entry_stat_t *stat_values,
+     int number_of_stat_values,
+     uint8_t *utf8_names,
+     size_t utf8_names_size,
+     int *number_of_stat_values_filled,
+     libcerror_error_t **error )
+{
+	libfshfs_internal_file_entry_stat_values_t sub_stat_values;
+
+	libfshfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfshfs_file_entry_get_sub_file_entries_stat";
+	int result                                          = 1;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfshfs_internal_file_entry_t *) file_entry;
+
+	if( stat_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stat values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_stat_values < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of stat values value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_names == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 names.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_names_size > (size_t) UINT32_MAX )
+	 || ( utf8_names_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 names size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_stat_values_filled == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of stat values filled.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &sub_stat_values,
+	     0,
+	     sizeof( libfshfs_internal_file_entry_stat_values_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear sub stat values.",
+		 function );
+
+		return( -1 );
+	}
+	sub_stat_values.internal_file_entry   = internal_file_entry;
+	sub_stat_values.stat_values           = stat_values;
+	sub_stat_values.number_of_stat_values = number_of_stat_values;
+	sub_stat_values.utf8_names            = utf8_names;
+	sub_stat_values.utf8_names_size       = utf8_names_size;
+
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfshfs_file_system_iterate_sub_catalog_records(
+	     internal_file_entry->file_system,
+	     internal_file_entry->io_handle,
+	     internal_file_entry->file_io_handle,
+	     internal_file_entry->identifier,
+	     &libfshfs_internal_file_entry_set_sub_stat_value,
+	     (void *) &sub_stat_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve stat values of sub catalog records.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == 1 )
+	{
+		*number_of_stat_values_filled = sub_stat_values.stat_value_index;
+	}
+	return( result );
+}
+
+/* Reads data at the current offset
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfshfs_file_entry_read_buffer(
+         libfshfs_file_entry_t *file_entry,
+         void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libfshfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfshfs_file_entry_read_buffer";
+	ssize_t read_count                                  = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfshfs_internal_file_entry_t *) file_entry;
+
+	if( ( internal_file_entry->file_mode & 0xf000 ) != LIBFSHFS_FILE_TYPE_REGULAR_FILE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid file entry - unsupported file mode not a regular file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file_entry->data_stream == NULL )
+	{
+		if( libfshfs_internal_file_entry_get_data_stream(
+		     internal_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data stream.",
+			 function );
+
+			read_count = -1;
+		}
+	}
+	if( internal_file_entry->data_stream != NULL )
+	{
+		read_count = libfdata_stream_read_buffer(
+		              internal_file_entry->data_stream,
+		              (intptr_t *) internal_file_entry->file_io_handle,
+		              buffer,
+		              buffer_size,
+		              0,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from data stream.",
+			 function );
+
+			read_count = -1;
+		}
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+}
+
+/* Determines the data stream of a regular file if not already determined
+ * The data stream is determined with the file IO handle of the file entry
+ * so that subsequent reads only need the file IO handle to read the data
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_internal_file_entry_determine_data_stream(
+     libfshfs_internal_file_entry_t *internal_file_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_internal_file_entry_determine_data_stream";
+	int result            = 1;
+
+	if( internal_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	/* Reading data of other file types fails when the data is read
+	 */
+	if( ( internal_file_entry->file_mode & 0xf000 ) != LIBFSHFS_FILE_TYPE_REGULAR_FILE )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file_entry->data_stream == NULL )
+	{
+		if( libfshfs_internal_file_entry_get_data_stream(
+		     internal_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data stream.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads data at a specific offset using a specific file IO handle
+ * If not already determined the data stream is determined with the file IO
+ * handle of the file entry
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfshfs_internal_file_entry_read_buffer_at_offset(
+         libfshfs_internal_file_entry_t *internal_file_entry,
+         libbfio_handle_t *file_io_handle,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libfshfs_internal_file_entry_read_buffer_at_offset";
+	ssize_t read_count    = 0;
+
+	if( internal_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file_entry->file_mode & 0xf000 ) != LIBFSHFS_FILE_TYPE_REGULAR_FILE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid file entry - unsupported file mode not a regular file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file_entry->data_stream == NULL )
+	{
+		if( libfshfs_internal_file_entry_get_data_stream(
+		     internal_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data stream.",
+			 function );
+
+			read_count = -1;
+		}
+	}
+	if( internal_file_entry->data_stream != NULL )
+	{
+		read_count = libfdata_stream_read_buffer_at_offset(
+		              internal_file_entry->data_stream,
+		              (intptr_t *) file_io_handle,
+		              buffer,
+		              buffer_size,
+		              offset,
+		              0,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from data stream at offset: %" PRIi64 "(0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			read_count = -1;
+		}
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+}
+
+/* Reads data at a specific offset
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfshfs_file_entry_read_buffer_at_offset(
+         libfshfs_file_entry_t *file_entry,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libfshfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfshfs_file_entry_read_buffer_at_offset";
+	ssize_t read_count                                  = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfshfs_internal_file_entry_t *) file_entry;
+
+	read_count = libfshfs_internal_file_entry_read_buffer_at_offset(
+	              internal_file_entry,
+	              internal_file_entry->file_io_handle,
+	              buffer,
+	              buffer_size,
+	              offset,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Reads sorted ranges of data
+ * Ranges that overlap or are separated by a small gap are coalesced into
+ * a single read of the data stream
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_internal_file_entry_read_ranges(
+     libfshfs_internal_file_entry_t *internal_file_entry,
+     libfshfs_read_range_t *read_ranges,
+     int number_of_ranges,
+     ssize_t *read_counts,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation    = NULL;
+	uint8_t *span_data       = NULL;
+	static char *function    = "libfshfs_internal_file_entry_read_ranges";
+	size_t range_data_offset = 0;
+	size_t read_size         = 0;
+	size_t span_data_size    = 0;
+	size_t span_size         = 0;
+	ssize_t read_count       = 0;
+	off64_t span_offset      = 0;
+	int first_range_index    = 0;
+	int last_range_index     = 0;
+	int range_index          = 0;
+
+	if( internal_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file_entry->data_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing data stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_ranges == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read ranges.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_ranges < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of ranges value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_counts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read counts.",
+		 function );
+
+		return( -1 );
+	}
+	while( first_range_index < number_of_ranges )
+	{
+		if( libfshfs_read_range_get_span(
+		     read_ranges,
+		     number_of_ranges,
+		     first_range_index,
+		     &last_range_index,
+		     &span_offset,
+		     &span_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine span of range: %d.",
+			 function,
+			 first_range_index );
+
+			goto on_error;
+		}
+		if( last_range_index == first_range_index )
+		{
+			read_count = 0;
+
+			if( read_ranges[ first_range_index ].size > 0 )
+			{
+				read_count = libfdata_stream_read_buffer_at_offset(
+				              internal_file_entry->data_stream,
+				              (intptr_t *) internal_file_entry->file_io_handle,
+				              read_ranges[ first_range_index ].buffer,
+				              read_ranges[ first_range_index ].size,
+				              span_offset,
+				              0,
+				              error );
+
+				if( read_count < 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read from data stream at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+					 function,
+					 span_offset,
+					 span_offset );
+
+					goto on_error;
+				}
+			}
+			read_counts[ read_ranges[ first_range_index ].index ] = read_count;
+		}
+		else
+		{
+			if( span_size > span_data_size )
+			{
+				reallocation = (uint8_t *) memory_reallocate(
+				                span_data,
+				                sizeof( uint8_t ) * span_size );
+
+				if( reallocation == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to resize span data.",
+					 function );
+
+					goto on_error;
+				}
+				span_data      = reallocation;
+				span_data_size = span_size;
+			}
+			read_count = libfdata_stream_read_buffer_at_offset(
+			              internal_file_entry->data_stream,
+			              (intptr_t *) internal_file_entry->file_io_handle,
+			              span_data,
+			              span_size,
+			              span_offset,
+			              0,
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read from data stream at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 span_offset,
+				 span_offset );
+
+				goto on_error;
+			}
+			for( range_index = first_range_index;
+			     range_index <= last_range_index;
+			     range_index++ )
+			{
+				range_data_offset = (size_t) ( read_ranges[ range_index ].offset - span_offset );
+				read_size         = 0;
+
+				if( range_data_offset < (size_t) read_count )
+				{
+					read_size = (size_t) read_count - range_data_offset;
+
+					if( read_size > read_ranges[ range_index ].size )
+					{
+						read_size = read_ranges[ range_index ].size;
+					}
+				}
+				if( read_size > 0 )
+				{
+					if( memory_copy(
+					     read_ranges[ range_index ].buffer,
+					     &( span_data[ range_data_offset ] ),
+					     read_size ) == NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_MEMORY,
+						 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+						 "%s: unable to copy range: %d data.",
+						 function,
+						 read_ranges[ range_index ].index );
+
+						goto on_error;
+					}
+				}
+				read_counts[ read_ranges[ range_index ].index ] = (ssize_t) read_size;
+			}
+		}
+		first_range_index = last_range_index + 1;
+	}
+	if( span_data != NULL )
+	{
+		memory_free(
+		 span_data );
+	}
+	return( 1 );
+
+on_error:
+	if( span_data != NULL )
+	{
+		memory_free(
+		 span_data );
+	}
+	return( -1 );
+}
+
+/* Reads data of multiple ranges at specific offsets
+ * The ranges are read in order of offset and nearby ranges are coalesced,
+ * so that the data is read with the fewest number of reads
+ * The number of bytes read for each range is stored in read_counts, which
+ * is less than the size of the range if the range extends beyond the end of the data
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_file_entry_read_buffers_at_offsets(
+     libfshfs_file_entry_t *file_entry,
+     const off64_t *offsets,
+     const size_t *sizes,
+     uint8_t **buffers,
+     int number_of_ranges,
+     ssize_t *read_counts,
+     libcerror_error_t **error )
+{
+	libfshfs_internal_file_entry_t *internal_file_entry = NULL;
+	libfshfs_read_range_t *read_ranges                  = NULL;
+	static char *function                               = "libfshfs_file_entry_read_buffers_at_offsets";
+	int range_index                                     = 0;
+	int result                                          = 1;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfshfs_internal_file_entry_t *) file_entry;
+
+	if( ( internal_file_entry->file_mode & 0xf000 ) != LIBFSHFS_FILE_TYPE_REGULAR_FILE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid file entry - unsupported file mode not a regular file.",
+		 function );
+
+		return( -1 );
+	}
+	if( offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_counts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read counts.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_ranges < 0 )
+	 || ( (size_t) number_of_ranges > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfshfs_read_range_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of ranges value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		if( offsets[ range_index ] < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid range: %d offset value out of bounds.",
+			 function,
+			 range_index );
+
+			return( -1 );
+		}
+		if( sizes[ range_index ] > (size_t) SSIZE_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid range: %d size value exceeds maximum.",
+			 function,
+			 range_index );
+
+			return( -1 );
+		}
+		if( sizes[ range_index ] > (size64_t) ( INT64_MAX - offsets[ range_index ] ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid range: %d size value out of bounds.",
+			 function,
+			 range_index );
+
+			return( -1 );
+		}
+		if( ( sizes[ range_index ] > 0 )
+		 && ( buffers[ range_index ] == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid range: %d buffer.",
+			 function,
+			 range_index );
+
+			return( -1 );
+		}
+	}
+	if( number_of_ranges == 0 )
+	{
+		return( 1 );
+	}
+	read_ranges = (libfshfs_read_range_t *) memory_allocate(
+	                                         sizeof( libfshfs_read_range_t ) * number_of_ranges );
+
+	if( read_ranges == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read ranges.",
+		 function );
+
+		return( -1 );
+	}
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		read_ranges[ range_index ].offset = offsets[ range_index ];
+		read_ranges[ range_index ].size   = sizes[ range_index ];
+		read_ranges[ range_index ].buffer = buffers[ range_index ];
+		read_ranges[ range_index ].index  = range_index;
+
+		read_counts[ range_index ] = 0;
+	}
+	qsort(
+	 read_ranges,
+	 (size_t) number_of_ranges,
+	 sizeof( libfshfs_read_range_t ),
+	 (int (*)(const void *, const void *)) &libfshfs_read_range_compare_by_offset );
+
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		memory_free(
+		 read_ranges );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file_entry->data_stream == NULL )
+	{
+		if( libfshfs_internal_file_entry_get_data_stream(
+		     internal_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data stream.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file_entry->data_stream != NULL )
+	{
+		if( libfshfs_internal_file_entry_read_ranges(
+		     internal_file_entry,
+		     read_ranges,
+		     number_of_ranges,
+		     read_counts,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read ranges.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		memory_free(
+		 read_ranges );
+
+		return( -1 );
+	}
+#endif
+	memory_free(
+	 read_ranges );
+
+	return( result );
+}
+
+/* Seeks a certain offset in the data
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t libfshfs_file_entry_seek_offset(
+         libfshfs_file_entry_t *file_entry,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	libfshfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                                = "libfshfs_file_entry_seek_offset";
+	off64_t result_offset                                = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfshfs_internal_file_entry_t *) file_entry;
+
+	if( ( internal_file_entry->file_mode & 0xf000 ) != LIBFSHFS_FILE_TYPE_REGULAR_FILE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid file entry - unsupported file mode not a regular file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file_entry->data_stream == NULL )
+	{
+		if( libfshfs_internal_file_entry_get_data_stream(
+		     internal_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data stream.",
+			 function );
+
+			result_offset = -1;
+		}
+	}
+	if( internal_file_entry->data_stream != NULL )
+	{
+		result_offset = libfdata_stream_seek_offset(
+		                 internal_file_entry->data_stream,
+		                 offset,
+		                 whence,
+		                 error );
+
+		if( result_offset == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek offset in data stream.",
+			 function );
+
+			result_offset = -1;
+		}
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result_offset );
+}
+
+/* Retrieves the current offset of the data
+ * Returns the offset if successful or -1 on error
+ */
+int libfshfs_file_entry_get_offset(
+     libfshfs_file_entry_t *file_entry,
+     off64_t *offset,
+     libcerror_error_t **error )
+{
+	libfshfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfshfs_file_entry_get_offset";
+	int result                                          = 1;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfshfs_internal_file_entry_t *) file_entry;
+
+	if( ( internal_file_entry->file_mode & 0xf000 ) != LIBFSHFS_FILE_TYPE_REGULAR_FILE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid file entry - unsupported file mode not a regular file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file_entry->data_stream == NULL )
+	{
+		if( libfshfs_internal_file_entry_get_data_stream(
+		     internal_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data stream.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file_entry->data_stream != NULL )
+	{
+		if( libfdata_stream_get_offset(
+		     internal_file_entry->data_stream,
+		     offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve offset from data stream.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the data size
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_internal_file_entry_get_data_size(
+     libfshfs_internal_file_entry_t *internal_file_entry,
+     libcerror_error_t **error )
+{
+	libfshfs_directory_entry_t *directory_entry      = NULL;
+	libfshfs_fork_descriptor_t *data_fork_descriptor = NULL;
+	static char *function                            = "libfshfs_internal_file_entry_get_data_size";
+	size64_t data_size                               = 0;
+	uint8_t attributes_index_flags                   = 0;
+	int result                                       = 0;
+
+	if( internal_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file_entry->compressed_data_attribute_record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry - compressed data attribute record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file_entry->compressed_data_header != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry - compressed data header value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfshfs_internal_file_entry_get_directory_entry(
+	     internal_file_entry,
+	     &directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	result = libfshfs_directory_entry_get_data_fork_descriptor(
+	          directory_entry,
+	          &data_fork_descriptor,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data fork descriptor from directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( data_fork_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing data fork descriptor.",
+			 function );
+
+			goto on_error;
+		}
+		/* If the attributes index is available it is used to determine
+		 * if the file entry has a com.apple.decmpfs attribute
+		 */
+		result = libfshfs_file_system_get_attributes_index_flags(
+		          internal_file_entry->file_system,
+		          internal_file_entry->identifier,
+		          &attributes_index_flags,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve attributes index flags.",
+			 function );
+
+			goto on_error;
+		}
+		else if( ( result != 0 )
+		      && ( ( attributes_index_flags & LIBFSHFS_ATTRIBUTES_INDEX_FLAG_HAS_COMPRESSED_DATA ) == 0 ) )
+		{
+			result = 0;
+		}
+		else
+		{
+			result = libfshfs_internal_file_entry_get_attribute_record_by_utf8_name(
+			          internal_file_entry,
+			          (uint8_t *) "com.apple.decmpfs",
+			          17,
+			          &( internal_file_entry->compressed_data_attribute_record ),
+			          error );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve com.apple.decmpfs attribute record.",
+			 function );
+
+			result = -1;
+		}
+		else if( result != 0 )
+		{
+			if( libfshfs_compressed_data_header_initialize(
+			     &( internal_file_entry->compressed_data_header ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create compressed data header.",
+				 function );
+
+				goto on_error;
+			}
+			if( internal_file_entry->compressed_data_attribute_record->record_type != LIBFSHFS_ATTRIBUTE_RECORD_TYPE_INLINE_DATA )
+			{
+/* TODO add support for additional attribute record types */
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported com.apple.decmpfs attribute record type.",
+				 function );
+
+				goto on_error;
+			}
+			result = libfshfs_compressed_data_header_read_data(
+			          internal_file_entry->compressed_data_header,
+			          internal_file_entry->compressed_data_attribute_record->inline_data,
+			          internal_file_entry->compressed_data_attribute_record->inline_data_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read compressed data header.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				data_size = internal_file_entry->compressed_data_header->uncompressed_data_size;
+			}
+			else
+			{
+				if( libfshfs_compressed_data_header_free(
+				     &( internal_file_entry->compressed_data_header ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create compressed data header.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
+		if( result == 0 )
+		{
+			data_size = (size64_t) data_fork_descriptor->size;
+		}
+	}
+	internal_file_entry->data_size = data_size;
+
+	return( 1 );
+
+on_error:
+	if( internal_file_entry->compressed_data_header != NULL )
+	{
+		libfshfs_compressed_data_header_free(
+		 &( internal_file_entry->compressed_data_header ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the size of the data
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_file_entry_get_size(
+     libfshfs_file_entry_t *file_entry,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	libfshfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfshfs_file_entry_get_size";
+	int result                                          = 1;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfshfs_internal_file_entry_t *) file_entry;
+
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file_entry->data_size == (size64_t) -1 )
 	{
-		if( libfshfs_internal_file_entry_get_data_stream(
+		if( libfshfs_internal_file_entry_get_data_size(
 		     internal_file_entry,
 		     error ) != 1 )
 		{
@@ -4981,39 +7412,18 @@ ssize_t libfshfs_file_entry_read_buffer_at_offset(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve data stream.",
+			 "%s: unable to retrieve data size.",
 			 function );
 
-			read_count = -1;
+			result = -1;
 		}
 	}
-	if( internal_file_entry->data_stream != NULL )
+	if( result == 1 )
 	{
-		read_count = libfdata_stream_read_buffer_at_offset(
-		              internal_file_entry->data_stream,
-		              (intptr_t *) internal_file_entry->file_io_handle,
-		              buffer,
-		              buffer_size,
-		              offset,
-		              0,
-		              error );
-
-		if( read_count < 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read from data stream at offset: %" PRIi64 "(0x%08" PRIx64 ").",
-			 function,
-			 offset,
-			 offset );
-
-			read_count = -1;
-		}
+		*size = internal_file_entry->data_size;
 	}
 #if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -5021,27 +7431,26 @@ ssize_t libfshfs_file_entry_read_buffer_at_offset(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	return( read_count );
+	return( result );
 }
 
-/* Seeks a certain offset in the data
- * Returns the offset if seek is successful or -1 on error
+/* Retrieves the number of extents of the data
+ * Returns 1 if successful or -1 on error
  */
-off64_t libfshfs_file_entry_seek_offset(
-         libfshfs_file_entry_t *file_entry,
-         off64_t offset,
-         int whence,
-         libcerror_error_t **error )
+int libfshfs_file_entry_get_number_of_extents(
+     libfshfs_file_entry_t *file_entry,
+     int *number_of_extents,
+     libcerror_error_t **error )
 {
 	libfshfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                                = "libfshfs_file_entry_seek_offset";
-	off64_t result_offset                                = 0;
+	static char *function                               = "libfshfs_file_entry_get_number_of_extents";
+	int result                                           = 1;
 
 	if( file_entry == NULL )
 	{
@@ -5056,19 +7465,8 @@ off64_t libfshfs_file_entry_seek_offset(
 	}
 	internal_file_entry = (libfshfs_internal_file_entry_t *) file_entry;
 
-	if( ( internal_file_entry->file_mode & 0xf000 ) != LIBFSHFS_FILE_TYPE_REGULAR_FILE )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid file entry - unsupported file mode not a regular file.",
-		 function );
-
-		return( -1 );
-	}
 #if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -5076,7 +7474,7 @@ off64_t libfshfs_file_entry_seek_offset(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -5095,31 +7493,28 @@ off64_t libfshfs_file_entry_seek_offset(
 			 "%s: unable to retrieve data stream.",
 			 function );
 
-			result_offset = -1;
+			result = -1;
 		}
 	}
 	if( internal_file_entry->data_stream != NULL )
 	{
-		result_offset = libfdata_stream_seek_offset(
-		                 internal_file_entry->data_stream,
-		                 offset,
-		                 whence,
-		                 error );
-
-		if( result_offset == -1 )
+		if( libcdata_array_get_number_of_entries(
+		     internal_file_entry->extents_array,
+		     number_of_extents,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_SEEK_FAILED,
-			 "%s: unable to seek offset in data stream.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of extents from array.",
 			 function );
 
-			result_offset = -1;
+			result = -1;
 		}
 	}
 #if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -5127,25 +7522,29 @@ off64_t libfshfs_file_entry_seek_offset(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	return( result_offset );
+	return( result );
 }
 
-/* Retrieves the current offset of the data
- * Returns the offset if successful or -1 on error
+/* Retrieves a specific extent of the data
+ * Returns 1 if successful or -1 on error
  */
-int libfshfs_file_entry_get_offset(
+int libfshfs_file_entry_get_extent_by_index(
      libfshfs_file_entry_t *file_entry,
-     off64_t *offset,
+     int extent_index,
+     off64_t *extent_offset,
+     size64_t *extent_size,
+     uint32_t *extent_flags,
      libcerror_error_t **error )
 {
+	libfshfs_extent_t *extent                           = NULL;
 	libfshfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                               = "libfshfs_file_entry_get_offset";
+	static char *function                               = "libfshfs_file_entry_get_extent_by_index";
 	int result                                          = 1;
 
 	if( file_entry == NULL )
@@ -5161,17 +7560,6 @@ int libfshfs_file_entry_get_offset(
 	}
 	internal_file_entry = (libfshfs_internal_file_entry_t *) file_entry;
 
-	if( ( internal_file_entry->file_mode & 0xf000 ) != LIBFSHFS_FILE_TYPE_REGULAR_FILE )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid file entry - unsupported file mode not a regular file.",
-		 function );
-
-		return( -1 );
-	}
 #if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file_entry->read_write_lock,
@@ -5205,20 +7593,43 @@ int libfshfs_file_entry_get_offset(
 	}
 	if( internal_file_entry->data_stream != NULL )
 	{
-		if( libfdata_stream_get_offset(
-		     internal_file_entry->data_stream,
-		     offset,
+		if( libcdata_array_get_entry_by_index(
+		     internal_file_entry->extents_array,
+		     extent_index,
+		     (intptr_t **) &extent,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve offset from data stream.",
-			 function );
+			 "%s: unable to retrieve extent: %d from array.",
+			 function,
+			 extent_index );
 
 			result = -1;
 		}
+		if( result == 1 )
+		{
+			if( libfshfs_extent_get_values(
+			     extent,
+			     internal_file_entry->io_handle,
+			     extent_offset,
+			     extent_size,
+			     extent_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve extent: %d values.",
+				 function,
+				 extent_index );
+
+				result = -1;
+			}
+		}
 	}
 #if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
@@ -5238,18 +7649,27 @@ int libfshfs_file_entry_get_offset(
 	return( result );
 }
 
-/* Retrieves the data size
+/* Determines the read runs
+ * A read run maps a range of the data onto a range of the volume,
+ * where physically contiguous extents are combined into a single run and
+ * the runs are trimmed to the size of the data
+ * The read runs are determined once and cached on the file entry
  * Returns 1 if successful or -1 on error
  */
-int libfshfs_internal_file_entry_get_data_size(
+int libfshfs_internal_file_entry_determine_read_runs(
      libfshfs_internal_file_entry_t *internal_file_entry,
      libcerror_error_t **error )
 {
-	libfshfs_directory_entry_t *directory_entry      = NULL;
-	libfshfs_fork_descriptor_t *data_fork_descriptor = NULL;
-	static char *function                            = "libfshfs_internal_file_entry_get_data_size";
-	size64_t data_size                               = 0;
-	int result                                       = 0;
+	libfshfs_extent_t *extent     = NULL;
+	libfshfs_read_run_t *read_run = NULL;
+	static char *function         = "libfshfs_internal_file_entry_determine_read_runs";
+	size64_t extent_size          = 0;
+	off64_t extent_data_offset    = 0;
+	off64_t extent_offset         = 0;
+	uint32_t extent_flags         = 0;
+	int extent_index              = 0;
+	int number_of_extents         = 0;
+	int number_of_read_runs       = 0;
 
 	if( internal_file_entry == NULL )
 	{
@@ -5262,186 +7682,228 @@ int libfshfs_internal_file_entry_get_data_size(
 
 		return( -1 );
 	}
-	if( internal_file_entry->compressed_data_attribute_record != NULL )
+	if( internal_file_entry->compressed_data_header != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file entry - compressed data attribute record value already set.",
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid file entry - unsupported compressed data.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file_entry->compressed_data_header != NULL )
+	if( internal_file_entry->read_runs != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file entry - compressed data header value already set.",
+		 "%s: invalid file entry - read runs value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file_entry->extents_array,
+	     &number_of_extents,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of extents from array.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( number_of_extents < 0 )
+	 || ( (size_t) number_of_extents >= ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfshfs_read_run_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of extents value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* There is at most one read run per extent and a sparse run for the data beyond the last extent
+	 */
+	internal_file_entry->read_runs = (libfshfs_read_run_t *) memory_allocate(
+	                                                          sizeof( libfshfs_read_run_t ) * ( number_of_extents + 1 ) );
+
+	if( internal_file_entry->read_runs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read runs.",
 		 function );
 
-		return( -1 );
-	}
-	if( libfshfs_internal_file_entry_get_directory_entry(
-	     internal_file_entry,
-	     &directory_entry,
-	     error ) != 1 )
+		goto on_error;
+	}
+	for( extent_index = 0;
+	     extent_index < number_of_extents;
+	     extent_index++ )
+	{
+		if( (size64_t) extent_data_offset >= internal_file_entry->data_size )
+		{
+			break;
+		}
+		if( libcdata_array_get_entry_by_index(
+		     internal_file_entry->extents_array,
+		     extent_index,
+		     (intptr_t **) &extent,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent: %d from array.",
+			 function,
+			 extent_index );
+
+			goto on_error;
+		}
+		if( libfshfs_extent_get_values(
+		     extent,
+		     internal_file_entry->io_handle,
+		     &extent_offset,
+		     &extent_size,
+		     &extent_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent: %d values.",
+			 function,
+			 extent_index );
+
+			goto on_error;
+		}
+		if( extent_size > ( internal_file_entry->data_size - (size64_t) extent_data_offset ) )
+		{
+			extent_size = internal_file_entry->data_size - (size64_t) extent_data_offset;
+		}
+		if( ( read_run != NULL )
+		 && ( ( read_run->volume_offset + (off64_t) read_run->size ) == extent_offset ) )
+		{
+			read_run->size += extent_size;
+		}
+		else if( extent_size > 0 )
+		{
+			read_run = &( internal_file_entry->read_runs[ number_of_read_runs++ ] );
+
+			read_run->data_offset   = extent_data_offset;
+			read_run->volume_offset = extent_offset;
+			read_run->size          = extent_size;
+			read_run->flags         = 0;
+		}
+		extent_data_offset += (off64_t) extent_size;
+	}
+	/* Data beyond the last extent is read as zero bytes
+	 */
+	if( (size64_t) extent_data_offset < internal_file_entry->data_size )
+	{
+		read_run = &( internal_file_entry->read_runs[ number_of_read_runs++ ] );
+
+		read_run->data_offset   = extent_data_offset;
+		read_run->volume_offset = 0;
+		read_run->size          = internal_file_entry->data_size - (size64_t) extent_data_offset;
+		read_run->flags         = LIBFSHFS_EXTENT_FLAG_IS_SPARSE;
+	}
+	internal_file_entry->number_of_read_runs  = number_of_read_runs;
+	internal_file_entry->read_runs_determined = 1;
+
+	return( 1 );
+
+on_error:
+	if( internal_file_entry->read_runs != NULL )
+	{
+		memory_free(
+		 internal_file_entry->read_runs );
+
+		internal_file_entry->read_runs = NULL;
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of read runs
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_internal_file_entry_get_number_of_read_runs(
+     libfshfs_internal_file_entry_t *internal_file_entry,
+     int *number_of_read_runs,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_internal_file_entry_get_number_of_read_runs";
+
+	if( internal_file_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve directory entry.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	result = libfshfs_directory_entry_get_data_fork_descriptor(
-	          directory_entry,
-	          &data_fork_descriptor,
-	          error );
-
-	if( result == -1 )
+	if( number_of_read_runs == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve data fork descriptor from directory entry.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of read runs.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	else if( result != 0 )
+	if( internal_file_entry->read_runs_determined == 0 )
 	{
-		if( data_fork_descriptor == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing data fork descriptor.",
-			 function );
-
-			goto on_error;
-		}
-		result = libfshfs_internal_file_entry_get_attribute_record_by_utf8_name(
-		          internal_file_entry,
-		          (uint8_t *) "com.apple.decmpfs",
-		          17,
-		          &( internal_file_entry->compressed_data_attribute_record ),
-		          error );
-
-		if( result == -1 )
+		if( libfshfs_internal_file_entry_determine_read_runs(
+		     internal_file_entry,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve com.apple.decmpfs attribute record.",
+			 "%s: unable to determine read runs.",
 			 function );
 
-			result = -1;
-		}
-		else if( result != 0 )
-		{
-			if( libfshfs_compressed_data_header_initialize(
-			     &( internal_file_entry->compressed_data_header ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create compressed data header.",
-				 function );
-
-				goto on_error;
-			}
-			if( internal_file_entry->compressed_data_attribute_record->record_type != LIBFSHFS_ATTRIBUTE_RECORD_TYPE_INLINE_DATA )
-			{
-/* TODO add support for additional attribute record types */
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported com.apple.decmpfs attribute record type.",
-				 function );
-
-				goto on_error;
-			}
-			result = libfshfs_compressed_data_header_read_data(
-			          internal_file_entry->compressed_data_header,
-			          internal_file_entry->compressed_data_attribute_record->inline_data,
-			          internal_file_entry->compressed_data_attribute_record->inline_data_size,
-			          error );
-
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read compressed data header.",
-				 function );
-
-				goto on_error;
-			}
-			else if( result != 0 )
-			{
-				data_size = internal_file_entry->compressed_data_header->uncompressed_data_size;
-			}
-			else
-			{
-				if( libfshfs_compressed_data_header_free(
-				     &( internal_file_entry->compressed_data_header ),
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to create compressed data header.",
-					 function );
-
-					goto on_error;
-				}
-			}
-		}
-		if( result == 0 )
-		{
-			data_size = (size64_t) data_fork_descriptor->size;
+			return( -1 );
 		}
 	}
-	internal_file_entry->data_size = data_size;
+	*number_of_read_runs = internal_file_entry->number_of_read_runs;
 
 	return( 1 );
-
-on_error:
-	if( internal_file_entry->compressed_data_header != NULL )
-	{
-		libfshfs_compressed_data_header_free(
-		 &( internal_file_entry->compressed_data_header ),
-		 NULL );
-	}
-	return( -1 );
 }
 
-/* Retrieves the size of the data
+/* Retrieves a specific read run
  * Returns 1 if successful or -1 on error
  */
-int libfshfs_file_entry_get_size(
-     libfshfs_file_entry_t *file_entry,
+int libfshfs_internal_file_entry_get_read_run_by_index(
+     libfshfs_internal_file_entry_t *internal_file_entry,
+     int read_run_index,
+     off64_t *data_offset,
+     off64_t *volume_offset,
      size64_t *size,
+     uint32_t *flags,
      libcerror_error_t **error )
 {
-	libfshfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                               = "libfshfs_file_entry_get_size";
-	int result                                          = 1;
+	libfshfs_read_run_t *read_run = NULL;
+	static char *function         = "libfshfs_internal_file_entry_get_read_run_by_index";
 
-	if( file_entry == NULL )
+	if( internal_file_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -5452,8 +7914,28 @@ int libfshfs_file_entry_get_size(
 
 		return( -1 );
 	}
-	internal_file_entry = (libfshfs_internal_file_entry_t *) file_entry;
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume offset.",
+		 function );
 
+		return( -1 );
+	}
 	if( size == NULL )
 	{
 		libcerror_error_set(
@@ -5465,24 +7947,20 @@ int libfshfs_file_entry_get_size(
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file_entry->read_write_lock,
-	     error ) != 1 )
+	if( flags == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flags.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	if( internal_file_entry->data_size == (size64_t) -1 )
+	if( internal_file_entry->read_runs_determined == 0 )
 	{
-		if( libfshfs_internal_file_entry_get_data_size(
+		if( libfshfs_internal_file_entry_determine_read_runs(
 		     internal_file_entry,
 		     error ) != 1 )
 		{
@@ -5490,45 +7968,46 @@ int libfshfs_file_entry_get_size(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve data size.",
+			 "%s: unable to determine read runs.",
 			 function );
 
-			result = -1;
+			return( -1 );
 		}
 	}
-	if( result == 1 )
-	{
-		*size = internal_file_entry->data_size;
-	}
-#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file_entry->read_write_lock,
-	     error ) != 1 )
+	if( ( read_run_index < 0 )
+	 || ( read_run_index >= internal_file_entry->number_of_read_runs ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid read run index value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	return( result );
+	read_run = &( internal_file_entry->read_runs[ read_run_index ] );
+
+	*data_offset   = read_run->data_offset;
+	*volume_offset = read_run->volume_offset;
+	*size          = read_run->size;
+	*flags         = read_run->flags;
+
+	return( 1 );
 }
 
-/* Retrieves the number of extents of the data
+/* Retrieves the number of read runs of the data
+ * Read runs are only supported for data that is not compressed
  * Returns 1 if successful or -1 on error
  */
-int libfshfs_file_entry_get_number_of_extents(
+int libfshfs_file_entry_get_number_of_read_runs(
      libfshfs_file_entry_t *file_entry,
-     int *number_of_extents,
+     int *number_of_read_runs,
      libcerror_error_t **error )
 {
 	libfshfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                               = "libfshfs_file_entry_get_number_of_extents";
-	int result                                           = 1;
+	static char *function                               = "libfshfs_file_entry_get_number_of_read_runs";
+	int result                                          = 1;
 
 	if( file_entry == NULL )
 	{
@@ -5544,7 +8023,7 @@ int libfshfs_file_entry_get_number_of_extents(
 	internal_file_entry = (libfshfs_internal_file_entry_t *) file_entry;
 
 #if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -5552,7 +8031,7 @@ int libfshfs_file_entry_get_number_of_extents(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
@@ -5576,23 +8055,23 @@ int libfshfs_file_entry_get_number_of_extents(
 	}
 	if( internal_file_entry->data_stream != NULL )
 	{
-		if( libcdata_array_get_number_of_entries(
-		     internal_file_entry->extents_array,
-		     number_of_extents,
+		if( libfshfs_internal_file_entry_get_number_of_read_runs(
+		     internal_file_entry,
+		     number_of_read_runs,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of extents from array.",
+			 "%s: unable to retrieve number of read runs.",
 			 function );
 
 			result = -1;
 		}
 	}
 #if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -5600,7 +8079,7 @@ int libfshfs_file_entry_get_number_of_extents(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
@@ -5609,20 +8088,23 @@ int libfshfs_file_entry_get_number_of_extents(
 	return( result );
 }
 
-/* Retrieves a specific extent of the data
+/* Retrieves a specific read run of the data
+ * The data offset is relative to the start of the data and the volume offset
+ * relative to the start of the volume. The volume offset of a sparse read run is 0
+ * Read runs are only supported for data that is not compressed
  * Returns 1 if successful or -1 on error
  */
-int libfshfs_file_entry_get_extent_by_index(
+int libfshfs_file_entry_get_read_run_by_index(
      libfshfs_file_entry_t *file_entry,
-     int extent_index,
-     off64_t *extent_offset,
-     size64_t *extent_size,
-     uint32_t *extent_flags,
+     int read_run_index,
+     off64_t *data_offset,
+     off64_t *volume_offset,
+     size64_t *size,
+     uint32_t *flags,
      libcerror_error_t **error )
 {
-	libfshfs_extent_t *extent                           = NULL;
 	libfshfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                               = "libfshfs_file_entry_get_extent_by_index";
+	static char *function                               = "libfshfs_file_entry_get_read_run_by_index";
 	int result                                          = 1;
 
 	if( file_entry == NULL )
@@ -5639,7 +8121,7 @@ int libfshfs_file_entry_get_extent_by_index(
 	internal_file_entry = (libfshfs_internal_file_entry_t *) file_entry;
 
 #if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -5647,7 +8129,7 @@ int libfshfs_file_entry_get_extent_by_index(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
@@ -5671,46 +8153,28 @@ int libfshfs_file_entry_get_extent_by_index(
 	}
 	if( internal_file_entry->data_stream != NULL )
 	{
-		if( libcdata_array_get_entry_by_index(
-		     internal_file_entry->extents_array,
-		     extent_index,
-		     (intptr_t **) &extent,
+		if( libfshfs_internal_file_entry_get_read_run_by_index(
+		     internal_file_entry,
+		     read_run_index,
+		     data_offset,
+		     volume_offset,
+		     size,
+		     flags,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve extent: %d from array.",
+			 "%s: unable to retrieve read run: %d.",
 			 function,
-			 extent_index );
+			 read_run_index );
 
 			result = -1;
 		}
-		if( result == 1 )
-		{
-			if( libfshfs_extent_get_values(
-			     extent,
-			     internal_file_entry->io_handle,
-			     extent_offset,
-			     extent_size,
-			     extent_flags,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve extent: %d values.",
-				 function,
-				 extent_index );
-
-				result = -1;
-			}
-		}
 	}
 #if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -5718,7 +8182,7 @@ int libfshfs_file_entry_get_extent_by_index(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
@@ -26,7 +26,9 @@
 #include <types.h>
 
 #include "libfshfs_attribute_record.h"
+#include "libfshfs_catalog_btree_key.h"
 #include "libfshfs_compressed_data_header.h"
+#include "libfshfs_directory_entries_page.h"
 #include "libfshfs_directory_entry.h"
 #include "libfshfs_extern.h"
 #include "libfshfs_file_system.h"
@@ -36,6 +38,9 @@
 #include "libfshfs_libcerror.h"
 #include "libfshfs_libcthreads.h"
 #include "libfshfs_libfdata.h"
+#include "libfshfs_memory_arena.h"
+#include "libfshfs_read_range.h"
+#include "libfshfs_read_run.h"
 #include "libfshfs_types.h"
 
 #if defined( __cplusplus )
@@ -90,6 +95,26 @@ struct libfshfs_internal_file_entry
 	 */
 	libcdata_array_t *sub_directory_entries;
 
+	/* The memory arena the sub directory entries are allocated from
+	 */
+	libfshfs_memory_arena_t *sub_directory_entries_memory_arena;
+
+	/* The number of sub file entries per page, 0 if not paged
+	 */
+	int sub_file_entries_page_size;
+
+	/* The sub directory entries page
+	 */
+	libfshfs_directory_entries_page_t *sub_directory_entries_page;
+
+	/* The number of sub file entries in paged mode
+	 */
+	int number_of_sub_file_entries;
+
+	/* Value to indicate the number of sub file entries was determined
+	 */
+	uint8_t number_of_sub_file_entries_determined;
+
 	/* The data stream
 	 */
 	libfdata_stream_t *data_stream;
@@ -102,6 +127,18 @@ struct libfshfs_internal_file_entry
 	 */
 	libcdata_array_t *extents_array;
 
+	/* The read runs
+	 */
+	libfshfs_read_run_t *read_runs;
+
+	/* The number of read runs
+	 */
+	int number_of_read_runs;
+
+	/* Value to indicate the read runs were determined
+	 */
+	uint8_t read_runs_determined;
+
 	/* The symbolic link data
 	 */
 	uint8_t *symbolic_link_data;
@@ -129,6 +166,39 @@ struct libfshfs_internal_file_entry
 #endif
 };
 
+typedef struct libfshfs_internal_file_entry_stat_values libfshfs_internal_file_entry_stat_values_t;
+
+struct libfshfs_internal_file_entry_stat_values
+{
+	/* The file entry
+	 */
+	libfshfs_internal_file_entry_t *internal_file_entry;
+
+	/* The stat values
+	 */
+	libfshfs_file_entry_stat_t *stat_values;
+
+	/* The number of stat values
+	 */
+	int number_of_stat_values;
+
+	/* The index of the next stat value
+	 */
+	int stat_value_index;
+
+	/* The UTF-8 names
+	 */
+	uint8_t *utf8_names;
+
+	/* The UTF-8 names size
+	 */
+	size_t utf8_names_size;
+
+	/* The offset of the next UTF-8 name
+	 */
+	size_t utf8_names_offset;
+};
+
 int libfshfs_file_entry_initialize(
      libfshfs_file_entry_t **file_entry,
      libfshfs_io_handle_t *io_handle,
@@ -382,12 +452,28 @@ int libfshfs_file_entry_get_extended_attribute_by_utf16_name(
      libfshfs_extended_attribute_t **extended_attribute,
      libcerror_error_t **error );
 
+int libfshfs_internal_file_entry_determine_number_of_sub_file_entries(
+     libfshfs_internal_file_entry_t *internal_file_entry,
+     libcerror_error_t **error );
+
 LIBFSHFS_EXTERN \
 int libfshfs_file_entry_get_number_of_sub_file_entries(
      libfshfs_file_entry_t *file_entry,
      int *number_of_sub_entries,
      libcerror_error_t **error );
 
+LIBFSHFS_EXTERN \
+int libfshfs_file_entry_set_sub_file_entries_page_size(
+     libfshfs_file_entry_t *file_entry,
+     int page_size,
+     libcerror_error_t **error );
+
+int libfshfs_internal_file_entry_get_sub_directory_entry_from_page(
+     libfshfs_internal_file_entry_t *internal_file_entry,
+     int sub_directory_entry_index,
+     libfshfs_directory_entry_t **sub_directory_entry,
+     libcerror_error_t **error );
+
 LIBFSHFS_EXTERN \
 int libfshfs_file_entry_get_sub_file_entry_by_index(
      libfshfs_file_entry_t *file_entry,
@@ -411,6 +497,47 @@ int libfshfs_file_entry_get_sub_file_entry_by_utf16_name(
      libfshfs_file_entry_t **sub_file_entry,
      libcerror_error_t **error );
 
+int libfshfs_internal_file_entry_get_sub_directory_entries(
+     libfshfs_internal_file_entry_t *internal_file_entry,
+     libcerror_error_t **error );
+
+int libfshfs_internal_file_entry_get_indirect_node_stat(
+     libfshfs_internal_file_entry_t *internal_file_entry,
+     uint32_t link_reference,
+     libfshfs_file_entry_stat_t *stat_value,
+     libcerror_error_t **error );
+
+int libfshfs_internal_file_entry_add_sub_utf8_name_size(
+     libfshfs_catalog_btree_key_t *node_key,
+     const libfshfs_file_entry_stat_t *stat_value,
+     uint32_t link_reference,
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libfshfs_internal_file_entry_set_sub_stat_value(
+     libfshfs_catalog_btree_key_t *node_key,
+     const libfshfs_file_entry_stat_t *stat_value,
+     uint32_t link_reference,
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBFSHFS_EXTERN \
+int libfshfs_file_entry_get_sub_file_entries_utf8_names_size(
+     libfshfs_file_entry_t *file_entry,
+     int *number_of_sub_file_entries,
+     size_t *utf8_names_size,
+     libcerror_error_t **error );
+
+LIBFSHFS_EXTERN \
+int libfshfs_file_entry_get_sub_file_entries_stat(
+     libfshfs_file_entry_t *file_entry,
+     libfshfs_file_entry_stat_t *stat_values,
+     int number_of_stat_values,
+     uint8_t *utf8_names,
+     size_t utf8_names_size,
+     int *number_of_stat_values_filled,
+     libcerror_error_t **error );
+
 LIBFSHFS_EXTERN \
 ssize_t libfshfs_file_entry_read_buffer(
          libfshfs_file_entry_t *file_entry,
@@ -418,6 +545,18 @@ ssize_t libfshfs_file_entry_read_buffer(
          size_t buffer_size,
          libcerror_error_t **error );
 
+int libfshfs_internal_file_entry_determine_data_stream(
+     libfshfs_internal_file_entry_t *internal_file_entry,
+     libcerror_error_t **error );
+
+ssize_t libfshfs_internal_file_entry_read_buffer_at_offset(
+         libfshfs_internal_file_entry_t *internal_file_entry,
+         libbfio_handle_t *file_io_handle,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
 LIBFSHFS_EXTERN \
 ssize_t libfshfs_file_entry_read_buffer_at_offset(
          libfshfs_file_entry_t *file_entry,
@@ -426,6 +565,23 @@ ssize_t libfshfs_file_entry_read_buffer_at_offset(
          off64_t offset,
          libcerror_error_t **error );
 
+int libfshfs_internal_file_entry_read_ranges(
+     libfshfs_internal_file_entry_t *internal_file_entry,
+     libfshfs_read_range_t *read_ranges,
+     int number_of_ranges,
+     ssize_t *read_counts,
+     libcerror_error_t **error );
+
+LIBFSHFS_EXTERN \
+int libfshfs_file_entry_read_buffers_at_offsets(
+     libfshfs_file_entry_t *file_entry,
+     const off64_t *offsets,
+     const size_t *sizes,
+     uint8_t **buffers,
+     int number_of_ranges,
+     ssize_t *read_counts,
+     libcerror_error_t **error );
+
 LIBFSHFS_EXTERN \
 off64_t libfshfs_file_entry_seek_offset(
          libfshfs_file_entry_t *file_entry,
@@ -464,6 +620,40 @@ int libfshfs_file_entry_get_extent_by_index(
      uint32_t *extent_flags,
      libcerror_error_t **error );
 
+int libfshfs_internal_file_entry_determine_read_runs(
+     libfshfs_internal_file_entry_t *internal_file_entry,
+     libcerror_error_t **error );
+
+int libfshfs_internal_file_entry_get_number_of_read_runs(
+     libfshfs_internal_file_entry_t *internal_file_entry,
+     int *number_of_read_runs,
+     libcerror_error_t **error );
+
+int libfshfs_internal_file_entry_get_read_run_by_index(
+     libfshfs_internal_file_entry_t *internal_file_entry,
+     int read_run_index,
+     off64_t *data_offset,
+     off64_t *volume_offset,
+     size64_t *size,
+     uint32_t *flags,
+     libcerror_error_t **error );
+
+LIBFSHFS_EXTERN \
+int libfshfs_file_entry_get_number_of_read_runs(
+     libfshfs_file_entry_t *file_entry,
+     int *number_of_read_runs,
+     libcerror_error_t **error );
+
+LIBFSHFS_EXTERN \
+int libfshfs_file_entry_get_read_run_by_index(
+     libfshfs_file_entry_t *file_entry,
+     int read_run_index,
+     off64_t *data_offset,
+     off64_t *volume_offset,
+     size64_t *size,
+     uint32_t *flags,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
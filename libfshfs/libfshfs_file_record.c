@@ -32,6 +32,7 @@
 #include "libfshfs_libcerror.h"
 #include "libfshfs_libcnotify.h"
 #include "libfshfs_libfdatetime.h"
+#include "libfshfs_memory_arena.h"
 
 #include "fshfs_catalog_file.h"
 
@@ -131,6 +132,14 @@ int libfshfs_file_record_free(
 	}
 	if( *file_record != NULL )
 	{
+		/* The file record and fork descriptors are freed with the memory arena
+		 */
+		if( ( *file_record )->memory_arena != NULL )
+		{
+			*file_record = NULL;
+
+			return( 1 );
+		}
 		if( ( *file_record )->data_fork_descriptor != NULL )
 		{
 			if( libfshfs_fork_descriptor_free(
@@ -244,6 +253,7 @@ int libfshfs_file_record_clone(
 	}
 	( *destination_file_record )->data_fork_descriptor     = NULL;
 	( *destination_file_record )->resource_fork_descriptor = NULL;
+	( *destination_file_record )->memory_arena             = NULL;
 
 	if( libfshfs_fork_descriptor_clone(
 	     &( ( *destination_file_record )->data_fork_descriptor ),
@@ -307,12 +317,12 @@ int libfshfs_file_record_read_data(
 	uint32_t data_fork_size                              = 0;
 	uint32_t resource_fork_size                          = 0;
 	uint16_t record_type                                 = 0;
+	int result                                           = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	uint32_t value_32bit                                 = 0;
 	uint16_t value_16bit                                 = 0;
 	uint8_t is_hard_link                                 = 0;
-	int result                                           = 0;
 #endif
 
 	if( file_record == NULL )
@@ -861,9 +871,21 @@ int libfshfs_file_record_read_data(
 	}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-	if( libfshfs_fork_descriptor_initialize(
-	     &( file_record->data_fork_descriptor ),
-	     error ) != 1 )
+	if( file_record->memory_arena != NULL )
+	{
+		result = libfshfs_memory_arena_allocate(
+		          file_record->memory_arena,
+		          sizeof( libfshfs_fork_descriptor_t ),
+		          (intptr_t **) &( file_record->data_fork_descriptor ),
+		          error );
+	}
+	else
+	{
+		result = libfshfs_fork_descriptor_initialize(
+		          &( file_record->data_fork_descriptor ),
+		          error );
+	}
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -934,9 +956,21 @@ int libfshfs_file_record_read_data(
 			goto on_error;
 		}
 	}
-	if( libfshfs_fork_descriptor_initialize(
-	     &resource_fork_descriptor,
-	     error ) != 1 )
+	if( file_record->memory_arena != NULL )
+	{
+		result = libfshfs_memory_arena_allocate(
+		          file_record->memory_arena,
+		          sizeof( libfshfs_fork_descriptor_t ),
+		          (intptr_t **) &resource_fork_descriptor,
+		          error );
+	}
+	else
+	{
+		result = libfshfs_fork_descriptor_initialize(
+		          &resource_fork_descriptor,
+		          error );
+	}
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -1011,7 +1045,7 @@ int libfshfs_file_record_read_data(
 	{
 		file_record->resource_fork_descriptor = resource_fork_descriptor;
 	}
-	else
+	else if( file_record->memory_arena == NULL )
 	{
 		if( libfshfs_fork_descriptor_free(
 		     &resource_fork_descriptor,
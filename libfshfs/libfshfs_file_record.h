@@ -27,6 +27,7 @@
 
 #include "libfshfs_fork_descriptor.h"
 #include "libfshfs_libcerror.h"
+#include "libfshfs_memory_arena.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -95,6 +96,10 @@ struct libfshfs_file_record
 	/* The resource fork descriptor
 	 */
 	libfshfs_fork_descriptor_t *resource_fork_descriptor;
+
+	/* The memory arena the file record and its fork descriptors were allocated from
+	 */
+	libfshfs_memory_arena_t *memory_arena;
 };
 
 int libfshfs_file_record_initialize(
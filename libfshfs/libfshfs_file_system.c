@@ -24,11 +24,17 @@
 #include <narrow_string.h>
 #include <types.h>
 
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
 #include "libfshfs_attribute_record.h"
 #include "libfshfs_attributes_btree_file.h"
+#include "libfshfs_attributes_index.h"
 #include "libfshfs_btree_file.h"
 #include "libfshfs_btree_node_cache.h"
 #include "libfshfs_catalog_btree_file.h"
+#include "libfshfs_catalog_index.h"
 #include "libfshfs_definitions.h"
 #include "libfshfs_directory_entry.h"
 #include "libfshfs_extent.h"
@@ -40,7 +46,18 @@
 #include "libfshfs_libcerror.h"
 #include "libfshfs_libcthreads.h"
 #include "libfshfs_libuna.h"
+#include "libfshfs_lookup_target.h"
 #include "libfshfs_name.h"
+#include "libfshfs_path_cache.h"
+#include "libfshfs_thread_record.h"
+
+/* The names of the private directories that contain the indirect nodes of
+ * the file and directory hard links, where the U+0000 characters of
+ * "\0\0\0\0HFS+ Private Data" are represented as U+2400
+ */
+static const char *libfshfs_file_system_private_directory_names[ 2 ] = {
+	"\xe2\x90\x80\xe2\x90\x80\xe2\x90\x80\xe2\x90\x80HFS+ Private Data",
+	".HFS+ Private Directory Data\r" };
 
 /* Creates a file system
  * Make sure the value file_system is referencing, is set to NULL
@@ -123,6 +140,20 @@ int libfshfs_file_system_initialize(
 		goto on_error;
 	}
 #endif
+	if( libfshfs_path_cache_initialize(
+	     &( ( *file_system )->path_cache ),
+	     LIBFSHFS_MAXIMUM_CACHE_ENTRIES_PATH_COMPONENTS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create path cache.",
+		 function );
+
+		goto on_error;
+	}
 	( *file_system )->use_case_folding = use_case_folding;
 
 	return( 1 );
@@ -130,6 +161,14 @@ int libfshfs_file_system_initialize(
 on_error:
 	if( *file_system != NULL )
 	{
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+		if( ( *file_system )->read_write_lock != NULL )
+		{
+			libcthreads_read_write_lock_free(
+			 &( ( *file_system )->read_write_lock ),
+			 NULL );
+		}
+#endif
 		memory_free(
 		 *file_system );
 
@@ -224,6 +263,38 @@ int libfshfs_file_system_free(
 				result = -1;
 			}
 		}
+		if( ( *file_system )->indirect_node_index != NULL )
+		{
+			if( libfshfs_catalog_index_free(
+			     &( ( *file_system )->indirect_node_index ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free indirect node index.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *file_system )->catalog_index != NULL )
+		{
+			if( libfshfs_catalog_index_free(
+			     &( ( *file_system )->catalog_index ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free catalog index.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( ( *file_system )->catalog_btree_node_cache != NULL )
 		{
 			if( libfshfs_btree_node_cache_free(
@@ -256,6 +327,22 @@ int libfshfs_file_system_free(
 				result = -1;
 			}
 		}
+		if( ( *file_system )->attributes_index != NULL )
+		{
+			if( libfshfs_attributes_index_free(
+			     &( ( *file_system )->attributes_index ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free attributes index.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( ( *file_system )->attributes_btree_node_cache != NULL )
 		{
 			if( libfshfs_btree_node_cache_free(
@@ -288,6 +375,22 @@ int libfshfs_file_system_free(
 				result = -1;
 			}
 		}
+		if( ( *file_system )->path_cache != NULL )
+		{
+			if( libfshfs_path_cache_free(
+			     &( ( *file_system )->path_cache ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free path cache.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 *file_system );
 
@@ -386,14 +489,56 @@ int libfshfs_file_system_read_attributes_file(
 	}
 	else if( result != 0 )
 	{
-		if( libfshfs_extents_btree_file_get_extents(
-		     file_system->extents_btree_file,
+		if( libfshfs_file_system_read_deferred_extents_file(
+		     file_system,
 		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read deferred extents B-tree file.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfshfs_btree_node_cache_grab(
+		     file_system->extents_btree_node_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab extents B-tree node cache.",
+			 function );
+
+			goto on_error;
+		}
+		result = libfshfs_extents_btree_file_get_extents(
+		          file_system->extents_btree_file,
+		          file_io_handle,
+		          file_system->extents_btree_node_cache,
+		          LIBFSHFS_ATTRIBUTES_FILE_IDENTIFIER,
+		          LIBFSHFS_FORK_TYPE_DATA,
+		          file_system->attributes_btree_file->extents,
+		          error );
+
+		if( libfshfs_btree_node_cache_release(
 		     file_system->extents_btree_node_cache,
-		     LIBFSHFS_ATTRIBUTES_FILE_IDENTIFIER,
-		     LIBFSHFS_FORK_TYPE_DATA,
-		     file_system->attributes_btree_file->extents,
 		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release extents B-tree node cache.",
+			 function );
+
+			goto on_error;
+		}
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -425,6 +570,7 @@ int libfshfs_file_system_read_attributes_file(
 	}
 	if( libfshfs_btree_node_cache_initialize(
 	     &( file_system->attributes_btree_node_cache ),
+	     LIBFSHFS_STATISTICS_REGION_ATTRIBUTES,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -448,6 +594,127 @@ on_error:
 	return( -1 );
 }
 
+/* Reads the attributes index
+ * The attributes index maps the identifiers of file entries with extended
+ * attributes to the location of their records in the attributes B-tree file
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_file_system_read_attributes_index(
+     libfshfs_file_system_t *file_system,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_file_system_read_attributes_index";
+	int result            = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->attributes_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file system - attributes index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfshfs_file_system_read_deferred_attributes_file(
+	     file_system,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read deferred attributes B-tree file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfshfs_attributes_index_initialize(
+	     &( file_system->attributes_index ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create attributes index.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_system->attributes_btree_file != NULL )
+	{
+		if( libfshfs_btree_node_cache_grab(
+		     file_system->attributes_btree_node_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab attributes B-tree node cache.",
+			 function );
+
+			goto on_error;
+		}
+		result = libfshfs_attributes_btree_file_read_attributes_index(
+		          file_system->attributes_btree_file,
+		          file_io_handle,
+		          file_system->attributes_btree_node_cache,
+		          file_system->attributes_index,
+		          error );
+
+		if( libfshfs_btree_node_cache_release(
+		     file_system->attributes_btree_node_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release attributes B-tree node cache.",
+			 function );
+
+			goto on_error;
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read attributes index from attributes B-tree file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( file_system->attributes_index != NULL )
+	{
+		libfshfs_attributes_index_free(
+		 &( file_system->attributes_index ),
+		 NULL );
+	}
+	return( -1 );
+}
+
 /* Reads the catalog B-tree file
  * Returns 1 if successful or -1 on error
  */
@@ -538,14 +805,56 @@ int libfshfs_file_system_read_catalog_file(
 	}
 	else if( result != 0 )
 	{
-		if( libfshfs_extents_btree_file_get_extents(
-		     file_system->extents_btree_file,
+		if( libfshfs_file_system_read_deferred_extents_file(
+		     file_system,
 		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read deferred extents B-tree file.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfshfs_btree_node_cache_grab(
+		     file_system->extents_btree_node_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab extents B-tree node cache.",
+			 function );
+
+			goto on_error;
+		}
+		result = libfshfs_extents_btree_file_get_extents(
+		          file_system->extents_btree_file,
+		          file_io_handle,
+		          file_system->extents_btree_node_cache,
+		          LIBFSHFS_CATALOG_FILE_IDENTIFIER,
+		          LIBFSHFS_FORK_TYPE_DATA,
+		          file_system->catalog_btree_file->extents,
+		          error );
+
+		if( libfshfs_btree_node_cache_release(
 		     file_system->extents_btree_node_cache,
-		     LIBFSHFS_CATALOG_FILE_IDENTIFIER,
-		     LIBFSHFS_FORK_TYPE_DATA,
-		     file_system->catalog_btree_file->extents,
 		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release extents B-tree node cache.",
+			 function );
+
+			goto on_error;
+		}
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -577,6 +886,7 @@ int libfshfs_file_system_read_catalog_file(
 	}
 	if( libfshfs_btree_node_cache_initialize(
 	     &( file_system->catalog_btree_node_cache ),
+	     LIBFSHFS_STATISTICS_REGION_CATALOG,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -590,6 +900,7 @@ int libfshfs_file_system_read_catalog_file(
 	}
 	if( libfshfs_btree_node_cache_initialize(
 	     &( file_system->indirect_node_catalog_btree_node_cache ),
+	     LIBFSHFS_STATISTICS_REGION_CATALOG,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -619,17 +930,18 @@ on_error:
 	return( -1 );
 }
 
-/* Reads the extents B-tree file
+/* Reads the catalog index
+ * The catalog index maps the identifiers of the directory and file records
+ * to the location of their records in the catalog B-tree file
  * Returns 1 if successful or -1 on error
  */
-int libfshfs_file_system_read_extents_file(
+int libfshfs_file_system_read_catalog_index(
      libfshfs_file_system_t *file_system,
      libfshfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
-     libfshfs_fork_descriptor_t *fork_descriptor,
      libcerror_error_t **error )
 {
-	static char *function = "libfshfs_file_system_read_extents_file";
+	static char *function = "libfshfs_file_system_read_catalog_index";
 	int result            = 0;
 
 	if( file_system == NULL )
@@ -643,82 +955,364 @@ int libfshfs_file_system_read_extents_file(
 
 		return( -1 );
 	}
-	if( file_system->extents_btree_file != NULL )
+	if( file_system->catalog_index != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file system - extents B-tree file value already set.",
-		 function );
-
-		return( -1 );
-	}
-	if( fork_descriptor == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid fork descriptor.",
+		 "%s: invalid file system - catalog index value already set.",
 		 function );
 
 		return( -1 );
 	}
-	result = libfshfs_fork_descriptor_has_extents_overflow(
-	          fork_descriptor,
-	          error );
-
-	if( result == -1 )
+	if( libfshfs_catalog_index_initialize(
+	     &( file_system->catalog_index ),
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine if fork descriptor has extents overflow.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create catalog index.",
 		 function );
 
 		goto on_error;
 	}
-	else if( result != 0 )
+	if( libfshfs_btree_node_cache_grab(
+	     file_system->catalog_btree_node_cache,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported fork descriptor has extents overflow.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab catalog B-tree node cache.",
 		 function );
 
 		goto on_error;
 	}
-	if( libfshfs_btree_file_initialize(
-	     &( file_system->extents_btree_file ),
+	result = libfshfs_catalog_btree_file_read_catalog_index(
+	          file_system->catalog_btree_file,
+	          io_handle,
+	          file_io_handle,
+	          file_system->catalog_btree_node_cache,
+	          file_system->catalog_index,
+	          error );
+
+	if( libfshfs_btree_node_cache_release(
+	     file_system->catalog_btree_node_cache,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create extents B-tree file.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release catalog B-tree node cache.",
 		 function );
 
 		goto on_error;
 	}
-	if( libfshfs_fork_descriptor_get_extents(
-	     fork_descriptor,
-	     file_system->extents_btree_file->extents,
-	     error ) != 1 )
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve extents of extents B-tree file.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read catalog index from catalog B-tree file.",
 		 function );
 
 		goto on_error;
 	}
-	file_system->extents_btree_file->size = fork_descriptor->size;
+	return( 1 );
+
+on_error:
+	if( file_system->catalog_index != NULL )
+	{
+		libfshfs_catalog_index_free(
+		 &( file_system->catalog_index ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the indirect node index
+ * The indirect node index maps the link references of the hard links
+ * to the location of the indirect node records in the catalog B-tree file
+ * and is read with a single pass over the children of the private directories
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_file_system_read_indirect_node_index(
+     libfshfs_file_system_t *file_system,
+     libfshfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libfshfs_directory_entry_t *directory_entry = NULL;
+	static char *function                       = "libfshfs_file_system_read_indirect_node_index";
+	uint32_t parent_identifier                  = 0;
+	int name_index                              = 0;
+	int result                                  = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->indirect_node_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file system - indirect node index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfshfs_catalog_index_initialize(
+	     &( file_system->indirect_node_index ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create indirect node index.",
+		 function );
+
+		goto on_error;
+	}
+	for( name_index = 0;
+	     name_index < 2;
+	     name_index++ )
+	{
+		result = libfshfs_file_system_get_directory_entry_by_utf8_name(
+		          file_system,
+		          io_handle,
+		          file_io_handle,
+		          LIBFSHFS_ROOT_DIRECTORY_IDENTIFIER,
+		          (const uint8_t *) libfshfs_file_system_private_directory_names[ name_index ],
+		          narrow_string_length(
+		           libfshfs_file_system_private_directory_names[ name_index ] ),
+		          &directory_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve private directory: %d entry.",
+			 function,
+			 name_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		if( libfshfs_directory_entry_get_identifier(
+		     directory_entry,
+		     &parent_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve private directory: %d identifier.",
+			 function,
+			 name_index );
+
+			goto on_error;
+		}
+		if( libfshfs_directory_entry_free(
+		     &directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory entry.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfshfs_btree_node_cache_grab(
+		     file_system->indirect_node_catalog_btree_node_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab indirect node catalog B-tree node cache.",
+			 function );
+
+			goto on_error;
+		}
+		result = libfshfs_catalog_btree_file_read_indirect_node_index(
+		          file_system->catalog_btree_file,
+		          io_handle,
+		          file_io_handle,
+		          file_system->indirect_node_catalog_btree_node_cache,
+		          parent_identifier,
+		          file_system->indirect_node_index,
+		          error );
+
+		if( libfshfs_btree_node_cache_release(
+		     file_system->indirect_node_catalog_btree_node_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release indirect node catalog B-tree node cache.",
+			 function );
+
+			goto on_error;
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read indirect node index from catalog B-tree file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( directory_entry != NULL )
+	{
+		libfshfs_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	if( file_system->indirect_node_index != NULL )
+	{
+		libfshfs_catalog_index_free(
+		 &( file_system->indirect_node_index ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the extents B-tree file
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_file_system_read_extents_file(
+     libfshfs_file_system_t *file_system,
+     libfshfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfshfs_fork_descriptor_t *fork_descriptor,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_file_system_read_extents_file";
+	int result            = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->extents_btree_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file system - extents B-tree file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( fork_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid fork descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfshfs_fork_descriptor_has_extents_overflow(
+	          fork_descriptor,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if fork descriptor has extents overflow.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported fork descriptor has extents overflow.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfshfs_btree_file_initialize(
+	     &( file_system->extents_btree_file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create extents B-tree file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfshfs_fork_descriptor_get_extents(
+	     fork_descriptor,
+	     file_system->extents_btree_file->extents,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve extents of extents B-tree file.",
+		 function );
+
+		goto on_error;
+	}
+	file_system->extents_btree_file->size = fork_descriptor->size;
 
 	if( libfshfs_btree_file_read_file_io_handle(
 	     file_system->extents_btree_file,
@@ -737,6 +1331,7 @@ int libfshfs_file_system_read_extents_file(
 	}
 	if( libfshfs_btree_node_cache_initialize(
 	     &( file_system->extents_btree_node_cache ),
+	     LIBFSHFS_STATISTICS_REGION_EXTENTS,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -760,68 +1355,1421 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves a directory entry for a specific identifier
- * Returns 1 if successful, 0 if not found or -1 on error
+/* Sets the B-tree files of which reading is deferred until first use
+ * The fork descriptors are referenced and must remain available while the file system is used
+ * Returns 1 if successful or -1 on error
  */
-int libfshfs_file_system_get_directory_entry_by_identifier(
+int libfshfs_file_system_set_deferred_files(
      libfshfs_file_system_t *file_system,
      libfshfs_io_handle_t *io_handle,
-     libbfio_handle_t *file_io_handle,
-     uint32_t identifier,
-     libfshfs_directory_entry_t **directory_entry,
+     libfshfs_fork_descriptor_t *extents_file_fork_descriptor,
+     libfshfs_fork_descriptor_t *attributes_file_fork_descriptor,
      libcerror_error_t **error )
 {
-	static char *function = "libfshfs_file_system_get_directory_entry_by_identifier";
-	int result            = 0;
+	static char *function = "libfshfs_file_system_set_deferred_files";
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->deferred_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file system - deferred IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( extents_file_fork_descriptor != NULL )
+	 && ( file_system->extents_btree_file != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file system - extents B-tree file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( attributes_file_fork_descriptor != NULL )
+	 && ( file_system->attributes_btree_file != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file system - attributes B-tree file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	file_system->deferred_io_handle                       = io_handle;
+	file_system->deferred_extents_file_fork_descriptor    = extents_file_fork_descriptor;
+	file_system->deferred_attributes_file_fork_descriptor = attributes_file_fork_descriptor;
+
+	return( 1 );
+}
+
+/* Reads the extents B-tree file if reading it was deferred
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_file_system_read_deferred_extents_file(
+     libfshfs_file_system_t *file_system,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_file_system_read_deferred_extents_file";
+	int result            = 1;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	/* The extents B-tree file is only deferred when the volume was opened lazily
+	 * The deferred fork descriptor is only checked while holding the lock
+	 */
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     file_system->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( file_system->deferred_extents_file_fork_descriptor != NULL )
+	{
+		if( libfshfs_file_system_read_extents_file(
+		     file_system,
+		     file_system->deferred_io_handle,
+		     file_io_handle,
+		     file_system->deferred_extents_file_fork_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read extents B-tree file.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			file_system->deferred_extents_file_fork_descriptor = NULL;
+		}
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     file_system->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads the attributes B-tree file if reading it was deferred
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_file_system_read_deferred_attributes_file(
+     libfshfs_file_system_t *file_system,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_file_system_read_deferred_attributes_file";
+	int result            = 1;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	/* The attributes B-tree file is only deferred when the volume was opened lazily
+	 * The deferred fork descriptors are only checked while holding the lock
+	 */
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     file_system->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( file_system->deferred_attributes_file_fork_descriptor != NULL )
+	{
+		/* The attributes B-tree file can depend on the extents (overflow) B-tree file
+		 */
+		if( file_system->deferred_extents_file_fork_descriptor != NULL )
+		{
+			if( libfshfs_file_system_read_extents_file(
+			     file_system,
+			     file_system->deferred_io_handle,
+			     file_io_handle,
+			     file_system->deferred_extents_file_fork_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read extents B-tree file.",
+				 function );
+
+				result = -1;
+			}
+			else
+			{
+				file_system->deferred_extents_file_fork_descriptor = NULL;
+			}
+		}
+	}
+	if( ( result == 1 )
+	 && ( file_system->deferred_attributes_file_fork_descriptor != NULL ) )
+	{
+		if( libfshfs_file_system_read_attributes_file(
+		     file_system,
+		     file_system->deferred_io_handle,
+		     file_io_handle,
+		     file_system->deferred_attributes_file_fork_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read attributes B-tree file.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			file_system->deferred_attributes_file_fork_descriptor = NULL;
+		}
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     file_system->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a directory entry for a specific identifier
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libfshfs_file_system_get_directory_entry_by_identifier(
+     libfshfs_file_system_t *file_system,
+     libfshfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t identifier,
+     libfshfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error )
+{
+	libfshfs_catalog_index_entry_t *catalog_index_entry = NULL;
+	static char *function                               = "libfshfs_file_system_get_directory_entry_by_identifier";
+	int result                                          = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->catalog_index != NULL )
+	{
+		result = libfshfs_catalog_index_get_entry_by_identifier(
+		          file_system->catalog_index,
+		          identifier,
+		          &catalog_index_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve catalog index entry: %" PRIu32 ".",
+			 function,
+			 identifier );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		if( libfshfs_btree_node_cache_grab(
+		     file_system->catalog_btree_node_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab catalog B-tree node cache.",
+			 function );
+
+			return( -1 );
+		}
+		result = libfshfs_catalog_btree_file_get_directory_entry_from_index_entry(
+		          file_system->catalog_btree_file,
+		          io_handle,
+		          file_io_handle,
+		          file_system->catalog_btree_node_cache,
+		          catalog_index_entry,
+		          directory_entry,
+		          error );
+
+		if( libfshfs_btree_node_cache_release(
+		     file_system->catalog_btree_node_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release catalog B-tree node cache.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( libfshfs_btree_node_cache_grab(
+		     file_system->catalog_btree_node_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab catalog B-tree node cache.",
+			 function );
+
+			return( -1 );
+		}
+		result = libfshfs_catalog_btree_file_get_directory_entry_by_identifier(
+		          file_system->catalog_btree_file,
+		          io_handle,
+		          file_io_handle,
+		          file_system->catalog_btree_node_cache,
+		          identifier,
+		          file_system->use_case_folding,
+		          directory_entry,
+		          error );
+
+		if( libfshfs_btree_node_cache_release(
+		     file_system->catalog_btree_node_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release catalog B-tree node cache.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entry: %" PRIu32 ".",
+		 function,
+		 identifier );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the number of directory entries in the catalog index
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_file_system_get_number_of_directory_entries(
+     libfshfs_file_system_t *file_system,
+     int *number_of_directory_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_file_system_get_number_of_directory_entries";
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfshfs_catalog_index_get_number_of_entries(
+	     file_system->catalog_index,
+	     number_of_directory_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of catalog index entries.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the identifier of a specific directory entry in the catalog index
+ * The directory entries are sorted by identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_file_system_get_directory_entry_identifier_by_index(
+     libfshfs_file_system_t *file_system,
+     int directory_entry_index,
+     uint32_t *identifier,
+     libcerror_error_t **error )
+{
+	libfshfs_catalog_index_entry_t *catalog_index_entry = NULL;
+	static char *function                               = "libfshfs_file_system_get_directory_entry_identifier_by_index";
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfshfs_catalog_index_get_entry_by_index(
+	     file_system->catalog_index,
+	     directory_entry_index,
+	     &catalog_index_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve catalog index entry: %d.",
+		 function,
+		 directory_entry_index );
+
+		return( -1 );
+	}
+	*identifier = catalog_index_entry->identifier;
+
+	return( 1 );
+}
+
+/* Retrieves an indirect node directory entry for a specific identifier
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libfshfs_file_system_get_indirect_node_directory_entry_by_identifier(
+     libfshfs_file_system_t *file_system,
+     libfshfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t identifier,
+     libfshfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error )
+{
+	libfshfs_catalog_index_entry_t *catalog_index_entry = NULL;
+	static char *function                               = "libfshfs_file_system_get_indirect_node_directory_entry_by_identifier";
+	int result                                          = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->indirect_node_index != NULL )
+	{
+		result = libfshfs_catalog_index_get_entry_by_identifier(
+		          file_system->indirect_node_index,
+		          identifier,
+		          &catalog_index_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve indirect node index entry: %" PRIu32 ".",
+			 function,
+			 identifier );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( libfshfs_btree_node_cache_grab(
+			     file_system->indirect_node_catalog_btree_node_cache,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab indirect node catalog B-tree node cache.",
+				 function );
+
+				return( -1 );
+			}
+			result = libfshfs_catalog_btree_file_get_directory_entry_from_index_entry(
+			          file_system->catalog_btree_file,
+			          io_handle,
+			          file_io_handle,
+			          file_system->indirect_node_catalog_btree_node_cache,
+			          catalog_index_entry,
+			          directory_entry,
+			          error );
+
+			if( libfshfs_btree_node_cache_release(
+			     file_system->indirect_node_catalog_btree_node_cache,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release indirect node catalog B-tree node cache.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	/* Fall back to a catalog B-tree lookup for link references not in the index
+	 */
+	if( result == 0 )
+	{
+		if( libfshfs_btree_node_cache_grab(
+		     file_system->indirect_node_catalog_btree_node_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab indirect node catalog B-tree node cache.",
+			 function );
+
+			return( -1 );
+		}
+		result = libfshfs_catalog_btree_file_get_directory_entry_by_identifier(
+		          file_system->catalog_btree_file,
+		          io_handle,
+		          file_io_handle,
+		          file_system->indirect_node_catalog_btree_node_cache,
+		          identifier,
+		          file_system->use_case_folding,
+		          directory_entry,
+		          error );
+
+		if( libfshfs_btree_node_cache_release(
+		     file_system->indirect_node_catalog_btree_node_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release indirect node catalog B-tree node cache.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve indirect node directory entry: %" PRIu32 ".",
+		 function,
+		 identifier );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves a directory entry for an UTF-8 encoded name
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libfshfs_file_system_get_directory_entry_by_utf8_name(
+     libfshfs_file_system_t *file_system,
+     libfshfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t parent_identifier,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfshfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error )
+{
+	libfshfs_directory_entry_t *safe_directory_entry = NULL;
+	static char *function                            = "libfshfs_file_system_get_directory_entry_by_utf8_name";
+	uint32_t name_hash                               = 0;
+	int result                                       = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfshfs_name_calculate_hash_utf8_string(
+	     (libuna_utf8_character_t *) utf8_string,
+	     utf8_string_length,
+	     file_system->use_case_folding,
+	     &name_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate name hash.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfshfs_btree_node_cache_grab(
+	     file_system->catalog_btree_node_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab catalog B-tree node cache.",
+		 function );
+
+		goto on_error;
+	}
+	result = libfshfs_catalog_btree_file_get_directory_entry_by_utf8_name(
+	          file_system->catalog_btree_file,
+	          io_handle,
+	          file_io_handle,
+	          file_system->catalog_btree_node_cache,
+	          parent_identifier,
+	          name_hash,
+	          utf8_string,
+	          utf8_string_length,
+	          file_system->use_case_folding,
+	          &safe_directory_entry,
+	          error );
+
+	if( libfshfs_btree_node_cache_release(
+	     file_system->catalog_btree_node_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release catalog B-tree node cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entry by UTF-8 name.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		*directory_entry = safe_directory_entry;
+	}
+	return( result );
+
+on_error:
+	if( safe_directory_entry != NULL )
+	{
+		libfshfs_directory_entry_free(
+		 &safe_directory_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a directory entry for a specific identifier
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libfshfs_file_system_get_directory_entry_by_utf8_path(
+     libfshfs_file_system_t *file_system,
+     libfshfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfshfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error )
+{
+	libfshfs_directory_entry_t *safe_directory_entry = NULL;
+	static char *function                            = "libfshfs_file_system_get_directory_entry_by_utf8_path";
+	int result                                       = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfshfs_btree_node_cache_grab(
+	     file_system->catalog_btree_node_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab catalog B-tree node cache.",
+		 function );
+
+		goto on_error;
+	}
+	result = libfshfs_catalog_btree_file_get_directory_entry_by_utf8_path(
+	          file_system->catalog_btree_file,
+	          io_handle,
+	          file_io_handle,
+	          file_system->catalog_btree_node_cache,
+	          file_system->path_cache,
+	          utf8_string,
+	          utf8_string_length,
+	          file_system->use_case_folding,
+	          &safe_directory_entry,
+	          error );
+
+	if( libfshfs_btree_node_cache_release(
+	     file_system->catalog_btree_node_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release catalog B-tree node cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entry by UTF-8 path.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		*directory_entry = safe_directory_entry;
+	}
+	return( result );
+
+on_error:
+	if( safe_directory_entry != NULL )
+	{
+		libfshfs_directory_entry_free(
+		 &safe_directory_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a directory entry for an UTF-16 encoded name
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libfshfs_file_system_get_directory_entry_by_utf16_name(
+     libfshfs_file_system_t *file_system,
+     libfshfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t parent_identifier,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libfshfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error )
+{
+	libfshfs_directory_entry_t *safe_directory_entry = NULL;
+	static char *function                            = "libfshfs_file_system_get_directory_entry_by_utf16_name";
+	uint32_t name_hash                               = 0;
+	int result                                       = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfshfs_name_calculate_hash_utf16_string(
+	     (libuna_utf16_character_t *) utf16_string,
+	     utf16_string_length,
+	     file_system->use_case_folding,
+	     &name_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate name hash.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfshfs_btree_node_cache_grab(
+	     file_system->catalog_btree_node_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab catalog B-tree node cache.",
+		 function );
+
+		goto on_error;
+	}
+	result = libfshfs_catalog_btree_file_get_directory_entry_by_utf16_name(
+	          file_system->catalog_btree_file,
+	          io_handle,
+	          file_io_handle,
+	          file_system->catalog_btree_node_cache,
+	          parent_identifier,
+	          name_hash,
+	          utf16_string,
+	          utf16_string_length,
+	          file_system->use_case_folding,
+	          &safe_directory_entry,
+	          error );
+
+	if( libfshfs_btree_node_cache_release(
+	     file_system->catalog_btree_node_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release catalog B-tree node cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entry by UTF-16 name.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		*directory_entry = safe_directory_entry;
+	}
+	return( result );
+
+on_error:
+	if( safe_directory_entry != NULL )
+	{
+		libfshfs_directory_entry_free(
+		 &safe_directory_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a directory entry for a specific identifier
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libfshfs_file_system_get_directory_entry_by_utf16_path(
+     libfshfs_file_system_t *file_system,
+     libfshfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libfshfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error )
+{
+	libfshfs_directory_entry_t *safe_directory_entry = NULL;
+	static char *function                            = "libfshfs_file_system_get_directory_entry_by_utf16_path";
+	int result                                       = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfshfs_btree_node_cache_grab(
+	     file_system->catalog_btree_node_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab catalog B-tree node cache.",
+		 function );
+
+		goto on_error;
+	}
+	result = libfshfs_catalog_btree_file_get_directory_entry_by_utf16_path(
+	          file_system->catalog_btree_file,
+	          io_handle,
+	          file_io_handle,
+	          file_system->catalog_btree_node_cache,
+	          file_system->path_cache,
+	          utf16_string,
+	          utf16_string_length,
+	          file_system->use_case_folding,
+	          &safe_directory_entry,
+	          error );
+
+	if( libfshfs_btree_node_cache_release(
+	     file_system->catalog_btree_node_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release catalog B-tree node cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entry by UTF-16 path.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		*directory_entry = safe_directory_entry;
+	}
+	return( result );
+
+on_error:
+	if( safe_directory_entry != NULL )
+	{
+		libfshfs_directory_entry_free(
+		 &safe_directory_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the directory entries of lookup targets
+ * A target that is looked up by identifier is looked up by its thread record and then by
+ * the parent identifier and name of the thread record. A target that is looked up by path
+ * is looked up one path segment at a time. In every step the pending targets are sorted
+ * by catalog key and their catalog keys are looked up in a single pass over the catalog B-tree
+ * The directory entry of a target that is not available is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_file_system_get_directory_entries_by_lookup_targets(
+     libfshfs_file_system_t *file_system,
+     libfshfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfshfs_lookup_target_t *lookup_targets,
+     int number_of_lookup_targets,
+     libcerror_error_t **error )
+{
+	libfshfs_lookup_target_t *lookup_target = NULL;
+	const uint8_t *utf8_string_segment      = NULL;
+	static char *function                   = "libfshfs_file_system_get_directory_entries_by_lookup_targets";
+	size_t utf8_string_segment_length       = 0;
+	uint32_t entry_identifier               = 0;
+	int lookup_target_index                 = 0;
+	int number_of_pending_lookup_targets    = 0;
+	int result                              = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( lookup_targets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lookup targets.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_lookup_targets < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of lookup targets value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	for( lookup_target_index = 0;
+	     lookup_target_index < number_of_lookup_targets;
+	     lookup_target_index++ )
+	{
+		lookup_target = &( lookup_targets[ lookup_target_index ] );
+
+		if( lookup_target->utf8_path == NULL )
+		{
+			if( file_system->catalog_index != NULL )
+			{
+				/* The catalog index provides the location of the directory entry directly
+				 */
+				result = libfshfs_file_system_get_directory_entry_by_identifier(
+				          file_system,
+				          io_handle,
+				          file_io_handle,
+				          lookup_target->identifier,
+				          &( lookup_target->directory_entry ),
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve directory entry of lookup target: %d.",
+					 function,
+					 lookup_target->index );
+
+					return( -1 );
+				}
+				continue;
+			}
+			result = libfshfs_lookup_target_set_thread_record_key(
+			          lookup_target,
+			          lookup_target->identifier,
+			          error );
+		}
+		else
+		{
+			lookup_target->utf8_path_index = 0;
+
+			/* Ignore a leading separator
+			 */
+			if( ( lookup_target->utf8_path_length > 0 )
+			 && ( lookup_target->utf8_path[ 0 ] == (uint8_t) LIBFSHFS_SEPARATOR ) )
+			{
+				lookup_target->utf8_path_index = 1;
+			}
+			if( lookup_target->utf8_path_length <= 1 )
+			{
+				lookup_target->utf8_path_index = lookup_target->utf8_path_length;
+
+				result = libfshfs_lookup_target_set_thread_record_key(
+				          lookup_target,
+				          LIBFSHFS_ROOT_DIRECTORY_IDENTIFIER,
+				          error );
+			}
+			else
+			{
+				result = libfshfs_lookup_target_get_utf8_path_segment(
+				          lookup_target,
+				          &utf8_string_segment,
+				          &utf8_string_segment_length,
+				          error );
+
+				if( ( result == 1 )
+				 && ( utf8_string_segment_length > 0 ) )
+				{
+					result = libfshfs_lookup_target_set_utf8_name_key(
+					          lookup_target,
+					          LIBFSHFS_ROOT_DIRECTORY_IDENTIFIER,
+					          utf8_string_segment,
+					          utf8_string_segment_length,
+					          file_system->use_case_folding,
+					          error );
+				}
+			}
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set catalog key of lookup target: %d.",
+			 function,
+			 lookup_target->index );
+
+			return( -1 );
+		}
+		if( lookup_target->is_pending != 0 )
+		{
+			number_of_pending_lookup_targets++;
+		}
+	}
+	while( number_of_pending_lookup_targets > 0 )
+	{
+		qsort(
+		 lookup_targets,
+		 (size_t) number_of_lookup_targets,
+		 sizeof( libfshfs_lookup_target_t ),
+		 (int (*)(const void *, const void *)) &libfshfs_lookup_target_compare_by_key );
+
+		if( libfshfs_btree_node_cache_grab(
+		     file_system->catalog_btree_node_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab catalog B-tree node cache.",
+			 function );
+
+			return( -1 );
+		}
+		result = libfshfs_catalog_btree_file_get_records_by_lookup_targets(
+		          file_system->catalog_btree_file,
+		          io_handle,
+		          file_io_handle,
+		          file_system->catalog_btree_node_cache,
+		          lookup_targets,
+		          number_of_pending_lookup_targets,
+		          file_system->use_case_folding,
+		          error );
+
+		if( libfshfs_btree_node_cache_release(
+		     file_system->catalog_btree_node_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release catalog B-tree node cache.",
+			 function );
+
+			return( -1 );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve catalog records of lookup targets.",
+			 function );
 
-	if( file_system == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file system.",
-		 function );
+			return( -1 );
+		}
+		number_of_pending_lookup_targets = 0;
 
-		return( -1 );
-	}
-	result = libfshfs_catalog_btree_file_get_directory_entry_by_identifier(
-	          file_system->catalog_btree_file,
-	          io_handle,
-	          file_io_handle,
-	          file_system->catalog_btree_node_cache,
-	          identifier,
-	          file_system->use_case_folding,
-	          directory_entry,
-	          error );
+		for( lookup_target_index = 0;
+		     lookup_target_index < number_of_lookup_targets;
+		     lookup_target_index++ )
+		{
+			lookup_target = &( lookup_targets[ lookup_target_index ] );
 
-	if( result == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve directory entry: %" PRIu32 ".",
-		 function,
-		 identifier );
+			/* The pending targets are sorted before the other targets
+			 */
+			if( lookup_target->is_pending == 0 )
+			{
+				break;
+			}
+			lookup_target->is_pending = 0;
 
-		return( -1 );
+			result = 1;
+
+			if( lookup_target->thread_record != NULL )
+			{
+				/* Look up the directory entry by the parent identifier and name of the thread record
+				 */
+				if( lookup_target->thread_record->name_size > 0 )
+				{
+					result = libfshfs_lookup_target_set_name_key(
+					          lookup_target,
+					          lookup_target->thread_record->parent_identifier,
+					          lookup_target->thread_record->name,
+					          (size_t) lookup_target->thread_record->name_size,
+					          lookup_target->thread_record->codepage,
+					          file_system->use_case_folding,
+					          error );
+				}
+				if( result == 1 )
+				{
+					result = libfshfs_thread_record_free(
+					          &( lookup_target->thread_record ),
+					          error );
+				}
+			}
+			else if( ( lookup_target->directory_entry != NULL )
+			      && ( lookup_target->utf8_path != NULL ) )
+			{
+				result = libfshfs_lookup_target_get_utf8_path_segment(
+				          lookup_target,
+				          &utf8_string_segment,
+				          &utf8_string_segment_length,
+				          error );
+
+				/* Look up the next path segment in the directory of the directory entry
+				 */
+				if( result == 1 )
+				{
+					result = libfshfs_directory_entry_get_identifier(
+					          lookup_target->directory_entry,
+					          &entry_identifier,
+					          error );
+
+					if( result == 1 )
+					{
+						result = libfshfs_directory_entry_free(
+						          &( lookup_target->directory_entry ),
+						          error );
+					}
+					if( ( result == 1 )
+					 && ( utf8_string_segment_length > 0 ) )
+					{
+						result = libfshfs_lookup_target_set_utf8_name_key(
+						          lookup_target,
+						          entry_identifier,
+						          utf8_string_segment,
+						          utf8_string_segment_length,
+						          file_system->use_case_folding,
+						          error );
+					}
+				}
+			}
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set catalog key of lookup target: %d.",
+				 function,
+				 lookup_target->index );
+
+				return( -1 );
+			}
+			if( lookup_target->is_pending != 0 )
+			{
+				number_of_pending_lookup_targets++;
+			}
+		}
 	}
-	return( result );
+	return( 1 );
 }
 
-/* Retrieves an indirect node directory entry for a specific identifier
- * Returns 1 if successful, 0 if not found or -1 on error
+/* Retrieves directory entries for a specific parent identifier
+ * If a memory arena is provided the directory entries are allocated from it
+ * Returns 1 if successful or -1 on error
  */
-int libfshfs_file_system_get_indirect_node_directory_entry_by_identifier(
+int libfshfs_file_system_get_directory_entries(
      libfshfs_file_system_t *file_system,
      libfshfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
-     uint32_t identifier,
-     libfshfs_directory_entry_t **directory_entry,
+     uint32_t parent_identifier,
+     libfshfs_memory_arena_t *memory_arena,
+     libcdata_array_t **directory_entries,
      libcerror_error_t **error )
 {
-	static char *function = "libfshfs_file_system_get_indirect_node_directory_entry_by_identifier";
+	static char *function = "libfshfs_file_system_get_directory_entries";
 	int result            = 0;
 
 	if( file_system == NULL )
@@ -835,142 +2783,105 @@ int libfshfs_file_system_get_indirect_node_directory_entry_by_identifier(
 
 		return( -1 );
 	}
-	result = libfshfs_catalog_btree_file_get_directory_entry_by_identifier(
-	          file_system->catalog_btree_file,
-	          io_handle,
-	          file_io_handle,
-	          file_system->indirect_node_catalog_btree_node_cache,
-	          identifier,
-	          file_system->use_case_folding,
-	          directory_entry,
-	          error );
-
-	if( result == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve indirect node directory entry: %" PRIu32 ".",
-		 function,
-		 identifier );
-
-		return( -1 );
-	}
-	return( result );
-}
-
-/* Retrieves a directory entry for an UTF-8 encoded name
- * Returns 1 if successful, 0 if not found or -1 on error
- */
-int libfshfs_file_system_get_directory_entry_by_utf8_name(
-     libfshfs_file_system_t *file_system,
-     libfshfs_io_handle_t *io_handle,
-     libbfio_handle_t *file_io_handle,
-     uint32_t parent_identifier,
-     const uint8_t *utf8_string,
-     size_t utf8_string_length,
-     libfshfs_directory_entry_t **directory_entry,
-     libcerror_error_t **error )
-{
-	libfshfs_directory_entry_t *safe_directory_entry = NULL;
-	static char *function                            = "libfshfs_file_system_get_directory_entry_by_utf8_name";
-	uint32_t name_hash                               = 0;
-	int result                                       = 0;
-
-	if( file_system == NULL )
+	if( directory_entries == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file system.",
+		 "%s: invalid directory entries.",
 		 function );
 
 		return( -1 );
 	}
-	if( directory_entry == NULL )
+	if( libcdata_array_initialize(
+	     directory_entries,
+	     0,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory entry.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory entries array.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libfshfs_name_calculate_hash_utf8_string(
-	     (libuna_utf8_character_t *) utf8_string,
-	     utf8_string_length,
-	     file_system->use_case_folding,
-	     &name_hash,
+	if( libfshfs_btree_node_cache_grab(
+	     file_system->catalog_btree_node_cache,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GENERIC,
-		 "%s: unable to calculate name hash.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab catalog B-tree node cache.",
 		 function );
 
 		goto on_error;
 	}
-	result = libfshfs_catalog_btree_file_get_directory_entry_by_utf8_name(
+	result = libfshfs_catalog_btree_file_get_directory_entries(
 	          file_system->catalog_btree_file,
 	          io_handle,
 	          file_io_handle,
 	          file_system->catalog_btree_node_cache,
 	          parent_identifier,
-	          name_hash,
-	          utf8_string,
-	          utf8_string_length,
-	          file_system->use_case_folding,
-	          &safe_directory_entry,
+	          memory_arena,
+	          *directory_entries,
 	          error );
 
-	if( result == -1 )
+	if( libfshfs_btree_node_cache_release(
+	     file_system->catalog_btree_node_cache,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve directory entry by UTF-8 name.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release catalog B-tree node cache.",
 		 function );
 
 		goto on_error;
 	}
-	else if( result != 0 )
+	if( result != 1 )
 	{
-		*directory_entry = safe_directory_entry;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entries for entry: %" PRIu32 " from catalog B-tree file.",
+		 function,
+		 parent_identifier );
+
+		goto on_error;
 	}
-	return( result );
+	return( 1 );
 
 on_error:
-	if( safe_directory_entry != NULL )
+	if( *directory_entries != NULL )
 	{
-		libfshfs_directory_entry_free(
-		 &safe_directory_entry,
+		libcdata_array_free(
+		 directory_entries,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfshfs_directory_entry_free,
 		 NULL );
 	}
 	return( -1 );
 }
 
-/* Retrieves a directory entry for a specific identifier
- * Returns 1 if successful, 0 if not found or -1 on error
+/* Reads the next page of directory entries for a specific parent identifier
+ * Returns 1 if successful or -1 on error
  */
-int libfshfs_file_system_get_directory_entry_by_utf8_path(
+int libfshfs_file_system_read_directory_entries_page(
      libfshfs_file_system_t *file_system,
      libfshfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
-     const uint8_t *utf8_string,
-     size_t utf8_string_length,
-     libfshfs_directory_entry_t **directory_entry,
+     uint32_t parent_identifier,
+     libfshfs_directory_entries_page_t *directory_entries_page,
      libcerror_error_t **error )
 {
-	libfshfs_directory_entry_t *safe_directory_entry = NULL;
-	static char *function                            = "libfshfs_file_system_get_directory_entry_by_utf8_path";
-	int result                                       = 0;
+	static char *function = "libfshfs_file_system_read_directory_entries_page";
+	int result            = 0;
 
 	if( file_system == NULL )
 	{
@@ -983,72 +2894,75 @@ int libfshfs_file_system_get_directory_entry_by_utf8_path(
 
 		return( -1 );
 	}
-	if( directory_entry == NULL )
+	if( libfshfs_btree_node_cache_grab(
+	     file_system->catalog_btree_node_cache,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory entry.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab catalog B-tree node cache.",
 		 function );
 
 		return( -1 );
 	}
-	result = libfshfs_catalog_btree_file_get_directory_entry_by_utf8_path(
+	result = libfshfs_catalog_btree_file_read_directory_entries_page(
 	          file_system->catalog_btree_file,
 	          io_handle,
 	          file_io_handle,
 	          file_system->catalog_btree_node_cache,
-	          utf8_string,
-	          utf8_string_length,
-	          file_system->use_case_folding,
-	          &safe_directory_entry,
+	          parent_identifier,
+	          directory_entries_page,
 	          error );
 
-	if( result == -1 )
+	if( libfshfs_btree_node_cache_release(
+	     file_system->catalog_btree_node_cache,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve directory entry by UTF-8 path.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release catalog B-tree node cache.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	else if( result != 0 )
+	if( result != 1 )
 	{
-		*directory_entry = safe_directory_entry;
-	}
-	return( result );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read directory entries page for entry: %" PRIu32 " from catalog B-tree file.",
+		 function,
+		 parent_identifier );
 
-on_error:
-	if( safe_directory_entry != NULL )
-	{
-		libfshfs_directory_entry_free(
-		 &safe_directory_entry,
-		 NULL );
+		return( -1 );
 	}
-	return( -1 );
+	return( 1 );
 }
 
-/* Retrieves a directory entry for an UTF-16 encoded name
- * Returns 1 if successful, 0 if not found or -1 on error
+/* Iterates over the directory and file records in the catalog
+ * Returns 1 if successful or -1 on error
  */
-int libfshfs_file_system_get_directory_entry_by_utf16_name(
+int libfshfs_file_system_iterate_catalog_records(
      libfshfs_file_system_t *file_system,
      libfshfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
-     uint32_t parent_identifier,
-     const uint16_t *utf16_string,
-     size_t utf16_string_length,
-     libfshfs_directory_entry_t **directory_entry,
+     int (*callback_function)(
+            uint32_t parent_identifier,
+            const uint8_t *name_data,
+            size_t name_size,
+            const libfshfs_file_entry_stat_t *stat_value,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
      libcerror_error_t **error )
 {
-	libfshfs_directory_entry_t *safe_directory_entry = NULL;
-	static char *function                            = "libfshfs_file_system_get_directory_entry_by_utf16_name";
-	uint32_t name_hash                               = 0;
-	int result                                       = 0;
+	static char *function = "libfshfs_file_system_iterate_catalog_records";
+	int result            = 0;
 
 	if( file_system == NULL )
 	{
@@ -1061,88 +2975,74 @@ int libfshfs_file_system_get_directory_entry_by_utf16_name(
 
 		return( -1 );
 	}
-	if( directory_entry == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory entry.",
-		 function );
-
-		return( -1 );
-	}
-	if( libfshfs_name_calculate_hash_utf16_string(
-	     (libuna_utf16_character_t *) utf16_string,
-	     utf16_string_length,
-	     file_system->use_case_folding,
-	     &name_hash,
+	if( libfshfs_btree_node_cache_grab(
+	     file_system->catalog_btree_node_cache,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GENERIC,
-		 "%s: unable to calculate name hash.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab catalog B-tree node cache.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	result = libfshfs_catalog_btree_file_get_directory_entry_by_utf16_name(
+	result = libfshfs_catalog_btree_file_iterate_records(
 	          file_system->catalog_btree_file,
 	          io_handle,
 	          file_io_handle,
 	          file_system->catalog_btree_node_cache,
-	          parent_identifier,
-	          name_hash,
-	          utf16_string,
-	          utf16_string_length,
-	          file_system->use_case_folding,
-	          &safe_directory_entry,
+	          callback_function,
+	          callback_data,
 	          error );
 
-	if( result == -1 )
+	if( libfshfs_btree_node_cache_release(
+	     file_system->catalog_btree_node_cache,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve directory entry by UTF-16 name.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release catalog B-tree node cache.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	else if( result != 0 )
+	if( result != 1 )
 	{
-		*directory_entry = safe_directory_entry;
-	}
-	return( result );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to iterate records of catalog B-tree file.",
+		 function );
 
-on_error:
-	if( safe_directory_entry != NULL )
-	{
-		libfshfs_directory_entry_free(
-		 &safe_directory_entry,
-		 NULL );
+		return( -1 );
 	}
-	return( -1 );
+	return( 1 );
 }
 
-/* Retrieves a directory entry for a specific identifier
- * Returns 1 if successful, 0 if not found or -1 on error
+/* Iterates over the directory and file records of a specific parent identifier in the catalog
+ * Returns 1 if successful or -1 on error
  */
-int libfshfs_file_system_get_directory_entry_by_utf16_path(
+int libfshfs_file_system_iterate_sub_catalog_records(
      libfshfs_file_system_t *file_system,
      libfshfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
-     const uint16_t *utf16_string,
-     size_t utf16_string_length,
-     libfshfs_directory_entry_t **directory_entry,
+     uint32_t parent_identifier,
+     int (*callback_function)(
+            libfshfs_catalog_btree_key_t *node_key,
+            const libfshfs_file_entry_stat_t *stat_value,
+            uint32_t link_reference,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
      libcerror_error_t **error )
 {
-	libfshfs_directory_entry_t *safe_directory_entry = NULL;
-	static char *function                            = "libfshfs_file_system_get_directory_entry_by_utf16_path";
-	int result                                       = 0;
+	static char *function = "libfshfs_file_system_iterate_sub_catalog_records";
+	int result            = 0;
 
 	if( file_system == NULL )
 	{
@@ -1155,67 +3055,70 @@ int libfshfs_file_system_get_directory_entry_by_utf16_path(
 
 		return( -1 );
 	}
-	if( directory_entry == NULL )
+	if( libfshfs_btree_node_cache_grab(
+	     file_system->catalog_btree_node_cache,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory entry.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab catalog B-tree node cache.",
 		 function );
 
 		return( -1 );
 	}
-	result = libfshfs_catalog_btree_file_get_directory_entry_by_utf16_path(
+	result = libfshfs_catalog_btree_file_iterate_sub_records(
 	          file_system->catalog_btree_file,
 	          io_handle,
 	          file_io_handle,
 	          file_system->catalog_btree_node_cache,
-	          utf16_string,
-	          utf16_string_length,
-	          file_system->use_case_folding,
-	          &safe_directory_entry,
+	          parent_identifier,
+	          callback_function,
+	          callback_data,
 	          error );
 
-	if( result == -1 )
+	if( libfshfs_btree_node_cache_release(
+	     file_system->catalog_btree_node_cache,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve directory entry by UTF-16 path.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release catalog B-tree node cache.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	else if( result != 0 )
+	if( result != 1 )
 	{
-		*directory_entry = safe_directory_entry;
-	}
-	return( result );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to iterate records of entry: %" PRIu32 " in catalog B-tree file.",
+		 function,
+		 parent_identifier );
 
-on_error:
-	if( safe_directory_entry != NULL )
-	{
-		libfshfs_directory_entry_free(
-		 &safe_directory_entry,
-		 NULL );
+		return( -1 );
 	}
-	return( -1 );
+	return( 1 );
 }
 
-/* Retrieves directory entries for a specific parent identifier
+/* Retrieves the number of directory and file records of a specific parent identifier in the catalog
  * Returns 1 if successful or -1 on error
  */
-int libfshfs_file_system_get_directory_entries(
+int libfshfs_file_system_get_number_of_sub_catalog_records(
      libfshfs_file_system_t *file_system,
      libfshfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      uint32_t parent_identifier,
-     libcdata_array_t **directory_entries,
+     int *number_of_sub_catalog_records,
      libcerror_error_t **error )
 {
-	static char *function = "libfshfs_file_system_get_directory_entries";
+	static char *function = "libfshfs_file_system_get_number_of_sub_catalog_records";
+	int result            = 0;
 
 	if( file_system == NULL )
 	{
@@ -1228,61 +3131,54 @@ int libfshfs_file_system_get_directory_entries(
 
 		return( -1 );
 	}
-	if( directory_entries == NULL )
+	if( libfshfs_btree_node_cache_grab(
+	     file_system->catalog_btree_node_cache,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory entries.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab catalog B-tree node cache.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_initialize(
-	     directory_entries,
-	     0,
+	result = libfshfs_catalog_btree_file_get_number_of_sub_records(
+	          file_system->catalog_btree_file,
+	          io_handle,
+	          file_io_handle,
+	          file_system->catalog_btree_node_cache,
+	          parent_identifier,
+	          number_of_sub_catalog_records,
+	          error );
+
+	if( libfshfs_btree_node_cache_release(
+	     file_system->catalog_btree_node_cache,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create directory entries array.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release catalog B-tree node cache.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfshfs_catalog_btree_file_get_directory_entries(
-	     file_system->catalog_btree_file,
-	     io_handle,
-	     file_io_handle,
-	     file_system->catalog_btree_node_cache,
-	     parent_identifier,
-	     *directory_entries,
-	     error ) != 1 )
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve directory entries for entry: %" PRIu32 " from catalog B-tree file.",
+		 "%s: unable to retrieve number of records of entry: %" PRIu32 " in catalog B-tree file.",
 		 function,
 		 parent_identifier );
 
-		goto on_error;
+		return( -1 );
 	}
 	return( 1 );
-
-on_error:
-	if( *directory_entries != NULL )
-	{
-		libcdata_array_free(
-		 directory_entries,
-		 (int (*)(intptr_t **, libcerror_error_t **)) &libfshfs_directory_entry_free,
-		 NULL );
-	}
-	return( -1 );
 }
 
 /* Retrieves extents for a specific fork descriptor
@@ -1368,14 +3264,56 @@ int libfshfs_file_system_get_extents(
 	}
 	else if( result != 0 )
 	{
-		if( libfshfs_extents_btree_file_get_extents(
-		     file_system->extents_btree_file,
+		if( libfshfs_file_system_read_deferred_extents_file(
+		     file_system,
 		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read deferred extents B-tree file.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfshfs_btree_node_cache_grab(
+		     file_system->extents_btree_node_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab extents B-tree node cache.",
+			 function );
+
+			goto on_error;
+		}
+		result = libfshfs_extents_btree_file_get_extents(
+		          file_system->extents_btree_file,
+		          file_io_handle,
+		          file_system->extents_btree_node_cache,
+		          identifier,
+		          fork_type,
+		          *extents,
+		          error );
+
+		if( libfshfs_btree_node_cache_release(
 		     file_system->extents_btree_node_cache,
-		     identifier,
-		     fork_type,
-		     *extents,
 		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release extents B-tree node cache.",
+			 function );
+
+			goto on_error;
+		}
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -1411,7 +3349,9 @@ int libfshfs_file_system_get_attributes(
      libcdata_array_t **attributes,
      libcerror_error_t **error )
 {
-	static char *function = "libfshfs_file_system_get_attributes";
+	libfshfs_attributes_index_entry_t *attributes_index_entry = NULL;
+	static char *function                                     = "libfshfs_file_system_get_attributes";
+	int result                                                = 0;
 
 	if( file_system == NULL )
 	{
@@ -1435,6 +3375,20 @@ int libfshfs_file_system_get_attributes(
 
 		return( -1 );
 	}
+	if( libfshfs_file_system_read_deferred_attributes_file(
+	     file_system,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read deferred attributes B-tree file.",
+		 function );
+
+		return( -1 );
+	}
 	if( libcdata_array_initialize(
 	     attributes,
 	     0,
@@ -1449,15 +3403,113 @@ int libfshfs_file_system_get_attributes(
 
 		goto on_error;
 	}
-	if( file_system->attributes_btree_file != NULL )
+	if( file_system->attributes_index != NULL )
 	{
-		if( libfshfs_attributes_btree_file_get_attributes(
-		     file_system->attributes_btree_file,
-		     file_io_handle,
+		result = libfshfs_attributes_index_get_entry_by_identifier(
+		          file_system->attributes_index,
+		          parent_identifier,
+		          &attributes_index_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve attributes index entry: %" PRIu32 ".",
+			 function,
+			 parent_identifier );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( libfshfs_btree_node_cache_grab(
+			     file_system->attributes_btree_node_cache,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab attributes B-tree node cache.",
+				 function );
+
+				goto on_error;
+			}
+			result = libfshfs_attributes_btree_file_get_attributes_from_index_entry(
+			          file_system->attributes_btree_file,
+			          file_io_handle,
+			          file_system->attributes_btree_node_cache,
+			          attributes_index_entry,
+			          *attributes,
+			          error );
+
+			if( libfshfs_btree_node_cache_release(
+			     file_system->attributes_btree_node_cache,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release attributes B-tree node cache.",
+				 function );
+
+				goto on_error;
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve attributes for entry: %" PRIu32 " from attributes B-tree file.",
+				 function,
+				 parent_identifier );
+
+				goto on_error;
+			}
+		}
+	}
+	else if( file_system->attributes_btree_file != NULL )
+	{
+		if( libfshfs_btree_node_cache_grab(
+		     file_system->attributes_btree_node_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab attributes B-tree node cache.",
+			 function );
+
+			goto on_error;
+		}
+		result = libfshfs_attributes_btree_file_get_attributes(
+		          file_system->attributes_btree_file,
+		          file_io_handle,
+		          file_system->attributes_btree_node_cache,
+		          parent_identifier,
+		          *attributes,
+		          error );
+
+		if( libfshfs_btree_node_cache_release(
 		     file_system->attributes_btree_node_cache,
-		     parent_identifier,
-		     *attributes,
 		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release attributes B-tree node cache.",
+			 function );
+
+			goto on_error;
+		}
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -1483,3 +3535,71 @@ on_error:
 	return( -1 );
 }
 
+/* Retrieves the attributes index flags for a specific identifier
+ * Returns 1 if successful, 0 if the attributes index is not available or -1 on error
+ */
+int libfshfs_file_system_get_attributes_index_flags(
+     libfshfs_file_system_t *file_system,
+     uint32_t identifier,
+     uint8_t *flags,
+     libcerror_error_t **error )
+{
+	libfshfs_attributes_index_entry_t *attributes_index_entry = NULL;
+	static char *function                                     = "libfshfs_file_system_get_attributes_index_flags";
+	int result                                                = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->attributes_index == NULL )
+	{
+		return( 0 );
+	}
+	result = libfshfs_attributes_index_get_entry_by_identifier(
+	          file_system->attributes_index,
+	          identifier,
+	          &attributes_index_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve attributes index entry: %" PRIu32 ".",
+		 function,
+		 identifier );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		*flags = 0;
+	}
+	else
+	{
+		*flags = attributes_index_entry->flags;
+	}
+	return( 1 );
+}
+
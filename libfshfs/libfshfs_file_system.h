@@ -25,14 +25,22 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfshfs_attributes_index.h"
 #include "libfshfs_btree_file.h"
 #include "libfshfs_btree_node_cache.h"
+#include "libfshfs_catalog_btree_key.h"
+#include "libfshfs_catalog_index.h"
+#include "libfshfs_directory_entries_page.h"
 #include "libfshfs_directory_entry.h"
 #include "libfshfs_fork_descriptor.h"
 #include "libfshfs_io_handle.h"
 #include "libfshfs_libbfio.h"
 #include "libfshfs_libcerror.h"
 #include "libfshfs_libcthreads.h"
+#include "libfshfs_lookup_target.h"
+#include "libfshfs_memory_arena.h"
+#include "libfshfs_path_cache.h"
+#include "libfshfs_types.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -62,6 +70,14 @@ struct libfshfs_file_system
 	 */
 	libfshfs_btree_node_cache_t *indirect_node_catalog_btree_node_cache;
 
+	/* The catalog index
+	 */
+	libfshfs_catalog_index_t *catalog_index;
+
+	/* The indirect node index
+	 */
+	libfshfs_catalog_index_t *indirect_node_index;
+
 	/* The attributes B-tree file
 	 */
 	libfshfs_btree_file_t *attributes_btree_file;
@@ -70,6 +86,26 @@ struct libfshfs_file_system
 	 */
 	libfshfs_btree_node_cache_t *attributes_btree_node_cache;
 
+	/* The attributes index
+	 */
+	libfshfs_attributes_index_t *attributes_index;
+
+	/* The path cache
+	 */
+	libfshfs_path_cache_t *path_cache;
+
+	/* The IO handle used to read deferred B-tree files
+	 */
+	libfshfs_io_handle_t *deferred_io_handle;
+
+	/* The extents B-tree file fork descriptor, if reading the extents B-tree file was deferred
+	 */
+	libfshfs_fork_descriptor_t *deferred_extents_file_fork_descriptor;
+
+	/* The attributes B-tree file fork descriptor, if reading the attributes B-tree file was deferred
+	 */
+	libfshfs_fork_descriptor_t *deferred_attributes_file_fork_descriptor;
+
 	/* Flag to indicate case folding should be used
 	 */
 	uint8_t use_case_folding;
@@ -97,6 +133,11 @@ int libfshfs_file_system_read_attributes_file(
      libfshfs_fork_descriptor_t *fork_descriptor,
      libcerror_error_t **error );
 
+int libfshfs_file_system_read_attributes_index(
+     libfshfs_file_system_t *file_system,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
 int libfshfs_file_system_read_catalog_file(
      libfshfs_file_system_t *file_system,
      libfshfs_io_handle_t *io_handle,
@@ -104,6 +145,18 @@ int libfshfs_file_system_read_catalog_file(
      libfshfs_fork_descriptor_t *fork_descriptor,
      libcerror_error_t **error );
 
+int libfshfs_file_system_read_catalog_index(
+     libfshfs_file_system_t *file_system,
+     libfshfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libfshfs_file_system_read_indirect_node_index(
+     libfshfs_file_system_t *file_system,
+     libfshfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
 int libfshfs_file_system_read_extents_file(
      libfshfs_file_system_t *file_system,
      libfshfs_io_handle_t *io_handle,
@@ -111,6 +164,23 @@ int libfshfs_file_system_read_extents_file(
      libfshfs_fork_descriptor_t *fork_descriptor,
      libcerror_error_t **error );
 
+int libfshfs_file_system_set_deferred_files(
+     libfshfs_file_system_t *file_system,
+     libfshfs_io_handle_t *io_handle,
+     libfshfs_fork_descriptor_t *extents_file_fork_descriptor,
+     libfshfs_fork_descriptor_t *attributes_file_fork_descriptor,
+     libcerror_error_t **error );
+
+int libfshfs_file_system_read_deferred_extents_file(
+     libfshfs_file_system_t *file_system,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libfshfs_file_system_read_deferred_attributes_file(
+     libfshfs_file_system_t *file_system,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
 int libfshfs_file_system_get_directory_entry_by_identifier(
      libfshfs_file_system_t *file_system,
      libfshfs_io_handle_t *io_handle,
@@ -119,6 +189,17 @@ int libfshfs_file_system_get_directory_entry_by_identifier(
      libfshfs_directory_entry_t **directory_entry,
      libcerror_error_t **error );
 
+int libfshfs_file_system_get_number_of_directory_entries(
+     libfshfs_file_system_t *file_system,
+     int *number_of_directory_entries,
+     libcerror_error_t **error );
+
+int libfshfs_file_system_get_directory_entry_identifier_by_index(
+     libfshfs_file_system_t *file_system,
+     int directory_entry_index,
+     uint32_t *identifier,
+     libcerror_error_t **error );
+
 int libfshfs_file_system_get_indirect_node_directory_entry_by_identifier(
      libfshfs_file_system_t *file_system,
      libfshfs_io_handle_t *io_handle,
@@ -165,14 +246,67 @@ int libfshfs_file_system_get_directory_entry_by_utf16_path(
      libfshfs_directory_entry_t **directory_entry,
      libcerror_error_t **error );
 
+int libfshfs_file_system_get_directory_entries_by_lookup_targets(
+     libfshfs_file_system_t *file_system,
+     libfshfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfshfs_lookup_target_t *lookup_targets,
+     int number_of_lookup_targets,
+     libcerror_error_t **error );
+
 int libfshfs_file_system_get_directory_entries(
      libfshfs_file_system_t *file_system,
      libfshfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      uint32_t parent_identifier,
+     libfshfs_memory_arena_t *memory_arena,
      libcdata_array_t **directory_entries,
      libcerror_error_t **error );
 
+int libfshfs_file_system_read_directory_entries_page(
+     libfshfs_file_system_t *file_system,
+     libfshfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t parent_identifier,
+     libfshfs_directory_entries_page_t *directory_entries_page,
+     libcerror_error_t **error );
+
+int libfshfs_file_system_iterate_catalog_records(
+     libfshfs_file_system_t *file_system,
+     libfshfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     int (*callback_function)(
+            uint32_t parent_identifier,
+            const uint8_t *name_data,
+            size_t name_size,
+            const libfshfs_file_entry_stat_t *stat_value,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libfshfs_file_system_iterate_sub_catalog_records(
+     libfshfs_file_system_t *file_system,
+     libfshfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t parent_identifier,
+     int (*callback_function)(
+            libfshfs_catalog_btree_key_t *node_key,
+            const libfshfs_file_entry_stat_t *stat_value,
+            uint32_t link_reference,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libfshfs_file_system_get_number_of_sub_catalog_records(
+     libfshfs_file_system_t *file_system,
+     libfshfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t parent_identifier,
+     int *number_of_sub_catalog_records,
+     libcerror_error_t **error );
+
 int libfshfs_file_system_get_extents(
      libfshfs_file_system_t *file_system,
      libbfio_handle_t *file_io_handle,
@@ -24,9 +24,11 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfshfs_definitions.h"
 #include "libfshfs_io_handle.h"
 #include "libfshfs_libcerror.h"
 #include "libfshfs_profiler.h"
+#include "libfshfs_statistics.h"
 
 /* Creates an IO handle
  * Make sure the value io_handle is referencing, is set to NULL
@@ -93,6 +95,21 @@ int libfshfs_io_handle_initialize(
 
 		return( -1 );
 	}
+	( *io_handle )->maximum_read_ahead_size = LIBFSHFS_READ_AHEAD_DEFAULT_MAXIMUM_WINDOW_SIZE;
+
+	if( libfshfs_statistics_initialize(
+	     &( ( *io_handle )->statistics ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create statistics.",
+		 function );
+
+		goto on_error;
+	}
 #if defined( HAVE_PROFILER )
 	if( libfshfs_profiler_initialize(
 	     &( ( *io_handle )->profiler ),
@@ -128,6 +145,12 @@ int libfshfs_io_handle_initialize(
 on_error:
 	if( *io_handle != NULL )
 	{
+		if( ( *io_handle )->statistics != NULL )
+		{
+			libfshfs_statistics_free(
+			 &( ( *io_handle )->statistics ),
+			 NULL );
+		}
 #if defined( HAVE_PROFILER )
 		if( ( *io_handle )->profiler != NULL )
 		{
@@ -195,6 +218,19 @@ int libfshfs_io_handle_free(
 			result = -1;
 		}
 #endif /* defined( HAVE_PROFILER ) */
+		if( libfshfs_statistics_free(
+		     &( ( *io_handle )->statistics ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free statistics.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
 		 *io_handle );
 
@@ -210,10 +246,12 @@ int libfshfs_io_handle_clear(
      libfshfs_io_handle_t *io_handle,
      libcerror_error_t **error )
 {
-	static char *function         = "libfshfs_io_handle_clear";
+	libfshfs_statistics_t *statistics = NULL;
+	static char *function             = "libfshfs_io_handle_clear";
+	size_t maximum_read_ahead_size    = 0;
 
 #if defined( HAVE_PROFILER )
-	libfshfs_profiler_t *profiler = NULL;
+	libfshfs_profiler_t *profiler     = NULL;
 #endif
 
 	if( io_handle == NULL )
@@ -227,6 +265,11 @@ int libfshfs_io_handle_clear(
 
 		return( -1 );
 	}
+	/* The statistics are retained so that they accumulate until reset
+	 */
+	maximum_read_ahead_size = io_handle->maximum_read_ahead_size;
+	statistics              = io_handle->statistics;
+
 #if defined( HAVE_PROFILER )
 	profiler = io_handle->profiler;
 #endif
@@ -244,6 +287,8 @@ int libfshfs_io_handle_clear(
 
 		return( -1 );
 	}
+	io_handle->maximum_read_ahead_size = maximum_read_ahead_size;
+	io_handle->statistics              = statistics;
 
 #if defined( HAVE_PROFILER )
 	io_handle->profiler = profiler;
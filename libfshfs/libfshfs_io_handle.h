@@ -27,6 +27,7 @@
 
 #include "libfshfs_libcerror.h"
 #include "libfshfs_profiler.h"
+#include "libfshfs_statistics.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -44,6 +45,23 @@ struct libfshfs_io_handle
 	 */
 	uint32_t block_size;
 
+	/* The maximum read-ahead size, where 0 disables read-ahead
+	 */
+	size_t maximum_read_ahead_size;
+
+	/* The memory mapped data of the volume, where NULL if not available
+	 * The mapped data is not owned by the IO handle
+	 */
+	const uint8_t *mapped_data;
+
+	/* The memory mapped data size
+	 */
+	size64_t mapped_data_size;
+
+	/* The statistics
+	 */
+	libfshfs_statistics_t *statistics;
+
 #if defined( HAVE_PROFILER )
 	/* The profiler
 	 */
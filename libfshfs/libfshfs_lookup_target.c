@@ -0,0 +1,477 @@
+/*
+ * Lookup target functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfshfs_definitions.h"
+#include "libfshfs_directory_entry.h"
+#include "libfshfs_libcerror.h"
+#include "libfshfs_libuna.h"
+#include "libfshfs_lookup_target.h"
+#include "libfshfs_name.h"
+#include "libfshfs_thread_record.h"
+
+/* Frees the folded name of the catalog key of a lookup target
+ */
+void libfshfs_lookup_target_free_folded_name(
+      libfshfs_lookup_target_t *lookup_target )
+{
+	if( lookup_target->folded_name != NULL )
+	{
+		memory_free(
+		 lookup_target->folded_name );
+
+		lookup_target->folded_name = NULL;
+	}
+	lookup_target->folded_name_length = 0;
+}
+
+/* Clears a lookup target
+ * Frees the folded name and the thread record and directory entry that were found
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_lookup_target_clear(
+     libfshfs_lookup_target_t *lookup_target,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_lookup_target_clear";
+	int result            = 1;
+
+	if( lookup_target == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lookup target.",
+		 function );
+
+		return( -1 );
+	}
+	libfshfs_lookup_target_free_folded_name(
+	 lookup_target );
+
+	if( lookup_target->thread_record != NULL )
+	{
+		if( libfshfs_thread_record_free(
+		     &( lookup_target->thread_record ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free thread record.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( lookup_target->directory_entry != NULL )
+	{
+		if( libfshfs_directory_entry_free(
+		     &( lookup_target->directory_entry ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory entry.",
+			 function );
+
+			result = -1;
+		}
+	}
+	lookup_target->is_pending = 0;
+
+	return( result );
+}
+
+/* Sets the catalog key of a lookup target to that of the thread record of an identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_lookup_target_set_thread_record_key(
+     libfshfs_lookup_target_t *lookup_target,
+     uint32_t identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_lookup_target_set_thread_record_key";
+
+	if( lookup_target == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lookup target.",
+		 function );
+
+		return( -1 );
+	}
+	libfshfs_lookup_target_free_folded_name(
+	 lookup_target );
+
+	lookup_target->parent_identifier = identifier;
+	lookup_target->is_pending        = 1;
+
+	return( 1 );
+}
+
+/* Sets the catalog key of a lookup target to a parent identifier and name
+ * The name is stored in the same way as the name of a catalog B-tree key
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_lookup_target_set_name_key(
+     libfshfs_lookup_target_t *lookup_target,
+     uint32_t parent_identifier,
+     const uint8_t *name,
+     size_t name_size,
+     int codepage,
+     uint8_t use_case_folding,
+     libcerror_error_t **error )
+{
+	static char *function   = "libfshfs_lookup_target_set_name_key";
+	size_t folded_name_size = 0;
+
+	if( lookup_target == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lookup target.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_size == 0 )
+	 || ( name_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libuna_unicode_character_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	libfshfs_lookup_target_free_folded_name(
+	 lookup_target );
+
+	folded_name_size = name_size;
+
+	if( codepage == LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN )
+	{
+		folded_name_size = ( folded_name_size + 1 ) / 2;
+	}
+	lookup_target->folded_name = (libuna_unicode_character_t *) memory_allocate(
+	                              sizeof( libuna_unicode_character_t ) * folded_name_size );
+
+	if( lookup_target->folded_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create folded name.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfshfs_name_get_folded_name(
+	     name,
+	     name_size,
+	     codepage,
+	     use_case_folding,
+	     lookup_target->folded_name,
+	     folded_name_size,
+	     &( lookup_target->folded_name_length ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve folded name.",
+		 function );
+
+		goto on_error;
+	}
+	lookup_target->parent_identifier = parent_identifier;
+	lookup_target->is_pending        = 1;
+
+	return( 1 );
+
+on_error:
+	libfshfs_lookup_target_free_folded_name(
+	 lookup_target );
+
+	return( -1 );
+}
+
+/* Sets the catalog key of a lookup target to a parent identifier and UTF-8 encoded name
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_lookup_target_set_utf8_name_key(
+     libfshfs_lookup_target_t *lookup_target,
+     uint32_t parent_identifier,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint8_t use_case_folding,
+     libcerror_error_t **error )
+{
+	static char *function   = "libfshfs_lookup_target_set_utf8_name_key";
+	size_t folded_name_size = 0;
+
+	if( lookup_target == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lookup target.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_length == 0 )
+	 || ( utf8_string_length > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 4 * sizeof( libuna_unicode_character_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	libfshfs_lookup_target_free_folded_name(
+	 lookup_target );
+
+	/* A single UTF-8 encoded character decomposes into at most 4 Unicode characters
+	 */
+	folded_name_size = utf8_string_length * 4;
+
+	lookup_target->folded_name = (libuna_unicode_character_t *) memory_allocate(
+	                              sizeof( libuna_unicode_character_t ) * folded_name_size );
+
+	if( lookup_target->folded_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create folded name.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfshfs_name_get_folded_name_from_utf8_string(
+	     utf8_string,
+	     utf8_string_length,
+	     use_case_folding,
+	     lookup_target->folded_name,
+	     folded_name_size,
+	     &( lookup_target->folded_name_length ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve folded name.",
+		 function );
+
+		goto on_error;
+	}
+	lookup_target->parent_identifier = parent_identifier;
+	lookup_target->is_pending        = 1;
+
+	return( 1 );
+
+on_error:
+	libfshfs_lookup_target_free_folded_name(
+	 lookup_target );
+
+	return( -1 );
+}
+
+/* Retrieves the next segment of the UTF-8 encoded path of a lookup target
+ * A segment ends at a separator or an end-of-string character, the segment length can be 0
+ * Returns 1 if successful, 0 if there are no more segments or -1 on error
+ */
+int libfshfs_lookup_target_get_utf8_path_segment(
+     libfshfs_lookup_target_t *lookup_target,
+     const uint8_t **utf8_string_segment,
+     size_t *utf8_string_segment_length,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libfshfs_lookup_target_get_utf8_path_segment";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t segment_index                         = 0;
+
+	if( lookup_target == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lookup target.",
+		 function );
+
+		return( -1 );
+	}
+	if( lookup_target->utf8_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid lookup target - missing UTF-8 path.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_segment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string segment.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_segment_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string segment length.",
+		 function );
+
+		return( -1 );
+	}
+	if( lookup_target->utf8_path_index >= lookup_target->utf8_path_length )
+	{
+		return( 0 );
+	}
+	segment_index = lookup_target->utf8_path_index;
+
+	*utf8_string_segment        = &( lookup_target->utf8_path[ segment_index ] );
+	*utf8_string_segment_length = 0;
+
+	while( lookup_target->utf8_path_index < lookup_target->utf8_path_length )
+	{
+		if( libuna_unicode_character_copy_from_utf8(
+		     &unicode_character,
+		     lookup_target->utf8_path,
+		     lookup_target->utf8_path_length,
+		     &( lookup_target->utf8_path_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-8 string to Unicode character.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( unicode_character == (libuna_unicode_character_t) LIBFSHFS_SEPARATOR )
+		 || ( unicode_character == 0 ) )
+		{
+			segment_index += 1;
+
+			break;
+		}
+	}
+	*utf8_string_segment_length = lookup_target->utf8_path_index - segment_index;
+
+	return( 1 );
+}
+
+/* Compares two lookup targets by the catalog key that is looked up
+ * Pending targets sort before other targets and are ordered in the same way as
+ * the catalog B-tree keys, by parent identifier and then by folded name
+ * Returns -1 if the first target is less than the second, 0 if equal or 1 if greater
+ */
+int libfshfs_lookup_target_compare_by_key(
+     const libfshfs_lookup_target_t *first_lookup_target,
+     const libfshfs_lookup_target_t *second_lookup_target )
+{
+	int result = 0;
+
+	if( first_lookup_target->is_pending > second_lookup_target->is_pending )
+	{
+		return( -1 );
+	}
+	else if( first_lookup_target->is_pending < second_lookup_target->is_pending )
+	{
+		return( 1 );
+	}
+	if( first_lookup_target->is_pending != 0 )
+	{
+		if( first_lookup_target->parent_identifier < second_lookup_target->parent_identifier )
+		{
+			return( -1 );
+		}
+		else if( first_lookup_target->parent_identifier > second_lookup_target->parent_identifier )
+		{
+			return( 1 );
+		}
+		result = libfshfs_name_compare_folded_names(
+		          first_lookup_target->folded_name,
+		          first_lookup_target->folded_name_length,
+		          second_lookup_target->folded_name,
+		          second_lookup_target->folded_name_length,
+		          NULL );
+
+		if( result == LIBUNA_COMPARE_LESS )
+		{
+			return( -1 );
+		}
+		else if( result == LIBUNA_COMPARE_GREATER )
+		{
+			return( 1 );
+		}
+	}
+	/* Keep the order of the request for duplicate keys
+	 */
+	if( first_lookup_target->index < second_lookup_target->index )
+	{
+		return( -1 );
+	}
+	else if( first_lookup_target->index > second_lookup_target->index )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
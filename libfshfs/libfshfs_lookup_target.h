@@ -0,0 +1,131 @@
+/*
+ * Lookup target functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSHFS_LOOKUP_TARGET_H )
+#define _LIBFSHFS_LOOKUP_TARGET_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfshfs_directory_entry.h"
+#include "libfshfs_libcerror.h"
+#include "libfshfs_libuna.h"
+#include "libfshfs_thread_record.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfshfs_lookup_target libfshfs_lookup_target_t;
+
+struct libfshfs_lookup_target
+{
+	/* The identifier (CNID)
+	 */
+	uint32_t identifier;
+
+	/* The UTF-8 encoded path or NULL if the target is looked up by identifier
+	 */
+	const uint8_t *utf8_path;
+
+	/* The UTF-8 encoded path length
+	 */
+	size_t utf8_path_length;
+
+	/* The index of the next segment in the UTF-8 encoded path
+	 */
+	size_t utf8_path_index;
+
+	/* The parent identifier (CNID) of the catalog key that is looked up
+	 */
+	uint32_t parent_identifier;
+
+	/* The folded name of the catalog key that is looked up
+	 * or NULL if the thread record of the parent identifier is looked up
+	 */
+	libuna_unicode_character_t *folded_name;
+
+	/* The folded name length
+	 */
+	size_t folded_name_length;
+
+	/* The thread record that was found
+	 */
+	libfshfs_thread_record_t *thread_record;
+
+	/* The directory entry that was found
+	 */
+	libfshfs_directory_entry_t *directory_entry;
+
+	/* Value to indicate the catalog key of the target still needs to be looked up
+	 */
+	uint8_t is_pending;
+
+	/* The index of the target in the lookup request
+	 */
+	int index;
+};
+
+void libfshfs_lookup_target_free_folded_name(
+      libfshfs_lookup_target_t *lookup_target );
+
+int libfshfs_lookup_target_clear(
+     libfshfs_lookup_target_t *lookup_target,
+     libcerror_error_t **error );
+
+int libfshfs_lookup_target_set_thread_record_key(
+     libfshfs_lookup_target_t *lookup_target,
+     uint32_t identifier,
+     libcerror_error_t **error );
+
+int libfshfs_lookup_target_set_name_key(
+     libfshfs_lookup_target_t *lookup_target,
+     uint32_t parent_identifier,
+     const uint8_t *name,
+     size_t name_size,
+     int codepage,
+     uint8_t use_case_folding,
+     libcerror_error_t **error );
+
+int libfshfs_lookup_target_set_utf8_name_key(
+     libfshfs_lookup_target_t *lookup_target,
+     uint32_t parent_identifier,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint8_t use_case_folding,
+     libcerror_error_t **error );
+
+int libfshfs_lookup_target_get_utf8_path_segment(
+     libfshfs_lookup_target_t *lookup_target,
+     const uint8_t **utf8_string_segment,
+     size_t *utf8_string_segment_length,
+     libcerror_error_t **error );
+
+int libfshfs_lookup_target_compare_by_key(
+     const libfshfs_lookup_target_t *first_lookup_target,
+     const libfshfs_lookup_target_t *second_lookup_target );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSHFS_LOOKUP_TARGET_H ) */
+
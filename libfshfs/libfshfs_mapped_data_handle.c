@@ -0,0 +1,334 @@
+/*
+ * Mapped data handle functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfshfs_libbfio.h"
+#include "libfshfs_libcerror.h"
+#include "libfshfs_libfdata.h"
+#include "libfshfs_mapped_data_handle.h"
+#include "libfshfs_statistics.h"
+#include "libfshfs_unused.h"
+
+/* Creates a mapped data handle
+ * Make sure the value data_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_mapped_data_handle_initialize(
+     libfshfs_mapped_data_handle_t **data_handle,
+     const uint8_t *mapped_data,
+     size64_t mapped_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_mapped_data_handle_initialize";
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( mapped_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped data.",
+		 function );
+
+		return( -1 );
+	}
+	if( mapped_data_size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid mapped data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*data_handle = memory_allocate_structure(
+	                libfshfs_mapped_data_handle_t );
+
+	if( *data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *data_handle,
+	     0,
+	     sizeof( libfshfs_mapped_data_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *data_handle )->mapped_data      = mapped_data;
+	( *data_handle )->mapped_data_size = mapped_data_size;
+
+	return( 1 );
+
+on_error:
+	if( *data_handle != NULL )
+	{
+		memory_free(
+		 *data_handle );
+
+		*data_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a mapped data handle
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_mapped_data_handle_free(
+     libfshfs_mapped_data_handle_t **data_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_mapped_data_handle_free";
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_handle != NULL )
+	{
+		/* The mapped data is not managed by the data handle
+		 */
+		memory_free(
+		 *data_handle );
+
+		*data_handle = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads data from the current offset into a buffer
+ * Callback for the data stream
+ * The data is copied directly from the mapped data, the file IO handle is not used
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfshfs_mapped_data_handle_read_segment_data(
+         libfshfs_mapped_data_handle_t *data_handle,
+         libbfio_handle_t *file_io_handle LIBFSHFS_ATTRIBUTE_UNUSED,
+         int segment_index LIBFSHFS_ATTRIBUTE_UNUSED,
+         int segment_file_index LIBFSHFS_ATTRIBUTE_UNUSED,
+         uint8_t *segment_data,
+         size_t segment_data_size,
+         uint32_t segment_flags,
+         uint8_t read_flags LIBFSHFS_ATTRIBUTE_UNUSED,
+         libcerror_error_t **error )
+{
+	static char *function = "libfshfs_mapped_data_handle_read_segment_data";
+	size_t read_size      = 0;
+
+	LIBFSHFS_UNREFERENCED_PARAMETER( file_io_handle )
+	LIBFSHFS_UNREFERENCED_PARAMETER( segment_index )
+	LIBFSHFS_UNREFERENCED_PARAMETER( segment_file_index )
+	LIBFSHFS_UNREFERENCED_PARAMETER( read_flags )
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment data.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid segment data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( segment_flags & LIBFDATA_RANGE_FLAG_IS_SPARSE ) != 0 )
+	{
+		if( memory_set(
+		     segment_data,
+		     0,
+		     segment_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear segment data.",
+			 function );
+
+			return( -1 );
+		}
+		data_handle->current_offset += (off64_t) segment_data_size;
+
+		return( (ssize_t) segment_data_size );
+	}
+	/* Similar to reading from a file IO handle, a read beyond the end
+	 * of the mapped data is truncated
+	 */
+	if( (size64_t) data_handle->current_offset < data_handle->mapped_data_size )
+	{
+		read_size = segment_data_size;
+
+		if( (size64_t) read_size > ( data_handle->mapped_data_size - (size64_t) data_handle->current_offset ) )
+		{
+			read_size = (size_t) ( data_handle->mapped_data_size - (size64_t) data_handle->current_offset );
+		}
+		if( memory_copy(
+		     segment_data,
+		     &( data_handle->mapped_data[ data_handle->current_offset ] ),
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy segment data.",
+			 function );
+
+			return( -1 );
+		}
+		if( data_handle->statistics != NULL )
+		{
+			if( libfshfs_statistics_add_read(
+			     data_handle->statistics,
+			     LIBFSHFS_STATISTICS_REGION_DATA,
+			     (uint64_t) read_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to add read to statistics.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		data_handle->current_offset += (off64_t) read_size;
+	}
+	return( (ssize_t) read_size );
+}
+
+/* Seeks a certain offset of the data
+ * Callback for the data stream
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t libfshfs_mapped_data_handle_seek_segment_offset(
+         libfshfs_mapped_data_handle_t *data_handle,
+         libbfio_handle_t *file_io_handle LIBFSHFS_ATTRIBUTE_UNUSED,
+         int segment_index LIBFSHFS_ATTRIBUTE_UNUSED,
+         int segment_file_index LIBFSHFS_ATTRIBUTE_UNUSED,
+         off64_t segment_offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libfshfs_mapped_data_handle_seek_segment_offset";
+
+	LIBFSHFS_UNREFERENCED_PARAMETER( file_io_handle )
+	LIBFSHFS_UNREFERENCED_PARAMETER( segment_index )
+	LIBFSHFS_UNREFERENCED_PARAMETER( segment_file_index )
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	data_handle->current_offset = segment_offset;
+
+	return( segment_offset );
+}
+
@@ -0,0 +1,273 @@
+/*
+ * Memory arena functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfshfs_libcerror.h"
+#include "libfshfs_memory_arena.h"
+
+/* Creates a memory arena
+ * Make sure the value memory_arena is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_memory_arena_initialize(
+     libfshfs_memory_arena_t **memory_arena,
+     size_t chunk_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_memory_arena_initialize";
+
+	if( memory_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *memory_arena != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid memory arena value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_size <= LIBFSHFS_MEMORY_ARENA_CHUNK_HEADER_SIZE )
+	 || ( chunk_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*memory_arena = memory_allocate_structure(
+	                 libfshfs_memory_arena_t );
+
+	if( *memory_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create memory arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *memory_arena,
+	     0,
+	     sizeof( libfshfs_memory_arena_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear memory arena.",
+		 function );
+
+		goto on_error;
+	}
+	( *memory_arena )->chunk_size = chunk_size;
+
+	return( 1 );
+
+on_error:
+	if( *memory_arena != NULL )
+	{
+		memory_free(
+		 *memory_arena );
+
+		*memory_arena = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a memory arena
+ * All the memory allocated from the arena is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_memory_arena_free(
+     libfshfs_memory_arena_t **memory_arena,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_memory_arena_free";
+	uint8_t *chunk        = NULL;
+	uint8_t *next_chunk   = NULL;
+
+	if( memory_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *memory_arena != NULL )
+	{
+		/* The chunks are linked to the previously allocated chunk
+		 */
+		chunk = ( *memory_arena )->chunk;
+
+		while( chunk != NULL )
+		{
+			next_chunk = *( (uint8_t **) chunk );
+
+			memory_free(
+			 chunk );
+
+			chunk = next_chunk;
+		}
+		memory_free(
+		 *memory_arena );
+
+		*memory_arena = NULL;
+	}
+	return( 1 );
+}
+
+/* Allocates zero-initialized memory from the memory arena
+ * The memory remains valid until the memory arena is freed and must not be freed separately
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_memory_arena_allocate(
+     libfshfs_memory_arena_t *memory_arena,
+     size_t size,
+     intptr_t **memory,
+     libcerror_error_t **error )
+{
+	uint8_t *chunk        = NULL;
+	static char *function = "libfshfs_memory_arena_allocate";
+	size_t chunk_size     = 0;
+
+	if( memory_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - LIBFSHFS_MEMORY_ARENA_CHUNK_HEADER_SIZE - LIBFSHFS_MEMORY_ARENA_ALIGNMENT ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory.",
+		 function );
+
+		return( -1 );
+	}
+	/* Keep the allocations aligned
+	 */
+	if( ( size % LIBFSHFS_MEMORY_ARENA_ALIGNMENT ) != 0 )
+	{
+		size += LIBFSHFS_MEMORY_ARENA_ALIGNMENT - ( size % LIBFSHFS_MEMORY_ARENA_ALIGNMENT );
+	}
+	if( ( memory_arena->chunk == NULL )
+	 || ( size > ( memory_arena->chunk_data_size - memory_arena->chunk_data_offset ) ) )
+	{
+		chunk_size = memory_arena->chunk_size;
+
+		/* Allocations that do not fit in a chunk are stored in a chunk of their own
+		 */
+		if( size > ( chunk_size - LIBFSHFS_MEMORY_ARENA_CHUNK_HEADER_SIZE ) )
+		{
+			chunk_size = LIBFSHFS_MEMORY_ARENA_CHUNK_HEADER_SIZE + size;
+		}
+		chunk = (uint8_t *) memory_allocate(
+		                     sizeof( uint8_t ) * chunk_size );
+
+		if( chunk == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create chunk.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     chunk,
+		     0,
+		     chunk_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear chunk.",
+			 function );
+
+			memory_free(
+			 chunk );
+
+			return( -1 );
+		}
+		*( (uint8_t **) chunk ) = memory_arena->chunk;
+
+		memory_arena->chunk             = chunk;
+		memory_arena->chunk_data_offset = LIBFSHFS_MEMORY_ARENA_CHUNK_HEADER_SIZE;
+		memory_arena->chunk_data_size   = chunk_size;
+		memory_arena->number_of_chunks += 1;
+	}
+	*memory = (intptr_t *) &( memory_arena->chunk[ memory_arena->chunk_data_offset ] );
+
+	memory_arena->chunk_data_offset += size;
+
+	return( 1 );
+}
+
@@ -0,0 +1,88 @@
+/*
+ * Memory arena functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBFSHFS_MEMORY_ARENA_H )
+#define _LIBFSHFS_MEMORY_ARENA_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfshfs_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the chunk header, that contains the pointer to the previous chunk
+ */
+#define LIBFSHFS_MEMORY_ARENA_CHUNK_HEADER_SIZE	16
+
+/* The alignment of the allocations
+ */
+#define LIBFSHFS_MEMORY_ARENA_ALIGNMENT		8
+
+typedef struct libfshfs_memory_arena libfshfs_memory_arena_t;
+
+struct libfshfs_memory_arena
+{
+	/* The most recently allocated chunk
+	 */
+	uint8_t *chunk;
+
+	/* The size of the chunk data
+	 */
+	size_t chunk_data_size;
+
+	/* The offset of the unused data in the chunk
+	 */
+	size_t chunk_data_offset;
+
+	/* The default chunk size
+	 */
+	size_t chunk_size;
+
+	/* The number of chunks
+	 */
+	int number_of_chunks;
+};
+
+int libfshfs_memory_arena_initialize(
+     libfshfs_memory_arena_t **memory_arena,
+     size_t chunk_size,
+     libcerror_error_t **error );
+
+int libfshfs_memory_arena_free(
+     libfshfs_memory_arena_t **memory_arena,
+     libcerror_error_t **error );
+
+int libfshfs_memory_arena_allocate(
+     libfshfs_memory_arena_t *memory_arena,
+     size_t size,
+     intptr_t **memory,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSHFS_MEMORY_ARENA_H ) */
+
@@ -28,308 +28,66 @@
 #include "libfshfs_libcerror.h"
 #include "libfshfs_libuna.h"
 #include "libfshfs_extern.h"
+#include "libfshfs_name_mappings.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
-typedef struct libfshfs_name_decomposition_mapping libfshfs_name_decomposition_mapping_t;
-
-struct libfshfs_name_decomposition_mapping
-{
-	/* The number of characters
-	 */
-	uint8_t number_of_characters;
-
-	/* The characters
-	 */
-	uint32_t characters[ 4 ];
-};
-
-LIBFSHFS_EXTERN_VARIABLE \
-uint32_t libfshfs_name_case_folding_mappings_0x00000040[ 528 ];
-
-LIBFSHFS_EXTERN_VARIABLE \
-uint32_t libfshfs_name_case_folding_mappings_0x00000340[ 536 ];
-
-LIBFSHFS_EXTERN_VARIABLE \
-uint32_t libfshfs_name_case_folding_mappings_0x000010a0[ 48 ];
-
-LIBFSHFS_EXTERN_VARIABLE \
-uint32_t libfshfs_name_case_folding_mappings_0x000013f8[ 8 ];
-
-LIBFSHFS_EXTERN_VARIABLE \
-uint32_t libfshfs_name_case_folding_mappings_0x00001c80[ 16 ];
-
-LIBFSHFS_EXTERN_VARIABLE \
-uint32_t libfshfs_name_case_folding_mappings_0x00001e00[ 512 ];
-
-LIBFSHFS_EXTERN_VARIABLE \
-uint32_t libfshfs_name_case_folding_mappings_0x00002120[ 104 ];
-
-LIBFSHFS_EXTERN_VARIABLE \
-uint32_t libfshfs_name_case_folding_mappings_0x000024b0[ 32 ];
-
-LIBFSHFS_EXTERN_VARIABLE \
-uint32_t libfshfs_name_case_folding_mappings_0x00002c00[ 248 ];
-
-LIBFSHFS_EXTERN_VARIABLE \
-uint32_t libfshfs_name_case_folding_mappings_0x0000a640[ 96 ];
-
-LIBFSHFS_EXTERN_VARIABLE \
-uint32_t libfshfs_name_case_folding_mappings_0x0000a720[ 152 ];
-
-LIBFSHFS_EXTERN_VARIABLE \
-uint32_t libfshfs_name_case_folding_mappings_0x0000ab70[ 80 ];
-
-LIBFSHFS_EXTERN_VARIABLE \
-uint32_t libfshfs_name_case_folding_mappings_0x0000ff20[ 32 ];
-
-LIBFSHFS_EXTERN_VARIABLE \
-uint32_t libfshfs_name_case_folding_mappings_0x00010400[ 40 ];
-
-LIBFSHFS_EXTERN_VARIABLE \
-uint32_t libfshfs_name_case_folding_mappings_0x000104b0[ 40 ];
-
-LIBFSHFS_EXTERN_VARIABLE \
-uint32_t libfshfs_name_case_folding_mappings_0x00010c80[ 56 ];
-
-LIBFSHFS_EXTERN_VARIABLE \
-uint32_t libfshfs_name_case_folding_mappings_0x000118a0[ 32 ];
-
-LIBFSHFS_EXTERN_VARIABLE \
-uint32_t libfshfs_name_case_folding_mappings_0x0001e900[ 40 ];
-
-LIBFSHFS_EXTERN_VARIABLE \
-libfshfs_name_decomposition_mapping_t libfshfs_name_decomposition_mappings_0x000000c0[ 192 ];
-
-LIBFSHFS_EXTERN_VARIABLE \
-libfshfs_name_decomposition_mapping_t libfshfs_name_decomposition_mappings_0x000001a0[ 152 ];
-
-LIBFSHFS_EXTERN_VARIABLE \
-libfshfs_name_decomposition_mapping_t libfshfs_name_decomposition_mappings_0x00000340[ 152 ];
-
-LIBFSHFS_EXTERN_VARIABLE \
-libfshfs_name_decomposition_mapping_t libfshfs_name_decomposition_mappings_0x00000400[ 256 ];
-
-LIBFSHFS_EXTERN_VARIABLE \
-libfshfs_name_decomposition_mapping_t libfshfs_name_decomposition_mappings_0x00000620[ 184 ];
-
-LIBFSHFS_EXTERN_VARIABLE \
-libfshfs_name_decomposition_mapping_t libfshfs_name_decomposition_mappings_0x00000928[ 184 ];
-
-LIBFSHFS_EXTERN_VARIABLE \
-libfshfs_name_decomposition_mapping_t libfshfs_name_decomposition_mappings_0x00000a30[ 48 ];
-
-LIBFSHFS_EXTERN_VARIABLE \
-libfshfs_name_decomposition_mapping_t libfshfs_name_decomposition_mappings_0x00000b48[ 136 ];
-
-LIBFSHFS_EXTERN_VARIABLE \
-libfshfs_name_decomposition_mapping_t libfshfs_name_decomposition_mappings_0x00000c48[ 136 ];
-
-LIBFSHFS_EXTERN_VARIABLE \
-libfshfs_name_decomposition_mapping_t libfshfs_name_decomposition_mappings_0x00000d48[ 152 ];
-
-LIBFSHFS_EXTERN_VARIABLE \
-libfshfs_name_decomposition_mapping_t libfshfs_name_decomposition_mappings_0x00000f40[ 232 ];
-
-LIBFSHFS_EXTERN_VARIABLE \
-libfshfs_name_decomposition_mapping_t libfshfs_name_decomposition_mappings_0x00001e00[ 512 ];
-
-LIBFSHFS_EXTERN_VARIABLE \
-libfshfs_name_decomposition_mapping_t libfshfs_name_decomposition_mappings_0x00003048[ 184 ];
-
-LIBFSHFS_EXTERN_VARIABLE \
-libfshfs_name_decomposition_mapping_t libfshfs_name_decomposition_mappings_0x0000ac00[ 8 ];
-
-LIBFSHFS_EXTERN_VARIABLE \
-libfshfs_name_decomposition_mapping_t libfshfs_name_decomposition_mappings_0x0000d7a0[ 8 ];
+/* Determines if the UTF-16 big-endian encoded character at the name index is in the ASCII range
+ */
+#define libfshfs_name_utf16_stream_character_is_ascii( name, name_size, name_index ) \
+	( ( ( name_index + 1 ) < name_size ) \
+	 && ( name[ name_index ] == 0 ) \
+	 && ( name[ name_index + 1 ] < 0x80 ) )
 
-LIBFSHFS_EXTERN_VARIABLE \
-libfshfs_name_decomposition_mapping_t libfshfs_name_decomposition_mappings_0x0000fb18[ 56 ];
+/* Applies case folding to an ASCII character, which only affects A to Z
+ */
+#define libfshfs_name_get_ascii_case_folding_mapping( unicode_character ) \
+	if( ( unicode_character >= (libuna_unicode_character_t) 'A' ) \
+	 && ( unicode_character <= (libuna_unicode_character_t) 'Z' ) ) \
+	{ \
+		unicode_character |= 0x20; \
+	}
 
-LIBFSHFS_EXTERN_VARIABLE \
-libfshfs_name_decomposition_mapping_t libfshfs_name_decomposition_mappings_0x00011348[ 8 ];
+/* Applies case folding to 4 UTF-16 big-endian encoded ASCII characters stored in a 64-bit value
+ * Only A to Z are affected, which is determined per 16-bit character without carry into the next
+ */
+#define libfshfs_name_get_ascii_value_64bit_case_folding_mapping( value_64bit ) \
+	value_64bit |= ( ( value_64bit + 0x003f003f003f003fUL ) & ~( value_64bit + 0x0025002500250025UL ) & 0x0080008000800080UL ) >> 2
 
+/* Retrieves the case folding mapping of a Unicode character
+ * The mapping is looked up in a two-level table of pages of 256 characters
+ */
 #define libfshfs_name_get_case_folding_mapping( unicode_character ) \
-	if( ( unicode_character >= 0x00000040UL ) \
-	 && ( unicode_character <= 0x0000024fUL ) ) \
-	{ \
-		unicode_character = libfshfs_name_case_folding_mappings_0x00000040[ unicode_character - 0x00000040UL ]; \
-	} \
-	else if( ( unicode_character >= 0x00000340UL ) \
-	      && ( unicode_character <= 0x00000557UL ) ) \
-	{ \
-		unicode_character = libfshfs_name_case_folding_mappings_0x00000340[ unicode_character - 0x00000340UL ]; \
-	} \
-	else if( ( unicode_character >= 0x000010a0UL ) \
-	      && ( unicode_character <= 0x000010cfUL ) ) \
-	{ \
-		unicode_character = libfshfs_name_case_folding_mappings_0x000010a0[ unicode_character - 0x000010a0UL ]; \
-	} \
-	else if( ( unicode_character >= 0x000013f8UL ) \
-	      && ( unicode_character <= 0x000013ffUL ) ) \
-	{ \
-		unicode_character = libfshfs_name_case_folding_mappings_0x000013f8[ unicode_character - 0x000013f8UL ]; \
-	} \
-	else if( ( unicode_character >= 0x00001c80UL ) \
-	      && ( unicode_character <= 0x00001c8fUL ) ) \
-	{ \
-		unicode_character = libfshfs_name_case_folding_mappings_0x00001c80[ unicode_character - 0x00001c80UL ]; \
-	} \
-	else if( ( unicode_character >= 0x00001e00UL ) \
-	      && ( unicode_character <= 0x00001fffUL ) ) \
+	if( ( ( unicode_character >> 8 ) < LIBFSHFS_NAME_CASE_FOLDING_MAPPINGS_NUMBER_OF_PAGES ) \
+	 && ( libfshfs_name_case_folding_mappings[ unicode_character >> 8 ] != NULL ) ) \
 	{ \
-		unicode_character = libfshfs_name_case_folding_mappings_0x00001e00[ unicode_character - 0x00001e00UL ]; \
-	} \
-	else if( ( unicode_character >= 0x00002120UL ) \
-	      && ( unicode_character <= 0x00002187UL ) ) \
-	{ \
-		unicode_character = libfshfs_name_case_folding_mappings_0x00002120[ unicode_character - 0x00002120UL ]; \
-	} \
-	else if( ( unicode_character >= 0x000024b0UL ) \
-	      && ( unicode_character <= 0x000024cfUL ) ) \
-	{ \
-		unicode_character = libfshfs_name_case_folding_mappings_0x000024b0[ unicode_character - 0x000024b0UL ]; \
-	} \
-	else if( ( unicode_character >= 0x00002c00UL ) \
-	      && ( unicode_character <= 0x00002cf7UL ) ) \
-	{ \
-		unicode_character = libfshfs_name_case_folding_mappings_0x00002c00[ unicode_character - 0x00002c00UL ]; \
-	} \
-	else if( ( unicode_character >= 0x0000a640UL ) \
-	      && ( unicode_character <= 0x0000a69fUL ) ) \
-	{ \
-		unicode_character = libfshfs_name_case_folding_mappings_0x0000a640[ unicode_character - 0x0000a640UL ]; \
-	} \
-	else if( ( unicode_character >= 0x0000a720UL ) \
-	      && ( unicode_character <= 0x0000a7b7UL ) ) \
-	{ \
-		unicode_character = libfshfs_name_case_folding_mappings_0x0000a720[ unicode_character - 0x0000a720UL ]; \
-	} \
-	else if( ( unicode_character >= 0x0000ab70UL ) \
-	      && ( unicode_character <= 0x0000abbf ) ) \
-	{ \
-		unicode_character = libfshfs_name_case_folding_mappings_0x0000ab70[ unicode_character - 0x0000ab70UL ]; \
-	} \
-	else if( ( unicode_character >= 0x0000ff20UL ) \
-	      && ( unicode_character <= 0x0000ff3fUL ) ) \
-	{ \
-		unicode_character = libfshfs_name_case_folding_mappings_0x0000ff20[ unicode_character - 0x0000ff20UL ]; \
-	} \
-	else if( ( unicode_character >= 0x00010400UL ) \
-	      && ( unicode_character <= 0x00010427UL ) ) \
-	{ \
-		unicode_character = libfshfs_name_case_folding_mappings_0x00010400[ unicode_character - 0x00010400UL ]; \
-	} \
-	else if( ( unicode_character >= 0x000104b0UL ) \
-	      && ( unicode_character <= 0x000104d7UL ) ) \
-	{ \
-		unicode_character = libfshfs_name_case_folding_mappings_0x000104b0[ unicode_character - 0x000104b0UL ]; \
-	} \
-	else if( ( unicode_character >= 0x00010c80UL ) \
-	      && ( unicode_character <= 0x00010cb7UL ) ) \
-	{ \
-		unicode_character = libfshfs_name_case_folding_mappings_0x00010c80[ unicode_character - 0x00010c80UL ]; \
-	} \
-	else if( ( unicode_character >= 0x000118a0UL ) \
-	      && ( unicode_character <= 0x000118bfUL ) ) \
-	{ \
-		unicode_character = libfshfs_name_case_folding_mappings_0x000118a0[ unicode_character - 0x000118a0UL ]; \
-	} \
-	else if( ( unicode_character >= 0x0001e900UL ) \
-	      && ( unicode_character <= 0x0001e927UL ) ) \
-	{ \
-		unicode_character = libfshfs_name_case_folding_mappings_0x0001e900[ unicode_character - 0x0001e900UL ]; \
+		unicode_character = libfshfs_name_case_folding_mappings[ unicode_character >> 8 ][ unicode_character & 0x000000ffUL ]; \
 	}
 
+/* Retrieves the decomposition mapping of a Unicode character
+ * The mapping is looked up in a two-level table of pages of 256 characters
+ */
 #define libfshfs_name_get_decomposition_mapping( unicode_character, nfd_mapping, single_nfd_mapping ) \
-	if( ( unicode_character >= 0x000000c0UL ) \
-	 && ( unicode_character <= 0x0000017fUL ) ) \
-	{ \
-		nfd_mapping = &( libfshfs_name_decomposition_mappings_0x000000c0[ unicode_character - 0x000000c0UL ] ); \
-	} \
-	else if( ( unicode_character >= 0x000001a0UL ) \
-	      && ( unicode_character <= 0x00000237UL ) ) \
-	{ \
-		nfd_mapping = &( libfshfs_name_decomposition_mappings_0x000001a0[ unicode_character - 0x000001a0UL ] ); \
-	} \
-	else if( ( unicode_character >= 0x00000340UL ) \
-	      && ( unicode_character <= 0x000003d7UL ) ) \
-	{ \
-		nfd_mapping = &( libfshfs_name_decomposition_mappings_0x00000340[ unicode_character - 0x00000340UL ] ); \
-	} \
-	else if( ( unicode_character >= 0x00000400UL ) \
-	      && ( unicode_character <= 0x000004ffUL ) ) \
-	{ \
-		nfd_mapping = &( libfshfs_name_decomposition_mappings_0x00000400[ unicode_character - 0x00000400UL ] ); \
-	} \
-	else if( ( unicode_character >= 0x00000620UL ) \
-	      && ( unicode_character <= 0x000006d7UL ) ) \
-	{ \
-		nfd_mapping = &( libfshfs_name_decomposition_mappings_0x00000620[ unicode_character - 0x00000620UL ] ); \
-	} \
-	else if( ( unicode_character >= 0x00000928UL ) \
-	      && ( unicode_character <= 0x000009dfUL ) ) \
-	{ \
-		nfd_mapping = &( libfshfs_name_decomposition_mappings_0x00000928[ unicode_character - 0x00000928UL ] ); \
-	} \
-	else if( ( unicode_character >= 0x00000a30UL ) \
-	      && ( unicode_character <= 0x00000a5fUL ) ) \
-	{ \
-		nfd_mapping = &( libfshfs_name_decomposition_mappings_0x00000a30[ unicode_character - 0x00000a30UL ] ); \
-	} \
-	else if( ( unicode_character >= 0x00000b48UL ) \
-	      && ( unicode_character <= 0x00000bcfUL ) ) \
-	{ \
-		nfd_mapping = &( libfshfs_name_decomposition_mappings_0x00000b48[ unicode_character - 0x00000b48UL ] ); \
-	} \
-	else if( ( unicode_character >= 0x00000c48UL ) \
-	      && ( unicode_character <= 0x00000ccfUL ) ) \
-	{ \
-		nfd_mapping = &( libfshfs_name_decomposition_mappings_0x00000c48[ unicode_character - 0x00000c48UL ] ); \
-	} \
-	else if( ( unicode_character >= 0x00000d48UL ) \
-	      && ( unicode_character <= 0x00000ddfUL ) ) \
-	{ \
-		nfd_mapping = &( libfshfs_name_decomposition_mappings_0x00000d48[ unicode_character - 0x00000d48UL ] ); \
-	} \
-	else if( ( unicode_character >= 0x00000f40UL ) \
-	      && ( unicode_character <= 0x00001027UL ) ) \
-	{ \
-		nfd_mapping = &( libfshfs_name_decomposition_mappings_0x00000f40[ unicode_character - 0x00000f40UL ] ); \
-	} \
-	else if( ( unicode_character >= 0x00001e00UL ) \
-	      && ( unicode_character <= 0x00001fffUL ) ) \
-	{ \
-		nfd_mapping = &( libfshfs_name_decomposition_mappings_0x00001e00[ unicode_character - 0x00001e00UL ] ); \
-	} \
-	else if( ( unicode_character >= 0x00003048UL ) \
-	      && ( unicode_character <= 0x000030ffUL ) ) \
-	{ \
-		nfd_mapping = &( libfshfs_name_decomposition_mappings_0x00003048[ unicode_character - 0x00003048UL ] ); \
-	} \
-	else if( ( unicode_character >= 0x0000ac00UL ) \
-	      && ( unicode_character <= 0x0000ac07UL ) ) \
+	if( ( ( unicode_character >> 8 ) < LIBFSHFS_NAME_DECOMPOSITION_MAPPINGS_NUMBER_OF_PAGES ) \
+	 && ( libfshfs_name_decomposition_mappings[ unicode_character >> 8 ] != NULL ) ) \
 	{ \
-		nfd_mapping = &( libfshfs_name_decomposition_mappings_0x0000ac00[ unicode_character - 0x0000ac00UL ] ); \
-	} \
-	else if( ( unicode_character >= 0x0000d7a0UL ) \
-	      && ( unicode_character <= 0x0000d7a7UL ) ) \
-	{ \
-		nfd_mapping = &( libfshfs_name_decomposition_mappings_0x0000d7a0[ unicode_character - 0x0000d7a0UL ] ); \
-	} \
-	else if( ( unicode_character >= 0x0000fb18UL ) \
-	      && ( unicode_character <= 0x0000fb4fUL ) ) \
-	{ \
-		nfd_mapping = &( libfshfs_name_decomposition_mappings_0x0000fb18[ unicode_character - 0x0000fb18UL ] ); \
+		nfd_mapping = &( libfshfs_name_decomposition_mappings[ unicode_character >> 8 ][ unicode_character & 0x000000ffUL ] ); \
 	} \
 	else \
 	{ \
 		single_nfd_mapping.characters[ 0 ] = unicode_character; \
  \
 		nfd_mapping = &single_nfd_mapping; \
-	} \
+	}
+
+int libfshfs_name_get_utf16_stream_ascii_size(
+     const uint8_t *name,
+     size_t name_size,
+     size_t name_index,
+     size_t *ascii_size,
+     libcerror_error_t **error );
 
 int libfshfs_name_compare(
      const uint8_t *first_name,
@@ -388,6 +146,48 @@ int libfshfs_name_compare_with_utf16_string(
      uint8_t use_case_folding,
      libcerror_error_t **error );
 
+int libfshfs_name_get_folded_name(
+     const uint8_t *name,
+     size_t name_size,
+     int codepage,
+     uint8_t use_case_folding,
+     libuna_unicode_character_t *folded_name,
+     size_t folded_name_size,
+     size_t *folded_name_length,
+     libcerror_error_t **error );
+
+int libfshfs_name_get_folded_name_from_utf8_string(
+     const libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_length,
+     uint8_t use_case_folding,
+     libuna_unicode_character_t *folded_name,
+     size_t folded_name_size,
+     size_t *folded_name_length,
+     libcerror_error_t **error );
+
+int libfshfs_name_compare_folded_names(
+     const libuna_unicode_character_t *first_folded_name,
+     size_t first_folded_name_length,
+     const libuna_unicode_character_t *second_folded_name,
+     size_t second_folded_name_length,
+     libcerror_error_t **error );
+
+int libfshfs_name_compare_folded_name_with_utf8_string(
+     const libuna_unicode_character_t *folded_name,
+     size_t folded_name_length,
+     const libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_length,
+     uint8_t use_case_folding,
+     libcerror_error_t **error );
+
+int libfshfs_name_compare_folded_name_with_utf16_string(
+     const libuna_unicode_character_t *folded_name,
+     size_t folded_name_length,
+     const libuna_utf16_character_t *utf16_string,
+     size_t utf16_string_length,
+     uint8_t use_case_folding,
+     libcerror_error_t **error );
+
 int libfshfs_name_calculate_hash(
      const uint8_t *name,
      size_t name_size,
@@ -0,0 +1,11402 @@
+/*
+ * Name case folding and decomposition mappings
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/* This file was generated by generate_name_mappings.py, do not edit
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libfshfs_name_mappings.h"
+
+/* The data below was derived from ftp://ftp.unicode.org/Public/9.0.0/ucd/CaseFolding.txt
+ */
+
+static uint32_t libfshfs_name_case_folding_mappings_0x00000000[ 256 ] = {
+	/* 0x00000000 */ 0x00000000,
+	/* 0x00000001 */ 0x00000001,
+	/* 0x00000002 */ 0x00000002,
+	/* 0x00000003 */ 0x00000003,
+	/* 0x00000004 */ 0x00000004,
+	/* 0x00000005 */ 0x00000005,
+	/* 0x00000006 */ 0x00000006,
+	/* 0x00000007 */ 0x00000007,
+	/* 0x00000008 */ 0x00000008,
+	/* 0x00000009 */ 0x00000009,
+	/* 0x0000000a */ 0x0000000a,
+	/* 0x0000000b */ 0x0000000b,
+	/* 0x0000000c */ 0x0000000c,
+	/* 0x0000000d */ 0x0000000d,
+	/* 0x0000000e */ 0x0000000e,
+	/* 0x0000000f */ 0x0000000f,
+	/* 0x00000010 */ 0x00000010,
+	/* 0x00000011 */ 0x00000011,
+	/* 0x00000012 */ 0x00000012,
+	/* 0x00000013 */ 0x00000013,
+	/* 0x00000014 */ 0x00000014,
+	/* 0x00000015 */ 0x00000015,
+	/* 0x00000016 */ 0x00000016,
+	/* 0x00000017 */ 0x00000017,
+	/* 0x00000018 */ 0x00000018,
+	/* 0x00000019 */ 0x00000019,
+	/* 0x0000001a */ 0x0000001a,
+	/* 0x0000001b */ 0x0000001b,
+	/* 0x0000001c */ 0x0000001c,
+	/* 0x0000001d */ 0x0000001d,
+	/* 0x0000001e */ 0x0000001e,
+	/* 0x0000001f */ 0x0000001f,
+	/* 0x00000020 */ 0x00000020,
+	/* 0x00000021 */ 0x00000021,
+	/* 0x00000022 */ 0x00000022,
+	/* 0x00000023 */ 0x00000023,
+	/* 0x00000024 */ 0x00000024,
+	/* 0x00000025 */ 0x00000025,
+	/* 0x00000026 */ 0x00000026,
+	/* 0x00000027 */ 0x00000027,
+	/* 0x00000028 */ 0x00000028,
+	/* 0x00000029 */ 0x00000029,
+	/* 0x0000002a */ 0x0000002a,
+	/* 0x0000002b */ 0x0000002b,
+	/* 0x0000002c */ 0x0000002c,
+	/* 0x0000002d */ 0x0000002d,
+	/* 0x0000002e */ 0x0000002e,
+	/* 0x0000002f */ 0x0000002f,
+	/* 0x00000030 */ 0x00000030,
+	/* 0x00000031 */ 0x00000031,
+	/* 0x00000032 */ 0x00000032,
+	/* 0x00000033 */ 0x00000033,
+	/* 0x00000034 */ 0x00000034,
+	/* 0x00000035 */ 0x00000035,
+	/* 0x00000036 */ 0x00000036,
+	/* 0x00000037 */ 0x00000037,
+	/* 0x00000038 */ 0x00000038,
+	/* 0x00000039 */ 0x00000039,
+	/* 0x0000003a */ 0x0000003a,
+	/* 0x0000003b */ 0x0000003b,
+	/* 0x0000003c */ 0x0000003c,
+	/* 0x0000003d */ 0x0000003d,
+	/* 0x0000003e */ 0x0000003e,
+	/* 0x0000003f */ 0x0000003f,
+	/* 0x00000040 */ 0x00000040,
+	/* 0x00000041 */ 0x00000061,
+	/* 0x00000042 */ 0x00000062,
+	/* 0x00000043 */ 0x00000063,
+	/* 0x00000044 */ 0x00000064,
+	/* 0x00000045 */ 0x00000065,
+	/* 0x00000046 */ 0x00000066,
+	/* 0x00000047 */ 0x00000067,
+	/* 0x00000048 */ 0x00000068,
+	/* 0x00000049 */ 0x00000069,
+	/* 0x0000004a */ 0x0000006a,
+	/* 0x0000004b */ 0x0000006b,
+	/* 0x0000004c */ 0x0000006c,
+	/* 0x0000004d */ 0x0000006d,
+	/* 0x0000004e */ 0x0000006e,
+	/* 0x0000004f */ 0x0000006f,
+	/* 0x00000050 */ 0x00000070,
+	/* 0x00000051 */ 0x00000071,
+	/* 0x00000052 */ 0x00000072,
+	/* 0x00000053 */ 0x00000073,
+	/* 0x00000054 */ 0x00000074,
+	/* 0x00000055 */ 0x00000075,
+	/* 0x00000056 */ 0x00000076,
+	/* 0x00000057 */ 0x00000077,
+	/* 0x00000058 */ 0x00000078,
+	/* 0x00000059 */ 0x00000079,
+	/* 0x0000005a */ 0x0000007a,
+	/* 0x0000005b */ 0x0000005b,
+	/* 0x0000005c */ 0x0000005c,
+	/* 0x0000005d */ 0x0000005d,
+	/* 0x0000005e */ 0x0000005e,
+	/* 0x0000005f */ 0x0000005f,
+	/* 0x00000060 */ 0x00000060,
+	/* 0x00000061 */ 0x00000061,
+	/* 0x00000062 */ 0x00000062,
+	/* 0x00000063 */ 0x00000063,
+	/* 0x00000064 */ 0x00000064,
+	/* 0x00000065 */ 0x00000065,
+	/* 0x00000066 */ 0x00000066,
+	/* 0x00000067 */ 0x00000067,
+	/* 0x00000068 */ 0x00000068,
+	/* 0x00000069 */ 0x00000069,
+	/* 0x0000006a */ 0x0000006a,
+	/* 0x0000006b */ 0x0000006b,
+	/* 0x0000006c */ 0x0000006c,
+	/* 0x0000006d */ 0x0000006d,
+	/* 0x0000006e */ 0x0000006e,
+	/* 0x0000006f */ 0x0000006f,
+	/* 0x00000070 */ 0x00000070,
+	/* 0x00000071 */ 0x00000071,
+	/* 0x00000072 */ 0x00000072,
+	/* 0x00000073 */ 0x00000073,
+	/* 0x00000074 */ 0x00000074,
+	/* 0x00000075 */ 0x00000075,
+	/* 0x00000076 */ 0x00000076,
+	/* 0x00000077 */ 0x00000077,
+	/* 0x00000078 */ 0x00000078,
+	/* 0x00000079 */ 0x00000079,
+	/* 0x0000007a */ 0x0000007a,
+	/* 0x0000007b */ 0x0000007b,
+	/* 0x0000007c */ 0x0000007c,
+	/* 0x0000007d */ 0x0000007d,
+	/* 0x0000007e */ 0x0000007e,
+	/* 0x0000007f */ 0x0000007f,
+	/* 0x00000080 */ 0x00000080,
+	/* 0x00000081 */ 0x00000081,
+	/* 0x00000082 */ 0x00000082,
+	/* 0x00000083 */ 0x00000083,
+	/* 0x00000084 */ 0x00000084,
+	/* 0x00000085 */ 0x00000085,
+	/* 0x00000086 */ 0x00000086,
+	/* 0x00000087 */ 0x00000087,
+	/* 0x00000088 */ 0x00000088,
+	/* 0x00000089 */ 0x00000089,
+	/* 0x0000008a */ 0x0000008a,
+	/* 0x0000008b */ 0x0000008b,
+	/* 0x0000008c */ 0x0000008c,
+	/* 0x0000008d */ 0x0000008d,
+	/* 0x0000008e */ 0x0000008e,
+	/* 0x0000008f */ 0x0000008f,
+	/* 0x00000090 */ 0x00000090,
+	/* 0x00000091 */ 0x00000091,
+	/* 0x00000092 */ 0x00000092,
+	/* 0x00000093 */ 0x00000093,
+	/* 0x00000094 */ 0x00000094,
+	/* 0x00000095 */ 0x00000095,
+	/* 0x00000096 */ 0x00000096,
+	/* 0x00000097 */ 0x00000097,
+	/* 0x00000098 */ 0x00000098,
+	/* 0x00000099 */ 0x00000099,
+	/* 0x0000009a */ 0x0000009a,
+	/* 0x0000009b */ 0x0000009b,
+	/* 0x0000009c */ 0x0000009c,
+	/* 0x0000009d */ 0x0000009d,
+	/* 0x0000009e */ 0x0000009e,
+	/* 0x0000009f */ 0x0000009f,
+	/* 0x000000a0 */ 0x000000a0,
+	/* 0x000000a1 */ 0x000000a1,
+	/* 0x000000a2 */ 0x000000a2,
+	/* 0x000000a3 */ 0x000000a3,
+	/* 0x000000a4 */ 0x000000a4,
+	/* 0x000000a5 */ 0x000000a5,
+	/* 0x000000a6 */ 0x000000a6,
+	/* 0x000000a7 */ 0x000000a7,
+	/* 0x000000a8 */ 0x000000a8,
+	/* 0x000000a9 */ 0x000000a9,
+	/* 0x000000aa */ 0x000000aa,
+	/* 0x000000ab */ 0x000000ab,
+	/* 0x000000ac */ 0x000000ac,
+	/* 0x000000ad */ 0x000000ad,
+	/* 0x000000ae */ 0x000000ae,
+	/* 0x000000af */ 0x000000af,
+	/* 0x000000b0 */ 0x000000b0,
+	/* 0x000000b1 */ 0x000000b1,
+	/* 0x000000b2 */ 0x000000b2,
+	/* 0x000000b3 */ 0x000000b3,
+	/* 0x000000b4 */ 0x000000b4,
+	/* 0x000000b5 */ 0x000003bc,
+	/* 0x000000b6 */ 0x000000b6,
+	/* 0x000000b7 */ 0x000000b7,
+	/* 0x000000b8 */ 0x000000b8,
+	/* 0x000000b9 */ 0x000000b9,
+	/* 0x000000ba */ 0x000000ba,
+	/* 0x000000bb */ 0x000000bb,
+	/* 0x000000bc */ 0x000000bc,
+	/* 0x000000bd */ 0x000000bd,
+	/* 0x000000be */ 0x000000be,
+	/* 0x000000bf */ 0x000000bf,
+	/* 0x000000c0 */ 0x000000e0,
+	/* 0x000000c1 */ 0x000000e1,
+	/* 0x000000c2 */ 0x000000e2,
+	/* 0x000000c3 */ 0x000000e3,
+	/* 0x000000c4 */ 0x000000e4,
+	/* 0x000000c5 */ 0x000000e5,
+	/* 0x000000c6 */ 0x000000e6,
+	/* 0x000000c7 */ 0x000000e7,
+	/* 0x000000c8 */ 0x000000e8,
+	/* 0x000000c9 */ 0x000000e9,
+	/* 0x000000ca */ 0x000000ea,
+	/* 0x000000cb */ 0x000000eb,
+	/* 0x000000cc */ 0x000000ec,
+	/* 0x000000cd */ 0x000000ed,
+	/* 0x000000ce */ 0x000000ee,
+	/* 0x000000cf */ 0x000000ef,
+	/* 0x000000d0 */ 0x000000f0,
+	/* 0x000000d1 */ 0x000000f1,
+	/* 0x000000d2 */ 0x000000f2,
+	/* 0x000000d3 */ 0x000000f3,
+	/* 0x000000d4 */ 0x000000f4,
+	/* 0x000000d5 */ 0x000000f5,
+	/* 0x000000d6 */ 0x000000f6,
+	/* 0x000000d7 */ 0x000000d7,
+	/* 0x000000d8 */ 0x000000f8,
+	/* 0x000000d9 */ 0x000000f9,
+	/* 0x000000da */ 0x000000fa,
+	/* 0x000000db */ 0x000000fb,
+	/* 0x000000dc */ 0x000000fc,
+	/* 0x000000dd */ 0x000000fd,
+	/* 0x000000de */ 0x000000fe,
+	/* 0x000000df */ 0x000000df,
+	/* 0x000000e0 */ 0x000000e0,
+	/* 0x000000e1 */ 0x000000e1,
+	/* 0x000000e2 */ 0x000000e2,
+	/* 0x000000e3 */ 0x000000e3,
+	/* 0x000000e4 */ 0x000000e4,
+	/* 0x000000e5 */ 0x000000e5,
+	/* 0x000000e6 */ 0x000000e6,
+	/* 0x000000e7 */ 0x000000e7,
+	/* 0x000000e8 */ 0x000000e8,
+	/* 0x000000e9 */ 0x000000e9,
+	/* 0x000000ea */ 0x000000ea,
+	/* 0x000000eb */ 0x000000eb,
+	/* 0x000000ec */ 0x000000ec,
+	/* 0x000000ed */ 0x000000ed,
+	/* 0x000000ee */ 0x000000ee,
+	/* 0x000000ef */ 0x000000ef,
+	/* 0x000000f0 */ 0x000000f0,
+	/* 0x000000f1 */ 0x000000f1,
+	/* 0x000000f2 */ 0x000000f2,
+	/* 0x000000f3 */ 0x000000f3,
+	/* 0x000000f4 */ 0x000000f4,
+	/* 0x000000f5 */ 0x000000f5,
+	/* 0x000000f6 */ 0x000000f6,
+	/* 0x000000f7 */ 0x000000f7,
+	/* 0x000000f8 */ 0x000000f8,
+	/* 0x000000f9 */ 0x000000f9,
+	/* 0x000000fa */ 0x000000fa,
+	/* 0x000000fb */ 0x000000fb,
+	/* 0x000000fc */ 0x000000fc,
+	/* 0x000000fd */ 0x000000fd,
+	/* 0x000000fe */ 0x000000fe,
+	/* 0x000000ff */ 0x000000ff
+};
+
+static uint32_t libfshfs_name_case_folding_mappings_0x00000100[ 256 ] = {
+	/* 0x00000100 */ 0x00000101,
+	/* 0x00000101 */ 0x00000101,
+	/* 0x00000102 */ 0x00000103,
+	/* 0x00000103 */ 0x00000103,
+	/* 0x00000104 */ 0x00000105,
+	/* 0x00000105 */ 0x00000105,
+	/* 0x00000106 */ 0x00000107,
+	/* 0x00000107 */ 0x00000107,
+	/* 0x00000108 */ 0x00000109,
+	/* 0x00000109 */ 0x00000109,
+	/* 0x0000010a */ 0x0000010b,
+	/* 0x0000010b */ 0x0000010b,
+	/* 0x0000010c */ 0x0000010d,
+	/* 0x0000010d */ 0x0000010d,
+	/* 0x0000010e */ 0x0000010f,
+	/* 0x0000010f */ 0x0000010f,
+	/* 0x00000110 */ 0x00000111,
+	/* 0x00000111 */ 0x00000111,
+	/* 0x00000112 */ 0x00000113,
+	/* 0x00000113 */ 0x00000113,
+	/* 0x00000114 */ 0x00000115,
+	/* 0x00000115 */ 0x00000115,
+	/* 0x00000116 */ 0x00000117,
+	/* 0x00000117 */ 0x00000117,
+	/* 0x00000118 */ 0x00000119,
+	/* 0x00000119 */ 0x00000119,
+	/* 0x0000011a */ 0x0000011b,
+	/* 0x0000011b */ 0x0000011b,
+	/* 0x0000011c */ 0x0000011d,
+	/* 0x0000011d */ 0x0000011d,
+	/* 0x0000011e */ 0x0000011f,
+	/* 0x0000011f */ 0x0000011f,
+	/* 0x00000120 */ 0x00000121,
+	/* 0x00000121 */ 0x00000121,
+	/* 0x00000122 */ 0x00000123,
+	/* 0x00000123 */ 0x00000123,
+	/* 0x00000124 */ 0x00000125,
+	/* 0x00000125 */ 0x00000125,
+	/* 0x00000126 */ 0x00000127,
+	/* 0x00000127 */ 0x00000127,
+	/* 0x00000128 */ 0x00000129,
+	/* 0x00000129 */ 0x00000129,
+	/* 0x0000012a */ 0x0000012b,
+	/* 0x0000012b */ 0x0000012b,
+	/* 0x0000012c */ 0x0000012d,
+	/* 0x0000012d */ 0x0000012d,
+	/* 0x0000012e */ 0x0000012f,
+	/* 0x0000012f */ 0x0000012f,
+	/* 0x00000130 */ 0x00000130,
+	/* 0x00000131 */ 0x00000131,
+	/* 0x00000132 */ 0x00000133,
+	/* 0x00000133 */ 0x00000133,
+	/* 0x00000134 */ 0x00000135,
+	/* 0x00000135 */ 0x00000135,
+	/* 0x00000136 */ 0x00000137,
+	/* 0x00000137 */ 0x00000137,
+	/* 0x00000138 */ 0x00000138,
+	/* 0x00000139 */ 0x0000013a,
+	/* 0x0000013a */ 0x0000013a,
+	/* 0x0000013b */ 0x0000013c,
+	/* 0x0000013c */ 0x0000013c,
+	/* 0x0000013d */ 0x0000013e,
+	/* 0x0000013e */ 0x0000013e,
+	/* 0x0000013f */ 0x00000140,
+	/* 0x00000140 */ 0x00000140,
+	/* 0x00000141 */ 0x00000142,
+	/* 0x00000142 */ 0x00000142,
+	/* 0x00000143 */ 0x00000144,
+	/* 0x00000144 */ 0x00000144,
+	/* 0x00000145 */ 0x00000146,
+	/* 0x00000146 */ 0x00000146,
+	/* 0x00000147 */ 0x00000148,
+	/* 0x00000148 */ 0x00000148,
+	/* 0x00000149 */ 0x00000149,
+	/* 0x0000014a */ 0x0000014b,
+	/* 0x0000014b */ 0x0000014b,
+	/* 0x0000014c */ 0x0000014d,
+	/* 0x0000014d */ 0x0000014d,
+	/* 0x0000014e */ 0x0000014f,
+	/* 0x0000014f */ 0x0000014f,
+	/* 0x00000150 */ 0x00000151,
+	/* 0x00000151 */ 0x00000151,
+	/* 0x00000152 */ 0x00000153,
+	/* 0x00000153 */ 0x00000153,
+	/* 0x00000154 */ 0x00000155,
+	/* 0x00000155 */ 0x00000155,
+	/* 0x00000156 */ 0x00000157,
+	/* 0x00000157 */ 0x00000157,
+	/* 0x00000158 */ 0x00000159,
+	/* 0x00000159 */ 0x00000159,
+	/* 0x0000015a */ 0x0000015b,
+	/* 0x0000015b */ 0x0000015b,
+	/* 0x0000015c */ 0x0000015d,
+	/* 0x0000015d */ 0x0000015d,
+	/* 0x0000015e */ 0x0000015f,
+	/* 0x0000015f */ 0x0000015f,
+	/* 0x00000160 */ 0x00000161,
+	/* 0x00000161 */ 0x00000161,
+	/* 0x00000162 */ 0x00000163,
+	/* 0x00000163 */ 0x00000163,
+	/* 0x00000164 */ 0x00000165,
+	/* 0x00000165 */ 0x00000165,
+	/* 0x00000166 */ 0x00000167,
+	/* 0x00000167 */ 0x00000167,
+	/* 0x00000168 */ 0x00000169,
+	/* 0x00000169 */ 0x00000169,
+	/* 0x0000016a */ 0x0000016b,
+	/* 0x0000016b */ 0x0000016b,
+	/* 0x0000016c */ 0x0000016d,
+	/* 0x0000016d */ 0x0000016d,
+	/* 0x0000016e */ 0x0000016f,
+	/* 0x0000016f */ 0x0000016f,
+	/* 0x00000170 */ 0x00000171,
+	/* 0x00000171 */ 0x00000171,
+	/* 0x00000172 */ 0x00000173,
+	/* 0x00000173 */ 0x00000173,
+	/* 0x00000174 */ 0x00000175,
+	/* 0x00000175 */ 0x00000175,
+	/* 0x00000176 */ 0x00000177,
+	/* 0x00000177 */ 0x00000177,
+	/* 0x00000178 */ 0x000000ff,
+	/* 0x00000179 */ 0x0000017a,
+	/* 0x0000017a */ 0x0000017a,
+	/* 0x0000017b */ 0x0000017c,
+	/* 0x0000017c */ 0x0000017c,
+	/* 0x0000017d */ 0x0000017e,
+	/* 0x0000017e */ 0x0000017e,
+	/* 0x0000017f */ 0x00000073,
+	/* 0x00000180 */ 0x00000180,
+	/* 0x00000181 */ 0x00000253,
+	/* 0x00000182 */ 0x00000183,
+	/* 0x00000183 */ 0x00000183,
+	/* 0x00000184 */ 0x00000185,
+	/* 0x00000185 */ 0x00000185,
+	/* 0x00000186 */ 0x00000254,
+	/* 0x00000187 */ 0x00000188,
+	/* 0x00000188 */ 0x00000188,
+	/* 0x00000189 */ 0x00000256,
+	/* 0x0000018a */ 0x00000257,
+	/* 0x0000018b */ 0x0000018c,
+	/* 0x0000018c */ 0x0000018c,
+	/* 0x0000018d */ 0x0000018d,
+	/* 0x0000018e */ 0x000001dd,
+	/* 0x0000018f */ 0x00000259,
+	/* 0x00000190 */ 0x0000025b,
+	/* 0x00000191 */ 0x00000192,
+	/* 0x00000192 */ 0x00000192,
+	/* 0x00000193 */ 0x00000260,
+	/* 0x00000194 */ 0x00000263,
+	/* 0x00000195 */ 0x00000195,
+	/* 0x00000196 */ 0x00000269,
+	/* 0x00000197 */ 0x00000268,
+	/* 0x00000198 */ 0x00000199,
+	/* 0x00000199 */ 0x00000199,
+	/* 0x0000019a */ 0x0000019a,
+	/* 0x0000019b */ 0x0000019b,
+	/* 0x0000019c */ 0x0000026f,
+	/* 0x0000019d */ 0x00000272,
+	/* 0x0000019e */ 0x0000019e,
+	/* 0x0000019f */ 0x00000275,
+	/* 0x000001a0 */ 0x000001a1,
+	/* 0x000001a1 */ 0x000001a1,
+	/* 0x000001a2 */ 0x000001a3,
+	/* 0x000001a3 */ 0x000001a3,
+	/* 0x000001a4 */ 0x000001a5,
+	/* 0x000001a5 */ 0x000001a5,
+	/* 0x000001a6 */ 0x00000280,
+	/* 0x000001a7 */ 0x000001a8,
+	/* 0x000001a8 */ 0x000001a8,
+	/* 0x000001a9 */ 0x00000283,
+	/* 0x000001aa */ 0x000001aa,
+	/* 0x000001ab */ 0x000001ab,
+	/* 0x000001ac */ 0x000001ad,
+	/* 0x000001ad */ 0x000001ad,
+	/* 0x000001ae */ 0x00000288,
+	/* 0x000001af */ 0x000001b0,
+	/* 0x000001b0 */ 0x000001b0,
+	/* 0x000001b1 */ 0x0000028a,
+	/* 0x000001b2 */ 0x0000028b,
+	/* 0x000001b3 */ 0x000001b4,
+	/* 0x000001b4 */ 0x000001b4,
+	/* 0x000001b5 */ 0x000001b6,
+	/* 0x000001b6 */ 0x000001b6,
+	/* 0x000001b7 */ 0x00000292,
+	/* 0x000001b8 */ 0x000001b9,
+	/* 0x000001b9 */ 0x000001b9,
+	/* 0x000001ba */ 0x000001ba,
+	/* 0x000001bb */ 0x000001bb,
+	/* 0x000001bc */ 0x000001bd,
+	/* 0x000001bd */ 0x000001bd,
+	/* 0x000001be */ 0x000001be,
+	/* 0x000001bf */ 0x000001bf,
+	/* 0x000001c0 */ 0x000001c0,
+	/* 0x000001c1 */ 0x000001c1,
+	/* 0x000001c2 */ 0x000001c2,
+	/* 0x000001c3 */ 0x000001c3,
+	/* 0x000001c4 */ 0x000001c6,
+	/* 0x000001c5 */ 0x000001c6,
+	/* 0x000001c6 */ 0x000001c6,
+	/* 0x000001c7 */ 0x000001c9,
+	/* 0x000001c8 */ 0x000001c9,
+	/* 0x000001c9 */ 0x000001c9,
+	/* 0x000001ca */ 0x000001cc,
+	/* 0x000001cb */ 0x000001cc,
+	/* 0x000001cc */ 0x000001cc,
+	/* 0x000001cd */ 0x000001ce,
+	/* 0x000001ce */ 0x000001ce,
+	/* 0x000001cf */ 0x000001d0,
+	/* 0x000001d0 */ 0x000001d0,
+	/* 0x000001d1 */ 0x000001d2,
+	/* 0x000001d2 */ 0x000001d2,
+	/* 0x000001d3 */ 0x000001d4,
+	/* 0x000001d4 */ 0x000001d4,
+	/* 0x000001d5 */ 0x000001d6,
+	/* 0x000001d6 */ 0x000001d6,
+	/* 0x000001d7 */ 0x000001d8,
+	/* 0x000001d8 */ 0x000001d8,
+	/* 0x000001d9 */ 0x000001da,
+	/* 0x000001da */ 0x000001da,
+	/* 0x000001db */ 0x000001dc,
+	/* 0x000001dc */ 0x000001dc,
+	/* 0x000001dd */ 0x000001dd,
+	/* 0x000001de */ 0x000001df,
+	/* 0x000001df */ 0x000001df,
+	/* 0x000001e0 */ 0x000001e1,
+	/* 0x000001e1 */ 0x000001e1,
+	/* 0x000001e2 */ 0x000001e3,
+	/* 0x000001e3 */ 0x000001e3,
+	/* 0x000001e4 */ 0x000001e5,
+	/* 0x000001e5 */ 0x000001e5,
+	/* 0x000001e6 */ 0x000001e7,
+	/* 0x000001e7 */ 0x000001e7,
+	/* 0x000001e8 */ 0x000001e9,
+	/* 0x000001e9 */ 0x000001e9,
+	/* 0x000001ea */ 0x000001eb,
+	/* 0x000001eb */ 0x000001eb,
+	/* 0x000001ec */ 0x000001ed,
+	/* 0x000001ed */ 0x000001ed,
+	/* 0x000001ee */ 0x000001ef,
+	/* 0x000001ef */ 0x000001ef,
+	/* 0x000001f0 */ 0x000001f0,
+	/* 0x000001f1 */ 0x000001f3,
+	/* 0x000001f2 */ 0x000001f3,
+	/* 0x000001f3 */ 0x000001f3,
+	/* 0x000001f4 */ 0x000001f5,
+	/* 0x000001f5 */ 0x000001f5,
+	/* 0x000001f6 */ 0x00000195,
+	/* 0x000001f7 */ 0x000001bf,
+	/* 0x000001f8 */ 0x000001f9,
+	/* 0x000001f9 */ 0x000001f9,
+	/* 0x000001fa */ 0x000001fb,
+	/* 0x000001fb */ 0x000001fb,
+	/* 0x000001fc */ 0x000001fd,
+	/* 0x000001fd */ 0x000001fd,
+	/* 0x000001fe */ 0x000001ff,
+	/* 0x000001ff */ 0x000001ff
+};
+
+static uint32_t libfshfs_name_case_folding_mappings_0x00000200[ 256 ] = {
+	/* 0x00000200 */ 0x00000201,
+	/* 0x00000201 */ 0x00000201,
+	/* 0x00000202 */ 0x00000203,
+	/* 0x00000203 */ 0x00000203,
+	/* 0x00000204 */ 0x00000205,
+	/* 0x00000205 */ 0x00000205,
+	/* 0x00000206 */ 0x00000207,
+	/* 0x00000207 */ 0x00000207,
+	/* 0x00000208 */ 0x00000209,
+	/* 0x00000209 */ 0x00000209,
+	/* 0x0000020a */ 0x0000020b,
+	/* 0x0000020b */ 0x0000020b,
+	/* 0x0000020c */ 0x0000020d,
+	/* 0x0000020d */ 0x0000020d,
+	/* 0x0000020e */ 0x0000020f,
+	/* 0x0000020f */ 0x0000020f,
+	/* 0x00000210 */ 0x00000211,
+	/* 0x00000211 */ 0x00000211,
+	/* 0x00000212 */ 0x00000213,
+	/* 0x00000213 */ 0x00000213,
+	/* 0x00000214 */ 0x00000215,
+	/* 0x00000215 */ 0x00000215,
+	/* 0x00000216 */ 0x00000217,
+	/* 0x00000217 */ 0x00000217,
+	/* 0x00000218 */ 0x00000219,
+	/* 0x00000219 */ 0x00000219,
+	/* 0x0000021a */ 0x0000021b,
+	/* 0x0000021b */ 0x0000021b,
+	/* 0x0000021c */ 0x0000021d,
+	/* 0x0000021d */ 0x0000021d,
+	/* 0x0000021e */ 0x0000021f,
+	/* 0x0000021f */ 0x0000021f,
+	/* 0x00000220 */ 0x0000019e,
+	/* 0x00000221 */ 0x00000221,
+	/* 0x00000222 */ 0x00000223,
+	/* 0x00000223 */ 0x00000223,
+	/* 0x00000224 */ 0x00000225,
+	/* 0x00000225 */ 0x00000225,
+	/* 0x00000226 */ 0x00000227,
+	/* 0x00000227 */ 0x00000227,
+	/* 0x00000228 */ 0x00000229,
+	/* 0x00000229 */ 0x00000229,
+	/* 0x0000022a */ 0x0000022b,
+	/* 0x0000022b */ 0x0000022b,
+	/* 0x0000022c */ 0x0000022d,
+	/* 0x0000022d */ 0x0000022d,
+	/* 0x0000022e */ 0x0000022f,
+	/* 0x0000022f */ 0x0000022f,
+	/* 0x00000230 */ 0x00000231,
+	/* 0x00000231 */ 0x00000231,
+	/* 0x00000232 */ 0x00000233,
+	/* 0x00000233 */ 0x00000233,
+	/* 0x00000234 */ 0x00000234,
+	/* 0x00000235 */ 0x00000235,
+	/* 0x00000236 */ 0x00000236,
+	/* 0x00000237 */ 0x00000237,
+	/* 0x00000238 */ 0x00000238,
+	/* 0x00000239 */ 0x00000239,
+	/* 0x0000023a */ 0x00002c65,
+	/* 0x0000023b */ 0x0000023c,
+	/* 0x0000023c */ 0x0000023c,
+	/* 0x0000023d */ 0x0000019a,
+	/* 0x0000023e */ 0x00002c66,
+	/* 0x0000023f */ 0x0000023f,
+	/* 0x00000240 */ 0x00000240,
+	/* 0x00000241 */ 0x00000242,
+	/* 0x00000242 */ 0x00000242,
+	/* 0x00000243 */ 0x00000180,
+	/* 0x00000244 */ 0x00000289,
+	/* 0x00000245 */ 0x0000028c,
+	/* 0x00000246 */ 0x00000247,
+	/* 0x00000247 */ 0x00000247,
+	/* 0x00000248 */ 0x00000249,
+	/* 0x00000249 */ 0x00000249,
+	/* 0x0000024a */ 0x0000024b,
+	/* 0x0000024b */ 0x0000024b,
+	/* 0x0000024c */ 0x0000024d,
+	/* 0x0000024d */ 0x0000024d,
+	/* 0x0000024e */ 0x0000024f,
+	/* 0x0000024f */ 0x0000024f,
+	/* 0x00000250 */ 0x00000250,
+	/* 0x00000251 */ 0x00000251,
+	/* 0x00000252 */ 0x00000252,
+	/* 0x00000253 */ 0x00000253,
+	/* 0x00000254 */ 0x00000254,
+	/* 0x00000255 */ 0x00000255,
+	/* 0x00000256 */ 0x00000256,
+	/* 0x00000257 */ 0x00000257,
+	/* 0x00000258 */ 0x00000258,
+	/* 0x00000259 */ 0x00000259,
+	/* 0x0000025a */ 0x0000025a,
+	/* 0x0000025b */ 0x0000025b,
+	/* 0x0000025c */ 0x0000025c,
+	/* 0x0000025d */ 0x0000025d,
+	/* 0x0000025e */ 0x0000025e,
+	/* 0x0000025f */ 0x0000025f,
+	/* 0x00000260 */ 0x00000260,
+	/* 0x00000261 */ 0x00000261,
+	/* 0x00000262 */ 0x00000262,
+	/* 0x00000263 */ 0x00000263,
+	/* 0x00000264 */ 0x00000264,
+	/* 0x00000265 */ 0x00000265,
+	/* 0x00000266 */ 0x00000266,
+	/* 0x00000267 */ 0x00000267,
+	/* 0x00000268 */ 0x00000268,
+	/* 0x00000269 */ 0x00000269,
+	/* 0x0000026a */ 0x0000026a,
+	/* 0x0000026b */ 0x0000026b,
+	/* 0x0000026c */ 0x0000026c,
+	/* 0x0000026d */ 0x0000026d,
+	/* 0x0000026e */ 0x0000026e,
+	/* 0x0000026f */ 0x0000026f,
+	/* 0x00000270 */ 0x00000270,
+	/* 0x00000271 */ 0x00000271,
+	/* 0x00000272 */ 0x00000272,
+	/* 0x00000273 */ 0x00000273,
+	/* 0x00000274 */ 0x00000274,
+	/* 0x00000275 */ 0x00000275,
+	/* 0x00000276 */ 0x00000276,
+	/* 0x00000277 */ 0x00000277,
+	/* 0x00000278 */ 0x00000278,
+	/* 0x00000279 */ 0x00000279,
+	/* 0x0000027a */ 0x0000027a,
+	/* 0x0000027b */ 0x0000027b,
+	/* 0x0000027c */ 0x0000027c,
+	/* 0x0000027d */ 0x0000027d,
+	/* 0x0000027e */ 0x0000027e,
+	/* 0x0000027f */ 0x0000027f,
+	/* 0x00000280 */ 0x00000280,
+	/* 0x00000281 */ 0x00000281,
+	/* 0x00000282 */ 0x00000282,
+	/* 0x00000283 */ 0x00000283,
+	/* 0x00000284 */ 0x00000284,
+	/* 0x00000285 */ 0x00000285,
+	/* 0x00000286 */ 0x00000286,
+	/* 0x00000287 */ 0x00000287,
+	/* 0x00000288 */ 0x00000288,
+	/* 0x00000289 */ 0x00000289,
+	/* 0x0000028a */ 0x0000028a,
+	/* 0x0000028b */ 0x0000028b,
+	/* 0x0000028c */ 0x0000028c,
+	/* 0x0000028d */ 0x0000028d,
+	/* 0x0000028e */ 0x0000028e,
+	/* 0x0000028f */ 0x0000028f,
+	/* 0x00000290 */ 0x00000290,
+	/* 0x00000291 */ 0x00000291,
+	/* 0x00000292 */ 0x00000292,
+	/* 0x00000293 */ 0x00000293,
+	/* 0x00000294 */ 0x00000294,
+	/* 0x00000295 */ 0x00000295,
+	/* 0x00000296 */ 0x00000296,
+	/* 0x00000297 */ 0x00000297,
+	/* 0x00000298 */ 0x00000298,
+	/* 0x00000299 */ 0x00000299,
+	/* 0x0000029a */ 0x0000029a,
+	/* 0x0000029b */ 0x0000029b,
+	/* 0x0000029c */ 0x0000029c,
+	/* 0x0000029d */ 0x0000029d,
+	/* 0x0000029e */ 0x0000029e,
+	/* 0x0000029f */ 0x0000029f,
+	/* 0x000002a0 */ 0x000002a0,
+	/* 0x000002a1 */ 0x000002a1,
+	/* 0x000002a2 */ 0x000002a2,
+	/* 0x000002a3 */ 0x000002a3,
+	/* 0x000002a4 */ 0x000002a4,
+	/* 0x000002a5 */ 0x000002a5,
+	/* 0x000002a6 */ 0x000002a6,
+	/* 0x000002a7 */ 0x000002a7,
+	/* 0x000002a8 */ 0x000002a8,
+	/* 0x000002a9 */ 0x000002a9,
+	/* 0x000002aa */ 0x000002aa,
+	/* 0x000002ab */ 0x000002ab,
+	/* 0x000002ac */ 0x000002ac,
+	/* 0x000002ad */ 0x000002ad,
+	/* 0x000002ae */ 0x000002ae,
+	/* 0x000002af */ 0x000002af,
+	/* 0x000002b0 */ 0x000002b0,
+	/* 0x000002b1 */ 0x000002b1,
+	/* 0x000002b2 */ 0x000002b2,
+	/* 0x000002b3 */ 0x000002b3,
+	/* 0x000002b4 */ 0x000002b4,
+	/* 0x000002b5 */ 0x000002b5,
+	/* 0x000002b6 */ 0x000002b6,
+	/* 0x000002b7 */ 0x000002b7,
+	/* 0x000002b8 */ 0x000002b8,
+	/* 0x000002b9 */ 0x000002b9,
+	/* 0x000002ba */ 0x000002ba,
+	/* 0x000002bb */ 0x000002bb,
+	/* 0x000002bc */ 0x000002bc,
+	/* 0x000002bd */ 0x000002bd,
+	/* 0x000002be */ 0x000002be,
+	/* 0x000002bf */ 0x000002bf,
+	/* 0x000002c0 */ 0x000002c0,
+	/* 0x000002c1 */ 0x000002c1,
+	/* 0x000002c2 */ 0x000002c2,
+	/* 0x000002c3 */ 0x000002c3,
+	/* 0x000002c4 */ 0x000002c4,
+	/* 0x000002c5 */ 0x000002c5,
+	/* 0x000002c6 */ 0x000002c6,
+	/* 0x000002c7 */ 0x000002c7,
+	/* 0x000002c8 */ 0x000002c8,
+	/* 0x000002c9 */ 0x000002c9,
+	/* 0x000002ca */ 0x000002ca,
+	/* 0x000002cb */ 0x000002cb,
+	/* 0x000002cc */ 0x000002cc,
+	/* 0x000002cd */ 0x000002cd,
+	/* 0x000002ce */ 0x000002ce,
+	/* 0x000002cf */ 0x000002cf,
+	/* 0x000002d0 */ 0x000002d0,
+	/* 0x000002d1 */ 0x000002d1,
+	/* 0x000002d2 */ 0x000002d2,
+	/* 0x000002d3 */ 0x000002d3,
+	/* 0x000002d4 */ 0x000002d4,
+	/* 0x000002d5 */ 0x000002d5,
+	/* 0x000002d6 */ 0x000002d6,
+	/* 0x000002d7 */ 0x000002d7,
+	/* 0x000002d8 */ 0x000002d8,
+	/* 0x000002d9 */ 0x000002d9,
+	/* 0x000002da */ 0x000002da,
+	/* 0x000002db */ 0x000002db,
+	/* 0x000002dc */ 0x000002dc,
+	/* 0x000002dd */ 0x000002dd,
+	/* 0x000002de */ 0x000002de,
+	/* 0x000002df */ 0x000002df,
+	/* 0x000002e0 */ 0x000002e0,
+	/* 0x000002e1 */ 0x000002e1,
+	/* 0x000002e2 */ 0x000002e2,
+	/* 0x000002e3 */ 0x000002e3,
+	/* 0x000002e4 */ 0x000002e4,
+	/* 0x000002e5 */ 0x000002e5,
+	/* 0x000002e6 */ 0x000002e6,
+	/* 0x000002e7 */ 0x000002e7,
+	/* 0x000002e8 */ 0x000002e8,
+	/* 0x000002e9 */ 0x000002e9,
+	/* 0x000002ea */ 0x000002ea,
+	/* 0x000002eb */ 0x000002eb,
+	/* 0x000002ec */ 0x000002ec,
+	/* 0x000002ed */ 0x000002ed,
+	/* 0x000002ee */ 0x000002ee,
+	/* 0x000002ef */ 0x000002ef,
+	/* 0x000002f0 */ 0x000002f0,
+	/* 0x000002f1 */ 0x000002f1,
+	/* 0x000002f2 */ 0x000002f2,
+	/* 0x000002f3 */ 0x000002f3,
+	/* 0x000002f4 */ 0x000002f4,
+	/* 0x000002f5 */ 0x000002f5,
+	/* 0x000002f6 */ 0x000002f6,
+	/* 0x000002f7 */ 0x000002f7,
+	/* 0x000002f8 */ 0x000002f8,
+	/* 0x000002f9 */ 0x000002f9,
+	/* 0x000002fa */ 0x000002fa,
+	/* 0x000002fb */ 0x000002fb,
+	/* 0x000002fc */ 0x000002fc,
+	/* 0x000002fd */ 0x000002fd,
+	/* 0x000002fe */ 0x000002fe,
+	/* 0x000002ff */ 0x000002ff
+};
+
+static uint32_t libfshfs_name_case_folding_mappings_0x00000300[ 256 ] = {
+	/* 0x00000300 */ 0x00000300,
+	/* 0x00000301 */ 0x00000301,
+	/* 0x00000302 */ 0x00000302,
+	/* 0x00000303 */ 0x00000303,
+	/* 0x00000304 */ 0x00000304,
+	/* 0x00000305 */ 0x00000305,
+	/* 0x00000306 */ 0x00000306,
+	/* 0x00000307 */ 0x00000307,
+	/* 0x00000308 */ 0x00000308,
+	/* 0x00000309 */ 0x00000309,
+	/* 0x0000030a */ 0x0000030a,
+	/* 0x0000030b */ 0x0000030b,
+	/* 0x0000030c */ 0x0000030c,
+	/* 0x0000030d */ 0x0000030d,
+	/* 0x0000030e */ 0x0000030e,
+	/* 0x0000030f */ 0x0000030f,
+	/* 0x00000310 */ 0x00000310,
+	/* 0x00000311 */ 0x00000311,
+	/* 0x00000312 */ 0x00000312,
+	/* 0x00000313 */ 0x00000313,
+	/* 0x00000314 */ 0x00000314,
+	/* 0x00000315 */ 0x00000315,
+	/* 0x00000316 */ 0x00000316,
+	/* 0x00000317 */ 0x00000317,
+	/* 0x00000318 */ 0x00000318,
+	/* 0x00000319 */ 0x00000319,
+	/* 0x0000031a */ 0x0000031a,
+	/* 0x0000031b */ 0x0000031b,
+	/* 0x0000031c */ 0x0000031c,
+	/* 0x0000031d */ 0x0000031d,
+	/* 0x0000031e */ 0x0000031e,
+	/* 0x0000031f */ 0x0000031f,
+	/* 0x00000320 */ 0x00000320,
+	/* 0x00000321 */ 0x00000321,
+	/* 0x00000322 */ 0x00000322,
+	/* 0x00000323 */ 0x00000323,
+	/* 0x00000324 */ 0x00000324,
+	/* 0x00000325 */ 0x00000325,
+	/* 0x00000326 */ 0x00000326,
+	/* 0x00000327 */ 0x00000327,
+	/* 0x00000328 */ 0x00000328,
+	/* 0x00000329 */ 0x00000329,
+	/* 0x0000032a */ 0x0000032a,
+	/* 0x0000032b */ 0x0000032b,
+	/* 0x0000032c */ 0x0000032c,
+	/* 0x0000032d */ 0x0000032d,
+	/* 0x0000032e */ 0x0000032e,
+	/* 0x0000032f */ 0x0000032f,
+	/* 0x00000330 */ 0x00000330,
+	/* 0x00000331 */ 0x00000331,
+	/* 0x00000332 */ 0x00000332,
+	/* 0x00000333 */ 0x00000333,
+	/* 0x00000334 */ 0x00000334,
+	/* 0x00000335 */ 0x00000335,
+	/* 0x00000336 */ 0x00000336,
+	/* 0x00000337 */ 0x00000337,
+	/* 0x00000338 */ 0x00000338,
+	/* 0x00000339 */ 0x00000339,
+	/* 0x0000033a */ 0x0000033a,
+	/* 0x0000033b */ 0x0000033b,
+	/* 0x0000033c */ 0x0000033c,
+	/* 0x0000033d */ 0x0000033d,
+	/* 0x0000033e */ 0x0000033e,
+	/* 0x0000033f */ 0x0000033f,
+	/* 0x00000340 */ 0x00000340,
+	/* 0x00000341 */ 0x00000341,
+	/* 0x00000342 */ 0x00000342,
+	/* 0x00000343 */ 0x00000343,
+	/* 0x00000344 */ 0x00000344,
+	/* 0x00000345 */ 0x000003b9,
+	/* 0x00000346 */ 0x00000346,
+	/* 0x00000347 */ 0x00000347,
+	/* 0x00000348 */ 0x00000348,
+	/* 0x00000349 */ 0x00000349,
+	/* 0x0000034a */ 0x0000034a,
+	/* 0x0000034b */ 0x0000034b,
+	/* 0x0000034c */ 0x0000034c,
+	/* 0x0000034d */ 0x0000034d,
+	/* 0x0000034e */ 0x0000034e,
+	/* 0x0000034f */ 0x0000034f,
+	/* 0x00000350 */ 0x00000350,
+	/* 0x00000351 */ 0x00000351,
+	/* 0x00000352 */ 0x00000352,
+	/* 0x00000353 */ 0x00000353,
+	/* 0x00000354 */ 0x00000354,
+	/* 0x00000355 */ 0x00000355,
+	/* 0x00000356 */ 0x00000356,
+	/* 0x00000357 */ 0x00000357,
+	/* 0x00000358 */ 0x00000358,
+	/* 0x00000359 */ 0x00000359,
+	/* 0x0000035a */ 0x0000035a,
+	/* 0x0000035b */ 0x0000035b,
+	/* 0x0000035c */ 0x0000035c,
+	/* 0x0000035d */ 0x0000035d,
+	/* 0x0000035e */ 0x0000035e,
+	/* 0x0000035f */ 0x0000035f,
+	/* 0x00000360 */ 0x00000360,
+	/* 0x00000361 */ 0x00000361,
+	/* 0x00000362 */ 0x00000362,
+	/* 0x00000363 */ 0x00000363,
+	/* 0x00000364 */ 0x00000364,
+	/* 0x00000365 */ 0x00000365,
+	/* 0x00000366 */ 0x00000366,
+	/* 0x00000367 */ 0x00000367,
+	/* 0x00000368 */ 0x00000368,
+	/* 0x00000369 */ 0x00000369,
+	/* 0x0000036a */ 0x0000036a,
+	/* 0x0000036b */ 0x0000036b,
+	/* 0x0000036c */ 0x0000036c,
+	/* 0x0000036d */ 0x0000036d,
+	/* 0x0000036e */ 0x0000036e,
+	/* 0x0000036f */ 0x0000036f,
+	/* 0x00000370 */ 0x00000371,
+	/* 0x00000371 */ 0x00000371,
+	/* 0x00000372 */ 0x00000373,
+	/* 0x00000373 */ 0x00000373,
+	/* 0x00000374 */ 0x00000374,
+	/* 0x00000375 */ 0x00000375,
+	/* 0x00000376 */ 0x00000377,
+	/* 0x00000377 */ 0x00000377,
+	/* 0x00000378 */ 0x00000378,
+	/* 0x00000379 */ 0x00000379,
+	/* 0x0000037a */ 0x0000037a,
+	/* 0x0000037b */ 0x0000037b,
+	/* 0x0000037c */ 0x0000037c,
+	/* 0x0000037d */ 0x0000037d,
+	/* 0x0000037e */ 0x0000037e,
+	/* 0x0000037f */ 0x000003f3,
+	/* 0x00000380 */ 0x00000380,
+	/* 0x00000381 */ 0x00000381,
+	/* 0x00000382 */ 0x00000382,
+	/* 0x00000383 */ 0x00000383,
+	/* 0x00000384 */ 0x00000384,
+	/* 0x00000385 */ 0x00000385,
+	/* 0x00000386 */ 0x000003ac,
+	/* 0x00000387 */ 0x00000387,
+	/* 0x00000388 */ 0x000003ad,
+	/* 0x00000389 */ 0x000003ae,
+	/* 0x0000038a */ 0x000003af,
+	/* 0x0000038b */ 0x0000038b,
+	/* 0x0000038c */ 0x000003cc,
+	/* 0x0000038d */ 0x0000038d,
+	/* 0x0000038e */ 0x000003cd,
+	/* 0x0000038f */ 0x000003ce,
+	/* 0x00000390 */ 0x00000390,
+	/* 0x00000391 */ 0x000003b1,
+	/* 0x00000392 */ 0x000003b2,
+	/* 0x00000393 */ 0x000003b3,
+	/* 0x00000394 */ 0x000003b4,
+	/* 0x00000395 */ 0x000003b5,
+	/* 0x00000396 */ 0x000003b6,
+	/* 0x00000397 */ 0x000003b7,
+	/* 0x00000398 */ 0x000003b8,
+	/* 0x00000399 */ 0x000003b9,
+	/* 0x0000039a */ 0x000003ba,
+	/* 0x0000039b */ 0x000003bb,
+	/* 0x0000039c */ 0x000003bc,
+	/* 0x0000039d */ 0x000003bd,
+	/* 0x0000039e */ 0x000003be,
+	/* 0x0000039f */ 0x000003bf,
+	/* 0x000003a0 */ 0x000003c0,
+	/* 0x000003a1 */ 0x000003c1,
+	/* 0x000003a2 */ 0x000003a2,
+	/* 0x000003a3 */ 0x000003c3,
+	/* 0x000003a4 */ 0x000003c4,
+	/* 0x000003a5 */ 0x000003c5,
+	/* 0x000003a6 */ 0x000003c6,
+	/* 0x000003a7 */ 0x000003c7,
+	/* 0x000003a8 */ 0x000003c8,
+	/* 0x000003a9 */ 0x000003c9,
+	/* 0x000003aa */ 0x000003ca,
+	/* 0x000003ab */ 0x000003cb,
+	/* 0x000003ac */ 0x000003ac,
+	/* 0x000003ad */ 0x000003ad,
+	/* 0x000003ae */ 0x000003ae,
+	/* 0x000003af */ 0x000003af,
+	/* 0x000003b0 */ 0x000003b0,
+	/* 0x000003b1 */ 0x000003b1,
+	/* 0x000003b2 */ 0x000003b2,
+	/* 0x000003b3 */ 0x000003b3,
+	/* 0x000003b4 */ 0x000003b4,
+	/* 0x000003b5 */ 0x000003b5,
+	/* 0x000003b6 */ 0x000003b6,
+	/* 0x000003b7 */ 0x000003b7,
+	/* 0x000003b8 */ 0x000003b8,
+	/* 0x000003b9 */ 0x000003b9,
+	/* 0x000003ba */ 0x000003ba,
+	/* 0x000003bb */ 0x000003bb,
+	/* 0x000003bc */ 0x000003bc,
+	/* 0x000003bd */ 0x000003bd,
+	/* 0x000003be */ 0x000003be,
+	/* 0x000003bf */ 0x000003bf,
+	/* 0x000003c0 */ 0x000003c0,
+	/* 0x000003c1 */ 0x000003c1,
+	/* 0x000003c2 */ 0x000003c3,
+	/* 0x000003c3 */ 0x000003c3,
+	/* 0x000003c4 */ 0x000003c4,
+	/* 0x000003c5 */ 0x000003c5,
+	/* 0x000003c6 */ 0x000003c6,
+	/* 0x000003c7 */ 0x000003c7,
+	/* 0x000003c8 */ 0x000003c8,
+	/* 0x000003c9 */ 0x000003c9,
+	/* 0x000003ca */ 0x000003ca,
+	/* 0x000003cb */ 0x000003cb,
+	/* 0x000003cc */ 0x000003cc,
+	/* 0x000003cd */ 0x000003cd,
+	/* 0x000003ce */ 0x000003ce,
+	/* 0x000003cf */ 0x000003d7,
+	/* 0x000003d0 */ 0x000003b2,
+	/* 0x000003d1 */ 0x000003b8,
+	/* 0x000003d2 */ 0x000003d2,
+	/* 0x000003d3 */ 0x000003d3,
+	/* 0x000003d4 */ 0x000003d4,
+	/* 0x000003d5 */ 0x000003c6,
+	/* 0x000003d6 */ 0x000003c0,
+	/* 0x000003d7 */ 0x000003d7,
+	/* 0x000003d8 */ 0x000003d9,
+	/* 0x000003d9 */ 0x000003d9,
+	/* 0x000003da */ 0x000003db,
+	/* 0x000003db */ 0x000003db,
+	/* 0x000003dc */ 0x000003dd,
+	/* 0x000003dd */ 0x000003dd,
+	/* 0x000003de */ 0x000003df,
+	/* 0x000003df */ 0x000003df,
+	/* 0x000003e0 */ 0x000003e1,
+	/* 0x000003e1 */ 0x000003e1,
+	/* 0x000003e2 */ 0x000003e3,
+	/* 0x000003e3 */ 0x000003e3,
+	/* 0x000003e4 */ 0x000003e5,
+	/* 0x000003e5 */ 0x000003e5,
+	/* 0x000003e6 */ 0x000003e7,
+	/* 0x000003e7 */ 0x000003e7,
+	/* 0x000003e8 */ 0x000003e9,
+	/* 0x000003e9 */ 0x000003e9,
+	/* 0x000003ea */ 0x000003eb,
+	/* 0x000003eb */ 0x000003eb,
+	/* 0x000003ec */ 0x000003ed,
+	/* 0x000003ed */ 0x000003ed,
+	/* 0x000003ee */ 0x000003ef,
+	/* 0x000003ef */ 0x000003ef,
+	/* 0x000003f0 */ 0x000003ba,
+	/* 0x000003f1 */ 0x000003c1,
+	/* 0x000003f2 */ 0x000003f2,
+	/* 0x000003f3 */ 0x000003f3,
+	/* 0x000003f4 */ 0x000003b8,
+	/* 0x000003f5 */ 0x000003b5,
+	/* 0x000003f6 */ 0x000003f6,
+	/* 0x000003f7 */ 0x000003f8,
+	/* 0x000003f8 */ 0x000003f8,
+	/* 0x000003f9 */ 0x000003f9,
+	/* 0x000003fa */ 0x000003fb,
+	/* 0x000003fb */ 0x000003fb,
+	/* 0x000003fc */ 0x000003fc,
+	/* 0x000003fd */ 0x0000037b,
+	/* 0x000003fe */ 0x0000037c,
+	/* 0x000003ff */ 0x0000037d
+};
+
+static uint32_t libfshfs_name_case_folding_mappings_0x00000400[ 256 ] = {
+	/* 0x00000400 */ 0x00000450,
+	/* 0x00000401 */ 0x00000451,
+	/* 0x00000402 */ 0x00000452,
+	/* 0x00000403 */ 0x00000453,
+	/* 0x00000404 */ 0x00000454,
+	/* 0x00000405 */ 0x00000455,
+	/* 0x00000406 */ 0x00000456,
+	/* 0x00000407 */ 0x00000457,
+	/* 0x00000408 */ 0x00000458,
+	/* 0x00000409 */ 0x00000459,
+	/* 0x0000040a */ 0x0000045a,
+	/* 0x0000040b */ 0x0000045b,
+	/* 0x0000040c */ 0x0000045c,
+	/* 0x0000040d */ 0x0000045d,
+	/* 0x0000040e */ 0x0000045e,
+	/* 0x0000040f */ 0x0000045f,
+	/* 0x00000410 */ 0x00000430,
+	/* 0x00000411 */ 0x00000431,
+	/* 0x00000412 */ 0x00000432,
+	/* 0x00000413 */ 0x00000433,
+	/* 0x00000414 */ 0x00000434,
+	/* 0x00000415 */ 0x00000435,
+	/* 0x00000416 */ 0x00000436,
+	/* 0x00000417 */ 0x00000437,
+	/* 0x00000418 */ 0x00000438,
+	/* 0x00000419 */ 0x00000439,
+	/* 0x0000041a */ 0x0000043a,
+	/* 0x0000041b */ 0x0000043b,
+	/* 0x0000041c */ 0x0000043c,
+	/* 0x0000041d */ 0x0000043d,
+	/* 0x0000041e */ 0x0000043e,
+	/* 0x0000041f */ 0x0000043f,
+	/* 0x00000420 */ 0x00000440,
+	/* 0x00000421 */ 0x00000441,
+	/* 0x00000422 */ 0x00000442,
+	/* 0x00000423 */ 0x00000443,
+	/* 0x00000424 */ 0x00000444,
+	/* 0x00000425 */ 0x00000445,
+	/* 0x00000426 */ 0x00000446,
+	/* 0x00000427 */ 0x00000447,
+	/* 0x00000428 */ 0x00000448,
+	/* 0x00000429 */ 0x00000449,
+	/* 0x0000042a */ 0x0000044a,
+	/* 0x0000042b */ 0x0000044b,
+	/* 0x0000042c */ 0x0000044c,
+	/* 0x0000042d */ 0x0000044d,
+	/* 0x0000042e */ 0x0000044e,
+	/* 0x0000042f */ 0x0000044f,
+	/* 0x00000430 */ 0x00000430,
+	/* 0x00000431 */ 0x00000431,
+	/* 0x00000432 */ 0x00000432,
+	/* 0x00000433 */ 0x00000433,
+	/* 0x00000434 */ 0x00000434,
+	/* 0x00000435 */ 0x00000435,
+	/* 0x00000436 */ 0x00000436,
+	/* 0x00000437 */ 0x00000437,
+	/* 0x00000438 */ 0x00000438,
+	/* 0x00000439 */ 0x00000439,
+	/* 0x0000043a */ 0x0000043a,
+	/* 0x0000043b */ 0x0000043b,
+	/* 0x0000043c */ 0x0000043c,
+	/* 0x0000043d */ 0x0000043d,
+	/* 0x0000043e */ 0x0000043e,
+	/* 0x0000043f */ 0x0000043f,
+	/* 0x00000440 */ 0x00000440,
+	/* 0x00000441 */ 0x00000441,
+	/* 0x00000442 */ 0x00000442,
+	/* 0x00000443 */ 0x00000443,
+	/* 0x00000444 */ 0x00000444,
+	/* 0x00000445 */ 0x00000445,
+	/* 0x00000446 */ 0x00000446,
+	/* 0x00000447 */ 0x00000447,
+	/* 0x00000448 */ 0x00000448,
+	/* 0x00000449 */ 0x00000449,
+	/* 0x0000044a */ 0x0000044a,
+	/* 0x0000044b */ 0x0000044b,
+	/* 0x0000044c */ 0x0000044c,
+	/* 0x0000044d */ 0x0000044d,
+	/* 0x0000044e */ 0x0000044e,
+	/* 0x0000044f */ 0x0000044f,
+	/* 0x00000450 */ 0x00000450,
+	/* 0x00000451 */ 0x00000451,
+	/* 0x00000452 */ 0x00000452,
+	/* 0x00000453 */ 0x00000453,
+	/* 0x00000454 */ 0x00000454,
+	/* 0x00000455 */ 0x00000455,
+	/* 0x00000456 */ 0x00000456,
+	/* 0x00000457 */ 0x00000457,
+	/* 0x00000458 */ 0x00000458,
+	/* 0x00000459 */ 0x00000459,
+	/* 0x0000045a */ 0x0000045a,
+	/* 0x0000045b */ 0x0000045b,
+	/* 0x0000045c */ 0x0000045c,
+	/* 0x0000045d */ 0x0000045d,
+	/* 0x0000045e */ 0x0000045e,
+	/* 0x0000045f */ 0x0000045f,
+	/* 0x00000460 */ 0x00000461,
+	/* 0x00000461 */ 0x00000461,
+	/* 0x00000462 */ 0x00000463,
+	/* 0x00000463 */ 0x00000463,
+	/* 0x00000464 */ 0x00000465,
+	/* 0x00000465 */ 0x00000465,
+	/* 0x00000466 */ 0x00000467,
+	/* 0x00000467 */ 0x00000467,
+	/* 0x00000468 */ 0x00000469,
+	/* 0x00000469 */ 0x00000469,
+	/* 0x0000046a */ 0x0000046b,
+	/* 0x0000046b */ 0x0000046b,
+	/* 0x0000046c */ 0x0000046d,
+	/* 0x0000046d */ 0x0000046d,
+	/* 0x0000046e */ 0x0000046f,
+	/* 0x0000046f */ 0x0000046f,
+	/* 0x00000470 */ 0x00000471,
+	/* 0x00000471 */ 0x00000471,
+	/* 0x00000472 */ 0x00000473,
+	/* 0x00000473 */ 0x00000473,
+	/* 0x00000474 */ 0x00000475,
+	/* 0x00000475 */ 0x00000475,
+	/* 0x00000476 */ 0x00000477,
+	/* 0x00000477 */ 0x00000477,
+	/* 0x00000478 */ 0x00000479,
+	/* 0x00000479 */ 0x00000479,
+	/* 0x0000047a */ 0x0000047b,
+	/* 0x0000047b */ 0x0000047b,
+	/* 0x0000047c */ 0x0000047d,
+	/* 0x0000047d */ 0x0000047d,
+	/* 0x0000047e */ 0x0000047f,
+	/* 0x0000047f */ 0x0000047f,
+	/* 0x00000480 */ 0x00000481,
+	/* 0x00000481 */ 0x00000481,
+	/* 0x00000482 */ 0x00000482,
+	/* 0x00000483 */ 0x00000483,
+	/* 0x00000484 */ 0x00000484,
+	/* 0x00000485 */ 0x00000485,
+	/* 0x00000486 */ 0x00000486,
+	/* 0x00000487 */ 0x00000487,
+	/* 0x00000488 */ 0x00000488,
+	/* 0x00000489 */ 0x00000489,
+	/* 0x0000048a */ 0x0000048b,
+	/* 0x0000048b */ 0x0000048b,
+	/* 0x0000048c */ 0x0000048d,
+	/* 0x0000048d */ 0x0000048d,
+	/* 0x0000048e */ 0x0000048f,
+	/* 0x0000048f */ 0x0000048f,
+	/* 0x00000490 */ 0x00000491,
+	/* 0x00000491 */ 0x00000491,
+	/* 0x00000492 */ 0x00000493,
+	/* 0x00000493 */ 0x00000493,
+	/* 0x00000494 */ 0x00000495,
+	/* 0x00000495 */ 0x00000495,
+	/* 0x00000496 */ 0x00000497,
+	/* 0x00000497 */ 0x00000497,
+	/* 0x00000498 */ 0x00000499,
+	/* 0x00000499 */ 0x00000499,
+	/* 0x0000049a */ 0x0000049b,
+	/* 0x0000049b */ 0x0000049b,
+	/* 0x0000049c */ 0x0000049d,
+	/* 0x0000049d */ 0x0000049d,
+	/* 0x0000049e */ 0x0000049f,
+	/* 0x0000049f */ 0x0000049f,
+	/* 0x000004a0 */ 0x000004a1,
+	/* 0x000004a1 */ 0x000004a1,
+	/* 0x000004a2 */ 0x000004a3,
+	/* 0x000004a3 */ 0x000004a3,
+	/* 0x000004a4 */ 0x000004a5,
+	/* 0x000004a5 */ 0x000004a5,
+	/* 0x000004a6 */ 0x000004a7,
+	/* 0x000004a7 */ 0x000004a7,
+	/* 0x000004a8 */ 0x000004a9,
+	/* 0x000004a9 */ 0x000004a9,
+	/* 0x000004aa */ 0x000004ab,
+	/* 0x000004ab */ 0x000004ab,
+	/* 0x000004ac */ 0x000004ad,
+	/* 0x000004ad */ 0x000004ad,
+	/* 0x000004ae */ 0x000004af,
+	/* 0x000004af */ 0x000004af,
+	/* 0x000004b0 */ 0x000004b1,
+	/* 0x000004b1 */ 0x000004b1,
+	/* 0x000004b2 */ 0x000004b3,
+	/* 0x000004b3 */ 0x000004b3,
+	/* 0x000004b4 */ 0x000004b5,
+	/* 0x000004b5 */ 0x000004b5,
+	/* 0x000004b6 */ 0x000004b7,
+	/* 0x000004b7 */ 0x000004b7,
+	/* 0x000004b8 */ 0x000004b9,
+	/* 0x000004b9 */ 0x000004b9,
+	/* 0x000004ba */ 0x000004bb,
+	/* 0x000004bb */ 0x000004bb,
+	/* 0x000004bc */ 0x000004bd,
+	/* 0x000004bd */ 0x000004bd,
+	/* 0x000004be */ 0x000004bf,
+	/* 0x000004bf */ 0x000004bf,
+	/* 0x000004c0 */ 0x000004cf,
+	/* 0x000004c1 */ 0x000004c2,
+	/* 0x000004c2 */ 0x000004c2,
+	/* 0x000004c3 */ 0x000004c4,
+	/* 0x000004c4 */ 0x000004c4,
+	/* 0x000004c5 */ 0x000004c6,
+	/* 0x000004c6 */ 0x000004c6,
+	/* 0x000004c7 */ 0x000004c8,
+	/* 0x000004c8 */ 0x000004c8,
+	/* 0x000004c9 */ 0x000004ca,
+	/* 0x000004ca */ 0x000004ca,
+	/* 0x000004cb */ 0x000004cc,
+	/* 0x000004cc */ 0x000004cc,
+	/* 0x000004cd */ 0x000004ce,
+	/* 0x000004ce */ 0x000004ce,
+	/* 0x000004cf */ 0x000004cf,
+	/* 0x000004d0 */ 0x000004d1,
+	/* 0x000004d1 */ 0x000004d1,
+	/* 0x000004d2 */ 0x000004d3,
+	/* 0x000004d3 */ 0x000004d3,
+	/* 0x000004d4 */ 0x000004d5,
+	/* 0x000004d5 */ 0x000004d5,
+	/* 0x000004d6 */ 0x000004d7,
+	/* 0x000004d7 */ 0x000004d7,
+	/* 0x000004d8 */ 0x000004d9,
+	/* 0x000004d9 */ 0x000004d9,
+	/* 0x000004da */ 0x000004db,
+	/* 0x000004db */ 0x000004db,
+	/* 0x000004dc */ 0x000004dd,
+	/* 0x000004dd */ 0x000004dd,
+	/* 0x000004de */ 0x000004df,
+	/* 0x000004df */ 0x000004df,
+	/* 0x000004e0 */ 0x000004e1,
+	/* 0x000004e1 */ 0x000004e1,
+	/* 0x000004e2 */ 0x000004e3,
+	/* 0x000004e3 */ 0x000004e3,
+	/* 0x000004e4 */ 0x000004e5,
+	/* 0x000004e5 */ 0x000004e5,
+	/* 0x000004e6 */ 0x000004e7,
+	/* 0x000004e7 */ 0x000004e7,
+	/* 0x000004e8 */ 0x000004e9,
+	/* 0x000004e9 */ 0x000004e9,
+	/* 0x000004ea */ 0x000004eb,
+	/* 0x000004eb */ 0x000004eb,
+	/* 0x000004ec */ 0x000004ed,
+	/* 0x000004ed */ 0x000004ed,
+	/* 0x000004ee */ 0x000004ef,
+	/* 0x000004ef */ 0x000004ef,
+	/* 0x000004f0 */ 0x000004f1,
+	/* 0x000004f1 */ 0x000004f1,
+	/* 0x000004f2 */ 0x000004f3,
+	/* 0x000004f3 */ 0x000004f3,
+	/* 0x000004f4 */ 0x000004f5,
+	/* 0x000004f5 */ 0x000004f5,
+	/* 0x000004f6 */ 0x000004f7,
+	/* 0x000004f7 */ 0x000004f7,
+	/* 0x000004f8 */ 0x000004f9,
+	/* 0x000004f9 */ 0x000004f9,
+	/* 0x000004fa */ 0x000004fb,
+	/* 0x000004fb */ 0x000004fb,
+	/* 0x000004fc */ 0x000004fd,
+	/* 0x000004fd */ 0x000004fd,
+	/* 0x000004fe */ 0x000004ff,
+	/* 0x000004ff */ 0x000004ff
+};
+
+static uint32_t libfshfs_name_case_folding_mappings_0x00000500[ 256 ] = {
+	/* 0x00000500 */ 0x00000501,
+	/* 0x00000501 */ 0x00000501,
+	/* 0x00000502 */ 0x00000503,
+	/* 0x00000503 */ 0x00000503,
+	/* 0x00000504 */ 0x00000505,
+	/* 0x00000505 */ 0x00000505,
+	/* 0x00000506 */ 0x00000507,
+	/* 0x00000507 */ 0x00000507,
+	/* 0x00000508 */ 0x00000509,
+	/* 0x00000509 */ 0x00000509,
+	/* 0x0000050a */ 0x0000050b,
+	/* 0x0000050b */ 0x0000050b,
+	/* 0x0000050c */ 0x0000050d,
+	/* 0x0000050d */ 0x0000050d,
+	/* 0x0000050e */ 0x0000050f,
+	/* 0x0000050f */ 0x0000050f,
+	/* 0x00000510 */ 0x00000511,
+	/* 0x00000511 */ 0x00000511,
+	/* 0x00000512 */ 0x00000513,
+	/* 0x00000513 */ 0x00000513,
+	/* 0x00000514 */ 0x00000515,
+	/* 0x00000515 */ 0x00000515,
+	/* 0x00000516 */ 0x00000517,
+	/* 0x00000517 */ 0x00000517,
+	/* 0x00000518 */ 0x00000519,
+	/* 0x00000519 */ 0x00000519,
+	/* 0x0000051a */ 0x0000051b,
+	/* 0x0000051b */ 0x0000051b,
+	/* 0x0000051c */ 0x0000051d,
+	/* 0x0000051d */ 0x0000051d,
+	/* 0x0000051e */ 0x0000051f,
+	/* 0x0000051f */ 0x0000051f,
+	/* 0x00000520 */ 0x00000521,
+	/* 0x00000521 */ 0x00000521,
+	/* 0x00000522 */ 0x00000523,
+	/* 0x00000523 */ 0x00000523,
+	/* 0x00000524 */ 0x00000525,
+	/* 0x00000525 */ 0x00000525,
+	/* 0x00000526 */ 0x00000527,
+	/* 0x00000527 */ 0x00000527,
+	/* 0x00000528 */ 0x00000529,
+	/* 0x00000529 */ 0x00000529,
+	/* 0x0000052a */ 0x0000052b,
+	/* 0x0000052b */ 0x0000052b,
+	/* 0x0000052c */ 0x0000052d,
+	/* 0x0000052d */ 0x0000052d,
+	/* 0x0000052e */ 0x0000052f,
+	/* 0x0000052f */ 0x0000052f,
+	/* 0x00000530 */ 0x00000530,
+	/* 0x00000531 */ 0x00000561,
+	/* 0x00000532 */ 0x00000562,
+	/* 0x00000533 */ 0x00000563,
+	/* 0x00000534 */ 0x00000564,
+	/* 0x00000535 */ 0x00000565,
+	/* 0x00000536 */ 0x00000566,
+	/* 0x00000537 */ 0x00000567,
+	/* 0x00000538 */ 0x00000568,
+	/* 0x00000539 */ 0x00000569,
+	/* 0x0000053a */ 0x0000056a,
+	/* 0x0000053b */ 0x0000056b,
+	/* 0x0000053c */ 0x0000056c,
+	/* 0x0000053d */ 0x0000056d,
+	/* 0x0000053e */ 0x0000056e,
+	/* 0x0000053f */ 0x0000056f,
+	/* 0x00000540 */ 0x00000570,
+	/* 0x00000541 */ 0x00000571,
+	/* 0x00000542 */ 0x00000572,
+	/* 0x00000543 */ 0x00000573,
+	/* 0x00000544 */ 0x00000574,
+	/* 0x00000545 */ 0x00000575,
+	/* 0x00000546 */ 0x00000576,
+	/* 0x00000547 */ 0x00000577,
+	/* 0x00000548 */ 0x00000578,
+	/* 0x00000549 */ 0x00000579,
+	/* 0x0000054a */ 0x0000057a,
+	/* 0x0000054b */ 0x0000057b,
+	/* 0x0000054c */ 0x0000057c,
+	/* 0x0000054d */ 0x0000057d,
+	/* 0x0000054e */ 0x0000057e,
+	/* 0x0000054f */ 0x0000057f,
+	/* 0x00000550 */ 0x00000580,
+	/* 0x00000551 */ 0x00000581,
+	/* 0x00000552 */ 0x00000582,
+	/* 0x00000553 */ 0x00000583,
+	/* 0x00000554 */ 0x00000584,
+	/* 0x00000555 */ 0x00000585,
+	/* 0x00000556 */ 0x00000586,
+	/* 0x00000557 */ 0x00000557,
+	/* 0x00000558 */ 0x00000558,
+	/* 0x00000559 */ 0x00000559,
+	/* 0x0000055a */ 0x0000055a,
+	/* 0x0000055b */ 0x0000055b,
+	/* 0x0000055c */ 0x0000055c,
+	/* 0x0000055d */ 0x0000055d,
+	/* 0x0000055e */ 0x0000055e,
+	/* 0x0000055f */ 0x0000055f,
+	/* 0x00000560 */ 0x00000560,
+	/* 0x00000561 */ 0x00000561,
+	/* 0x00000562 */ 0x00000562,
+	/* 0x00000563 */ 0x00000563,
+	/* 0x00000564 */ 0x00000564,
+	/* 0x00000565 */ 0x00000565,
+	/* 0x00000566 */ 0x00000566,
+	/* 0x00000567 */ 0x00000567,
+	/* 0x00000568 */ 0x00000568,
+	/* 0x00000569 */ 0x00000569,
+	/* 0x0000056a */ 0x0000056a,
+	/* 0x0000056b */ 0x0000056b,
+	/* 0x0000056c */ 0x0000056c,
+	/* 0x0000056d */ 0x0000056d,
+	/* 0x0000056e */ 0x0000056e,
+	/* 0x0000056f */ 0x0000056f,
+	/* 0x00000570 */ 0x00000570,
+	/* 0x00000571 */ 0x00000571,
+	/* 0x00000572 */ 0x00000572,
+	/* 0x00000573 */ 0x00000573,
+	/* 0x00000574 */ 0x00000574,
+	/* 0x00000575 */ 0x00000575,
+	/* 0x00000576 */ 0x00000576,
+	/* 0x00000577 */ 0x00000577,
+	/* 0x00000578 */ 0x00000578,
+	/* 0x00000579 */ 0x00000579,
+	/* 0x0000057a */ 0x0000057a,
+	/* 0x0000057b */ 0x0000057b,
+	/* 0x0000057c */ 0x0000057c,
+	/* 0x0000057d */ 0x0000057d,
+	/* 0x0000057e */ 0x0000057e,
+	/* 0x0000057f */ 0x0000057f,
+	/* 0x00000580 */ 0x00000580,
+	/* 0x00000581 */ 0x00000581,
+	/* 0x00000582 */ 0x00000582,
+	/* 0x00000583 */ 0x00000583,
+	/* 0x00000584 */ 0x00000584,
+	/* 0x00000585 */ 0x00000585,
+	/* 0x00000586 */ 0x00000586,
+	/* 0x00000587 */ 0x00000587,
+	/* 0x00000588 */ 0x00000588,
+	/* 0x00000589 */ 0x00000589,
+	/* 0x0000058a */ 0x0000058a,
+	/* 0x0000058b */ 0x0000058b,
+	/* 0x0000058c */ 0x0000058c,
+	/* 0x0000058d */ 0x0000058d,
+	/* 0x0000058e */ 0x0000058e,
+	/* 0x0000058f */ 0x0000058f,
+	/* 0x00000590 */ 0x00000590,
+	/* 0x00000591 */ 0x00000591,
+	/* 0x00000592 */ 0x00000592,
+	/* 0x00000593 */ 0x00000593,
+	/* 0x00000594 */ 0x00000594,
+	/* 0x00000595 */ 0x00000595,
+	/* 0x00000596 */ 0x00000596,
+	/* 0x00000597 */ 0x00000597,
+	/* 0x00000598 */ 0x00000598,
+	/* 0x00000599 */ 0x00000599,
+	/* 0x0000059a */ 0x0000059a,
+	/* 0x0000059b */ 0x0000059b,
+	/* 0x0000059c */ 0x0000059c,
+	/* 0x0000059d */ 0x0000059d,
+	/* 0x0000059e */ 0x0000059e,
+	/* 0x0000059f */ 0x0000059f,
+	/* 0x000005a0 */ 0x000005a0,
+	/* 0x000005a1 */ 0x000005a1,
+	/* 0x000005a2 */ 0x000005a2,
+	/* 0x000005a3 */ 0x000005a3,
+	/* 0x000005a4 */ 0x000005a4,
+	/* 0x000005a5 */ 0x000005a5,
+	/* 0x000005a6 */ 0x000005a6,
+	/* 0x000005a7 */ 0x000005a7,
+	/* 0x000005a8 */ 0x000005a8,
+	/* 0x000005a9 */ 0x000005a9,
+	/* 0x000005aa */ 0x000005aa,
+	/* 0x000005ab */ 0x000005ab,
+	/* 0x000005ac */ 0x000005ac,
+	/* 0x000005ad */ 0x000005ad,
+	/* 0x000005ae */ 0x000005ae,
+	/* 0x000005af */ 0x000005af,
+	/* 0x000005b0 */ 0x000005b0,
+	/* 0x000005b1 */ 0x000005b1,
+	/* 0x000005b2 */ 0x000005b2,
+	/* 0x000005b3 */ 0x000005b3,
+	/* 0x000005b4 */ 0x000005b4,
+	/* 0x000005b5 */ 0x000005b5,
+	/* 0x000005b6 */ 0x000005b6,
+	/* 0x000005b7 */ 0x000005b7,
+	/* 0x000005b8 */ 0x000005b8,
+	/* 0x000005b9 */ 0x000005b9,
+	/* 0x000005ba */ 0x000005ba,
+	/* 0x000005bb */ 0x000005bb,
+	/* 0x000005bc */ 0x000005bc,
+	/* 0x000005bd */ 0x000005bd,
+	/* 0x000005be */ 0x000005be,
+	/* 0x000005bf */ 0x000005bf,
+	/* 0x000005c0 */ 0x000005c0,
+	/* 0x000005c1 */ 0x000005c1,
+	/* 0x000005c2 */ 0x000005c2,
+	/* 0x000005c3 */ 0x000005c3,
+	/* 0x000005c4 */ 0x000005c4,
+	/* 0x000005c5 */ 0x000005c5,
+	/* 0x000005c6 */ 0x000005c6,
+	/* 0x000005c7 */ 0x000005c7,
+	/* 0x000005c8 */ 0x000005c8,
+	/* 0x000005c9 */ 0x000005c9,
+	/* 0x000005ca */ 0x000005ca,
+	/* 0x000005cb */ 0x000005cb,
+	/* 0x000005cc */ 0x000005cc,
+	/* 0x000005cd */ 0x000005cd,
+	/* 0x000005ce */ 0x000005ce,
+	/* 0x000005cf */ 0x000005cf,
+	/* 0x000005d0 */ 0x000005d0,
+	/* 0x000005d1 */ 0x000005d1,
+	/* 0x000005d2 */ 0x000005d2,
+	/* 0x000005d3 */ 0x000005d3,
+	/* 0x000005d4 */ 0x000005d4,
+	/* 0x000005d5 */ 0x000005d5,
+	/* 0x000005d6 */ 0x000005d6,
+	/* 0x000005d7 */ 0x000005d7,
+	/* 0x000005d8 */ 0x000005d8,
+	/* 0x000005d9 */ 0x000005d9,
+	/* 0x000005da */ 0x000005da,
+	/* 0x000005db */ 0x000005db,
+	/* 0x000005dc */ 0x000005dc,
+	/* 0x000005dd */ 0x000005dd,
+	/* 0x000005de */ 0x000005de,
+	/* 0x000005df */ 0x000005df,
+	/* 0x000005e0 */ 0x000005e0,
+	/* 0x000005e1 */ 0x000005e1,
+	/* 0x000005e2 */ 0x000005e2,
+	/* 0x000005e3 */ 0x000005e3,
+	/* 0x000005e4 */ 0x000005e4,
+	/* 0x000005e5 */ 0x000005e5,
+	/* 0x000005e6 */ 0x000005e6,
+	/* 0x000005e7 */ 0x000005e7,
+	/* 0x000005e8 */ 0x000005e8,
+	/* 0x000005e9 */ 0x000005e9,
+	/* 0x000005ea */ 0x000005ea,
+	/* 0x000005eb */ 0x000005eb,
+	/* 0x000005ec */ 0x000005ec,
+	/* 0x000005ed */ 0x000005ed,
+	/* 0x000005ee */ 0x000005ee,
+	/* 0x000005ef */ 0x000005ef,
+	/* 0x000005f0 */ 0x000005f0,
+	/* 0x000005f1 */ 0x000005f1,
+	/* 0x000005f2 */ 0x000005f2,
+	/* 0x000005f3 */ 0x000005f3,
+	/* 0x000005f4 */ 0x000005f4,
+	/* 0x000005f5 */ 0x000005f5,
+	/* 0x000005f6 */ 0x000005f6,
+	/* 0x000005f7 */ 0x000005f7,
+	/* 0x000005f8 */ 0x000005f8,
+	/* 0x000005f9 */ 0x000005f9,
+	/* 0x000005fa */ 0x000005fa,
+	/* 0x000005fb */ 0x000005fb,
+	/* 0x000005fc */ 0x000005fc,
+	/* 0x000005fd */ 0x000005fd,
+	/* 0x000005fe */ 0x000005fe,
+	/* 0x000005ff */ 0x000005ff
+};
+
+static uint32_t libfshfs_name_case_folding_mappings_0x00001000[ 256 ] = {
+	/* 0x00001000 */ 0x00001000,
+	/* 0x00001001 */ 0x00001001,
+	/* 0x00001002 */ 0x00001002,
+	/* 0x00001003 */ 0x00001003,
+	/* 0x00001004 */ 0x00001004,
+	/* 0x00001005 */ 0x00001005,
+	/* 0x00001006 */ 0x00001006,
+	/* 0x00001007 */ 0x00001007,
+	/* 0x00001008 */ 0x00001008,
+	/* 0x00001009 */ 0x00001009,
+	/* 0x0000100a */ 0x0000100a,
+	/* 0x0000100b */ 0x0000100b,
+	/* 0x0000100c */ 0x0000100c,
+	/* 0x0000100d */ 0x0000100d,
+	/* 0x0000100e */ 0x0000100e,
+	/* 0x0000100f */ 0x0000100f,
+	/* 0x00001010 */ 0x00001010,
+	/* 0x00001011 */ 0x00001011,
+	/* 0x00001012 */ 0x00001012,
+	/* 0x00001013 */ 0x00001013,
+	/* 0x00001014 */ 0x00001014,
+	/* 0x00001015 */ 0x00001015,
+	/* 0x00001016 */ 0x00001016,
+	/* 0x00001017 */ 0x00001017,
+	/* 0x00001018 */ 0x00001018,
+	/* 0x00001019 */ 0x00001019,
+	/* 0x0000101a */ 0x0000101a,
+	/* 0x0000101b */ 0x0000101b,
+	/* 0x0000101c */ 0x0000101c,
+	/* 0x0000101d */ 0x0000101d,
+	/* 0x0000101e */ 0x0000101e,
+	/* 0x0000101f */ 0x0000101f,
+	/* 0x00001020 */ 0x00001020,
+	/* 0x00001021 */ 0x00001021,
+	/* 0x00001022 */ 0x00001022,
+	/* 0x00001023 */ 0x00001023,
+	/* 0x00001024 */ 0x00001024,
+	/* 0x00001025 */ 0x00001025,
+	/* 0x00001026 */ 0x00001026,
+	/* 0x00001027 */ 0x00001027,
+	/* 0x00001028 */ 0x00001028,
+	/* 0x00001029 */ 0x00001029,
+	/* 0x0000102a */ 0x0000102a,
+	/* 0x0000102b */ 0x0000102b,
+	/* 0x0000102c */ 0x0000102c,
+	/* 0x0000102d */ 0x0000102d,
+	/* 0x0000102e */ 0x0000102e,
+	/* 0x0000102f */ 0x0000102f,
+	/* 0x00001030 */ 0x00001030,
+	/* 0x00001031 */ 0x00001031,
+	/* 0x00001032 */ 0x00001032,
+	/* 0x00001033 */ 0x00001033,
+	/* 0x00001034 */ 0x00001034,
+	/* 0x00001035 */ 0x00001035,
+	/* 0x00001036 */ 0x00001036,
+	/* 0x00001037 */ 0x00001037,
+	/* 0x00001038 */ 0x00001038,
+	/* 0x00001039 */ 0x00001039,
+	/* 0x0000103a */ 0x0000103a,
+	/* 0x0000103b */ 0x0000103b,
+	/* 0x0000103c */ 0x0000103c,
+	/* 0x0000103d */ 0x0000103d,
+	/* 0x0000103e */ 0x0000103e,
+	/* 0x0000103f */ 0x0000103f,
+	/* 0x00001040 */ 0x00001040,
+	/* 0x00001041 */ 0x00001041,
+	/* 0x00001042 */ 0x00001042,
+	/* 0x00001043 */ 0x00001043,
+	/* 0x00001044 */ 0x00001044,
+	/* 0x00001045 */ 0x00001045,
+	/* 0x00001046 */ 0x00001046,
+	/* 0x00001047 */ 0x00001047,
+	/* 0x00001048 */ 0x00001048,
+	/* 0x00001049 */ 0x00001049,
+	/* 0x0000104a */ 0x0000104a,
+	/* 0x0000104b */ 0x0000104b,
+	/* 0x0000104c */ 0x0000104c,
+	/* 0x0000104d */ 0x0000104d,
+	/* 0x0000104e */ 0x0000104e,
+	/* 0x0000104f */ 0x0000104f,
+	/* 0x00001050 */ 0x00001050,
+	/* 0x00001051 */ 0x00001051,
+	/* 0x00001052 */ 0x00001052,
+	/* 0x00001053 */ 0x00001053,
+	/* 0x00001054 */ 0x00001054,
+	/* 0x00001055 */ 0x00001055,
+	/* 0x00001056 */ 0x00001056,
+	/* 0x00001057 */ 0x00001057,
+	/* 0x00001058 */ 0x00001058,
+	/* 0x00001059 */ 0x00001059,
+	/* 0x0000105a */ 0x0000105a,
+	/* 0x0000105b */ 0x0000105b,
+	/* 0x0000105c */ 0x0000105c,
+	/* 0x0000105d */ 0x0000105d,
+	/* 0x0000105e */ 0x0000105e,
+	/* 0x0000105f */ 0x0000105f,
+	/* 0x00001060 */ 0x00001060,
+	/* 0x00001061 */ 0x00001061,
+	/* 0x00001062 */ 0x00001062,
+	/* 0x00001063 */ 0x00001063,
+	/* 0x00001064 */ 0x00001064,
+	/* 0x00001065 */ 0x00001065,
+	/* 0x00001066 */ 0x00001066,
+	/* 0x00001067 */ 0x00001067,
+	/* 0x00001068 */ 0x00001068,
+	/* 0x00001069 */ 0x00001069,
+	/* 0x0000106a */ 0x0000106a,
+	/* 0x0000106b */ 0x0000106b,
+	/* 0x0000106c */ 0x0000106c,
+	/* 0x0000106d */ 0x0000106d,
+	/* 0x0000106e */ 0x0000106e,
+	/* 0x0000106f */ 0x0000106f,
+	/* 0x00001070 */ 0x00001070,
+	/* 0x00001071 */ 0x00001071,
+	/* 0x00001072 */ 0x00001072,
+	/* 0x00001073 */ 0x00001073,
+	/* 0x00001074 */ 0x00001074,
+	/* 0x00001075 */ 0x00001075,
+	/* 0x00001076 */ 0x00001076,
+	/* 0x00001077 */ 0x00001077,
+	/* 0x00001078 */ 0x00001078,
+	/* 0x00001079 */ 0x00001079,
+	/* 0x0000107a */ 0x0000107a,
+	/* 0x0000107b */ 0x0000107b,
+	/* 0x0000107c */ 0x0000107c,
+	/* 0x0000107d */ 0x0000107d,
+	/* 0x0000107e */ 0x0000107e,
+	/* 0x0000107f */ 0x0000107f,
+	/* 0x00001080 */ 0x00001080,
+	/* 0x00001081 */ 0x00001081,
+	/* 0x00001082 */ 0x00001082,
+	/* 0x00001083 */ 0x00001083,
+	/* 0x00001084 */ 0x00001084,
+	/* 0x00001085 */ 0x00001085,
+	/* 0x00001086 */ 0x00001086,
+	/* 0x00001087 */ 0x00001087,
+	/* 0x00001088 */ 0x00001088,
+	/* 0x00001089 */ 0x00001089,
+	/* 0x0000108a */ 0x0000108a,
+	/* 0x0000108b */ 0x0000108b,
+	/* 0x0000108c */ 0x0000108c,
+	/* 0x0000108d */ 0x0000108d,
+	/* 0x0000108e */ 0x0000108e,
+	/* 0x0000108f */ 0x0000108f,
+	/* 0x00001090 */ 0x00001090,
+	/* 0x00001091 */ 0x00001091,
+	/* 0x00001092 */ 0x00001092,
+	/* 0x00001093 */ 0x00001093,
+	/* 0x00001094 */ 0x00001094,
+	/* 0x00001095 */ 0x00001095,
+	/* 0x00001096 */ 0x00001096,
+	/* 0x00001097 */ 0x00001097,
+	/* 0x00001098 */ 0x00001098,
+	/* 0x00001099 */ 0x00001099,
+	/* 0x0000109a */ 0x0000109a,
+	/* 0x0000109b */ 0x0000109b,
+	/* 0x0000109c */ 0x0000109c,
+	/* 0x0000109d */ 0x0000109d,
+	/* 0x0000109e */ 0x0000109e,
+	/* 0x0000109f */ 0x0000109f,
+	/* 0x000010a0 */ 0x00002d00,
+	/* 0x000010a1 */ 0x00002d01,
+	/* 0x000010a2 */ 0x00002d02,
+	/* 0x000010a3 */ 0x00002d03,
+	/* 0x000010a4 */ 0x00002d04,
+	/* 0x000010a5 */ 0x00002d05,
+	/* 0x000010a6 */ 0x00002d06,
+	/* 0x000010a7 */ 0x00002d07,
+	/* 0x000010a8 */ 0x00002d08,
+	/* 0x000010a9 */ 0x00002d09,
+	/* 0x000010aa */ 0x00002d0a,
+	/* 0x000010ab */ 0x00002d0b,
+	/* 0x000010ac */ 0x00002d0c,
+	/* 0x000010ad */ 0x00002d0d,
+	/* 0x000010ae */ 0x00002d0e,
+	/* 0x000010af */ 0x00002d0f,
+	/* 0x000010b0 */ 0x00002d10,
+	/* 0x000010b1 */ 0x00002d11,
+	/* 0x000010b2 */ 0x00002d12,
+	/* 0x000010b3 */ 0x00002d13,
+	/* 0x000010b4 */ 0x00002d14,
+	/* 0x000010b5 */ 0x00002d15,
+	/* 0x000010b6 */ 0x00002d16,
+	/* 0x000010b7 */ 0x00002d17,
+	/* 0x000010b8 */ 0x00002d18,
+	/* 0x000010b9 */ 0x00002d19,
+	/* 0x000010ba */ 0x00002d1a,
+	/* 0x000010bb */ 0x00002d1b,
+	/* 0x000010bc */ 0x00002d1c,
+	/* 0x000010bd */ 0x00002d1d,
+	/* 0x000010be */ 0x00002d1e,
+	/* 0x000010bf */ 0x00002d1f,
+	/* 0x000010c0 */ 0x00002d20,
+	/* 0x000010c1 */ 0x00002d21,
+	/* 0x000010c2 */ 0x00002d22,
+	/* 0x000010c3 */ 0x00002d23,
+	/* 0x000010c4 */ 0x00002d24,
+	/* 0x000010c5 */ 0x00002d25,
+	/* 0x000010c6 */ 0x000010c6,
+	/* 0x000010c7 */ 0x00002d27,
+	/* 0x000010c8 */ 0x000010c8,
+	/* 0x000010c9 */ 0x000010c9,
+	/* 0x000010ca */ 0x000010ca,
+	/* 0x000010cb */ 0x000010cb,
+	/* 0x000010cc */ 0x000010cc,
+	/* 0x000010cd */ 0x00002d2d,
+	/* 0x000010ce */ 0x000010ce,
+	/* 0x000010cf */ 0x000010cf,
+	/* 0x000010d0 */ 0x000010d0,
+	/* 0x000010d1 */ 0x000010d1,
+	/* 0x000010d2 */ 0x000010d2,
+	/* 0x000010d3 */ 0x000010d3,
+	/* 0x000010d4 */ 0x000010d4,
+	/* 0x000010d5 */ 0x000010d5,
+	/* 0x000010d6 */ 0x000010d6,
+	/* 0x000010d7 */ 0x000010d7,
+	/* 0x000010d8 */ 0x000010d8,
+	/* 0x000010d9 */ 0x000010d9,
+	/* 0x000010da */ 0x000010da,
+	/* 0x000010db */ 0x000010db,
+	/* 0x000010dc */ 0x000010dc,
+	/* 0x000010dd */ 0x000010dd,
+	/* 0x000010de */ 0x000010de,
+	/* 0x000010df */ 0x000010df,
+	/* 0x000010e0 */ 0x000010e0,
+	/* 0x000010e1 */ 0x000010e1,
+	/* 0x000010e2 */ 0x000010e2,
+	/* 0x000010e3 */ 0x000010e3,
+	/* 0x000010e4 */ 0x000010e4,
+	/* 0x000010e5 */ 0x000010e5,
+	/* 0x000010e6 */ 0x000010e6,
+	/* 0x000010e7 */ 0x000010e7,
+	/* 0x000010e8 */ 0x000010e8,
+	/* 0x000010e9 */ 0x000010e9,
+	/* 0x000010ea */ 0x000010ea,
+	/* 0x000010eb */ 0x000010eb,
+	/* 0x000010ec */ 0x000010ec,
+	/* 0x000010ed */ 0x000010ed,
+	/* 0x000010ee */ 0x000010ee,
+	/* 0x000010ef */ 0x000010ef,
+	/* 0x000010f0 */ 0x000010f0,
+	/* 0x000010f1 */ 0x000010f1,
+	/* 0x000010f2 */ 0x000010f2,
+	/* 0x000010f3 */ 0x000010f3,
+	/* 0x000010f4 */ 0x000010f4,
+	/* 0x000010f5 */ 0x000010f5,
+	/* 0x000010f6 */ 0x000010f6,
+	/* 0x000010f7 */ 0x000010f7,
+	/* 0x000010f8 */ 0x000010f8,
+	/* 0x000010f9 */ 0x000010f9,
+	/* 0x000010fa */ 0x000010fa,
+	/* 0x000010fb */ 0x000010fb,
+	/* 0x000010fc */ 0x000010fc,
+	/* 0x000010fd */ 0x000010fd,
+	/* 0x000010fe */ 0x000010fe,
+	/* 0x000010ff */ 0x000010ff
+};
+
+static uint32_t libfshfs_name_case_folding_mappings_0x00001300[ 256 ] = {
+	/* 0x00001300 */ 0x00001300,
+	/* 0x00001301 */ 0x00001301,
+	/* 0x00001302 */ 0x00001302,
+	/* 0x00001303 */ 0x00001303,
+	/* 0x00001304 */ 0x00001304,
+	/* 0x00001305 */ 0x00001305,
+	/* 0x00001306 */ 0x00001306,
+	/* 0x00001307 */ 0x00001307,
+	/* 0x00001308 */ 0x00001308,
+	/* 0x00001309 */ 0x00001309,
+	/* 0x0000130a */ 0x0000130a,
+	/* 0x0000130b */ 0x0000130b,
+	/* 0x0000130c */ 0x0000130c,
+	/* 0x0000130d */ 0x0000130d,
+	/* 0x0000130e */ 0x0000130e,
+	/* 0x0000130f */ 0x0000130f,
+	/* 0x00001310 */ 0x00001310,
+	/* 0x00001311 */ 0x00001311,
+	/* 0x00001312 */ 0x00001312,
+	/* 0x00001313 */ 0x00001313,
+	/* 0x00001314 */ 0x00001314,
+	/* 0x00001315 */ 0x00001315,
+	/* 0x00001316 */ 0x00001316,
+	/* 0x00001317 */ 0x00001317,
+	/* 0x00001318 */ 0x00001318,
+	/* 0x00001319 */ 0x00001319,
+	/* 0x0000131a */ 0x0000131a,
+	/* 0x0000131b */ 0x0000131b,
+	/* 0x0000131c */ 0x0000131c,
+	/* 0x0000131d */ 0x0000131d,
+	/* 0x0000131e */ 0x0000131e,
+	/* 0x0000131f */ 0x0000131f,
+	/* 0x00001320 */ 0x00001320,
+	/* 0x00001321 */ 0x00001321,
+	/* 0x00001322 */ 0x00001322,
+	/* 0x00001323 */ 0x00001323,
+	/* 0x00001324 */ 0x00001324,
+	/* 0x00001325 */ 0x00001325,
+	/* 0x00001326 */ 0x00001326,
+	/* 0x00001327 */ 0x00001327,
+	/* 0x00001328 */ 0x00001328,
+	/* 0x00001329 */ 0x00001329,
+	/* 0x0000132a */ 0x0000132a,
+	/* 0x0000132b */ 0x0000132b,
+	/* 0x0000132c */ 0x0000132c,
+	/* 0x0000132d */ 0x0000132d,
+	/* 0x0000132e */ 0x0000132e,
+	/* 0x0000132f */ 0x0000132f,
+	/* 0x00001330 */ 0x00001330,
+	/* 0x00001331 */ 0x00001331,
+	/* 0x00001332 */ 0x00001332,
+	/* 0x00001333 */ 0x00001333,
+	/* 0x00001334 */ 0x00001334,
+	/* 0x00001335 */ 0x00001335,
+	/* 0x00001336 */ 0x00001336,
+	/* 0x00001337 */ 0x00001337,
+	/* 0x00001338 */ 0x00001338,
+	/* 0x00001339 */ 0x00001339,
+	/* 0x0000133a */ 0x0000133a,
+	/* 0x0000133b */ 0x0000133b,
+	/* 0x0000133c */ 0x0000133c,
+	/* 0x0000133d */ 0x0000133d,
+	/* 0x0000133e */ 0x0000133e,
+	/* 0x0000133f */ 0x0000133f,
+	/* 0x00001340 */ 0x00001340,
+	/* 0x00001341 */ 0x00001341,
+	/* 0x00001342 */ 0x00001342,
+	/* 0x00001343 */ 0x00001343,
+	/* 0x00001344 */ 0x00001344,
+	/* 0x00001345 */ 0x00001345,
+	/* 0x00001346 */ 0x00001346,
+	/* 0x00001347 */ 0x00001347,
+	/* 0x00001348 */ 0x00001348,
+	/* 0x00001349 */ 0x00001349,
+	/* 0x0000134a */ 0x0000134a,
+	/* 0x0000134b */ 0x0000134b,
+	/* 0x0000134c */ 0x0000134c,
+	/* 0x0000134d */ 0x0000134d,
+	/* 0x0000134e */ 0x0000134e,
+	/* 0x0000134f */ 0x0000134f,
+	/* 0x00001350 */ 0x00001350,
+	/* 0x00001351 */ 0x00001351,
+	/* 0x00001352 */ 0x00001352,
+	/* 0x00001353 */ 0x00001353,
+	/* 0x00001354 */ 0x00001354,
+	/* 0x00001355 */ 0x00001355,
+	/* 0x00001356 */ 0x00001356,
+	/* 0x00001357 */ 0x00001357,
+	/* 0x00001358 */ 0x00001358,
+	/* 0x00001359 */ 0x00001359,
+	/* 0x0000135a */ 0x0000135a,
+	/* 0x0000135b */ 0x0000135b,
+	/* 0x0000135c */ 0x0000135c,
+	/* 0x0000135d */ 0x0000135d,
+	/* 0x0000135e */ 0x0000135e,
+	/* 0x0000135f */ 0x0000135f,
+	/* 0x00001360 */ 0x00001360,
+	/* 0x00001361 */ 0x00001361,
+	/* 0x00001362 */ 0x00001362,
+	/* 0x00001363 */ 0x00001363,
+	/* 0x00001364 */ 0x00001364,
+	/* 0x00001365 */ 0x00001365,
+	/* 0x00001366 */ 0x00001366,
+	/* 0x00001367 */ 0x00001367,
+	/* 0x00001368 */ 0x00001368,
+	/* 0x00001369 */ 0x00001369,
+	/* 0x0000136a */ 0x0000136a,
+	/* 0x0000136b */ 0x0000136b,
+	/* 0x0000136c */ 0x0000136c,
+	/* 0x0000136d */ 0x0000136d,
+	/* 0x0000136e */ 0x0000136e,
+	/* 0x0000136f */ 0x0000136f,
+	/* 0x00001370 */ 0x00001370,
+	/* 0x00001371 */ 0x00001371,
+	/* 0x00001372 */ 0x00001372,
+	/* 0x00001373 */ 0x00001373,
+	/* 0x00001374 */ 0x00001374,
+	/* 0x00001375 */ 0x00001375,
+	/* 0x00001376 */ 0x00001376,
+	/* 0x00001377 */ 0x00001377,
+	/* 0x00001378 */ 0x00001378,
+	/* 0x00001379 */ 0x00001379,
+	/* 0x0000137a */ 0x0000137a,
+	/* 0x0000137b */ 0x0000137b,
+	/* 0x0000137c */ 0x0000137c,
+	/* 0x0000137d */ 0x0000137d,
+	/* 0x0000137e */ 0x0000137e,
+	/* 0x0000137f */ 0x0000137f,
+	/* 0x00001380 */ 0x00001380,
+	/* 0x00001381 */ 0x00001381,
+	/* 0x00001382 */ 0x00001382,
+	/* 0x00001383 */ 0x00001383,
+	/* 0x00001384 */ 0x00001384,
+	/* 0x00001385 */ 0x00001385,
+	/* 0x00001386 */ 0x00001386,
+	/* 0x00001387 */ 0x00001387,
+	/* 0x00001388 */ 0x00001388,
+	/* 0x00001389 */ 0x00001389,
+	/* 0x0000138a */ 0x0000138a,
+	/* 0x0000138b */ 0x0000138b,
+	/* 0x0000138c */ 0x0000138c,
+	/* 0x0000138d */ 0x0000138d,
+	/* 0x0000138e */ 0x0000138e,
+	/* 0x0000138f */ 0x0000138f,
+	/* 0x00001390 */ 0x00001390,
+	/* 0x00001391 */ 0x00001391,
+	/* 0x00001392 */ 0x00001392,
+	/* 0x00001393 */ 0x00001393,
+	/* 0x00001394 */ 0x00001394,
+	/* 0x00001395 */ 0x00001395,
+	/* 0x00001396 */ 0x00001396,
+	/* 0x00001397 */ 0x00001397,
+	/* 0x00001398 */ 0x00001398,
+	/* 0x00001399 */ 0x00001399,
+	/* 0x0000139a */ 0x0000139a,
+	/* 0x0000139b */ 0x0000139b,
+	/* 0x0000139c */ 0x0000139c,
+	/* 0x0000139d */ 0x0000139d,
+	/* 0x0000139e */ 0x0000139e,
+	/* 0x0000139f */ 0x0000139f,
+	/* 0x000013a0 */ 0x000013a0,
+	/* 0x000013a1 */ 0x000013a1,
+	/* 0x000013a2 */ 0x000013a2,
+	/* 0x000013a3 */ 0x000013a3,
+	/* 0x000013a4 */ 0x000013a4,
+	/* 0x000013a5 */ 0x000013a5,
+	/* 0x000013a6 */ 0x000013a6,
+	/* 0x000013a7 */ 0x000013a7,
+	/* 0x000013a8 */ 0x000013a8,
+	/* 0x000013a9 */ 0x000013a9,
+	/* 0x000013aa */ 0x000013aa,
+	/* 0x000013ab */ 0x000013ab,
+	/* 0x000013ac */ 0x000013ac,
+	/* 0x000013ad */ 0x000013ad,
+	/* 0x000013ae */ 0x000013ae,
+	/* 0x000013af */ 0x000013af,
+	/* 0x000013b0 */ 0x000013b0,
+	/* 0x000013b1 */ 0x000013b1,
+	/* 0x000013b2 */ 0x000013b2,
+	/* 0x000013b3 */ 0x000013b3,
+	/* 0x000013b4 */ 0x000013b4,
+	/* 0x000013b5 */ 0x000013b5,
+	/* 0x000013b6 */ 0x000013b6,
+	/* 0x000013b7 */ 0x000013b7,
+	/* 0x000013b8 */ 0x000013b8,
+	/* 0x000013b9 */ 0x000013b9,
+	/* 0x000013ba */ 0x000013ba,
+	/* 0x000013bb */ 0x000013bb,
+	/* 0x000013bc */ 0x000013bc,
+	/* 0x000013bd */ 0x000013bd,
+	/* 0x000013be */ 0x000013be,
+	/* 0x000013bf */ 0x000013bf,
+	/* 0x000013c0 */ 0x000013c0,
+	/* 0x000013c1 */ 0x000013c1,
+	/* 0x000013c2 */ 0x000013c2,
+	/* 0x000013c3 */ 0x000013c3,
+	/* 0x000013c4 */ 0x000013c4,
+	/* 0x000013c5 */ 0x000013c5,
+	/* 0x000013c6 */ 0x000013c6,
+	/* 0x000013c7 */ 0x000013c7,
+	/* 0x000013c8 */ 0x000013c8,
+	/* 0x000013c9 */ 0x000013c9,
+	/* 0x000013ca */ 0x000013ca,
+	/* 0x000013cb */ 0x000013cb,
+	/* 0x000013cc */ 0x000013cc,
+	/* 0x000013cd */ 0x000013cd,
+	/* 0x000013ce */ 0x000013ce,
+	/* 0x000013cf */ 0x000013cf,
+	/* 0x000013d0 */ 0x000013d0,
+	/* 0x000013d1 */ 0x000013d1,
+	/* 0x000013d2 */ 0x000013d2,
+	/* 0x000013d3 */ 0x000013d3,
+	/* 0x000013d4 */ 0x000013d4,
+	/* 0x000013d5 */ 0x000013d5,
+	/* 0x000013d6 */ 0x000013d6,
+	/* 0x000013d7 */ 0x000013d7,
+	/* 0x000013d8 */ 0x000013d8,
+	/* 0x000013d9 */ 0x000013d9,
+	/* 0x000013da */ 0x000013da,
+	/* 0x000013db */ 0x000013db,
+	/* 0x000013dc */ 0x000013dc,
+	/* 0x000013dd */ 0x000013dd,
+	/* 0x000013de */ 0x000013de,
+	/* 0x000013df */ 0x000013df,
+	/* 0x000013e0 */ 0x000013e0,
+	/* 0x000013e1 */ 0x000013e1,
+	/* 0x000013e2 */ 0x000013e2,
+	/* 0x000013e3 */ 0x000013e3,
+	/* 0x000013e4 */ 0x000013e4,
+	/* 0x000013e5 */ 0x000013e5,
+	/* 0x000013e6 */ 0x000013e6,
+	/* 0x000013e7 */ 0x000013e7,
+	/* 0x000013e8 */ 0x000013e8,
+	/* 0x000013e9 */ 0x000013e9,
+	/* 0x000013ea */ 0x000013ea,
+	/* 0x000013eb */ 0x000013eb,
+	/* 0x000013ec */ 0x000013ec,
+	/* 0x000013ed */ 0x000013ed,
+	/* 0x000013ee */ 0x000013ee,
+	/* 0x000013ef */ 0x000013ef,
+	/* 0x000013f0 */ 0x000013f0,
+	/* 0x000013f1 */ 0x000013f1,
+	/* 0x000013f2 */ 0x000013f2,
+	/* 0x000013f3 */ 0x000013f3,
+	/* 0x000013f4 */ 0x000013f4,
+	/* 0x000013f5 */ 0x000013f5,
+	/* 0x000013f6 */ 0x000013f6,
+	/* 0x000013f7 */ 0x000013f7,
+	/* 0x000013f8 */ 0x000013f0,
+	/* 0x000013f9 */ 0x000013f1,
+	/* 0x000013fa */ 0x000013f2,
+	/* 0x000013fb */ 0x000013f3,
+	/* 0x000013fc */ 0x000013f4,
+	/* 0x000013fd */ 0x000013f5,
+	/* 0x000013fe */ 0x000013fe,
+	/* 0x000013ff */ 0x000013ff
+};
+
+static uint32_t libfshfs_name_case_folding_mappings_0x00001c00[ 256 ] = {
+	/* 0x00001c00 */ 0x00001c00,
+	/* 0x00001c01 */ 0x00001c01,
+	/* 0x00001c02 */ 0x00001c02,
+	/* 0x00001c03 */ 0x00001c03,
+	/* 0x00001c04 */ 0x00001c04,
+	/* 0x00001c05 */ 0x00001c05,
+	/* 0x00001c06 */ 0x00001c06,
+	/* 0x00001c07 */ 0x00001c07,
+	/* 0x00001c08 */ 0x00001c08,
+	/* 0x00001c09 */ 0x00001c09,
+	/* 0x00001c0a */ 0x00001c0a,
+	/* 0x00001c0b */ 0x00001c0b,
+	/* 0x00001c0c */ 0x00001c0c,
+	/* 0x00001c0d */ 0x00001c0d,
+	/* 0x00001c0e */ 0x00001c0e,
+	/* 0x00001c0f */ 0x00001c0f,
+	/* 0x00001c10 */ 0x00001c10,
+	/* 0x00001c11 */ 0x00001c11,
+	/* 0x00001c12 */ 0x00001c12,
+	/* 0x00001c13 */ 0x00001c13,
+	/* 0x00001c14 */ 0x00001c14,
+	/* 0x00001c15 */ 0x00001c15,
+	/* 0x00001c16 */ 0x00001c16,
+	/* 0x00001c17 */ 0x00001c17,
+	/* 0x00001c18 */ 0x00001c18,
+	/* 0x00001c19 */ 0x00001c19,
+	/* 0x00001c1a */ 0x00001c1a,
+	/* 0x00001c1b */ 0x00001c1b,
+	/* 0x00001c1c */ 0x00001c1c,
+	/* 0x00001c1d */ 0x00001c1d,
+	/* 0x00001c1e */ 0x00001c1e,
+	/* 0x00001c1f */ 0x00001c1f,
+	/* 0x00001c20 */ 0x00001c20,
+	/* 0x00001c21 */ 0x00001c21,
+	/* 0x00001c22 */ 0x00001c22,
+	/* 0x00001c23 */ 0x00001c23,
+	/* 0x00001c24 */ 0x00001c24,
+	/* 0x00001c25 */ 0x00001c25,
+	/* 0x00001c26 */ 0x00001c26,
+	/* 0x00001c27 */ 0x00001c27,
+	/* 0x00001c28 */ 0x00001c28,
+	/* 0x00001c29 */ 0x00001c29,
+	/* 0x00001c2a */ 0x00001c2a,
+	/* 0x00001c2b */ 0x00001c2b,
+	/* 0x00001c2c */ 0x00001c2c,
+	/* 0x00001c2d */ 0x00001c2d,
+	/* 0x00001c2e */ 0x00001c2e,
+	/* 0x00001c2f */ 0x00001c2f,
+	/* 0x00001c30 */ 0x00001c30,
+	/* 0x00001c31 */ 0x00001c31,
+	/* 0x00001c32 */ 0x00001c32,
+	/* 0x00001c33 */ 0x00001c33,
+	/* 0x00001c34 */ 0x00001c34,
+	/* 0x00001c35 */ 0x00001c35,
+	/* 0x00001c36 */ 0x00001c36,
+	/* 0x00001c37 */ 0x00001c37,
+	/* 0x00001c38 */ 0x00001c38,
+	/* 0x00001c39 */ 0x00001c39,
+	/* 0x00001c3a */ 0x00001c3a,
+	/* 0x00001c3b */ 0x00001c3b,
+	/* 0x00001c3c */ 0x00001c3c,
+	/* 0x00001c3d */ 0x00001c3d,
+	/* 0x00001c3e */ 0x00001c3e,
+	/* 0x00001c3f */ 0x00001c3f,
+	/* 0x00001c40 */ 0x00001c40,
+	/* 0x00001c41 */ 0x00001c41,
+	/* 0x00001c42 */ 0x00001c42,
+	/* 0x00001c43 */ 0x00001c43,
+	/* 0x00001c44 */ 0x00001c44,
+	/* 0x00001c45 */ 0x00001c45,
+	/* 0x00001c46 */ 0x00001c46,
+	/* 0x00001c47 */ 0x00001c47,
+	/* 0x00001c48 */ 0x00001c48,
+	/* 0x00001c49 */ 0x00001c49,
+	/* 0x00001c4a */ 0x00001c4a,
+	/* 0x00001c4b */ 0x00001c4b,
+	/* 0x00001c4c */ 0x00001c4c,
+	/* 0x00001c4d */ 0x00001c4d,
+	/* 0x00001c4e */ 0x00001c4e,
+	/* 0x00001c4f */ 0x00001c4f,
+	/* 0x00001c50 */ 0x00001c50,
+	/* 0x00001c51 */ 0x00001c51,
+	/* 0x00001c52 */ 0x00001c52,
+	/* 0x00001c53 */ 0x00001c53,
+	/* 0x00001c54 */ 0x00001c54,
+	/* 0x00001c55 */ 0x00001c55,
+	/* 0x00001c56 */ 0x00001c56,
+	/* 0x00001c57 */ 0x00001c57,
+	/* 0x00001c58 */ 0x00001c58,
+	/* 0x00001c59 */ 0x00001c59,
+	/* 0x00001c5a */ 0x00001c5a,
+	/* 0x00001c5b */ 0x00001c5b,
+	/* 0x00001c5c */ 0x00001c5c,
+	/* 0x00001c5d */ 0x00001c5d,
+	/* 0x00001c5e */ 0x00001c5e,
+	/* 0x00001c5f */ 0x00001c5f,
+	/* 0x00001c60 */ 0x00001c60,
+	/* 0x00001c61 */ 0x00001c61,
+	/* 0x00001c62 */ 0x00001c62,
+	/* 0x00001c63 */ 0x00001c63,
+	/* 0x00001c64 */ 0x00001c64,
+	/* 0x00001c65 */ 0x00001c65,
+	/* 0x00001c66 */ 0x00001c66,
+	/* 0x00001c67 */ 0x00001c67,
+	/* 0x00001c68 */ 0x00001c68,
+	/* 0x00001c69 */ 0x00001c69,
+	/* 0x00001c6a */ 0x00001c6a,
+	/* 0x00001c6b */ 0x00001c6b,
+	/* 0x00001c6c */ 0x00001c6c,
+	/* 0x00001c6d */ 0x00001c6d,
+	/* 0x00001c6e */ 0x00001c6e,
+	/* 0x00001c6f */ 0x00001c6f,
+	/* 0x00001c70 */ 0x00001c70,
+	/* 0x00001c71 */ 0x00001c71,
+	/* 0x00001c72 */ 0x00001c72,
+	/* 0x00001c73 */ 0x00001c73,
+	/* 0x00001c74 */ 0x00001c74,
+	/* 0x00001c75 */ 0x00001c75,
+	/* 0x00001c76 */ 0x00001c76,
+	/* 0x00001c77 */ 0x00001c77,
+	/* 0x00001c78 */ 0x00001c78,
+	/* 0x00001c79 */ 0x00001c79,
+	/* 0x00001c7a */ 0x00001c7a,
+	/* 0x00001c7b */ 0x00001c7b,
+	/* 0x00001c7c */ 0x00001c7c,
+	/* 0x00001c7d */ 0x00001c7d,
+	/* 0x00001c7e */ 0x00001c7e,
+	/* 0x00001c7f */ 0x00001c7f,
+	/* 0x00001c80 */ 0x00000432,
+	/* 0x00001c81 */ 0x00000434,
+	/* 0x00001c82 */ 0x0000043e,
+	/* 0x00001c83 */ 0x00000441,
+	/* 0x00001c84 */ 0x00000442,
+	/* 0x00001c85 */ 0x00000442,
+	/* 0x00001c86 */ 0x0000044a,
+	/* 0x00001c87 */ 0x00000463,
+	/* 0x00001c88 */ 0x0000a64b,
+	/* 0x00001c89 */ 0x00001c89,
+	/* 0x00001c8a */ 0x00001c8a,
+	/* 0x00001c8b */ 0x00001c8b,
+	/* 0x00001c8c */ 0x00001c8c,
+	/* 0x00001c8d */ 0x00001c8d,
+	/* 0x00001c8e */ 0x00001c8e,
+	/* 0x00001c8f */ 0x00001c8f,
+	/* 0x00001c90 */ 0x00001c90,
+	/* 0x00001c91 */ 0x00001c91,
+	/* 0x00001c92 */ 0x00001c92,
+	/* 0x00001c93 */ 0x00001c93,
+	/* 0x00001c94 */ 0x00001c94,
+	/* 0x00001c95 */ 0x00001c95,
+	/* 0x00001c96 */ 0x00001c96,
+	/* 0x00001c97 */ 0x00001c97,
+	/* 0x00001c98 */ 0x00001c98,
+	/* 0x00001c99 */ 0x00001c99,
+	/* 0x00001c9a */ 0x00001c9a,
+	/* 0x00001c9b */ 0x00001c9b,
+	/* 0x00001c9c */ 0x00001c9c,
+	/* 0x00001c9d */ 0x00001c9d,
+	/* 0x00001c9e */ 0x00001c9e,
+	/* 0x00001c9f */ 0x00001c9f,
+	/* 0x00001ca0 */ 0x00001ca0,
+	/* 0x00001ca1 */ 0x00001ca1,
+	/* 0x00001ca2 */ 0x00001ca2,
+	/* 0x00001ca3 */ 0x00001ca3,
+	/* 0x00001ca4 */ 0x00001ca4,
+	/* 0x00001ca5 */ 0x00001ca5,
+	/* 0x00001ca6 */ 0x00001ca6,
+	/* 0x00001ca7 */ 0x00001ca7,
+	/* 0x00001ca8 */ 0x00001ca8,
+	/* 0x00001ca9 */ 0x00001ca9,
+	/* 0x00001caa */ 0x00001caa,
+	/* 0x00001cab */ 0x00001cab,
+	/* 0x00001cac */ 0x00001cac,
+	/* 0x00001cad */ 0x00001cad,
+	/* 0x00001cae */ 0x00001cae,
+	/* 0x00001caf */ 0x00001caf,
+	/* 0x00001cb0 */ 0x00001cb0,
+	/* 0x00001cb1 */ 0x00001cb1,
+	/* 0x00001cb2 */ 0x00001cb2,
+	/* 0x00001cb3 */ 0x00001cb3,
+	/* 0x00001cb4 */ 0x00001cb4,
+	/* 0x00001cb5 */ 0x00001cb5,
+	/* 0x00001cb6 */ 0x00001cb6,
+	/* 0x00001cb7 */ 0x00001cb7,
+	/* 0x00001cb8 */ 0x00001cb8,
+	/* 0x00001cb9 */ 0x00001cb9,
+	/* 0x00001cba */ 0x00001cba,
+	/* 0x00001cbb */ 0x00001cbb,
+	/* 0x00001cbc */ 0x00001cbc,
+	/* 0x00001cbd */ 0x00001cbd,
+	/* 0x00001cbe */ 0x00001cbe,
+	/* 0x00001cbf */ 0x00001cbf,
+	/* 0x00001cc0 */ 0x00001cc0,
+	/* 0x00001cc1 */ 0x00001cc1,
+	/* 0x00001cc2 */ 0x00001cc2,
+	/* 0x00001cc3 */ 0x00001cc3,
+	/* 0x00001cc4 */ 0x00001cc4,
+	/* 0x00001cc5 */ 0x00001cc5,
+	/* 0x00001cc6 */ 0x00001cc6,
+	/* 0x00001cc7 */ 0x00001cc7,
+	/* 0x00001cc8 */ 0x00001cc8,
+	/* 0x00001cc9 */ 0x00001cc9,
+	/* 0x00001cca */ 0x00001cca,
+	/* 0x00001ccb */ 0x00001ccb,
+	/* 0x00001ccc */ 0x00001ccc,
+	/* 0x00001ccd */ 0x00001ccd,
+	/* 0x00001cce */ 0x00001cce,
+	/* 0x00001ccf */ 0x00001ccf,
+	/* 0x00001cd0 */ 0x00001cd0,
+	/* 0x00001cd1 */ 0x00001cd1,
+	/* 0x00001cd2 */ 0x00001cd2,
+	/* 0x00001cd3 */ 0x00001cd3,
+	/* 0x00001cd4 */ 0x00001cd4,
+	/* 0x00001cd5 */ 0x00001cd5,
+	/* 0x00001cd6 */ 0x00001cd6,
+	/* 0x00001cd7 */ 0x00001cd7,
+	/* 0x00001cd8 */ 0x00001cd8,
+	/* 0x00001cd9 */ 0x00001cd9,
+	/* 0x00001cda */ 0x00001cda,
+	/* 0x00001cdb */ 0x00001cdb,
+	/* 0x00001cdc */ 0x00001cdc,
+	/* 0x00001cdd */ 0x00001cdd,
+	/* 0x00001cde */ 0x00001cde,
+	/* 0x00001cdf */ 0x00001cdf,
+	/* 0x00001ce0 */ 0x00001ce0,
+	/* 0x00001ce1 */ 0x00001ce1,
+	/* 0x00001ce2 */ 0x00001ce2,
+	/* 0x00001ce3 */ 0x00001ce3,
+	/* 0x00001ce4 */ 0x00001ce4,
+	/* 0x00001ce5 */ 0x00001ce5,
+	/* 0x00001ce6 */ 0x00001ce6,
+	/* 0x00001ce7 */ 0x00001ce7,
+	/* 0x00001ce8 */ 0x00001ce8,
+	/* 0x00001ce9 */ 0x00001ce9,
+	/* 0x00001cea */ 0x00001cea,
+	/* 0x00001ceb */ 0x00001ceb,
+	/* 0x00001cec */ 0x00001cec,
+	/* 0x00001ced */ 0x00001ced,
+	/* 0x00001cee */ 0x00001cee,
+	/* 0x00001cef */ 0x00001cef,
+	/* 0x00001cf0 */ 0x00001cf0,
+	/* 0x00001cf1 */ 0x00001cf1,
+	/* 0x00001cf2 */ 0x00001cf2,
+	/* 0x00001cf3 */ 0x00001cf3,
+	/* 0x00001cf4 */ 0x00001cf4,
+	/* 0x00001cf5 */ 0x00001cf5,
+	/* 0x00001cf6 */ 0x00001cf6,
+	/* 0x00001cf7 */ 0x00001cf7,
+	/* 0x00001cf8 */ 0x00001cf8,
+	/* 0x00001cf9 */ 0x00001cf9,
+	/* 0x00001cfa */ 0x00001cfa,
+	/* 0x00001cfb */ 0x00001cfb,
+	/* 0x00001cfc */ 0x00001cfc,
+	/* 0x00001cfd */ 0x00001cfd,
+	/* 0x00001cfe */ 0x00001cfe,
+	/* 0x00001cff */ 0x00001cff
+};
+
+static uint32_t libfshfs_name_case_folding_mappings_0x00001e00[ 256 ] = {
+	/* 0x00001e00 */ 0x00001e01,
+	/* 0x00001e01 */ 0x00001e01,
+	/* 0x00001e02 */ 0x00001e03,
+	/* 0x00001e03 */ 0x00001e03,
+	/* 0x00001e04 */ 0x00001e05,
+	/* 0x00001e05 */ 0x00001e05,
+	/* 0x00001e06 */ 0x00001e07,
+	/* 0x00001e07 */ 0x00001e07,
+	/* 0x00001e08 */ 0x00001e09,
+	/* 0x00001e09 */ 0x00001e09,
+	/* 0x00001e0a */ 0x00001e0b,
+	/* 0x00001e0b */ 0x00001e0b,
+	/* 0x00001e0c */ 0x00001e0d,
+	/* 0x00001e0d */ 0x00001e0d,
+	/* 0x00001e0e */ 0x00001e0f,
+	/* 0x00001e0f */ 0x00001e0f,
+	/* 0x00001e10 */ 0x00001e11,
+	/* 0x00001e11 */ 0x00001e11,
+	/* 0x00001e12 */ 0x00001e13,
+	/* 0x00001e13 */ 0x00001e13,
+	/* 0x00001e14 */ 0x00001e15,
+	/* 0x00001e15 */ 0x00001e15,
+	/* 0x00001e16 */ 0x00001e17,
+	/* 0x00001e17 */ 0x00001e17,
+	/* 0x00001e18 */ 0x00001e19,
+	/* 0x00001e19 */ 0x00001e19,
+	/* 0x00001e1a */ 0x00001e1b,
+	/* 0x00001e1b */ 0x00001e1b,
+	/* 0x00001e1c */ 0x00001e1d,
+	/* 0x00001e1d */ 0x00001e1d,
+	/* 0x00001e1e */ 0x00001e1f,
+	/* 0x00001e1f */ 0x00001e1f,
+	/* 0x00001e20 */ 0x00001e21,
+	/* 0x00001e21 */ 0x00001e21,
+	/* 0x00001e22 */ 0x00001e23,
+	/* 0x00001e23 */ 0x00001e23,
+	/* 0x00001e24 */ 0x00001e25,
+	/* 0x00001e25 */ 0x00001e25,
+	/* 0x00001e26 */ 0x00001e27,
+	/* 0x00001e27 */ 0x00001e27,
+	/* 0x00001e28 */ 0x00001e29,
+	/* 0x00001e29 */ 0x00001e29,
+	/* 0x00001e2a */ 0x00001e2b,
+	/* 0x00001e2b */ 0x00001e2b,
+	/* 0x00001e2c */ 0x00001e2d,
+	/* 0x00001e2d */ 0x00001e2d,
+	/* 0x00001e2e */ 0x00001e2f,
+	/* 0x00001e2f */ 0x00001e2f,
+	/* 0x00001e30 */ 0x00001e31,
+	/* 0x00001e31 */ 0x00001e31,
+	/* 0x00001e32 */ 0x00001e33,
+	/* 0x00001e33 */ 0x00001e33,
+	/* 0x00001e34 */ 0x00001e35,
+	/* 0x00001e35 */ 0x00001e35,
+	/* 0x00001e36 */ 0x00001e37,
+	/* 0x00001e37 */ 0x00001e37,
+	/* 0x00001e38 */ 0x00001e39,
+	/* 0x00001e39 */ 0x00001e39,
+	/* 0x00001e3a */ 0x00001e3b,
+	/* 0x00001e3b */ 0x00001e3b,
+	/* 0x00001e3c */ 0x00001e3d,
+	/* 0x00001e3d */ 0x00001e3d,
+	/* 0x00001e3e */ 0x00001e3f,
+	/* 0x00001e3f */ 0x00001e3f,
+	/* 0x00001e40 */ 0x00001e41,
+	/* 0x00001e41 */ 0x00001e41,
+	/* 0x00001e42 */ 0x00001e43,
+	/* 0x00001e43 */ 0x00001e43,
+	/* 0x00001e44 */ 0x00001e45,
+	/* 0x00001e45 */ 0x00001e45,
+	/* 0x00001e46 */ 0x00001e47,
+	/* 0x00001e47 */ 0x00001e47,
+	/* 0x00001e48 */ 0x00001e49,
+	/* 0x00001e49 */ 0x00001e49,
+	/* 0x00001e4a */ 0x00001e4b,
+	/* 0x00001e4b */ 0x00001e4b,
+	/* 0x00001e4c */ 0x00001e4d,
+	/* 0x00001e4d */ 0x00001e4d,
+	/* 0x00001e4e */ 0x00001e4f,
+	/* 0x00001e4f */ 0x00001e4f,
+	/* 0x00001e50 */ 0x00001e51,
+	/* 0x00001e51 */ 0x00001e51,
+	/* 0x00001e52 */ 0x00001e53,
+	/* 0x00001e53 */ 0x00001e53,
+	/* 0x00001e54 */ 0x00001e55,
+	/* 0x00001e55 */ 0x00001e55,
+	/* 0x00001e56 */ 0x00001e57,
+	/* 0x00001e57 */ 0x00001e57,
+	/* 0x00001e58 */ 0x00001e59,
+	/* 0x00001e59 */ 0x00001e59,
+	/* 0x00001e5a */ 0x00001e5b,
+	/* 0x00001e5b */ 0x00001e5b,
+	/* 0x00001e5c */ 0x00001e5d,
+	/* 0x00001e5d */ 0x00001e5d,
+	/* 0x00001e5e */ 0x00001e5f,
+	/* 0x00001e5f */ 0x00001e5f,
+	/* 0x00001e60 */ 0x00001e61,
+	/* 0x00001e61 */ 0x00001e61,
+	/* 0x00001e62 */ 0x00001e63,
+	/* 0x00001e63 */ 0x00001e63,
+	/* 0x00001e64 */ 0x00001e65,
+	/* 0x00001e65 */ 0x00001e65,
+	/* 0x00001e66 */ 0x00001e67,
+	/* 0x00001e67 */ 0x00001e67,
+	/* 0x00001e68 */ 0x00001e69,
+	/* 0x00001e69 */ 0x00001e69,
+	/* 0x00001e6a */ 0x00001e6b,
+	/* 0x00001e6b */ 0x00001e6b,
+	/* 0x00001e6c */ 0x00001e6d,
+	/* 0x00001e6d */ 0x00001e6d,
+	/* 0x00001e6e */ 0x00001e6f,
+	/* 0x00001e6f */ 0x00001e6f,
+	/* 0x00001e70 */ 0x00001e71,
+	/* 0x00001e71 */ 0x00001e71,
+	/* 0x00001e72 */ 0x00001e73,
+	/* 0x00001e73 */ 0x00001e73,
+	/* 0x00001e74 */ 0x00001e75,
+	/* 0x00001e75 */ 0x00001e75,
+	/* 0x00001e76 */ 0x00001e77,
+	/* 0x00001e77 */ 0x00001e77,
+	/* 0x00001e78 */ 0x00001e79,
+	/* 0x00001e79 */ 0x00001e79,
+	/* 0x00001e7a */ 0x00001e7b,
+	/* 0x00001e7b */ 0x00001e7b,
+	/* 0x00001e7c */ 0x00001e7d,
+	/* 0x00001e7d */ 0x00001e7d,
+	/* 0x00001e7e */ 0x00001e7f,
+	/* 0x00001e7f */ 0x00001e7f,
+	/* 0x00001e80 */ 0x00001e81,
+	/* 0x00001e81 */ 0x00001e81,
+	/* 0x00001e82 */ 0x00001e83,
+	/* 0x00001e83 */ 0x00001e83,
+	/* 0x00001e84 */ 0x00001e85,
+	/* 0x00001e85 */ 0x00001e85,
+	/* 0x00001e86 */ 0x00001e87,
+	/* 0x00001e87 */ 0x00001e87,
+	/* 0x00001e88 */ 0x00001e89,
+	/* 0x00001e89 */ 0x00001e89,
+	/* 0x00001e8a */ 0x00001e8b,
+	/* 0x00001e8b */ 0x00001e8b,
+	/* 0x00001e8c */ 0x00001e8d,
+	/* 0x00001e8d */ 0x00001e8d,
+	/* 0x00001e8e */ 0x00001e8f,
+	/* 0x00001e8f */ 0x00001e8f,
+	/* 0x00001e90 */ 0x00001e91,
+	/* 0x00001e91 */ 0x00001e91,
+	/* 0x00001e92 */ 0x00001e93,
+	/* 0x00001e93 */ 0x00001e93,
+	/* 0x00001e94 */ 0x00001e95,
+	/* 0x00001e95 */ 0x00001e95,
+	/* 0x00001e96 */ 0x00001e96,
+	/* 0x00001e97 */ 0x00001e97,
+	/* 0x00001e98 */ 0x00001e98,
+	/* 0x00001e99 */ 0x00001e99,
+	/* 0x00001e9a */ 0x00001e9a,
+	/* 0x00001e9b */ 0x00001e61,
+	/* 0x00001e9c */ 0x00001e9c,
+	/* 0x00001e9d */ 0x00001e9d,
+	/* 0x00001e9e */ 0x000000df,
+	/* 0x00001e9f */ 0x00001e9f,
+	/* 0x00001ea0 */ 0x00001ea1,
+	/* 0x00001ea1 */ 0x00001ea1,
+	/* 0x00001ea2 */ 0x00001ea3,
+	/* 0x00001ea3 */ 0x00001ea3,
+	/* 0x00001ea4 */ 0x00001ea5,
+	/* 0x00001ea5 */ 0x00001ea5,
+	/* 0x00001ea6 */ 0x00001ea7,
+	/* 0x00001ea7 */ 0x00001ea7,
+	/* 0x00001ea8 */ 0x00001ea9,
+	/* 0x00001ea9 */ 0x00001ea9,
+	/* 0x00001eaa */ 0x00001eab,
+	/* 0x00001eab */ 0x00001eab,
+	/* 0x00001eac */ 0x00001ead,
+	/* 0x00001ead */ 0x00001ead,
+	/* 0x00001eae */ 0x00001eaf,
+	/* 0x00001eaf */ 0x00001eaf,
+	/* 0x00001eb0 */ 0x00001eb1,
+	/* 0x00001eb1 */ 0x00001eb1,
+	/* 0x00001eb2 */ 0x00001eb3,
+	/* 0x00001eb3 */ 0x00001eb3,
+	/* 0x00001eb4 */ 0x00001eb5,
+	/* 0x00001eb5 */ 0x00001eb5,
+	/* 0x00001eb6 */ 0x00001eb7,
+	/* 0x00001eb7 */ 0x00001eb7,
+	/* 0x00001eb8 */ 0x00001eb9,
+	/* 0x00001eb9 */ 0x00001eb9,
+	/* 0x00001eba */ 0x00001ebb,
+	/* 0x00001ebb */ 0x00001ebb,
+	/* 0x00001ebc */ 0x00001ebd,
+	/* 0x00001ebd */ 0x00001ebd,
+	/* 0x00001ebe */ 0x00001ebf,
+	/* 0x00001ebf */ 0x00001ebf,
+	/* 0x00001ec0 */ 0x00001ec1,
+	/* 0x00001ec1 */ 0x00001ec1,
+	/* 0x00001ec2 */ 0x00001ec3,
+	/* 0x00001ec3 */ 0x00001ec3,
+	/* 0x00001ec4 */ 0x00001ec5,
+	/* 0x00001ec5 */ 0x00001ec5,
+	/* 0x00001ec6 */ 0x00001ec7,
+	/* 0x00001ec7 */ 0x00001ec7,
+	/* 0x00001ec8 */ 0x00001ec9,
+	/* 0x00001ec9 */ 0x00001ec9,
+	/* 0x00001eca */ 0x00001ecb,
+	/* 0x00001ecb */ 0x00001ecb,
+	/* 0x00001ecc */ 0x00001ecd,
+	/* 0x00001ecd */ 0x00001ecd,
+	/* 0x00001ece */ 0x00001ecf,
+	/* 0x00001ecf */ 0x00001ecf,
+	/* 0x00001ed0 */ 0x00001ed1,
+	/* 0x00001ed1 */ 0x00001ed1,
+	/* 0x00001ed2 */ 0x00001ed3,
+	/* 0x00001ed3 */ 0x00001ed3,
+	/* 0x00001ed4 */ 0x00001ed5,
+	/* 0x00001ed5 */ 0x00001ed5,
+	/* 0x00001ed6 */ 0x00001ed7,
+	/* 0x00001ed7 */ 0x00001ed7,
+	/* 0x00001ed8 */ 0x00001ed9,
+	/* 0x00001ed9 */ 0x00001ed9,
+	/* 0x00001eda */ 0x00001edb,
+	/* 0x00001edb */ 0x00001edb,
+	/* 0x00001edc */ 0x00001edd,
+	/* 0x00001edd */ 0x00001edd,
+	/* 0x00001ede */ 0x00001edf,
+	/* 0x00001edf */ 0x00001edf,
+	/* 0x00001ee0 */ 0x00001ee1,
+	/* 0x00001ee1 */ 0x00001ee1,
+	/* 0x00001ee2 */ 0x00001ee3,
+	/* 0x00001ee3 */ 0x00001ee3,
+	/* 0x00001ee4 */ 0x00001ee5,
+	/* 0x00001ee5 */ 0x00001ee5,
+	/* 0x00001ee6 */ 0x00001ee7,
+	/* 0x00001ee7 */ 0x00001ee7,
+	/* 0x00001ee8 */ 0x00001ee9,
+	/* 0x00001ee9 */ 0x00001ee9,
+	/* 0x00001eea */ 0x00001eeb,
+	/* 0x00001eeb */ 0x00001eeb,
+	/* 0x00001eec */ 0x00001eed,
+	/* 0x00001eed */ 0x00001eed,
+	/* 0x00001eee */ 0x00001eef,
+	/* 0x00001eef */ 0x00001eef,
+	/* 0x00001ef0 */ 0x00001ef1,
+	/* 0x00001ef1 */ 0x00001ef1,
+	/* 0x00001ef2 */ 0x00001ef3,
+	/* 0x00001ef3 */ 0x00001ef3,
+	/* 0x00001ef4 */ 0x00001ef5,
+	/* 0x00001ef5 */ 0x00001ef5,
+	/* 0x00001ef6 */ 0x00001ef7,
+	/* 0x00001ef7 */ 0x00001ef7,
+	/* 0x00001ef8 */ 0x00001ef9,
+	/* 0x00001ef9 */ 0x00001ef9,
+	/* 0x00001efa */ 0x00001efb,
+	/* 0x00001efb */ 0x00001efb,
+	/* 0x00001efc */ 0x00001efd,
+	/* 0x00001efd */ 0x00001efd,
+	/* 0x00001efe */ 0x00001eff,
+	/* 0x00001eff */ 0x00001eff
+};
+
+static uint32_t libfshfs_name_case_folding_mappings_0x00001f00[ 256 ] = {
+	/* 0x00001f00 */ 0x00001f00,
+	/* 0x00001f01 */ 0x00001f01,
+	/* 0x00001f02 */ 0x00001f02,
+	/* 0x00001f03 */ 0x00001f03,
+	/* 0x00001f04 */ 0x00001f04,
+	/* 0x00001f05 */ 0x00001f05,
+	/* 0x00001f06 */ 0x00001f06,
+	/* 0x00001f07 */ 0x00001f07,
+	/* 0x00001f08 */ 0x00001f00,
+	/* 0x00001f09 */ 0x00001f01,
+	/* 0x00001f0a */ 0x00001f02,
+	/* 0x00001f0b */ 0x00001f03,
+	/* 0x00001f0c */ 0x00001f04,
+	/* 0x00001f0d */ 0x00001f05,
+	/* 0x00001f0e */ 0x00001f06,
+	/* 0x00001f0f */ 0x00001f07,
+	/* 0x00001f10 */ 0x00001f10,
+	/* 0x00001f11 */ 0x00001f11,
+	/* 0x00001f12 */ 0x00001f12,
+	/* 0x00001f13 */ 0x00001f13,
+	/* 0x00001f14 */ 0x00001f14,
+	/* 0x00001f15 */ 0x00001f15,
+	/* 0x00001f16 */ 0x00001f16,
+	/* 0x00001f17 */ 0x00001f17,
+	/* 0x00001f18 */ 0x00001f10,
+	/* 0x00001f19 */ 0x00001f11,
+	/* 0x00001f1a */ 0x00001f12,
+	/* 0x00001f1b */ 0x00001f13,
+	/* 0x00001f1c */ 0x00001f14,
+	/* 0x00001f1d */ 0x00001f15,
+	/* 0x00001f1e */ 0x00001f1e,
+	/* 0x00001f1f */ 0x00001f1f,
+	/* 0x00001f20 */ 0x00001f20,
+	/* 0x00001f21 */ 0x00001f21,
+	/* 0x00001f22 */ 0x00001f22,
+	/* 0x00001f23 */ 0x00001f23,
+	/* 0x00001f24 */ 0x00001f24,
+	/* 0x00001f25 */ 0x00001f25,
+	/* 0x00001f26 */ 0x00001f26,
+	/* 0x00001f27 */ 0x00001f27,
+	/* 0x00001f28 */ 0x00001f20,
+	/* 0x00001f29 */ 0x00001f21,
+	/* 0x00001f2a */ 0x00001f22,
+	/* 0x00001f2b */ 0x00001f23,
+	/* 0x00001f2c */ 0x00001f24,
+	/* 0x00001f2d */ 0x00001f25,
+	/* 0x00001f2e */ 0x00001f26,
+	/* 0x00001f2f */ 0x00001f27,
+	/* 0x00001f30 */ 0x00001f30,
+	/* 0x00001f31 */ 0x00001f31,
+	/* 0x00001f32 */ 0x00001f32,
+	/* 0x00001f33 */ 0x00001f33,
+	/* 0x00001f34 */ 0x00001f34,
+	/* 0x00001f35 */ 0x00001f35,
+	/* 0x00001f36 */ 0x00001f36,
+	/* 0x00001f37 */ 0x00001f37,
+	/* 0x00001f38 */ 0x00001f30,
+	/* 0x00001f39 */ 0x00001f31,
+	/* 0x00001f3a */ 0x00001f32,
+	/* 0x00001f3b */ 0x00001f33,
+	/* 0x00001f3c */ 0x00001f34,
+	/* 0x00001f3d */ 0x00001f35,
+	/* 0x00001f3e */ 0x00001f36,
+	/* 0x00001f3f */ 0x00001f37,
+	/* 0x00001f40 */ 0x00001f40,
+	/* 0x00001f41 */ 0x00001f41,
+	/* 0x00001f42 */ 0x00001f42,
+	/* 0x00001f43 */ 0x00001f43,
+	/* 0x00001f44 */ 0x00001f44,
+	/* 0x00001f45 */ 0x00001f45,
+	/* 0x00001f46 */ 0x00001f46,
+	/* 0x00001f47 */ 0x00001f47,
+	/* 0x00001f48 */ 0x00001f40,
+	/* 0x00001f49 */ 0x00001f41,
+	/* 0x00001f4a */ 0x00001f42,
+	/* 0x00001f4b */ 0x00001f43,
+	/* 0x00001f4c */ 0x00001f44,
+	/* 0x00001f4d */ 0x00001f45,
+	/* 0x00001f4e */ 0x00001f4e,
+	/* 0x00001f4f */ 0x00001f4f,
+	/* 0x00001f50 */ 0x00001f50,
+	/* 0x00001f51 */ 0x00001f51,
+	/* 0x00001f52 */ 0x00001f52,
+	/* 0x00001f53 */ 0x00001f53,
+	/* 0x00001f54 */ 0x00001f54,
+	/* 0x00001f55 */ 0x00001f55,
+	/* 0x00001f56 */ 0x00001f56,
+	/* 0x00001f57 */ 0x00001f57,
+	/* 0x00001f58 */ 0x00001f58,
+	/* 0x00001f59 */ 0x00001f51,
+	/* 0x00001f5a */ 0x00001f5a,
+	/* 0x00001f5b */ 0x00001f53,
+	/* 0x00001f5c */ 0x00001f5c,
+	/* 0x00001f5d */ 0x00001f55,
+	/* 0x00001f5e */ 0x00001f5e,
+	/* 0x00001f5f */ 0x00001f57,
+	/* 0x00001f60 */ 0x00001f60,
+	/* 0x00001f61 */ 0x00001f61,
+	/* 0x00001f62 */ 0x00001f62,
+	/* 0x00001f63 */ 0x00001f63,
+	/* 0x00001f64 */ 0x00001f64,
+	/* 0x00001f65 */ 0x00001f65,
+	/* 0x00001f66 */ 0x00001f66,
+	/* 0x00001f67 */ 0x00001f67,
+	/* 0x00001f68 */ 0x00001f60,
+	/* 0x00001f69 */ 0x00001f61,
+	/* 0x00001f6a */ 0x00001f62,
+	/* 0x00001f6b */ 0x00001f63,
+	/* 0x00001f6c */ 0x00001f64,
+	/* 0x00001f6d */ 0x00001f65,
+	/* 0x00001f6e */ 0x00001f66,
+	/* 0x00001f6f */ 0x00001f67,
+	/* 0x00001f70 */ 0x00001f70,
+	/* 0x00001f71 */ 0x00001f71,
+	/* 0x00001f72 */ 0x00001f72,
+	/* 0x00001f73 */ 0x00001f73,
+	/* 0x00001f74 */ 0x00001f74,
+	/* 0x00001f75 */ 0x00001f75,
+	/* 0x00001f76 */ 0x00001f76,
+	/* 0x00001f77 */ 0x00001f77,
+	/* 0x00001f78 */ 0x00001f78,
+	/* 0x00001f79 */ 0x00001f79,
+	/* 0x00001f7a */ 0x00001f7a,
+	/* 0x00001f7b */ 0x00001f7b,
+	/* 0x00001f7c */ 0x00001f7c,
+	/* 0x00001f7d */ 0x00001f7d,
+	/* 0x00001f7e */ 0x00001f7e,
+	/* 0x00001f7f */ 0x00001f7f,
+	/* 0x00001f80 */ 0x00001f80,
+	/* 0x00001f81 */ 0x00001f81,
+	/* 0x00001f82 */ 0x00001f82,
+	/* 0x00001f83 */ 0x00001f83,
+	/* 0x00001f84 */ 0x00001f84,
+	/* 0x00001f85 */ 0x00001f85,
+	/* 0x00001f86 */ 0x00001f86,
+	/* 0x00001f87 */ 0x00001f87,
+	/* 0x00001f88 */ 0x00001f80,
+	/* 0x00001f89 */ 0x00001f81,
+	/* 0x00001f8a */ 0x00001f82,
+	/* 0x00001f8b */ 0x00001f83,
+	/* 0x00001f8c */ 0x00001f84,
+	/* 0x00001f8d */ 0x00001f85,
+	/* 0x00001f8e */ 0x00001f86,
+	/* 0x00001f8f */ 0x00001f87,
+	/* 0x00001f90 */ 0x00001f90,
+	/* 0x00001f91 */ 0x00001f91,
+	/* 0x00001f92 */ 0x00001f92,
+	/* 0x00001f93 */ 0x00001f93,
+	/* 0x00001f94 */ 0x00001f94,
+	/* 0x00001f95 */ 0x00001f95,
+	/* 0x00001f96 */ 0x00001f96,
+	/* 0x00001f97 */ 0x00001f97,
+	/* 0x00001f98 */ 0x00001f90,
+	/* 0x00001f99 */ 0x00001f91,
+	/* 0x00001f9a */ 0x00001f92,
+	/* 0x00001f9b */ 0x00001f93,
+	/* 0x00001f9c */ 0x00001f94,
+	/* 0x00001f9d */ 0x00001f95,
+	/* 0x00001f9e */ 0x00001f96,
+	/* 0x00001f9f */ 0x00001f97,
+	/* 0x00001fa0 */ 0x00001fa0,
+	/* 0x00001fa1 */ 0x00001fa1,
+	/* 0x00001fa2 */ 0x00001fa2,
+	/* 0x00001fa3 */ 0x00001fa3,
+	/* 0x00001fa4 */ 0x00001fa4,
+	/* 0x00001fa5 */ 0x00001fa5,
+	/* 0x00001fa6 */ 0x00001fa6,
+	/* 0x00001fa7 */ 0x00001fa7,
+	/* 0x00001fa8 */ 0x00001fa0,
+	/* 0x00001fa9 */ 0x00001fa1,
+	/* 0x00001faa */ 0x00001fa2,
+	/* 0x00001fab */ 0x00001fa3,
+	/* 0x00001fac */ 0x00001fa4,
+	/* 0x00001fad */ 0x00001fa5,
+	/* 0x00001fae */ 0x00001fa6,
+	/* 0x00001faf */ 0x00001fa7,
+	/* 0x00001fb0 */ 0x00001fb0,
+	/* 0x00001fb1 */ 0x00001fb1,
+	/* 0x00001fb2 */ 0x00001fb2,
+	/* 0x00001fb3 */ 0x00001fb3,
+	/* 0x00001fb4 */ 0x00001fb4,
+	/* 0x00001fb5 */ 0x00001fb5,
+	/* 0x00001fb6 */ 0x00001fb6,
+	/* 0x00001fb7 */ 0x00001fb7,
+	/* 0x00001fb8 */ 0x00001fb0,
+	/* 0x00001fb9 */ 0x00001fb1,
+	/* 0x00001fba */ 0x00001f70,
+	/* 0x00001fbb */ 0x00001f71,
+	/* 0x00001fbc */ 0x00001fb3,
+	/* 0x00001fbd */ 0x00001fbd,
+	/* 0x00001fbe */ 0x000003b9,
+	/* 0x00001fbf */ 0x00001fbf,
+	/* 0x00001fc0 */ 0x00001fc0,
+	/* 0x00001fc1 */ 0x00001fc1,
+	/* 0x00001fc2 */ 0x00001fc2,
+	/* 0x00001fc3 */ 0x00001fc3,
+	/* 0x00001fc4 */ 0x00001fc4,
+	/* 0x00001fc5 */ 0x00001fc5,
+	/* 0x00001fc6 */ 0x00001fc6,
+	/* 0x00001fc7 */ 0x00001fc7,
+	/* 0x00001fc8 */ 0x00001f72,
+	/* 0x00001fc9 */ 0x00001f73,
+	/* 0x00001fca */ 0x00001f74,
+	/* 0x00001fcb */ 0x00001f75,
+	/* 0x00001fcc */ 0x00001fc3,
+	/* 0x00001fcd */ 0x00001fcd,
+	/* 0x00001fce */ 0x00001fce,
+	/* 0x00001fcf */ 0x00001fcf,
+	/* 0x00001fd0 */ 0x00001fd0,
+	/* 0x00001fd1 */ 0x00001fd1,
+	/* 0x00001fd2 */ 0x00001fd2,
+	/* 0x00001fd3 */ 0x00001fd3,
+	/* 0x00001fd4 */ 0x00001fd4,
+	/* 0x00001fd5 */ 0x00001fd5,
+	/* 0x00001fd6 */ 0x00001fd6,
+	/* 0x00001fd7 */ 0x00001fd7,
+	/* 0x00001fd8 */ 0x00001fd0,
+	/* 0x00001fd9 */ 0x00001fd1,
+	/* 0x00001fda */ 0x00001f76,
+	/* 0x00001fdb */ 0x00001f77,
+	/* 0x00001fdc */ 0x00001fdc,
+	/* 0x00001fdd */ 0x00001fdd,
+	/* 0x00001fde */ 0x00001fde,
+	/* 0x00001fdf */ 0x00001fdf,
+	/* 0x00001fe0 */ 0x00001fe0,
+	/* 0x00001fe1 */ 0x00001fe1,
+	/* 0x00001fe2 */ 0x00001fe2,
+	/* 0x00001fe3 */ 0x00001fe3,
+	/* 0x00001fe4 */ 0x00001fe4,
+	/* 0x00001fe5 */ 0x00001fe5,
+	/* 0x00001fe6 */ 0x00001fe6,
+	/* 0x00001fe7 */ 0x00001fe7,
+	/* 0x00001fe8 */ 0x00001fe0,
+	/* 0x00001fe9 */ 0x00001fe1,
+	/* 0x00001fea */ 0x00001f7a,
+	/* 0x00001feb */ 0x00001f7b,
+	/* 0x00001fec */ 0x00001fe5,
+	/* 0x00001fed */ 0x00001fed,
+	/* 0x00001fee */ 0x00001fee,
+	/* 0x00001fef */ 0x00001fef,
+	/* 0x00001ff0 */ 0x00001ff0,
+	/* 0x00001ff1 */ 0x00001ff1,
+	/* 0x00001ff2 */ 0x00001ff2,
+	/* 0x00001ff3 */ 0x00001ff3,
+	/* 0x00001ff4 */ 0x00001ff4,
+	/* 0x00001ff5 */ 0x00001ff5,
+	/* 0x00001ff6 */ 0x00001ff6,
+	/* 0x00001ff7 */ 0x00001ff7,
+	/* 0x00001ff8 */ 0x00001f78,
+	/* 0x00001ff9 */ 0x00001f79,
+	/* 0x00001ffa */ 0x00001f7c,
+	/* 0x00001ffb */ 0x00001f7d,
+	/* 0x00001ffc */ 0x00001ff3,
+	/* 0x00001ffd */ 0x00001ffd,
+	/* 0x00001ffe */ 0x00001ffe,
+	/* 0x00001fff */ 0x00001fff
+};
+
+static uint32_t libfshfs_name_case_folding_mappings_0x00002100[ 256 ] = {
+	/* 0x00002100 */ 0x00002100,
+	/* 0x00002101 */ 0x00002101,
+	/* 0x00002102 */ 0x00002102,
+	/* 0x00002103 */ 0x00002103,
+	/* 0x00002104 */ 0x00002104,
+	/* 0x00002105 */ 0x00002105,
+	/* 0x00002106 */ 0x00002106,
+	/* 0x00002107 */ 0x00002107,
+	/* 0x00002108 */ 0x00002108,
+	/* 0x00002109 */ 0x00002109,
+	/* 0x0000210a */ 0x0000210a,
+	/* 0x0000210b */ 0x0000210b,
+	/* 0x0000210c */ 0x0000210c,
+	/* 0x0000210d */ 0x0000210d,
+	/* 0x0000210e */ 0x0000210e,
+	/* 0x0000210f */ 0x0000210f,
+	/* 0x00002110 */ 0x00002110,
+	/* 0x00002111 */ 0x00002111,
+	/* 0x00002112 */ 0x00002112,
+	/* 0x00002113 */ 0x00002113,
+	/* 0x00002114 */ 0x00002114,
+	/* 0x00002115 */ 0x00002115,
+	/* 0x00002116 */ 0x00002116,
+	/* 0x00002117 */ 0x00002117,
+	/* 0x00002118 */ 0x00002118,
+	/* 0x00002119 */ 0x00002119,
+	/* 0x0000211a */ 0x0000211a,
+	/* 0x0000211b */ 0x0000211b,
+	/* 0x0000211c */ 0x0000211c,
+	/* 0x0000211d */ 0x0000211d,
+	/* 0x0000211e */ 0x0000211e,
+	/* 0x0000211f */ 0x0000211f,
+	/* 0x00002120 */ 0x00002120,
+	/* 0x00002121 */ 0x00002121,
+	/* 0x00002122 */ 0x00002122,
+	/* 0x00002123 */ 0x00002123,
+	/* 0x00002124 */ 0x00002124,
+	/* 0x00002125 */ 0x00002125,
+	/* 0x00002126 */ 0x000003c9,
+	/* 0x00002127 */ 0x00002127,
+	/* 0x00002128 */ 0x00002128,
+	/* 0x00002129 */ 0x00002129,
+	/* 0x0000212a */ 0x0000006b,
+	/* 0x0000212b */ 0x000000e5,
+	/* 0x0000212c */ 0x0000212c,
+	/* 0x0000212d */ 0x0000212d,
+	/* 0x0000212e */ 0x0000212e,
+	/* 0x0000212f */ 0x0000212f,
+	/* 0x00002130 */ 0x00002130,
+	/* 0x00002131 */ 0x00002131,
+	/* 0x00002132 */ 0x0000214e,
+	/* 0x00002133 */ 0x00002133,
+	/* 0x00002134 */ 0x00002134,
+	/* 0x00002135 */ 0x00002135,
+	/* 0x00002136 */ 0x00002136,
+	/* 0x00002137 */ 0x00002137,
+	/* 0x00002138 */ 0x00002138,
+	/* 0x00002139 */ 0x00002139,
+	/* 0x0000213a */ 0x0000213a,
+	/* 0x0000213b */ 0x0000213b,
+	/* 0x0000213c */ 0x0000213c,
+	/* 0x0000213d */ 0x0000213d,
+	/* 0x0000213e */ 0x0000213e,
+	/* 0x0000213f */ 0x0000213f,
+	/* 0x00002140 */ 0x00002140,
+	/* 0x00002141 */ 0x00002141,
+	/* 0x00002142 */ 0x00002142,
+	/* 0x00002143 */ 0x00002143,
+	/* 0x00002144 */ 0x00002144,
+	/* 0x00002145 */ 0x00002145,
+	/* 0x00002146 */ 0x00002146,
+	/* 0x00002147 */ 0x00002147,
+	/* 0x00002148 */ 0x00002148,
+	/* 0x00002149 */ 0x00002149,
+	/* 0x0000214a */ 0x0000214a,
+	/* 0x0000214b */ 0x0000214b,
+	/* 0x0000214c */ 0x0000214c,
+	/* 0x0000214d */ 0x0000214d,
+	/* 0x0000214e */ 0x0000214e,
+	/* 0x0000214f */ 0x0000214f,
+	/* 0x00002150 */ 0x00002150,
+	/* 0x00002151 */ 0x00002151,
+	/* 0x00002152 */ 0x00002152,
+	/* 0x00002153 */ 0x00002153,
+	/* 0x00002154 */ 0x00002154,
+	/* 0x00002155 */ 0x00002155,
+	/* 0x00002156 */ 0x00002156,
+	/* 0x00002157 */ 0x00002157,
+	/* 0x00002158 */ 0x00002158,
+	/* 0x00002159 */ 0x00002159,
+	/* 0x0000215a */ 0x0000215a,
+	/* 0x0000215b */ 0x0000215b,
+	/* 0x0000215c */ 0x0000215c,
+	/* 0x0000215d */ 0x0000215d,
+	/* 0x0000215e */ 0x0000215e,
+	/* 0x0000215f */ 0x0000215f,
+	/* 0x00002160 */ 0x00002170,
+	/* 0x00002161 */ 0x00002171,
+	/* 0x00002162 */ 0x00002172,
+	/* 0x00002163 */ 0x00002173,
+	/* 0x00002164 */ 0x00002174,
+	/* 0x00002165 */ 0x00002175,
+	/* 0x00002166 */ 0x00002176,
+	/* 0x00002167 */ 0x00002177,
+	/* 0x00002168 */ 0x00002178,
+	/* 0x00002169 */ 0x00002179,
+	/* 0x0000216a */ 0x0000217a,
+	/* 0x0000216b */ 0x0000217b,
+	/* 0x0000216c */ 0x0000217c,
+	/* 0x0000216d */ 0x0000217d,
+	/* 0x0000216e */ 0x0000217e,
+	/* 0x0000216f */ 0x0000217f,
+	/* 0x00002170 */ 0x00002170,
+	/* 0x00002171 */ 0x00002171,
+	/* 0x00002172 */ 0x00002172,
+	/* 0x00002173 */ 0x00002173,
+	/* 0x00002174 */ 0x00002174,
+	/* 0x00002175 */ 0x00002175,
+	/* 0x00002176 */ 0x00002176,
+	/* 0x00002177 */ 0x00002177,
+	/* 0x00002178 */ 0x00002178,
+	/* 0x00002179 */ 0x00002179,
+	/* 0x0000217a */ 0x0000217a,
+	/* 0x0000217b */ 0x0000217b,
+	/* 0x0000217c */ 0x0000217c,
+	/* 0x0000217d */ 0x0000217d,
+	/* 0x0000217e */ 0x0000217e,
+	/* 0x0000217f */ 0x0000217f,
+	/* 0x00002180 */ 0x00002180,
+	/* 0x00002181 */ 0x00002181,
+	/* 0x00002182 */ 0x00002182,
+	/* 0x00002183 */ 0x00002184,
+	/* 0x00002184 */ 0x00002184,
+	/* 0x00002185 */ 0x00002185,
+	/* 0x00002186 */ 0x00002186,
+	/* 0x00002187 */ 0x00002187,
+	/* 0x00002188 */ 0x00002188,
+	/* 0x00002189 */ 0x00002189,
+	/* 0x0000218a */ 0x0000218a,
+	/* 0x0000218b */ 0x0000218b,
+	/* 0x0000218c */ 0x0000218c,
+	/* 0x0000218d */ 0x0000218d,
+	/* 0x0000218e */ 0x0000218e,
+	/* 0x0000218f */ 0x0000218f,
+	/* 0x00002190 */ 0x00002190,
+	/* 0x00002191 */ 0x00002191,
+	/* 0x00002192 */ 0x00002192,
+	/* 0x00002193 */ 0x00002193,
+	/* 0x00002194 */ 0x00002194,
+	/* 0x00002195 */ 0x00002195,
+	/* 0x00002196 */ 0x00002196,
+	/* 0x00002197 */ 0x00002197,
+	/* 0x00002198 */ 0x00002198,
+	/* 0x00002199 */ 0x00002199,
+	/* 0x0000219a */ 0x0000219a,
+	/* 0x0000219b */ 0x0000219b,
+	/* 0x0000219c */ 0x0000219c,
+	/* 0x0000219d */ 0x0000219d,
+	/* 0x0000219e */ 0x0000219e,
+	/* 0x0000219f */ 0x0000219f,
+	/* 0x000021a0 */ 0x000021a0,
+	/* 0x000021a1 */ 0x000021a1,
+	/* 0x000021a2 */ 0x000021a2,
+	/* 0x000021a3 */ 0x000021a3,
+	/* 0x000021a4 */ 0x000021a4,
+	/* 0x000021a5 */ 0x000021a5,
+	/* 0x000021a6 */ 0x000021a6,
+	/* 0x000021a7 */ 0x000021a7,
+	/* 0x000021a8 */ 0x000021a8,
+	/* 0x000021a9 */ 0x000021a9,
+	/* 0x000021aa */ 0x000021aa,
+	/* 0x000021ab */ 0x000021ab,
+	/* 0x000021ac */ 0x000021ac,
+	/* 0x000021ad */ 0x000021ad,
+	/* 0x000021ae */ 0x000021ae,
+	/* 0x000021af */ 0x000021af,
+	/* 0x000021b0 */ 0x000021b0,
+	/* 0x000021b1 */ 0x000021b1,
+	/* 0x000021b2 */ 0x000021b2,
+	/* 0x000021b3 */ 0x000021b3,
+	/* 0x000021b4 */ 0x000021b4,
+	/* 0x000021b5 */ 0x000021b5,
+	/* 0x000021b6 */ 0x000021b6,
+	/* 0x000021b7 */ 0x000021b7,
+	/* 0x000021b8 */ 0x000021b8,
+	/* 0x000021b9 */ 0x000021b9,
+	/* 0x000021ba */ 0x000021ba,
+	/* 0x000021bb */ 0x000021bb,
+	/* 0x000021bc */ 0x000021bc,
+	/* 0x000021bd */ 0x000021bd,
+	/* 0x000021be */ 0x000021be,
+	/* 0x000021bf */ 0x000021bf,
+	/* 0x000021c0 */ 0x000021c0,
+	/* 0x000021c1 */ 0x000021c1,
+	/* 0x000021c2 */ 0x000021c2,
+	/* 0x000021c3 */ 0x000021c3,
+	/* 0x000021c4 */ 0x000021c4,
+	/* 0x000021c5 */ 0x000021c5,
+	/* 0x000021c6 */ 0x000021c6,
+	/* 0x000021c7 */ 0x000021c7,
+	/* 0x000021c8 */ 0x000021c8,
+	/* 0x000021c9 */ 0x000021c9,
+	/* 0x000021ca */ 0x000021ca,
+	/* 0x000021cb */ 0x000021cb,
+	/* 0x000021cc */ 0x000021cc,
+	/* 0x000021cd */ 0x000021cd,
+	/* 0x000021ce */ 0x000021ce,
+	/* 0x000021cf */ 0x000021cf,
+	/* 0x000021d0 */ 0x000021d0,
+	/* 0x000021d1 */ 0x000021d1,
+	/* 0x000021d2 */ 0x000021d2,
+	/* 0x000021d3 */ 0x000021d3,
+	/* 0x000021d4 */ 0x000021d4,
+	/* 0x000021d5 */ 0x000021d5,
+	/* 0x000021d6 */ 0x000021d6,
+	/* 0x000021d7 */ 0x000021d7,
+	/* 0x000021d8 */ 0x000021d8,
+	/* 0x000021d9 */ 0x000021d9,
+	/* 0x000021da */ 0x000021da,
+	/* 0x000021db */ 0x000021db,
+	/* 0x000021dc */ 0x000021dc,
+	/* 0x000021dd */ 0x000021dd,
+	/* 0x000021de */ 0x000021de,
+	/* 0x000021df */ 0x000021df,
+	/* 0x000021e0 */ 0x000021e0,
+	/* 0x000021e1 */ 0x000021e1,
+	/* 0x000021e2 */ 0x000021e2,
+	/* 0x000021e3 */ 0x000021e3,
+	/* 0x000021e4 */ 0x000021e4,
+	/* 0x000021e5 */ 0x000021e5,
+	/* 0x000021e6 */ 0x000021e6,
+	/* 0x000021e7 */ 0x000021e7,
+	/* 0x000021e8 */ 0x000021e8,
+	/* 0x000021e9 */ 0x000021e9,
+	/* 0x000021ea */ 0x000021ea,
+	/* 0x000021eb */ 0x000021eb,
+	/* 0x000021ec */ 0x000021ec,
+	/* 0x000021ed */ 0x000021ed,
+	/* 0x000021ee */ 0x000021ee,
+	/* 0x000021ef */ 0x000021ef,
+	/* 0x000021f0 */ 0x000021f0,
+	/* 0x000021f1 */ 0x000021f1,
+	/* 0x000021f2 */ 0x000021f2,
+	/* 0x000021f3 */ 0x000021f3,
+	/* 0x000021f4 */ 0x000021f4,
+	/* 0x000021f5 */ 0x000021f5,
+	/* 0x000021f6 */ 0x000021f6,
+	/* 0x000021f7 */ 0x000021f7,
+	/* 0x000021f8 */ 0x000021f8,
+	/* 0x000021f9 */ 0x000021f9,
+	/* 0x000021fa */ 0x000021fa,
+	/* 0x000021fb */ 0x000021fb,
+	/* 0x000021fc */ 0x000021fc,
+	/* 0x000021fd */ 0x000021fd,
+	/* 0x000021fe */ 0x000021fe,
+	/* 0x000021ff */ 0x000021ff
+};
+
+static uint32_t libfshfs_name_case_folding_mappings_0x00002400[ 256 ] = {
+	/* 0x00002400 */ 0x00002400,
+	/* 0x00002401 */ 0x00002401,
+	/* 0x00002402 */ 0x00002402,
+	/* 0x00002403 */ 0x00002403,
+	/* 0x00002404 */ 0x00002404,
+	/* 0x00002405 */ 0x00002405,
+	/* 0x00002406 */ 0x00002406,
+	/* 0x00002407 */ 0x00002407,
+	/* 0x00002408 */ 0x00002408,
+	/* 0x00002409 */ 0x00002409,
+	/* 0x0000240a */ 0x0000240a,
+	/* 0x0000240b */ 0x0000240b,
+	/* 0x0000240c */ 0x0000240c,
+	/* 0x0000240d */ 0x0000240d,
+	/* 0x0000240e */ 0x0000240e,
+	/* 0x0000240f */ 0x0000240f,
+	/* 0x00002410 */ 0x00002410,
+	/* 0x00002411 */ 0x00002411,
+	/* 0x00002412 */ 0x00002412,
+	/* 0x00002413 */ 0x00002413,
+	/* 0x00002414 */ 0x00002414,
+	/* 0x00002415 */ 0x00002415,
+	/* 0x00002416 */ 0x00002416,
+	/* 0x00002417 */ 0x00002417,
+	/* 0x00002418 */ 0x00002418,
+	/* 0x00002419 */ 0x00002419,
+	/* 0x0000241a */ 0x0000241a,
+	/* 0x0000241b */ 0x0000241b,
+	/* 0x0000241c */ 0x0000241c,
+	/* 0x0000241d */ 0x0000241d,
+	/* 0x0000241e */ 0x0000241e,
+	/* 0x0000241f */ 0x0000241f,
+	/* 0x00002420 */ 0x00002420,
+	/* 0x00002421 */ 0x00002421,
+	/* 0x00002422 */ 0x00002422,
+	/* 0x00002423 */ 0x00002423,
+	/* 0x00002424 */ 0x00002424,
+	/* 0x00002425 */ 0x00002425,
+	/* 0x00002426 */ 0x00002426,
+	/* 0x00002427 */ 0x00002427,
+	/* 0x00002428 */ 0x00002428,
+	/* 0x00002429 */ 0x00002429,
+	/* 0x0000242a */ 0x0000242a,
+	/* 0x0000242b */ 0x0000242b,
+	/* 0x0000242c */ 0x0000242c,
+	/* 0x0000242d */ 0x0000242d,
+	/* 0x0000242e */ 0x0000242e,
+	/* 0x0000242f */ 0x0000242f,
+	/* 0x00002430 */ 0x00002430,
+	/* 0x00002431 */ 0x00002431,
+	/* 0x00002432 */ 0x00002432,
+	/* 0x00002433 */ 0x00002433,
+	/* 0x00002434 */ 0x00002434,
+	/* 0x00002435 */ 0x00002435,
+	/* 0x00002436 */ 0x00002436,
+	/* 0x00002437 */ 0x00002437,
+	/* 0x00002438 */ 0x00002438,
+	/* 0x00002439 */ 0x00002439,
+	/* 0x0000243a */ 0x0000243a,
+	/* 0x0000243b */ 0x0000243b,
+	/* 0x0000243c */ 0x0000243c,
+	/* 0x0000243d */ 0x0000243d,
+	/* 0x0000243e */ 0x0000243e,
+	/* 0x0000243f */ 0x0000243f,
+	/* 0x00002440 */ 0x00002440,
+	/* 0x00002441 */ 0x00002441,
+	/* 0x00002442 */ 0x00002442,
+	/* 0x00002443 */ 0x00002443,
+	/* 0x00002444 */ 0x00002444,
+	/* 0x00002445 */ 0x00002445,
+	/* 0x00002446 */ 0x00002446,
+	/* 0x00002447 */ 0x00002447,
+	/* 0x00002448 */ 0x00002448,
+	/* 0x00002449 */ 0x00002449,
+	/* 0x0000244a */ 0x0000244a,
+	/* 0x0000244b */ 0x0000244b,
+	/* 0x0000244c */ 0x0000244c,
+	/* 0x0000244d */ 0x0000244d,
+	/* 0x0000244e */ 0x0000244e,
+	/* 0x0000244f */ 0x0000244f,
+	/* 0x00002450 */ 0x00002450,
+	/* 0x00002451 */ 0x00002451,
+	/* 0x00002452 */ 0x00002452,
+	/* 0x00002453 */ 0x00002453,
+	/* 0x00002454 */ 0x00002454,
+	/* 0x00002455 */ 0x00002455,
+	/* 0x00002456 */ 0x00002456,
+	/* 0x00002457 */ 0x00002457,
+	/* 0x00002458 */ 0x00002458,
+	/* 0x00002459 */ 0x00002459,
+	/* 0x0000245a */ 0x0000245a,
+	/* 0x0000245b */ 0x0000245b,
+	/* 0x0000245c */ 0x0000245c,
+	/* 0x0000245d */ 0x0000245d,
+	/* 0x0000245e */ 0x0000245e,
+	/* 0x0000245f */ 0x0000245f,
+	/* 0x00002460 */ 0x00002460,
+	/* 0x00002461 */ 0x00002461,
+	/* 0x00002462 */ 0x00002462,
+	/* 0x00002463 */ 0x00002463,
+	/* 0x00002464 */ 0x00002464,
+	/* 0x00002465 */ 0x00002465,
+	/* 0x00002466 */ 0x00002466,
+	/* 0x00002467 */ 0x00002467,
+	/* 0x00002468 */ 0x00002468,
+	/* 0x00002469 */ 0x00002469,
+	/* 0x0000246a */ 0x0000246a,
+	/* 0x0000246b */ 0x0000246b,
+	/* 0x0000246c */ 0x0000246c,
+	/* 0x0000246d */ 0x0000246d,
+	/* 0x0000246e */ 0x0000246e,
+	/* 0x0000246f */ 0x0000246f,
+	/* 0x00002470 */ 0x00002470,
+	/* 0x00002471 */ 0x00002471,
+	/* 0x00002472 */ 0x00002472,
+	/* 0x00002473 */ 0x00002473,
+	/* 0x00002474 */ 0x00002474,
+	/* 0x00002475 */ 0x00002475,
+	/* 0x00002476 */ 0x00002476,
+	/* 0x00002477 */ 0x00002477,
+	/* 0x00002478 */ 0x00002478,
+	/* 0x00002479 */ 0x00002479,
+	/* 0x0000247a */ 0x0000247a,
+	/* 0x0000247b */ 0x0000247b,
+	/* 0x0000247c */ 0x0000247c,
+	/* 0x0000247d */ 0x0000247d,
+	/* 0x0000247e */ 0x0000247e,
+	/* 0x0000247f */ 0x0000247f,
+	/* 0x00002480 */ 0x00002480,
+	/* 0x00002481 */ 0x00002481,
+	/* 0x00002482 */ 0x00002482,
+	/* 0x00002483 */ 0x00002483,
+	/* 0x00002484 */ 0x00002484,
+	/* 0x00002485 */ 0x00002485,
+	/* 0x00002486 */ 0x00002486,
+	/* 0x00002487 */ 0x00002487,
+	/* 0x00002488 */ 0x00002488,
+	/* 0x00002489 */ 0x00002489,
+	/* 0x0000248a */ 0x0000248a,
+	/* 0x0000248b */ 0x0000248b,
+	/* 0x0000248c */ 0x0000248c,
+	/* 0x0000248d */ 0x0000248d,
+	/* 0x0000248e */ 0x0000248e,
+	/* 0x0000248f */ 0x0000248f,
+	/* 0x00002490 */ 0x00002490,
+	/* 0x00002491 */ 0x00002491,
+	/* 0x00002492 */ 0x00002492,
+	/* 0x00002493 */ 0x00002493,
+	/* 0x00002494 */ 0x00002494,
+	/* 0x00002495 */ 0x00002495,
+	/* 0x00002496 */ 0x00002496,
+	/* 0x00002497 */ 0x00002497,
+	/* 0x00002498 */ 0x00002498,
+	/* 0x00002499 */ 0x00002499,
+	/* 0x0000249a */ 0x0000249a,
+	/* 0x0000249b */ 0x0000249b,
+	/* 0x0000249c */ 0x0000249c,
+	/* 0x0000249d */ 0x0000249d,
+	/* 0x0000249e */ 0x0000249e,
+	/* 0x0000249f */ 0x0000249f,
+	/* 0x000024a0 */ 0x000024a0,
+	/* 0x000024a1 */ 0x000024a1,
+	/* 0x000024a2 */ 0x000024a2,
+	/* 0x000024a3 */ 0x000024a3,
+	/* 0x000024a4 */ 0x000024a4,
+	/* 0x000024a5 */ 0x000024a5,
+	/* 0x000024a6 */ 0x000024a6,
+	/* 0x000024a7 */ 0x000024a7,
+	/* 0x000024a8 */ 0x000024a8,
+	/* 0x000024a9 */ 0x000024a9,
+	/* 0x000024aa */ 0x000024aa,
+	/* 0x000024ab */ 0x000024ab,
+	/* 0x000024ac */ 0x000024ac,
+	/* 0x000024ad */ 0x000024ad,
+	/* 0x000024ae */ 0x000024ae,
+	/* 0x000024af */ 0x000024af,
+	/* 0x000024b0 */ 0x000024b0,
+	/* 0x000024b1 */ 0x000024b1,
+	/* 0x000024b2 */ 0x000024b2,
+	/* 0x000024b3 */ 0x000024b3,
+	/* 0x000024b4 */ 0x000024b4,
+	/* 0x000024b5 */ 0x000024b5,
+	/* 0x000024b6 */ 0x000024d0,
+	/* 0x000024b7 */ 0x000024d1,
+	/* 0x000024b8 */ 0x000024d2,
+	/* 0x000024b9 */ 0x000024d3,
+	/* 0x000024ba */ 0x000024d4,
+	/* 0x000024bb */ 0x000024d5,
+	/* 0x000024bc */ 0x000024d6,
+	/* 0x000024bd */ 0x000024d7,
+	/* 0x000024be */ 0x000024d8,
+	/* 0x000024bf */ 0x000024d9,
+	/* 0x000024c0 */ 0x000024da,
+	/* 0x000024c1 */ 0x000024db,
+	/* 0x000024c2 */ 0x000024dc,
+	/* 0x000024c3 */ 0x000024dd,
+	/* 0x000024c4 */ 0x000024de,
+	/* 0x000024c5 */ 0x000024df,
+	/* 0x000024c6 */ 0x000024e0,
+	/* 0x000024c7 */ 0x000024e1,
+	/* 0x000024c8 */ 0x000024e2,
+	/* 0x000024c9 */ 0x000024e3,
+	/* 0x000024ca */ 0x000024e4,
+	/* 0x000024cb */ 0x000024e5,
+	/* 0x000024cc */ 0x000024e6,
+	/* 0x000024cd */ 0x000024e7,
+	/* 0x000024ce */ 0x000024e8,
+	/* 0x000024cf */ 0x000024e9,
+	/* 0x000024d0 */ 0x000024d0,
+	/* 0x000024d1 */ 0x000024d1,
+	/* 0x000024d2 */ 0x000024d2,
+	/* 0x000024d3 */ 0x000024d3,
+	/* 0x000024d4 */ 0x000024d4,
+	/* 0x000024d5 */ 0x000024d5,
+	/* 0x000024d6 */ 0x000024d6,
+	/* 0x000024d7 */ 0x000024d7,
+	/* 0x000024d8 */ 0x000024d8,
+	/* 0x000024d9 */ 0x000024d9,
+	/* 0x000024da */ 0x000024da,
+	/* 0x000024db */ 0x000024db,
+	/* 0x000024dc */ 0x000024dc,
+	/* 0x000024dd */ 0x000024dd,
+	/* 0x000024de */ 0x000024de,
+	/* 0x000024df */ 0x000024df,
+	/* 0x000024e0 */ 0x000024e0,
+	/* 0x000024e1 */ 0x000024e1,
+	/* 0x000024e2 */ 0x000024e2,
+	/* 0x000024e3 */ 0x000024e3,
+	/* 0x000024e4 */ 0x000024e4,
+	/* 0x000024e5 */ 0x000024e5,
+	/* 0x000024e6 */ 0x000024e6,
+	/* 0x000024e7 */ 0x000024e7,
+	/* 0x000024e8 */ 0x000024e8,
+	/* 0x000024e9 */ 0x000024e9,
+	/* 0x000024ea */ 0x000024ea,
+	/* 0x000024eb */ 0x000024eb,
+	/* 0x000024ec */ 0x000024ec,
+	/* 0x000024ed */ 0x000024ed,
+	/* 0x000024ee */ 0x000024ee,
+	/* 0x000024ef */ 0x000024ef,
+	/* 0x000024f0 */ 0x000024f0,
+	/* 0x000024f1 */ 0x000024f1,
+	/* 0x000024f2 */ 0x000024f2,
+	/* 0x000024f3 */ 0x000024f3,
+	/* 0x000024f4 */ 0x000024f4,
+	/* 0x000024f5 */ 0x000024f5,
+	/* 0x000024f6 */ 0x000024f6,
+	/* 0x000024f7 */ 0x000024f7,
+	/* 0x000024f8 */ 0x000024f8,
+	/* 0x000024f9 */ 0x000024f9,
+	/* 0x000024fa */ 0x000024fa,
+	/* 0x000024fb */ 0x000024fb,
+	/* 0x000024fc */ 0x000024fc,
+	/* 0x000024fd */ 0x000024fd,
+	/* 0x000024fe */ 0x000024fe,
+	/* 0x000024ff */ 0x000024ff
+};
+
+static uint32_t libfshfs_name_case_folding_mappings_0x00002c00[ 256 ] = {
+	/* 0x00002c00 */ 0x00002c30,
+	/* 0x00002c01 */ 0x00002c31,
+	/* 0x00002c02 */ 0x00002c32,
+	/* 0x00002c03 */ 0x00002c33,
+	/* 0x00002c04 */ 0x00002c34,
+	/* 0x00002c05 */ 0x00002c35,
+	/* 0x00002c06 */ 0x00002c36,
+	/* 0x00002c07 */ 0x00002c37,
+	/* 0x00002c08 */ 0x00002c38,
+	/* 0x00002c09 */ 0x00002c39,
+	/* 0x00002c0a */ 0x00002c3a,
+	/* 0x00002c0b */ 0x00002c3b,
+	/* 0x00002c0c */ 0x00002c3c,
+	/* 0x00002c0d */ 0x00002c3d,
+	/* 0x00002c0e */ 0x00002c3e,
+	/* 0x00002c0f */ 0x00002c3f,
+	/* 0x00002c10 */ 0x00002c40,
+	/* 0x00002c11 */ 0x00002c41,
+	/* 0x00002c12 */ 0x00002c42,
+	/* 0x00002c13 */ 0x00002c43,
+	/* 0x00002c14 */ 0x00002c44,
+	/* 0x00002c15 */ 0x00002c45,
+	/* 0x00002c16 */ 0x00002c46,
+	/* 0x00002c17 */ 0x00002c47,
+	/* 0x00002c18 */ 0x00002c48,
+	/* 0x00002c19 */ 0x00002c49,
+	/* 0x00002c1a */ 0x00002c4a,
+	/* 0x00002c1b */ 0x00002c4b,
+	/* 0x00002c1c */ 0x00002c4c,
+	/* 0x00002c1d */ 0x00002c4d,
+	/* 0x00002c1e */ 0x00002c4e,
+	/* 0x00002c1f */ 0x00002c4f,
+	/* 0x00002c20 */ 0x00002c50,
+	/* 0x00002c21 */ 0x00002c51,
+	/* 0x00002c22 */ 0x00002c52,
+	/* 0x00002c23 */ 0x00002c53,
+	/* 0x00002c24 */ 0x00002c54,
+	/* 0x00002c25 */ 0x00002c55,
+	/* 0x00002c26 */ 0x00002c56,
+	/* 0x00002c27 */ 0x00002c57,
+	/* 0x00002c28 */ 0x00002c58,
+	/* 0x00002c29 */ 0x00002c59,
+	/* 0x00002c2a */ 0x00002c5a,
+	/* 0x00002c2b */ 0x00002c5b,
+	/* 0x00002c2c */ 0x00002c5c,
+	/* 0x00002c2d */ 0x00002c5d,
+	/* 0x00002c2e */ 0x00002c5e,
+	/* 0x00002c2f */ 0x00002c2f,
+	/* 0x00002c30 */ 0x00002c30,
+	/* 0x00002c31 */ 0x00002c31,
+	/* 0x00002c32 */ 0x00002c32,
+	/* 0x00002c33 */ 0x00002c33,
+	/* 0x00002c34 */ 0x00002c34,
+	/* 0x00002c35 */ 0x00002c35,
+	/* 0x00002c36 */ 0x00002c36,
+	/* 0x00002c37 */ 0x00002c37,
+	/* 0x00002c38 */ 0x00002c38,
+	/* 0x00002c39 */ 0x00002c39,
+	/* 0x00002c3a */ 0x00002c3a,
+	/* 0x00002c3b */ 0x00002c3b,
+	/* 0x00002c3c */ 0x00002c3c,
+	/* 0x00002c3d */ 0x00002c3d,
+	/* 0x00002c3e */ 0x00002c3e,
+	/* 0x00002c3f */ 0x00002c3f,
+	/* 0x00002c40 */ 0x00002c40,
+	/* 0x00002c41 */ 0x00002c41,
+	/* 0x00002c42 */ 0x00002c42,
+	/* 0x00002c43 */ 0x00002c43,
+	/* 0x00002c44 */ 0x00002c44,
+	/* 0x00002c45 */ 0x00002c45,
+	/* 0x00002c46 */ 0x00002c46,
+	/* 0x00002c47 */ 0x00002c47,
+	/* 0x00002c48 */ 0x00002c48,
+	/* 0x00002c49 */ 0x00002c49,
+	/* 0x00002c4a */ 0x00002c4a,
+	/* 0x00002c4b */ 0x00002c4b,
+	/* 0x00002c4c */ 0x00002c4c,
+	/* 0x00002c4d */ 0x00002c4d,
+	/* 0x00002c4e */ 0x00002c4e,
+	/* 0x00002c4f */ 0x00002c4f,
+	/* 0x00002c50 */ 0x00002c50,
+	/* 0x00002c51 */ 0x00002c51,
+	/* 0x00002c52 */ 0x00002c52,
+	/* 0x00002c53 */ 0x00002c53,
+	/* 0x00002c54 */ 0x00002c54,
+	/* 0x00002c55 */ 0x00002c55,
+	/* 0x00002c56 */ 0x00002c56,
+	/* 0x00002c57 */ 0x00002c57,
+	/* 0x00002c58 */ 0x00002c58,
+	/* 0x00002c59 */ 0x00002c59,
+	/* 0x00002c5a */ 0x00002c5a,
+	/* 0x00002c5b */ 0x00002c5b,
+	/* 0x00002c5c */ 0x00002c5c,
+	/* 0x00002c5d */ 0x00002c5d,
+	/* 0x00002c5e */ 0x00002c5e,
+	/* 0x00002c5f */ 0x00002c5f,
+	/* 0x00002c60 */ 0x00002c61,
+	/* 0x00002c61 */ 0x00002c61,
+	/* 0x00002c62 */ 0x0000026b,
+	/* 0x00002c63 */ 0x00001d7d,
+	/* 0x00002c64 */ 0x0000027d,
+	/* 0x00002c65 */ 0x00002c65,
+	/* 0x00002c66 */ 0x00002c66,
+	/* 0x00002c67 */ 0x00002c68,
+	/* 0x00002c68 */ 0x00002c68,
+	/* 0x00002c69 */ 0x00002c6a,
+	/* 0x00002c6a */ 0x00002c6a,
+	/* 0x00002c6b */ 0x00002c6c,
+	/* 0x00002c6c */ 0x00002c6c,
+	/* 0x00002c6d */ 0x00000251,
+	/* 0x00002c6e */ 0x00000271,
+	/* 0x00002c6f */ 0x00000250,
+	/* 0x00002c70 */ 0x00000252,
+	/* 0x00002c71 */ 0x00002c71,
+	/* 0x00002c72 */ 0x00002c73,
+	/* 0x00002c73 */ 0x00002c73,
+	/* 0x00002c74 */ 0x00002c74,
+	/* 0x00002c75 */ 0x00002c76,
+	/* 0x00002c76 */ 0x00002c76,
+	/* 0x00002c77 */ 0x00002c77,
+	/* 0x00002c78 */ 0x00002c78,
+	/* 0x00002c79 */ 0x00002c79,
+	/* 0x00002c7a */ 0x00002c7a,
+	/* 0x00002c7b */ 0x00002c7b,
+	/* 0x00002c7c */ 0x00002c7c,
+	/* 0x00002c7d */ 0x00002c7d,
+	/* 0x00002c7e */ 0x0000023f,
+	/* 0x00002c7f */ 0x00000240,
+	/* 0x00002c80 */ 0x00002c81,
+	/* 0x00002c81 */ 0x00002c81,
+	/* 0x00002c82 */ 0x00002c83,
+	/* 0x00002c83 */ 0x00002c83,
+	/* 0x00002c84 */ 0x00002c85,
+	/* 0x00002c85 */ 0x00002c85,
+	/* 0x00002c86 */ 0x00002c87,
+	/* 0x00002c87 */ 0x00002c87,
+	/* 0x00002c88 */ 0x00002c89,
+	/* 0x00002c89 */ 0x00002c89,
+	/* 0x00002c8a */ 0x00002c8b,
+	/* 0x00002c8b */ 0x00002c8b,
+	/* 0x00002c8c */ 0x00002c8d,
+	/* 0x00002c8d */ 0x00002c8d,
+	/* 0x00002c8e */ 0x00002c8f,
+	/* 0x00002c8f */ 0x00002c8f,
+	/* 0x00002c90 */ 0x00002c91,
+	/* 0x00002c91 */ 0x00002c91,
+	/* 0x00002c92 */ 0x00002c93,
+	/* 0x00002c93 */ 0x00002c93,
+	/* 0x00002c94 */ 0x00002c95,
+	/* 0x00002c95 */ 0x00002c95,
+	/* 0x00002c96 */ 0x00002c97,
+	/* 0x00002c97 */ 0x00002c97,
+	/* 0x00002c98 */ 0x00002c99,
+	/* 0x00002c99 */ 0x00002c99,
+	/* 0x00002c9a */ 0x00002c9b,
+	/* 0x00002c9b */ 0x00002c9b,
+	/* 0x00002c9c */ 0x00002c9d,
+	/* 0x00002c9d */ 0x00002c9d,
+	/* 0x00002c9e */ 0x00002c9f,
+	/* 0x00002c9f */ 0x00002c9f,
+	/* 0x00002ca0 */ 0x00002ca1,
+	/* 0x00002ca1 */ 0x00002ca1,
+	/* 0x00002ca2 */ 0x00002ca3,
+	/* 0x00002ca3 */ 0x00002ca3,
+	/* 0x00002ca4 */ 0x00002ca5,
+	/* 0x00002ca5 */ 0x00002ca5,
+	/* 0x00002ca6 */ 0x00002ca7,
+	/* 0x00002ca7 */ 0x00002ca7,
+	/* 0x00002ca8 */ 0x00002ca9,
+	/* 0x00002ca9 */ 0x00002ca9,
+	/* 0x00002caa */ 0x00002cab,
+	/* 0x00002cab */ 0x00002cab,
+	/* 0x00002cac */ 0x00002cad,
+	/* 0x00002cad */ 0x00002cad,
+	/* 0x00002cae */ 0x00002caf,
+	/* 0x00002caf */ 0x00002caf,
+	/* 0x00002cb0 */ 0x00002cb1,
+	/* 0x00002cb1 */ 0x00002cb1,
+	/* 0x00002cb2 */ 0x00002cb3,
+	/* 0x00002cb3 */ 0x00002cb3,
+	/* 0x00002cb4 */ 0x00002cb5,
+	/* 0x00002cb5 */ 0x00002cb5,
+	/* 0x00002cb6 */ 0x00002cb7,
+	/* 0x00002cb7 */ 0x00002cb7,
+	/* 0x00002cb8 */ 0x00002cb9,
+	/* 0x00002cb9 */ 0x00002cb9,
+	/* 0x00002cba */ 0x00002cbb,
+	/* 0x00002cbb */ 0x00002cbb,
+	/* 0x00002cbc */ 0x00002cbd,
+	/* 0x00002cbd */ 0x00002cbd,
+	/* 0x00002cbe */ 0x00002cbf,
+	/* 0x00002cbf */ 0x00002cbf,
+	/* 0x00002cc0 */ 0x00002cc1,
+	/* 0x00002cc1 */ 0x00002cc1,
+	/* 0x00002cc2 */ 0x00002cc3,
+	/* 0x00002cc3 */ 0x00002cc3,
+	/* 0x00002cc4 */ 0x00002cc5,
+	/* 0x00002cc5 */ 0x00002cc5,
+	/* 0x00002cc6 */ 0x00002cc7,
+	/* 0x00002cc7 */ 0x00002cc7,
+	/* 0x00002cc8 */ 0x00002cc9,
+	/* 0x00002cc9 */ 0x00002cc9,
+	/* 0x00002cca */ 0x00002ccb,
+	/* 0x00002ccb */ 0x00002ccb,
+	/* 0x00002ccc */ 0x00002ccd,
+	/* 0x00002ccd */ 0x00002ccd,
+	/* 0x00002cce */ 0x00002ccf,
+	/* 0x00002ccf */ 0x00002ccf,
+	/* 0x00002cd0 */ 0x00002cd1,
+	/* 0x00002cd1 */ 0x00002cd1,
+	/* 0x00002cd2 */ 0x00002cd3,
+	/* 0x00002cd3 */ 0x00002cd3,
+	/* 0x00002cd4 */ 0x00002cd5,
+	/* 0x00002cd5 */ 0x00002cd5,
+	/* 0x00002cd6 */ 0x00002cd7,
+	/* 0x00002cd7 */ 0x00002cd7,
+	/* 0x00002cd8 */ 0x00002cd9,
+	/* 0x00002cd9 */ 0x00002cd9,
+	/* 0x00002cda */ 0x00002cdb,
+	/* 0x00002cdb */ 0x00002cdb,
+	/* 0x00002cdc */ 0x00002cdd,
+	/* 0x00002cdd */ 0x00002cdd,
+	/* 0x00002cde */ 0x00002cdf,
+	/* 0x00002cdf */ 0x00002cdf,
+	/* 0x00002ce0 */ 0x00002ce1,
+	/* 0x00002ce1 */ 0x00002ce1,
+	/* 0x00002ce2 */ 0x00002ce3,
+	/* 0x00002ce3 */ 0x00002ce3,
+	/* 0x00002ce4 */ 0x00002ce4,
+	/* 0x00002ce5 */ 0x00002ce5,
+	/* 0x00002ce6 */ 0x00002ce6,
+	/* 0x00002ce7 */ 0x00002ce7,
+	/* 0x00002ce8 */ 0x00002ce8,
+	/* 0x00002ce9 */ 0x00002ce9,
+	/* 0x00002cea */ 0x00002cea,
+	/* 0x00002ceb */ 0x00002cec,
+	/* 0x00002cec */ 0x00002cec,
+	/* 0x00002ced */ 0x00002cee,
+	/* 0x00002cee */ 0x00002cee,
+	/* 0x00002cef */ 0x00002cef,
+	/* 0x00002cf0 */ 0x00002cf0,
+	/* 0x00002cf1 */ 0x00002cf1,
+	/* 0x00002cf2 */ 0x00002cf3,
+	/* 0x00002cf3 */ 0x00002cf3,
+	/* 0x00002cf4 */ 0x00002cf4,
+	/* 0x00002cf5 */ 0x00002cf5,
+	/* 0x00002cf6 */ 0x00002cf6,
+	/* 0x00002cf7 */ 0x00002cf7,
+	/* 0x00002cf8 */ 0x00002cf8,
+	/* 0x00002cf9 */ 0x00002cf9,
+	/* 0x00002cfa */ 0x00002cfa,
+	/* 0x00002cfb */ 0x00002cfb,
+	/* 0x00002cfc */ 0x00002cfc,
+	/* 0x00002cfd */ 0x00002cfd,
+	/* 0x00002cfe */ 0x00002cfe,
+	/* 0x00002cff */ 0x00002cff
+};
+
+static uint32_t libfshfs_name_case_folding_mappings_0x0000a600[ 256 ] = {
+	/* 0x0000a600 */ 0x0000a600,
+	/* 0x0000a601 */ 0x0000a601,
+	/* 0x0000a602 */ 0x0000a602,
+	/* 0x0000a603 */ 0x0000a603,
+	/* 0x0000a604 */ 0x0000a604,
+	/* 0x0000a605 */ 0x0000a605,
+	/* 0x0000a606 */ 0x0000a606,
+	/* 0x0000a607 */ 0x0000a607,
+	/* 0x0000a608 */ 0x0000a608,
+	/* 0x0000a609 */ 0x0000a609,
+	/* 0x0000a60a */ 0x0000a60a,
+	/* 0x0000a60b */ 0x0000a60b,
+	/* 0x0000a60c */ 0x0000a60c,
+	/* 0x0000a60d */ 0x0000a60d,
+	/* 0x0000a60e */ 0x0000a60e,
+	/* 0x0000a60f */ 0x0000a60f,
+	/* 0x0000a610 */ 0x0000a610,
+	/* 0x0000a611 */ 0x0000a611,
+	/* 0x0000a612 */ 0x0000a612,
+	/* 0x0000a613 */ 0x0000a613,
+	/* 0x0000a614 */ 0x0000a614,
+	/* 0x0000a615 */ 0x0000a615,
+	/* 0x0000a616 */ 0x0000a616,
+	/* 0x0000a617 */ 0x0000a617,
+	/* 0x0000a618 */ 0x0000a618,
+	/* 0x0000a619 */ 0x0000a619,
+	/* 0x0000a61a */ 0x0000a61a,
+	/* 0x0000a61b */ 0x0000a61b,
+	/* 0x0000a61c */ 0x0000a61c,
+	/* 0x0000a61d */ 0x0000a61d,
+	/* 0x0000a61e */ 0x0000a61e,
+	/* 0x0000a61f */ 0x0000a61f,
+	/* 0x0000a620 */ 0x0000a620,
+	/* 0x0000a621 */ 0x0000a621,
+	/* 0x0000a622 */ 0x0000a622,
+	/* 0x0000a623 */ 0x0000a623,
+	/* 0x0000a624 */ 0x0000a624,
+	/* 0x0000a625 */ 0x0000a625,
+	/* 0x0000a626 */ 0x0000a626,
+	/* 0x0000a627 */ 0x0000a627,
+	/* 0x0000a628 */ 0x0000a628,
+	/* 0x0000a629 */ 0x0000a629,
+	/* 0x0000a62a */ 0x0000a62a,
+	/* 0x0000a62b */ 0x0000a62b,
+	/* 0x0000a62c */ 0x0000a62c,
+	/* 0x0000a62d */ 0x0000a62d,
+	/* 0x0000a62e */ 0x0000a62e,
+	/* 0x0000a62f */ 0x0000a62f,
+	/* 0x0000a630 */ 0x0000a630,
+	/* 0x0000a631 */ 0x0000a631,
+	/* 0x0000a632 */ 0x0000a632,
+	/* 0x0000a633 */ 0x0000a633,
+	/* 0x0000a634 */ 0x0000a634,
+	/* 0x0000a635 */ 0x0000a635,
+	/* 0x0000a636 */ 0x0000a636,
+	/* 0x0000a637 */ 0x0000a637,
+	/* 0x0000a638 */ 0x0000a638,
+	/* 0x0000a639 */ 0x0000a639,
+	/* 0x0000a63a */ 0x0000a63a,
+	/* 0x0000a63b */ 0x0000a63b,
+	/* 0x0000a63c */ 0x0000a63c,
+	/* 0x0000a63d */ 0x0000a63d,
+	/* 0x0000a63e */ 0x0000a63e,
+	/* 0x0000a63f */ 0x0000a63f,
+	/* 0x0000a640 */ 0x0000a641,
+	/* 0x0000a641 */ 0x0000a641,
+	/* 0x0000a642 */ 0x0000a643,
+	/* 0x0000a643 */ 0x0000a643,
+	/* 0x0000a644 */ 0x0000a645,
+	/* 0x0000a645 */ 0x0000a645,
+	/* 0x0000a646 */ 0x0000a647,
+	/* 0x0000a647 */ 0x0000a647,
+	/* 0x0000a648 */ 0x0000a649,
+	/* 0x0000a649 */ 0x0000a649,
+	/* 0x0000a64a */ 0x0000a64b,
+	/* 0x0000a64b */ 0x0000a64b,
+	/* 0x0000a64c */ 0x0000a64d,
+	/* 0x0000a64d */ 0x0000a64d,
+	/* 0x0000a64e */ 0x0000a64f,
+	/* 0x0000a64f */ 0x0000a64f,
+	/* 0x0000a650 */ 0x0000a651,
+	/* 0x0000a651 */ 0x0000a651,
+	/* 0x0000a652 */ 0x0000a653,
+	/* 0x0000a653 */ 0x0000a653,
+	/* 0x0000a654 */ 0x0000a655,
+	/* 0x0000a655 */ 0x0000a655,
+	/* 0x0000a656 */ 0x0000a657,
+	/* 0x0000a657 */ 0x0000a657,
+	/* 0x0000a658 */ 0x0000a659,
+	/* 0x0000a659 */ 0x0000a659,
+	/* 0x0000a65a */ 0x0000a65b,
+	/* 0x0000a65b */ 0x0000a65b,
+	/* 0x0000a65c */ 0x0000a65d,
+	/* 0x0000a65d */ 0x0000a65d,
+	/* 0x0000a65e */ 0x0000a65f,
+	/* 0x0000a65f */ 0x0000a65f,
+	/* 0x0000a660 */ 0x0000a661,
+	/* 0x0000a661 */ 0x0000a661,
+	/* 0x0000a662 */ 0x0000a663,
+	/* 0x0000a663 */ 0x0000a663,
+	/* 0x0000a664 */ 0x0000a665,
+	/* 0x0000a665 */ 0x0000a665,
+	/* 0x0000a666 */ 0x0000a667,
+	/* 0x0000a667 */ 0x0000a667,
+	/* 0x0000a668 */ 0x0000a669,
+	/* 0x0000a669 */ 0x0000a669,
+	/* 0x0000a66a */ 0x0000a66b,
+	/* 0x0000a66b */ 0x0000a66b,
+	/* 0x0000a66c */ 0x0000a66d,
+	/* 0x0000a66d */ 0x0000a66d,
+	/* 0x0000a66e */ 0x0000a66e,
+	/* 0x0000a66f */ 0x0000a66f,
+	/* 0x0000a670 */ 0x0000a670,
+	/* 0x0000a671 */ 0x0000a671,
+	/* 0x0000a672 */ 0x0000a672,
+	/* 0x0000a673 */ 0x0000a673,
+	/* 0x0000a674 */ 0x0000a674,
+	/* 0x0000a675 */ 0x0000a675,
+	/* 0x0000a676 */ 0x0000a676,
+	/* 0x0000a677 */ 0x0000a677,
+	/* 0x0000a678 */ 0x0000a678,
+	/* 0x0000a679 */ 0x0000a679,
+	/* 0x0000a67a */ 0x0000a67a,
+	/* 0x0000a67b */ 0x0000a67b,
+	/* 0x0000a67c */ 0x0000a67c,
+	/* 0x0000a67d */ 0x0000a67d,
+	/* 0x0000a67e */ 0x0000a67e,
+	/* 0x0000a67f */ 0x0000a67f,
+	/* 0x0000a680 */ 0x0000a681,
+	/* 0x0000a681 */ 0x0000a681,
+	/* 0x0000a682 */ 0x0000a683,
+	/* 0x0000a683 */ 0x0000a683,
+	/* 0x0000a684 */ 0x0000a685,
+	/* 0x0000a685 */ 0x0000a685,
+	/* 0x0000a686 */ 0x0000a687,
+	/* 0x0000a687 */ 0x0000a687,
+	/* 0x0000a688 */ 0x0000a689,
+	/* 0x0000a689 */ 0x0000a689,
+	/* 0x0000a68a */ 0x0000a68b,
+	/* 0x0000a68b */ 0x0000a68b,
+	/* 0x0000a68c */ 0x0000a68d,
+	/* 0x0000a68d */ 0x0000a68d,
+	/* 0x0000a68e */ 0x0000a68f,
+	/* 0x0000a68f */ 0x0000a68f,
+	/* 0x0000a690 */ 0x0000a691,
+	/* 0x0000a691 */ 0x0000a691,
+	/* 0x0000a692 */ 0x0000a693,
+	/* 0x0000a693 */ 0x0000a693,
+	/* 0x0000a694 */ 0x0000a695,
+	/* 0x0000a695 */ 0x0000a695,
+	/* 0x0000a696 */ 0x0000a697,
+	/* 0x0000a697 */ 0x0000a697,
+	/* 0x0000a698 */ 0x0000a699,
+	/* 0x0000a699 */ 0x0000a699,
+	/* 0x0000a69a */ 0x0000a69b,
+	/* 0x0000a69b */ 0x0000a69b,
+	/* 0x0000a69c */ 0x0000a69c,
+	/* 0x0000a69d */ 0x0000a69d,
+	/* 0x0000a69e */ 0x0000a69e,
+	/* 0x0000a69f */ 0x0000a69f,
+	/* 0x0000a6a0 */ 0x0000a6a0,
+	/* 0x0000a6a1 */ 0x0000a6a1,
+	/* 0x0000a6a2 */ 0x0000a6a2,
+	/* 0x0000a6a3 */ 0x0000a6a3,
+	/* 0x0000a6a4 */ 0x0000a6a4,
+	/* 0x0000a6a5 */ 0x0000a6a5,
+	/* 0x0000a6a6 */ 0x0000a6a6,
+	/* 0x0000a6a7 */ 0x0000a6a7,
+	/* 0x0000a6a8 */ 0x0000a6a8,
+	/* 0x0000a6a9 */ 0x0000a6a9,
+	/* 0x0000a6aa */ 0x0000a6aa,
+	/* 0x0000a6ab */ 0x0000a6ab,
+	/* 0x0000a6ac */ 0x0000a6ac,
+	/* 0x0000a6ad */ 0x0000a6ad,
+	/* 0x0000a6ae */ 0x0000a6ae,
+	/* 0x0000a6af */ 0x0000a6af,
+	/* 0x0000a6b0 */ 0x0000a6b0,
+	/* 0x0000a6b1 */ 0x0000a6b1,
+	/* 0x0000a6b2 */ 0x0000a6b2,
+	/* 0x0000a6b3 */ 0x0000a6b3,
+	/* 0x0000a6b4 */ 0x0000a6b4,
+	/* 0x0000a6b5 */ 0x0000a6b5,
+	/* 0x0000a6b6 */ 0x0000a6b6,
+	/* 0x0000a6b7 */ 0x0000a6b7,
+	/* 0x0000a6b8 */ 0x0000a6b8,
+	/* 0x0000a6b9 */ 0x0000a6b9,
+	/* 0x0000a6ba */ 0x0000a6ba,
+	/* 0x0000a6bb */ 0x0000a6bb,
+	/* 0x0000a6bc */ 0x0000a6bc,
+	/* 0x0000a6bd */ 0x0000a6bd,
+	/* 0x0000a6be */ 0x0000a6be,
+	/* 0x0000a6bf */ 0x0000a6bf,
+	/* 0x0000a6c0 */ 0x0000a6c0,
+	/* 0x0000a6c1 */ 0x0000a6c1,
+	/* 0x0000a6c2 */ 0x0000a6c2,
+	/* 0x0000a6c3 */ 0x0000a6c3,
+	/* 0x0000a6c4 */ 0x0000a6c4,
+	/* 0x0000a6c5 */ 0x0000a6c5,
+	/* 0x0000a6c6 */ 0x0000a6c6,
+	/* 0x0000a6c7 */ 0x0000a6c7,
+	/* 0x0000a6c8 */ 0x0000a6c8,
+	/* 0x0000a6c9 */ 0x0000a6c9,
+	/* 0x0000a6ca */ 0x0000a6ca,
+	/* 0x0000a6cb */ 0x0000a6cb,
+	/* 0x0000a6cc */ 0x0000a6cc,
+	/* 0x0000a6cd */ 0x0000a6cd,
+	/* 0x0000a6ce */ 0x0000a6ce,
+	/* 0x0000a6cf */ 0x0000a6cf,
+	/* 0x0000a6d0 */ 0x0000a6d0,
+	/* 0x0000a6d1 */ 0x0000a6d1,
+	/* 0x0000a6d2 */ 0x0000a6d2,
+	/* 0x0000a6d3 */ 0x0000a6d3,
+	/* 0x0000a6d4 */ 0x0000a6d4,
+	/* 0x0000a6d5 */ 0x0000a6d5,
+	/* 0x0000a6d6 */ 0x0000a6d6,
+	/* 0x0000a6d7 */ 0x0000a6d7,
+	/* 0x0000a6d8 */ 0x0000a6d8,
+	/* 0x0000a6d9 */ 0x0000a6d9,
+	/* 0x0000a6da */ 0x0000a6da,
+	/* 0x0000a6db */ 0x0000a6db,
+	/* 0x0000a6dc */ 0x0000a6dc,
+	/* 0x0000a6dd */ 0x0000a6dd,
+	/* 0x0000a6de */ 0x0000a6de,
+	/* 0x0000a6df */ 0x0000a6df,
+	/* 0x0000a6e0 */ 0x0000a6e0,
+	/* 0x0000a6e1 */ 0x0000a6e1,
+	/* 0x0000a6e2 */ 0x0000a6e2,
+	/* 0x0000a6e3 */ 0x0000a6e3,
+	/* 0x0000a6e4 */ 0x0000a6e4,
+	/* 0x0000a6e5 */ 0x0000a6e5,
+	/* 0x0000a6e6 */ 0x0000a6e6,
+	/* 0x0000a6e7 */ 0x0000a6e7,
+	/* 0x0000a6e8 */ 0x0000a6e8,
+	/* 0x0000a6e9 */ 0x0000a6e9,
+	/* 0x0000a6ea */ 0x0000a6ea,
+	/* 0x0000a6eb */ 0x0000a6eb,
+	/* 0x0000a6ec */ 0x0000a6ec,
+	/* 0x0000a6ed */ 0x0000a6ed,
+	/* 0x0000a6ee */ 0x0000a6ee,
+	/* 0x0000a6ef */ 0x0000a6ef,
+	/* 0x0000a6f0 */ 0x0000a6f0,
+	/* 0x0000a6f1 */ 0x0000a6f1,
+	/* 0x0000a6f2 */ 0x0000a6f2,
+	/* 0x0000a6f3 */ 0x0000a6f3,
+	/* 0x0000a6f4 */ 0x0000a6f4,
+	/* 0x0000a6f5 */ 0x0000a6f5,
+	/* 0x0000a6f6 */ 0x0000a6f6,
+	/* 0x0000a6f7 */ 0x0000a6f7,
+	/* 0x0000a6f8 */ 0x0000a6f8,
+	/* 0x0000a6f9 */ 0x0000a6f9,
+	/* 0x0000a6fa */ 0x0000a6fa,
+	/* 0x0000a6fb */ 0x0000a6fb,
+	/* 0x0000a6fc */ 0x0000a6fc,
+	/* 0x0000a6fd */ 0x0000a6fd,
+	/* 0x0000a6fe */ 0x0000a6fe,
+	/* 0x0000a6ff */ 0x0000a6ff
+};
+
+static uint32_t libfshfs_name_case_folding_mappings_0x0000a700[ 256 ] = {
+	/* 0x0000a700 */ 0x0000a700,
+	/* 0x0000a701 */ 0x0000a701,
+	/* 0x0000a702 */ 0x0000a702,
+	/* 0x0000a703 */ 0x0000a703,
+	/* 0x0000a704 */ 0x0000a704,
+	/* 0x0000a705 */ 0x0000a705,
+	/* 0x0000a706 */ 0x0000a706,
+	/* 0x0000a707 */ 0x0000a707,
+	/* 0x0000a708 */ 0x0000a708,
+	/* 0x0000a709 */ 0x0000a709,
+	/* 0x0000a70a */ 0x0000a70a,
+	/* 0x0000a70b */ 0x0000a70b,
+	/* 0x0000a70c */ 0x0000a70c,
+	/* 0x0000a70d */ 0x0000a70d,
+	/* 0x0000a70e */ 0x0000a70e,
+	/* 0x0000a70f */ 0x0000a70f,
+	/* 0x0000a710 */ 0x0000a710,
+	/* 0x0000a711 */ 0x0000a711,
+	/* 0x0000a712 */ 0x0000a712,
+	/* 0x0000a713 */ 0x0000a713,
+	/* 0x0000a714 */ 0x0000a714,
+	/* 0x0000a715 */ 0x0000a715,
+	/* 0x0000a716 */ 0x0000a716,
+	/* 0x0000a717 */ 0x0000a717,
+	/* 0x0000a718 */ 0x0000a718,
+	/* 0x0000a719 */ 0x0000a719,
+	/* 0x0000a71a */ 0x0000a71a,
+	/* 0x0000a71b */ 0x0000a71b,
+	/* 0x0000a71c */ 0x0000a71c,
+	/* 0x0000a71d */ 0x0000a71d,
+	/* 0x0000a71e */ 0x0000a71e,
+	/* 0x0000a71f */ 0x0000a71f,
+	/* 0x0000a720 */ 0x0000a720,
+	/* 0x0000a721 */ 0x0000a721,
+	/* 0x0000a722 */ 0x0000a723,
+	/* 0x0000a723 */ 0x0000a723,
+	/* 0x0000a724 */ 0x0000a725,
+	/* 0x0000a725 */ 0x0000a725,
+	/* 0x0000a726 */ 0x0000a727,
+	/* 0x0000a727 */ 0x0000a727,
+	/* 0x0000a728 */ 0x0000a729,
+	/* 0x0000a729 */ 0x0000a729,
+	/* 0x0000a72a */ 0x0000a72b,
+	/* 0x0000a72b */ 0x0000a72b,
+	/* 0x0000a72c */ 0x0000a72d,
+	/* 0x0000a72d */ 0x0000a72d,
+	/* 0x0000a72e */ 0x0000a72f,
+	/* 0x0000a72f */ 0x0000a72f,
+	/* 0x0000a730 */ 0x0000a730,
+	/* 0x0000a731 */ 0x0000a731,
+	/* 0x0000a732 */ 0x0000a733,
+	/* 0x0000a733 */ 0x0000a733,
+	/* 0x0000a734 */ 0x0000a735,
+	/* 0x0000a735 */ 0x0000a735,
+	/* 0x0000a736 */ 0x0000a737,
+	/* 0x0000a737 */ 0x0000a737,
+	/* 0x0000a738 */ 0x0000a739,
+	/* 0x0000a739 */ 0x0000a739,
+	/* 0x0000a73a */ 0x0000a73b,
+	/* 0x0000a73b */ 0x0000a73b,
+	/* 0x0000a73c */ 0x0000a73d,
+	/* 0x0000a73d */ 0x0000a73d,
+	/* 0x0000a73e */ 0x0000a73f,
+	/* 0x0000a73f */ 0x0000a73f,
+	/* 0x0000a740 */ 0x0000a741,
+	/* 0x0000a741 */ 0x0000a741,
+	/* 0x0000a742 */ 0x0000a743,
+	/* 0x0000a743 */ 0x0000a743,
+	/* 0x0000a744 */ 0x0000a745,
+	/* 0x0000a745 */ 0x0000a745,
+	/* 0x0000a746 */ 0x0000a747,
+	/* 0x0000a747 */ 0x0000a747,
+	/* 0x0000a748 */ 0x0000a749,
+	/* 0x0000a749 */ 0x0000a749,
+	/* 0x0000a74a */ 0x0000a74b,
+	/* 0x0000a74b */ 0x0000a74b,
+	/* 0x0000a74c */ 0x0000a74d,
+	/* 0x0000a74d */ 0x0000a74d,
+	/* 0x0000a74e */ 0x0000a74f,
+	/* 0x0000a74f */ 0x0000a74f,
+	/* 0x0000a750 */ 0x0000a751,
+	/* 0x0000a751 */ 0x0000a751,
+	/* 0x0000a752 */ 0x0000a753,
+	/* 0x0000a753 */ 0x0000a753,
+	/* 0x0000a754 */ 0x0000a755,
+	/* 0x0000a755 */ 0x0000a755,
+	/* 0x0000a756 */ 0x0000a757,
+	/* 0x0000a757 */ 0x0000a757,
+	/* 0x0000a758 */ 0x0000a759,
+	/* 0x0000a759 */ 0x0000a759,
+	/* 0x0000a75a */ 0x0000a75b,
+	/* 0x0000a75b */ 0x0000a75b,
+	/* 0x0000a75c */ 0x0000a75d,
+	/* 0x0000a75d */ 0x0000a75d,
+	/* 0x0000a75e */ 0x0000a75f,
+	/* 0x0000a75f */ 0x0000a75f,
+	/* 0x0000a760 */ 0x0000a761,
+	/* 0x0000a761 */ 0x0000a761,
+	/* 0x0000a762 */ 0x0000a763,
+	/* 0x0000a763 */ 0x0000a763,
+	/* 0x0000a764 */ 0x0000a765,
+	/* 0x0000a765 */ 0x0000a765,
+	/* 0x0000a766 */ 0x0000a767,
+	/* 0x0000a767 */ 0x0000a767,
+	/* 0x0000a768 */ 0x0000a769,
+	/* 0x0000a769 */ 0x0000a769,
+	/* 0x0000a76a */ 0x0000a76b,
+	/* 0x0000a76b */ 0x0000a76b,
+	/* 0x0000a76c */ 0x0000a76d,
+	/* 0x0000a76d */ 0x0000a76d,
+	/* 0x0000a76e */ 0x0000a76f,
+	/* 0x0000a76f */ 0x0000a76f,
+	/* 0x0000a770 */ 0x0000a770,
+	/* 0x0000a771 */ 0x0000a771,
+	/* 0x0000a772 */ 0x0000a772,
+	/* 0x0000a773 */ 0x0000a773,
+	/* 0x0000a774 */ 0x0000a774,
+	/* 0x0000a775 */ 0x0000a775,
+	/* 0x0000a776 */ 0x0000a776,
+	/* 0x0000a777 */ 0x0000a777,
+	/* 0x0000a778 */ 0x0000a778,
+	/* 0x0000a779 */ 0x0000a77a,
+	/* 0x0000a77a */ 0x0000a77a,
+	/* 0x0000a77b */ 0x0000a77c,
+	/* 0x0000a77c */ 0x0000a77c,
+	/* 0x0000a77d */ 0x00001d79,
+	/* 0x0000a77e */ 0x0000a77f,
+	/* 0x0000a77f */ 0x0000a77f,
+	/* 0x0000a780 */ 0x0000a781,
+	/* 0x0000a781 */ 0x0000a781,
+	/* 0x0000a782 */ 0x0000a783,
+	/* 0x0000a783 */ 0x0000a783,
+	/* 0x0000a784 */ 0x0000a785,
+	/* 0x0000a785 */ 0x0000a785,
+	/* 0x0000a786 */ 0x0000a787,
+	/* 0x0000a787 */ 0x0000a787,
+	/* 0x0000a788 */ 0x0000a788,
+	/* 0x0000a789 */ 0x0000a789,
+	/* 0x0000a78a */ 0x0000a78a,
+	/* 0x0000a78b */ 0x0000a78c,
+	/* 0x0000a78c */ 0x0000a78c,
+	/* 0x0000a78d */ 0x00000265,
+	/* 0x0000a78e */ 0x0000a78e,
+	/* 0x0000a78f */ 0x0000a78f,
+	/* 0x0000a790 */ 0x0000a791,
+	/* 0x0000a791 */ 0x0000a791,
+	/* 0x0000a792 */ 0x0000a793,
+	/* 0x0000a793 */ 0x0000a793,
+	/* 0x0000a794 */ 0x0000a794,
+	/* 0x0000a795 */ 0x0000a795,
+	/* 0x0000a796 */ 0x0000a797,
+	/* 0x0000a797 */ 0x0000a797,
+	/* 0x0000a798 */ 0x0000a799,
+	/* 0x0000a799 */ 0x0000a799,
+	/* 0x0000a79a */ 0x0000a79b,
+	/* 0x0000a79b */ 0x0000a79b,
+	/* 0x0000a79c */ 0x0000a79d,
+	/* 0x0000a79d */ 0x0000a79d,
+	/* 0x0000a79e */ 0x0000a79f,
+	/* 0x0000a79f */ 0x0000a79f,
+	/* 0x0000a7a0 */ 0x0000a7a1,
+	/* 0x0000a7a1 */ 0x0000a7a1,
+	/* 0x0000a7a2 */ 0x0000a7a3,
+	/* 0x0000a7a3 */ 0x0000a7a3,
+	/* 0x0000a7a4 */ 0x0000a7a5,
+	/* 0x0000a7a5 */ 0x0000a7a5,
+	/* 0x0000a7a6 */ 0x0000a7a7,
+	/* 0x0000a7a7 */ 0x0000a7a7,
+	/* 0x0000a7a8 */ 0x0000a7a9,
+	/* 0x0000a7a9 */ 0x0000a7a9,
+	/* 0x0000a7aa */ 0x00000266,
+	/* 0x0000a7ab */ 0x0000025c,
+	/* 0x0000a7ac */ 0x00000261,
+	/* 0x0000a7ad */ 0x0000026c,
+	/* 0x0000a7ae */ 0x0000026a,
+	/* 0x0000a7af */ 0x0000a7af,
+	/* 0x0000a7b0 */ 0x0000029e,
+	/* 0x0000a7b1 */ 0x00000287,
+	/* 0x0000a7b2 */ 0x0000029d,
+	/* 0x0000a7b3 */ 0x0000ab53,
+	/* 0x0000a7b4 */ 0x0000a7b5,
+	/* 0x0000a7b5 */ 0x0000a7b5,
+	/* 0x0000a7b6 */ 0x0000a7b7,
+	/* 0x0000a7b7 */ 0x0000a7b7,
+	/* 0x0000a7b8 */ 0x0000a7b8,
+	/* 0x0000a7b9 */ 0x0000a7b9,
+	/* 0x0000a7ba */ 0x0000a7ba,
+	/* 0x0000a7bb */ 0x0000a7bb,
+	/* 0x0000a7bc */ 0x0000a7bc,
+	/* 0x0000a7bd */ 0x0000a7bd,
+	/* 0x0000a7be */ 0x0000a7be,
+	/* 0x0000a7bf */ 0x0000a7bf,
+	/* 0x0000a7c0 */ 0x0000a7c0,
+	/* 0x0000a7c1 */ 0x0000a7c1,
+	/* 0x0000a7c2 */ 0x0000a7c2,
+	/* 0x0000a7c3 */ 0x0000a7c3,
+	/* 0x0000a7c4 */ 0x0000a7c4,
+	/* 0x0000a7c5 */ 0x0000a7c5,
+	/* 0x0000a7c6 */ 0x0000a7c6,
+	/* 0x0000a7c7 */ 0x0000a7c7,
+	/* 0x0000a7c8 */ 0x0000a7c8,
+	/* 0x0000a7c9 */ 0x0000a7c9,
+	/* 0x0000a7ca */ 0x0000a7ca,
+	/* 0x0000a7cb */ 0x0000a7cb,
+	/* 0x0000a7cc */ 0x0000a7cc,
+	/* 0x0000a7cd */ 0x0000a7cd,
+	/* 0x0000a7ce */ 0x0000a7ce,
+	/* 0x0000a7cf */ 0x0000a7cf,
+	/* 0x0000a7d0 */ 0x0000a7d0,
+	/* 0x0000a7d1 */ 0x0000a7d1,
+	/* 0x0000a7d2 */ 0x0000a7d2,
+	/* 0x0000a7d3 */ 0x0000a7d3,
+	/* 0x0000a7d4 */ 0x0000a7d4,
+	/* 0x0000a7d5 */ 0x0000a7d5,
+	/* 0x0000a7d6 */ 0x0000a7d6,
+	/* 0x0000a7d7 */ 0x0000a7d7,
+	/* 0x0000a7d8 */ 0x0000a7d8,
+	/* 0x0000a7d9 */ 0x0000a7d9,
+	/* 0x0000a7da */ 0x0000a7da,
+	/* 0x0000a7db */ 0x0000a7db,
+	/* 0x0000a7dc */ 0x0000a7dc,
+	/* 0x0000a7dd */ 0x0000a7dd,
+	/* 0x0000a7de */ 0x0000a7de,
+	/* 0x0000a7df */ 0x0000a7df,
+	/* 0x0000a7e0 */ 0x0000a7e0,
+	/* 0x0000a7e1 */ 0x0000a7e1,
+	/* 0x0000a7e2 */ 0x0000a7e2,
+	/* 0x0000a7e3 */ 0x0000a7e3,
+	/* 0x0000a7e4 */ 0x0000a7e4,
+	/* 0x0000a7e5 */ 0x0000a7e5,
+	/* 0x0000a7e6 */ 0x0000a7e6,
+	/* 0x0000a7e7 */ 0x0000a7e7,
+	/* 0x0000a7e8 */ 0x0000a7e8,
+	/* 0x0000a7e9 */ 0x0000a7e9,
+	/* 0x0000a7ea */ 0x0000a7ea,
+	/* 0x0000a7eb */ 0x0000a7eb,
+	/* 0x0000a7ec */ 0x0000a7ec,
+	/* 0x0000a7ed */ 0x0000a7ed,
+	/* 0x0000a7ee */ 0x0000a7ee,
+	/* 0x0000a7ef */ 0x0000a7ef,
+	/* 0x0000a7f0 */ 0x0000a7f0,
+	/* 0x0000a7f1 */ 0x0000a7f1,
+	/* 0x0000a7f2 */ 0x0000a7f2,
+	/* 0x0000a7f3 */ 0x0000a7f3,
+	/* 0x0000a7f4 */ 0x0000a7f4,
+	/* 0x0000a7f5 */ 0x0000a7f5,
+	/* 0x0000a7f6 */ 0x0000a7f6,
+	/* 0x0000a7f7 */ 0x0000a7f7,
+	/* 0x0000a7f8 */ 0x0000a7f8,
+	/* 0x0000a7f9 */ 0x0000a7f9,
+	/* 0x0000a7fa */ 0x0000a7fa,
+	/* 0x0000a7fb */ 0x0000a7fb,
+	/* 0x0000a7fc */ 0x0000a7fc,
+	/* 0x0000a7fd */ 0x0000a7fd,
+	/* 0x0000a7fe */ 0x0000a7fe,
+	/* 0x0000a7ff */ 0x0000a7ff
+};
+
+static uint32_t libfshfs_name_case_folding_mappings_0x0000ab00[ 256 ] = {
+	/* 0x0000ab00 */ 0x0000ab00,
+	/* 0x0000ab01 */ 0x0000ab01,
+	/* 0x0000ab02 */ 0x0000ab02,
+	/* 0x0000ab03 */ 0x0000ab03,
+	/* 0x0000ab04 */ 0x0000ab04,
+	/* 0x0000ab05 */ 0x0000ab05,
+	/* 0x0000ab06 */ 0x0000ab06,
+	/* 0x0000ab07 */ 0x0000ab07,
+	/* 0x0000ab08 */ 0x0000ab08,
+	/* 0x0000ab09 */ 0x0000ab09,
+	/* 0x0000ab0a */ 0x0000ab0a,
+	/* 0x0000ab0b */ 0x0000ab0b,
+	/* 0x0000ab0c */ 0x0000ab0c,
+	/* 0x0000ab0d */ 0x0000ab0d,
+	/* 0x0000ab0e */ 0x0000ab0e,
+	/* 0x0000ab0f */ 0x0000ab0f,
+	/* 0x0000ab10 */ 0x0000ab10,
+	/* 0x0000ab11 */ 0x0000ab11,
+	/* 0x0000ab12 */ 0x0000ab12,
+	/* 0x0000ab13 */ 0x0000ab13,
+	/* 0x0000ab14 */ 0x0000ab14,
+	/* 0x0000ab15 */ 0x0000ab15,
+	/* 0x0000ab16 */ 0x0000ab16,
+	/* 0x0000ab17 */ 0x0000ab17,
+	/* 0x0000ab18 */ 0x0000ab18,
+	/* 0x0000ab19 */ 0x0000ab19,
+	/* 0x0000ab1a */ 0x0000ab1a,
+	/* 0x0000ab1b */ 0x0000ab1b,
+	/* 0x0000ab1c */ 0x0000ab1c,
+	/* 0x0000ab1d */ 0x0000ab1d,
+	/* 0x0000ab1e */ 0x0000ab1e,
+	/* 0x0000ab1f */ 0x0000ab1f,
+	/* 0x0000ab20 */ 0x0000ab20,
+	/* 0x0000ab21 */ 0x0000ab21,
+	/* 0x0000ab22 */ 0x0000ab22,
+	/* 0x0000ab23 */ 0x0000ab23,
+	/* 0x0000ab24 */ 0x0000ab24,
+	/* 0x0000ab25 */ 0x0000ab25,
+	/* 0x0000ab26 */ 0x0000ab26,
+	/* 0x0000ab27 */ 0x0000ab27,
+	/* 0x0000ab28 */ 0x0000ab28,
+	/* 0x0000ab29 */ 0x0000ab29,
+	/* 0x0000ab2a */ 0x0000ab2a,
+	/* 0x0000ab2b */ 0x0000ab2b,
+	/* 0x0000ab2c */ 0x0000ab2c,
+	/* 0x0000ab2d */ 0x0000ab2d,
+	/* 0x0000ab2e */ 0x0000ab2e,
+	/* 0x0000ab2f */ 0x0000ab2f,
+	/* 0x0000ab30 */ 0x0000ab30,
+	/* 0x0000ab31 */ 0x0000ab31,
+	/* 0x0000ab32 */ 0x0000ab32,
+	/* 0x0000ab33 */ 0x0000ab33,
+	/* 0x0000ab34 */ 0x0000ab34,
+	/* 0x0000ab35 */ 0x0000ab35,
+	/* 0x0000ab36 */ 0x0000ab36,
+	/* 0x0000ab37 */ 0x0000ab37,
+	/* 0x0000ab38 */ 0x0000ab38,
+	/* 0x0000ab39 */ 0x0000ab39,
+	/* 0x0000ab3a */ 0x0000ab3a,
+	/* 0x0000ab3b */ 0x0000ab3b,
+	/* 0x0000ab3c */ 0x0000ab3c,
+	/* 0x0000ab3d */ 0x0000ab3d,
+	/* 0x0000ab3e */ 0x0000ab3e,
+	/* 0x0000ab3f */ 0x0000ab3f,
+	/* 0x0000ab40 */ 0x0000ab40,
+	/* 0x0000ab41 */ 0x0000ab41,
+	/* 0x0000ab42 */ 0x0000ab42,
+	/* 0x0000ab43 */ 0x0000ab43,
+	/* 0x0000ab44 */ 0x0000ab44,
+	/* 0x0000ab45 */ 0x0000ab45,
+	/* 0x0000ab46 */ 0x0000ab46,
+	/* 0x0000ab47 */ 0x0000ab47,
+	/* 0x0000ab48 */ 0x0000ab48,
+	/* 0x0000ab49 */ 0x0000ab49,
+	/* 0x0000ab4a */ 0x0000ab4a,
+	/* 0x0000ab4b */ 0x0000ab4b,
+	/* 0x0000ab4c */ 0x0000ab4c,
+	/* 0x0000ab4d */ 0x0000ab4d,
+	/* 0x0000ab4e */ 0x0000ab4e,
+	/* 0x0000ab4f */ 0x0000ab4f,
+	/* 0x0000ab50 */ 0x0000ab50,
+	/* 0x0000ab51 */ 0x0000ab51,
+	/* 0x0000ab52 */ 0x0000ab52,
+	/* 0x0000ab53 */ 0x0000ab53,
+	/* 0x0000ab54 */ 0x0000ab54,
+	/* 0x0000ab55 */ 0x0000ab55,
+	/* 0x0000ab56 */ 0x0000ab56,
+	/* 0x0000ab57 */ 0x0000ab57,
+	/* 0x0000ab58 */ 0x0000ab58,
+	/* 0x0000ab59 */ 0x0000ab59,
+	/* 0x0000ab5a */ 0x0000ab5a,
+	/* 0x0000ab5b */ 0x0000ab5b,
+	/* 0x0000ab5c */ 0x0000ab5c,
+	/* 0x0000ab5d */ 0x0000ab5d,
+	/* 0x0000ab5e */ 0x0000ab5e,
+	/* 0x0000ab5f */ 0x0000ab5f,
+	/* 0x0000ab60 */ 0x0000ab60,
+	/* 0x0000ab61 */ 0x0000ab61,
+	/* 0x0000ab62 */ 0x0000ab62,
+	/* 0x0000ab63 */ 0x0000ab63,
+	/* 0x0000ab64 */ 0x0000ab64,
+	/* 0x0000ab65 */ 0x0000ab65,
+	/* 0x0000ab66 */ 0x0000ab66,
+	/* 0x0000ab67 */ 0x0000ab67,
+	/* 0x0000ab68 */ 0x0000ab68,
+	/* 0x0000ab69 */ 0x0000ab69,
+	/* 0x0000ab6a */ 0x0000ab6a,
+	/* 0x0000ab6b */ 0x0000ab6b,
+	/* 0x0000ab6c */ 0x0000ab6c,
+	/* 0x0000ab6d */ 0x0000ab6d,
+	/* 0x0000ab6e */ 0x0000ab6e,
+	/* 0x0000ab6f */ 0x0000ab6f,
+	/* 0x0000ab70 */ 0x000013a0,
+	/* 0x0000ab71 */ 0x000013a1,
+	/* 0x0000ab72 */ 0x000013a2,
+	/* 0x0000ab73 */ 0x000013a3,
+	/* 0x0000ab74 */ 0x000013a4,
+	/* 0x0000ab75 */ 0x000013a5,
+	/* 0x0000ab76 */ 0x000013a6,
+	/* 0x0000ab77 */ 0x000013a7,
+	/* 0x0000ab78 */ 0x000013a8,
+	/* 0x0000ab79 */ 0x000013a9,
+	/* 0x0000ab7a */ 0x000013aa,
+	/* 0x0000ab7b */ 0x000013ab,
+	/* 0x0000ab7c */ 0x000013ac,
+	/* 0x0000ab7d */ 0x000013ad,
+	/* 0x0000ab7e */ 0x000013ae,
+	/* 0x0000ab7f */ 0x000013af,
+	/* 0x0000ab80 */ 0x000013b0,
+	/* 0x0000ab81 */ 0x000013b1,
+	/* 0x0000ab82 */ 0x000013b2,
+	/* 0x0000ab83 */ 0x000013b3,
+	/* 0x0000ab84 */ 0x000013b4,
+	/* 0x0000ab85 */ 0x000013b5,
+	/* 0x0000ab86 */ 0x000013b6,
+	/* 0x0000ab87 */ 0x000013b7,
+	/* 0x0000ab88 */ 0x000013b8,
+	/* 0x0000ab89 */ 0x000013b9,
+	/* 0x0000ab8a */ 0x000013ba,
+	/* 0x0000ab8b */ 0x000013bb,
+	/* 0x0000ab8c */ 0x000013bc,
+	/* 0x0000ab8d */ 0x000013bd,
+	/* 0x0000ab8e */ 0x000013be,
+	/* 0x0000ab8f */ 0x000013bf,
+	/* 0x0000ab90 */ 0x000013c0,
+	/* 0x0000ab91 */ 0x000013c1,
+	/* 0x0000ab92 */ 0x000013c2,
+	/* 0x0000ab93 */ 0x000013c3,
+	/* 0x0000ab94 */ 0x000013c4,
+	/* 0x0000ab95 */ 0x000013c5,
+	/* 0x0000ab96 */ 0x000013c6,
+	/* 0x0000ab97 */ 0x000013c7,
+	/* 0x0000ab98 */ 0x000013c8,
+	/* 0x0000ab99 */ 0x000013c9,
+	/* 0x0000ab9a */ 0x000013ca,
+	/* 0x0000ab9b */ 0x000013cb,
+	/* 0x0000ab9c */ 0x000013cc,
+	/* 0x0000ab9d */ 0x000013cd,
+	/* 0x0000ab9e */ 0x000013ce,
+	/* 0x0000ab9f */ 0x000013cf,
+	/* 0x0000aba0 */ 0x000013d0,
+	/* 0x0000aba1 */ 0x000013d1,
+	/* 0x0000aba2 */ 0x000013d2,
+	/* 0x0000aba3 */ 0x000013d3,
+	/* 0x0000aba4 */ 0x000013d4,
+	/* 0x0000aba5 */ 0x000013d5,
+	/* 0x0000aba6 */ 0x000013d6,
+	/* 0x0000aba7 */ 0x000013d7,
+	/* 0x0000aba8 */ 0x000013d8,
+	/* 0x0000aba9 */ 0x000013d9,
+	/* 0x0000abaa */ 0x000013da,
+	/* 0x0000abab */ 0x000013db,
+	/* 0x0000abac */ 0x000013dc,
+	/* 0x0000abad */ 0x000013dd,
+	/* 0x0000abae */ 0x000013de,
+	/* 0x0000abaf */ 0x000013df,
+	/* 0x0000abb0 */ 0x000013e0,
+	/* 0x0000abb1 */ 0x000013e1,
+	/* 0x0000abb2 */ 0x000013e2,
+	/* 0x0000abb3 */ 0x000013e3,
+	/* 0x0000abb4 */ 0x000013e4,
+	/* 0x0000abb5 */ 0x000013e5,
+	/* 0x0000abb6 */ 0x000013e6,
+	/* 0x0000abb7 */ 0x000013e7,
+	/* 0x0000abb8 */ 0x000013e8,
+	/* 0x0000abb9 */ 0x000013e9,
+	/* 0x0000abba */ 0x000013ea,
+	/* 0x0000abbb */ 0x000013eb,
+	/* 0x0000abbc */ 0x000013ec,
+	/* 0x0000abbd */ 0x000013ed,
+	/* 0x0000abbe */ 0x000013ee,
+	/* 0x0000abbf */ 0x000013ef,
+	/* 0x0000abc0 */ 0x0000abc0,
+	/* 0x0000abc1 */ 0x0000abc1,
+	/* 0x0000abc2 */ 0x0000abc2,
+	/* 0x0000abc3 */ 0x0000abc3,
+	/* 0x0000abc4 */ 0x0000abc4,
+	/* 0x0000abc5 */ 0x0000abc5,
+	/* 0x0000abc6 */ 0x0000abc6,
+	/* 0x0000abc7 */ 0x0000abc7,
+	/* 0x0000abc8 */ 0x0000abc8,
+	/* 0x0000abc9 */ 0x0000abc9,
+	/* 0x0000abca */ 0x0000abca,
+	/* 0x0000abcb */ 0x0000abcb,
+	/* 0x0000abcc */ 0x0000abcc,
+	/* 0x0000abcd */ 0x0000abcd,
+	/* 0x0000abce */ 0x0000abce,
+	/* 0x0000abcf */ 0x0000abcf,
+	/* 0x0000abd0 */ 0x0000abd0,
+	/* 0x0000abd1 */ 0x0000abd1,
+	/* 0x0000abd2 */ 0x0000abd2,
+	/* 0x0000abd3 */ 0x0000abd3,
+	/* 0x0000abd4 */ 0x0000abd4,
+	/* 0x0000abd5 */ 0x0000abd5,
+	/* 0x0000abd6 */ 0x0000abd6,
+	/* 0x0000abd7 */ 0x0000abd7,
+	/* 0x0000abd8 */ 0x0000abd8,
+	/* 0x0000abd9 */ 0x0000abd9,
+	/* 0x0000abda */ 0x0000abda,
+	/* 0x0000abdb */ 0x0000abdb,
+	/* 0x0000abdc */ 0x0000abdc,
+	/* 0x0000abdd */ 0x0000abdd,
+	/* 0x0000abde */ 0x0000abde,
+	/* 0x0000abdf */ 0x0000abdf,
+	/* 0x0000abe0 */ 0x0000abe0,
+	/* 0x0000abe1 */ 0x0000abe1,
+	/* 0x0000abe2 */ 0x0000abe2,
+	/* 0x0000abe3 */ 0x0000abe3,
+	/* 0x0000abe4 */ 0x0000abe4,
+	/* 0x0000abe5 */ 0x0000abe5,
+	/* 0x0000abe6 */ 0x0000abe6,
+	/* 0x0000abe7 */ 0x0000abe7,
+	/* 0x0000abe8 */ 0x0000abe8,
+	/* 0x0000abe9 */ 0x0000abe9,
+	/* 0x0000abea */ 0x0000abea,
+	/* 0x0000abeb */ 0x0000abeb,
+	/* 0x0000abec */ 0x0000abec,
+	/* 0x0000abed */ 0x0000abed,
+	/* 0x0000abee */ 0x0000abee,
+	/* 0x0000abef */ 0x0000abef,
+	/* 0x0000abf0 */ 0x0000abf0,
+	/* 0x0000abf1 */ 0x0000abf1,
+	/* 0x0000abf2 */ 0x0000abf2,
+	/* 0x0000abf3 */ 0x0000abf3,
+	/* 0x0000abf4 */ 0x0000abf4,
+	/* 0x0000abf5 */ 0x0000abf5,
+	/* 0x0000abf6 */ 0x0000abf6,
+	/* 0x0000abf7 */ 0x0000abf7,
+	/* 0x0000abf8 */ 0x0000abf8,
+	/* 0x0000abf9 */ 0x0000abf9,
+	/* 0x0000abfa */ 0x0000abfa,
+	/* 0x0000abfb */ 0x0000abfb,
+	/* 0x0000abfc */ 0x0000abfc,
+	/* 0x0000abfd */ 0x0000abfd,
+	/* 0x0000abfe */ 0x0000abfe,
+	/* 0x0000abff */ 0x0000abff
+};
+
+static uint32_t libfshfs_name_case_folding_mappings_0x0000ff00[ 256 ] = {
+	/* 0x0000ff00 */ 0x0000ff00,
+	/* 0x0000ff01 */ 0x0000ff01,
+	/* 0x0000ff02 */ 0x0000ff02,
+	/* 0x0000ff03 */ 0x0000ff03,
+	/* 0x0000ff04 */ 0x0000ff04,
+	/* 0x0000ff05 */ 0x0000ff05,
+	/* 0x0000ff06 */ 0x0000ff06,
+	/* 0x0000ff07 */ 0x0000ff07,
+	/* 0x0000ff08 */ 0x0000ff08,
+	/* 0x0000ff09 */ 0x0000ff09,
+	/* 0x0000ff0a */ 0x0000ff0a,
+	/* 0x0000ff0b */ 0x0000ff0b,
+	/* 0x0000ff0c */ 0x0000ff0c,
+	/* 0x0000ff0d */ 0x0000ff0d,
+	/* 0x0000ff0e */ 0x0000ff0e,
+	/* 0x0000ff0f */ 0x0000ff0f,
+	/* 0x0000ff10 */ 0x0000ff10,
+	/* 0x0000ff11 */ 0x0000ff11,
+	/* 0x0000ff12 */ 0x0000ff12,
+	/* 0x0000ff13 */ 0x0000ff13,
+	/* 0x0000ff14 */ 0x0000ff14,
+	/* 0x0000ff15 */ 0x0000ff15,
+	/* 0x0000ff16 */ 0x0000ff16,
+	/* 0x0000ff17 */ 0x0000ff17,
+	/* 0x0000ff18 */ 0x0000ff18,
+	/* 0x0000ff19 */ 0x0000ff19,
+	/* 0x0000ff1a */ 0x0000ff1a,
+	/* 0x0000ff1b */ 0x0000ff1b,
+	/* 0x0000ff1c */ 0x0000ff1c,
+	/* 0x0000ff1d */ 0x0000ff1d,
+	/* 0x0000ff1e */ 0x0000ff1e,
+	/* 0x0000ff1f */ 0x0000ff1f,
+	/* 0x0000ff20 */ 0x0000ff20,
+	/* 0x0000ff21 */ 0x0000ff41,
+	/* 0x0000ff22 */ 0x0000ff42,
+	/* 0x0000ff23 */ 0x0000ff43,
+	/* 0x0000ff24 */ 0x0000ff44,
+	/* 0x0000ff25 */ 0x0000ff45,
+	/* 0x0000ff26 */ 0x0000ff46,
+	/* 0x0000ff27 */ 0x0000ff47,
+	/* 0x0000ff28 */ 0x0000ff48,
+	/* 0x0000ff29 */ 0x0000ff49,
+	/* 0x0000ff2a */ 0x0000ff4a,
+	/* 0x0000ff2b */ 0x0000ff4b,
+	/* 0x0000ff2c */ 0x0000ff4c,
+	/* 0x0000ff2d */ 0x0000ff4d,
+	/* 0x0000ff2e */ 0x0000ff4e,
+	/* 0x0000ff2f */ 0x0000ff4f,
+	/* 0x0000ff30 */ 0x0000ff50,
+	/* 0x0000ff31 */ 0x0000ff51,
+	/* 0x0000ff32 */ 0x0000ff52,
+	/* 0x0000ff33 */ 0x0000ff53,
+	/* 0x0000ff34 */ 0x0000ff54,
+	/* 0x0000ff35 */ 0x0000ff55,
+	/* 0x0000ff36 */ 0x0000ff56,
+	/* 0x0000ff37 */ 0x0000ff57,
+	/* 0x0000ff38 */ 0x0000ff58,
+	/* 0x0000ff39 */ 0x0000ff59,
+	/* 0x0000ff3a */ 0x0000ff5a,
+	/* 0x0000ff3b */ 0x0000ff3b,
+	/* 0x0000ff3c */ 0x0000ff3c,
+	/* 0x0000ff3d */ 0x0000ff3d,
+	/* 0x0000ff3e */ 0x0000ff3e,
+	/* 0x0000ff3f */ 0x0000ff3f,
+	/* 0x0000ff40 */ 0x0000ff40,
+	/* 0x0000ff41 */ 0x0000ff41,
+	/* 0x0000ff42 */ 0x0000ff42,
+	/* 0x0000ff43 */ 0x0000ff43,
+	/* 0x0000ff44 */ 0x0000ff44,
+	/* 0x0000ff45 */ 0x0000ff45,
+	/* 0x0000ff46 */ 0x0000ff46,
+	/* 0x0000ff47 */ 0x0000ff47,
+	/* 0x0000ff48 */ 0x0000ff48,
+	/* 0x0000ff49 */ 0x0000ff49,
+	/* 0x0000ff4a */ 0x0000ff4a,
+	/* 0x0000ff4b */ 0x0000ff4b,
+	/* 0x0000ff4c */ 0x0000ff4c,
+	/* 0x0000ff4d */ 0x0000ff4d,
+	/* 0x0000ff4e */ 0x0000ff4e,
+	/* 0x0000ff4f */ 0x0000ff4f,
+	/* 0x0000ff50 */ 0x0000ff50,
+	/* 0x0000ff51 */ 0x0000ff51,
+	/* 0x0000ff52 */ 0x0000ff52,
+	/* 0x0000ff53 */ 0x0000ff53,
+	/* 0x0000ff54 */ 0x0000ff54,
+	/* 0x0000ff55 */ 0x0000ff55,
+	/* 0x0000ff56 */ 0x0000ff56,
+	/* 0x0000ff57 */ 0x0000ff57,
+	/* 0x0000ff58 */ 0x0000ff58,
+	/* 0x0000ff59 */ 0x0000ff59,
+	/* 0x0000ff5a */ 0x0000ff5a,
+	/* 0x0000ff5b */ 0x0000ff5b,
+	/* 0x0000ff5c */ 0x0000ff5c,
+	/* 0x0000ff5d */ 0x0000ff5d,
+	/* 0x0000ff5e */ 0x0000ff5e,
+	/* 0x0000ff5f */ 0x0000ff5f,
+	/* 0x0000ff60 */ 0x0000ff60,
+	/* 0x0000ff61 */ 0x0000ff61,
+	/* 0x0000ff62 */ 0x0000ff62,
+	/* 0x0000ff63 */ 0x0000ff63,
+	/* 0x0000ff64 */ 0x0000ff64,
+	/* 0x0000ff65 */ 0x0000ff65,
+	/* 0x0000ff66 */ 0x0000ff66,
+	/* 0x0000ff67 */ 0x0000ff67,
+	/* 0x0000ff68 */ 0x0000ff68,
+	/* 0x0000ff69 */ 0x0000ff69,
+	/* 0x0000ff6a */ 0x0000ff6a,
+	/* 0x0000ff6b */ 0x0000ff6b,
+	/* 0x0000ff6c */ 0x0000ff6c,
+	/* 0x0000ff6d */ 0x0000ff6d,
+	/* 0x0000ff6e */ 0x0000ff6e,
+	/* 0x0000ff6f */ 0x0000ff6f,
+	/* 0x0000ff70 */ 0x0000ff70,
+	/* 0x0000ff71 */ 0x0000ff71,
+	/* 0x0000ff72 */ 0x0000ff72,
+	/* 0x0000ff73 */ 0x0000ff73,
+	/* 0x0000ff74 */ 0x0000ff74,
+	/* 0x0000ff75 */ 0x0000ff75,
+	/* 0x0000ff76 */ 0x0000ff76,
+	/* 0x0000ff77 */ 0x0000ff77,
+	/* 0x0000ff78 */ 0x0000ff78,
+	/* 0x0000ff79 */ 0x0000ff79,
+	/* 0x0000ff7a */ 0x0000ff7a,
+	/* 0x0000ff7b */ 0x0000ff7b,
+	/* 0x0000ff7c */ 0x0000ff7c,
+	/* 0x0000ff7d */ 0x0000ff7d,
+	/* 0x0000ff7e */ 0x0000ff7e,
+	/* 0x0000ff7f */ 0x0000ff7f,
+	/* 0x0000ff80 */ 0x0000ff80,
+	/* 0x0000ff81 */ 0x0000ff81,
+	/* 0x0000ff82 */ 0x0000ff82,
+	/* 0x0000ff83 */ 0x0000ff83,
+	/* 0x0000ff84 */ 0x0000ff84,
+	/* 0x0000ff85 */ 0x0000ff85,
+	/* 0x0000ff86 */ 0x0000ff86,
+	/* 0x0000ff87 */ 0x0000ff87,
+	/* 0x0000ff88 */ 0x0000ff88,
+	/* 0x0000ff89 */ 0x0000ff89,
+	/* 0x0000ff8a */ 0x0000ff8a,
+	/* 0x0000ff8b */ 0x0000ff8b,
+	/* 0x0000ff8c */ 0x0000ff8c,
+	/* 0x0000ff8d */ 0x0000ff8d,
+	/* 0x0000ff8e */ 0x0000ff8e,
+	/* 0x0000ff8f */ 0x0000ff8f,
+	/* 0x0000ff90 */ 0x0000ff90,
+	/* 0x0000ff91 */ 0x0000ff91,
+	/* 0x0000ff92 */ 0x0000ff92,
+	/* 0x0000ff93 */ 0x0000ff93,
+	/* 0x0000ff94 */ 0x0000ff94,
+	/* 0x0000ff95 */ 0x0000ff95,
+	/* 0x0000ff96 */ 0x0000ff96,
+	/* 0x0000ff97 */ 0x0000ff97,
+	/* 0x0000ff98 */ 0x0000ff98,
+	/* 0x0000ff99 */ 0x0000ff99,
+	/* 0x0000ff9a */ 0x0000ff9a,
+	/* 0x0000ff9b */ 0x0000ff9b,
+	/* 0x0000ff9c */ 0x0000ff9c,
+	/* 0x0000ff9d */ 0x0000ff9d,
+	/* 0x0000ff9e */ 0x0000ff9e,
+	/* 0x0000ff9f */ 0x0000ff9f,
+	/* 0x0000ffa0 */ 0x0000ffa0,
+	/* 0x0000ffa1 */ 0x0000ffa1,
+	/* 0x0000ffa2 */ 0x0000ffa2,
+	/* 0x0000ffa3 */ 0x0000ffa3,
+	/* 0x0000ffa4 */ 0x0000ffa4,
+	/* 0x0000ffa5 */ 0x0000ffa5,
+	/* 0x0000ffa6 */ 0x0000ffa6,
+	/* 0x0000ffa7 */ 0x0000ffa7,
+	/* 0x0000ffa8 */ 0x0000ffa8,
+	/* 0x0000ffa9 */ 0x0000ffa9,
+	/* 0x0000ffaa */ 0x0000ffaa,
+	/* 0x0000ffab */ 0x0000ffab,
+	/* 0x0000ffac */ 0x0000ffac,
+	/* 0x0000ffad */ 0x0000ffad,
+	/* 0x0000ffae */ 0x0000ffae,
+	/* 0x0000ffaf */ 0x0000ffaf,
+	/* 0x0000ffb0 */ 0x0000ffb0,
+	/* 0x0000ffb1 */ 0x0000ffb1,
+	/* 0x0000ffb2 */ 0x0000ffb2,
+	/* 0x0000ffb3 */ 0x0000ffb3,
+	/* 0x0000ffb4 */ 0x0000ffb4,
+	/* 0x0000ffb5 */ 0x0000ffb5,
+	/* 0x0000ffb6 */ 0x0000ffb6,
+	/* 0x0000ffb7 */ 0x0000ffb7,
+	/* 0x0000ffb8 */ 0x0000ffb8,
+	/* 0x0000ffb9 */ 0x0000ffb9,
+	/* 0x0000ffba */ 0x0000ffba,
+	/* 0x0000ffbb */ 0x0000ffbb,
+	/* 0x0000ffbc */ 0x0000ffbc,
+	/* 0x0000ffbd */ 0x0000ffbd,
+	/* 0x0000ffbe */ 0x0000ffbe,
+	/* 0x0000ffbf */ 0x0000ffbf,
+	/* 0x0000ffc0 */ 0x0000ffc0,
+	/* 0x0000ffc1 */ 0x0000ffc1,
+	/* 0x0000ffc2 */ 0x0000ffc2,
+	/* 0x0000ffc3 */ 0x0000ffc3,
+	/* 0x0000ffc4 */ 0x0000ffc4,
+	/* 0x0000ffc5 */ 0x0000ffc5,
+	/* 0x0000ffc6 */ 0x0000ffc6,
+	/* 0x0000ffc7 */ 0x0000ffc7,
+	/* 0x0000ffc8 */ 0x0000ffc8,
+	/* 0x0000ffc9 */ 0x0000ffc9,
+	/* 0x0000ffca */ 0x0000ffca,
+	/* 0x0000ffcb */ 0x0000ffcb,
+	/* 0x0000ffcc */ 0x0000ffcc,
+	/* 0x0000ffcd */ 0x0000ffcd,
+	/* 0x0000ffce */ 0x0000ffce,
+	/* 0x0000ffcf */ 0x0000ffcf,
+	/* 0x0000ffd0 */ 0x0000ffd0,
+	/* 0x0000ffd1 */ 0x0000ffd1,
+	/* 0x0000ffd2 */ 0x0000ffd2,
+	/* 0x0000ffd3 */ 0x0000ffd3,
+	/* 0x0000ffd4 */ 0x0000ffd4,
+	/* 0x0000ffd5 */ 0x0000ffd5,
+	/* 0x0000ffd6 */ 0x0000ffd6,
+	/* 0x0000ffd7 */ 0x0000ffd7,
+	/* 0x0000ffd8 */ 0x0000ffd8,
+	/* 0x0000ffd9 */ 0x0000ffd9,
+	/* 0x0000ffda */ 0x0000ffda,
+	/* 0x0000ffdb */ 0x0000ffdb,
+	/* 0x0000ffdc */ 0x0000ffdc,
+	/* 0x0000ffdd */ 0x0000ffdd,
+	/* 0x0000ffde */ 0x0000ffde,
+	/* 0x0000ffdf */ 0x0000ffdf,
+	/* 0x0000ffe0 */ 0x0000ffe0,
+	/* 0x0000ffe1 */ 0x0000ffe1,
+	/* 0x0000ffe2 */ 0x0000ffe2,
+	/* 0x0000ffe3 */ 0x0000ffe3,
+	/* 0x0000ffe4 */ 0x0000ffe4,
+	/* 0x0000ffe5 */ 0x0000ffe5,
+	/* 0x0000ffe6 */ 0x0000ffe6,
+	/* 0x0000ffe7 */ 0x0000ffe7,
+	/* 0x0000ffe8 */ 0x0000ffe8,
+	/* 0x0000ffe9 */ 0x0000ffe9,
+	/* 0x0000ffea */ 0x0000ffea,
+	/* 0x0000ffeb */ 0x0000ffeb,
+	/* 0x0000ffec */ 0x0000ffec,
+	/* 0x0000ffed */ 0x0000ffed,
+	/* 0x0000ffee */ 0x0000ffee,
+	/* 0x0000ffef */ 0x0000ffef,
+	/* 0x0000fff0 */ 0x0000fff0,
+	/* 0x0000fff1 */ 0x0000fff1,
+	/* 0x0000fff2 */ 0x0000fff2,
+	/* 0x0000fff3 */ 0x0000fff3,
+	/* 0x0000fff4 */ 0x0000fff4,
+	/* 0x0000fff5 */ 0x0000fff5,
+	/* 0x0000fff6 */ 0x0000fff6,
+	/* 0x0000fff7 */ 0x0000fff7,
+	/* 0x0000fff8 */ 0x0000fff8,
+	/* 0x0000fff9 */ 0x0000fff9,
+	/* 0x0000fffa */ 0x0000fffa,
+	/* 0x0000fffb */ 0x0000fffb,
+	/* 0x0000fffc */ 0x0000fffc,
+	/* 0x0000fffd */ 0x0000fffd,
+	/* 0x0000fffe */ 0x0000fffe,
+	/* 0x0000ffff */ 0x0000ffff
+};
+
+static uint32_t libfshfs_name_case_folding_mappings_0x00010400[ 256 ] = {
+	/* 0x00010400 */ 0x00010428,
+	/* 0x00010401 */ 0x00010429,
+	/* 0x00010402 */ 0x0001042a,
+	/* 0x00010403 */ 0x0001042b,
+	/* 0x00010404 */ 0x0001042c,
+	/* 0x00010405 */ 0x0001042d,
+	/* 0x00010406 */ 0x0001042e,
+	/* 0x00010407 */ 0x0001042f,
+	/* 0x00010408 */ 0x00010430,
+	/* 0x00010409 */ 0x00010431,
+	/* 0x0001040a */ 0x00010432,
+	/* 0x0001040b */ 0x00010433,
+	/* 0x0001040c */ 0x00010434,
+	/* 0x0001040d */ 0x00010435,
+	/* 0x0001040e */ 0x00010436,
+	/* 0x0001040f */ 0x00010437,
+	/* 0x00010410 */ 0x00010438,
+	/* 0x00010411 */ 0x00010439,
+	/* 0x00010412 */ 0x0001043a,
+	/* 0x00010413 */ 0x0001043b,
+	/* 0x00010414 */ 0x0001043c,
+	/* 0x00010415 */ 0x0001043d,
+	/* 0x00010416 */ 0x0001043e,
+	/* 0x00010417 */ 0x0001043f,
+	/* 0x00010418 */ 0x00010440,
+	/* 0x00010419 */ 0x00010441,
+	/* 0x0001041a */ 0x00010442,
+	/* 0x0001041b */ 0x00010443,
+	/* 0x0001041c */ 0x00010444,
+	/* 0x0001041d */ 0x00010445,
+	/* 0x0001041e */ 0x00010446,
+	/* 0x0001041f */ 0x00010447,
+	/* 0x00010420 */ 0x00010448,
+	/* 0x00010421 */ 0x00010449,
+	/* 0x00010422 */ 0x0001044a,
+	/* 0x00010423 */ 0x0001044b,
+	/* 0x00010424 */ 0x0001044c,
+	/* 0x00010425 */ 0x0001044d,
+	/* 0x00010426 */ 0x0001044e,
+	/* 0x00010427 */ 0x0001044f,
+	/* 0x00010428 */ 0x00010428,
+	/* 0x00010429 */ 0x00010429,
+	/* 0x0001042a */ 0x0001042a,
+	/* 0x0001042b */ 0x0001042b,
+	/* 0x0001042c */ 0x0001042c,
+	/* 0x0001042d */ 0x0001042d,
+	/* 0x0001042e */ 0x0001042e,
+	/* 0x0001042f */ 0x0001042f,
+	/* 0x00010430 */ 0x00010430,
+	/* 0x00010431 */ 0x00010431,
+	/* 0x00010432 */ 0x00010432,
+	/* 0x00010433 */ 0x00010433,
+	/* 0x00010434 */ 0x00010434,
+	/* 0x00010435 */ 0x00010435,
+	/* 0x00010436 */ 0x00010436,
+	/* 0x00010437 */ 0x00010437,
+	/* 0x00010438 */ 0x00010438,
+	/* 0x00010439 */ 0x00010439,
+	/* 0x0001043a */ 0x0001043a,
+	/* 0x0001043b */ 0x0001043b,
+	/* 0x0001043c */ 0x0001043c,
+	/* 0x0001043d */ 0x0001043d,
+	/* 0x0001043e */ 0x0001043e,
+	/* 0x0001043f */ 0x0001043f,
+	/* 0x00010440 */ 0x00010440,
+	/* 0x00010441 */ 0x00010441,
+	/* 0x00010442 */ 0x00010442,
+	/* 0x00010443 */ 0x00010443,
+	/* 0x00010444 */ 0x00010444,
+	/* 0x00010445 */ 0x00010445,
+	/* 0x00010446 */ 0x00010446,
+	/* 0x00010447 */ 0x00010447,
+	/* 0x00010448 */ 0x00010448,
+	/* 0x00010449 */ 0x00010449,
+	/* 0x0001044a */ 0x0001044a,
+	/* 0x0001044b */ 0x0001044b,
+	/* 0x0001044c */ 0x0001044c,
+	/* 0x0001044d */ 0x0001044d,
+	/* 0x0001044e */ 0x0001044e,
+	/* 0x0001044f */ 0x0001044f,
+	/* 0x00010450 */ 0x00010450,
+	/* 0x00010451 */ 0x00010451,
+	/* 0x00010452 */ 0x00010452,
+	/* 0x00010453 */ 0x00010453,
+	/* 0x00010454 */ 0x00010454,
+	/* 0x00010455 */ 0x00010455,
+	/* 0x00010456 */ 0x00010456,
+	/* 0x00010457 */ 0x00010457,
+	/* 0x00010458 */ 0x00010458,
+	/* 0x00010459 */ 0x00010459,
+	/* 0x0001045a */ 0x0001045a,
+	/* 0x0001045b */ 0x0001045b,
+	/* 0x0001045c */ 0x0001045c,
+	/* 0x0001045d */ 0x0001045d,
+	/* 0x0001045e */ 0x0001045e,
+	/* 0x0001045f */ 0x0001045f,
+	/* 0x00010460 */ 0x00010460,
+	/* 0x00010461 */ 0x00010461,
+	/* 0x00010462 */ 0x00010462,
+	/* 0x00010463 */ 0x00010463,
+	/* 0x00010464 */ 0x00010464,
+	/* 0x00010465 */ 0x00010465,
+	/* 0x00010466 */ 0x00010466,
+	/* 0x00010467 */ 0x00010467,
+	/* 0x00010468 */ 0x00010468,
+	/* 0x00010469 */ 0x00010469,
+	/* 0x0001046a */ 0x0001046a,
+	/* 0x0001046b */ 0x0001046b,
+	/* 0x0001046c */ 0x0001046c,
+	/* 0x0001046d */ 0x0001046d,
+	/* 0x0001046e */ 0x0001046e,
+	/* 0x0001046f */ 0x0001046f,
+	/* 0x00010470 */ 0x00010470,
+	/* 0x00010471 */ 0x00010471,
+	/* 0x00010472 */ 0x00010472,
+	/* 0x00010473 */ 0x00010473,
+	/* 0x00010474 */ 0x00010474,
+	/* 0x00010475 */ 0x00010475,
+	/* 0x00010476 */ 0x00010476,
+	/* 0x00010477 */ 0x00010477,
+	/* 0x00010478 */ 0x00010478,
+	/* 0x00010479 */ 0x00010479,
+	/* 0x0001047a */ 0x0001047a,
+	/* 0x0001047b */ 0x0001047b,
+	/* 0x0001047c */ 0x0001047c,
+	/* 0x0001047d */ 0x0001047d,
+	/* 0x0001047e */ 0x0001047e,
+	/* 0x0001047f */ 0x0001047f,
+	/* 0x00010480 */ 0x00010480,
+	/* 0x00010481 */ 0x00010481,
+	/* 0x00010482 */ 0x00010482,
+	/* 0x00010483 */ 0x00010483,
+	/* 0x00010484 */ 0x00010484,
+	/* 0x00010485 */ 0x00010485,
+	/* 0x00010486 */ 0x00010486,
+	/* 0x00010487 */ 0x00010487,
+	/* 0x00010488 */ 0x00010488,
+	/* 0x00010489 */ 0x00010489,
+	/* 0x0001048a */ 0x0001048a,
+	/* 0x0001048b */ 0x0001048b,
+	/* 0x0001048c */ 0x0001048c,
+	/* 0x0001048d */ 0x0001048d,
+	/* 0x0001048e */ 0x0001048e,
+	/* 0x0001048f */ 0x0001048f,
+	/* 0x00010490 */ 0x00010490,
+	/* 0x00010491 */ 0x00010491,
+	/* 0x00010492 */ 0x00010492,
+	/* 0x00010493 */ 0x00010493,
+	/* 0x00010494 */ 0x00010494,
+	/* 0x00010495 */ 0x00010495,
+	/* 0x00010496 */ 0x00010496,
+	/* 0x00010497 */ 0x00010497,
+	/* 0x00010498 */ 0x00010498,
+	/* 0x00010499 */ 0x00010499,
+	/* 0x0001049a */ 0x0001049a,
+	/* 0x0001049b */ 0x0001049b,
+	/* 0x0001049c */ 0x0001049c,
+	/* 0x0001049d */ 0x0001049d,
+	/* 0x0001049e */ 0x0001049e,
+	/* 0x0001049f */ 0x0001049f,
+	/* 0x000104a0 */ 0x000104a0,
+	/* 0x000104a1 */ 0x000104a1,
+	/* 0x000104a2 */ 0x000104a2,
+	/* 0x000104a3 */ 0x000104a3,
+	/* 0x000104a4 */ 0x000104a4,
+	/* 0x000104a5 */ 0x000104a5,
+	/* 0x000104a6 */ 0x000104a6,
+	/* 0x000104a7 */ 0x000104a7,
+	/* 0x000104a8 */ 0x000104a8,
+	/* 0x000104a9 */ 0x000104a9,
+	/* 0x000104aa */ 0x000104aa,
+	/* 0x000104ab */ 0x000104ab,
+	/* 0x000104ac */ 0x000104ac,
+	/* 0x000104ad */ 0x000104ad,
+	/* 0x000104ae */ 0x000104ae,
+	/* 0x000104af */ 0x000104af,
+	/* 0x000104b0 */ 0x000104d8,
+	/* 0x000104b1 */ 0x000104d9,
+	/* 0x000104b2 */ 0x000104da,
+	/* 0x000104b3 */ 0x000104db,
+	/* 0x000104b4 */ 0x000104dc,
+	/* 0x000104b5 */ 0x000104dd,
+	/* 0x000104b6 */ 0x000104de,
+	/* 0x000104b7 */ 0x000104df,
+	/* 0x000104b8 */ 0x000104e0,
+	/* 0x000104b9 */ 0x000104e1,
+	/* 0x000104ba */ 0x000104e2,
+	/* 0x000104bb */ 0x000104e3,
+	/* 0x000104bc */ 0x000104e4,
+	/* 0x000104bd */ 0x000104e5,
+	/* 0x000104be */ 0x000104e6,
+	/* 0x000104bf */ 0x000104e7,
+	/* 0x000104c0 */ 0x000104e8,
+	/* 0x000104c1 */ 0x000104e9,
+	/* 0x000104c2 */ 0x000104ea,
+	/* 0x000104c3 */ 0x000104eb,
+	/* 0x000104c4 */ 0x000104ec,
+	/* 0x000104c5 */ 0x000104ed,
+	/* 0x000104c6 */ 0x000104ee,
+	/* 0x000104c7 */ 0x000104ef,
+	/* 0x000104c8 */ 0x000104f0,
+	/* 0x000104c9 */ 0x000104f1,
+	/* 0x000104ca */ 0x000104f2,
+	/* 0x000104cb */ 0x000104f3,
+	/* 0x000104cc */ 0x000104f4,
+	/* 0x000104cd */ 0x000104f5,
+	/* 0x000104ce */ 0x000104f6,
+	/* 0x000104cf */ 0x000104f7,
+	/* 0x000104d0 */ 0x000104f8,
+	/* 0x000104d1 */ 0x000104f9,
+	/* 0x000104d2 */ 0x000104fa,
+	/* 0x000104d3 */ 0x000104fb,
+	/* 0x000104d4 */ 0x000104d4,
+	/* 0x000104d5 */ 0x000104d5,
+	/* 0x000104d6 */ 0x000104d6,
+	/* 0x000104d7 */ 0x000104d7,
+	/* 0x000104d8 */ 0x000104d8,
+	/* 0x000104d9 */ 0x000104d9,
+	/* 0x000104da */ 0x000104da,
+	/* 0x000104db */ 0x000104db,
+	/* 0x000104dc */ 0x000104dc,
+	/* 0x000104dd */ 0x000104dd,
+	/* 0x000104de */ 0x000104de,
+	/* 0x000104df */ 0x000104df,
+	/* 0x000104e0 */ 0x000104e0,
+	/* 0x000104e1 */ 0x000104e1,
+	/* 0x000104e2 */ 0x000104e2,
+	/* 0x000104e3 */ 0x000104e3,
+	/* 0x000104e4 */ 0x000104e4,
+	/* 0x000104e5 */ 0x000104e5,
+	/* 0x000104e6 */ 0x000104e6,
+	/* 0x000104e7 */ 0x000104e7,
+	/* 0x000104e8 */ 0x000104e8,
+	/* 0x000104e9 */ 0x000104e9,
+	/* 0x000104ea */ 0x000104ea,
+	/* 0x000104eb */ 0x000104eb,
+	/* 0x000104ec */ 0x000104ec,
+	/* 0x000104ed */ 0x000104ed,
+	/* 0x000104ee */ 0x000104ee,
+	/* 0x000104ef */ 0x000104ef,
+	/* 0x000104f0 */ 0x000104f0,
+	/* 0x000104f1 */ 0x000104f1,
+	/* 0x000104f2 */ 0x000104f2,
+	/* 0x000104f3 */ 0x000104f3,
+	/* 0x000104f4 */ 0x000104f4,
+	/* 0x000104f5 */ 0x000104f5,
+	/* 0x000104f6 */ 0x000104f6,
+	/* 0x000104f7 */ 0x000104f7,
+	/* 0x000104f8 */ 0x000104f8,
+	/* 0x000104f9 */ 0x000104f9,
+	/* 0x000104fa */ 0x000104fa,
+	/* 0x000104fb */ 0x000104fb,
+	/* 0x000104fc */ 0x000104fc,
+	/* 0x000104fd */ 0x000104fd,
+	/* 0x000104fe */ 0x000104fe,
+	/* 0x000104ff */ 0x000104ff
+};
+
+static uint32_t libfshfs_name_case_folding_mappings_0x00010c00[ 256 ] = {
+	/* 0x00010c00 */ 0x00010c00,
+	/* 0x00010c01 */ 0x00010c01,
+	/* 0x00010c02 */ 0x00010c02,
+	/* 0x00010c03 */ 0x00010c03,
+	/* 0x00010c04 */ 0x00010c04,
+	/* 0x00010c05 */ 0x00010c05,
+	/* 0x00010c06 */ 0x00010c06,
+	/* 0x00010c07 */ 0x00010c07,
+	/* 0x00010c08 */ 0x00010c08,
+	/* 0x00010c09 */ 0x00010c09,
+	/* 0x00010c0a */ 0x00010c0a,
+	/* 0x00010c0b */ 0x00010c0b,
+	/* 0x00010c0c */ 0x00010c0c,
+	/* 0x00010c0d */ 0x00010c0d,
+	/* 0x00010c0e */ 0x00010c0e,
+	/* 0x00010c0f */ 0x00010c0f,
+	/* 0x00010c10 */ 0x00010c10,
+	/* 0x00010c11 */ 0x00010c11,
+	/* 0x00010c12 */ 0x00010c12,
+	/* 0x00010c13 */ 0x00010c13,
+	/* 0x00010c14 */ 0x00010c14,
+	/* 0x00010c15 */ 0x00010c15,
+	/* 0x00010c16 */ 0x00010c16,
+	/* 0x00010c17 */ 0x00010c17,
+	/* 0x00010c18 */ 0x00010c18,
+	/* 0x00010c19 */ 0x00010c19,
+	/* 0x00010c1a */ 0x00010c1a,
+	/* 0x00010c1b */ 0x00010c1b,
+	/* 0x00010c1c */ 0x00010c1c,
+	/* 0x00010c1d */ 0x00010c1d,
+	/* 0x00010c1e */ 0x00010c1e,
+	/* 0x00010c1f */ 0x00010c1f,
+	/* 0x00010c20 */ 0x00010c20,
+	/* 0x00010c21 */ 0x00010c21,
+	/* 0x00010c22 */ 0x00010c22,
+	/* 0x00010c23 */ 0x00010c23,
+	/* 0x00010c24 */ 0x00010c24,
+	/* 0x00010c25 */ 0x00010c25,
+	/* 0x00010c26 */ 0x00010c26,
+	/* 0x00010c27 */ 0x00010c27,
+	/* 0x00010c28 */ 0x00010c28,
+	/* 0x00010c29 */ 0x00010c29,
+	/* 0x00010c2a */ 0x00010c2a,
+	/* 0x00010c2b */ 0x00010c2b,
+	/* 0x00010c2c */ 0x00010c2c,
+	/* 0x00010c2d */ 0x00010c2d,
+	/* 0x00010c2e */ 0x00010c2e,
+	/* 0x00010c2f */ 0x00010c2f,
+	/* 0x00010c30 */ 0x00010c30,
+	/* 0x00010c31 */ 0x00010c31,
+	/* 0x00010c32 */ 0x00010c32,
+	/* 0x00010c33 */ 0x00010c33,
+	/* 0x00010c34 */ 0x00010c34,
+	/* 0x00010c35 */ 0x00010c35,
+	/* 0x00010c36 */ 0x00010c36,
+	/* 0x00010c37 */ 0x00010c37,
+	/* 0x00010c38 */ 0x00010c38,
+	/* 0x00010c39 */ 0x00010c39,
+	/* 0x00010c3a */ 0x00010c3a,
+	/* 0x00010c3b */ 0x00010c3b,
+	/* 0x00010c3c */ 0x00010c3c,
+	/* 0x00010c3d */ 0x00010c3d,
+	/* 0x00010c3e */ 0x00010c3e,
+	/* 0x00010c3f */ 0x00010c3f,
+	/* 0x00010c40 */ 0x00010c40,
+	/* 0x00010c41 */ 0x00010c41,
+	/* 0x00010c42 */ 0x00010c42,
+	/* 0x00010c43 */ 0x00010c43,
+	/* 0x00010c44 */ 0x00010c44,
+	/* 0x00010c45 */ 0x00010c45,
+	/* 0x00010c46 */ 0x00010c46,
+	/* 0x00010c47 */ 0x00010c47,
+	/* 0x00010c48 */ 0x00010c48,
+	/* 0x00010c49 */ 0x00010c49,
+	/* 0x00010c4a */ 0x00010c4a,
+	/* 0x00010c4b */ 0x00010c4b,
+	/* 0x00010c4c */ 0x00010c4c,
+	/* 0x00010c4d */ 0x00010c4d,
+	/* 0x00010c4e */ 0x00010c4e,
+	/* 0x00010c4f */ 0x00010c4f,
+	/* 0x00010c50 */ 0x00010c50,
+	/* 0x00010c51 */ 0x00010c51,
+	/* 0x00010c52 */ 0x00010c52,
+	/* 0x00010c53 */ 0x00010c53,
+	/* 0x00010c54 */ 0x00010c54,
+	/* 0x00010c55 */ 0x00010c55,
+	/* 0x00010c56 */ 0x00010c56,
+	/* 0x00010c57 */ 0x00010c57,
+	/* 0x00010c58 */ 0x00010c58,
+	/* 0x00010c59 */ 0x00010c59,
+	/* 0x00010c5a */ 0x00010c5a,
+	/* 0x00010c5b */ 0x00010c5b,
+	/* 0x00010c5c */ 0x00010c5c,
+	/* 0x00010c5d */ 0x00010c5d,
+	/* 0x00010c5e */ 0x00010c5e,
+	/* 0x00010c5f */ 0x00010c5f,
+	/* 0x00010c60 */ 0x00010c60,
+	/* 0x00010c61 */ 0x00010c61,
+	/* 0x00010c62 */ 0x00010c62,
+	/* 0x00010c63 */ 0x00010c63,
+	/* 0x00010c64 */ 0x00010c64,
+	/* 0x00010c65 */ 0x00010c65,
+	/* 0x00010c66 */ 0x00010c66,
+	/* 0x00010c67 */ 0x00010c67,
+	/* 0x00010c68 */ 0x00010c68,
+	/* 0x00010c69 */ 0x00010c69,
+	/* 0x00010c6a */ 0x00010c6a,
+	/* 0x00010c6b */ 0x00010c6b,
+	/* 0x00010c6c */ 0x00010c6c,
+	/* 0x00010c6d */ 0x00010c6d,
+	/* 0x00010c6e */ 0x00010c6e,
+	/* 0x00010c6f */ 0x00010c6f,
+	/* 0x00010c70 */ 0x00010c70,
+	/* 0x00010c71 */ 0x00010c71,
+	/* 0x00010c72 */ 0x00010c72,
+	/* 0x00010c73 */ 0x00010c73,
+	/* 0x00010c74 */ 0x00010c74,
+	/* 0x00010c75 */ 0x00010c75,
+	/* 0x00010c76 */ 0x00010c76,
+	/* 0x00010c77 */ 0x00010c77,
+	/* 0x00010c78 */ 0x00010c78,
+	/* 0x00010c79 */ 0x00010c79,
+	/* 0x00010c7a */ 0x00010c7a,
+	/* 0x00010c7b */ 0x00010c7b,
+	/* 0x00010c7c */ 0x00010c7c,
+	/* 0x00010c7d */ 0x00010c7d,
+	/* 0x00010c7e */ 0x00010c7e,
+	/* 0x00010c7f */ 0x00010c7f,
+	/* 0x00010c80 */ 0x00010cc0,
+	/* 0x00010c81 */ 0x00010cc1,
+	/* 0x00010c82 */ 0x00010cc2,
+	/* 0x00010c83 */ 0x00010cc3,
+	/* 0x00010c84 */ 0x00010cc4,
+	/* 0x00010c85 */ 0x00010cc5,
+	/* 0x00010c86 */ 0x00010cc6,
+	/* 0x00010c87 */ 0x00010cc7,
+	/* 0x00010c88 */ 0x00010cc8,
+	/* 0x00010c89 */ 0x00010cc9,
+	/* 0x00010c8a */ 0x00010cca,
+	/* 0x00010c8b */ 0x00010ccb,
+	/* 0x00010c8c */ 0x00010ccc,
+	/* 0x00010c8d */ 0x00010ccd,
+	/* 0x00010c8e */ 0x00010cce,
+	/* 0x00010c8f */ 0x00010ccf,
+	/* 0x00010c90 */ 0x00010cd0,
+	/* 0x00010c91 */ 0x00010cd1,
+	/* 0x00010c92 */ 0x00010cd2,
+	/* 0x00010c93 */ 0x00010cd3,
+	/* 0x00010c94 */ 0x00010cd4,
+	/* 0x00010c95 */ 0x00010cd5,
+	/* 0x00010c96 */ 0x00010cd6,
+	/* 0x00010c97 */ 0x00010cd7,
+	/* 0x00010c98 */ 0x00010cd8,
+	/* 0x00010c99 */ 0x00010cd9,
+	/* 0x00010c9a */ 0x00010cda,
+	/* 0x00010c9b */ 0x00010cdb,
+	/* 0x00010c9c */ 0x00010cdc,
+	/* 0x00010c9d */ 0x00010cdd,
+	/* 0x00010c9e */ 0x00010cde,
+	/* 0x00010c9f */ 0x00010cdf,
+	/* 0x00010ca0 */ 0x00010ce0,
+	/* 0x00010ca1 */ 0x00010ce1,
+	/* 0x00010ca2 */ 0x00010ce2,
+	/* 0x00010ca3 */ 0x00010ce3,
+	/* 0x00010ca4 */ 0x00010ce4,
+	/* 0x00010ca5 */ 0x00010ce5,
+	/* 0x00010ca6 */ 0x00010ce6,
+	/* 0x00010ca7 */ 0x00010ce7,
+	/* 0x00010ca8 */ 0x00010ce8,
+	/* 0x00010ca9 */ 0x00010ce9,
+	/* 0x00010caa */ 0x00010cea,
+	/* 0x00010cab */ 0x00010ceb,
+	/* 0x00010cac */ 0x00010cec,
+	/* 0x00010cad */ 0x00010ced,
+	/* 0x00010cae */ 0x00010cee,
+	/* 0x00010caf */ 0x00010cef,
+	/* 0x00010cb0 */ 0x00010cf0,
+	/* 0x00010cb1 */ 0x00010cf1,
+	/* 0x00010cb2 */ 0x00010cf2,
+	/* 0x00010cb3 */ 0x00010cb3,
+	/* 0x00010cb4 */ 0x00010cb4,
+	/* 0x00010cb5 */ 0x00010cb5,
+	/* 0x00010cb6 */ 0x00010cb6,
+	/* 0x00010cb7 */ 0x00010cb7,
+	/* 0x00010cb8 */ 0x00010cb8,
+	/* 0x00010cb9 */ 0x00010cb9,
+	/* 0x00010cba */ 0x00010cba,
+	/* 0x00010cbb */ 0x00010cbb,
+	/* 0x00010cbc */ 0x00010cbc,
+	/* 0x00010cbd */ 0x00010cbd,
+	/* 0x00010cbe */ 0x00010cbe,
+	/* 0x00010cbf */ 0x00010cbf,
+	/* 0x00010cc0 */ 0x00010cc0,
+	/* 0x00010cc1 */ 0x00010cc1,
+	/* 0x00010cc2 */ 0x00010cc2,
+	/* 0x00010cc3 */ 0x00010cc3,
+	/* 0x00010cc4 */ 0x00010cc4,
+	/* 0x00010cc5 */ 0x00010cc5,
+	/* 0x00010cc6 */ 0x00010cc6,
+	/* 0x00010cc7 */ 0x00010cc7,
+	/* 0x00010cc8 */ 0x00010cc8,
+	/* 0x00010cc9 */ 0x00010cc9,
+	/* 0x00010cca */ 0x00010cca,
+	/* 0x00010ccb */ 0x00010ccb,
+	/* 0x00010ccc */ 0x00010ccc,
+	/* 0x00010ccd */ 0x00010ccd,
+	/* 0x00010cce */ 0x00010cce,
+	/* 0x00010ccf */ 0x00010ccf,
+	/* 0x00010cd0 */ 0x00010cd0,
+	/* 0x00010cd1 */ 0x00010cd1,
+	/* 0x00010cd2 */ 0x00010cd2,
+	/* 0x00010cd3 */ 0x00010cd3,
+	/* 0x00010cd4 */ 0x00010cd4,
+	/* 0x00010cd5 */ 0x00010cd5,
+	/* 0x00010cd6 */ 0x00010cd6,
+	/* 0x00010cd7 */ 0x00010cd7,
+	/* 0x00010cd8 */ 0x00010cd8,
+	/* 0x00010cd9 */ 0x00010cd9,
+	/* 0x00010cda */ 0x00010cda,
+	/* 0x00010cdb */ 0x00010cdb,
+	/* 0x00010cdc */ 0x00010cdc,
+	/* 0x00010cdd */ 0x00010cdd,
+	/* 0x00010cde */ 0x00010cde,
+	/* 0x00010cdf */ 0x00010cdf,
+	/* 0x00010ce0 */ 0x00010ce0,
+	/* 0x00010ce1 */ 0x00010ce1,
+	/* 0x00010ce2 */ 0x00010ce2,
+	/* 0x00010ce3 */ 0x00010ce3,
+	/* 0x00010ce4 */ 0x00010ce4,
+	/* 0x00010ce5 */ 0x00010ce5,
+	/* 0x00010ce6 */ 0x00010ce6,
+	/* 0x00010ce7 */ 0x00010ce7,
+	/* 0x00010ce8 */ 0x00010ce8,
+	/* 0x00010ce9 */ 0x00010ce9,
+	/* 0x00010cea */ 0x00010cea,
+	/* 0x00010ceb */ 0x00010ceb,
+	/* 0x00010cec */ 0x00010cec,
+	/* 0x00010ced */ 0x00010ced,
+	/* 0x00010cee */ 0x00010cee,
+	/* 0x00010cef */ 0x00010cef,
+	/* 0x00010cf0 */ 0x00010cf0,
+	/* 0x00010cf1 */ 0x00010cf1,
+	/* 0x00010cf2 */ 0x00010cf2,
+	/* 0x00010cf3 */ 0x00010cf3,
+	/* 0x00010cf4 */ 0x00010cf4,
+	/* 0x00010cf5 */ 0x00010cf5,
+	/* 0x00010cf6 */ 0x00010cf6,
+	/* 0x00010cf7 */ 0x00010cf7,
+	/* 0x00010cf8 */ 0x00010cf8,
+	/* 0x00010cf9 */ 0x00010cf9,
+	/* 0x00010cfa */ 0x00010cfa,
+	/* 0x00010cfb */ 0x00010cfb,
+	/* 0x00010cfc */ 0x00010cfc,
+	/* 0x00010cfd */ 0x00010cfd,
+	/* 0x00010cfe */ 0x00010cfe,
+	/* 0x00010cff */ 0x00010cff
+};
+
+static uint32_t libfshfs_name_case_folding_mappings_0x00011800[ 256 ] = {
+	/* 0x00011800 */ 0x00011800,
+	/* 0x00011801 */ 0x00011801,
+	/* 0x00011802 */ 0x00011802,
+	/* 0x00011803 */ 0x00011803,
+	/* 0x00011804 */ 0x00011804,
+	/* 0x00011805 */ 0x00011805,
+	/* 0x00011806 */ 0x00011806,
+	/* 0x00011807 */ 0x00011807,
+	/* 0x00011808 */ 0x00011808,
+	/* 0x00011809 */ 0x00011809,
+	/* 0x0001180a */ 0x0001180a,
+	/* 0x0001180b */ 0x0001180b,
+	/* 0x0001180c */ 0x0001180c,
+	/* 0x0001180d */ 0x0001180d,
+	/* 0x0001180e */ 0x0001180e,
+	/* 0x0001180f */ 0x0001180f,
+	/* 0x00011810 */ 0x00011810,
+	/* 0x00011811 */ 0x00011811,
+	/* 0x00011812 */ 0x00011812,
+	/* 0x00011813 */ 0x00011813,
+	/* 0x00011814 */ 0x00011814,
+	/* 0x00011815 */ 0x00011815,
+	/* 0x00011816 */ 0x00011816,
+	/* 0x00011817 */ 0x00011817,
+	/* 0x00011818 */ 0x00011818,
+	/* 0x00011819 */ 0x00011819,
+	/* 0x0001181a */ 0x0001181a,
+	/* 0x0001181b */ 0x0001181b,
+	/* 0x0001181c */ 0x0001181c,
+	/* 0x0001181d */ 0x0001181d,
+	/* 0x0001181e */ 0x0001181e,
+	/* 0x0001181f */ 0x0001181f,
+	/* 0x00011820 */ 0x00011820,
+	/* 0x00011821 */ 0x00011821,
+	/* 0x00011822 */ 0x00011822,
+	/* 0x00011823 */ 0x00011823,
+	/* 0x00011824 */ 0x00011824,
+	/* 0x00011825 */ 0x00011825,
+	/* 0x00011826 */ 0x00011826,
+	/* 0x00011827 */ 0x00011827,
+	/* 0x00011828 */ 0x00011828,
+	/* 0x00011829 */ 0x00011829,
+	/* 0x0001182a */ 0x0001182a,
+	/* 0x0001182b */ 0x0001182b,
+	/* 0x0001182c */ 0x0001182c,
+	/* 0x0001182d */ 0x0001182d,
+	/* 0x0001182e */ 0x0001182e,
+	/* 0x0001182f */ 0x0001182f,
+	/* 0x00011830 */ 0x00011830,
+	/* 0x00011831 */ 0x00011831,
+	/* 0x00011832 */ 0x00011832,
+	/* 0x00011833 */ 0x00011833,
+	/* 0x00011834 */ 0x00011834,
+	/* 0x00011835 */ 0x00011835,
+	/* 0x00011836 */ 0x00011836,
+	/* 0x00011837 */ 0x00011837,
+	/* 0x00011838 */ 0x00011838,
+	/* 0x00011839 */ 0x00011839,
+	/* 0x0001183a */ 0x0001183a,
+	/* 0x0001183b */ 0x0001183b,
+	/* 0x0001183c */ 0x0001183c,
+	/* 0x0001183d */ 0x0001183d,
+	/* 0x0001183e */ 0x0001183e,
+	/* 0x0001183f */ 0x0001183f,
+	/* 0x00011840 */ 0x00011840,
+	/* 0x00011841 */ 0x00011841,
+	/* 0x00011842 */ 0x00011842,
+	/* 0x00011843 */ 0x00011843,
+	/* 0x00011844 */ 0x00011844,
+	/* 0x00011845 */ 0x00011845,
+	/* 0x00011846 */ 0x00011846,
+	/* 0x00011847 */ 0x00011847,
+	/* 0x00011848 */ 0x00011848,
+	/* 0x00011849 */ 0x00011849,
+	/* 0x0001184a */ 0x0001184a,
+	/* 0x0001184b */ 0x0001184b,
+	/* 0x0001184c */ 0x0001184c,
+	/* 0x0001184d */ 0x0001184d,
+	/* 0x0001184e */ 0x0001184e,
+	/* 0x0001184f */ 0x0001184f,
+	/* 0x00011850 */ 0x00011850,
+	/* 0x00011851 */ 0x00011851,
+	/* 0x00011852 */ 0x00011852,
+	/* 0x00011853 */ 0x00011853,
+	/* 0x00011854 */ 0x00011854,
+	/* 0x00011855 */ 0x00011855,
+	/* 0x00011856 */ 0x00011856,
+	/* 0x00011857 */ 0x00011857,
+	/* 0x00011858 */ 0x00011858,
+	/* 0x00011859 */ 0x00011859,
+	/* 0x0001185a */ 0x0001185a,
+	/* 0x0001185b */ 0x0001185b,
+	/* 0x0001185c */ 0x0001185c,
+	/* 0x0001185d */ 0x0001185d,
+	/* 0x0001185e */ 0x0001185e,
+	/* 0x0001185f */ 0x0001185f,
+	/* 0x00011860 */ 0x00011860,
+	/* 0x00011861 */ 0x00011861,
+	/* 0x00011862 */ 0x00011862,
+	/* 0x00011863 */ 0x00011863,
+	/* 0x00011864 */ 0x00011864,
+	/* 0x00011865 */ 0x00011865,
+	/* 0x00011866 */ 0x00011866,
+	/* 0x00011867 */ 0x00011867,
+	/* 0x00011868 */ 0x00011868,
+	/* 0x00011869 */ 0x00011869,
+	/* 0x0001186a */ 0x0001186a,
+	/* 0x0001186b */ 0x0001186b,
+	/* 0x0001186c */ 0x0001186c,
+	/* 0x0001186d */ 0x0001186d,
+	/* 0x0001186e */ 0x0001186e,
+	/* 0x0001186f */ 0x0001186f,
+	/* 0x00011870 */ 0x00011870,
+	/* 0x00011871 */ 0x00011871,
+	/* 0x00011872 */ 0x00011872,
+	/* 0x00011873 */ 0x00011873,
+	/* 0x00011874 */ 0x00011874,
+	/* 0x00011875 */ 0x00011875,
+	/* 0x00011876 */ 0x00011876,
+	/* 0x00011877 */ 0x00011877,
+	/* 0x00011878 */ 0x00011878,
+	/* 0x00011879 */ 0x00011879,
+	/* 0x0001187a */ 0x0001187a,
+	/* 0x0001187b */ 0x0001187b,
+	/* 0x0001187c */ 0x0001187c,
+	/* 0x0001187d */ 0x0001187d,
+	/* 0x0001187e */ 0x0001187e,
+	/* 0x0001187f */ 0x0001187f,
+	/* 0x00011880 */ 0x00011880,
+	/* 0x00011881 */ 0x00011881,
+	/* 0x00011882 */ 0x00011882,
+	/* 0x00011883 */ 0x00011883,
+	/* 0x00011884 */ 0x00011884,
+	/* 0x00011885 */ 0x00011885,
+	/* 0x00011886 */ 0x00011886,
+	/* 0x00011887 */ 0x00011887,
+	/* 0x00011888 */ 0x00011888,
+	/* 0x00011889 */ 0x00011889,
+	/* 0x0001188a */ 0x0001188a,
+	/* 0x0001188b */ 0x0001188b,
+	/* 0x0001188c */ 0x0001188c,
+	/* 0x0001188d */ 0x0001188d,
+	/* 0x0001188e */ 0x0001188e,
+	/* 0x0001188f */ 0x0001188f,
+	/* 0x00011890 */ 0x00011890,
+	/* 0x00011891 */ 0x00011891,
+	/* 0x00011892 */ 0x00011892,
+	/* 0x00011893 */ 0x00011893,
+	/* 0x00011894 */ 0x00011894,
+	/* 0x00011895 */ 0x00011895,
+	/* 0x00011896 */ 0x00011896,
+	/* 0x00011897 */ 0x00011897,
+	/* 0x00011898 */ 0x00011898,
+	/* 0x00011899 */ 0x00011899,
+	/* 0x0001189a */ 0x0001189a,
+	/* 0x0001189b */ 0x0001189b,
+	/* 0x0001189c */ 0x0001189c,
+	/* 0x0001189d */ 0x0001189d,
+	/* 0x0001189e */ 0x0001189e,
+	/* 0x0001189f */ 0x0001189f,
+	/* 0x000118a0 */ 0x000118c0,
+	/* 0x000118a1 */ 0x000118c1,
+	/* 0x000118a2 */ 0x000118c2,
+	/* 0x000118a3 */ 0x000118c3,
+	/* 0x000118a4 */ 0x000118c4,
+	/* 0x000118a5 */ 0x000118c5,
+	/* 0x000118a6 */ 0x000118c6,
+	/* 0x000118a7 */ 0x000118c7,
+	/* 0x000118a8 */ 0x000118c8,
+	/* 0x000118a9 */ 0x000118c9,
+	/* 0x000118aa */ 0x000118ca,
+	/* 0x000118ab */ 0x000118cb,
+	/* 0x000118ac */ 0x000118cc,
+	/* 0x000118ad */ 0x000118cd,
+	/* 0x000118ae */ 0x000118ce,
+	/* 0x000118af */ 0x000118cf,
+	/* 0x000118b0 */ 0x000118d0,
+	/* 0x000118b1 */ 0x000118d1,
+	/* 0x000118b2 */ 0x000118d2,
+	/* 0x000118b3 */ 0x000118d3,
+	/* 0x000118b4 */ 0x000118d4,
+	/* 0x000118b5 */ 0x000118d5,
+	/* 0x000118b6 */ 0x000118d6,
+	/* 0x000118b7 */ 0x000118d7,
+	/* 0x000118b8 */ 0x000118d8,
+	/* 0x000118b9 */ 0x000118d9,
+	/* 0x000118ba */ 0x000118da,
+	/* 0x000118bb */ 0x000118db,
+	/* 0x000118bc */ 0x000118dc,
+	/* 0x000118bd */ 0x000118dd,
+	/* 0x000118be */ 0x000118de,
+	/* 0x000118bf */ 0x000118df,
+	/* 0x000118c0 */ 0x000118c0,
+	/* 0x000118c1 */ 0x000118c1,
+	/* 0x000118c2 */ 0x000118c2,
+	/* 0x000118c3 */ 0x000118c3,
+	/* 0x000118c4 */ 0x000118c4,
+	/* 0x000118c5 */ 0x000118c5,
+	/* 0x000118c6 */ 0x000118c6,
+	/* 0x000118c7 */ 0x000118c7,
+	/* 0x000118c8 */ 0x000118c8,
+	/* 0x000118c9 */ 0x000118c9,
+	/* 0x000118ca */ 0x000118ca,
+	/* 0x000118cb */ 0x000118cb,
+	/* 0x000118cc */ 0x000118cc,
+	/* 0x000118cd */ 0x000118cd,
+	/* 0x000118ce */ 0x000118ce,
+	/* 0x000118cf */ 0x000118cf,
+	/* 0x000118d0 */ 0x000118d0,
+	/* 0x000118d1 */ 0x000118d1,
+	/* 0x000118d2 */ 0x000118d2,
+	/* 0x000118d3 */ 0x000118d3,
+	/* 0x000118d4 */ 0x000118d4,
+	/* 0x000118d5 */ 0x000118d5,
+	/* 0x000118d6 */ 0x000118d6,
+	/* 0x000118d7 */ 0x000118d7,
+	/* 0x000118d8 */ 0x000118d8,
+	/* 0x000118d9 */ 0x000118d9,
+	/* 0x000118da */ 0x000118da,
+	/* 0x000118db */ 0x000118db,
+	/* 0x000118dc */ 0x000118dc,
+	/* 0x000118dd */ 0x000118dd,
+	/* 0x000118de */ 0x000118de,
+	/* 0x000118df */ 0x000118df,
+	/* 0x000118e0 */ 0x000118e0,
+	/* 0x000118e1 */ 0x000118e1,
+	/* 0x000118e2 */ 0x000118e2,
+	/* 0x000118e3 */ 0x000118e3,
+	/* 0x000118e4 */ 0x000118e4,
+	/* 0x000118e5 */ 0x000118e5,
+	/* 0x000118e6 */ 0x000118e6,
+	/* 0x000118e7 */ 0x000118e7,
+	/* 0x000118e8 */ 0x000118e8,
+	/* 0x000118e9 */ 0x000118e9,
+	/* 0x000118ea */ 0x000118ea,
+	/* 0x000118eb */ 0x000118eb,
+	/* 0x000118ec */ 0x000118ec,
+	/* 0x000118ed */ 0x000118ed,
+	/* 0x000118ee */ 0x000118ee,
+	/* 0x000118ef */ 0x000118ef,
+	/* 0x000118f0 */ 0x000118f0,
+	/* 0x000118f1 */ 0x000118f1,
+	/* 0x000118f2 */ 0x000118f2,
+	/* 0x000118f3 */ 0x000118f3,
+	/* 0x000118f4 */ 0x000118f4,
+	/* 0x000118f5 */ 0x000118f5,
+	/* 0x000118f6 */ 0x000118f6,
+	/* 0x000118f7 */ 0x000118f7,
+	/* 0x000118f8 */ 0x000118f8,
+	/* 0x000118f9 */ 0x000118f9,
+	/* 0x000118fa */ 0x000118fa,
+	/* 0x000118fb */ 0x000118fb,
+	/* 0x000118fc */ 0x000118fc,
+	/* 0x000118fd */ 0x000118fd,
+	/* 0x000118fe */ 0x000118fe,
+	/* 0x000118ff */ 0x000118ff
+};
+
+static uint32_t libfshfs_name_case_folding_mappings_0x0001e900[ 256 ] = {
+	/* 0x0001e900 */ 0x0001e922,
+	/* 0x0001e901 */ 0x0001e923,
+	/* 0x0001e902 */ 0x0001e924,
+	/* 0x0001e903 */ 0x0001e925,
+	/* 0x0001e904 */ 0x0001e926,
+	/* 0x0001e905 */ 0x0001e927,
+	/* 0x0001e906 */ 0x0001e928,
+	/* 0x0001e907 */ 0x0001e929,
+	/* 0x0001e908 */ 0x0001e92a,
+	/* 0x0001e909 */ 0x0001e92b,
+	/* 0x0001e90a */ 0x0001e92c,
+	/* 0x0001e90b */ 0x0001e92d,
+	/* 0x0001e90c */ 0x0001e92e,
+	/* 0x0001e90d */ 0x0001e92f,
+	/* 0x0001e90e */ 0x0001e930,
+	/* 0x0001e90f */ 0x0001e931,
+	/* 0x0001e910 */ 0x0001e932,
+	/* 0x0001e911 */ 0x0001e933,
+	/* 0x0001e912 */ 0x0001e934,
+	/* 0x0001e913 */ 0x0001e935,
+	/* 0x0001e914 */ 0x0001e936,
+	/* 0x0001e915 */ 0x0001e937,
+	/* 0x0001e916 */ 0x0001e938,
+	/* 0x0001e917 */ 0x0001e939,
+	/* 0x0001e918 */ 0x0001e93a,
+	/* 0x0001e919 */ 0x0001e93b,
+	/* 0x0001e91a */ 0x0001e93c,
+	/* 0x0001e91b */ 0x0001e93d,
+	/* 0x0001e91c */ 0x0001e93e,
+	/* 0x0001e91d */ 0x0001e93f,
+	/* 0x0001e91e */ 0x0001e940,
+	/* 0x0001e91f */ 0x0001e941,
+	/* 0x0001e920 */ 0x0001e942,
+	/* 0x0001e921 */ 0x0001e943,
+	/* 0x0001e922 */ 0x0001e922,
+	/* 0x0001e923 */ 0x0001e923,
+	/* 0x0001e924 */ 0x0001e924,
+	/* 0x0001e925 */ 0x0001e925,
+	/* 0x0001e926 */ 0x0001e926,
+	/* 0x0001e927 */ 0x0001e927,
+	/* 0x0001e928 */ 0x0001e928,
+	/* 0x0001e929 */ 0x0001e929,
+	/* 0x0001e92a */ 0x0001e92a,
+	/* 0x0001e92b */ 0x0001e92b,
+	/* 0x0001e92c */ 0x0001e92c,
+	/* 0x0001e92d */ 0x0001e92d,
+	/* 0x0001e92e */ 0x0001e92e,
+	/* 0x0001e92f */ 0x0001e92f,
+	/* 0x0001e930 */ 0x0001e930,
+	/* 0x0001e931 */ 0x0001e931,
+	/* 0x0001e932 */ 0x0001e932,
+	/* 0x0001e933 */ 0x0001e933,
+	/* 0x0001e934 */ 0x0001e934,
+	/* 0x0001e935 */ 0x0001e935,
+	/* 0x0001e936 */ 0x0001e936,
+	/* 0x0001e937 */ 0x0001e937,
+	/* 0x0001e938 */ 0x0001e938,
+	/* 0x0001e939 */ 0x0001e939,
+	/* 0x0001e93a */ 0x0001e93a,
+	/* 0x0001e93b */ 0x0001e93b,
+	/* 0x0001e93c */ 0x0001e93c,
+	/* 0x0001e93d */ 0x0001e93d,
+	/* 0x0001e93e */ 0x0001e93e,
+	/* 0x0001e93f */ 0x0001e93f,
+	/* 0x0001e940 */ 0x0001e940,
+	/* 0x0001e941 */ 0x0001e941,
+	/* 0x0001e942 */ 0x0001e942,
+	/* 0x0001e943 */ 0x0001e943,
+	/* 0x0001e944 */ 0x0001e944,
+	/* 0x0001e945 */ 0x0001e945,
+	/* 0x0001e946 */ 0x0001e946,
+	/* 0x0001e947 */ 0x0001e947,
+	/* 0x0001e948 */ 0x0001e948,
+	/* 0x0001e949 */ 0x0001e949,
+	/* 0x0001e94a */ 0x0001e94a,
+	/* 0x0001e94b */ 0x0001e94b,
+	/* 0x0001e94c */ 0x0001e94c,
+	/* 0x0001e94d */ 0x0001e94d,
+	/* 0x0001e94e */ 0x0001e94e,
+	/* 0x0001e94f */ 0x0001e94f,
+	/* 0x0001e950 */ 0x0001e950,
+	/* 0x0001e951 */ 0x0001e951,
+	/* 0x0001e952 */ 0x0001e952,
+	/* 0x0001e953 */ 0x0001e953,
+	/* 0x0001e954 */ 0x0001e954,
+	/* 0x0001e955 */ 0x0001e955,
+	/* 0x0001e956 */ 0x0001e956,
+	/* 0x0001e957 */ 0x0001e957,
+	/* 0x0001e958 */ 0x0001e958,
+	/* 0x0001e959 */ 0x0001e959,
+	/* 0x0001e95a */ 0x0001e95a,
+	/* 0x0001e95b */ 0x0001e95b,
+	/* 0x0001e95c */ 0x0001e95c,
+	/* 0x0001e95d */ 0x0001e95d,
+	/* 0x0001e95e */ 0x0001e95e,
+	/* 0x0001e95f */ 0x0001e95f,
+	/* 0x0001e960 */ 0x0001e960,
+	/* 0x0001e961 */ 0x0001e961,
+	/* 0x0001e962 */ 0x0001e962,
+	/* 0x0001e963 */ 0x0001e963,
+	/* 0x0001e964 */ 0x0001e964,
+	/* 0x0001e965 */ 0x0001e965,
+	/* 0x0001e966 */ 0x0001e966,
+	/* 0x0001e967 */ 0x0001e967,
+	/* 0x0001e968 */ 0x0001e968,
+	/* 0x0001e969 */ 0x0001e969,
+	/* 0x0001e96a */ 0x0001e96a,
+	/* 0x0001e96b */ 0x0001e96b,
+	/* 0x0001e96c */ 0x0001e96c,
+	/* 0x0001e96d */ 0x0001e96d,
+	/* 0x0001e96e */ 0x0001e96e,
+	/* 0x0001e96f */ 0x0001e96f,
+	/* 0x0001e970 */ 0x0001e970,
+	/* 0x0001e971 */ 0x0001e971,
+	/* 0x0001e972 */ 0x0001e972,
+	/* 0x0001e973 */ 0x0001e973,
+	/* 0x0001e974 */ 0x0001e974,
+	/* 0x0001e975 */ 0x0001e975,
+	/* 0x0001e976 */ 0x0001e976,
+	/* 0x0001e977 */ 0x0001e977,
+	/* 0x0001e978 */ 0x0001e978,
+	/* 0x0001e979 */ 0x0001e979,
+	/* 0x0001e97a */ 0x0001e97a,
+	/* 0x0001e97b */ 0x0001e97b,
+	/* 0x0001e97c */ 0x0001e97c,
+	/* 0x0001e97d */ 0x0001e97d,
+	/* 0x0001e97e */ 0x0001e97e,
+	/* 0x0001e97f */ 0x0001e97f,
+	/* 0x0001e980 */ 0x0001e980,
+	/* 0x0001e981 */ 0x0001e981,
+	/* 0x0001e982 */ 0x0001e982,
+	/* 0x0001e983 */ 0x0001e983,
+	/* 0x0001e984 */ 0x0001e984,
+	/* 0x0001e985 */ 0x0001e985,
+	/* 0x0001e986 */ 0x0001e986,
+	/* 0x0001e987 */ 0x0001e987,
+	/* 0x0001e988 */ 0x0001e988,
+	/* 0x0001e989 */ 0x0001e989,
+	/* 0x0001e98a */ 0x0001e98a,
+	/* 0x0001e98b */ 0x0001e98b,
+	/* 0x0001e98c */ 0x0001e98c,
+	/* 0x0001e98d */ 0x0001e98d,
+	/* 0x0001e98e */ 0x0001e98e,
+	/* 0x0001e98f */ 0x0001e98f,
+	/* 0x0001e990 */ 0x0001e990,
+	/* 0x0001e991 */ 0x0001e991,
+	/* 0x0001e992 */ 0x0001e992,
+	/* 0x0001e993 */ 0x0001e993,
+	/* 0x0001e994 */ 0x0001e994,
+	/* 0x0001e995 */ 0x0001e995,
+	/* 0x0001e996 */ 0x0001e996,
+	/* 0x0001e997 */ 0x0001e997,
+	/* 0x0001e998 */ 0x0001e998,
+	/* 0x0001e999 */ 0x0001e999,
+	/* 0x0001e99a */ 0x0001e99a,
+	/* 0x0001e99b */ 0x0001e99b,
+	/* 0x0001e99c */ 0x0001e99c,
+	/* 0x0001e99d */ 0x0001e99d,
+	/* 0x0001e99e */ 0x0001e99e,
+	/* 0x0001e99f */ 0x0001e99f,
+	/* 0x0001e9a0 */ 0x0001e9a0,
+	/* 0x0001e9a1 */ 0x0001e9a1,
+	/* 0x0001e9a2 */ 0x0001e9a2,
+	/* 0x0001e9a3 */ 0x0001e9a3,
+	/* 0x0001e9a4 */ 0x0001e9a4,
+	/* 0x0001e9a5 */ 0x0001e9a5,
+	/* 0x0001e9a6 */ 0x0001e9a6,
+	/* 0x0001e9a7 */ 0x0001e9a7,
+	/* 0x0001e9a8 */ 0x0001e9a8,
+	/* 0x0001e9a9 */ 0x0001e9a9,
+	/* 0x0001e9aa */ 0x0001e9aa,
+	/* 0x0001e9ab */ 0x0001e9ab,
+	/* 0x0001e9ac */ 0x0001e9ac,
+	/* 0x0001e9ad */ 0x0001e9ad,
+	/* 0x0001e9ae */ 0x0001e9ae,
+	/* 0x0001e9af */ 0x0001e9af,
+	/* 0x0001e9b0 */ 0x0001e9b0,
+	/* 0x0001e9b1 */ 0x0001e9b1,
+	/* 0x0001e9b2 */ 0x0001e9b2,
+	/* 0x0001e9b3 */ 0x0001e9b3,
+	/* 0x0001e9b4 */ 0x0001e9b4,
+	/* 0x0001e9b5 */ 0x0001e9b5,
+	/* 0x0001e9b6 */ 0x0001e9b6,
+	/* 0x0001e9b7 */ 0x0001e9b7,
+	/* 0x0001e9b8 */ 0x0001e9b8,
+	/* 0x0001e9b9 */ 0x0001e9b9,
+	/* 0x0001e9ba */ 0x0001e9ba,
+	/* 0x0001e9bb */ 0x0001e9bb,
+	/* 0x0001e9bc */ 0x0001e9bc,
+	/* 0x0001e9bd */ 0x0001e9bd,
+	/* 0x0001e9be */ 0x0001e9be,
+	/* 0x0001e9bf */ 0x0001e9bf,
+	/* 0x0001e9c0 */ 0x0001e9c0,
+	/* 0x0001e9c1 */ 0x0001e9c1,
+	/* 0x0001e9c2 */ 0x0001e9c2,
+	/* 0x0001e9c3 */ 0x0001e9c3,
+	/* 0x0001e9c4 */ 0x0001e9c4,
+	/* 0x0001e9c5 */ 0x0001e9c5,
+	/* 0x0001e9c6 */ 0x0001e9c6,
+	/* 0x0001e9c7 */ 0x0001e9c7,
+	/* 0x0001e9c8 */ 0x0001e9c8,
+	/* 0x0001e9c9 */ 0x0001e9c9,
+	/* 0x0001e9ca */ 0x0001e9ca,
+	/* 0x0001e9cb */ 0x0001e9cb,
+	/* 0x0001e9cc */ 0x0001e9cc,
+	/* 0x0001e9cd */ 0x0001e9cd,
+	/* 0x0001e9ce */ 0x0001e9ce,
+	/* 0x0001e9cf */ 0x0001e9cf,
+	/* 0x0001e9d0 */ 0x0001e9d0,
+	/* 0x0001e9d1 */ 0x0001e9d1,
+	/* 0x0001e9d2 */ 0x0001e9d2,
+	/* 0x0001e9d3 */ 0x0001e9d3,
+	/* 0x0001e9d4 */ 0x0001e9d4,
+	/* 0x0001e9d5 */ 0x0001e9d5,
+	/* 0x0001e9d6 */ 0x0001e9d6,
+	/* 0x0001e9d7 */ 0x0001e9d7,
+	/* 0x0001e9d8 */ 0x0001e9d8,
+	/* 0x0001e9d9 */ 0x0001e9d9,
+	/* 0x0001e9da */ 0x0001e9da,
+	/* 0x0001e9db */ 0x0001e9db,
+	/* 0x0001e9dc */ 0x0001e9dc,
+	/* 0x0001e9dd */ 0x0001e9dd,
+	/* 0x0001e9de */ 0x0001e9de,
+	/* 0x0001e9df */ 0x0001e9df,
+	/* 0x0001e9e0 */ 0x0001e9e0,
+	/* 0x0001e9e1 */ 0x0001e9e1,
+	/* 0x0001e9e2 */ 0x0001e9e2,
+	/* 0x0001e9e3 */ 0x0001e9e3,
+	/* 0x0001e9e4 */ 0x0001e9e4,
+	/* 0x0001e9e5 */ 0x0001e9e5,
+	/* 0x0001e9e6 */ 0x0001e9e6,
+	/* 0x0001e9e7 */ 0x0001e9e7,
+	/* 0x0001e9e8 */ 0x0001e9e8,
+	/* 0x0001e9e9 */ 0x0001e9e9,
+	/* 0x0001e9ea */ 0x0001e9ea,
+	/* 0x0001e9eb */ 0x0001e9eb,
+	/* 0x0001e9ec */ 0x0001e9ec,
+	/* 0x0001e9ed */ 0x0001e9ed,
+	/* 0x0001e9ee */ 0x0001e9ee,
+	/* 0x0001e9ef */ 0x0001e9ef,
+	/* 0x0001e9f0 */ 0x0001e9f0,
+	/* 0x0001e9f1 */ 0x0001e9f1,
+	/* 0x0001e9f2 */ 0x0001e9f2,
+	/* 0x0001e9f3 */ 0x0001e9f3,
+	/* 0x0001e9f4 */ 0x0001e9f4,
+	/* 0x0001e9f5 */ 0x0001e9f5,
+	/* 0x0001e9f6 */ 0x0001e9f6,
+	/* 0x0001e9f7 */ 0x0001e9f7,
+	/* 0x0001e9f8 */ 0x0001e9f8,
+	/* 0x0001e9f9 */ 0x0001e9f9,
+	/* 0x0001e9fa */ 0x0001e9fa,
+	/* 0x0001e9fb */ 0x0001e9fb,
+	/* 0x0001e9fc */ 0x0001e9fc,
+	/* 0x0001e9fd */ 0x0001e9fd,
+	/* 0x0001e9fe */ 0x0001e9fe,
+	/* 0x0001e9ff */ 0x0001e9ff
+};
+
+uint32_t *libfshfs_name_case_folding_mappings[ 490 ] = {
+	/* 0x00000000 */ libfshfs_name_case_folding_mappings_0x00000000,
+	/* 0x00000100 */ libfshfs_name_case_folding_mappings_0x00000100,
+	/* 0x00000200 */ libfshfs_name_case_folding_mappings_0x00000200,
+	/* 0x00000300 */ libfshfs_name_case_folding_mappings_0x00000300,
+	/* 0x00000400 */ libfshfs_name_case_folding_mappings_0x00000400,
+	/* 0x00000500 */ libfshfs_name_case_folding_mappings_0x00000500,
+	/* 0x00000600 */ NULL,
+	/* 0x00000700 */ NULL,
+	/* 0x00000800 */ NULL,
+	/* 0x00000900 */ NULL,
+	/* 0x00000a00 */ NULL,
+	/* 0x00000b00 */ NULL,
+	/* 0x00000c00 */ NULL,
+	/* 0x00000d00 */ NULL,
+	/* 0x00000e00 */ NULL,
+	/* 0x00000f00 */ NULL,
+	/* 0x00001000 */ libfshfs_name_case_folding_mappings_0x00001000,
+	/* 0x00001100 */ NULL,
+	/* 0x00001200 */ NULL,
+	/* 0x00001300 */ libfshfs_name_case_folding_mappings_0x00001300,
+	/* 0x00001400 */ NULL,
+	/* 0x00001500 */ NULL,
+	/* 0x00001600 */ NULL,
+	/* 0x00001700 */ NULL,
+	/* 0x00001800 */ NULL,
+	/* 0x00001900 */ NULL,
+	/* 0x00001a00 */ NULL,
+	/* 0x00001b00 */ NULL,
+	/* 0x00001c00 */ libfshfs_name_case_folding_mappings_0x00001c00,
+	/* 0x00001d00 */ NULL,
+	/* 0x00001e00 */ libfshfs_name_case_folding_mappings_0x00001e00,
+	/* 0x00001f00 */ libfshfs_name_case_folding_mappings_0x00001f00,
+	/* 0x00002000 */ NULL,
+	/* 0x00002100 */ libfshfs_name_case_folding_mappings_0x00002100,
+	/* 0x00002200 */ NULL,
+	/* 0x00002300 */ NULL,
+	/* 0x00002400 */ libfshfs_name_case_folding_mappings_0x00002400,
+	/* 0x00002500 */ NULL,
+	/* 0x00002600 */ NULL,
+	/* 0x00002700 */ NULL,
+	/* 0x00002800 */ NULL,
+	/* 0x00002900 */ NULL,
+	/* 0x00002a00 */ NULL,
+	/* 0x00002b00 */ NULL,
+	/* 0x00002c00 */ libfshfs_name_case_folding_mappings_0x00002c00,
+	/* 0x00002d00 */ NULL,
+	/* 0x00002e00 */ NULL,
+	/* 0x00002f00 */ NULL,
+	/* 0x00003000 */ NULL,
+	/* 0x00003100 */ NULL,
+	/* 0x00003200 */ NULL,
+	/* 0x00003300 */ NULL,
+	/* 0x00003400 */ NULL,
+	/* 0x00003500 */ NULL,
+	/* 0x00003600 */ NULL,
+	/* 0x00003700 */ NULL,
+	/* 0x00003800 */ NULL,
+	/* 0x00003900 */ NULL,
+	/* 0x00003a00 */ NULL,
+	/* 0x00003b00 */ NULL,
+	/* 0x00003c00 */ NULL,
+	/* 0x00003d00 */ NULL,
+	/* 0x00003e00 */ NULL,
+	/* 0x00003f00 */ NULL,
+	/* 0x00004000 */ NULL,
+	/* 0x00004100 */ NULL,
+	/* 0x00004200 */ NULL,
+	/* 0x00004300 */ NULL,
+	/* 0x00004400 */ NULL,
+	/* 0x00004500 */ NULL,
+	/* 0x00004600 */ NULL,
+	/* 0x00004700 */ NULL,
+	/* 0x00004800 */ NULL,
+	/* 0x00004900 */ NULL,
+	/* 0x00004a00 */ NULL,
+	/* 0x00004b00 */ NULL,
+	/* 0x00004c00 */ NULL,
+	/* 0x00004d00 */ NULL,
+	/* 0x00004e00 */ NULL,
+	/* 0x00004f00 */ NULL,
+	/* 0x00005000 */ NULL,
+	/* 0x00005100 */ NULL,
+	/* 0x00005200 */ NULL,
+	/* 0x00005300 */ NULL,
+	/* 0x00005400 */ NULL,
+	/* 0x00005500 */ NULL,
+	/* 0x00005600 */ NULL,
+	/* 0x00005700 */ NULL,
+	/* 0x00005800 */ NULL,
+	/* 0x00005900 */ NULL,
+	/* 0x00005a00 */ NULL,
+	/* 0x00005b00 */ NULL,
+	/* 0x00005c00 */ NULL,
+	/* 0x00005d00 */ NULL,
+	/* 0x00005e00 */ NULL,
+	/* 0x00005f00 */ NULL,
+	/* 0x00006000 */ NULL,
+	/* 0x00006100 */ NULL,
+	/* 0x00006200 */ NULL,
+	/* 0x00006300 */ NULL,
+	/* 0x00006400 */ NULL,
+	/* 0x00006500 */ NULL,
+	/* 0x00006600 */ NULL,
+	/* 0x00006700 */ NULL,
+	/* 0x00006800 */ NULL,
+	/* 0x00006900 */ NULL,
+	/* 0x00006a00 */ NULL,
+	/* 0x00006b00 */ NULL,
+	/* 0x00006c00 */ NULL,
+	/* 0x00006d00 */ NULL,
+	/* 0x00006e00 */ NULL,
+	/* 0x00006f00 */ NULL,
+	/* 0x00007000 */ NULL,
+	/* 0x00007100 */ NULL,
+	/* 0x00007200 */ NULL,
+	/* 0x00007300 */ NULL,
+	/* 0x00007400 */ NULL,
+	/* 0x00007500 */ NULL,
+	/* 0x00007600 */ NULL,
+	/* 0x00007700 */ NULL,
+	/* 0x00007800 */ NULL,
+	/* 0x00007900 */ NULL,
+	/* 0x00007a00 */ NULL,
+	/* 0x00007b00 */ NULL,
+	/* 0x00007c00 */ NULL,
+	/* 0x00007d00 */ NULL,
+	/* 0x00007e00 */ NULL,
+	/* 0x00007f00 */ NULL,
+	/* 0x00008000 */ NULL,
+	/* 0x00008100 */ NULL,
+	/* 0x00008200 */ NULL,
+	/* 0x00008300 */ NULL,
+	/* 0x00008400 */ NULL,
+	/* 0x00008500 */ NULL,
+	/* 0x00008600 */ NULL,
+	/* 0x00008700 */ NULL,
+	/* 0x00008800 */ NULL,
+	/* 0x00008900 */ NULL,
+	/* 0x00008a00 */ NULL,
+	/* 0x00008b00 */ NULL,
+	/* 0x00008c00 */ NULL,
+	/* 0x00008d00 */ NULL,
+	/* 0x00008e00 */ NULL,
+	/* 0x00008f00 */ NULL,
+	/* 0x00009000 */ NULL,
+	/* 0x00009100 */ NULL,
+	/* 0x00009200 */ NULL,
+	/* 0x00009300 */ NULL,
+	/* 0x00009400 */ NULL,
+	/* 0x00009500 */ NULL,
+	/* 0x00009600 */ NULL,
+	/* 0x00009700 */ NULL,
+	/* 0x00009800 */ NULL,
+	/* 0x00009900 */ NULL,
+	/* 0x00009a00 */ NULL,
+	/* 0x00009b00 */ NULL,
+	/* 0x00009c00 */ NULL,
+	/* 0x00009d00 */ NULL,
+	/* 0x00009e00 */ NULL,
+	/* 0x00009f00 */ NULL,
+	/* 0x0000a000 */ NULL,
+	/* 0x0000a100 */ NULL,
+	/* 0x0000a200 */ NULL,
+	/* 0x0000a300 */ NULL,
+	/* 0x0000a400 */ NULL,
+	/* 0x0000a500 */ NULL,
+	/* 0x0000a600 */ libfshfs_name_case_folding_mappings_0x0000a600,
+	/* 0x0000a700 */ libfshfs_name_case_folding_mappings_0x0000a700,
+	/* 0x0000a800 */ NULL,
+	/* 0x0000a900 */ NULL,
+	/* 0x0000aa00 */ NULL,
+	/* 0x0000ab00 */ libfshfs_name_case_folding_mappings_0x0000ab00,
+	/* 0x0000ac00 */ NULL,
+	/* 0x0000ad00 */ NULL,
+	/* 0x0000ae00 */ NULL,
+	/* 0x0000af00 */ NULL,
+	/* 0x0000b000 */ NULL,
+	/* 0x0000b100 */ NULL,
+	/* 0x0000b200 */ NULL,
+	/* 0x0000b300 */ NULL,
+	/* 0x0000b400 */ NULL,
+	/* 0x0000b500 */ NULL,
+	/* 0x0000b600 */ NULL,
+	/* 0x0000b700 */ NULL,
+	/* 0x0000b800 */ NULL,
+	/* 0x0000b900 */ NULL,
+	/* 0x0000ba00 */ NULL,
+	/* 0x0000bb00 */ NULL,
+	/* 0x0000bc00 */ NULL,
+	/* 0x0000bd00 */ NULL,
+	/* 0x0000be00 */ NULL,
+	/* 0x0000bf00 */ NULL,
+	/* 0x0000c000 */ NULL,
+	/* 0x0000c100 */ NULL,
+	/* 0x0000c200 */ NULL,
+	/* 0x0000c300 */ NULL,
+	/* 0x0000c400 */ NULL,
+	/* 0x0000c500 */ NULL,
+	/* 0x0000c600 */ NULL,
+	/* 0x0000c700 */ NULL,
+	/* 0x0000c800 */ NULL,
+	/* 0x0000c900 */ NULL,
+	/* 0x0000ca00 */ NULL,
+	/* 0x0000cb00 */ NULL,
+	/* 0x0000cc00 */ NULL,
+	/* 0x0000cd00 */ NULL,
+	/* 0x0000ce00 */ NULL,
+	/* 0x0000cf00 */ NULL,
+	/* 0x0000d000 */ NULL,
+	/* 0x0000d100 */ NULL,
+	/* 0x0000d200 */ NULL,
+	/* 0x0000d300 */ NULL,
+	/* 0x0000d400 */ NULL,
+	/* 0x0000d500 */ NULL,
+	/* 0x0000d600 */ NULL,
+	/* 0x0000d700 */ NULL,
+	/* 0x0000d800 */ NULL,
+	/* 0x0000d900 */ NULL,
+	/* 0x0000da00 */ NULL,
+	/* 0x0000db00 */ NULL,
+	/* 0x0000dc00 */ NULL,
+	/* 0x0000dd00 */ NULL,
+	/* 0x0000de00 */ NULL,
+	/* 0x0000df00 */ NULL,
+	/* 0x0000e000 */ NULL,
+	/* 0x0000e100 */ NULL,
+	/* 0x0000e200 */ NULL,
+	/* 0x0000e300 */ NULL,
+	/* 0x0000e400 */ NULL,
+	/* 0x0000e500 */ NULL,
+	/* 0x0000e600 */ NULL,
+	/* 0x0000e700 */ NULL,
+	/* 0x0000e800 */ NULL,
+	/* 0x0000e900 */ NULL,
+	/* 0x0000ea00 */ NULL,
+	/* 0x0000eb00 */ NULL,
+	/* 0x0000ec00 */ NULL,
+	/* 0x0000ed00 */ NULL,
+	/* 0x0000ee00 */ NULL,
+	/* 0x0000ef00 */ NULL,
+	/* 0x0000f000 */ NULL,
+	/* 0x0000f100 */ NULL,
+	/* 0x0000f200 */ NULL,
+	/* 0x0000f300 */ NULL,
+	/* 0x0000f400 */ NULL,
+	/* 0x0000f500 */ NULL,
+	/* 0x0000f600 */ NULL,
+	/* 0x0000f700 */ NULL,
+	/* 0x0000f800 */ NULL,
+	/* 0x0000f900 */ NULL,
+	/* 0x0000fa00 */ NULL,
+	/* 0x0000fb00 */ NULL,
+	/* 0x0000fc00 */ NULL,
+	/* 0x0000fd00 */ NULL,
+	/* 0x0000fe00 */ NULL,
+	/* 0x0000ff00 */ libfshfs_name_case_folding_mappings_0x0000ff00,
+	/* 0x00010000 */ NULL,
+	/* 0x00010100 */ NULL,
+	/* 0x00010200 */ NULL,
+	/* 0x00010300 */ NULL,
+	/* 0x00010400 */ libfshfs_name_case_folding_mappings_0x00010400,
+	/* 0x00010500 */ NULL,
+	/* 0x00010600 */ NULL,
+	/* 0x00010700 */ NULL,
+	/* 0x00010800 */ NULL,
+	/* 0x00010900 */ NULL,
+	/* 0x00010a00 */ NULL,
+	/* 0x00010b00 */ NULL,
+	/* 0x00010c00 */ libfshfs_name_case_folding_mappings_0x00010c00,
+	/* 0x00010d00 */ NULL,
+	/* 0x00010e00 */ NULL,
+	/* 0x00010f00 */ NULL,
+	/* 0x00011000 */ NULL,
+	/* 0x00011100 */ NULL,
+	/* 0x00011200 */ NULL,
+	/* 0x00011300 */ NULL,
+	/* 0x00011400 */ NULL,
+	/* 0x00011500 */ NULL,
+	/* 0x00011600 */ NULL,
+	/* 0x00011700 */ NULL,
+	/* 0x00011800 */ libfshfs_name_case_folding_mappings_0x00011800,
+	/* 0x00011900 */ NULL,
+	/* 0x00011a00 */ NULL,
+	/* 0x00011b00 */ NULL,
+	/* 0x00011c00 */ NULL,
+	/* 0x00011d00 */ NULL,
+	/* 0x00011e00 */ NULL,
+	/* 0x00011f00 */ NULL,
+	/* 0x00012000 */ NULL,
+	/* 0x00012100 */ NULL,
+	/* 0x00012200 */ NULL,
+	/* 0x00012300 */ NULL,
+	/* 0x00012400 */ NULL,
+	/* 0x00012500 */ NULL,
+	/* 0x00012600 */ NULL,
+	/* 0x00012700 */ NULL,
+	/* 0x00012800 */ NULL,
+	/* 0x00012900 */ NULL,
+	/* 0x00012a00 */ NULL,
+	/* 0x00012b00 */ NULL,
+	/* 0x00012c00 */ NULL,
+	/* 0x00012d00 */ NULL,
+	/* 0x00012e00 */ NULL,
+	/* 0x00012f00 */ NULL,
+	/* 0x00013000 */ NULL,
+	/* 0x00013100 */ NULL,
+	/* 0x00013200 */ NULL,
+	/* 0x00013300 */ NULL,
+	/* 0x00013400 */ NULL,
+	/* 0x00013500 */ NULL,
+	/* 0x00013600 */ NULL,
+	/* 0x00013700 */ NULL,
+	/* 0x00013800 */ NULL,
+	/* 0x00013900 */ NULL,
+	/* 0x00013a00 */ NULL,
+	/* 0x00013b00 */ NULL,
+	/* 0x00013c00 */ NULL,
+	/* 0x00013d00 */ NULL,
+	/* 0x00013e00 */ NULL,
+	/* 0x00013f00 */ NULL,
+	/* 0x00014000 */ NULL,
+	/* 0x00014100 */ NULL,
+	/* 0x00014200 */ NULL,
+	/* 0x00014300 */ NULL,
+	/* 0x00014400 */ NULL,
+	/* 0x00014500 */ NULL,
+	/* 0x00014600 */ NULL,
+	/* 0x00014700 */ NULL,
+	/* 0x00014800 */ NULL,
+	/* 0x00014900 */ NULL,
+	/* 0x00014a00 */ NULL,
+	/* 0x00014b00 */ NULL,
+	/* 0x00014c00 */ NULL,
+	/* 0x00014d00 */ NULL,
+	/* 0x00014e00 */ NULL,
+	/* 0x00014f00 */ NULL,
+	/* 0x00015000 */ NULL,
+	/* 0x00015100 */ NULL,
+	/* 0x00015200 */ NULL,
+	/* 0x00015300 */ NULL,
+	/* 0x00015400 */ NULL,
+	/* 0x00015500 */ NULL,
+	/* 0x00015600 */ NULL,
+	/* 0x00015700 */ NULL,
+	/* 0x00015800 */ NULL,
+	/* 0x00015900 */ NULL,
+	/* 0x00015a00 */ NULL,
+	/* 0x00015b00 */ NULL,
+	/* 0x00015c00 */ NULL,
+	/* 0x00015d00 */ NULL,
+	/* 0x00015e00 */ NULL,
+	/* 0x00015f00 */ NULL,
+	/* 0x00016000 */ NULL,
+	/* 0x00016100 */ NULL,
+	/* 0x00016200 */ NULL,
+	/* 0x00016300 */ NULL,
+	/* 0x00016400 */ NULL,
+	/* 0x00016500 */ NULL,
+	/* 0x00016600 */ NULL,
+	/* 0x00016700 */ NULL,
+	/* 0x00016800 */ NULL,
+	/* 0x00016900 */ NULL,
+	/* 0x00016a00 */ NULL,
+	/* 0x00016b00 */ NULL,
+	/* 0x00016c00 */ NULL,
+	/* 0x00016d00 */ NULL,
+	/* 0x00016e00 */ NULL,
+	/* 0x00016f00 */ NULL,
+	/* 0x00017000 */ NULL,
+	/* 0x00017100 */ NULL,
+	/* 0x00017200 */ NULL,
+	/* 0x00017300 */ NULL,
+	/* 0x00017400 */ NULL,
+	/* 0x00017500 */ NULL,
+	/* 0x00017600 */ NULL,
+	/* 0x00017700 */ NULL,
+	/* 0x00017800 */ NULL,
+	/* 0x00017900 */ NULL,
+	/* 0x00017a00 */ NULL,
+	/* 0x00017b00 */ NULL,
+	/* 0x00017c00 */ NULL,
+	/* 0x00017d00 */ NULL,
+	/* 0x00017e00 */ NULL,
+	/* 0x00017f00 */ NULL,
+	/* 0x00018000 */ NULL,
+	/* 0x00018100 */ NULL,
+	/* 0x00018200 */ NULL,
+	/* 0x00018300 */ NULL,
+	/* 0x00018400 */ NULL,
+	/* 0x00018500 */ NULL,
+	/* 0x00018600 */ NULL,
+	/* 0x00018700 */ NULL,
+	/* 0x00018800 */ NULL,
+	/* 0x00018900 */ NULL,
+	/* 0x00018a00 */ NULL,
+	/* 0x00018b00 */ NULL,
+	/* 0x00018c00 */ NULL,
+	/* 0x00018d00 */ NULL,
+	/* 0x00018e00 */ NULL,
+	/* 0x00018f00 */ NULL,
+	/* 0x00019000 */ NULL,
+	/* 0x00019100 */ NULL,
+	/* 0x00019200 */ NULL,
+	/* 0x00019300 */ NULL,
+	/* 0x00019400 */ NULL,
+	/* 0x00019500 */ NULL,
+	/* 0x00019600 */ NULL,
+	/* 0x00019700 */ NULL,
+	/* 0x00019800 */ NULL,
+	/* 0x00019900 */ NULL,
+	/* 0x00019a00 */ NULL,
+	/* 0x00019b00 */ NULL,
+	/* 0x00019c00 */ NULL,
+	/* 0x00019d00 */ NULL,
+	/* 0x00019e00 */ NULL,
+	/* 0x00019f00 */ NULL,
+	/* 0x0001a000 */ NULL,
+	/* 0x0001a100 */ NULL,
+	/* 0x0001a200 */ NULL,
+	/* 0x0001a300 */ NULL,
+	/* 0x0001a400 */ NULL,
+	/* 0x0001a500 */ NULL,
+	/* 0x0001a600 */ NULL,
+	/* 0x0001a700 */ NULL,
+	/* 0x0001a800 */ NULL,
+	/* 0x0001a900 */ NULL,
+	/* 0x0001aa00 */ NULL,
+	/* 0x0001ab00 */ NULL,
+	/* 0x0001ac00 */ NULL,
+	/* 0x0001ad00 */ NULL,
+	/* 0x0001ae00 */ NULL,
+	/* 0x0001af00 */ NULL,
+	/* 0x0001b000 */ NULL,
+	/* 0x0001b100 */ NULL,
+	/* 0x0001b200 */ NULL,
+	/* 0x0001b300 */ NULL,
+	/* 0x0001b400 */ NULL,
+	/* 0x0001b500 */ NULL,
+	/* 0x0001b600 */ NULL,
+	/* 0x0001b700 */ NULL,
+	/* 0x0001b800 */ NULL,
+	/* 0x0001b900 */ NULL,
+	/* 0x0001ba00 */ NULL,
+	/* 0x0001bb00 */ NULL,
+	/* 0x0001bc00 */ NULL,
+	/* 0x0001bd00 */ NULL,
+	/* 0x0001be00 */ NULL,
+	/* 0x0001bf00 */ NULL,
+	/* 0x0001c000 */ NULL,
+	/* 0x0001c100 */ NULL,
+	/* 0x0001c200 */ NULL,
+	/* 0x0001c300 */ NULL,
+	/* 0x0001c400 */ NULL,
+	/* 0x0001c500 */ NULL,
+	/* 0x0001c600 */ NULL,
+	/* 0x0001c700 */ NULL,
+	/* 0x0001c800 */ NULL,
+	/* 0x0001c900 */ NULL,
+	/* 0x0001ca00 */ NULL,
+	/* 0x0001cb00 */ NULL,
+	/* 0x0001cc00 */ NULL,
+	/* 0x0001cd00 */ NULL,
+	/* 0x0001ce00 */ NULL,
+	/* 0x0001cf00 */ NULL,
+	/* 0x0001d000 */ NULL,
+	/* 0x0001d100 */ NULL,
+	/* 0x0001d200 */ NULL,
+	/* 0x0001d300 */ NULL,
+	/* 0x0001d400 */ NULL,
+	/* 0x0001d500 */ NULL,
+	/* 0x0001d600 */ NULL,
+	/* 0x0001d700 */ NULL,
+	/* 0x0001d800 */ NULL,
+	/* 0x0001d900 */ NULL,
+	/* 0x0001da00 */ NULL,
+	/* 0x0001db00 */ NULL,
+	/* 0x0001dc00 */ NULL,
+	/* 0x0001dd00 */ NULL,
+	/* 0x0001de00 */ NULL,
+	/* 0x0001df00 */ NULL,
+	/* 0x0001e000 */ NULL,
+	/* 0x0001e100 */ NULL,
+	/* 0x0001e200 */ NULL,
+	/* 0x0001e300 */ NULL,
+	/* 0x0001e400 */ NULL,
+	/* 0x0001e500 */ NULL,
+	/* 0x0001e600 */ NULL,
+	/* 0x0001e700 */ NULL,
+	/* 0x0001e800 */ NULL,
+	/* 0x0001e900 */ libfshfs_name_case_folding_mappings_0x0001e900
+};
+
+/* The data below was derived from ftp://ftp.unicode.org/Public/9.0.0/ucd/UnicodeData.txt
+ */
+
+static libfshfs_name_decomposition_mapping_t libfshfs_name_decomposition_mappings_0x00000000[ 256 ] = {
+	/* 0x00000000 */ { 1, { 0x00000000 } },
+	/* 0x00000001 */ { 1, { 0x00000001 } },
+	/* 0x00000002 */ { 1, { 0x00000002 } },
+	/* 0x00000003 */ { 1, { 0x00000003 } },
+	/* 0x00000004 */ { 1, { 0x00000004 } },
+	/* 0x00000005 */ { 1, { 0x00000005 } },
+	/* 0x00000006 */ { 1, { 0x00000006 } },
+	/* 0x00000007 */ { 1, { 0x00000007 } },
+	/* 0x00000008 */ { 1, { 0x00000008 } },
+	/* 0x00000009 */ { 1, { 0x00000009 } },
+	/* 0x0000000a */ { 1, { 0x0000000a } },
+	/* 0x0000000b */ { 1, { 0x0000000b } },
+	/* 0x0000000c */ { 1, { 0x0000000c } },
+	/* 0x0000000d */ { 1, { 0x0000000d } },
+	/* 0x0000000e */ { 1, { 0x0000000e } },
+	/* 0x0000000f */ { 1, { 0x0000000f } },
+	/* 0x00000010 */ { 1, { 0x00000010 } },
+	/* 0x00000011 */ { 1, { 0x00000011 } },
+	/* 0x00000012 */ { 1, { 0x00000012 } },
+	/* 0x00000013 */ { 1, { 0x00000013 } },
+	/* 0x00000014 */ { 1, { 0x00000014 } },
+	/* 0x00000015 */ { 1, { 0x00000015 } },
+	/* 0x00000016 */ { 1, { 0x00000016 } },
+	/* 0x00000017 */ { 1, { 0x00000017 } },
+	/* 0x00000018 */ { 1, { 0x00000018 } },
+	/* 0x00000019 */ { 1, { 0x00000019 } },
+	/* 0x0000001a */ { 1, { 0x0000001a } },
+	/* 0x0000001b */ { 1, { 0x0000001b } },
+	/* 0x0000001c */ { 1, { 0x0000001c } },
+	/* 0x0000001d */ { 1, { 0x0000001d } },
+	/* 0x0000001e */ { 1, { 0x0000001e } },
+	/* 0x0000001f */ { 1, { 0x0000001f } },
+	/* 0x00000020 */ { 1, { 0x00000020 } },
+	/* 0x00000021 */ { 1, { 0x00000021 } },
+	/* 0x00000022 */ { 1, { 0x00000022 } },
+	/* 0x00000023 */ { 1, { 0x00000023 } },
+	/* 0x00000024 */ { 1, { 0x00000024 } },
+	/* 0x00000025 */ { 1, { 0x00000025 } },
+	/* 0x00000026 */ { 1, { 0x00000026 } },
+	/* 0x00000027 */ { 1, { 0x00000027 } },
+	/* 0x00000028 */ { 1, { 0x00000028 } },
+	/* 0x00000029 */ { 1, { 0x00000029 } },
+	/* 0x0000002a */ { 1, { 0x0000002a } },
+	/* 0x0000002b */ { 1, { 0x0000002b } },
+	/* 0x0000002c */ { 1, { 0x0000002c } },
+	/* 0x0000002d */ { 1, { 0x0000002d } },
+	/* 0x0000002e */ { 1, { 0x0000002e } },
+	/* 0x0000002f */ { 1, { 0x0000002f } },
+	/* 0x00000030 */ { 1, { 0x00000030 } },
+	/* 0x00000031 */ { 1, { 0x00000031 } },
+	/* 0x00000032 */ { 1, { 0x00000032 } },
+	/* 0x00000033 */ { 1, { 0x00000033 } },
+	/* 0x00000034 */ { 1, { 0x00000034 } },
+	/* 0x00000035 */ { 1, { 0x00000035 } },
+	/* 0x00000036 */ { 1, { 0x00000036 } },
+	/* 0x00000037 */ { 1, { 0x00000037 } },
+	/* 0x00000038 */ { 1, { 0x00000038 } },
+	/* 0x00000039 */ { 1, { 0x00000039 } },
+	/* 0x0000003a */ { 1, { 0x0000003a } },
+	/* 0x0000003b */ { 1, { 0x0000003b } },
+	/* 0x0000003c */ { 1, { 0x0000003c } },
+	/* 0x0000003d */ { 1, { 0x0000003d } },
+	/* 0x0000003e */ { 1, { 0x0000003e } },
+	/* 0x0000003f */ { 1, { 0x0000003f } },
+	/* 0x00000040 */ { 1, { 0x00000040 } },
+	/* 0x00000041 */ { 1, { 0x00000041 } },
+	/* 0x00000042 */ { 1, { 0x00000042 } },
+	/* 0x00000043 */ { 1, { 0x00000043 } },
+	/* 0x00000044 */ { 1, { 0x00000044 } },
+	/* 0x00000045 */ { 1, { 0x00000045 } },
+	/* 0x00000046 */ { 1, { 0x00000046 } },
+	/* 0x00000047 */ { 1, { 0x00000047 } },
+	/* 0x00000048 */ { 1, { 0x00000048 } },
+	/* 0x00000049 */ { 1, { 0x00000049 } },
+	/* 0x0000004a */ { 1, { 0x0000004a } },
+	/* 0x0000004b */ { 1, { 0x0000004b } },
+	/* 0x0000004c */ { 1, { 0x0000004c } },
+	/* 0x0000004d */ { 1, { 0x0000004d } },
+	/* 0x0000004e */ { 1, { 0x0000004e } },
+	/* 0x0000004f */ { 1, { 0x0000004f } },
+	/* 0x00000050 */ { 1, { 0x00000050 } },
+	/* 0x00000051 */ { 1, { 0x00000051 } },
+	/* 0x00000052 */ { 1, { 0x00000052 } },
+	/* 0x00000053 */ { 1, { 0x00000053 } },
+	/* 0x00000054 */ { 1, { 0x00000054 } },
+	/* 0x00000055 */ { 1, { 0x00000055 } },
+	/* 0x00000056 */ { 1, { 0x00000056 } },
+	/* 0x00000057 */ { 1, { 0x00000057 } },
+	/* 0x00000058 */ { 1, { 0x00000058 } },
+	/* 0x00000059 */ { 1, { 0x00000059 } },
+	/* 0x0000005a */ { 1, { 0x0000005a } },
+	/* 0x0000005b */ { 1, { 0x0000005b } },
+	/* 0x0000005c */ { 1, { 0x0000005c } },
+	/* 0x0000005d */ { 1, { 0x0000005d } },
+	/* 0x0000005e */ { 1, { 0x0000005e } },
+	/* 0x0000005f */ { 1, { 0x0000005f } },
+	/* 0x00000060 */ { 1, { 0x00000060 } },
+	/* 0x00000061 */ { 1, { 0x00000061 } },
+	/* 0x00000062 */ { 1, { 0x00000062 } },
+	/* 0x00000063 */ { 1, { 0x00000063 } },
+	/* 0x00000064 */ { 1, { 0x00000064 } },
+	/* 0x00000065 */ { 1, { 0x00000065 } },
+	/* 0x00000066 */ { 1, { 0x00000066 } },
+	/* 0x00000067 */ { 1, { 0x00000067 } },
+	/* 0x00000068 */ { 1, { 0x00000068 } },
+	/* 0x00000069 */ { 1, { 0x00000069 } },
+	/* 0x0000006a */ { 1, { 0x0000006a } },
+	/* 0x0000006b */ { 1, { 0x0000006b } },
+	/* 0x0000006c */ { 1, { 0x0000006c } },
+	/* 0x0000006d */ { 1, { 0x0000006d } },
+	/* 0x0000006e */ { 1, { 0x0000006e } },
+	/* 0x0000006f */ { 1, { 0x0000006f } },
+	/* 0x00000070 */ { 1, { 0x00000070 } },
+	/* 0x00000071 */ { 1, { 0x00000071 } },
+	/* 0x00000072 */ { 1, { 0x00000072 } },
+	/* 0x00000073 */ { 1, { 0x00000073 } },
+	/* 0x00000074 */ { 1, { 0x00000074 } },
+	/* 0x00000075 */ { 1, { 0x00000075 } },
+	/* 0x00000076 */ { 1, { 0x00000076 } },
+	/* 0x00000077 */ { 1, { 0x00000077 } },
+	/* 0x00000078 */ { 1, { 0x00000078 } },
+	/* 0x00000079 */ { 1, { 0x00000079 } },
+	/* 0x0000007a */ { 1, { 0x0000007a } },
+	/* 0x0000007b */ { 1, { 0x0000007b } },
+	/* 0x0000007c */ { 1, { 0x0000007c } },
+	/* 0x0000007d */ { 1, { 0x0000007d } },
+	/* 0x0000007e */ { 1, { 0x0000007e } },
+	/* 0x0000007f */ { 1, { 0x0000007f } },
+	/* 0x00000080 */ { 1, { 0x00000080 } },
+	/* 0x00000081 */ { 1, { 0x00000081 } },
+	/* 0x00000082 */ { 1, { 0x00000082 } },
+	/* 0x00000083 */ { 1, { 0x00000083 } },
+	/* 0x00000084 */ { 1, { 0x00000084 } },
+	/* 0x00000085 */ { 1, { 0x00000085 } },
+	/* 0x00000086 */ { 1, { 0x00000086 } },
+	/* 0x00000087 */ { 1, { 0x00000087 } },
+	/* 0x00000088 */ { 1, { 0x00000088 } },
+	/* 0x00000089 */ { 1, { 0x00000089 } },
+	/* 0x0000008a */ { 1, { 0x0000008a } },
+	/* 0x0000008b */ { 1, { 0x0000008b } },
+	/* 0x0000008c */ { 1, { 0x0000008c } },
+	/* 0x0000008d */ { 1, { 0x0000008d } },
+	/* 0x0000008e */ { 1, { 0x0000008e } },
+	/* 0x0000008f */ { 1, { 0x0000008f } },
+	/* 0x00000090 */ { 1, { 0x00000090 } },
+	/* 0x00000091 */ { 1, { 0x00000091 } },
+	/* 0x00000092 */ { 1, { 0x00000092 } },
+	/* 0x00000093 */ { 1, { 0x00000093 } },
+	/* 0x00000094 */ { 1, { 0x00000094 } },
+	/* 0x00000095 */ { 1, { 0x00000095 } },
+	/* 0x00000096 */ { 1, { 0x00000096 } },
+	/* 0x00000097 */ { 1, { 0x00000097 } },
+	/* 0x00000098 */ { 1, { 0x00000098 } },
+	/* 0x00000099 */ { 1, { 0x00000099 } },
+	/* 0x0000009a */ { 1, { 0x0000009a } },
+	/* 0x0000009b */ { 1, { 0x0000009b } },
+	/* 0x0000009c */ { 1, { 0x0000009c } },
+	/* 0x0000009d */ { 1, { 0x0000009d } },
+	/* 0x0000009e */ { 1, { 0x0000009e } },
+	/* 0x0000009f */ { 1, { 0x0000009f } },
+	/* 0x000000a0 */ { 1, { 0x000000a0 } },
+	/* 0x000000a1 */ { 1, { 0x000000a1 } },
+	/* 0x000000a2 */ { 1, { 0x000000a2 } },
+	/* 0x000000a3 */ { 1, { 0x000000a3 } },
+	/* 0x000000a4 */ { 1, { 0x000000a4 } },
+	/* 0x000000a5 */ { 1, { 0x000000a5 } },
+	/* 0x000000a6 */ { 1, { 0x000000a6 } },
+	/* 0x000000a7 */ { 1, { 0x000000a7 } },
+	/* 0x000000a8 */ { 1, { 0x000000a8 } },
+	/* 0x000000a9 */ { 1, { 0x000000a9 } },
+	/* 0x000000aa */ { 1, { 0x000000aa } },
+	/* 0x000000ab */ { 1, { 0x000000ab } },
+	/* 0x000000ac */ { 1, { 0x000000ac } },
+	/* 0x000000ad */ { 1, { 0x000000ad } },
+	/* 0x000000ae */ { 1, { 0x000000ae } },
+	/* 0x000000af */ { 1, { 0x000000af } },
+	/* 0x000000b0 */ { 1, { 0x000000b0 } },
+	/* 0x000000b1 */ { 1, { 0x000000b1 } },
+	/* 0x000000b2 */ { 1, { 0x000000b2 } },
+	/* 0x000000b3 */ { 1, { 0x000000b3 } },
+	/* 0x000000b4 */ { 1, { 0x000000b4 } },
+	/* 0x000000b5 */ { 1, { 0x000000b5 } },
+	/* 0x000000b6 */ { 1, { 0x000000b6 } },
+	/* 0x000000b7 */ { 1, { 0x000000b7 } },
+	/* 0x000000b8 */ { 1, { 0x000000b8 } },
+	/* 0x000000b9 */ { 1, { 0x000000b9 } },
+	/* 0x000000ba */ { 1, { 0x000000ba } },
+	/* 0x000000bb */ { 1, { 0x000000bb } },
+	/* 0x000000bc */ { 1, { 0x000000bc } },
+	/* 0x000000bd */ { 1, { 0x000000bd } },
+	/* 0x000000be */ { 1, { 0x000000be } },
+	/* 0x000000bf */ { 1, { 0x000000bf } },
+	/* 0x000000c0 */ { 2, { 0x00000041, 0x00000300 } },
+	/* 0x000000c1 */ { 2, { 0x00000041, 0x00000301 } },
+	/* 0x000000c2 */ { 2, { 0x00000041, 0x00000302 } },
+	/* 0x000000c3 */ { 2, { 0x00000041, 0x00000303 } },
+	/* 0x000000c4 */ { 2, { 0x00000041, 0x00000308 } },
+	/* 0x000000c5 */ { 2, { 0x00000041, 0x0000030a } },
+	/* 0x000000c6 */ { 1, { 0x000000c6 } },
+	/* 0x000000c7 */ { 2, { 0x00000043, 0x00000327 } },
+	/* 0x000000c8 */ { 2, { 0x00000045, 0x00000300 } },
+	/* 0x000000c9 */ { 2, { 0x00000045, 0x00000301 } },
+	/* 0x000000ca */ { 2, { 0x00000045, 0x00000302 } },
+	/* 0x000000cb */ { 2, { 0x00000045, 0x00000308 } },
+	/* 0x000000cc */ { 2, { 0x00000049, 0x00000300 } },
+	/* 0x000000cd */ { 2, { 0x00000049, 0x00000301 } },
+	/* 0x000000ce */ { 2, { 0x00000049, 0x00000302 } },
+	/* 0x000000cf */ { 2, { 0x00000049, 0x00000308 } },
+	/* 0x000000d0 */ { 1, { 0x000000d0 } },
+	/* 0x000000d1 */ { 2, { 0x0000004e, 0x00000303 } },
+	/* 0x000000d2 */ { 2, { 0x0000004f, 0x00000300 } },
+	/* 0x000000d3 */ { 2, { 0x0000004f, 0x00000301 } },
+	/* 0x000000d4 */ { 2, { 0x0000004f, 0x00000302 } },
+	/* 0x000000d5 */ { 2, { 0x0000004f, 0x00000303 } },
+	/* 0x000000d6 */ { 2, { 0x0000004f, 0x00000308 } },
+	/* 0x000000d7 */ { 1, { 0x000000d7 } },
+	/* 0x000000d8 */ { 1, { 0x000000d8 } },
+	/* 0x000000d9 */ { 2, { 0x00000055, 0x00000300 } },
+	/* 0x000000da */ { 2, { 0x00000055, 0x00000301 } },
+	/* 0x000000db */ { 2, { 0x00000055, 0x00000302 } },
+	/* 0x000000dc */ { 2, { 0x00000055, 0x00000308 } },
+	/* 0x000000dd */ { 2, { 0x00000059, 0x00000301 } },
+	/* 0x000000de */ { 1, { 0x000000de } },
+	/* 0x000000df */ { 1, { 0x000000df } },
+	/* 0x000000e0 */ { 2, { 0x00000061, 0x00000300 } },
+	/* 0x000000e1 */ { 2, { 0x00000061, 0x00000301 } },
+	/* 0x000000e2 */ { 2, { 0x00000061, 0x00000302 } },
+	/* 0x000000e3 */ { 2, { 0x00000061, 0x00000303 } },
+	/* 0x000000e4 */ { 2, { 0x00000061, 0x00000308 } },
+	/* 0x000000e5 */ { 2, { 0x00000061, 0x0000030a } },
+	/* 0x000000e6 */ { 1, { 0x000000e6 } },
+	/* 0x000000e7 */ { 2, { 0x00000063, 0x00000327 } },
+	/* 0x000000e8 */ { 2, { 0x00000065, 0x00000300 } },
+	/* 0x000000e9 */ { 2, { 0x00000065, 0x00000301 } },
+	/* 0x000000ea */ { 2, { 0x00000065, 0x00000302 } },
+	/* 0x000000eb */ { 2, { 0x00000065, 0x00000308 } },
+	/* 0x000000ec */ { 2, { 0x00000069, 0x00000300 } },
+	/* 0x000000ed */ { 2, { 0x00000069, 0x00000301 } },
+	/* 0x000000ee */ { 2, { 0x00000069, 0x00000302 } },
+	/* 0x000000ef */ { 2, { 0x00000069, 0x00000308 } },
+	/* 0x000000f0 */ { 1, { 0x000000f0 } },
+	/* 0x000000f1 */ { 2, { 0x0000006e, 0x00000303 } },
+	/* 0x000000f2 */ { 2, { 0x0000006f, 0x00000300 } },
+	/* 0x000000f3 */ { 2, { 0x0000006f, 0x00000301 } },
+	/* 0x000000f4 */ { 2, { 0x0000006f, 0x00000302 } },
+	/* 0x000000f5 */ { 2, { 0x0000006f, 0x00000303 } },
+	/* 0x000000f6 */ { 2, { 0x0000006f, 0x00000308 } },
+	/* 0x000000f7 */ { 1, { 0x000000f7 } },
+	/* 0x000000f8 */ { 1, { 0x000000f8 } },
+	/* 0x000000f9 */ { 2, { 0x00000075, 0x00000300 } },
+	/* 0x000000fa */ { 2, { 0x00000075, 0x00000301 } },
+	/* 0x000000fb */ { 2, { 0x00000075, 0x00000302 } },
+	/* 0x000000fc */ { 2, { 0x00000075, 0x00000308 } },
+	/* 0x000000fd */ { 2, { 0x00000079, 0x00000301 } },
+	/* 0x000000fe */ { 1, { 0x000000fe } },
+	/* 0x000000ff */ { 2, { 0x00000079, 0x00000308 } }
+};
+
+static libfshfs_name_decomposition_mapping_t libfshfs_name_decomposition_mappings_0x00000100[ 256 ] = {
+	/* 0x00000100 */ { 2, { 0x00000041, 0x00000304 } },
+	/* 0x00000101 */ { 2, { 0x00000061, 0x00000304 } },
+	/* 0x00000102 */ { 2, { 0x00000041, 0x00000306 } },
+	/* 0x00000103 */ { 2, { 0x00000061, 0x00000306 } },
+	/* 0x00000104 */ { 2, { 0x00000041, 0x00000328 } },
+	/* 0x00000105 */ { 2, { 0x00000061, 0x00000328 } },
+	/* 0x00000106 */ { 2, { 0x00000043, 0x00000301 } },
+	/* 0x00000107 */ { 2, { 0x00000063, 0x00000301 } },
+	/* 0x00000108 */ { 2, { 0x00000043, 0x00000302 } },
+	/* 0x00000109 */ { 2, { 0x00000063, 0x00000302 } },
+	/* 0x0000010a */ { 2, { 0x00000043, 0x00000307 } },
+	/* 0x0000010b */ { 2, { 0x00000063, 0x00000307 } },
+	/* 0x0000010c */ { 2, { 0x00000043, 0x0000030c } },
+	/* 0x0000010d */ { 2, { 0x00000063, 0x0000030c } },
+	/* 0x0000010e */ { 2, { 0x00000044, 0x0000030c } },
+	/* 0x0000010f */ { 2, { 0x00000064, 0x0000030c } },
+	/* 0x00000110 */ { 1, { 0x00000110 } },
+	/* 0x00000111 */ { 1, { 0x00000111 } },
+	/* 0x00000112 */ { 2, { 0x00000045, 0x00000304 } },
+	/* 0x00000113 */ { 2, { 0x00000065, 0x00000304 } },
+	/* 0x00000114 */ { 2, { 0x00000045, 0x00000306 } },
+	/* 0x00000115 */ { 2, { 0x00000065, 0x00000306 } },
+	/* 0x00000116 */ { 2, { 0x00000045, 0x00000307 } },
+	/* 0x00000117 */ { 2, { 0x00000065, 0x00000307 } },
+	/* 0x00000118 */ { 2, { 0x00000045, 0x00000328 } },
+	/* 0x00000119 */ { 2, { 0x00000065, 0x00000328 } },
+	/* 0x0000011a */ { 2, { 0x00000045, 0x0000030c } },
+	/* 0x0000011b */ { 2, { 0x00000065, 0x0000030c } },
+	/* 0x0000011c */ { 2, { 0x00000047, 0x00000302 } },
+	/* 0x0000011d */ { 2, { 0x00000067, 0x00000302 } },
+	/* 0x0000011e */ { 2, { 0x00000047, 0x00000306 } },
+	/* 0x0000011f */ { 2, { 0x00000067, 0x00000306 } },
+	/* 0x00000120 */ { 2, { 0x00000047, 0x00000307 } },
+	/* 0x00000121 */ { 2, { 0x00000067, 0x00000307 } },
+	/* 0x00000122 */ { 2, { 0x00000047, 0x00000327 } },
+	/* 0x00000123 */ { 2, { 0x00000067, 0x00000327 } },
+	/* 0x00000124 */ { 2, { 0x00000048, 0x00000302 } },
+	/* 0x00000125 */ { 2, { 0x00000068, 0x00000302 } },
+	/* 0x00000126 */ { 1, { 0x00000126 } },
+	/* 0x00000127 */ { 1, { 0x00000127 } },
+	/* 0x00000128 */ { 2, { 0x00000049, 0x00000303 } },
+	/* 0x00000129 */ { 2, { 0x00000069, 0x00000303 } },
+	/* 0x0000012a */ { 2, { 0x00000049, 0x00000304 } },
+	/* 0x0000012b */ { 2, { 0x00000069, 0x00000304 } },
+	/* 0x0000012c */ { 2, { 0x00000049, 0x00000306 } },
+	/* 0x0000012d */ { 2, { 0x00000069, 0x00000306 } },
+	/* 0x0000012e */ { 2, { 0x00000049, 0x00000328 } },
+	/* 0x0000012f */ { 2, { 0x00000069, 0x00000328 } },
+	/* 0x00000130 */ { 2, { 0x00000049, 0x00000307 } },
+	/* 0x00000131 */ { 1, { 0x00000131 } },
+	/* 0x00000132 */ { 1, { 0x00000132 } },
+	/* 0x00000133 */ { 1, { 0x00000133 } },
+	/* 0x00000134 */ { 2, { 0x0000004a, 0x00000302 } },
+	/* 0x00000135 */ { 2, { 0x0000006a, 0x00000302 } },
+	/* 0x00000136 */ { 2, { 0x0000004b, 0x00000327 } },
+	/* 0x00000137 */ { 2, { 0x0000006b, 0x00000327 } },
+	/* 0x00000138 */ { 1, { 0x00000138 } },
+	/* 0x00000139 */ { 2, { 0x0000004c, 0x00000301 } },
+	/* 0x0000013a */ { 2, { 0x0000006c, 0x00000301 } },
+	/* 0x0000013b */ { 2, { 0x0000004c, 0x00000327 } },
+	/* 0x0000013c */ { 2, { 0x0000006c, 0x00000327 } },
+	/* 0x0000013d */ { 2, { 0x0000004c, 0x0000030c } },
+	/* 0x0000013e */ { 2, { 0x0000006c, 0x0000030c } },
+	/* 0x0000013f */ { 1, { 0x0000013f } },
+	/* 0x00000140 */ { 1, { 0x00000140 } },
+	/* 0x00000141 */ { 1, { 0x00000141 } },
+	/* 0x00000142 */ { 1, { 0x00000142 } },
+	/* 0x00000143 */ { 2, { 0x0000004e, 0x00000301 } },
+	/* 0x00000144 */ { 2, { 0x0000006e, 0x00000301 } },
+	/* 0x00000145 */ { 2, { 0x0000004e, 0x00000327 } },
+	/* 0x00000146 */ { 2, { 0x0000006e, 0x00000327 } },
+	/* 0x00000147 */ { 2, { 0x0000004e, 0x0000030c } },
+	/* 0x00000148 */ { 2, { 0x0000006e, 0x0000030c } },
+	/* 0x00000149 */ { 1, { 0x00000149 } },
+	/* 0x0000014a */ { 1, { 0x0000014a } },
+	/* 0x0000014b */ { 1, { 0x0000014b } },
+	/* 0x0000014c */ { 2, { 0x0000004f, 0x00000304 } },
+	/* 0x0000014d */ { 2, { 0x0000006f, 0x00000304 } },
+	/* 0x0000014e */ { 2, { 0x0000004f, 0x00000306 } },
+	/* 0x0000014f */ { 2, { 0x0000006f, 0x00000306 } },
+	/* 0x00000150 */ { 2, { 0x0000004f, 0x0000030b } },
+	/* 0x00000151 */ { 2, { 0x0000006f, 0x0000030b } },
+	/* 0x00000152 */ { 1, { 0x00000152 } },
+	/* 0x00000153 */ { 1, { 0x00000153 } },
+	/* 0x00000154 */ { 2, { 0x00000052, 0x00000301 } },
+	/* 0x00000155 */ { 2, { 0x00000072, 0x00000301 } },
+	/* 0x00000156 */ { 2, { 0x00000052, 0x00000327 } },
+	/* 0x00000157 */ { 2, { 0x00000072, 0x00000327 } },
+	/* 0x00000158 */ { 2, { 0x00000052, 0x0000030c } },
+	/* 0x00000159 */ { 2, { 0x00000072, 0x0000030c } },
+	/* 0x0000015a */ { 2, { 0x00000053, 0x00000301 } },
+	/* 0x0000015b */ { 2, { 0x00000073, 0x00000301 } },
+	/* 0x0000015c */ { 2, { 0x00000053, 0x00000302 } },
+	/* 0x0000015d */ { 2, { 0x00000073, 0x00000302 } },
+	/* 0x0000015e */ { 2, { 0x00000053, 0x00000327 } },
+	/* 0x0000015f */ { 2, { 0x00000073, 0x00000327 } },
+	/* 0x00000160 */ { 2, { 0x00000053, 0x0000030c } },
+	/* 0x00000161 */ { 2, { 0x00000073, 0x0000030c } },
+	/* 0x00000162 */ { 2, { 0x00000054, 0x00000327 } },
+	/* 0x00000163 */ { 2, { 0x00000074, 0x00000327 } },
+	/* 0x00000164 */ { 2, { 0x00000054, 0x0000030c } },
+	/* 0x00000165 */ { 2, { 0x00000074, 0x0000030c } },
+	/* 0x00000166 */ { 1, { 0x00000166 } },
+	/* 0x00000167 */ { 1, { 0x00000167 } },
+	/* 0x00000168 */ { 2, { 0x00000055, 0x00000303 } },
+	/* 0x00000169 */ { 2, { 0x00000075, 0x00000303 } },
+	/* 0x0000016a */ { 2, { 0x00000055, 0x00000304 } },
+	/* 0x0000016b */ { 2, { 0x00000075, 0x00000304 } },
+	/* 0x0000016c */ { 2, { 0x00000055, 0x00000306 } },
+	/* 0x0000016d */ { 2, { 0x00000075, 0x00000306 } },
+	/* 0x0000016e */ { 2, { 0x00000055, 0x0000030a } },
+	/* 0x0000016f */ { 2, { 0x00000075, 0x0000030a } },
+	/* 0x00000170 */ { 2, { 0x00000055, 0x0000030b } },
+	/* 0x00000171 */ { 2, { 0x00000075, 0x0000030b } },
+	/* 0x00000172 */ { 2, { 0x00000055, 0x00000328 } },
+	/* 0x00000173 */ { 2, { 0x00000075, 0x00000328 } },
+	/* 0x00000174 */ { 2, { 0x00000057, 0x00000302 } },
+	/* 0x00000175 */ { 2, { 0x00000077, 0x00000302 } },
+	/* 0x00000176 */ { 2, { 0x00000059, 0x00000302 } },
+	/* 0x00000177 */ { 2, { 0x00000079, 0x00000302 } },
+	/* 0x00000178 */ { 2, { 0x00000059, 0x00000308 } },
+	/* 0x00000179 */ { 2, { 0x0000005a, 0x00000301 } },
+	/* 0x0000017a */ { 2, { 0x0000007a, 0x00000301 } },
+	/* 0x0000017b */ { 2, { 0x0000005a, 0x00000307 } },
+	/* 0x0000017c */ { 2, { 0x0000007a, 0x00000307 } },
+	/* 0x0000017d */ { 2, { 0x0000005a, 0x0000030c } },
+	/* 0x0000017e */ { 2, { 0x0000007a, 0x0000030c } },
+	/* 0x0000017f */ { 1, { 0x0000017f } },
+	/* 0x00000180 */ { 1, { 0x00000180 } },
+	/* 0x00000181 */ { 1, { 0x00000181 } },
+	/* 0x00000182 */ { 1, { 0x00000182 } },
+	/* 0x00000183 */ { 1, { 0x00000183 } },
+	/* 0x00000184 */ { 1, { 0x00000184 } },
+	/* 0x00000185 */ { 1, { 0x00000185 } },
+	/* 0x00000186 */ { 1, { 0x00000186 } },
+	/* 0x00000187 */ { 1, { 0x00000187 } },
+	/* 0x00000188 */ { 1, { 0x00000188 } },
+	/* 0x00000189 */ { 1, { 0x00000189 } },
+	/* 0x0000018a */ { 1, { 0x0000018a } },
+	/* 0x0000018b */ { 1, { 0x0000018b } },
+	/* 0x0000018c */ { 1, { 0x0000018c } },
+	/* 0x0000018d */ { 1, { 0x0000018d } },
+	/* 0x0000018e */ { 1, { 0x0000018e } },
+	/* 0x0000018f */ { 1, { 0x0000018f } },
+	/* 0x00000190 */ { 1, { 0x00000190 } },
+	/* 0x00000191 */ { 1, { 0x00000191 } },
+	/* 0x00000192 */ { 1, { 0x00000192 } },
+	/* 0x00000193 */ { 1, { 0x00000193 } },
+	/* 0x00000194 */ { 1, { 0x00000194 } },
+	/* 0x00000195 */ { 1, { 0x00000195 } },
+	/* 0x00000196 */ { 1, { 0x00000196 } },
+	/* 0x00000197 */ { 1, { 0x00000197 } },
+	/* 0x00000198 */ { 1, { 0x00000198 } },
+	/* 0x00000199 */ { 1, { 0x00000199 } },
+	/* 0x0000019a */ { 1, { 0x0000019a } },
+	/* 0x0000019b */ { 1, { 0x0000019b } },
+	/* 0x0000019c */ { 1, { 0x0000019c } },
+	/* 0x0000019d */ { 1, { 0x0000019d } },
+	/* 0x0000019e */ { 1, { 0x0000019e } },
+	/* 0x0000019f */ { 1, { 0x0000019f } },
+	/* 0x000001a0 */ { 2, { 0x0000004f, 0x0000031b } },
+	/* 0x000001a1 */ { 2, { 0x0000006f, 0x0000031b } },
+	/* 0x000001a2 */ { 1, { 0x000001a2 } },
+	/* 0x000001a3 */ { 1, { 0x000001a3 } },
+	/* 0x000001a4 */ { 1, { 0x000001a4 } },
+	/* 0x000001a5 */ { 1, { 0x000001a5 } },
+	/* 0x000001a6 */ { 1, { 0x000001a6 } },
+	/* 0x000001a7 */ { 1, { 0x000001a7 } },
+	/* 0x000001a8 */ { 1, { 0x000001a8 } },
+	/* 0x000001a9 */ { 1, { 0x000001a9 } },
+	/* 0x000001aa */ { 1, { 0x000001aa } },
+	/* 0x000001ab */ { 1, { 0x000001ab } },
+	/* 0x000001ac */ { 1, { 0x000001ac } },
+	/* 0x000001ad */ { 1, { 0x000001ad } },
+	/* 0x000001ae */ { 1, { 0x000001ae } },
+	/* 0x000001af */ { 2, { 0x00000055, 0x0000031b } },
+	/* 0x000001b0 */ { 2, { 0x00000075, 0x0000031b } },
+	/* 0x000001b1 */ { 1, { 0x000001b1 } },
+	/* 0x000001b2 */ { 1, { 0x000001b2 } },
+	/* 0x000001b3 */ { 1, { 0x000001b3 } },
+	/* 0x000001b4 */ { 1, { 0x000001b4 } },
+	/* 0x000001b5 */ { 1, { 0x000001b5 } },
+	/* 0x000001b6 */ { 1, { 0x000001b6 } },
+	/* 0x000001b7 */ { 1, { 0x000001b7 } },
+	/* 0x000001b8 */ { 1, { 0x000001b8 } },
+	/* 0x000001b9 */ { 1, { 0x000001b9 } },
+	/* 0x000001ba */ { 1, { 0x000001ba } },
+	/* 0x000001bb */ { 1, { 0x000001bb } },
+	/* 0x000001bc */ { 1, { 0x000001bc } },
+	/* 0x000001bd */ { 1, { 0x000001bd } },
+	/* 0x000001be */ { 1, { 0x000001be } },
+	/* 0x000001bf */ { 1, { 0x000001bf } },
+	/* 0x000001c0 */ { 1, { 0x000001c0 } },
+	/* 0x000001c1 */ { 1, { 0x000001c1 } },
+	/* 0x000001c2 */ { 1, { 0x000001c2 } },
+	/* 0x000001c3 */ { 1, { 0x000001c3 } },
+	/* 0x000001c4 */ { 1, { 0x000001c4 } },
+	/* 0x000001c5 */ { 1, { 0x000001c5 } },
+	/* 0x000001c6 */ { 1, { 0x000001c6 } },
+	/* 0x000001c7 */ { 1, { 0x000001c7 } },
+	/* 0x000001c8 */ { 1, { 0x000001c8 } },
+	/* 0x000001c9 */ { 1, { 0x000001c9 } },
+	/* 0x000001ca */ { 1, { 0x000001ca } },
+	/* 0x000001cb */ { 1, { 0x000001cb } },
+	/* 0x000001cc */ { 1, { 0x000001cc } },
+	/* 0x000001cd */ { 2, { 0x00000041, 0x0000030c } },
+	/* 0x000001ce */ { 2, { 0x00000061, 0x0000030c } },
+	/* 0x000001cf */ { 2, { 0x00000049, 0x0000030c } },
+	/* 0x000001d0 */ { 2, { 0x00000069, 0x0000030c } },
+	/* 0x000001d1 */ { 2, { 0x0000004f, 0x0000030c } },
+	/* 0x000001d2 */ { 2, { 0x0000006f, 0x0000030c } },
+	/* 0x000001d3 */ { 2, { 0x00000055, 0x0000030c } },
+	/* 0x000001d4 */ { 2, { 0x00000075, 0x0000030c } },
+	/* 0x000001d5 */ { 3, { 0x00000055, 0x00000308, 0x00000304 } },
+	/* 0x000001d6 */ { 3, { 0x00000075, 0x00000308, 0x00000304 } },
+	/* 0x000001d7 */ { 3, { 0x00000055, 0x00000308, 0x00000301 } },
+	/* 0x000001d8 */ { 3, { 0x00000075, 0x00000308, 0x00000301 } },
+	/* 0x000001d9 */ { 3, { 0x00000055, 0x00000308, 0x0000030c } },
+	/* 0x000001da */ { 3, { 0x00000075, 0x00000308, 0x0000030c } },
+	/* 0x000001db */ { 3, { 0x00000055, 0x00000308, 0x00000300 } },
+	/* 0x000001dc */ { 3, { 0x00000075, 0x00000308, 0x00000300 } },
+	/* 0x000001dd */ { 1, { 0x000001dd } },
+	/* 0x000001de */ { 3, { 0x00000041, 0x00000308, 0x00000304 } },
+	/* 0x000001df */ { 3, { 0x00000061, 0x00000308, 0x00000304 } },
+	/* 0x000001e0 */ { 3, { 0x00000041, 0x00000307, 0x00000304 } },
+	/* 0x000001e1 */ { 3, { 0x00000061, 0x00000307, 0x00000304 } },
+	/* 0x000001e2 */ { 2, { 0x000000c6, 0x00000304 } },
+	/* 0x000001e3 */ { 2, { 0x000000e6, 0x00000304 } },
+	/* 0x000001e4 */ { 1, { 0x000001e4 } },
+	/* 0x000001e5 */ { 1, { 0x000001e5 } },
+	/* 0x000001e6 */ { 2, { 0x00000047, 0x0000030c } },
+	/* 0x000001e7 */ { 2, { 0x00000067, 0x0000030c } },
+	/* 0x000001e8 */ { 2, { 0x0000004b, 0x0000030c } },
+	/* 0x000001e9 */ { 2, { 0x0000006b, 0x0000030c } },
+	/* 0x000001ea */ { 2, { 0x0000004f, 0x00000328 } },
+	/* 0x000001eb */ { 2, { 0x0000006f, 0x00000328 } },
+	/* 0x000001ec */ { 3, { 0x0000004f, 0x00000328, 0x00000304 } },
+	/* 0x000001ed */ { 3, { 0x0000006f, 0x00000328, 0x00000304 } },
+	/* 0x000001ee */ { 2, { 0x000001b7, 0x0000030c } },
+	/* 0x000001ef */ { 2, { 0x00000292, 0x0000030c } },
+	/* 0x000001f0 */ { 2, { 0x0000006a, 0x0000030c } },
+	/* 0x000001f1 */ { 1, { 0x000001f1 } },
+	/* 0x000001f2 */ { 1, { 0x000001f2 } },
+	/* 0x000001f3 */ { 1, { 0x000001f3 } },
+	/* 0x000001f4 */ { 2, { 0x00000047, 0x00000301 } },
+	/* 0x000001f5 */ { 2, { 0x00000067, 0x00000301 } },
+	/* 0x000001f6 */ { 1, { 0x000001f6 } },
+	/* 0x000001f7 */ { 1, { 0x000001f7 } },
+	/* 0x000001f8 */ { 2, { 0x0000004e, 0x00000300 } },
+	/* 0x000001f9 */ { 2, { 0x0000006e, 0x00000300 } },
+	/* 0x000001fa */ { 3, { 0x00000041, 0x0000030a, 0x00000301 } },
+	/* 0x000001fb */ { 3, { 0x00000061, 0x0000030a, 0x00000301 } },
+	/* 0x000001fc */ { 2, { 0x000000c6, 0x00000301 } },
+	/* 0x000001fd */ { 2, { 0x000000e6, 0x00000301 } },
+	/* 0x000001fe */ { 2, { 0x000000d8, 0x00000301 } },
+	/* 0x000001ff */ { 2, { 0x000000f8, 0x00000301 } }
+};
+
+static libfshfs_name_decomposition_mapping_t libfshfs_name_decomposition_mappings_0x00000200[ 256 ] = {
+	/* 0x00000200 */ { 2, { 0x00000041, 0x0000030f } },
+	/* 0x00000201 */ { 2, { 0x00000061, 0x0000030f } },
+	/* 0x00000202 */ { 2, { 0x00000041, 0x00000311 } },
+	/* 0x00000203 */ { 2, { 0x00000061, 0x00000311 } },
+	/* 0x00000204 */ { 2, { 0x00000045, 0x0000030f } },
+	/* 0x00000205 */ { 2, { 0x00000065, 0x0000030f } },
+	/* 0x00000206 */ { 2, { 0x00000045, 0x00000311 } },
+	/* 0x00000207 */ { 2, { 0x00000065, 0x00000311 } },
+	/* 0x00000208 */ { 2, { 0x00000049, 0x0000030f } },
+	/* 0x00000209 */ { 2, { 0x00000069, 0x0000030f } },
+	/* 0x0000020a */ { 2, { 0x00000049, 0x00000311 } },
+	/* 0x0000020b */ { 2, { 0x00000069, 0x00000311 } },
+	/* 0x0000020c */ { 2, { 0x0000004f, 0x0000030f } },
+	/* 0x0000020d */ { 2, { 0x0000006f, 0x0000030f } },
+	/* 0x0000020e */ { 2, { 0x0000004f, 0x00000311 } },
+	/* 0x0000020f */ { 2, { 0x0000006f, 0x00000311 } },
+	/* 0x00000210 */ { 2, { 0x00000052, 0x0000030f } },
+	/* 0x00000211 */ { 2, { 0x00000072, 0x0000030f } },
+	/* 0x00000212 */ { 2, { 0x00000052, 0x00000311 } },
+	/* 0x00000213 */ { 2, { 0x00000072, 0x00000311 } },
+	/* 0x00000214 */ { 2, { 0x00000055, 0x0000030f } },
+	/* 0x00000215 */ { 2, { 0x00000075, 0x0000030f } },
+	/* 0x00000216 */ { 2, { 0x00000055, 0x00000311 } },
+	/* 0x00000217 */ { 2, { 0x00000075, 0x00000311 } },
+	/* 0x00000218 */ { 2, { 0x00000053, 0x00000326 } },
+	/* 0x00000219 */ { 2, { 0x00000073, 0x00000326 } },
+	/* 0x0000021a */ { 2, { 0x00000054, 0x00000326 } },
+	/* 0x0000021b */ { 2, { 0x00000074, 0x00000326 } },
+	/* 0x0000021c */ { 1, { 0x0000021c } },
+	/* 0x0000021d */ { 1, { 0x0000021d } },
+	/* 0x0000021e */ { 2, { 0x00000048, 0x0000030c } },
+	/* 0x0000021f */ { 2, { 0x00000068, 0x0000030c } },
+	/* 0x00000220 */ { 1, { 0x00000220 } },
+	/* 0x00000221 */ { 1, { 0x00000221 } },
+	/* 0x00000222 */ { 1, { 0x00000222 } },
+	/* 0x00000223 */ { 1, { 0x00000223 } },
+	/* 0x00000224 */ { 1, { 0x00000224 } },
+	/* 0x00000225 */ { 1, { 0x00000225 } },
+	/* 0x00000226 */ { 2, { 0x00000041, 0x00000307 } },
+	/* 0x00000227 */ { 2, { 0x00000061, 0x00000307 } },
+	/* 0x00000228 */ { 2, { 0x00000045, 0x00000327 } },
+	/* 0x00000229 */ { 2, { 0x00000065, 0x00000327 } },
+	/* 0x0000022a */ { 3, { 0x0000004f, 0x00000308, 0x00000304 } },
+	/* 0x0000022b */ { 3, { 0x0000006f, 0x00000308, 0x00000304 } },
+	/* 0x0000022c */ { 3, { 0x0000004f, 0x00000303, 0x00000304 } },
+	/* 0x0000022d */ { 3, { 0x0000006f, 0x00000303, 0x00000304 } },
+	/* 0x0000022e */ { 2, { 0x0000004f, 0x00000307 } },
+	/* 0x0000022f */ { 2, { 0x0000006f, 0x00000307 } },
+	/* 0x00000230 */ { 3, { 0x0000004f, 0x00000307, 0x00000304 } },
+	/* 0x00000231 */ { 3, { 0x0000006f, 0x00000307, 0x00000304 } },
+	/* 0x00000232 */ { 2, { 0x00000059, 0x00000304 } },
+	/* 0x00000233 */ { 2, { 0x00000079, 0x00000304 } },
+	/* 0x00000234 */ { 1, { 0x00000234 } },
+	/* 0x00000235 */ { 1, { 0x00000235 } },
+	/* 0x00000236 */ { 1, { 0x00000236 } },
+	/* 0x00000237 */ { 1, { 0x00000237 } },
+	/* 0x00000238 */ { 1, { 0x00000238 } },
+	/* 0x00000239 */ { 1, { 0x00000239 } },
+	/* 0x0000023a */ { 1, { 0x0000023a } },
+	/* 0x0000023b */ { 1, { 0x0000023b } },
+	/* 0x0000023c */ { 1, { 0x0000023c } },
+	/* 0x0000023d */ { 1, { 0x0000023d } },
+	/* 0x0000023e */ { 1, { 0x0000023e } },
+	/* 0x0000023f */ { 1, { 0x0000023f } },
+	/* 0x00000240 */ { 1, { 0x00000240 } },
+	/* 0x00000241 */ { 1, { 0x00000241 } },
+	/* 0x00000242 */ { 1, { 0x00000242 } },
+	/* 0x00000243 */ { 1, { 0x00000243 } },
+	/* 0x00000244 */ { 1, { 0x00000244 } },
+	/* 0x00000245 */ { 1, { 0x00000245 } },
+	/* 0x00000246 */ { 1, { 0x00000246 } },
+	/* 0x00000247 */ { 1, { 0x00000247 } },
+	/* 0x00000248 */ { 1, { 0x00000248 } },
+	/* 0x00000249 */ { 1, { 0x00000249 } },
+	/* 0x0000024a */ { 1, { 0x0000024a } },
+	/* 0x0000024b */ { 1, { 0x0000024b } },
+	/* 0x0000024c */ { 1, { 0x0000024c } },
+	/* 0x0000024d */ { 1, { 0x0000024d } },
+	/* 0x0000024e */ { 1, { 0x0000024e } },
+	/* 0x0000024f */ { 1, { 0x0000024f } },
+	/* 0x00000250 */ { 1, { 0x00000250 } },
+	/* 0x00000251 */ { 1, { 0x00000251 } },
+	/* 0x00000252 */ { 1, { 0x00000252 } },
+	/* 0x00000253 */ { 1, { 0x00000253 } },
+	/* 0x00000254 */ { 1, { 0x00000254 } },
+	/* 0x00000255 */ { 1, { 0x00000255 } },
+	/* 0x00000256 */ { 1, { 0x00000256 } },
+	/* 0x00000257 */ { 1, { 0x00000257 } },
+	/* 0x00000258 */ { 1, { 0x00000258 } },
+	/* 0x00000259 */ { 1, { 0x00000259 } },
+	/* 0x0000025a */ { 1, { 0x0000025a } },
+	/* 0x0000025b */ { 1, { 0x0000025b } },
+	/* 0x0000025c */ { 1, { 0x0000025c } },
+	/* 0x0000025d */ { 1, { 0x0000025d } },
+	/* 0x0000025e */ { 1, { 0x0000025e } },
+	/* 0x0000025f */ { 1, { 0x0000025f } },
+	/* 0x00000260 */ { 1, { 0x00000260 } },
+	/* 0x00000261 */ { 1, { 0x00000261 } },
+	/* 0x00000262 */ { 1, { 0x00000262 } },
+	/* 0x00000263 */ { 1, { 0x00000263 } },
+	/* 0x00000264 */ { 1, { 0x00000264 } },
+	/* 0x00000265 */ { 1, { 0x00000265 } },
+	/* 0x00000266 */ { 1, { 0x00000266 } },
+	/* 0x00000267 */ { 1, { 0x00000267 } },
+	/* 0x00000268 */ { 1, { 0x00000268 } },
+	/* 0x00000269 */ { 1, { 0x00000269 } },
+	/* 0x0000026a */ { 1, { 0x0000026a } },
+	/* 0x0000026b */ { 1, { 0x0000026b } },
+	/* 0x0000026c */ { 1, { 0x0000026c } },
+	/* 0x0000026d */ { 1, { 0x0000026d } },
+	/* 0x0000026e */ { 1, { 0x0000026e } },
+	/* 0x0000026f */ { 1, { 0x0000026f } },
+	/* 0x00000270 */ { 1, { 0x00000270 } },
+	/* 0x00000271 */ { 1, { 0x00000271 } },
+	/* 0x00000272 */ { 1, { 0x00000272 } },
+	/* 0x00000273 */ { 1, { 0x00000273 } },
+	/* 0x00000274 */ { 1, { 0x00000274 } },
+	/* 0x00000275 */ { 1, { 0x00000275 } },
+	/* 0x00000276 */ { 1, { 0x00000276 } },
+	/* 0x00000277 */ { 1, { 0x00000277 } },
+	/* 0x00000278 */ { 1, { 0x00000278 } },
+	/* 0x00000279 */ { 1, { 0x00000279 } },
+	/* 0x0000027a */ { 1, { 0x0000027a } },
+	/* 0x0000027b */ { 1, { 0x0000027b } },
+	/* 0x0000027c */ { 1, { 0x0000027c } },
+	/* 0x0000027d */ { 1, { 0x0000027d } },
+	/* 0x0000027e */ { 1, { 0x0000027e } },
+	/* 0x0000027f */ { 1, { 0x0000027f } },
+	/* 0x00000280 */ { 1, { 0x00000280 } },
+	/* 0x00000281 */ { 1, { 0x00000281 } },
+	/* 0x00000282 */ { 1, { 0x00000282 } },
+	/* 0x00000283 */ { 1, { 0x00000283 } },
+	/* 0x00000284 */ { 1, { 0x00000284 } },
+	/* 0x00000285 */ { 1, { 0x00000285 } },
+	/* 0x00000286 */ { 1, { 0x00000286 } },
+	/* 0x00000287 */ { 1, { 0x00000287 } },
+	/* 0x00000288 */ { 1, { 0x00000288 } },
+	/* 0x00000289 */ { 1, { 0x00000289 } },
+	/* 0x0000028a */ { 1, { 0x0000028a } },
+	/* 0x0000028b */ { 1, { 0x0000028b } },
+	/* 0x0000028c */ { 1, { 0x0000028c } },
+	/* 0x0000028d */ { 1, { 0x0000028d } },
+	/* 0x0000028e */ { 1, { 0x0000028e } },
+	/* 0x0000028f */ { 1, { 0x0000028f } },
+	/* 0x00000290 */ { 1, { 0x00000290 } },
+	/* 0x00000291 */ { 1, { 0x00000291 } },
+	/* 0x00000292 */ { 1, { 0x00000292 } },
+	/* 0x00000293 */ { 1, { 0x00000293 } },
+	/* 0x00000294 */ { 1, { 0x00000294 } },
+	/* 0x00000295 */ { 1, { 0x00000295 } },
+	/* 0x00000296 */ { 1, { 0x00000296 } },
+	/* 0x00000297 */ { 1, { 0x00000297 } },
+	/* 0x00000298 */ { 1, { 0x00000298 } },
+	/* 0x00000299 */ { 1, { 0x00000299 } },
+	/* 0x0000029a */ { 1, { 0x0000029a } },
+	/* 0x0000029b */ { 1, { 0x0000029b } },
+	/* 0x0000029c */ { 1, { 0x0000029c } },
+	/* 0x0000029d */ { 1, { 0x0000029d } },
+	/* 0x0000029e */ { 1, { 0x0000029e } },
+	/* 0x0000029f */ { 1, { 0x0000029f } },
+	/* 0x000002a0 */ { 1, { 0x000002a0 } },
+	/* 0x000002a1 */ { 1, { 0x000002a1 } },
+	/* 0x000002a2 */ { 1, { 0x000002a2 } },
+	/* 0x000002a3 */ { 1, { 0x000002a3 } },
+	/* 0x000002a4 */ { 1, { 0x000002a4 } },
+	/* 0x000002a5 */ { 1, { 0x000002a5 } },
+	/* 0x000002a6 */ { 1, { 0x000002a6 } },
+	/* 0x000002a7 */ { 1, { 0x000002a7 } },
+	/* 0x000002a8 */ { 1, { 0x000002a8 } },
+	/* 0x000002a9 */ { 1, { 0x000002a9 } },
+	/* 0x000002aa */ { 1, { 0x000002aa } },
+	/* 0x000002ab */ { 1, { 0x000002ab } },
+	/* 0x000002ac */ { 1, { 0x000002ac } },
+	/* 0x000002ad */ { 1, { 0x000002ad } },
+	/* 0x000002ae */ { 1, { 0x000002ae } },
+	/* 0x000002af */ { 1, { 0x000002af } },
+	/* 0x000002b0 */ { 1, { 0x000002b0 } },
+	/* 0x000002b1 */ { 1, { 0x000002b1 } },
+	/* 0x000002b2 */ { 1, { 0x000002b2 } },
+	/* 0x000002b3 */ { 1, { 0x000002b3 } },
+	/* 0x000002b4 */ { 1, { 0x000002b4 } },
+	/* 0x000002b5 */ { 1, { 0x000002b5 } },
+	/* 0x000002b6 */ { 1, { 0x000002b6 } },
+	/* 0x000002b7 */ { 1, { 0x000002b7 } },
+	/* 0x000002b8 */ { 1, { 0x000002b8 } },
+	/* 0x000002b9 */ { 1, { 0x000002b9 } },
+	/* 0x000002ba */ { 1, { 0x000002ba } },
+	/* 0x000002bb */ { 1, { 0x000002bb } },
+	/* 0x000002bc */ { 1, { 0x000002bc } },
+	/* 0x000002bd */ { 1, { 0x000002bd } },
+	/* 0x000002be */ { 1, { 0x000002be } },
+	/* 0x000002bf */ { 1, { 0x000002bf } },
+	/* 0x000002c0 */ { 1, { 0x000002c0 } },
+	/* 0x000002c1 */ { 1, { 0x000002c1 } },
+	/* 0x000002c2 */ { 1, { 0x000002c2 } },
+	/* 0x000002c3 */ { 1, { 0x000002c3 } },
+	/* 0x000002c4 */ { 1, { 0x000002c4 } },
+	/* 0x000002c5 */ { 1, { 0x000002c5 } },
+	/* 0x000002c6 */ { 1, { 0x000002c6 } },
+	/* 0x000002c7 */ { 1, { 0x000002c7 } },
+	/* 0x000002c8 */ { 1, { 0x000002c8 } },
+	/* 0x000002c9 */ { 1, { 0x000002c9 } },
+	/* 0x000002ca */ { 1, { 0x000002ca } },
+	/* 0x000002cb */ { 1, { 0x000002cb } },
+	/* 0x000002cc */ { 1, { 0x000002cc } },
+	/* 0x000002cd */ { 1, { 0x000002cd } },
+	/* 0x000002ce */ { 1, { 0x000002ce } },
+	/* 0x000002cf */ { 1, { 0x000002cf } },
+	/* 0x000002d0 */ { 1, { 0x000002d0 } },
+	/* 0x000002d1 */ { 1, { 0x000002d1 } },
+	/* 0x000002d2 */ { 1, { 0x000002d2 } },
+	/* 0x000002d3 */ { 1, { 0x000002d3 } },
+	/* 0x000002d4 */ { 1, { 0x000002d4 } },
+	/* 0x000002d5 */ { 1, { 0x000002d5 } },
+	/* 0x000002d6 */ { 1, { 0x000002d6 } },
+	/* 0x000002d7 */ { 1, { 0x000002d7 } },
+	/* 0x000002d8 */ { 1, { 0x000002d8 } },
+	/* 0x000002d9 */ { 1, { 0x000002d9 } },
+	/* 0x000002da */ { 1, { 0x000002da } },
+	/* 0x000002db */ { 1, { 0x000002db } },
+	/* 0x000002dc */ { 1, { 0x000002dc } },
+	/* 0x000002dd */ { 1, { 0x000002dd } },
+	/* 0x000002de */ { 1, { 0x000002de } },
+	/* 0x000002df */ { 1, { 0x000002df } },
+	/* 0x000002e0 */ { 1, { 0x000002e0 } },
+	/* 0x000002e1 */ { 1, { 0x000002e1 } },
+	/* 0x000002e2 */ { 1, { 0x000002e2 } },
+	/* 0x000002e3 */ { 1, { 0x000002e3 } },
+	/* 0x000002e4 */ { 1, { 0x000002e4 } },
+	/* 0x000002e5 */ { 1, { 0x000002e5 } },
+	/* 0x000002e6 */ { 1, { 0x000002e6 } },
+	/* 0x000002e7 */ { 1, { 0x000002e7 } },
+	/* 0x000002e8 */ { 1, { 0x000002e8 } },
+	/* 0x000002e9 */ { 1, { 0x000002e9 } },
+	/* 0x000002ea */ { 1, { 0x000002ea } },
+	/* 0x000002eb */ { 1, { 0x000002eb } },
+	/* 0x000002ec */ { 1, { 0x000002ec } },
+	/* 0x000002ed */ { 1, { 0x000002ed } },
+	/* 0x000002ee */ { 1, { 0x000002ee } },
+	/* 0x000002ef */ { 1, { 0x000002ef } },
+	/* 0x000002f0 */ { 1, { 0x000002f0 } },
+	/* 0x000002f1 */ { 1, { 0x000002f1 } },
+	/* 0x000002f2 */ { 1, { 0x000002f2 } },
+	/* 0x000002f3 */ { 1, { 0x000002f3 } },
+	/* 0x000002f4 */ { 1, { 0x000002f4 } },
+	/* 0x000002f5 */ { 1, { 0x000002f5 } },
+	/* 0x000002f6 */ { 1, { 0x000002f6 } },
+	/* 0x000002f7 */ { 1, { 0x000002f7 } },
+	/* 0x000002f8 */ { 1, { 0x000002f8 } },
+	/* 0x000002f9 */ { 1, { 0x000002f9 } },
+	/* 0x000002fa */ { 1, { 0x000002fa } },
+	/* 0x000002fb */ { 1, { 0x000002fb } },
+	/* 0x000002fc */ { 1, { 0x000002fc } },
+	/* 0x000002fd */ { 1, { 0x000002fd } },
+	/* 0x000002fe */ { 1, { 0x000002fe } },
+	/* 0x000002ff */ { 1, { 0x000002ff } }
+};
+
+static libfshfs_name_decomposition_mapping_t libfshfs_name_decomposition_mappings_0x00000300[ 256 ] = {
+	/* 0x00000300 */ { 1, { 0x00000300 } },
+	/* 0x00000301 */ { 1, { 0x00000301 } },
+	/* 0x00000302 */ { 1, { 0x00000302 } },
+	/* 0x00000303 */ { 1, { 0x00000303 } },
+	/* 0x00000304 */ { 1, { 0x00000304 } },
+	/* 0x00000305 */ { 1, { 0x00000305 } },
+	/* 0x00000306 */ { 1, { 0x00000306 } },
+	/* 0x00000307 */ { 1, { 0x00000307 } },
+	/* 0x00000308 */ { 1, { 0x00000308 } },
+	/* 0x00000309 */ { 1, { 0x00000309 } },
+	/* 0x0000030a */ { 1, { 0x0000030a } },
+	/* 0x0000030b */ { 1, { 0x0000030b } },
+	/* 0x0000030c */ { 1, { 0x0000030c } },
+	/* 0x0000030d */ { 1, { 0x0000030d } },
+	/* 0x0000030e */ { 1, { 0x0000030e } },
+	/* 0x0000030f */ { 1, { 0x0000030f } },
+	/* 0x00000310 */ { 1, { 0x00000310 } },
+	/* 0x00000311 */ { 1, { 0x00000311 } },
+	/* 0x00000312 */ { 1, { 0x00000312 } },
+	/* 0x00000313 */ { 1, { 0x00000313 } },
+	/* 0x00000314 */ { 1, { 0x00000314 } },
+	/* 0x00000315 */ { 1, { 0x00000315 } },
+	/* 0x00000316 */ { 1, { 0x00000316 } },
+	/* 0x00000317 */ { 1, { 0x00000317 } },
+	/* 0x00000318 */ { 1, { 0x00000318 } },
+	/* 0x00000319 */ { 1, { 0x00000319 } },
+	/* 0x0000031a */ { 1, { 0x0000031a } },
+	/* 0x0000031b */ { 1, { 0x0000031b } },
+	/* 0x0000031c */ { 1, { 0x0000031c } },
+	/* 0x0000031d */ { 1, { 0x0000031d } },
+	/* 0x0000031e */ { 1, { 0x0000031e } },
+	/* 0x0000031f */ { 1, { 0x0000031f } },
+	/* 0x00000320 */ { 1, { 0x00000320 } },
+	/* 0x00000321 */ { 1, { 0x00000321 } },
+	/* 0x00000322 */ { 1, { 0x00000322 } },
+	/* 0x00000323 */ { 1, { 0x00000323 } },
+	/* 0x00000324 */ { 1, { 0x00000324 } },
+	/* 0x00000325 */ { 1, { 0x00000325 } },
+	/* 0x00000326 */ { 1, { 0x00000326 } },
+	/* 0x00000327 */ { 1, { 0x00000327 } },
+	/* 0x00000328 */ { 1, { 0x00000328 } },
+	/* 0x00000329 */ { 1, { 0x00000329 } },
+	/* 0x0000032a */ { 1, { 0x0000032a } },
+	/* 0x0000032b */ { 1, { 0x0000032b } },
+	/* 0x0000032c */ { 1, { 0x0000032c } },
+	/* 0x0000032d */ { 1, { 0x0000032d } },
+	/* 0x0000032e */ { 1, { 0x0000032e } },
+	/* 0x0000032f */ { 1, { 0x0000032f } },
+	/* 0x00000330 */ { 1, { 0x00000330 } },
+	/* 0x00000331 */ { 1, { 0x00000331 } },
+	/* 0x00000332 */ { 1, { 0x00000332 } },
+	/* 0x00000333 */ { 1, { 0x00000333 } },
+	/* 0x00000334 */ { 1, { 0x00000334 } },
+	/* 0x00000335 */ { 1, { 0x00000335 } },
+	/* 0x00000336 */ { 1, { 0x00000336 } },
+	/* 0x00000337 */ { 1, { 0x00000337 } },
+	/* 0x00000338 */ { 1, { 0x00000338 } },
+	/* 0x00000339 */ { 1, { 0x00000339 } },
+	/* 0x0000033a */ { 1, { 0x0000033a } },
+	/* 0x0000033b */ { 1, { 0x0000033b } },
+	/* 0x0000033c */ { 1, { 0x0000033c } },
+	/* 0x0000033d */ { 1, { 0x0000033d } },
+	/* 0x0000033e */ { 1, { 0x0000033e } },
+	/* 0x0000033f */ { 1, { 0x0000033f } },
+	/* 0x00000340 */ { 1, { 0x00000300 } },
+	/* 0x00000341 */ { 1, { 0x00000301 } },
+	/* 0x00000342 */ { 1, { 0x00000342 } },
+	/* 0x00000343 */ { 1, { 0x00000313 } },
+	/* 0x00000344 */ { 2, { 0x00000308, 0x00000301 } },
+	/* 0x00000345 */ { 1, { 0x00000345 } },
+	/* 0x00000346 */ { 1, { 0x00000346 } },
+	/* 0x00000347 */ { 1, { 0x00000347 } },
+	/* 0x00000348 */ { 1, { 0x00000348 } },
+	/* 0x00000349 */ { 1, { 0x00000349 } },
+	/* 0x0000034a */ { 1, { 0x0000034a } },
+	/* 0x0000034b */ { 1, { 0x0000034b } },
+	/* 0x0000034c */ { 1, { 0x0000034c } },
+	/* 0x0000034d */ { 1, { 0x0000034d } },
+	/* 0x0000034e */ { 1, { 0x0000034e } },
+	/* 0x0000034f */ { 1, { 0x0000034f } },
+	/* 0x00000350 */ { 1, { 0x00000350 } },
+	/* 0x00000351 */ { 1, { 0x00000351 } },
+	/* 0x00000352 */ { 1, { 0x00000352 } },
+	/* 0x00000353 */ { 1, { 0x00000353 } },
+	/* 0x00000354 */ { 1, { 0x00000354 } },
+	/* 0x00000355 */ { 1, { 0x00000355 } },
+	/* 0x00000356 */ { 1, { 0x00000356 } },
+	/* 0x00000357 */ { 1, { 0x00000357 } },
+	/* 0x00000358 */ { 1, { 0x00000358 } },
+	/* 0x00000359 */ { 1, { 0x00000359 } },
+	/* 0x0000035a */ { 1, { 0x0000035a } },
+	/* 0x0000035b */ { 1, { 0x0000035b } },
+	/* 0x0000035c */ { 1, { 0x0000035c } },
+	/* 0x0000035d */ { 1, { 0x0000035d } },
+	/* 0x0000035e */ { 1, { 0x0000035e } },
+	/* 0x0000035f */ { 1, { 0x0000035f } },
+	/* 0x00000360 */ { 1, { 0x00000360 } },
+	/* 0x00000361 */ { 1, { 0x00000361 } },
+	/* 0x00000362 */ { 1, { 0x00000362 } },
+	/* 0x00000363 */ { 1, { 0x00000363 } },
+	/* 0x00000364 */ { 1, { 0x00000364 } },
+	/* 0x00000365 */ { 1, { 0x00000365 } },
+	/* 0x00000366 */ { 1, { 0x00000366 } },
+	/* 0x00000367 */ { 1, { 0x00000367 } },
+	/* 0x00000368 */ { 1, { 0x00000368 } },
+	/* 0x00000369 */ { 1, { 0x00000369 } },
+	/* 0x0000036a */ { 1, { 0x0000036a } },
+	/* 0x0000036b */ { 1, { 0x0000036b } },
+	/* 0x0000036c */ { 1, { 0x0000036c } },
+	/* 0x0000036d */ { 1, { 0x0000036d } },
+	/* 0x0000036e */ { 1, { 0x0000036e } },
+	/* 0x0000036f */ { 1, { 0x0000036f } },
+	/* 0x00000370 */ { 1, { 0x00000370 } },
+	/* 0x00000371 */ { 1, { 0x00000371 } },
+	/* 0x00000372 */ { 1, { 0x00000372 } },
+	/* 0x00000373 */ { 1, { 0x00000373 } },
+	/* 0x00000374 */ { 1, { 0x000002b9 } },
+	/* 0x00000375 */ { 1, { 0x00000375 } },
+	/* 0x00000376 */ { 1, { 0x00000376 } },
+	/* 0x00000377 */ { 1, { 0x00000377 } },
+	/* 0x00000378 */ { 1, { 0x00000378 } },
+	/* 0x00000379 */ { 1, { 0x00000379 } },
+	/* 0x0000037a */ { 1, { 0x0000037a } },
+	/* 0x0000037b */ { 1, { 0x0000037b } },
+	/* 0x0000037c */ { 1, { 0x0000037c } },
+	/* 0x0000037d */ { 1, { 0x0000037d } },
+	/* 0x0000037e */ { 1, { 0x0000003b } },
+	/* 0x0000037f */ { 1, { 0x0000037f } },
+	/* 0x00000380 */ { 1, { 0x00000380 } },
+	/* 0x00000381 */ { 1, { 0x00000381 } },
+	/* 0x00000382 */ { 1, { 0x00000382 } },
+	/* 0x00000383 */ { 1, { 0x00000383 } },
+	/* 0x00000384 */ { 1, { 0x00000384 } },
+	/* 0x00000385 */ { 2, { 0x000000a8, 0x00000301 } },
+	/* 0x00000386 */ { 2, { 0x00000391, 0x00000301 } },
+	/* 0x00000387 */ { 1, { 0x000000b7 } },
+	/* 0x00000388 */ { 2, { 0x00000395, 0x00000301 } },
+	/* 0x00000389 */ { 2, { 0x00000397, 0x00000301 } },
+	/* 0x0000038a */ { 2, { 0x00000399, 0x00000301 } },
+	/* 0x0000038b */ { 1, { 0x0000038b } },
+	/* 0x0000038c */ { 2, { 0x0000039f, 0x00000301 } },
+	/* 0x0000038d */ { 1, { 0x0000038d } },
+	/* 0x0000038e */ { 2, { 0x000003a5, 0x00000301 } },
+	/* 0x0000038f */ { 2, { 0x000003a9, 0x00000301 } },
+	/* 0x00000390 */ { 3, { 0x000003b9, 0x00000308, 0x00000301 } },
+	/* 0x00000391 */ { 1, { 0x00000391 } },
+	/* 0x00000392 */ { 1, { 0x00000392 } },
+	/* 0x00000393 */ { 1, { 0x00000393 } },
+	/* 0x00000394 */ { 1, { 0x00000394 } },
+	/* 0x00000395 */ { 1, { 0x00000395 } },
+	/* 0x00000396 */ { 1, { 0x00000396 } },
+	/* 0x00000397 */ { 1, { 0x00000397 } },
+	/* 0x00000398 */ { 1, { 0x00000398 } },
+	/* 0x00000399 */ { 1, { 0x00000399 } },
+	/* 0x0000039a */ { 1, { 0x0000039a } },
+	/* 0x0000039b */ { 1, { 0x0000039b } },
+	/* 0x0000039c */ { 1, { 0x0000039c } },
+	/* 0x0000039d */ { 1, { 0x0000039d } },
+	/* 0x0000039e */ { 1, { 0x0000039e } },
+	/* 0x0000039f */ { 1, { 0x0000039f } },
+	/* 0x000003a0 */ { 1, { 0x000003a0 } },
+	/* 0x000003a1 */ { 1, { 0x000003a1 } },
+	/* 0x000003a2 */ { 1, { 0x000003a2 } },
+	/* 0x000003a3 */ { 1, { 0x000003a3 } },
+	/* 0x000003a4 */ { 1, { 0x000003a4 } },
+	/* 0x000003a5 */ { 1, { 0x000003a5 } },
+	/* 0x000003a6 */ { 1, { 0x000003a6 } },
+	/* 0x000003a7 */ { 1, { 0x000003a7 } },
+	/* 0x000003a8 */ { 1, { 0x000003a8 } },
+	/* 0x000003a9 */ { 1, { 0x000003a9 } },
+	/* 0x000003aa */ { 2, { 0x00000399, 0x00000308 } },
+	/* 0x000003ab */ { 2, { 0x000003a5, 0x00000308 } },
+	/* 0x000003ac */ { 2, { 0x000003b1, 0x00000301 } },
+	/* 0x000003ad */ { 2, { 0x000003b5, 0x00000301 } },
+	/* 0x000003ae */ { 2, { 0x000003b7, 0x00000301 } },
+	/* 0x000003af */ { 2, { 0x000003b9, 0x00000301 } },
+	/* 0x000003b0 */ { 3, { 0x000003c5, 0x00000308, 0x00000301 } },
+	/* 0x000003b1 */ { 1, { 0x000003b1 } },
+	/* 0x000003b2 */ { 1, { 0x000003b2 } },
+	/* 0x000003b3 */ { 1, { 0x000003b3 } },
+	/* 0x000003b4 */ { 1, { 0x000003b4 } },
+	/* 0x000003b5 */ { 1, { 0x000003b5 } },
+	/* 0x000003b6 */ { 1, { 0x000003b6 } },
+	/* 0x000003b7 */ { 1, { 0x000003b7 } },
+	/* 0x000003b8 */ { 1, { 0x000003b8 } },
+	/* 0x000003b9 */ { 1, { 0x000003b9 } },
+	/* 0x000003ba */ { 1, { 0x000003ba } },
+	/* 0x000003bb */ { 1, { 0x000003bb } },
+	/* 0x000003bc */ { 1, { 0x000003bc } },
+	/* 0x000003bd */ { 1, { 0x000003bd } },
+	/* 0x000003be */ { 1, { 0x000003be } },
+	/* 0x000003bf */ { 1, { 0x000003bf } },
+	/* 0x000003c0 */ { 1, { 0x000003c0 } },
+	/* 0x000003c1 */ { 1, { 0x000003c1 } },
+	/* 0x000003c2 */ { 1, { 0x000003c2 } },
+	/* 0x000003c3 */ { 1, { 0x000003c3 } },
+	/* 0x000003c4 */ { 1, { 0x000003c4 } },
+	/* 0x000003c5 */ { 1, { 0x000003c5 } },
+	/* 0x000003c6 */ { 1, { 0x000003c6 } },
+	/* 0x000003c7 */ { 1, { 0x000003c7 } },
+	/* 0x000003c8 */ { 1, { 0x000003c8 } },
+	/* 0x000003c9 */ { 1, { 0x000003c9 } },
+	/* 0x000003ca */ { 2, { 0x000003b9, 0x00000308 } },
+	/* 0x000003cb */ { 2, { 0x000003c5, 0x00000308 } },
+	/* 0x000003cc */ { 2, { 0x000003bf, 0x00000301 } },
+	/* 0x000003cd */ { 2, { 0x000003c5, 0x00000301 } },
+	/* 0x000003ce */ { 2, { 0x000003c9, 0x00000301 } },
+	/* 0x000003cf */ { 1, { 0x000003cf } },
+	/* 0x000003d0 */ { 1, { 0x000003d0 } },
+	/* 0x000003d1 */ { 1, { 0x000003d1 } },
+	/* 0x000003d2 */ { 1, { 0x000003d2 } },
+	/* 0x000003d3 */ { 2, { 0x000003d2, 0x00000301 } },
+	/* 0x000003d4 */ { 2, { 0x000003d2, 0x00000308 } },
+	/* 0x000003d5 */ { 1, { 0x000003d5 } },
+	/* 0x000003d6 */ { 1, { 0x000003d6 } },
+	/* 0x000003d7 */ { 1, { 0x000003d7 } },
+	/* 0x000003d8 */ { 1, { 0x000003d8 } },
+	/* 0x000003d9 */ { 1, { 0x000003d9 } },
+	/* 0x000003da */ { 1, { 0x000003da } },
+	/* 0x000003db */ { 1, { 0x000003db } },
+	/* 0x000003dc */ { 1, { 0x000003dc } },
+	/* 0x000003dd */ { 1, { 0x000003dd } },
+	/* 0x000003de */ { 1, { 0x000003de } },
+	/* 0x000003df */ { 1, { 0x000003df } },
+	/* 0x000003e0 */ { 1, { 0x000003e0 } },
+	/* 0x000003e1 */ { 1, { 0x000003e1 } },
+	/* 0x000003e2 */ { 1, { 0x000003e2 } },
+	/* 0x000003e3 */ { 1, { 0x000003e3 } },
+	/* 0x000003e4 */ { 1, { 0x000003e4 } },
+	/* 0x000003e5 */ { 1, { 0x000003e5 } },
+	/* 0x000003e6 */ { 1, { 0x000003e6 } },
+	/* 0x000003e7 */ { 1, { 0x000003e7 } },
+	/* 0x000003e8 */ { 1, { 0x000003e8 } },
+	/* 0x000003e9 */ { 1, { 0x000003e9 } },
+	/* 0x000003ea */ { 1, { 0x000003ea } },
+	/* 0x000003eb */ { 1, { 0x000003eb } },
+	/* 0x000003ec */ { 1, { 0x000003ec } },
+	/* 0x000003ed */ { 1, { 0x000003ed } },
+	/* 0x000003ee */ { 1, { 0x000003ee } },
+	/* 0x000003ef */ { 1, { 0x000003ef } },
+	/* 0x000003f0 */ { 1, { 0x000003f0 } },
+	/* 0x000003f1 */ { 1, { 0x000003f1 } },
+	/* 0x000003f2 */ { 1, { 0x000003f2 } },
+	/* 0x000003f3 */ { 1, { 0x000003f3 } },
+	/* 0x000003f4 */ { 1, { 0x000003f4 } },
+	/* 0x000003f5 */ { 1, { 0x000003f5 } },
+	/* 0x000003f6 */ { 1, { 0x000003f6 } },
+	/* 0x000003f7 */ { 1, { 0x000003f7 } },
+	/* 0x000003f8 */ { 1, { 0x000003f8 } },
+	/* 0x000003f9 */ { 1, { 0x000003f9 } },
+	/* 0x000003fa */ { 1, { 0x000003fa } },
+	/* 0x000003fb */ { 1, { 0x000003fb } },
+	/* 0x000003fc */ { 1, { 0x000003fc } },
+	/* 0x000003fd */ { 1, { 0x000003fd } },
+	/* 0x000003fe */ { 1, { 0x000003fe } },
+	/* 0x000003ff */ { 1, { 0x000003ff } }
+};
+
+static libfshfs_name_decomposition_mapping_t libfshfs_name_decomposition_mappings_0x00000400[ 256 ] = {
+	/* 0x00000400 */ { 2, { 0x00000415, 0x00000300 } },
+	/* 0x00000401 */ { 2, { 0x00000415, 0x00000308 } },
+	/* 0x00000402 */ { 1, { 0x00000402 } },
+	/* 0x00000403 */ { 2, { 0x00000413, 0x00000301 } },
+	/* 0x00000404 */ { 1, { 0x00000404 } },
+	/* 0x00000405 */ { 1, { 0x00000405 } },
+	/* 0x00000406 */ { 1, { 0x00000406 } },
+	/* 0x00000407 */ { 2, { 0x00000406, 0x00000308 } },
+	/* 0x00000408 */ { 1, { 0x00000408 } },
+	/* 0x00000409 */ { 1, { 0x00000409 } },
+	/* 0x0000040a */ { 1, { 0x0000040a } },
+	/* 0x0000040b */ { 1, { 0x0000040b } },
+	/* 0x0000040c */ { 2, { 0x0000041a, 0x00000301 } },
+	/* 0x0000040d */ { 2, { 0x00000418, 0x00000300 } },
+	/* 0x0000040e */ { 2, { 0x00000423, 0x00000306 } },
+	/* 0x0000040f */ { 1, { 0x0000040f } },
+	/* 0x00000410 */ { 1, { 0x00000410 } },
+	/* 0x00000411 */ { 1, { 0x00000411 } },
+	/* 0x00000412 */ { 1, { 0x00000412 } },
+	/* 0x00000413 */ { 1, { 0x00000413 } },
+	/* 0x00000414 */ { 1, { 0x00000414 } },
+	/* 0x00000415 */ { 1, { 0x00000415 } },
+	/* 0x00000416 */ { 1, { 0x00000416 } },
+	/* 0x00000417 */ { 1, { 0x00000417 } },
+	/* 0x00000418 */ { 1, { 0x00000418 } },
+	/* 0x00000419 */ { 2, { 0x00000418, 0x00000306 } },
+	/* 0x0000041a */ { 1, { 0x0000041a } },
+	/* 0x0000041b */ { 1, { 0x0000041b } },
+	/* 0x0000041c */ { 1, { 0x0000041c } },
+	/* 0x0000041d */ { 1, { 0x0000041d } },
+	/* 0x0000041e */ { 1, { 0x0000041e } },
+	/* 0x0000041f */ { 1, { 0x0000041f } },
+	/* 0x00000420 */ { 1, { 0x00000420 } },
+	/* 0x00000421 */ { 1, { 0x00000421 } },
+	/* 0x00000422 */ { 1, { 0x00000422 } },
+	/* 0x00000423 */ { 1, { 0x00000423 } },
+	/* 0x00000424 */ { 1, { 0x00000424 } },
+	/* 0x00000425 */ { 1, { 0x00000425 } },
+	/* 0x00000426 */ { 1, { 0x00000426 } },
+	/* 0x00000427 */ { 1, { 0x00000427 } },
+	/* 0x00000428 */ { 1, { 0x00000428 } },
+	/* 0x00000429 */ { 1, { 0x00000429 } },
+	/* 0x0000042a */ { 1, { 0x0000042a } },
+	/* 0x0000042b */ { 1, { 0x0000042b } },
+	/* 0x0000042c */ { 1, { 0x0000042c } },
+	/* 0x0000042d */ { 1, { 0x0000042d } },
+	/* 0x0000042e */ { 1, { 0x0000042e } },
+	/* 0x0000042f */ { 1, { 0x0000042f } },
+	/* 0x00000430 */ { 1, { 0x00000430 } },
+	/* 0x00000431 */ { 1, { 0x00000431 } },
+	/* 0x00000432 */ { 1, { 0x00000432 } },
+	/* 0x00000433 */ { 1, { 0x00000433 } },
+	/* 0x00000434 */ { 1, { 0x00000434 } },
+	/* 0x00000435 */ { 1, { 0x00000435 } },
+	/* 0x00000436 */ { 1, { 0x00000436 } },
+	/* 0x00000437 */ { 1, { 0x00000437 } },
+	/* 0x00000438 */ { 1, { 0x00000438 } },
+	/* 0x00000439 */ { 2, { 0x00000438, 0x00000306 } },
+	/* 0x0000043a */ { 1, { 0x0000043a } },
+	/* 0x0000043b */ { 1, { 0x0000043b } },
+	/* 0x0000043c */ { 1, { 0x0000043c } },
+	/* 0x0000043d */ { 1, { 0x0000043d } },
+	/* 0x0000043e */ { 1, { 0x0000043e } },
+	/* 0x0000043f */ { 1, { 0x0000043f } },
+	/* 0x00000440 */ { 1, { 0x00000440 } },
+	/* 0x00000441 */ { 1, { 0x00000441 } },
+	/* 0x00000442 */ { 1, { 0x00000442 } },
+	/* 0x00000443 */ { 1, { 0x00000443 } },
+	/* 0x00000444 */ { 1, { 0x00000444 } },
+	/* 0x00000445 */ { 1, { 0x00000445 } },
+	/* 0x00000446 */ { 1, { 0x00000446 } },
+	/* 0x00000447 */ { 1, { 0x00000447 } },
+	/* 0x00000448 */ { 1, { 0x00000448 } },
+	/* 0x00000449 */ { 1, { 0x00000449 } },
+	/* 0x0000044a */ { 1, { 0x0000044a } },
+	/* 0x0000044b */ { 1, { 0x0000044b } },
+	/* 0x0000044c */ { 1, { 0x0000044c } },
+	/* 0x0000044d */ { 1, { 0x0000044d } },
+	/* 0x0000044e */ { 1, { 0x0000044e } },
+	/* 0x0000044f */ { 1, { 0x0000044f } },
+	/* 0x00000450 */ { 2, { 0x00000435, 0x00000300 } },
+	/* 0x00000451 */ { 2, { 0x00000435, 0x00000308 } },
+	/* 0x00000452 */ { 1, { 0x00000452 } },
+	/* 0x00000453 */ { 2, { 0x00000433, 0x00000301 } },
+	/* 0x00000454 */ { 1, { 0x00000454 } },
+	/* 0x00000455 */ { 1, { 0x00000455 } },
+	/* 0x00000456 */ { 1, { 0x00000456 } },
+	/* 0x00000457 */ { 2, { 0x00000456, 0x00000308 } },
+	/* 0x00000458 */ { 1, { 0x00000458 } },
+	/* 0x00000459 */ { 1, { 0x00000459 } },
+	/* 0x0000045a */ { 1, { 0x0000045a } },
+	/* 0x0000045b */ { 1, { 0x0000045b } },
+	/* 0x0000045c */ { 2, { 0x0000043a, 0x00000301 } },
+	/* 0x0000045d */ { 2, { 0x00000438, 0x00000300 } },
+	/* 0x0000045e */ { 2, { 0x00000443, 0x00000306 } },
+	/* 0x0000045f */ { 1, { 0x0000045f } },
+	/* 0x00000460 */ { 1, { 0x00000460 } },
+	/* 0x00000461 */ { 1, { 0x00000461 } },
+	/* 0x00000462 */ { 1, { 0x00000462 } },
+	/* 0x00000463 */ { 1, { 0x00000463 } },
+	/* 0x00000464 */ { 1, { 0x00000464 } },
+	/* 0x00000465 */ { 1, { 0x00000465 } },
+	/* 0x00000466 */ { 1, { 0x00000466 } },
+	/* 0x00000467 */ { 1, { 0x00000467 } },
+	/* 0x00000468 */ { 1, { 0x00000468 } },
+	/* 0x00000469 */ { 1, { 0x00000469 } },
+	/* 0x0000046a */ { 1, { 0x0000046a } },
+	/* 0x0000046b */ { 1, { 0x0000046b } },
+	/* 0x0000046c */ { 1, { 0x0000046c } },
+	/* 0x0000046d */ { 1, { 0x0000046d } },
+	/* 0x0000046e */ { 1, { 0x0000046e } },
+	/* 0x0000046f */ { 1, { 0x0000046f } },
+	/* 0x00000470 */ { 1, { 0x00000470 } },
+	/* 0x00000471 */ { 1, { 0x00000471 } },
+	/* 0x00000472 */ { 1, { 0x00000472 } },
+	/* 0x00000473 */ { 1, { 0x00000473 } },
+	/* 0x00000474 */ { 1, { 0x00000474 } },
+	/* 0x00000475 */ { 1, { 0x00000475 } },
+	/* 0x00000476 */ { 2, { 0x00000474, 0x0000030f } },
+	/* 0x00000477 */ { 2, { 0x00000475, 0x0000030f } },
+	/* 0x00000478 */ { 1, { 0x00000478 } },
+	/* 0x00000479 */ { 1, { 0x00000479 } },
+	/* 0x0000047a */ { 1, { 0x0000047a } },
+	/* 0x0000047b */ { 1, { 0x0000047b } },
+	/* 0x0000047c */ { 1, { 0x0000047c } },
+	/* 0x0000047d */ { 1, { 0x0000047d } },
+	/* 0x0000047e */ { 1, { 0x0000047e } },
+	/* 0x0000047f */ { 1, { 0x0000047f } },
+	/* 0x00000480 */ { 1, { 0x00000480 } },
+	/* 0x00000481 */ { 1, { 0x00000481 } },
+	/* 0x00000482 */ { 1, { 0x00000482 } },
+	/* 0x00000483 */ { 1, { 0x00000483 } },
+	/* 0x00000484 */ { 1, { 0x00000484 } },
+	/* 0x00000485 */ { 1, { 0x00000485 } },
+	/* 0x00000486 */ { 1, { 0x00000486 } },
+	/* 0x00000487 */ { 1, { 0x00000487 } },
+	/* 0x00000488 */ { 1, { 0x00000488 } },
+	/* 0x00000489 */ { 1, { 0x00000489 } },
+	/* 0x0000048a */ { 1, { 0x0000048a } },
+	/* 0x0000048b */ { 1, { 0x0000048b } },
+	/* 0x0000048c */ { 1, { 0x0000048c } },
+	/* 0x0000048d */ { 1, { 0x0000048d } },
+	/* 0x0000048e */ { 1, { 0x0000048e } },
+	/* 0x0000048f */ { 1, { 0x0000048f } },
+	/* 0x00000490 */ { 1, { 0x00000490 } },
+	/* 0x00000491 */ { 1, { 0x00000491 } },
+	/* 0x00000492 */ { 1, { 0x00000492 } },
+	/* 0x00000493 */ { 1, { 0x00000493 } },
+	/* 0x00000494 */ { 1, { 0x00000494 } },
+	/* 0x00000495 */ { 1, { 0x00000495 } },
+	/* 0x00000496 */ { 1, { 0x00000496 } },
+	/* 0x00000497 */ { 1, { 0x00000497 } },
+	/* 0x00000498 */ { 1, { 0x00000498 } },
+	/* 0x00000499 */ { 1, { 0x00000499 } },
+	/* 0x0000049a */ { 1, { 0x0000049a } },
+	/* 0x0000049b */ { 1, { 0x0000049b } },
+	/* 0x0000049c */ { 1, { 0x0000049c } },
+	/* 0x0000049d */ { 1, { 0x0000049d } },
+	/* 0x0000049e */ { 1, { 0x0000049e } },
+	/* 0x0000049f */ { 1, { 0x0000049f } },
+	/* 0x000004a0 */ { 1, { 0x000004a0 } },
+	/* 0x000004a1 */ { 1, { 0x000004a1 } },
+	/* 0x000004a2 */ { 1, { 0x000004a2 } },
+	/* 0x000004a3 */ { 1, { 0x000004a3 } },
+	/* 0x000004a4 */ { 1, { 0x000004a4 } },
+	/* 0x000004a5 */ { 1, { 0x000004a5 } },
+	/* 0x000004a6 */ { 1, { 0x000004a6 } },
+	/* 0x000004a7 */ { 1, { 0x000004a7 } },
+	/* 0x000004a8 */ { 1, { 0x000004a8 } },
+	/* 0x000004a9 */ { 1, { 0x000004a9 } },
+	/* 0x000004aa */ { 1, { 0x000004aa } },
+	/* 0x000004ab */ { 1, { 0x000004ab } },
+	/* 0x000004ac */ { 1, { 0x000004ac } },
+	/* 0x000004ad */ { 1, { 0x000004ad } },
+	/* 0x000004ae */ { 1, { 0x000004ae } },
+	/* 0x000004af */ { 1, { 0x000004af } },
+	/* 0x000004b0 */ { 1, { 0x000004b0 } },
+	/* 0x000004b1 */ { 1, { 0x000004b1 } },
+	/* 0x000004b2 */ { 1, { 0x000004b2 } },
+	/* 0x000004b3 */ { 1, { 0x000004b3 } },
+	/* 0x000004b4 */ { 1, { 0x000004b4 } },
+	/* 0x000004b5 */ { 1, { 0x000004b5 } },
+	/* 0x000004b6 */ { 1, { 0x000004b6 } },
+	/* 0x000004b7 */ { 1, { 0x000004b7 } },
+	/* 0x000004b8 */ { 1, { 0x000004b8 } },
+	/* 0x000004b9 */ { 1, { 0x000004b9 } },
+	/* 0x000004ba */ { 1, { 0x000004ba } },
+	/* 0x000004bb */ { 1, { 0x000004bb } },
+	/* 0x000004bc */ { 1, { 0x000004bc } },
+	/* 0x000004bd */ { 1, { 0x000004bd } },
+	/* 0x000004be */ { 1, { 0x000004be } },
+	/* 0x000004bf */ { 1, { 0x000004bf } },
+	/* 0x000004c0 */ { 1, { 0x000004c0 } },
+	/* 0x000004c1 */ { 2, { 0x00000416, 0x00000306 } },
+	/* 0x000004c2 */ { 2, { 0x00000436, 0x00000306 } },
+	/* 0x000004c3 */ { 1, { 0x000004c3 } },
+	/* 0x000004c4 */ { 1, { 0x000004c4 } },
+	/* 0x000004c5 */ { 1, { 0x000004c5 } },
+	/* 0x000004c6 */ { 1, { 0x000004c6 } },
+	/* 0x000004c7 */ { 1, { 0x000004c7 } },
+	/* 0x000004c8 */ { 1, { 0x000004c8 } },
+	/* 0x000004c9 */ { 1, { 0x000004c9 } },
+	/* 0x000004ca */ { 1, { 0x000004ca } },
+	/* 0x000004cb */ { 1, { 0x000004cb } },
+	/* 0x000004cc */ { 1, { 0x000004cc } },
+	/* 0x000004cd */ { 1, { 0x000004cd } },
+	/* 0x000004ce */ { 1, { 0x000004ce } },
+	/* 0x000004cf */ { 1, { 0x000004cf } },
+	/* 0x000004d0 */ { 2, { 0x00000410, 0x00000306 } },
+	/* 0x000004d1 */ { 2, { 0x00000430, 0x00000306 } },
+	/* 0x000004d2 */ { 2, { 0x00000410, 0x00000308 } },
+	/* 0x000004d3 */ { 2, { 0x00000430, 0x00000308 } },
+	/* 0x000004d4 */ { 1, { 0x000004d4 } },
+	/* 0x000004d5 */ { 1, { 0x000004d5 } },
+	/* 0x000004d6 */ { 2, { 0x00000415, 0x00000306 } },
+	/* 0x000004d7 */ { 2, { 0x00000435, 0x00000306 } },
+	/* 0x000004d8 */ { 1, { 0x000004d8 } },
+	/* 0x000004d9 */ { 1, { 0x000004d9 } },
+	/* 0x000004da */ { 2, { 0x000004d8, 0x00000308 } },
+	/* 0x000004db */ { 2, { 0x000004d9, 0x00000308 } },
+	/* 0x000004dc */ { 2, { 0x00000416, 0x00000308 } },
+	/* 0x000004dd */ { 2, { 0x00000436, 0x00000308 } },
+	/* 0x000004de */ { 2, { 0x00000417, 0x00000308 } },
+	/* 0x000004df */ { 2, { 0x00000437, 0x00000308 } },
+	/* 0x000004e0 */ { 1, { 0x000004e0 } },
+	/* 0x000004e1 */ { 1, { 0x000004e1 } },
+	/* 0x000004e2 */ { 2, { 0x00000418, 0x00000304 } },
+	/* 0x000004e3 */ { 2, { 0x00000438, 0x00000304 } },
+	/* 0x000004e4 */ { 2, { 0x00000418, 0x00000308 } },
+	/* 0x000004e5 */ { 2, { 0x00000438, 0x00000308 } },
+	/* 0x000004e6 */ { 2, { 0x0000041e, 0x00000308 } },
+	/* 0x000004e7 */ { 2, { 0x0000043e, 0x00000308 } },
+	/* 0x000004e8 */ { 1, { 0x000004e8 } },
+	/* 0x000004e9 */ { 1, { 0x000004e9 } },
+	/* 0x000004ea */ { 2, { 0x000004e8, 0x00000308 } },
+	/* 0x000004eb */ { 2, { 0x000004e9, 0x00000308 } },
+	/* 0x000004ec */ { 2, { 0x0000042d, 0x00000308 } },
+	/* 0x000004ed */ { 2, { 0x0000044d, 0x00000308 } },
+	/* 0x000004ee */ { 2, { 0x00000423, 0x00000304 } },
+	/* 0x000004ef */ { 2, { 0x00000443, 0x00000304 } },
+	/* 0x000004f0 */ { 2, { 0x00000423, 0x00000308 } },
+	/* 0x000004f1 */ { 2, { 0x00000443, 0x00000308 } },
+	/* 0x000004f2 */ { 2, { 0x00000423, 0x0000030b } },
+	/* 0x000004f3 */ { 2, { 0x00000443, 0x0000030b } },
+	/* 0x000004f4 */ { 2, { 0x00000427, 0x00000308 } },
+	/* 0x000004f5 */ { 2, { 0x00000447, 0x00000308 } },
+	/* 0x000004f6 */ { 1, { 0x000004f6 } },
+	/* 0x000004f7 */ { 1, { 0x000004f7 } },
+	/* 0x000004f8 */ { 2, { 0x0000042b, 0x00000308 } },
+	/* 0x000004f9 */ { 2, { 0x0000044b, 0x00000308 } },
+	/* 0x000004fa */ { 1, { 0x000004fa } },
+	/* 0x000004fb */ { 1, { 0x000004fb } },
+	/* 0x000004fc */ { 1, { 0x000004fc } },
+	/* 0x000004fd */ { 1, { 0x000004fd } },
+	/* 0x000004fe */ { 1, { 0x000004fe } },
+	/* 0x000004ff */ { 1, { 0x000004ff } }
+};
+
+static libfshfs_name_decomposition_mapping_t libfshfs_name_decomposition_mappings_0x00000600[ 256 ] = {
+	/* 0x00000600 */ { 1, { 0x00000600 } },
+	/* 0x00000601 */ { 1, { 0x00000601 } },
+	/* 0x00000602 */ { 1, { 0x00000602 } },
+	/* 0x00000603 */ { 1, { 0x00000603 } },
+	/* 0x00000604 */ { 1, { 0x00000604 } },
+	/* 0x00000605 */ { 1, { 0x00000605 } },
+	/* 0x00000606 */ { 1, { 0x00000606 } },
+	/* 0x00000607 */ { 1, { 0x00000607 } },
+	/* 0x00000608 */ { 1, { 0x00000608 } },
+	/* 0x00000609 */ { 1, { 0x00000609 } },
+	/* 0x0000060a */ { 1, { 0x0000060a } },
+	/* 0x0000060b */ { 1, { 0x0000060b } },
+	/* 0x0000060c */ { 1, { 0x0000060c } },
+	/* 0x0000060d */ { 1, { 0x0000060d } },
+	/* 0x0000060e */ { 1, { 0x0000060e } },
+	/* 0x0000060f */ { 1, { 0x0000060f } },
+	/* 0x00000610 */ { 1, { 0x00000610 } },
+	/* 0x00000611 */ { 1, { 0x00000611 } },
+	/* 0x00000612 */ { 1, { 0x00000612 } },
+	/* 0x00000613 */ { 1, { 0x00000613 } },
+	/* 0x00000614 */ { 1, { 0x00000614 } },
+	/* 0x00000615 */ { 1, { 0x00000615 } },
+	/* 0x00000616 */ { 1, { 0x00000616 } },
+	/* 0x00000617 */ { 1, { 0x00000617 } },
+	/* 0x00000618 */ { 1, { 0x00000618 } },
+	/* 0x00000619 */ { 1, { 0x00000619 } },
+	/* 0x0000061a */ { 1, { 0x0000061a } },
+	/* 0x0000061b */ { 1, { 0x0000061b } },
+	/* 0x0000061c */ { 1, { 0x0000061c } },
+	/* 0x0000061d */ { 1, { 0x0000061d } },
+	/* 0x0000061e */ { 1, { 0x0000061e } },
+	/* 0x0000061f */ { 1, { 0x0000061f } },
+	/* 0x00000620 */ { 1, { 0x00000620 } },
+	/* 0x00000621 */ { 1, { 0x00000621 } },
+	/* 0x00000622 */ { 2, { 0x00000627, 0x00000653 } },
+	/* 0x00000623 */ { 2, { 0x00000627, 0x00000654 } },
+	/* 0x00000624 */ { 2, { 0x00000648, 0x00000654 } },
+	/* 0x00000625 */ { 2, { 0x00000627, 0x00000655 } },
+	/* 0x00000626 */ { 2, { 0x0000064a, 0x00000654 } },
+	/* 0x00000627 */ { 1, { 0x00000627 } },
+	/* 0x00000628 */ { 1, { 0x00000628 } },
+	/* 0x00000629 */ { 1, { 0x00000629 } },
+	/* 0x0000062a */ { 1, { 0x0000062a } },
+	/* 0x0000062b */ { 1, { 0x0000062b } },
+	/* 0x0000062c */ { 1, { 0x0000062c } },
+	/* 0x0000062d */ { 1, { 0x0000062d } },
+	/* 0x0000062e */ { 1, { 0x0000062e } },
+	/* 0x0000062f */ { 1, { 0x0000062f } },
+	/* 0x00000630 */ { 1, { 0x00000630 } },
+	/* 0x00000631 */ { 1, { 0x00000631 } },
+	/* 0x00000632 */ { 1, { 0x00000632 } },
+	/* 0x00000633 */ { 1, { 0x00000633 } },
+	/* 0x00000634 */ { 1, { 0x00000634 } },
+	/* 0x00000635 */ { 1, { 0x00000635 } },
+	/* 0x00000636 */ { 1, { 0x00000636 } },
+	/* 0x00000637 */ { 1, { 0x00000637 } },
+	/* 0x00000638 */ { 1, { 0x00000638 } },
+	/* 0x00000639 */ { 1, { 0x00000639 } },
+	/* 0x0000063a */ { 1, { 0x0000063a } },
+	/* 0x0000063b */ { 1, { 0x0000063b } },
+	/* 0x0000063c */ { 1, { 0x0000063c } },
+	/* 0x0000063d */ { 1, { 0x0000063d } },
+	/* 0x0000063e */ { 1, { 0x0000063e } },
+	/* 0x0000063f */ { 1, { 0x0000063f } },
+	/* 0x00000640 */ { 1, { 0x00000640 } },
+	/* 0x00000641 */ { 1, { 0x00000641 } },
+	/* 0x00000642 */ { 1, { 0x00000642 } },
+	/* 0x00000643 */ { 1, { 0x00000643 } },
+	/* 0x00000644 */ { 1, { 0x00000644 } },
+	/* 0x00000645 */ { 1, { 0x00000645 } },
+	/* 0x00000646 */ { 1, { 0x00000646 } },
+	/* 0x00000647 */ { 1, { 0x00000647 } },
+	/* 0x00000648 */ { 1, { 0x00000648 } },
+	/* 0x00000649 */ { 1, { 0x00000649 } },
+	/* 0x0000064a */ { 1, { 0x0000064a } },
+	/* 0x0000064b */ { 1, { 0x0000064b } },
+	/* 0x0000064c */ { 1, { 0x0000064c } },
+	/* 0x0000064d */ { 1, { 0x0000064d } },
+	/* 0x0000064e */ { 1, { 0x0000064e } },
+	/* 0x0000064f */ { 1, { 0x0000064f } },
+	/* 0x00000650 */ { 1, { 0x00000650 } },
+	/* 0x00000651 */ { 1, { 0x00000651 } },
+	/* 0x00000652 */ { 1, { 0x00000652 } },
+	/* 0x00000653 */ { 1, { 0x00000653 } },
+	/* 0x00000654 */ { 1, { 0x00000654 } },
+	/* 0x00000655 */ { 1, { 0x00000655 } },
+	/* 0x00000656 */ { 1, { 0x00000656 } },
+	/* 0x00000657 */ { 1, { 0x00000657 } },
+	/* 0x00000658 */ { 1, { 0x00000658 } },
+	/* 0x00000659 */ { 1, { 0x00000659 } },
+	/* 0x0000065a */ { 1, { 0x0000065a } },
+	/* 0x0000065b */ { 1, { 0x0000065b } },
+	/* 0x0000065c */ { 1, { 0x0000065c } },
+	/* 0x0000065d */ { 1, { 0x0000065d } },
+	/* 0x0000065e */ { 1, { 0x0000065e } },
+	/* 0x0000065f */ { 1, { 0x0000065f } },
+	/* 0x00000660 */ { 1, { 0x00000660 } },
+	/* 0x00000661 */ { 1, { 0x00000661 } },
+	/* 0x00000662 */ { 1, { 0x00000662 } },
+	/* 0x00000663 */ { 1, { 0x00000663 } },
+	/* 0x00000664 */ { 1, { 0x00000664 } },
+	/* 0x00000665 */ { 1, { 0x00000665 } },
+	/* 0x00000666 */ { 1, { 0x00000666 } },
+	/* 0x00000667 */ { 1, { 0x00000667 } },
+	/* 0x00000668 */ { 1, { 0x00000668 } },
+	/* 0x00000669 */ { 1, { 0x00000669 } },
+	/* 0x0000066a */ { 1, { 0x0000066a } },
+	/* 0x0000066b */ { 1, { 0x0000066b } },
+	/* 0x0000066c */ { 1, { 0x0000066c } },
+	/* 0x0000066d */ { 1, { 0x0000066d } },
+	/* 0x0000066e */ { 1, { 0x0000066e } },
+	/* 0x0000066f */ { 1, { 0x0000066f } },
+	/* 0x00000670 */ { 1, { 0x00000670 } },
+	/* 0x00000671 */ { 1, { 0x00000671 } },
+	/* 0x00000672 */ { 1, { 0x00000672 } },
+	/* 0x00000673 */ { 1, { 0x00000673 } },
+	/* 0x00000674 */ { 1, { 0x00000674 } },
+	/* 0x00000675 */ { 1, { 0x00000675 } },
+	/* 0x00000676 */ { 1, { 0x00000676 } },
+	/* 0x00000677 */ { 1, { 0x00000677 } },
+	/* 0x00000678 */ { 1, { 0x00000678 } },
+	/* 0x00000679 */ { 1, { 0x00000679 } },
+	/* 0x0000067a */ { 1, { 0x0000067a } },
+	/* 0x0000067b */ { 1, { 0x0000067b } },
+	/* 0x0000067c */ { 1, { 0x0000067c } },
+	/* 0x0000067d */ { 1, { 0x0000067d } },
+	/* 0x0000067e */ { 1, { 0x0000067e } },
+	/* 0x0000067f */ { 1, { 0x0000067f } },
+	/* 0x00000680 */ { 1, { 0x00000680 } },
+	/* 0x00000681 */ { 1, { 0x00000681 } },
+	/* 0x00000682 */ { 1, { 0x00000682 } },
+	/* 0x00000683 */ { 1, { 0x00000683 } },
+	/* 0x00000684 */ { 1, { 0x00000684 } },
+	/* 0x00000685 */ { 1, { 0x00000685 } },
+	/* 0x00000686 */ { 1, { 0x00000686 } },
+	/* 0x00000687 */ { 1, { 0x00000687 } },
+	/* 0x00000688 */ { 1, { 0x00000688 } },
+	/* 0x00000689 */ { 1, { 0x00000689 } },
+	/* 0x0000068a */ { 1, { 0x0000068a } },
+	/* 0x0000068b */ { 1, { 0x0000068b } },
+	/* 0x0000068c */ { 1, { 0x0000068c } },
+	/* 0x0000068d */ { 1, { 0x0000068d } },
+	/* 0x0000068e */ { 1, { 0x0000068e } },
+	/* 0x0000068f */ { 1, { 0x0000068f } },
+	/* 0x00000690 */ { 1, { 0x00000690 } },
+	/* 0x00000691 */ { 1, { 0x00000691 } },
+	/* 0x00000692 */ { 1, { 0x00000692 } },
+	/* 0x00000693 */ { 1, { 0x00000693 } },
+	/* 0x00000694 */ { 1, { 0x00000694 } },
+	/* 0x00000695 */ { 1, { 0x00000695 } },
+	/* 0x00000696 */ { 1, { 0x00000696 } },
+	/* 0x00000697 */ { 1, { 0x00000697 } },
+	/* 0x00000698 */ { 1, { 0x00000698 } },
+	/* 0x00000699 */ { 1, { 0x00000699 } },
+	/* 0x0000069a */ { 1, { 0x0000069a } },
+	/* 0x0000069b */ { 1, { 0x0000069b } },
+	/* 0x0000069c */ { 1, { 0x0000069c } },
+	/* 0x0000069d */ { 1, { 0x0000069d } },
+	/* 0x0000069e */ { 1, { 0x0000069e } },
+	/* 0x0000069f */ { 1, { 0x0000069f } },
+	/* 0x000006a0 */ { 1, { 0x000006a0 } },
+	/* 0x000006a1 */ { 1, { 0x000006a1 } },
+	/* 0x000006a2 */ { 1, { 0x000006a2 } },
+	/* 0x000006a3 */ { 1, { 0x000006a3 } },
+	/* 0x000006a4 */ { 1, { 0x000006a4 } },
+	/* 0x000006a5 */ { 1, { 0x000006a5 } },
+	/* 0x000006a6 */ { 1, { 0x000006a6 } },
+	/* 0x000006a7 */ { 1, { 0x000006a7 } },
+	/* 0x000006a8 */ { 1, { 0x000006a8 } },
+	/* 0x000006a9 */ { 1, { 0x000006a9 } },
+	/* 0x000006aa */ { 1, { 0x000006aa } },
+	/* 0x000006ab */ { 1, { 0x000006ab } },
+	/* 0x000006ac */ { 1, { 0x000006ac } },
+	/* 0x000006ad */ { 1, { 0x000006ad } },
+	/* 0x000006ae */ { 1, { 0x000006ae } },
+	/* 0x000006af */ { 1, { 0x000006af } },
+	/* 0x000006b0 */ { 1, { 0x000006b0 } },
+	/* 0x000006b1 */ { 1, { 0x000006b1 } },
+	/* 0x000006b2 */ { 1, { 0x000006b2 } },
+	/* 0x000006b3 */ { 1, { 0x000006b3 } },
+	/* 0x000006b4 */ { 1, { 0x000006b4 } },
+	/* 0x000006b5 */ { 1, { 0x000006b5 } },
+	/* 0x000006b6 */ { 1, { 0x000006b6 } },
+	/* 0x000006b7 */ { 1, { 0x000006b7 } },
+	/* 0x000006b8 */ { 1, { 0x000006b8 } },
+	/* 0x000006b9 */ { 1, { 0x000006b9 } },
+	/* 0x000006ba */ { 1, { 0x000006ba } },
+	/* 0x000006bb */ { 1, { 0x000006bb } },
+	/* 0x000006bc */ { 1, { 0x000006bc } },
+	/* 0x000006bd */ { 1, { 0x000006bd } },
+	/* 0x000006be */ { 1, { 0x000006be } },
+	/* 0x000006bf */ { 1, { 0x000006bf } },
+	/* 0x000006c0 */ { 2, { 0x000006d5, 0x00000654 } },
+	/* 0x000006c1 */ { 1, { 0x000006c1 } },
+	/* 0x000006c2 */ { 2, { 0x000006c1, 0x00000654 } },
+	/* 0x000006c3 */ { 1, { 0x000006c3 } },
+	/* 0x000006c4 */ { 1, { 0x000006c4 } },
+	/* 0x000006c5 */ { 1, { 0x000006c5 } },
+	/* 0x000006c6 */ { 1, { 0x000006c6 } },
+	/* 0x000006c7 */ { 1, { 0x000006c7 } },
+	/* 0x000006c8 */ { 1, { 0x000006c8 } },
+	/* 0x000006c9 */ { 1, { 0x000006c9 } },
+	/* 0x000006ca */ { 1, { 0x000006ca } },
+	/* 0x000006cb */ { 1, { 0x000006cb } },
+	/* 0x000006cc */ { 1, { 0x000006cc } },
+	/* 0x000006cd */ { 1, { 0x000006cd } },
+	/* 0x000006ce */ { 1, { 0x000006ce } },
+	/* 0x000006cf */ { 1, { 0x000006cf } },
+	/* 0x000006d0 */ { 1, { 0x000006d0 } },
+	/* 0x000006d1 */ { 1, { 0x000006d1 } },
+	/* 0x000006d2 */ { 1, { 0x000006d2 } },
+	/* 0x000006d3 */ { 2, { 0x000006d2, 0x00000654 } },
+	/* 0x000006d4 */ { 1, { 0x000006d4 } },
+	/* 0x000006d5 */ { 1, { 0x000006d5 } },
+	/* 0x000006d6 */ { 1, { 0x000006d6 } },
+	/* 0x000006d7 */ { 1, { 0x000006d7 } },
+	/* 0x000006d8 */ { 1, { 0x000006d8 } },
+	/* 0x000006d9 */ { 1, { 0x000006d9 } },
+	/* 0x000006da */ { 1, { 0x000006da } },
+	/* 0x000006db */ { 1, { 0x000006db } },
+	/* 0x000006dc */ { 1, { 0x000006dc } },
+	/* 0x000006dd */ { 1, { 0x000006dd } },
+	/* 0x000006de */ { 1, { 0x000006de } },
+	/* 0x000006df */ { 1, { 0x000006df } },
+	/* 0x000006e0 */ { 1, { 0x000006e0 } },
+	/* 0x000006e1 */ { 1, { 0x000006e1 } },
+	/* 0x000006e2 */ { 1, { 0x000006e2 } },
+	/* 0x000006e3 */ { 1, { 0x000006e3 } },
+	/* 0x000006e4 */ { 1, { 0x000006e4 } },
+	/* 0x000006e5 */ { 1, { 0x000006e5 } },
+	/* 0x000006e6 */ { 1, { 0x000006e6 } },
+	/* 0x000006e7 */ { 1, { 0x000006e7 } },
+	/* 0x000006e8 */ { 1, { 0x000006e8 } },
+	/* 0x000006e9 */ { 1, { 0x000006e9 } },
+	/* 0x000006ea */ { 1, { 0x000006ea } },
+	/* 0x000006eb */ { 1, { 0x000006eb } },
+	/* 0x000006ec */ { 1, { 0x000006ec } },
+	/* 0x000006ed */ { 1, { 0x000006ed } },
+	/* 0x000006ee */ { 1, { 0x000006ee } },
+	/* 0x000006ef */ { 1, { 0x000006ef } },
+	/* 0x000006f0 */ { 1, { 0x000006f0 } },
+	/* 0x000006f1 */ { 1, { 0x000006f1 } },
+	/* 0x000006f2 */ { 1, { 0x000006f2 } },
+	/* 0x000006f3 */ { 1, { 0x000006f3 } },
+	/* 0x000006f4 */ { 1, { 0x000006f4 } },
+	/* 0x000006f5 */ { 1, { 0x000006f5 } },
+	/* 0x000006f6 */ { 1, { 0x000006f6 } },
+	/* 0x000006f7 */ { 1, { 0x000006f7 } },
+	/* 0x000006f8 */ { 1, { 0x000006f8 } },
+	/* 0x000006f9 */ { 1, { 0x000006f9 } },
+	/* 0x000006fa */ { 1, { 0x000006fa } },
+	/* 0x000006fb */ { 1, { 0x000006fb } },
+	/* 0x000006fc */ { 1, { 0x000006fc } },
+	/* 0x000006fd */ { 1, { 0x000006fd } },
+	/* 0x000006fe */ { 1, { 0x000006fe } },
+	/* 0x000006ff */ { 1, { 0x000006ff } }
+};
+
+static libfshfs_name_decomposition_mapping_t libfshfs_name_decomposition_mappings_0x00000900[ 256 ] = {
+	/* 0x00000900 */ { 1, { 0x00000900 } },
+	/* 0x00000901 */ { 1, { 0x00000901 } },
+	/* 0x00000902 */ { 1, { 0x00000902 } },
+	/* 0x00000903 */ { 1, { 0x00000903 } },
+	/* 0x00000904 */ { 1, { 0x00000904 } },
+	/* 0x00000905 */ { 1, { 0x00000905 } },
+	/* 0x00000906 */ { 1, { 0x00000906 } },
+	/* 0x00000907 */ { 1, { 0x00000907 } },
+	/* 0x00000908 */ { 1, { 0x00000908 } },
+	/* 0x00000909 */ { 1, { 0x00000909 } },
+	/* 0x0000090a */ { 1, { 0x0000090a } },
+	/* 0x0000090b */ { 1, { 0x0000090b } },
+	/* 0x0000090c */ { 1, { 0x0000090c } },
+	/* 0x0000090d */ { 1, { 0x0000090d } },
+	/* 0x0000090e */ { 1, { 0x0000090e } },
+	/* 0x0000090f */ { 1, { 0x0000090f } },
+	/* 0x00000910 */ { 1, { 0x00000910 } },
+	/* 0x00000911 */ { 1, { 0x00000911 } },
+	/* 0x00000912 */ { 1, { 0x00000912 } },
+	/* 0x00000913 */ { 1, { 0x00000913 } },
+	/* 0x00000914 */ { 1, { 0x00000914 } },
+	/* 0x00000915 */ { 1, { 0x00000915 } },
+	/* 0x00000916 */ { 1, { 0x00000916 } },
+	/* 0x00000917 */ { 1, { 0x00000917 } },
+	/* 0x00000918 */ { 1, { 0x00000918 } },
+	/* 0x00000919 */ { 1, { 0x00000919 } },
+	/* 0x0000091a */ { 1, { 0x0000091a } },
+	/* 0x0000091b */ { 1, { 0x0000091b } },
+	/* 0x0000091c */ { 1, { 0x0000091c } },
+	/* 0x0000091d */ { 1, { 0x0000091d } },
+	/* 0x0000091e */ { 1, { 0x0000091e } },
+	/* 0x0000091f */ { 1, { 0x0000091f } },
+	/* 0x00000920 */ { 1, { 0x00000920 } },
+	/* 0x00000921 */ { 1, { 0x00000921 } },
+	/* 0x00000922 */ { 1, { 0x00000922 } },
+	/* 0x00000923 */ { 1, { 0x00000923 } },
+	/* 0x00000924 */ { 1, { 0x00000924 } },
+	/* 0x00000925 */ { 1, { 0x00000925 } },
+	/* 0x00000926 */ { 1, { 0x00000926 } },
+	/* 0x00000927 */ { 1, { 0x00000927 } },
+	/* 0x00000928 */ { 1, { 0x00000928 } },
+	/* 0x00000929 */ { 2, { 0x00000928, 0x0000093c } },
+	/* 0x0000092a */ { 1, { 0x0000092a } },
+	/* 0x0000092b */ { 1, { 0x0000092b } },
+	/* 0x0000092c */ { 1, { 0x0000092c } },
+	/* 0x0000092d */ { 1, { 0x0000092d } },
+	/* 0x0000092e */ { 1, { 0x0000092e } },
+	/* 0x0000092f */ { 1, { 0x0000092f } },
+	/* 0x00000930 */ { 1, { 0x00000930 } },
+	/* 0x00000931 */ { 2, { 0x00000930, 0x0000093c } },
+	/* 0x00000932 */ { 1, { 0x00000932 } },
+	/* 0x00000933 */ { 1, { 0x00000933 } },
+	/* 0x00000934 */ { 2, { 0x00000933, 0x0000093c } },
+	/* 0x00000935 */ { 1, { 0x00000935 } },
+	/* 0x00000936 */ { 1, { 0x00000936 } },
+	/* 0x00000937 */ { 1, { 0x00000937 } },
+	/* 0x00000938 */ { 1, { 0x00000938 } },
+	/* 0x00000939 */ { 1, { 0x00000939 } },
+	/* 0x0000093a */ { 1, { 0x0000093a } },
+	/* 0x0000093b */ { 1, { 0x0000093b } },
+	/* 0x0000093c */ { 1, { 0x0000093c } },
+	/* 0x0000093d */ { 1, { 0x0000093d } },
+	/* 0x0000093e */ { 1, { 0x0000093e } },
+	/* 0x0000093f */ { 1, { 0x0000093f } },
+	/* 0x00000940 */ { 1, { 0x00000940 } },
+	/* 0x00000941 */ { 1, { 0x00000941 } },
+	/* 0x00000942 */ { 1, { 0x00000942 } },
+	/* 0x00000943 */ { 1, { 0x00000943 } },
+	/* 0x00000944 */ { 1, { 0x00000944 } },
+	/* 0x00000945 */ { 1, { 0x00000945 } },
+	/* 0x00000946 */ { 1, { 0x00000946 } },
+	/* 0x00000947 */ { 1, { 0x00000947 } },
+	/* 0x00000948 */ { 1, { 0x00000948 } },
+	/* 0x00000949 */ { 1, { 0x00000949 } },
+	/* 0x0000094a */ { 1, { 0x0000094a } },
+	/* 0x0000094b */ { 1, { 0x0000094b } },
+	/* 0x0000094c */ { 1, { 0x0000094c } },
+	/* 0x0000094d */ { 1, { 0x0000094d } },
+	/* 0x0000094e */ { 1, { 0x0000094e } },
+	/* 0x0000094f */ { 1, { 0x0000094f } },
+	/* 0x00000950 */ { 1, { 0x00000950 } },
+	/* 0x00000951 */ { 1, { 0x00000951 } },
+	/* 0x00000952 */ { 1, { 0x00000952 } },
+	/* 0x00000953 */ { 1, { 0x00000953 } },
+	/* 0x00000954 */ { 1, { 0x00000954 } },
+	/* 0x00000955 */ { 1, { 0x00000955 } },
+	/* 0x00000956 */ { 1, { 0x00000956 } },
+	/* 0x00000957 */ { 1, { 0x00000957 } },
+	/* 0x00000958 */ { 2, { 0x00000915, 0x0000093c } },
+	/* 0x00000959 */ { 2, { 0x00000916, 0x0000093c } },
+	/* 0x0000095a */ { 2, { 0x00000917, 0x0000093c } },
+	/* 0x0000095b */ { 2, { 0x0000091c, 0x0000093c } },
+	/* 0x0000095c */ { 2, { 0x00000921, 0x0000093c } },
+	/* 0x0000095d */ { 2, { 0x00000922, 0x0000093c } },
+	/* 0x0000095e */ { 2, { 0x0000092b, 0x0000093c } },
+	/* 0x0000095f */ { 2, { 0x0000092f, 0x0000093c } },
+	/* 0x00000960 */ { 1, { 0x00000960 } },
+	/* 0x00000961 */ { 1, { 0x00000961 } },
+	/* 0x00000962 */ { 1, { 0x00000962 } },
+	/* 0x00000963 */ { 1, { 0x00000963 } },
+	/* 0x00000964 */ { 1, { 0x00000964 } },
+	/* 0x00000965 */ { 1, { 0x00000965 } },
+	/* 0x00000966 */ { 1, { 0x00000966 } },
+	/* 0x00000967 */ { 1, { 0x00000967 } },
+	/* 0x00000968 */ { 1, { 0x00000968 } },
+	/* 0x00000969 */ { 1, { 0x00000969 } },
+	/* 0x0000096a */ { 1, { 0x0000096a } },
+	/* 0x0000096b */ { 1, { 0x0000096b } },
+	/* 0x0000096c */ { 1, { 0x0000096c } },
+	/* 0x0000096d */ { 1, { 0x0000096d } },
+	/* 0x0000096e */ { 1, { 0x0000096e } },
+	/* 0x0000096f */ { 1, { 0x0000096f } },
+	/* 0x00000970 */ { 1, { 0x00000970 } },
+	/* 0x00000971 */ { 1, { 0x00000971 } },
+	/* 0x00000972 */ { 1, { 0x00000972 } },
+	/* 0x00000973 */ { 1, { 0x00000973 } },
+	/* 0x00000974 */ { 1, { 0x00000974 } },
+	/* 0x00000975 */ { 1, { 0x00000975 } },
+	/* 0x00000976 */ { 1, { 0x00000976 } },
+	/* 0x00000977 */ { 1, { 0x00000977 } },
+	/* 0x00000978 */ { 1, { 0x00000978 } },
+	/* 0x00000979 */ { 1, { 0x00000979 } },
+	/* 0x0000097a */ { 1, { 0x0000097a } },
+	/* 0x0000097b */ { 1, { 0x0000097b } },
+	/* 0x0000097c */ { 1, { 0x0000097c } },
+	/* 0x0000097d */ { 1, { 0x0000097d } },
+	/* 0x0000097e */ { 1, { 0x0000097e } },
+	/* 0x0000097f */ { 1, { 0x0000097f } },
+	/* 0x00000980 */ { 1, { 0x00000980 } },
+	/* 0x00000981 */ { 1, { 0x00000981 } },
+	/* 0x00000982 */ { 1, { 0x00000982 } },
+	/* 0x00000983 */ { 1, { 0x00000983 } },
+	/* 0x00000984 */ { 1, { 0x00000984 } },
+	/* 0x00000985 */ { 1, { 0x00000985 } },
+	/* 0x00000986 */ { 1, { 0x00000986 } },
+	/* 0x00000987 */ { 1, { 0x00000987 } },
+	/* 0x00000988 */ { 1, { 0x00000988 } },
+	/* 0x00000989 */ { 1, { 0x00000989 } },
+	/* 0x0000098a */ { 1, { 0x0000098a } },
+	/* 0x0000098b */ { 1, { 0x0000098b } },
+	/* 0x0000098c */ { 1, { 0x0000098c } },
+	/* 0x0000098d */ { 1, { 0x0000098d } },
+	/* 0x0000098e */ { 1, { 0x0000098e } },
+	/* 0x0000098f */ { 1, { 0x0000098f } },
+	/* 0x00000990 */ { 1, { 0x00000990 } },
+	/* 0x00000991 */ { 1, { 0x00000991 } },
+	/* 0x00000992 */ { 1, { 0x00000992 } },
+	/* 0x00000993 */ { 1, { 0x00000993 } },
+	/* 0x00000994 */ { 1, { 0x00000994 } },
+	/* 0x00000995 */ { 1, { 0x00000995 } },
+	/* 0x00000996 */ { 1, { 0x00000996 } },
+	/* 0x00000997 */ { 1, { 0x00000997 } },
+	/* 0x00000998 */ { 1, { 0x00000998 } },
+	/* 0x00000999 */ { 1, { 0x00000999 } },
+	/* 0x0000099a */ { 1, { 0x0000099a } },
+	/* 0x0000099b */ { 1, { 0x0000099b } },
+	/* 0x0000099c */ { 1, { 0x0000099c } },
+	/* 0x0000099d */ { 1, { 0x0000099d } },
+	/* 0x0000099e */ { 1, { 0x0000099e } },
+	/* 0x0000099f */ { 1, { 0x0000099f } },
+	/* 0x000009a0 */ { 1, { 0x000009a0 } },
+	/* 0x000009a1 */ { 1, { 0x000009a1 } },
+	/* 0x000009a2 */ { 1, { 0x000009a2 } },
+	/* 0x000009a3 */ { 1, { 0x000009a3 } },
+	/* 0x000009a4 */ { 1, { 0x000009a4 } },
+	/* 0x000009a5 */ { 1, { 0x000009a5 } },
+	/* 0x000009a6 */ { 1, { 0x000009a6 } },
+	/* 0x000009a7 */ { 1, { 0x000009a7 } },
+	/* 0x000009a8 */ { 1, { 0x000009a8 } },
+	/* 0x000009a9 */ { 1, { 0x000009a9 } },
+	/* 0x000009aa */ { 1, { 0x000009aa } },
+	/* 0x000009ab */ { 1, { 0x000009ab } },
+	/* 0x000009ac */ { 1, { 0x000009ac } },
+	/* 0x000009ad */ { 1, { 0x000009ad } },
+	/* 0x000009ae */ { 1, { 0x000009ae } },
+	/* 0x000009af */ { 1, { 0x000009af } },
+	/* 0x000009b0 */ { 1, { 0x000009b0 } },
+	/* 0x000009b1 */ { 1, { 0x000009b1 } },
+	/* 0x000009b2 */ { 1, { 0x000009b2 } },
+	/* 0x000009b3 */ { 1, { 0x000009b3 } },
+	/* 0x000009b4 */ { 1, { 0x000009b4 } },
+	/* 0x000009b5 */ { 1, { 0x000009b5 } },
+	/* 0x000009b6 */ { 1, { 0x000009b6 } },
+	/* 0x000009b7 */ { 1, { 0x000009b7 } },
+	/* 0x000009b8 */ { 1, { 0x000009b8 } },
+	/* 0x000009b9 */ { 1, { 0x000009b9 } },
+	/* 0x000009ba */ { 1, { 0x000009ba } },
+	/* 0x000009bb */ { 1, { 0x000009bb } },
+	/* 0x000009bc */ { 1, { 0x000009bc } },
+	/* 0x000009bd */ { 1, { 0x000009bd } },
+	/* 0x000009be */ { 1, { 0x000009be } },
+	/* 0x000009bf */ { 1, { 0x000009bf } },
+	/* 0x000009c0 */ { 1, { 0x000009c0 } },
+	/* 0x000009c1 */ { 1, { 0x000009c1 } },
+	/* 0x000009c2 */ { 1, { 0x000009c2 } },
+	/* 0x000009c3 */ { 1, { 0x000009c3 } },
+	/* 0x000009c4 */ { 1, { 0x000009c4 } },
+	/* 0x000009c5 */ { 1, { 0x000009c5 } },
+	/* 0x000009c6 */ { 1, { 0x000009c6 } },
+	/* 0x000009c7 */ { 1, { 0x000009c7 } },
+	/* 0x000009c8 */ { 1, { 0x000009c8 } },
+	/* 0x000009c9 */ { 1, { 0x000009c9 } },
+	/* 0x000009ca */ { 1, { 0x000009ca } },
+	/* 0x000009cb */ { 2, { 0x000009c7, 0x000009be } },
+	/* 0x000009cc */ { 2, { 0x000009c7, 0x000009d7 } },
+	/* 0x000009cd */ { 1, { 0x000009cd } },
+	/* 0x000009ce */ { 1, { 0x000009ce } },
+	/* 0x000009cf */ { 1, { 0x000009cf } },
+	/* 0x000009d0 */ { 1, { 0x000009d0 } },
+	/* 0x000009d1 */ { 1, { 0x000009d1 } },
+	/* 0x000009d2 */ { 1, { 0x000009d2 } },
+	/* 0x000009d3 */ { 1, { 0x000009d3 } },
+	/* 0x000009d4 */ { 1, { 0x000009d4 } },
+	/* 0x000009d5 */ { 1, { 0x000009d5 } },
+	/* 0x000009d6 */ { 1, { 0x000009d6 } },
+	/* 0x000009d7 */ { 1, { 0x000009d7 } },
+	/* 0x000009d8 */ { 1, { 0x000009d8 } },
+	/* 0x000009d9 */ { 1, { 0x000009d9 } },
+	/* 0x000009da */ { 1, { 0x000009da } },
+	/* 0x000009db */ { 1, { 0x000009db } },
+	/* 0x000009dc */ { 2, { 0x000009a1, 0x000009bc } },
+	/* 0x000009dd */ { 2, { 0x000009a2, 0x000009bc } },
+	/* 0x000009de */ { 1, { 0x000009de } },
+	/* 0x000009df */ { 2, { 0x000009af, 0x000009bc } },
+	/* 0x000009e0 */ { 1, { 0x000009e0 } },
+	/* 0x000009e1 */ { 1, { 0x000009e1 } },
+	/* 0x000009e2 */ { 1, { 0x000009e2 } },
+	/* 0x000009e3 */ { 1, { 0x000009e3 } },
+	/* 0x000009e4 */ { 1, { 0x000009e4 } },
+	/* 0x000009e5 */ { 1, { 0x000009e5 } },
+	/* 0x000009e6 */ { 1, { 0x000009e6 } },
+	/* 0x000009e7 */ { 1, { 0x000009e7 } },
+	/* 0x000009e8 */ { 1, { 0x000009e8 } },
+	/* 0x000009e9 */ { 1, { 0x000009e9 } },
+	/* 0x000009ea */ { 1, { 0x000009ea } },
+	/* 0x000009eb */ { 1, { 0x000009eb } },
+	/* 0x000009ec */ { 1, { 0x000009ec } },
+	/* 0x000009ed */ { 1, { 0x000009ed } },
+	/* 0x000009ee */ { 1, { 0x000009ee } },
+	/* 0x000009ef */ { 1, { 0x000009ef } },
+	/* 0x000009f0 */ { 1, { 0x000009f0 } },
+	/* 0x000009f1 */ { 1, { 0x000009f1 } },
+	/* 0x000009f2 */ { 1, { 0x000009f2 } },
+	/* 0x000009f3 */ { 1, { 0x000009f3 } },
+	/* 0x000009f4 */ { 1, { 0x000009f4 } },
+	/* 0x000009f5 */ { 1, { 0x000009f5 } },
+	/* 0x000009f6 */ { 1, { 0x000009f6 } },
+	/* 0x000009f7 */ { 1, { 0x000009f7 } },
+	/* 0x000009f8 */ { 1, { 0x000009f8 } },
+	/* 0x000009f9 */ { 1, { 0x000009f9 } },
+	/* 0x000009fa */ { 1, { 0x000009fa } },
+	/* 0x000009fb */ { 1, { 0x000009fb } },
+	/* 0x000009fc */ { 1, { 0x000009fc } },
+	/* 0x000009fd */ { 1, { 0x000009fd } },
+	/* 0x000009fe */ { 1, { 0x000009fe } },
+	/* 0x000009ff */ { 1, { 0x000009ff } }
+};
+
+static libfshfs_name_decomposition_mapping_t libfshfs_name_decomposition_mappings_0x00000a00[ 256 ] = {
+	/* 0x00000a00 */ { 1, { 0x00000a00 } },
+	/* 0x00000a01 */ { 1, { 0x00000a01 } },
+	/* 0x00000a02 */ { 1, { 0x00000a02 } },
+	/* 0x00000a03 */ { 1, { 0x00000a03 } },
+	/* 0x00000a04 */ { 1, { 0x00000a04 } },
+	/* 0x00000a05 */ { 1, { 0x00000a05 } },
+	/* 0x00000a06 */ { 1, { 0x00000a06 } },
+	/* 0x00000a07 */ { 1, { 0x00000a07 } },
+	/* 0x00000a08 */ { 1, { 0x00000a08 } },
+	/* 0x00000a09 */ { 1, { 0x00000a09 } },
+	/* 0x00000a0a */ { 1, { 0x00000a0a } },
+	/* 0x00000a0b */ { 1, { 0x00000a0b } },
+	/* 0x00000a0c */ { 1, { 0x00000a0c } },
+	/* 0x00000a0d */ { 1, { 0x00000a0d } },
+	/* 0x00000a0e */ { 1, { 0x00000a0e } },
+	/* 0x00000a0f */ { 1, { 0x00000a0f } },
+	/* 0x00000a10 */ { 1, { 0x00000a10 } },
+	/* 0x00000a11 */ { 1, { 0x00000a11 } },
+	/* 0x00000a12 */ { 1, { 0x00000a12 } },
+	/* 0x00000a13 */ { 1, { 0x00000a13 } },
+	/* 0x00000a14 */ { 1, { 0x00000a14 } },
+	/* 0x00000a15 */ { 1, { 0x00000a15 } },
+	/* 0x00000a16 */ { 1, { 0x00000a16 } },
+	/* 0x00000a17 */ { 1, { 0x00000a17 } },
+	/* 0x00000a18 */ { 1, { 0x00000a18 } },
+	/* 0x00000a19 */ { 1, { 0x00000a19 } },
+	/* 0x00000a1a */ { 1, { 0x00000a1a } },
+	/* 0x00000a1b */ { 1, { 0x00000a1b } },
+	/* 0x00000a1c */ { 1, { 0x00000a1c } },
+	/* 0x00000a1d */ { 1, { 0x00000a1d } },
+	/* 0x00000a1e */ { 1, { 0x00000a1e } },
+	/* 0x00000a1f */ { 1, { 0x00000a1f } },
+	/* 0x00000a20 */ { 1, { 0x00000a20 } },
+	/* 0x00000a21 */ { 1, { 0x00000a21 } },
+	/* 0x00000a22 */ { 1, { 0x00000a22 } },
+	/* 0x00000a23 */ { 1, { 0x00000a23 } },
+	/* 0x00000a24 */ { 1, { 0x00000a24 } },
+	/* 0x00000a25 */ { 1, { 0x00000a25 } },
+	/* 0x00000a26 */ { 1, { 0x00000a26 } },
+	/* 0x00000a27 */ { 1, { 0x00000a27 } },
+	/* 0x00000a28 */ { 1, { 0x00000a28 } },
+	/* 0x00000a29 */ { 1, { 0x00000a29 } },
+	/* 0x00000a2a */ { 1, { 0x00000a2a } },
+	/* 0x00000a2b */ { 1, { 0x00000a2b } },
+	/* 0x00000a2c */ { 1, { 0x00000a2c } },
+	/* 0x00000a2d */ { 1, { 0x00000a2d } },
+	/* 0x00000a2e */ { 1, { 0x00000a2e } },
+	/* 0x00000a2f */ { 1, { 0x00000a2f } },
+	/* 0x00000a30 */ { 1, { 0x00000a30 } },
+	/* 0x00000a31 */ { 1, { 0x00000a31 } },
+	/* 0x00000a32 */ { 1, { 0x00000a32 } },
+	/* 0x00000a33 */ { 2, { 0x00000a32, 0x00000a3c } },
+	/* 0x00000a34 */ { 1, { 0x00000a34 } },
+	/* 0x00000a35 */ { 1, { 0x00000a35 } },
+	/* 0x00000a36 */ { 2, { 0x00000a38, 0x00000a3c } },
+	/* 0x00000a37 */ { 1, { 0x00000a37 } },
+	/* 0x00000a38 */ { 1, { 0x00000a38 } },
+	/* 0x00000a39 */ { 1, { 0x00000a39 } },
+	/* 0x00000a3a */ { 1, { 0x00000a3a } },
+	/* 0x00000a3b */ { 1, { 0x00000a3b } },
+	/* 0x00000a3c */ { 1, { 0x00000a3c } },
+	/* 0x00000a3d */ { 1, { 0x00000a3d } },
+	/* 0x00000a3e */ { 1, { 0x00000a3e } },
+	/* 0x00000a3f */ { 1, { 0x00000a3f } },
+	/* 0x00000a40 */ { 1, { 0x00000a40 } },
+	/* 0x00000a41 */ { 1, { 0x00000a41 } },
+	/* 0x00000a42 */ { 1, { 0x00000a42 } },
+	/* 0x00000a43 */ { 1, { 0x00000a43 } },
+	/* 0x00000a44 */ { 1, { 0x00000a44 } },
+	/* 0x00000a45 */ { 1, { 0x00000a45 } },
+	/* 0x00000a46 */ { 1, { 0x00000a46 } },
+	/* 0x00000a47 */ { 1, { 0x00000a47 } },
+	/* 0x00000a48 */ { 1, { 0x00000a48 } },
+	/* 0x00000a49 */ { 1, { 0x00000a49 } },
+	/* 0x00000a4a */ { 1, { 0x00000a4a } },
+	/* 0x00000a4b */ { 1, { 0x00000a4b } },
+	/* 0x00000a4c */ { 1, { 0x00000a4c } },
+	/* 0x00000a4d */ { 1, { 0x00000a4d } },
+	/* 0x00000a4e */ { 1, { 0x00000a4e } },
+	/* 0x00000a4f */ { 1, { 0x00000a4f } },
+	/* 0x00000a50 */ { 1, { 0x00000a50 } },
+	/* 0x00000a51 */ { 1, { 0x00000a51 } },
+	/* 0x00000a52 */ { 1, { 0x00000a52 } },
+	/* 0x00000a53 */ { 1, { 0x00000a53 } },
+	/* 0x00000a54 */ { 1, { 0x00000a54 } },
+	/* 0x00000a55 */ { 1, { 0x00000a55 } },
+	/* 0x00000a56 */ { 1, { 0x00000a56 } },
+	/* 0x00000a57 */ { 1, { 0x00000a57 } },
+	/* 0x00000a58 */ { 1, { 0x00000a58 } },
+	/* 0x00000a59 */ { 2, { 0x00000a16, 0x00000a3c } },
+	/* 0x00000a5a */ { 2, { 0x00000a17, 0x00000a3c } },
+	/* 0x00000a5b */ { 2, { 0x00000a1c, 0x00000a3c } },
+	/* 0x00000a5c */ { 1, { 0x00000a5c } },
+	/* 0x00000a5d */ { 1, { 0x00000a5d } },
+	/* 0x00000a5e */ { 2, { 0x00000a2b, 0x00000a3c } },
+	/* 0x00000a5f */ { 1, { 0x00000a5f } },
+	/* 0x00000a60 */ { 1, { 0x00000a60 } },
+	/* 0x00000a61 */ { 1, { 0x00000a61 } },
+	/* 0x00000a62 */ { 1, { 0x00000a62 } },
+	/* 0x00000a63 */ { 1, { 0x00000a63 } },
+	/* 0x00000a64 */ { 1, { 0x00000a64 } },
+	/* 0x00000a65 */ { 1, { 0x00000a65 } },
+	/* 0x00000a66 */ { 1, { 0x00000a66 } },
+	/* 0x00000a67 */ { 1, { 0x00000a67 } },
+	/* 0x00000a68 */ { 1, { 0x00000a68 } },
+	/* 0x00000a69 */ { 1, { 0x00000a69 } },
+	/* 0x00000a6a */ { 1, { 0x00000a6a } },
+	/* 0x00000a6b */ { 1, { 0x00000a6b } },
+	/* 0x00000a6c */ { 1, { 0x00000a6c } },
+	/* 0x00000a6d */ { 1, { 0x00000a6d } },
+	/* 0x00000a6e */ { 1, { 0x00000a6e } },
+	/* 0x00000a6f */ { 1, { 0x00000a6f } },
+	/* 0x00000a70 */ { 1, { 0x00000a70 } },
+	/* 0x00000a71 */ { 1, { 0x00000a71 } },
+	/* 0x00000a72 */ { 1, { 0x00000a72 } },
+	/* 0x00000a73 */ { 1, { 0x00000a73 } },
+	/* 0x00000a74 */ { 1, { 0x00000a74 } },
+	/* 0x00000a75 */ { 1, { 0x00000a75 } },
+	/* 0x00000a76 */ { 1, { 0x00000a76 } },
+	/* 0x00000a77 */ { 1, { 0x00000a77 } },
+	/* 0x00000a78 */ { 1, { 0x00000a78 } },
+	/* 0x00000a79 */ { 1, { 0x00000a79 } },
+	/* 0x00000a7a */ { 1, { 0x00000a7a } },
+	/* 0x00000a7b */ { 1, { 0x00000a7b } },
+	/* 0x00000a7c */ { 1, { 0x00000a7c } },
+	/* 0x00000a7d */ { 1, { 0x00000a7d } },
+	/* 0x00000a7e */ { 1, { 0x00000a7e } },
+	/* 0x00000a7f */ { 1, { 0x00000a7f } },
+	/* 0x00000a80 */ { 1, { 0x00000a80 } },
+	/* 0x00000a81 */ { 1, { 0x00000a81 } },
+	/* 0x00000a82 */ { 1, { 0x00000a82 } },
+	/* 0x00000a83 */ { 1, { 0x00000a83 } },
+	/* 0x00000a84 */ { 1, { 0x00000a84 } },
+	/* 0x00000a85 */ { 1, { 0x00000a85 } },
+	/* 0x00000a86 */ { 1, { 0x00000a86 } },
+	/* 0x00000a87 */ { 1, { 0x00000a87 } },
+	/* 0x00000a88 */ { 1, { 0x00000a88 } },
+	/* 0x00000a89 */ { 1, { 0x00000a89 } },
+	/* 0x00000a8a */ { 1, { 0x00000a8a } },
+	/* 0x00000a8b */ { 1, { 0x00000a8b } },
+	/* 0x00000a8c */ { 1, { 0x00000a8c } },
+	/* 0x00000a8d */ { 1, { 0x00000a8d } },
+	/* 0x00000a8e */ { 1, { 0x00000a8e } },
+	/* 0x00000a8f */ { 1, { 0x00000a8f } },
+	/* 0x00000a90 */ { 1, { 0x00000a90 } },
+	/* 0x00000a91 */ { 1, { 0x00000a91 } },
+	/* 0x00000a92 */ { 1, { 0x00000a92 } },
+	/* 0x00000a93 */ { 1, { 0x00000a93 } },
+	/* 0x00000a94 */ { 1, { 0x00000a94 } },
+	/* 0x00000a95 */ { 1, { 0x00000a95 } },
+	/* 0x00000a96 */ { 1, { 0x00000a96 } },
+	/* 0x00000a97 */ { 1, { 0x00000a97 } },
+	/* 0x00000a98 */ { 1, { 0x00000a98 } },
+	/* 0x00000a99 */ { 1, { 0x00000a99 } },
+	/* 0x00000a9a */ { 1, { 0x00000a9a } },
+	/* 0x00000a9b */ { 1, { 0x00000a9b } },
+	/* 0x00000a9c */ { 1, { 0x00000a9c } },
+	/* 0x00000a9d */ { 1, { 0x00000a9d } },
+	/* 0x00000a9e */ { 1, { 0x00000a9e } },
+	/* 0x00000a9f */ { 1, { 0x00000a9f } },
+	/* 0x00000aa0 */ { 1, { 0x00000aa0 } },
+	/* 0x00000aa1 */ { 1, { 0x00000aa1 } },
+	/* 0x00000aa2 */ { 1, { 0x00000aa2 } },
+	/* 0x00000aa3 */ { 1, { 0x00000aa3 } },
+	/* 0x00000aa4 */ { 1, { 0x00000aa4 } },
+	/* 0x00000aa5 */ { 1, { 0x00000aa5 } },
+	/* 0x00000aa6 */ { 1, { 0x00000aa6 } },
+	/* 0x00000aa7 */ { 1, { 0x00000aa7 } },
+	/* 0x00000aa8 */ { 1, { 0x00000aa8 } },
+	/* 0x00000aa9 */ { 1, { 0x00000aa9 } },
+	/* 0x00000aaa */ { 1, { 0x00000aaa } },
+	/* 0x00000aab */ { 1, { 0x00000aab } },
+	/* 0x00000aac */ { 1, { 0x00000aac } },
+	/* 0x00000aad */ { 1, { 0x00000aad } },
+	/* 0x00000aae */ { 1, { 0x00000aae } },
+	/* 0x00000aaf */ { 1, { 0x00000aaf } },
+	/* 0x00000ab0 */ { 1, { 0x00000ab0 } },
+	/* 0x00000ab1 */ { 1, { 0x00000ab1 } },
+	/* 0x00000ab2 */ { 1, { 0x00000ab2 } },
+	/* 0x00000ab3 */ { 1, { 0x00000ab3 } },
+	/* 0x00000ab4 */ { 1, { 0x00000ab4 } },
+	/* 0x00000ab5 */ { 1, { 0x00000ab5 } },
+	/* 0x00000ab6 */ { 1, { 0x00000ab6 } },
+	/* 0x00000ab7 */ { 1, { 0x00000ab7 } },
+	/* 0x00000ab8 */ { 1, { 0x00000ab8 } },
+	/* 0x00000ab9 */ { 1, { 0x00000ab9 } },
+	/* 0x00000aba */ { 1, { 0x00000aba } },
+	/* 0x00000abb */ { 1, { 0x00000abb } },
+	/* 0x00000abc */ { 1, { 0x00000abc } },
+	/* 0x00000abd */ { 1, { 0x00000abd } },
+	/* 0x00000abe */ { 1, { 0x00000abe } },
+	/* 0x00000abf */ { 1, { 0x00000abf } },
+	/* 0x00000ac0 */ { 1, { 0x00000ac0 } },
+	/* 0x00000ac1 */ { 1, { 0x00000ac1 } },
+	/* 0x00000ac2 */ { 1, { 0x00000ac2 } },
+	/* 0x00000ac3 */ { 1, { 0x00000ac3 } },
+	/* 0x00000ac4 */ { 1, { 0x00000ac4 } },
+	/* 0x00000ac5 */ { 1, { 0x00000ac5 } },
+	/* 0x00000ac6 */ { 1, { 0x00000ac6 } },
+	/* 0x00000ac7 */ { 1, { 0x00000ac7 } },
+	/* 0x00000ac8 */ { 1, { 0x00000ac8 } },
+	/* 0x00000ac9 */ { 1, { 0x00000ac9 } },
+	/* 0x00000aca */ { 1, { 0x00000aca } },
+	/* 0x00000acb */ { 1, { 0x00000acb } },
+	/* 0x00000acc */ { 1, { 0x00000acc } },
+	/* 0x00000acd */ { 1, { 0x00000acd } },
+	/* 0x00000ace */ { 1, { 0x00000ace } },
+	/* 0x00000acf */ { 1, { 0x00000acf } },
+	/* 0x00000ad0 */ { 1, { 0x00000ad0 } },
+	/* 0x00000ad1 */ { 1, { 0x00000ad1 } },
+	/* 0x00000ad2 */ { 1, { 0x00000ad2 } },
+	/* 0x00000ad3 */ { 1, { 0x00000ad3 } },
+	/* 0x00000ad4 */ { 1, { 0x00000ad4 } },
+	/* 0x00000ad5 */ { 1, { 0x00000ad5 } },
+	/* 0x00000ad6 */ { 1, { 0x00000ad6 } },
+	/* 0x00000ad7 */ { 1, { 0x00000ad7 } },
+	/* 0x00000ad8 */ { 1, { 0x00000ad8 } },
+	/* 0x00000ad9 */ { 1, { 0x00000ad9 } },
+	/* 0x00000ada */ { 1, { 0x00000ada } },
+	/* 0x00000adb */ { 1, { 0x00000adb } },
+	/* 0x00000adc */ { 1, { 0x00000adc } },
+	/* 0x00000add */ { 1, { 0x00000add } },
+	/* 0x00000ade */ { 1, { 0x00000ade } },
+	/* 0x00000adf */ { 1, { 0x00000adf } },
+	/* 0x00000ae0 */ { 1, { 0x00000ae0 } },
+	/* 0x00000ae1 */ { 1, { 0x00000ae1 } },
+	/* 0x00000ae2 */ { 1, { 0x00000ae2 } },
+	/* 0x00000ae3 */ { 1, { 0x00000ae3 } },
+	/* 0x00000ae4 */ { 1, { 0x00000ae4 } },
+	/* 0x00000ae5 */ { 1, { 0x00000ae5 } },
+	/* 0x00000ae6 */ { 1, { 0x00000ae6 } },
+	/* 0x00000ae7 */ { 1, { 0x00000ae7 } },
+	/* 0x00000ae8 */ { 1, { 0x00000ae8 } },
+	/* 0x00000ae9 */ { 1, { 0x00000ae9 } },
+	/* 0x00000aea */ { 1, { 0x00000aea } },
+	/* 0x00000aeb */ { 1, { 0x00000aeb } },
+	/* 0x00000aec */ { 1, { 0x00000aec } },
+	/* 0x00000aed */ { 1, { 0x00000aed } },
+	/* 0x00000aee */ { 1, { 0x00000aee } },
+	/* 0x00000aef */ { 1, { 0x00000aef } },
+	/* 0x00000af0 */ { 1, { 0x00000af0 } },
+	/* 0x00000af1 */ { 1, { 0x00000af1 } },
+	/* 0x00000af2 */ { 1, { 0x00000af2 } },
+	/* 0x00000af3 */ { 1, { 0x00000af3 } },
+	/* 0x00000af4 */ { 1, { 0x00000af4 } },
+	/* 0x00000af5 */ { 1, { 0x00000af5 } },
+	/* 0x00000af6 */ { 1, { 0x00000af6 } },
+	/* 0x00000af7 */ { 1, { 0x00000af7 } },
+	/* 0x00000af8 */ { 1, { 0x00000af8 } },
+	/* 0x00000af9 */ { 1, { 0x00000af9 } },
+	/* 0x00000afa */ { 1, { 0x00000afa } },
+	/* 0x00000afb */ { 1, { 0x00000afb } },
+	/* 0x00000afc */ { 1, { 0x00000afc } },
+	/* 0x00000afd */ { 1, { 0x00000afd } },
+	/* 0x00000afe */ { 1, { 0x00000afe } },
+	/* 0x00000aff */ { 1, { 0x00000aff } }
+};
+
+static libfshfs_name_decomposition_mapping_t libfshfs_name_decomposition_mappings_0x00000b00[ 256 ] = {
+	/* 0x00000b00 */ { 1, { 0x00000b00 } },
+	/* 0x00000b01 */ { 1, { 0x00000b01 } },
+	/* 0x00000b02 */ { 1, { 0x00000b02 } },
+	/* 0x00000b03 */ { 1, { 0x00000b03 } },
+	/* 0x00000b04 */ { 1, { 0x00000b04 } },
+	/* 0x00000b05 */ { 1, { 0x00000b05 } },
+	/* 0x00000b06 */ { 1, { 0x00000b06 } },
+	/* 0x00000b07 */ { 1, { 0x00000b07 } },
+	/* 0x00000b08 */ { 1, { 0x00000b08 } },
+	/* 0x00000b09 */ { 1, { 0x00000b09 } },
+	/* 0x00000b0a */ { 1, { 0x00000b0a } },
+	/* 0x00000b0b */ { 1, { 0x00000b0b } },
+	/* 0x00000b0c */ { 1, { 0x00000b0c } },
+	/* 0x00000b0d */ { 1, { 0x00000b0d } },
+	/* 0x00000b0e */ { 1, { 0x00000b0e } },
+	/* 0x00000b0f */ { 1, { 0x00000b0f } },
+	/* 0x00000b10 */ { 1, { 0x00000b10 } },
+	/* 0x00000b11 */ { 1, { 0x00000b11 } },
+	/* 0x00000b12 */ { 1, { 0x00000b12 } },
+	/* 0x00000b13 */ { 1, { 0x00000b13 } },
+	/* 0x00000b14 */ { 1, { 0x00000b14 } },
+	/* 0x00000b15 */ { 1, { 0x00000b15 } },
+	/* 0x00000b16 */ { 1, { 0x00000b16 } },
+	/* 0x00000b17 */ { 1, { 0x00000b17 } },
+	/* 0x00000b18 */ { 1, { 0x00000b18 } },
+	/* 0x00000b19 */ { 1, { 0x00000b19 } },
+	/* 0x00000b1a */ { 1, { 0x00000b1a } },
+	/* 0x00000b1b */ { 1, { 0x00000b1b } },
+	/* 0x00000b1c */ { 1, { 0x00000b1c } },
+	/* 0x00000b1d */ { 1, { 0x00000b1d } },
+	/* 0x00000b1e */ { 1, { 0x00000b1e } },
+	/* 0x00000b1f */ { 1, { 0x00000b1f } },
+	/* 0x00000b20 */ { 1, { 0x00000b20 } },
+	/* 0x00000b21 */ { 1, { 0x00000b21 } },
+	/* 0x00000b22 */ { 1, { 0x00000b22 } },
+	/* 0x00000b23 */ { 1, { 0x00000b23 } },
+	/* 0x00000b24 */ { 1, { 0x00000b24 } },
+	/* 0x00000b25 */ { 1, { 0x00000b25 } },
+	/* 0x00000b26 */ { 1, { 0x00000b26 } },
+	/* 0x00000b27 */ { 1, { 0x00000b27 } },
+	/* 0x00000b28 */ { 1, { 0x00000b28 } },
+	/* 0x00000b29 */ { 1, { 0x00000b29 } },
+	/* 0x00000b2a */ { 1, { 0x00000b2a } },
+	/* 0x00000b2b */ { 1, { 0x00000b2b } },
+	/* 0x00000b2c */ { 1, { 0x00000b2c } },
+	/* 0x00000b2d */ { 1, { 0x00000b2d } },
+	/* 0x00000b2e */ { 1, { 0x00000b2e } },
+	/* 0x00000b2f */ { 1, { 0x00000b2f } },
+	/* 0x00000b30 */ { 1, { 0x00000b30 } },
+	/* 0x00000b31 */ { 1, { 0x00000b31 } },
+	/* 0x00000b32 */ { 1, { 0x00000b32 } },
+	/* 0x00000b33 */ { 1, { 0x00000b33 } },
+	/* 0x00000b34 */ { 1, { 0x00000b34 } },
+	/* 0x00000b35 */ { 1, { 0x00000b35 } },
+	/* 0x00000b36 */ { 1, { 0x00000b36 } },
+	/* 0x00000b37 */ { 1, { 0x00000b37 } },
+	/* 0x00000b38 */ { 1, { 0x00000b38 } },
+	/* 0x00000b39 */ { 1, { 0x00000b39 } },
+	/* 0x00000b3a */ { 1, { 0x00000b3a } },
+	/* 0x00000b3b */ { 1, { 0x00000b3b } },
+	/* 0x00000b3c */ { 1, { 0x00000b3c } },
+	/* 0x00000b3d */ { 1, { 0x00000b3d } },
+	/* 0x00000b3e */ { 1, { 0x00000b3e } },
+	/* 0x00000b3f */ { 1, { 0x00000b3f } },
+	/* 0x00000b40 */ { 1, { 0x00000b40 } },
+	/* 0x00000b41 */ { 1, { 0x00000b41 } },
+	/* 0x00000b42 */ { 1, { 0x00000b42 } },
+	/* 0x00000b43 */ { 1, { 0x00000b43 } },
+	/* 0x00000b44 */ { 1, { 0x00000b44 } },
+	/* 0x00000b45 */ { 1, { 0x00000b45 } },
+	/* 0x00000b46 */ { 1, { 0x00000b46 } },
+	/* 0x00000b47 */ { 1, { 0x00000b47 } },
+	/* 0x00000b48 */ { 2, { 0x00000b47, 0x00000b56 } },
+	/* 0x00000b49 */ { 1, { 0x00000b49 } },
+	/* 0x00000b4a */ { 1, { 0x00000b4a } },
+	/* 0x00000b4b */ { 2, { 0x00000b47, 0x00000b3e } },
+	/* 0x00000b4c */ { 2, { 0x00000b47, 0x00000b57 } },
+	/* 0x00000b4d */ { 1, { 0x00000b4d } },
+	/* 0x00000b4e */ { 1, { 0x00000b4e } },
+	/* 0x00000b4f */ { 1, { 0x00000b4f } },
+	/* 0x00000b50 */ { 1, { 0x00000b50 } },
+	/* 0x00000b51 */ { 1, { 0x00000b51 } },
+	/* 0x00000b52 */ { 1, { 0x00000b52 } },
+	/* 0x00000b53 */ { 1, { 0x00000b53 } },
+	/* 0x00000b54 */ { 1, { 0x00000b54 } },
+	/* 0x00000b55 */ { 1, { 0x00000b55 } },
+	/* 0x00000b56 */ { 1, { 0x00000b56 } },
+	/* 0x00000b57 */ { 1, { 0x00000b57 } },
+	/* 0x00000b58 */ { 1, { 0x00000b58 } },
+	/* 0x00000b59 */ { 1, { 0x00000b59 } },
+	/* 0x00000b5a */ { 1, { 0x00000b5a } },
+	/* 0x00000b5b */ { 1, { 0x00000b5b } },
+	/* 0x00000b5c */ { 2, { 0x00000b21, 0x00000b3c } },
+	/* 0x00000b5d */ { 2, { 0x00000b22, 0x00000b3c } },
+	/* 0x00000b5e */ { 1, { 0x00000b5e } },
+	/* 0x00000b5f */ { 1, { 0x00000b5f } },
+	/* 0x00000b60 */ { 1, { 0x00000b60 } },
+	/* 0x00000b61 */ { 1, { 0x00000b61 } },
+	/* 0x00000b62 */ { 1, { 0x00000b62 } },
+	/* 0x00000b63 */ { 1, { 0x00000b63 } },
+	/* 0x00000b64 */ { 1, { 0x00000b64 } },
+	/* 0x00000b65 */ { 1, { 0x00000b65 } },
+	/* 0x00000b66 */ { 1, { 0x00000b66 } },
+	/* 0x00000b67 */ { 1, { 0x00000b67 } },
+	/* 0x00000b68 */ { 1, { 0x00000b68 } },
+	/* 0x00000b69 */ { 1, { 0x00000b69 } },
+	/* 0x00000b6a */ { 1, { 0x00000b6a } },
+	/* 0x00000b6b */ { 1, { 0x00000b6b } },
+	/* 0x00000b6c */ { 1, { 0x00000b6c } },
+	/* 0x00000b6d */ { 1, { 0x00000b6d } },
+	/* 0x00000b6e */ { 1, { 0x00000b6e } },
+	/* 0x00000b6f */ { 1, { 0x00000b6f } },
+	/* 0x00000b70 */ { 1, { 0x00000b70 } },
+	/* 0x00000b71 */ { 1, { 0x00000b71 } },
+	/* 0x00000b72 */ { 1, { 0x00000b72 } },
+	/* 0x00000b73 */ { 1, { 0x00000b73 } },
+	/* 0x00000b74 */ { 1, { 0x00000b74 } },
+	/* 0x00000b75 */ { 1, { 0x00000b75 } },
+	/* 0x00000b76 */ { 1, { 0x00000b76 } },
+	/* 0x00000b77 */ { 1, { 0x00000b77 } },
+	/* 0x00000b78 */ { 1, { 0x00000b78 } },
+	/* 0x00000b79 */ { 1, { 0x00000b79 } },
+	/* 0x00000b7a */ { 1, { 0x00000b7a } },
+	/* 0x00000b7b */ { 1, { 0x00000b7b } },
+	/* 0x00000b7c */ { 1, { 0x00000b7c } },
+	/* 0x00000b7d */ { 1, { 0x00000b7d } },
+	/* 0x00000b7e */ { 1, { 0x00000b7e } },
+	/* 0x00000b7f */ { 1, { 0x00000b7f } },
+	/* 0x00000b80 */ { 1, { 0x00000b80 } },
+	/* 0x00000b81 */ { 1, { 0x00000b81 } },
+	/* 0x00000b82 */ { 1, { 0x00000b82 } },
+	/* 0x00000b83 */ { 1, { 0x00000b83 } },
+	/* 0x00000b84 */ { 1, { 0x00000b84 } },
+	/* 0x00000b85 */ { 1, { 0x00000b85 } },
+	/* 0x00000b86 */ { 1, { 0x00000b86 } },
+	/* 0x00000b87 */ { 1, { 0x00000b87 } },
+	/* 0x00000b88 */ { 1, { 0x00000b88 } },
+	/* 0x00000b89 */ { 1, { 0x00000b89 } },
+	/* 0x00000b8a */ { 1, { 0x00000b8a } },
+	/* 0x00000b8b */ { 1, { 0x00000b8b } },
+	/* 0x00000b8c */ { 1, { 0x00000b8c } },
+	/* 0x00000b8d */ { 1, { 0x00000b8d } },
+	/* 0x00000b8e */ { 1, { 0x00000b8e } },
+	/* 0x00000b8f */ { 1, { 0x00000b8f } },
+	/* 0x00000b90 */ { 1, { 0x00000b90 } },
+	/* 0x00000b91 */ { 1, { 0x00000b91 } },
+	/* 0x00000b92 */ { 1, { 0x00000b92 } },
+	/* 0x00000b93 */ { 1, { 0x00000b93 } },
+	/* 0x00000b94 */ { 2, { 0x00000b92, 0x00000bd7 } },
+	/* 0x00000b95 */ { 1, { 0x00000b95 } },
+	/* 0x00000b96 */ { 1, { 0x00000b96 } },
+	/* 0x00000b97 */ { 1, { 0x00000b97 } },
+	/* 0x00000b98 */ { 1, { 0x00000b98 } },
+	/* 0x00000b99 */ { 1, { 0x00000b99 } },
+	/* 0x00000b9a */ { 1, { 0x00000b9a } },
+	/* 0x00000b9b */ { 1, { 0x00000b9b } },
+	/* 0x00000b9c */ { 1, { 0x00000b9c } },
+	/* 0x00000b9d */ { 1, { 0x00000b9d } },
+	/* 0x00000b9e */ { 1, { 0x00000b9e } },
+	/* 0x00000b9f */ { 1, { 0x00000b9f } },
+	/* 0x00000ba0 */ { 1, { 0x00000ba0 } },
+	/* 0x00000ba1 */ { 1, { 0x00000ba1 } },
+	/* 0x00000ba2 */ { 1, { 0x00000ba2 } },
+	/* 0x00000ba3 */ { 1, { 0x00000ba3 } },
+	/* 0x00000ba4 */ { 1, { 0x00000ba4 } },
+	/* 0x00000ba5 */ { 1, { 0x00000ba5 } },
+	/* 0x00000ba6 */ { 1, { 0x00000ba6 } },
+	/* 0x00000ba7 */ { 1, { 0x00000ba7 } },
+	/* 0x00000ba8 */ { 1, { 0x00000ba8 } },
+	/* 0x00000ba9 */ { 1, { 0x00000ba9 } },
+	/* 0x00000baa */ { 1, { 0x00000baa } },
+	/* 0x00000bab */ { 1, { 0x00000bab } },
+	/* 0x00000bac */ { 1, { 0x00000bac } },
+	/* 0x00000bad */ { 1, { 0x00000bad } },
+	/* 0x00000bae */ { 1, { 0x00000bae } },
+	/* 0x00000baf */ { 1, { 0x00000baf } },
+	/* 0x00000bb0 */ { 1, { 0x00000bb0 } },
+	/* 0x00000bb1 */ { 1, { 0x00000bb1 } },
+	/* 0x00000bb2 */ { 1, { 0x00000bb2 } },
+	/* 0x00000bb3 */ { 1, { 0x00000bb3 } },
+	/* 0x00000bb4 */ { 1, { 0x00000bb4 } },
+	/* 0x00000bb5 */ { 1, { 0x00000bb5 } },
+	/* 0x00000bb6 */ { 1, { 0x00000bb6 } },
+	/* 0x00000bb7 */ { 1, { 0x00000bb7 } },
+	/* 0x00000bb8 */ { 1, { 0x00000bb8 } },
+	/* 0x00000bb9 */ { 1, { 0x00000bb9 } },
+	/* 0x00000bba */ { 1, { 0x00000bba } },
+	/* 0x00000bbb */ { 1, { 0x00000bbb } },
+	/* 0x00000bbc */ { 1, { 0x00000bbc } },
+	/* 0x00000bbd */ { 1, { 0x00000bbd } },
+	/* 0x00000bbe */ { 1, { 0x00000bbe } },
+	/* 0x00000bbf */ { 1, { 0x00000bbf } },
+	/* 0x00000bc0 */ { 1, { 0x00000bc0 } },
+	/* 0x00000bc1 */ { 1, { 0x00000bc1 } },
+	/* 0x00000bc2 */ { 1, { 0x00000bc2 } },
+	/* 0x00000bc3 */ { 1, { 0x00000bc3 } },
+	/* 0x00000bc4 */ { 1, { 0x00000bc4 } },
+	/* 0x00000bc5 */ { 1, { 0x00000bc5 } },
+	/* 0x00000bc6 */ { 1, { 0x00000bc6 } },
+	/* 0x00000bc7 */ { 1, { 0x00000bc7 } },
+	/* 0x00000bc8 */ { 1, { 0x00000bc8 } },
+	/* 0x00000bc9 */ { 1, { 0x00000bc9 } },
+	/* 0x00000bca */ { 2, { 0x00000bc6, 0x00000bbe } },
+	/* 0x00000bcb */ { 2, { 0x00000bc7, 0x00000bbe } },
+	/* 0x00000bcc */ { 2, { 0x00000bc6, 0x00000bd7 } },
+	/* 0x00000bcd */ { 1, { 0x00000bcd } },
+	/* 0x00000bce */ { 1, { 0x00000bce } },
+	/* 0x00000bcf */ { 1, { 0x00000bcf } },
+	/* 0x00000bd0 */ { 1, { 0x00000bd0 } },
+	/* 0x00000bd1 */ { 1, { 0x00000bd1 } },
+	/* 0x00000bd2 */ { 1, { 0x00000bd2 } },
+	/* 0x00000bd3 */ { 1, { 0x00000bd3 } },
+	/* 0x00000bd4 */ { 1, { 0x00000bd4 } },
+	/* 0x00000bd5 */ { 1, { 0x00000bd5 } },
+	/* 0x00000bd6 */ { 1, { 0x00000bd6 } },
+	/* 0x00000bd7 */ { 1, { 0x00000bd7 } },
+	/* 0x00000bd8 */ { 1, { 0x00000bd8 } },
+	/* 0x00000bd9 */ { 1, { 0x00000bd9 } },
+	/* 0x00000bda */ { 1, { 0x00000bda } },
+	/* 0x00000bdb */ { 1, { 0x00000bdb } },
+	/* 0x00000bdc */ { 1, { 0x00000bdc } },
+	/* 0x00000bdd */ { 1, { 0x00000bdd } },
+	/* 0x00000bde */ { 1, { 0x00000bde } },
+	/* 0x00000bdf */ { 1, { 0x00000bdf } },
+	/* 0x00000be0 */ { 1, { 0x00000be0 } },
+	/* 0x00000be1 */ { 1, { 0x00000be1 } },
+	/* 0x00000be2 */ { 1, { 0x00000be2 } },
+	/* 0x00000be3 */ { 1, { 0x00000be3 } },
+	/* 0x00000be4 */ { 1, { 0x00000be4 } },
+	/* 0x00000be5 */ { 1, { 0x00000be5 } },
+	/* 0x00000be6 */ { 1, { 0x00000be6 } },
+	/* 0x00000be7 */ { 1, { 0x00000be7 } },
+	/* 0x00000be8 */ { 1, { 0x00000be8 } },
+	/* 0x00000be9 */ { 1, { 0x00000be9 } },
+	/* 0x00000bea */ { 1, { 0x00000bea } },
+	/* 0x00000beb */ { 1, { 0x00000beb } },
+	/* 0x00000bec */ { 1, { 0x00000bec } },
+	/* 0x00000bed */ { 1, { 0x00000bed } },
+	/* 0x00000bee */ { 1, { 0x00000bee } },
+	/* 0x00000bef */ { 1, { 0x00000bef } },
+	/* 0x00000bf0 */ { 1, { 0x00000bf0 } },
+	/* 0x00000bf1 */ { 1, { 0x00000bf1 } },
+	/* 0x00000bf2 */ { 1, { 0x00000bf2 } },
+	/* 0x00000bf3 */ { 1, { 0x00000bf3 } },
+	/* 0x00000bf4 */ { 1, { 0x00000bf4 } },
+	/* 0x00000bf5 */ { 1, { 0x00000bf5 } },
+	/* 0x00000bf6 */ { 1, { 0x00000bf6 } },
+	/* 0x00000bf7 */ { 1, { 0x00000bf7 } },
+	/* 0x00000bf8 */ { 1, { 0x00000bf8 } },
+	/* 0x00000bf9 */ { 1, { 0x00000bf9 } },
+	/* 0x00000bfa */ { 1, { 0x00000bfa } },
+	/* 0x00000bfb */ { 1, { 0x00000bfb } },
+	/* 0x00000bfc */ { 1, { 0x00000bfc } },
+	/* 0x00000bfd */ { 1, { 0x00000bfd } },
+	/* 0x00000bfe */ { 1, { 0x00000bfe } },
+	/* 0x00000bff */ { 1, { 0x00000bff } }
+};
+
+static libfshfs_name_decomposition_mapping_t libfshfs_name_decomposition_mappings_0x00000c00[ 256 ] = {
+	/* 0x00000c00 */ { 1, { 0x00000c00 } },
+	/* 0x00000c01 */ { 1, { 0x00000c01 } },
+	/* 0x00000c02 */ { 1, { 0x00000c02 } },
+	/* 0x00000c03 */ { 1, { 0x00000c03 } },
+	/* 0x00000c04 */ { 1, { 0x00000c04 } },
+	/* 0x00000c05 */ { 1, { 0x00000c05 } },
+	/* 0x00000c06 */ { 1, { 0x00000c06 } },
+	/* 0x00000c07 */ { 1, { 0x00000c07 } },
+	/* 0x00000c08 */ { 1, { 0x00000c08 } },
+	/* 0x00000c09 */ { 1, { 0x00000c09 } },
+	/* 0x00000c0a */ { 1, { 0x00000c0a } },
+	/* 0x00000c0b */ { 1, { 0x00000c0b } },
+	/* 0x00000c0c */ { 1, { 0x00000c0c } },
+	/* 0x00000c0d */ { 1, { 0x00000c0d } },
+	/* 0x00000c0e */ { 1, { 0x00000c0e } },
+	/* 0x00000c0f */ { 1, { 0x00000c0f } },
+	/* 0x00000c10 */ { 1, { 0x00000c10 } },
+	/* 0x00000c11 */ { 1, { 0x00000c11 } },
+	/* 0x00000c12 */ { 1, { 0x00000c12 } },
+	/* 0x00000c13 */ { 1, { 0x00000c13 } },
+	/* 0x00000c14 */ { 1, { 0x00000c14 } },
+	/* 0x00000c15 */ { 1, { 0x00000c15 } },
+	/* 0x00000c16 */ { 1, { 0x00000c16 } },
+	/* 0x00000c17 */ { 1, { 0x00000c17 } },
+	/* 0x00000c18 */ { 1, { 0x00000c18 } },
+	/* 0x00000c19 */ { 1, { 0x00000c19 } },
+	/* 0x00000c1a */ { 1, { 0x00000c1a } },
+	/* 0x00000c1b */ { 1, { 0x00000c1b } },
+	/* 0x00000c1c */ { 1, { 0x00000c1c } },
+	/* 0x00000c1d */ { 1, { 0x00000c1d } },
+	/* 0x00000c1e */ { 1, { 0x00000c1e } },
+	/* 0x00000c1f */ { 1, { 0x00000c1f } },
+	/* 0x00000c20 */ { 1, { 0x00000c20 } },
+	/* 0x00000c21 */ { 1, { 0x00000c21 } },
+	/* 0x00000c22 */ { 1, { 0x00000c22 } },
+	/* 0x00000c23 */ { 1, { 0x00000c23 } },
+	/* 0x00000c24 */ { 1, { 0x00000c24 } },
+	/* 0x00000c25 */ { 1, { 0x00000c25 } },
+	/* 0x00000c26 */ { 1, { 0x00000c26 } },
+	/* 0x00000c27 */ { 1, { 0x00000c27 } },
+	/* 0x00000c28 */ { 1, { 0x00000c28 } },
+	/* 0x00000c29 */ { 1, { 0x00000c29 } },
+	/* 0x00000c2a */ { 1, { 0x00000c2a } },
+	/* 0x00000c2b */ { 1, { 0x00000c2b } },
+	/* 0x00000c2c */ { 1, { 0x00000c2c } },
+	/* 0x00000c2d */ { 1, { 0x00000c2d } },
+	/* 0x00000c2e */ { 1, { 0x00000c2e } },
+	/* 0x00000c2f */ { 1, { 0x00000c2f } },
+	/* 0x00000c30 */ { 1, { 0x00000c30 } },
+	/* 0x00000c31 */ { 1, { 0x00000c31 } },
+	/* 0x00000c32 */ { 1, { 0x00000c32 } },
+	/* 0x00000c33 */ { 1, { 0x00000c33 } },
+	/* 0x00000c34 */ { 1, { 0x00000c34 } },
+	/* 0x00000c35 */ { 1, { 0x00000c35 } },
+	/* 0x00000c36 */ { 1, { 0x00000c36 } },
+	/* 0x00000c37 */ { 1, { 0x00000c37 } },
+	/* 0x00000c38 */ { 1, { 0x00000c38 } },
+	/* 0x00000c39 */ { 1, { 0x00000c39 } },
+	/* 0x00000c3a */ { 1, { 0x00000c3a } },
+	/* 0x00000c3b */ { 1, { 0x00000c3b } },
+	/* 0x00000c3c */ { 1, { 0x00000c3c } },
+	/* 0x00000c3d */ { 1, { 0x00000c3d } },
+	/* 0x00000c3e */ { 1, { 0x00000c3e } },
+	/* 0x00000c3f */ { 1, { 0x00000c3f } },
+	/* 0x00000c40 */ { 1, { 0x00000c40 } },
+	/* 0x00000c41 */ { 1, { 0x00000c41 } },
+	/* 0x00000c42 */ { 1, { 0x00000c42 } },
+	/* 0x00000c43 */ { 1, { 0x00000c43 } },
+	/* 0x00000c44 */ { 1, { 0x00000c44 } },
+	/* 0x00000c45 */ { 1, { 0x00000c45 } },
+	/* 0x00000c46 */ { 1, { 0x00000c46 } },
+	/* 0x00000c47 */ { 1, { 0x00000c47 } },
+	/* 0x00000c48 */ { 2, { 0x00000c46, 0x00000c56 } },
+	/* 0x00000c49 */ { 1, { 0x00000c49 } },
+	/* 0x00000c4a */ { 1, { 0x00000c4a } },
+	/* 0x00000c4b */ { 1, { 0x00000c4b } },
+	/* 0x00000c4c */ { 1, { 0x00000c4c } },
+	/* 0x00000c4d */ { 1, { 0x00000c4d } },
+	/* 0x00000c4e */ { 1, { 0x00000c4e } },
+	/* 0x00000c4f */ { 1, { 0x00000c4f } },
+	/* 0x00000c50 */ { 1, { 0x00000c50 } },
+	/* 0x00000c51 */ { 1, { 0x00000c51 } },
+	/* 0x00000c52 */ { 1, { 0x00000c52 } },
+	/* 0x00000c53 */ { 1, { 0x00000c53 } },
+	/* 0x00000c54 */ { 1, { 0x00000c54 } },
+	/* 0x00000c55 */ { 1, { 0x00000c55 } },
+	/* 0x00000c56 */ { 1, { 0x00000c56 } },
+	/* 0x00000c57 */ { 1, { 0x00000c57 } },
+	/* 0x00000c58 */ { 1, { 0x00000c58 } },
+	/* 0x00000c59 */ { 1, { 0x00000c59 } },
+	/* 0x00000c5a */ { 1, { 0x00000c5a } },
+	/* 0x00000c5b */ { 1, { 0x00000c5b } },
+	/* 0x00000c5c */ { 1, { 0x00000c5c } },
+	/* 0x00000c5d */ { 1, { 0x00000c5d } },
+	/* 0x00000c5e */ { 1, { 0x00000c5e } },
+	/* 0x00000c5f */ { 1, { 0x00000c5f } },
+	/* 0x00000c60 */ { 1, { 0x00000c60 } },
+	/* 0x00000c61 */ { 1, { 0x00000c61 } },
+	/* 0x00000c62 */ { 1, { 0x00000c62 } },
+	/* 0x00000c63 */ { 1, { 0x00000c63 } },
+	/* 0x00000c64 */ { 1, { 0x00000c64 } },
+	/* 0x00000c65 */ { 1, { 0x00000c65 } },
+	/* 0x00000c66 */ { 1, { 0x00000c66 } },
+	/* 0x00000c67 */ { 1, { 0x00000c67 } },
+	/* 0x00000c68 */ { 1, { 0x00000c68 } },
+	/* 0x00000c69 */ { 1, { 0x00000c69 } },
+	/* 0x00000c6a */ { 1, { 0x00000c6a } },
+	/* 0x00000c6b */ { 1, { 0x00000c6b } },
+	/* 0x00000c6c */ { 1, { 0x00000c6c } },
+	/* 0x00000c6d */ { 1, { 0x00000c6d } },
+	/* 0x00000c6e */ { 1, { 0x00000c6e } },
+	/* 0x00000c6f */ { 1, { 0x00000c6f } },
+	/* 0x00000c70 */ { 1, { 0x00000c70 } },
+	/* 0x00000c71 */ { 1, { 0x00000c71 } },
+	/* 0x00000c72 */ { 1, { 0x00000c72 } },
+	/* 0x00000c73 */ { 1, { 0x00000c73 } },
+	/* 0x00000c74 */ { 1, { 0x00000c74 } },
+	/* 0x00000c75 */ { 1, { 0x00000c75 } },
+	/* 0x00000c76 */ { 1, { 0x00000c76 } },
+	/* 0x00000c77 */ { 1, { 0x00000c77 } },
+	/* 0x00000c78 */ { 1, { 0x00000c78 } },
+	/* 0x00000c79 */ { 1, { 0x00000c79 } },
+	/* 0x00000c7a */ { 1, { 0x00000c7a } },
+	/* 0x00000c7b */ { 1, { 0x00000c7b } },
+	/* 0x00000c7c */ { 1, { 0x00000c7c } },
+	/* 0x00000c7d */ { 1, { 0x00000c7d } },
+	/* 0x00000c7e */ { 1, { 0x00000c7e } },
+	/* 0x00000c7f */ { 1, { 0x00000c7f } },
+	/* 0x00000c80 */ { 1, { 0x00000c80 } },
+	/* 0x00000c81 */ { 1, { 0x00000c81 } },
+	/* 0x00000c82 */ { 1, { 0x00000c82 } },
+	/* 0x00000c83 */ { 1, { 0x00000c83 } },
+	/* 0x00000c84 */ { 1, { 0x00000c84 } },
+	/* 0x00000c85 */ { 1, { 0x00000c85 } },
+	/* 0x00000c86 */ { 1, { 0x00000c86 } },
+	/* 0x00000c87 */ { 1, { 0x00000c87 } },
+	/* 0x00000c88 */ { 1, { 0x00000c88 } },
+	/* 0x00000c89 */ { 1, { 0x00000c89 } },
+	/* 0x00000c8a */ { 1, { 0x00000c8a } },
+	/* 0x00000c8b */ { 1, { 0x00000c8b } },
+	/* 0x00000c8c */ { 1, { 0x00000c8c } },
+	/* 0x00000c8d */ { 1, { 0x00000c8d } },
+	/* 0x00000c8e */ { 1, { 0x00000c8e } },
+	/* 0x00000c8f */ { 1, { 0x00000c8f } },
+	/* 0x00000c90 */ { 1, { 0x00000c90 } },
+	/* 0x00000c91 */ { 1, { 0x00000c91 } },
+	/* 0x00000c92 */ { 1, { 0x00000c92 } },
+	/* 0x00000c93 */ { 1, { 0x00000c93 } },
+	/* 0x00000c94 */ { 1, { 0x00000c94 } },
+	/* 0x00000c95 */ { 1, { 0x00000c95 } },
+	/* 0x00000c96 */ { 1, { 0x00000c96 } },
+	/* 0x00000c97 */ { 1, { 0x00000c97 } },
+	/* 0x00000c98 */ { 1, { 0x00000c98 } },
+	/* 0x00000c99 */ { 1, { 0x00000c99 } },
+	/* 0x00000c9a */ { 1, { 0x00000c9a } },
+	/* 0x00000c9b */ { 1, { 0x00000c9b } },
+	/* 0x00000c9c */ { 1, { 0x00000c9c } },
+	/* 0x00000c9d */ { 1, { 0x00000c9d } },
+	/* 0x00000c9e */ { 1, { 0x00000c9e } },
+	/* 0x00000c9f */ { 1, { 0x00000c9f } },
+	/* 0x00000ca0 */ { 1, { 0x00000ca0 } },
+	/* 0x00000ca1 */ { 1, { 0x00000ca1 } },
+	/* 0x00000ca2 */ { 1, { 0x00000ca2 } },
+	/* 0x00000ca3 */ { 1, { 0x00000ca3 } },
+	/* 0x00000ca4 */ { 1, { 0x00000ca4 } },
+	/* 0x00000ca5 */ { 1, { 0x00000ca5 } },
+	/* 0x00000ca6 */ { 1, { 0x00000ca6 } },
+	/* 0x00000ca7 */ { 1, { 0x00000ca7 } },
+	/* 0x00000ca8 */ { 1, { 0x00000ca8 } },
+	/* 0x00000ca9 */ { 1, { 0x00000ca9 } },
+	/* 0x00000caa */ { 1, { 0x00000caa } },
+	/* 0x00000cab */ { 1, { 0x00000cab } },
+	/* 0x00000cac */ { 1, { 0x00000cac } },
+	/* 0x00000cad */ { 1, { 0x00000cad } },
+	/* 0x00000cae */ { 1, { 0x00000cae } },
+	/* 0x00000caf */ { 1, { 0x00000caf } },
+	/* 0x00000cb0 */ { 1, { 0x00000cb0 } },
+	/* 0x00000cb1 */ { 1, { 0x00000cb1 } },
+	/* 0x00000cb2 */ { 1, { 0x00000cb2 } },
+	/* 0x00000cb3 */ { 1, { 0x00000cb3 } },
+	/* 0x00000cb4 */ { 1, { 0x00000cb4 } },
+	/* 0x00000cb5 */ { 1, { 0x00000cb5 } },
+	/* 0x00000cb6 */ { 1, { 0x00000cb6 } },
+	/* 0x00000cb7 */ { 1, { 0x00000cb7 } },
+	/* 0x00000cb8 */ { 1, { 0x00000cb8 } },
+	/* 0x00000cb9 */ { 1, { 0x00000cb9 } },
+	/* 0x00000cba */ { 1, { 0x00000cba } },
+	/* 0x00000cbb */ { 1, { 0x00000cbb } },
+	/* 0x00000cbc */ { 1, { 0x00000cbc } },
+	/* 0x00000cbd */ { 1, { 0x00000cbd } },
+	/* 0x00000cbe */ { 1, { 0x00000cbe } },
+	/* 0x00000cbf */ { 1, { 0x00000cbf } },
+	/* 0x00000cc0 */ { 2, { 0x00000cbf, 0x00000cd5 } },
+	/* 0x00000cc1 */ { 1, { 0x00000cc1 } },
+	/* 0x00000cc2 */ { 1, { 0x00000cc2 } },
+	/* 0x00000cc3 */ { 1, { 0x00000cc3 } },
+	/* 0x00000cc4 */ { 1, { 0x00000cc4 } },
+	/* 0x00000cc5 */ { 1, { 0x00000cc5 } },
+	/* 0x00000cc6 */ { 1, { 0x00000cc6 } },
+	/* 0x00000cc7 */ { 2, { 0x00000cc6, 0x00000cd5 } },
+	/* 0x00000cc8 */ { 2, { 0x00000cc6, 0x00000cd6 } },
+	/* 0x00000cc9 */ { 1, { 0x00000cc9 } },
+	/* 0x00000cca */ { 2, { 0x00000cc6, 0x00000cc2 } },
+	/* 0x00000ccb */ { 3, { 0x00000cc6, 0x00000cc2, 0x00000cd5 } },
+	/* 0x00000ccc */ { 1, { 0x00000ccc } },
+	/* 0x00000ccd */ { 1, { 0x00000ccd } },
+	/* 0x00000cce */ { 1, { 0x00000cce } },
+	/* 0x00000ccf */ { 1, { 0x00000ccf } },
+	/* 0x00000cd0 */ { 1, { 0x00000cd0 } },
+	/* 0x00000cd1 */ { 1, { 0x00000cd1 } },
+	/* 0x00000cd2 */ { 1, { 0x00000cd2 } },
+	/* 0x00000cd3 */ { 1, { 0x00000cd3 } },
+	/* 0x00000cd4 */ { 1, { 0x00000cd4 } },
+	/* 0x00000cd5 */ { 1, { 0x00000cd5 } },
+	/* 0x00000cd6 */ { 1, { 0x00000cd6 } },
+	/* 0x00000cd7 */ { 1, { 0x00000cd7 } },
+	/* 0x00000cd8 */ { 1, { 0x00000cd8 } },
+	/* 0x00000cd9 */ { 1, { 0x00000cd9 } },
+	/* 0x00000cda */ { 1, { 0x00000cda } },
+	/* 0x00000cdb */ { 1, { 0x00000cdb } },
+	/* 0x00000cdc */ { 1, { 0x00000cdc } },
+	/* 0x00000cdd */ { 1, { 0x00000cdd } },
+	/* 0x00000cde */ { 1, { 0x00000cde } },
+	/* 0x00000cdf */ { 1, { 0x00000cdf } },
+	/* 0x00000ce0 */ { 1, { 0x00000ce0 } },
+	/* 0x00000ce1 */ { 1, { 0x00000ce1 } },
+	/* 0x00000ce2 */ { 1, { 0x00000ce2 } },
+	/* 0x00000ce3 */ { 1, { 0x00000ce3 } },
+	/* 0x00000ce4 */ { 1, { 0x00000ce4 } },
+	/* 0x00000ce5 */ { 1, { 0x00000ce5 } },
+	/* 0x00000ce6 */ { 1, { 0x00000ce6 } },
+	/* 0x00000ce7 */ { 1, { 0x00000ce7 } },
+	/* 0x00000ce8 */ { 1, { 0x00000ce8 } },
+	/* 0x00000ce9 */ { 1, { 0x00000ce9 } },
+	/* 0x00000cea */ { 1, { 0x00000cea } },
+	/* 0x00000ceb */ { 1, { 0x00000ceb } },
+	/* 0x00000cec */ { 1, { 0x00000cec } },
+	/* 0x00000ced */ { 1, { 0x00000ced } },
+	/* 0x00000cee */ { 1, { 0x00000cee } },
+	/* 0x00000cef */ { 1, { 0x00000cef } },
+	/* 0x00000cf0 */ { 1, { 0x00000cf0 } },
+	/* 0x00000cf1 */ { 1, { 0x00000cf1 } },
+	/* 0x00000cf2 */ { 1, { 0x00000cf2 } },
+	/* 0x00000cf3 */ { 1, { 0x00000cf3 } },
+	/* 0x00000cf4 */ { 1, { 0x00000cf4 } },
+	/* 0x00000cf5 */ { 1, { 0x00000cf5 } },
+	/* 0x00000cf6 */ { 1, { 0x00000cf6 } },
+	/* 0x00000cf7 */ { 1, { 0x00000cf7 } },
+	/* 0x00000cf8 */ { 1, { 0x00000cf8 } },
+	/* 0x00000cf9 */ { 1, { 0x00000cf9 } },
+	/* 0x00000cfa */ { 1, { 0x00000cfa } },
+	/* 0x00000cfb */ { 1, { 0x00000cfb } },
+	/* 0x00000cfc */ { 1, { 0x00000cfc } },
+	/* 0x00000cfd */ { 1, { 0x00000cfd } },
+	/* 0x00000cfe */ { 1, { 0x00000cfe } },
+	/* 0x00000cff */ { 1, { 0x00000cff } }
+};
+
+static libfshfs_name_decomposition_mapping_t libfshfs_name_decomposition_mappings_0x00000d00[ 256 ] = {
+	/* 0x00000d00 */ { 1, { 0x00000d00 } },
+	/* 0x00000d01 */ { 1, { 0x00000d01 } },
+	/* 0x00000d02 */ { 1, { 0x00000d02 } },
+	/* 0x00000d03 */ { 1, { 0x00000d03 } },
+	/* 0x00000d04 */ { 1, { 0x00000d04 } },
+	/* 0x00000d05 */ { 1, { 0x00000d05 } },
+	/* 0x00000d06 */ { 1, { 0x00000d06 } },
+	/* 0x00000d07 */ { 1, { 0x00000d07 } },
+	/* 0x00000d08 */ { 1, { 0x00000d08 } },
+	/* 0x00000d09 */ { 1, { 0x00000d09 } },
+	/* 0x00000d0a */ { 1, { 0x00000d0a } },
+	/* 0x00000d0b */ { 1, { 0x00000d0b } },
+	/* 0x00000d0c */ { 1, { 0x00000d0c } },
+	/* 0x00000d0d */ { 1, { 0x00000d0d } },
+	/* 0x00000d0e */ { 1, { 0x00000d0e } },
+	/* 0x00000d0f */ { 1, { 0x00000d0f } },
+	/* 0x00000d10 */ { 1, { 0x00000d10 } },
+	/* 0x00000d11 */ { 1, { 0x00000d11 } },
+	/* 0x00000d12 */ { 1, { 0x00000d12 } },
+	/* 0x00000d13 */ { 1, { 0x00000d13 } },
+	/* 0x00000d14 */ { 1, { 0x00000d14 } },
+	/* 0x00000d15 */ { 1, { 0x00000d15 } },
+	/* 0x00000d16 */ { 1, { 0x00000d16 } },
+	/* 0x00000d17 */ { 1, { 0x00000d17 } },
+	/* 0x00000d18 */ { 1, { 0x00000d18 } },
+	/* 0x00000d19 */ { 1, { 0x00000d19 } },
+	/* 0x00000d1a */ { 1, { 0x00000d1a } },
+	/* 0x00000d1b */ { 1, { 0x00000d1b } },
+	/* 0x00000d1c */ { 1, { 0x00000d1c } },
+	/* 0x00000d1d */ { 1, { 0x00000d1d } },
+	/* 0x00000d1e */ { 1, { 0x00000d1e } },
+	/* 0x00000d1f */ { 1, { 0x00000d1f } },
+	/* 0x00000d20 */ { 1, { 0x00000d20 } },
+	/* 0x00000d21 */ { 1, { 0x00000d21 } },
+	/* 0x00000d22 */ { 1, { 0x00000d22 } },
+	/* 0x00000d23 */ { 1, { 0x00000d23 } },
+	/* 0x00000d24 */ { 1, { 0x00000d24 } },
+	/* 0x00000d25 */ { 1, { 0x00000d25 } },
+	/* 0x00000d26 */ { 1, { 0x00000d26 } },
+	/* 0x00000d27 */ { 1, { 0x00000d27 } },
+	/* 0x00000d28 */ { 1, { 0x00000d28 } },
+	/* 0x00000d29 */ { 1, { 0x00000d29 } },
+	/* 0x00000d2a */ { 1, { 0x00000d2a } },
+	/* 0x00000d2b */ { 1, { 0x00000d2b } },
+	/* 0x00000d2c */ { 1, { 0x00000d2c } },
+	/* 0x00000d2d */ { 1, { 0x00000d2d } },
+	/* 0x00000d2e */ { 1, { 0x00000d2e } },
+	/* 0x00000d2f */ { 1, { 0x00000d2f } },
+	/* 0x00000d30 */ { 1, { 0x00000d30 } },
+	/* 0x00000d31 */ { 1, { 0x00000d31 } },
+	/* 0x00000d32 */ { 1, { 0x00000d32 } },
+	/* 0x00000d33 */ { 1, { 0x00000d33 } },
+	/* 0x00000d34 */ { 1, { 0x00000d34 } },
+	/* 0x00000d35 */ { 1, { 0x00000d35 } },
+	/* 0x00000d36 */ { 1, { 0x00000d36 } },
+	/* 0x00000d37 */ { 1, { 0x00000d37 } },
+	/* 0x00000d38 */ { 1, { 0x00000d38 } },
+	/* 0x00000d39 */ { 1, { 0x00000d39 } },
+	/* 0x00000d3a */ { 1, { 0x00000d3a } },
+	/* 0x00000d3b */ { 1, { 0x00000d3b } },
+	/* 0x00000d3c */ { 1, { 0x00000d3c } },
+	/* 0x00000d3d */ { 1, { 0x00000d3d } },
+	/* 0x00000d3e */ { 1, { 0x00000d3e } },
+	/* 0x00000d3f */ { 1, { 0x00000d3f } },
+	/* 0x00000d40 */ { 1, { 0x00000d40 } },
+	/* 0x00000d41 */ { 1, { 0x00000d41 } },
+	/* 0x00000d42 */ { 1, { 0x00000d42 } },
+	/* 0x00000d43 */ { 1, { 0x00000d43 } },
+	/* 0x00000d44 */ { 1, { 0x00000d44 } },
+	/* 0x00000d45 */ { 1, { 0x00000d45 } },
+	/* 0x00000d46 */ { 1, { 0x00000d46 } },
+	/* 0x00000d47 */ { 1, { 0x00000d47 } },
+	/* 0x00000d48 */ { 1, { 0x00000d48 } },
+	/* 0x00000d49 */ { 1, { 0x00000d49 } },
+	/* 0x00000d4a */ { 2, { 0x00000d46, 0x00000d3e } },
+	/* 0x00000d4b */ { 2, { 0x00000d47, 0x00000d3e } },
+	/* 0x00000d4c */ { 2, { 0x00000d46, 0x00000d57 } },
+	/* 0x00000d4d */ { 1, { 0x00000d4d } },
+	/* 0x00000d4e */ { 1, { 0x00000d4e } },
+	/* 0x00000d4f */ { 1, { 0x00000d4f } },
+	/* 0x00000d50 */ { 1, { 0x00000d50 } },
+	/* 0x00000d51 */ { 1, { 0x00000d51 } },
+	/* 0x00000d52 */ { 1, { 0x00000d52 } },
+	/* 0x00000d53 */ { 1, { 0x00000d53 } },
+	/* 0x00000d54 */ { 1, { 0x00000d54 } },
+	/* 0x00000d55 */ { 1, { 0x00000d55 } },
+	/* 0x00000d56 */ { 1, { 0x00000d56 } },
+	/* 0x00000d57 */ { 1, { 0x00000d57 } },
+	/* 0x00000d58 */ { 1, { 0x00000d58 } },
+	/* 0x00000d59 */ { 1, { 0x00000d59 } },
+	/* 0x00000d5a */ { 1, { 0x00000d5a } },
+	/* 0x00000d5b */ { 1, { 0x00000d5b } },
+	/* 0x00000d5c */ { 1, { 0x00000d5c } },
+	/* 0x00000d5d */ { 1, { 0x00000d5d } },
+	/* 0x00000d5e */ { 1, { 0x00000d5e } },
+	/* 0x00000d5f */ { 1, { 0x00000d5f } },
+	/* 0x00000d60 */ { 1, { 0x00000d60 } },
+	/* 0x00000d61 */ { 1, { 0x00000d61 } },
+	/* 0x00000d62 */ { 1, { 0x00000d62 } },
+	/* 0x00000d63 */ { 1, { 0x00000d63 } },
+	/* 0x00000d64 */ { 1, { 0x00000d64 } },
+	/* 0x00000d65 */ { 1, { 0x00000d65 } },
+	/* 0x00000d66 */ { 1, { 0x00000d66 } },
+	/* 0x00000d67 */ { 1, { 0x00000d67 } },
+	/* 0x00000d68 */ { 1, { 0x00000d68 } },
+	/* 0x00000d69 */ { 1, { 0x00000d69 } },
+	/* 0x00000d6a */ { 1, { 0x00000d6a } },
+	/* 0x00000d6b */ { 1, { 0x00000d6b } },
+	/* 0x00000d6c */ { 1, { 0x00000d6c } },
+	/* 0x00000d6d */ { 1, { 0x00000d6d } },
+	/* 0x00000d6e */ { 1, { 0x00000d6e } },
+	/* 0x00000d6f */ { 1, { 0x00000d6f } },
+	/* 0x00000d70 */ { 1, { 0x00000d70 } },
+	/* 0x00000d71 */ { 1, { 0x00000d71 } },
+	/* 0x00000d72 */ { 1, { 0x00000d72 } },
+	/* 0x00000d73 */ { 1, { 0x00000d73 } },
+	/* 0x00000d74 */ { 1, { 0x00000d74 } },
+	/* 0x00000d75 */ { 1, { 0x00000d75 } },
+	/* 0x00000d76 */ { 1, { 0x00000d76 } },
+	/* 0x00000d77 */ { 1, { 0x00000d77 } },
+	/* 0x00000d78 */ { 1, { 0x00000d78 } },
+	/* 0x00000d79 */ { 1, { 0x00000d79 } },
+	/* 0x00000d7a */ { 1, { 0x00000d7a } },
+	/* 0x00000d7b */ { 1, { 0x00000d7b } },
+	/* 0x00000d7c */ { 1, { 0x00000d7c } },
+	/* 0x00000d7d */ { 1, { 0x00000d7d } },
+	/* 0x00000d7e */ { 1, { 0x00000d7e } },
+	/* 0x00000d7f */ { 1, { 0x00000d7f } },
+	/* 0x00000d80 */ { 1, { 0x00000d80 } },
+	/* 0x00000d81 */ { 1, { 0x00000d81 } },
+	/* 0x00000d82 */ { 1, { 0x00000d82 } },
+	/* 0x00000d83 */ { 1, { 0x00000d83 } },
+	/* 0x00000d84 */ { 1, { 0x00000d84 } },
+	/* 0x00000d85 */ { 1, { 0x00000d85 } },
+	/* 0x00000d86 */ { 1, { 0x00000d86 } },
+	/* 0x00000d87 */ { 1, { 0x00000d87 } },
+	/* 0x00000d88 */ { 1, { 0x00000d88 } },
+	/* 0x00000d89 */ { 1, { 0x00000d89 } },
+	/* 0x00000d8a */ { 1, { 0x00000d8a } },
+	/* 0x00000d8b */ { 1, { 0x00000d8b } },
+	/* 0x00000d8c */ { 1, { 0x00000d8c } },
+	/* 0x00000d8d */ { 1, { 0x00000d8d } },
+	/* 0x00000d8e */ { 1, { 0x00000d8e } },
+	/* 0x00000d8f */ { 1, { 0x00000d8f } },
+	/* 0x00000d90 */ { 1, { 0x00000d90 } },
+	/* 0x00000d91 */ { 1, { 0x00000d91 } },
+	/* 0x00000d92 */ { 1, { 0x00000d92 } },
+	/* 0x00000d93 */ { 1, { 0x00000d93 } },
+	/* 0x00000d94 */ { 1, { 0x00000d94 } },
+	/* 0x00000d95 */ { 1, { 0x00000d95 } },
+	/* 0x00000d96 */ { 1, { 0x00000d96 } },
+	/* 0x00000d97 */ { 1, { 0x00000d97 } },
+	/* 0x00000d98 */ { 1, { 0x00000d98 } },
+	/* 0x00000d99 */ { 1, { 0x00000d99 } },
+	/* 0x00000d9a */ { 1, { 0x00000d9a } },
+	/* 0x00000d9b */ { 1, { 0x00000d9b } },
+	/* 0x00000d9c */ { 1, { 0x00000d9c } },
+	/* 0x00000d9d */ { 1, { 0x00000d9d } },
+	/* 0x00000d9e */ { 1, { 0x00000d9e } },
+	/* 0x00000d9f */ { 1, { 0x00000d9f } },
+	/* 0x00000da0 */ { 1, { 0x00000da0 } },
+	/* 0x00000da1 */ { 1, { 0x00000da1 } },
+	/* 0x00000da2 */ { 1, { 0x00000da2 } },
+	/* 0x00000da3 */ { 1, { 0x00000da3 } },
+	/* 0x00000da4 */ { 1, { 0x00000da4 } },
+	/* 0x00000da5 */ { 1, { 0x00000da5 } },
+	/* 0x00000da6 */ { 1, { 0x00000da6 } },
+	/* 0x00000da7 */ { 1, { 0x00000da7 } },
+	/* 0x00000da8 */ { 1, { 0x00000da8 } },
+	/* 0x00000da9 */ { 1, { 0x00000da9 } },
+	/* 0x00000daa */ { 1, { 0x00000daa } },
+	/* 0x00000dab */ { 1, { 0x00000dab } },
+	/* 0x00000dac */ { 1, { 0x00000dac } },
+	/* 0x00000dad */ { 1, { 0x00000dad } },
+	/* 0x00000dae */ { 1, { 0x00000dae } },
+	/* 0x00000daf */ { 1, { 0x00000daf } },
+	/* 0x00000db0 */ { 1, { 0x00000db0 } },
+	/* 0x00000db1 */ { 1, { 0x00000db1 } },
+	/* 0x00000db2 */ { 1, { 0x00000db2 } },
+	/* 0x00000db3 */ { 1, { 0x00000db3 } },
+	/* 0x00000db4 */ { 1, { 0x00000db4 } },
+	/* 0x00000db5 */ { 1, { 0x00000db5 } },
+	/* 0x00000db6 */ { 1, { 0x00000db6 } },
+	/* 0x00000db7 */ { 1, { 0x00000db7 } },
+	/* 0x00000db8 */ { 1, { 0x00000db8 } },
+	/* 0x00000db9 */ { 1, { 0x00000db9 } },
+	/* 0x00000dba */ { 1, { 0x00000dba } },
+	/* 0x00000dbb */ { 1, { 0x00000dbb } },
+	/* 0x00000dbc */ { 1, { 0x00000dbc } },
+	/* 0x00000dbd */ { 1, { 0x00000dbd } },
+	/* 0x00000dbe */ { 1, { 0x00000dbe } },
+	/* 0x00000dbf */ { 1, { 0x00000dbf } },
+	/* 0x00000dc0 */ { 1, { 0x00000dc0 } },
+	/* 0x00000dc1 */ { 1, { 0x00000dc1 } },
+	/* 0x00000dc2 */ { 1, { 0x00000dc2 } },
+	/* 0x00000dc3 */ { 1, { 0x00000dc3 } },
+	/* 0x00000dc4 */ { 1, { 0x00000dc4 } },
+	/* 0x00000dc5 */ { 1, { 0x00000dc5 } },
+	/* 0x00000dc6 */ { 1, { 0x00000dc6 } },
+	/* 0x00000dc7 */ { 1, { 0x00000dc7 } },
+	/* 0x00000dc8 */ { 1, { 0x00000dc8 } },
+	/* 0x00000dc9 */ { 1, { 0x00000dc9 } },
+	/* 0x00000dca */ { 1, { 0x00000dca } },
+	/* 0x00000dcb */ { 1, { 0x00000dcb } },
+	/* 0x00000dcc */ { 1, { 0x00000dcc } },
+	/* 0x00000dcd */ { 1, { 0x00000dcd } },
+	/* 0x00000dce */ { 1, { 0x00000dce } },
+	/* 0x00000dcf */ { 1, { 0x00000dcf } },
+	/* 0x00000dd0 */ { 1, { 0x00000dd0 } },
+	/* 0x00000dd1 */ { 1, { 0x00000dd1 } },
+	/* 0x00000dd2 */ { 1, { 0x00000dd2 } },
+	/* 0x00000dd3 */ { 1, { 0x00000dd3 } },
+	/* 0x00000dd4 */ { 1, { 0x00000dd4 } },
+	/* 0x00000dd5 */ { 1, { 0x00000dd5 } },
+	/* 0x00000dd6 */ { 1, { 0x00000dd6 } },
+	/* 0x00000dd7 */ { 1, { 0x00000dd7 } },
+	/* 0x00000dd8 */ { 1, { 0x00000dd8 } },
+	/* 0x00000dd9 */ { 1, { 0x00000dd9 } },
+	/* 0x00000dda */ { 2, { 0x00000dd9, 0x00000dca } },
+	/* 0x00000ddb */ { 1, { 0x00000ddb } },
+	/* 0x00000ddc */ { 2, { 0x00000dd9, 0x00000dcf } },
+	/* 0x00000ddd */ { 3, { 0x00000dd9, 0x00000dcf, 0x00000dca } },
+	/* 0x00000dde */ { 2, { 0x00000dd9, 0x00000ddf } },
+	/* 0x00000ddf */ { 1, { 0x00000ddf } },
+	/* 0x00000de0 */ { 1, { 0x00000de0 } },
+	/* 0x00000de1 */ { 1, { 0x00000de1 } },
+	/* 0x00000de2 */ { 1, { 0x00000de2 } },
+	/* 0x00000de3 */ { 1, { 0x00000de3 } },
+	/* 0x00000de4 */ { 1, { 0x00000de4 } },
+	/* 0x00000de5 */ { 1, { 0x00000de5 } },
+	/* 0x00000de6 */ { 1, { 0x00000de6 } },
+	/* 0x00000de7 */ { 1, { 0x00000de7 } },
+	/* 0x00000de8 */ { 1, { 0x00000de8 } },
+	/* 0x00000de9 */ { 1, { 0x00000de9 } },
+	/* 0x00000dea */ { 1, { 0x00000dea } },
+	/* 0x00000deb */ { 1, { 0x00000deb } },
+	/* 0x00000dec */ { 1, { 0x00000dec } },
+	/* 0x00000ded */ { 1, { 0x00000ded } },
+	/* 0x00000dee */ { 1, { 0x00000dee } },
+	/* 0x00000def */ { 1, { 0x00000def } },
+	/* 0x00000df0 */ { 1, { 0x00000df0 } },
+	/* 0x00000df1 */ { 1, { 0x00000df1 } },
+	/* 0x00000df2 */ { 1, { 0x00000df2 } },
+	/* 0x00000df3 */ { 1, { 0x00000df3 } },
+	/* 0x00000df4 */ { 1, { 0x00000df4 } },
+	/* 0x00000df5 */ { 1, { 0x00000df5 } },
+	/* 0x00000df6 */ { 1, { 0x00000df6 } },
+	/* 0x00000df7 */ { 1, { 0x00000df7 } },
+	/* 0x00000df8 */ { 1, { 0x00000df8 } },
+	/* 0x00000df9 */ { 1, { 0x00000df9 } },
+	/* 0x00000dfa */ { 1, { 0x00000dfa } },
+	/* 0x00000dfb */ { 1, { 0x00000dfb } },
+	/* 0x00000dfc */ { 1, { 0x00000dfc } },
+	/* 0x00000dfd */ { 1, { 0x00000dfd } },
+	/* 0x00000dfe */ { 1, { 0x00000dfe } },
+	/* 0x00000dff */ { 1, { 0x00000dff } }
+};
+
+static libfshfs_name_decomposition_mapping_t libfshfs_name_decomposition_mappings_0x00000f00[ 256 ] = {
+	/* 0x00000f00 */ { 1, { 0x00000f00 } },
+	/* 0x00000f01 */ { 1, { 0x00000f01 } },
+	/* 0x00000f02 */ { 1, { 0x00000f02 } },
+	/* 0x00000f03 */ { 1, { 0x00000f03 } },
+	/* 0x00000f04 */ { 1, { 0x00000f04 } },
+	/* 0x00000f05 */ { 1, { 0x00000f05 } },
+	/* 0x00000f06 */ { 1, { 0x00000f06 } },
+	/* 0x00000f07 */ { 1, { 0x00000f07 } },
+	/* 0x00000f08 */ { 1, { 0x00000f08 } },
+	/* 0x00000f09 */ { 1, { 0x00000f09 } },
+	/* 0x00000f0a */ { 1, { 0x00000f0a } },
+	/* 0x00000f0b */ { 1, { 0x00000f0b } },
+	/* 0x00000f0c */ { 1, { 0x00000f0c } },
+	/* 0x00000f0d */ { 1, { 0x00000f0d } },
+	/* 0x00000f0e */ { 1, { 0x00000f0e } },
+	/* 0x00000f0f */ { 1, { 0x00000f0f } },
+	/* 0x00000f10 */ { 1, { 0x00000f10 } },
+	/* 0x00000f11 */ { 1, { 0x00000f11 } },
+	/* 0x00000f12 */ { 1, { 0x00000f12 } },
+	/* 0x00000f13 */ { 1, { 0x00000f13 } },
+	/* 0x00000f14 */ { 1, { 0x00000f14 } },
+	/* 0x00000f15 */ { 1, { 0x00000f15 } },
+	/* 0x00000f16 */ { 1, { 0x00000f16 } },
+	/* 0x00000f17 */ { 1, { 0x00000f17 } },
+	/* 0x00000f18 */ { 1, { 0x00000f18 } },
+	/* 0x00000f19 */ { 1, { 0x00000f19 } },
+	/* 0x00000f1a */ { 1, { 0x00000f1a } },
+	/* 0x00000f1b */ { 1, { 0x00000f1b } },
+	/* 0x00000f1c */ { 1, { 0x00000f1c } },
+	/* 0x00000f1d */ { 1, { 0x00000f1d } },
+	/* 0x00000f1e */ { 1, { 0x00000f1e } },
+	/* 0x00000f1f */ { 1, { 0x00000f1f } },
+	/* 0x00000f20 */ { 1, { 0x00000f20 } },
+	/* 0x00000f21 */ { 1, { 0x00000f21 } },
+	/* 0x00000f22 */ { 1, { 0x00000f22 } },
+	/* 0x00000f23 */ { 1, { 0x00000f23 } },
+	/* 0x00000f24 */ { 1, { 0x00000f24 } },
+	/* 0x00000f25 */ { 1, { 0x00000f25 } },
+	/* 0x00000f26 */ { 1, { 0x00000f26 } },
+	/* 0x00000f27 */ { 1, { 0x00000f27 } },
+	/* 0x00000f28 */ { 1, { 0x00000f28 } },
+	/* 0x00000f29 */ { 1, { 0x00000f29 } },
+	/* 0x00000f2a */ { 1, { 0x00000f2a } },
+	/* 0x00000f2b */ { 1, { 0x00000f2b } },
+	/* 0x00000f2c */ { 1, { 0x00000f2c } },
+	/* 0x00000f2d */ { 1, { 0x00000f2d } },
+	/* 0x00000f2e */ { 1, { 0x00000f2e } },
+	/* 0x00000f2f */ { 1, { 0x00000f2f } },
+	/* 0x00000f30 */ { 1, { 0x00000f30 } },
+	/* 0x00000f31 */ { 1, { 0x00000f31 } },
+	/* 0x00000f32 */ { 1, { 0x00000f32 } },
+	/* 0x00000f33 */ { 1, { 0x00000f33 } },
+	/* 0x00000f34 */ { 1, { 0x00000f34 } },
+	/* 0x00000f35 */ { 1, { 0x00000f35 } },
+	/* 0x00000f36 */ { 1, { 0x00000f36 } },
+	/* 0x00000f37 */ { 1, { 0x00000f37 } },
+	/* 0x00000f38 */ { 1, { 0x00000f38 } },
+	/* 0x00000f39 */ { 1, { 0x00000f39 } },
+	/* 0x00000f3a */ { 1, { 0x00000f3a } },
+	/* 0x00000f3b */ { 1, { 0x00000f3b } },
+	/* 0x00000f3c */ { 1, { 0x00000f3c } },
+	/* 0x00000f3d */ { 1, { 0x00000f3d } },
+	/* 0x00000f3e */ { 1, { 0x00000f3e } },
+	/* 0x00000f3f */ { 1, { 0x00000f3f } },
+	/* 0x00000f40 */ { 1, { 0x00000f40 } },
+	/* 0x00000f41 */ { 1, { 0x00000f41 } },
+	/* 0x00000f42 */ { 1, { 0x00000f42 } },
+	/* 0x00000f43 */ { 2, { 0x00000f42, 0x00000fb7 } },
+	/* 0x00000f44 */ { 1, { 0x00000f44 } },
+	/* 0x00000f45 */ { 1, { 0x00000f45 } },
+	/* 0x00000f46 */ { 1, { 0x00000f46 } },
+	/* 0x00000f47 */ { 1, { 0x00000f47 } },
+	/* 0x00000f48 */ { 1, { 0x00000f48 } },
+	/* 0x00000f49 */ { 1, { 0x00000f49 } },
+	/* 0x00000f4a */ { 1, { 0x00000f4a } },
+	/* 0x00000f4b */ { 1, { 0x00000f4b } },
+	/* 0x00000f4c */ { 1, { 0x00000f4c } },
+	/* 0x00000f4d */ { 2, { 0x00000f4c, 0x00000fb7 } },
+	/* 0x00000f4e */ { 1, { 0x00000f4e } },
+	/* 0x00000f4f */ { 1, { 0x00000f4f } },
+	/* 0x00000f50 */ { 1, { 0x00000f50 } },
+	/* 0x00000f51 */ { 1, { 0x00000f51 } },
+	/* 0x00000f52 */ { 2, { 0x00000f51, 0x00000fb7 } },
+	/* 0x00000f53 */ { 1, { 0x00000f53 } },
+	/* 0x00000f54 */ { 1, { 0x00000f54 } },
+	/* 0x00000f55 */ { 1, { 0x00000f55 } },
+	/* 0x00000f56 */ { 1, { 0x00000f56 } },
+	/* 0x00000f57 */ { 2, { 0x00000f56, 0x00000fb7 } },
+	/* 0x00000f58 */ { 1, { 0x00000f58 } },
+	/* 0x00000f59 */ { 1, { 0x00000f59 } },
+	/* 0x00000f5a */ { 1, { 0x00000f5a } },
+	/* 0x00000f5b */ { 1, { 0x00000f5b } },
+	/* 0x00000f5c */ { 2, { 0x00000f5b, 0x00000fb7 } },
+	/* 0x00000f5d */ { 1, { 0x00000f5d } },
+	/* 0x00000f5e */ { 1, { 0x00000f5e } },
+	/* 0x00000f5f */ { 1, { 0x00000f5f } },
+	/* 0x00000f60 */ { 1, { 0x00000f60 } },
+	/* 0x00000f61 */ { 1, { 0x00000f61 } },
+	/* 0x00000f62 */ { 1, { 0x00000f62 } },
+	/* 0x00000f63 */ { 1, { 0x00000f63 } },
+	/* 0x00000f64 */ { 1, { 0x00000f64 } },
+	/* 0x00000f65 */ { 1, { 0x00000f65 } },
+	/* 0x00000f66 */ { 1, { 0x00000f66 } },
+	/* 0x00000f67 */ { 1, { 0x00000f67 } },
+	/* 0x00000f68 */ { 1, { 0x00000f68 } },
+	/* 0x00000f69 */ { 2, { 0x00000f40, 0x00000fb5 } },
+	/* 0x00000f6a */ { 1, { 0x00000f6a } },
+	/* 0x00000f6b */ { 1, { 0x00000f6b } },
+	/* 0x00000f6c */ { 1, { 0x00000f6c } },
+	/* 0x00000f6d */ { 1, { 0x00000f6d } },
+	/* 0x00000f6e */ { 1, { 0x00000f6e } },
+	/* 0x00000f6f */ { 1, { 0x00000f6f } },
+	/* 0x00000f70 */ { 1, { 0x00000f70 } },
+	/* 0x00000f71 */ { 1, { 0x00000f71 } },
+	/* 0x00000f72 */ { 1, { 0x00000f72 } },
+	/* 0x00000f73 */ { 2, { 0x00000f71, 0x00000f72 } },
+	/* 0x00000f74 */ { 1, { 0x00000f74 } },
+	/* 0x00000f75 */ { 2, { 0x00000f71, 0x00000f74 } },
+	/* 0x00000f76 */ { 2, { 0x00000fb2, 0x00000f80 } },
+	/* 0x00000f77 */ { 1, { 0x00000f77 } },
+	/* 0x00000f78 */ { 2, { 0x00000fb3, 0x00000f80 } },
+	/* 0x00000f79 */ { 1, { 0x00000f79 } },
+	/* 0x00000f7a */ { 1, { 0x00000f7a } },
+	/* 0x00000f7b */ { 1, { 0x00000f7b } },
+	/* 0x00000f7c */ { 1, { 0x00000f7c } },
+	/* 0x00000f7d */ { 1, { 0x00000f7d } },
+	/* 0x00000f7e */ { 1, { 0x00000f7e } },
+	/* 0x00000f7f */ { 1, { 0x00000f7f } },
+	/* 0x00000f80 */ { 1, { 0x00000f80 } },
+	/* 0x00000f81 */ { 2, { 0x00000f71, 0x00000f80 } },
+	/* 0x00000f82 */ { 1, { 0x00000f82 } },
+	/* 0x00000f83 */ { 1, { 0x00000f83 } },
+	/* 0x00000f84 */ { 1, { 0x00000f84 } },
+	/* 0x00000f85 */ { 1, { 0x00000f85 } },
+	/* 0x00000f86 */ { 1, { 0x00000f86 } },
+	/* 0x00000f87 */ { 1, { 0x00000f87 } },
+	/* 0x00000f88 */ { 1, { 0x00000f88 } },
+	/* 0x00000f89 */ { 1, { 0x00000f89 } },
+	/* 0x00000f8a */ { 1, { 0x00000f8a } },
+	/* 0x00000f8b */ { 1, { 0x00000f8b } },
+	/* 0x00000f8c */ { 1, { 0x00000f8c } },
+	/* 0x00000f8d */ { 1, { 0x00000f8d } },
+	/* 0x00000f8e */ { 1, { 0x00000f8e } },
+	/* 0x00000f8f */ { 1, { 0x00000f8f } },
+	/* 0x00000f90 */ { 1, { 0x00000f90 } },
+	/* 0x00000f91 */ { 1, { 0x00000f91 } },
+	/* 0x00000f92 */ { 1, { 0x00000f92 } },
+	/* 0x00000f93 */ { 2, { 0x00000f92, 0x00000fb7 } },
+	/* 0x00000f94 */ { 1, { 0x00000f94 } },
+	/* 0x00000f95 */ { 1, { 0x00000f95 } },
+	/* 0x00000f96 */ { 1, { 0x00000f96 } },
+	/* 0x00000f97 */ { 1, { 0x00000f97 } },
+	/* 0x00000f98 */ { 1, { 0x00000f98 } },
+	/* 0x00000f99 */ { 1, { 0x00000f99 } },
+	/* 0x00000f9a */ { 1, { 0x00000f9a } },
+	/* 0x00000f9b */ { 1, { 0x00000f9b } },
+	/* 0x00000f9c */ { 1, { 0x00000f9c } },
+	/* 0x00000f9d */ { 2, { 0x00000f9c, 0x00000fb7 } },
+	/* 0x00000f9e */ { 1, { 0x00000f9e } },
+	/* 0x00000f9f */ { 1, { 0x00000f9f } },
+	/* 0x00000fa0 */ { 1, { 0x00000fa0 } },
+	/* 0x00000fa1 */ { 1, { 0x00000fa1 } },
+	/* 0x00000fa2 */ { 2, { 0x00000fa1, 0x00000fb7 } },
+	/* 0x00000fa3 */ { 1, { 0x00000fa3 } },
+	/* 0x00000fa4 */ { 1, { 0x00000fa4 } },
+	/* 0x00000fa5 */ { 1, { 0x00000fa5 } },
+	/* 0x00000fa6 */ { 1, { 0x00000fa6 } },
+	/* 0x00000fa7 */ { 2, { 0x00000fa6, 0x00000fb7 } },
+	/* 0x00000fa8 */ { 1, { 0x00000fa8 } },
+	/* 0x00000fa9 */ { 1, { 0x00000fa9 } },
+	/* 0x00000faa */ { 1, { 0x00000faa } },
+	/* 0x00000fab */ { 1, { 0x00000fab } },
+	/* 0x00000fac */ { 2, { 0x00000fab, 0x00000fb7 } },
+	/* 0x00000fad */ { 1, { 0x00000fad } },
+	/* 0x00000fae */ { 1, { 0x00000fae } },
+	/* 0x00000faf */ { 1, { 0x00000faf } },
+	/* 0x00000fb0 */ { 1, { 0x00000fb0 } },
+	/* 0x00000fb1 */ { 1, { 0x00000fb1 } },
+	/* 0x00000fb2 */ { 1, { 0x00000fb2 } },
+	/* 0x00000fb3 */ { 1, { 0x00000fb3 } },
+	/* 0x00000fb4 */ { 1, { 0x00000fb4 } },
+	/* 0x00000fb5 */ { 1, { 0x00000fb5 } },
+	/* 0x00000fb6 */ { 1, { 0x00000fb6 } },
+	/* 0x00000fb7 */ { 1, { 0x00000fb7 } },
+	/* 0x00000fb8 */ { 1, { 0x00000fb8 } },
+	/* 0x00000fb9 */ { 2, { 0x00000f90, 0x00000fb5 } },
+	/* 0x00000fba */ { 1, { 0x00000fba } },
+	/* 0x00000fbb */ { 1, { 0x00000fbb } },
+	/* 0x00000fbc */ { 1, { 0x00000fbc } },
+	/* 0x00000fbd */ { 1, { 0x00000fbd } },
+	/* 0x00000fbe */ { 1, { 0x00000fbe } },
+	/* 0x00000fbf */ { 1, { 0x00000fbf } },
+	/* 0x00000fc0 */ { 1, { 0x00000fc0 } },
+	/* 0x00000fc1 */ { 1, { 0x00000fc1 } },
+	/* 0x00000fc2 */ { 1, { 0x00000fc2 } },
+	/* 0x00000fc3 */ { 1, { 0x00000fc3 } },
+	/* 0x00000fc4 */ { 1, { 0x00000fc4 } },
+	/* 0x00000fc5 */ { 1, { 0x00000fc5 } },
+	/* 0x00000fc6 */ { 1, { 0x00000fc6 } },
+	/* 0x00000fc7 */ { 1, { 0x00000fc7 } },
+	/* 0x00000fc8 */ { 1, { 0x00000fc8 } },
+	/* 0x00000fc9 */ { 1, { 0x00000fc9 } },
+	/* 0x00000fca */ { 1, { 0x00000fca } },
+	/* 0x00000fcb */ { 1, { 0x00000fcb } },
+	/* 0x00000fcc */ { 1, { 0x00000fcc } },
+	/* 0x00000fcd */ { 1, { 0x00000fcd } },
+	/* 0x00000fce */ { 1, { 0x00000fce } },
+	/* 0x00000fcf */ { 1, { 0x00000fcf } },
+	/* 0x00000fd0 */ { 1, { 0x00000fd0 } },
+	/* 0x00000fd1 */ { 1, { 0x00000fd1 } },
+	/* 0x00000fd2 */ { 1, { 0x00000fd2 } },
+	/* 0x00000fd3 */ { 1, { 0x00000fd3 } },
+	/* 0x00000fd4 */ { 1, { 0x00000fd4 } },
+	/* 0x00000fd5 */ { 1, { 0x00000fd5 } },
+	/* 0x00000fd6 */ { 1, { 0x00000fd6 } },
+	/* 0x00000fd7 */ { 1, { 0x00000fd7 } },
+	/* 0x00000fd8 */ { 1, { 0x00000fd8 } },
+	/* 0x00000fd9 */ { 1, { 0x00000fd9 } },
+	/* 0x00000fda */ { 1, { 0x00000fda } },
+	/* 0x00000fdb */ { 1, { 0x00000fdb } },
+	/* 0x00000fdc */ { 1, { 0x00000fdc } },
+	/* 0x00000fdd */ { 1, { 0x00000fdd } },
+	/* 0x00000fde */ { 1, { 0x00000fde } },
+	/* 0x00000fdf */ { 1, { 0x00000fdf } },
+	/* 0x00000fe0 */ { 1, { 0x00000fe0 } },
+	/* 0x00000fe1 */ { 1, { 0x00000fe1 } },
+	/* 0x00000fe2 */ { 1, { 0x00000fe2 } },
+	/* 0x00000fe3 */ { 1, { 0x00000fe3 } },
+	/* 0x00000fe4 */ { 1, { 0x00000fe4 } },
+	/* 0x00000fe5 */ { 1, { 0x00000fe5 } },
+	/* 0x00000fe6 */ { 1, { 0x00000fe6 } },
+	/* 0x00000fe7 */ { 1, { 0x00000fe7 } },
+	/* 0x00000fe8 */ { 1, { 0x00000fe8 } },
+	/* 0x00000fe9 */ { 1, { 0x00000fe9 } },
+	/* 0x00000fea */ { 1, { 0x00000fea } },
+	/* 0x00000feb */ { 1, { 0x00000feb } },
+	/* 0x00000fec */ { 1, { 0x00000fec } },
+	/* 0x00000fed */ { 1, { 0x00000fed } },
+	/* 0x00000fee */ { 1, { 0x00000fee } },
+	/* 0x00000fef */ { 1, { 0x00000fef } },
+	/* 0x00000ff0 */ { 1, { 0x00000ff0 } },
+	/* 0x00000ff1 */ { 1, { 0x00000ff1 } },
+	/* 0x00000ff2 */ { 1, { 0x00000ff2 } },
+	/* 0x00000ff3 */ { 1, { 0x00000ff3 } },
+	/* 0x00000ff4 */ { 1, { 0x00000ff4 } },
+	/* 0x00000ff5 */ { 1, { 0x00000ff5 } },
+	/* 0x00000ff6 */ { 1, { 0x00000ff6 } },
+	/* 0x00000ff7 */ { 1, { 0x00000ff7 } },
+	/* 0x00000ff8 */ { 1, { 0x00000ff8 } },
+	/* 0x00000ff9 */ { 1, { 0x00000ff9 } },
+	/* 0x00000ffa */ { 1, { 0x00000ffa } },
+	/* 0x00000ffb */ { 1, { 0x00000ffb } },
+	/* 0x00000ffc */ { 1, { 0x00000ffc } },
+	/* 0x00000ffd */ { 1, { 0x00000ffd } },
+	/* 0x00000ffe */ { 1, { 0x00000ffe } },
+	/* 0x00000fff */ { 1, { 0x00000fff } }
+};
+
+static libfshfs_name_decomposition_mapping_t libfshfs_name_decomposition_mappings_0x00001000[ 256 ] = {
+	/* 0x00001000 */ { 1, { 0x00001000 } },
+	/* 0x00001001 */ { 1, { 0x00001001 } },
+	/* 0x00001002 */ { 1, { 0x00001002 } },
+	/* 0x00001003 */ { 1, { 0x00001003 } },
+	/* 0x00001004 */ { 1, { 0x00001004 } },
+	/* 0x00001005 */ { 1, { 0x00001005 } },
+	/* 0x00001006 */ { 1, { 0x00001006 } },
+	/* 0x00001007 */ { 1, { 0x00001007 } },
+	/* 0x00001008 */ { 1, { 0x00001008 } },
+	/* 0x00001009 */ { 1, { 0x00001009 } },
+	/* 0x0000100a */ { 1, { 0x0000100a } },
+	/* 0x0000100b */ { 1, { 0x0000100b } },
+	/* 0x0000100c */ { 1, { 0x0000100c } },
+	/* 0x0000100d */ { 1, { 0x0000100d } },
+	/* 0x0000100e */ { 1, { 0x0000100e } },
+	/* 0x0000100f */ { 1, { 0x0000100f } },
+	/* 0x00001010 */ { 1, { 0x00001010 } },
+	/* 0x00001011 */ { 1, { 0x00001011 } },
+	/* 0x00001012 */ { 1, { 0x00001012 } },
+	/* 0x00001013 */ { 1, { 0x00001013 } },
+	/* 0x00001014 */ { 1, { 0x00001014 } },
+	/* 0x00001015 */ { 1, { 0x00001015 } },
+	/* 0x00001016 */ { 1, { 0x00001016 } },
+	/* 0x00001017 */ { 1, { 0x00001017 } },
+	/* 0x00001018 */ { 1, { 0x00001018 } },
+	/* 0x00001019 */ { 1, { 0x00001019 } },
+	/* 0x0000101a */ { 1, { 0x0000101a } },
+	/* 0x0000101b */ { 1, { 0x0000101b } },
+	/* 0x0000101c */ { 1, { 0x0000101c } },
+	/* 0x0000101d */ { 1, { 0x0000101d } },
+	/* 0x0000101e */ { 1, { 0x0000101e } },
+	/* 0x0000101f */ { 1, { 0x0000101f } },
+	/* 0x00001020 */ { 1, { 0x00001020 } },
+	/* 0x00001021 */ { 1, { 0x00001021 } },
+	/* 0x00001022 */ { 1, { 0x00001022 } },
+	/* 0x00001023 */ { 1, { 0x00001023 } },
+	/* 0x00001024 */ { 1, { 0x00001024 } },
+	/* 0x00001025 */ { 1, { 0x00001025 } },
+	/* 0x00001026 */ { 2, { 0x00001025, 0x0000102e } },
+	/* 0x00001027 */ { 1, { 0x00001027 } },
+	/* 0x00001028 */ { 1, { 0x00001028 } },
+	/* 0x00001029 */ { 1, { 0x00001029 } },
+	/* 0x0000102a */ { 1, { 0x0000102a } },
+	/* 0x0000102b */ { 1, { 0x0000102b } },
+	/* 0x0000102c */ { 1, { 0x0000102c } },
+	/* 0x0000102d */ { 1, { 0x0000102d } },
+	/* 0x0000102e */ { 1, { 0x0000102e } },
+	/* 0x0000102f */ { 1, { 0x0000102f } },
+	/* 0x00001030 */ { 1, { 0x00001030 } },
+	/* 0x00001031 */ { 1, { 0x00001031 } },
+	/* 0x00001032 */ { 1, { 0x00001032 } },
+	/* 0x00001033 */ { 1, { 0x00001033 } },
+	/* 0x00001034 */ { 1, { 0x00001034 } },
+	/* 0x00001035 */ { 1, { 0x00001035 } },
+	/* 0x00001036 */ { 1, { 0x00001036 } },
+	/* 0x00001037 */ { 1, { 0x00001037 } },
+	/* 0x00001038 */ { 1, { 0x00001038 } },
+	/* 0x00001039 */ { 1, { 0x00001039 } },
+	/* 0x0000103a */ { 1, { 0x0000103a } },
+	/* 0x0000103b */ { 1, { 0x0000103b } },
+	/* 0x0000103c */ { 1, { 0x0000103c } },
+	/* 0x0000103d */ { 1, { 0x0000103d } },
+	/* 0x0000103e */ { 1, { 0x0000103e } },
+	/* 0x0000103f */ { 1, { 0x0000103f } },
+	/* 0x00001040 */ { 1, { 0x00001040 } },
+	/* 0x00001041 */ { 1, { 0x00001041 } },
+	/* 0x00001042 */ { 1, { 0x00001042 } },
+	/* 0x00001043 */ { 1, { 0x00001043 } },
+	/* 0x00001044 */ { 1, { 0x00001044 } },
+	/* 0x00001045 */ { 1, { 0x00001045 } },
+	/* 0x00001046 */ { 1, { 0x00001046 } },
+	/* 0x00001047 */ { 1, { 0x00001047 } },
+	/* 0x00001048 */ { 1, { 0x00001048 } },
+	/* 0x00001049 */ { 1, { 0x00001049 } },
+	/* 0x0000104a */ { 1, { 0x0000104a } },
+	/* 0x0000104b */ { 1, { 0x0000104b } },
+	/* 0x0000104c */ { 1, { 0x0000104c } },
+	/* 0x0000104d */ { 1, { 0x0000104d } },
+	/* 0x0000104e */ { 1, { 0x0000104e } },
+	/* 0x0000104f */ { 1, { 0x0000104f } },
+	/* 0x00001050 */ { 1, { 0x00001050 } },
+	/* 0x00001051 */ { 1, { 0x00001051 } },
+	/* 0x00001052 */ { 1, { 0x00001052 } },
+	/* 0x00001053 */ { 1, { 0x00001053 } },
+	/* 0x00001054 */ { 1, { 0x00001054 } },
+	/* 0x00001055 */ { 1, { 0x00001055 } },
+	/* 0x00001056 */ { 1, { 0x00001056 } },
+	/* 0x00001057 */ { 1, { 0x00001057 } },
+	/* 0x00001058 */ { 1, { 0x00001058 } },
+	/* 0x00001059 */ { 1, { 0x00001059 } },
+	/* 0x0000105a */ { 1, { 0x0000105a } },
+	/* 0x0000105b */ { 1, { 0x0000105b } },
+	/* 0x0000105c */ { 1, { 0x0000105c } },
+	/* 0x0000105d */ { 1, { 0x0000105d } },
+	/* 0x0000105e */ { 1, { 0x0000105e } },
+	/* 0x0000105f */ { 1, { 0x0000105f } },
+	/* 0x00001060 */ { 1, { 0x00001060 } },
+	/* 0x00001061 */ { 1, { 0x00001061 } },
+	/* 0x00001062 */ { 1, { 0x00001062 } },
+	/* 0x00001063 */ { 1, { 0x00001063 } },
+	/* 0x00001064 */ { 1, { 0x00001064 } },
+	/* 0x00001065 */ { 1, { 0x00001065 } },
+	/* 0x00001066 */ { 1, { 0x00001066 } },
+	/* 0x00001067 */ { 1, { 0x00001067 } },
+	/* 0x00001068 */ { 1, { 0x00001068 } },
+	/* 0x00001069 */ { 1, { 0x00001069 } },
+	/* 0x0000106a */ { 1, { 0x0000106a } },
+	/* 0x0000106b */ { 1, { 0x0000106b } },
+	/* 0x0000106c */ { 1, { 0x0000106c } },
+	/* 0x0000106d */ { 1, { 0x0000106d } },
+	/* 0x0000106e */ { 1, { 0x0000106e } },
+	/* 0x0000106f */ { 1, { 0x0000106f } },
+	/* 0x00001070 */ { 1, { 0x00001070 } },
+	/* 0x00001071 */ { 1, { 0x00001071 } },
+	/* 0x00001072 */ { 1, { 0x00001072 } },
+	/* 0x00001073 */ { 1, { 0x00001073 } },
+	/* 0x00001074 */ { 1, { 0x00001074 } },
+	/* 0x00001075 */ { 1, { 0x00001075 } },
+	/* 0x00001076 */ { 1, { 0x00001076 } },
+	/* 0x00001077 */ { 1, { 0x00001077 } },
+	/* 0x00001078 */ { 1, { 0x00001078 } },
+	/* 0x00001079 */ { 1, { 0x00001079 } },
+	/* 0x0000107a */ { 1, { 0x0000107a } },
+	/* 0x0000107b */ { 1, { 0x0000107b } },
+	/* 0x0000107c */ { 1, { 0x0000107c } },
+	/* 0x0000107d */ { 1, { 0x0000107d } },
+	/* 0x0000107e */ { 1, { 0x0000107e } },
+	/* 0x0000107f */ { 1, { 0x0000107f } },
+	/* 0x00001080 */ { 1, { 0x00001080 } },
+	/* 0x00001081 */ { 1, { 0x00001081 } },
+	/* 0x00001082 */ { 1, { 0x00001082 } },
+	/* 0x00001083 */ { 1, { 0x00001083 } },
+	/* 0x00001084 */ { 1, { 0x00001084 } },
+	/* 0x00001085 */ { 1, { 0x00001085 } },
+	/* 0x00001086 */ { 1, { 0x00001086 } },
+	/* 0x00001087 */ { 1, { 0x00001087 } },
+	/* 0x00001088 */ { 1, { 0x00001088 } },
+	/* 0x00001089 */ { 1, { 0x00001089 } },
+	/* 0x0000108a */ { 1, { 0x0000108a } },
+	/* 0x0000108b */ { 1, { 0x0000108b } },
+	/* 0x0000108c */ { 1, { 0x0000108c } },
+	/* 0x0000108d */ { 1, { 0x0000108d } },
+	/* 0x0000108e */ { 1, { 0x0000108e } },
+	/* 0x0000108f */ { 1, { 0x0000108f } },
+	/* 0x00001090 */ { 1, { 0x00001090 } },
+	/* 0x00001091 */ { 1, { 0x00001091 } },
+	/* 0x00001092 */ { 1, { 0x00001092 } },
+	/* 0x00001093 */ { 1, { 0x00001093 } },
+	/* 0x00001094 */ { 1, { 0x00001094 } },
+	/* 0x00001095 */ { 1, { 0x00001095 } },
+	/* 0x00001096 */ { 1, { 0x00001096 } },
+	/* 0x00001097 */ { 1, { 0x00001097 } },
+	/* 0x00001098 */ { 1, { 0x00001098 } },
+	/* 0x00001099 */ { 1, { 0x00001099 } },
+	/* 0x0000109a */ { 1, { 0x0000109a } },
+	/* 0x0000109b */ { 1, { 0x0000109b } },
+	/* 0x0000109c */ { 1, { 0x0000109c } },
+	/* 0x0000109d */ { 1, { 0x0000109d } },
+	/* 0x0000109e */ { 1, { 0x0000109e } },
+	/* 0x0000109f */ { 1, { 0x0000109f } },
+	/* 0x000010a0 */ { 1, { 0x000010a0 } },
+	/* 0x000010a1 */ { 1, { 0x000010a1 } },
+	/* 0x000010a2 */ { 1, { 0x000010a2 } },
+	/* 0x000010a3 */ { 1, { 0x000010a3 } },
+	/* 0x000010a4 */ { 1, { 0x000010a4 } },
+	/* 0x000010a5 */ { 1, { 0x000010a5 } },
+	/* 0x000010a6 */ { 1, { 0x000010a6 } },
+	/* 0x000010a7 */ { 1, { 0x000010a7 } },
+	/* 0x000010a8 */ { 1, { 0x000010a8 } },
+	/* 0x000010a9 */ { 1, { 0x000010a9 } },
+	/* 0x000010aa */ { 1, { 0x000010aa } },
+	/* 0x000010ab */ { 1, { 0x000010ab } },
+	/* 0x000010ac */ { 1, { 0x000010ac } },
+	/* 0x000010ad */ { 1, { 0x000010ad } },
+	/* 0x000010ae */ { 1, { 0x000010ae } },
+	/* 0x000010af */ { 1, { 0x000010af } },
+	/* 0x000010b0 */ { 1, { 0x000010b0 } },
+	/* 0x000010b1 */ { 1, { 0x000010b1 } },
+	/* 0x000010b2 */ { 1, { 0x000010b2 } },
+	/* 0x000010b3 */ { 1, { 0x000010b3 } },
+	/* 0x000010b4 */ { 1, { 0x000010b4 } },
+	/* 0x000010b5 */ { 1, { 0x000010b5 } },
+	/* 0x000010b6 */ { 1, { 0x000010b6 } },
+	/* 0x000010b7 */ { 1, { 0x000010b7 } },
+	/* 0x000010b8 */ { 1, { 0x000010b8 } },
+	/* 0x000010b9 */ { 1, { 0x000010b9 } },
+	/* 0x000010ba */ { 1, { 0x000010ba } },
+	/* 0x000010bb */ { 1, { 0x000010bb } },
+	/* 0x000010bc */ { 1, { 0x000010bc } },
+	/* 0x000010bd */ { 1, { 0x000010bd } },
+	/* 0x000010be */ { 1, { 0x000010be } },
+	/* 0x000010bf */ { 1, { 0x000010bf } },
+	/* 0x000010c0 */ { 1, { 0x000010c0 } },
+	/* 0x000010c1 */ { 1, { 0x000010c1 } },
+	/* 0x000010c2 */ { 1, { 0x000010c2 } },
+	/* 0x000010c3 */ { 1, { 0x000010c3 } },
+	/* 0x000010c4 */ { 1, { 0x000010c4 } },
+	/* 0x000010c5 */ { 1, { 0x000010c5 } },
+	/* 0x000010c6 */ { 1, { 0x000010c6 } },
+	/* 0x000010c7 */ { 1, { 0x000010c7 } },
+	/* 0x000010c8 */ { 1, { 0x000010c8 } },
+	/* 0x000010c9 */ { 1, { 0x000010c9 } },
+	/* 0x000010ca */ { 1, { 0x000010ca } },
+	/* 0x000010cb */ { 1, { 0x000010cb } },
+	/* 0x000010cc */ { 1, { 0x000010cc } },
+	/* 0x000010cd */ { 1, { 0x000010cd } },
+	/* 0x000010ce */ { 1, { 0x000010ce } },
+	/* 0x000010cf */ { 1, { 0x000010cf } },
+	/* 0x000010d0 */ { 1, { 0x000010d0 } },
+	/* 0x000010d1 */ { 1, { 0x000010d1 } },
+	/* 0x000010d2 */ { 1, { 0x000010d2 } },
+	/* 0x000010d3 */ { 1, { 0x000010d3 } },
+	/* 0x000010d4 */ { 1, { 0x000010d4 } },
+	/* 0x000010d5 */ { 1, { 0x000010d5 } },
+	/* 0x000010d6 */ { 1, { 0x000010d6 } },
+	/* 0x000010d7 */ { 1, { 0x000010d7 } },
+	/* 0x000010d8 */ { 1, { 0x000010d8 } },
+	/* 0x000010d9 */ { 1, { 0x000010d9 } },
+	/* 0x000010da */ { 1, { 0x000010da } },
+	/* 0x000010db */ { 1, { 0x000010db } },
+	/* 0x000010dc */ { 1, { 0x000010dc } },
+	/* 0x000010dd */ { 1, { 0x000010dd } },
+	/* 0x000010de */ { 1, { 0x000010de } },
+	/* 0x000010df */ { 1, { 0x000010df } },
+	/* 0x000010e0 */ { 1, { 0x000010e0 } },
+	/* 0x000010e1 */ { 1, { 0x000010e1 } },
+	/* 0x000010e2 */ { 1, { 0x000010e2 } },
+	/* 0x000010e3 */ { 1, { 0x000010e3 } },
+	/* 0x000010e4 */ { 1, { 0x000010e4 } },
+	/* 0x000010e5 */ { 1, { 0x000010e5 } },
+	/* 0x000010e6 */ { 1, { 0x000010e6 } },
+	/* 0x000010e7 */ { 1, { 0x000010e7 } },
+	/* 0x000010e8 */ { 1, { 0x000010e8 } },
+	/* 0x000010e9 */ { 1, { 0x000010e9 } },
+	/* 0x000010ea */ { 1, { 0x000010ea } },
+	/* 0x000010eb */ { 1, { 0x000010eb } },
+	/* 0x000010ec */ { 1, { 0x000010ec } },
+	/* 0x000010ed */ { 1, { 0x000010ed } },
+	/* 0x000010ee */ { 1, { 0x000010ee } },
+	/* 0x000010ef */ { 1, { 0x000010ef } },
+	/* 0x000010f0 */ { 1, { 0x000010f0 } },
+	/* 0x000010f1 */ { 1, { 0x000010f1 } },
+	/* 0x000010f2 */ { 1, { 0x000010f2 } },
+	/* 0x000010f3 */ { 1, { 0x000010f3 } },
+	/* 0x000010f4 */ { 1, { 0x000010f4 } },
+	/* 0x000010f5 */ { 1, { 0x000010f5 } },
+	/* 0x000010f6 */ { 1, { 0x000010f6 } },
+	/* 0x000010f7 */ { 1, { 0x000010f7 } },
+	/* 0x000010f8 */ { 1, { 0x000010f8 } },
+	/* 0x000010f9 */ { 1, { 0x000010f9 } },
+	/* 0x000010fa */ { 1, { 0x000010fa } },
+	/* 0x000010fb */ { 1, { 0x000010fb } },
+	/* 0x000010fc */ { 1, { 0x000010fc } },
+	/* 0x000010fd */ { 1, { 0x000010fd } },
+	/* 0x000010fe */ { 1, { 0x000010fe } },
+	/* 0x000010ff */ { 1, { 0x000010ff } }
+};
+
+static libfshfs_name_decomposition_mapping_t libfshfs_name_decomposition_mappings_0x00001e00[ 256 ] = {
+	/* 0x00001e00 */ { 2, { 0x00000041, 0x00000325 } },
+	/* 0x00001e01 */ { 2, { 0x00000061, 0x00000325 } },
+	/* 0x00001e02 */ { 2, { 0x00000042, 0x00000307 } },
+	/* 0x00001e03 */ { 2, { 0x00000062, 0x00000307 } },
+	/* 0x00001e04 */ { 2, { 0x00000042, 0x00000323 } },
+	/* 0x00001e05 */ { 2, { 0x00000062, 0x00000323 } },
+	/* 0x00001e06 */ { 2, { 0x00000042, 0x00000331 } },
+	/* 0x00001e07 */ { 2, { 0x00000062, 0x00000331 } },
+	/* 0x00001e08 */ { 3, { 0x00000043, 0x00000327, 0x00000301 } },
+	/* 0x00001e09 */ { 3, { 0x00000063, 0x00000327, 0x00000301 } },
+	/* 0x00001e0a */ { 2, { 0x00000044, 0x00000307 } },
+	/* 0x00001e0b */ { 2, { 0x00000064, 0x00000307 } },
+	/* 0x00001e0c */ { 2, { 0x00000044, 0x00000323 } },
+	/* 0x00001e0d */ { 2, { 0x00000064, 0x00000323 } },
+	/* 0x00001e0e */ { 2, { 0x00000044, 0x00000331 } },
+	/* 0x00001e0f */ { 2, { 0x00000064, 0x00000331 } },
+	/* 0x00001e10 */ { 2, { 0x00000044, 0x00000327 } },
+	/* 0x00001e11 */ { 2, { 0x00000064, 0x00000327 } },
+	/* 0x00001e12 */ { 2, { 0x00000044, 0x0000032d } },
+	/* 0x00001e13 */ { 2, { 0x00000064, 0x0000032d } },
+	/* 0x00001e14 */ { 3, { 0x00000045, 0x00000304, 0x00000300 } },
+	/* 0x00001e15 */ { 3, { 0x00000065, 0x00000304, 0x00000300 } },
+	/* 0x00001e16 */ { 3, { 0x00000045, 0x00000304, 0x00000301 } },
+	/* 0x00001e17 */ { 3, { 0x00000065, 0x00000304, 0x00000301 } },
+	/* 0x00001e18 */ { 2, { 0x00000045, 0x0000032d } },
+	/* 0x00001e19 */ { 2, { 0x00000065, 0x0000032d } },
+	/* 0x00001e1a */ { 2, { 0x00000045, 0x00000330 } },
+	/* 0x00001e1b */ { 2, { 0x00000065, 0x00000330 } },
+	/* 0x00001e1c */ { 3, { 0x00000045, 0x00000327, 0x00000306 } },
+	/* 0x00001e1d */ { 3, { 0x00000065, 0x00000327, 0x00000306 } },
+	/* 0x00001e1e */ { 2, { 0x00000046, 0x00000307 } },
+	/* 0x00001e1f */ { 2, { 0x00000066, 0x00000307 } },
+	/* 0x00001e20 */ { 2, { 0x00000047, 0x00000304 } },
+	/* 0x00001e21 */ { 2, { 0x00000067, 0x00000304 } },
+	/* 0x00001e22 */ { 2, { 0x00000048, 0x00000307 } },
+	/* 0x00001e23 */ { 2, { 0x00000068, 0x00000307 } },
+	/* 0x00001e24 */ { 2, { 0x00000048, 0x00000323 } },
+	/* 0x00001e25 */ { 2, { 0x00000068, 0x00000323 } },
+	/* 0x00001e26 */ { 2, { 0x00000048, 0x00000308 } },
+	/* 0x00001e27 */ { 2, { 0x00000068, 0x00000308 } },
+	/* 0x00001e28 */ { 2, { 0x00000048, 0x00000327 } },
+	/* 0x00001e29 */ { 2, { 0x00000068, 0x00000327 } },
+	/* 0x00001e2a */ { 2, { 0x00000048, 0x0000032e } },
+	/* 0x00001e2b */ { 2, { 0x00000068, 0x0000032e } },
+	/* 0x00001e2c */ { 2, { 0x00000049, 0x00000330 } },
+	/* 0x00001e2d */ { 2, { 0x00000069, 0x00000330 } },
+	/* 0x00001e2e */ { 3, { 0x00000049, 0x00000308, 0x00000301 } },
+	/* 0x00001e2f */ { 3, { 0x00000069, 0x00000308, 0x00000301 } },
+	/* 0x00001e30 */ { 2, { 0x0000004b, 0x00000301 } },
+	/* 0x00001e31 */ { 2, { 0x0000006b, 0x00000301 } },
+	/* 0x00001e32 */ { 2, { 0x0000004b, 0x00000323 } },
+	/* 0x00001e33 */ { 2, { 0x0000006b, 0x00000323 } },
+	/* 0x00001e34 */ { 2, { 0x0000004b, 0x00000331 } },
+	/* 0x00001e35 */ { 2, { 0x0000006b, 0x00000331 } },
+	/* 0x00001e36 */ { 2, { 0x0000004c, 0x00000323 } },
+	/* 0x00001e37 */ { 2, { 0x0000006c, 0x00000323 } },
+	/* 0x00001e38 */ { 3, { 0x0000004c, 0x00000323, 0x00000304 } },
+	/* 0x00001e39 */ { 3, { 0x0000006c, 0x00000323, 0x00000304 } },
+	/* 0x00001e3a */ { 2, { 0x0000004c, 0x00000331 } },
+	/* 0x00001e3b */ { 2, { 0x0000006c, 0x00000331 } },
+	/* 0x00001e3c */ { 2, { 0x0000004c, 0x0000032d } },
+	/* 0x00001e3d */ { 2, { 0x0000006c, 0x0000032d } },
+	/* 0x00001e3e */ { 2, { 0x0000004d, 0x00000301 } },
+	/* 0x00001e3f */ { 2, { 0x0000006d, 0x00000301 } },
+	/* 0x00001e40 */ { 2, { 0x0000004d, 0x00000307 } },
+	/* 0x00001e41 */ { 2, { 0x0000006d, 0x00000307 } },
+	/* 0x00001e42 */ { 2, { 0x0000004d, 0x00000323 } },
+	/* 0x00001e43 */ { 2, { 0x0000006d, 0x00000323 } },
+	/* 0x00001e44 */ { 2, { 0x0000004e, 0x00000307 } },
+	/* 0x00001e45 */ { 2, { 0x0000006e, 0x00000307 } },
+	/* 0x00001e46 */ { 2, { 0x0000004e, 0x00000323 } },
+	/* 0x00001e47 */ { 2, { 0x0000006e, 0x00000323 } },
+	/* 0x00001e48 */ { 2, { 0x0000004e, 0x00000331 } },
+	/* 0x00001e49 */ { 2, { 0x0000006e, 0x00000331 } },
+	/* 0x00001e4a */ { 2, { 0x0000004e, 0x0000032d } },
+	/* 0x00001e4b */ { 2, { 0x0000006e, 0x0000032d } },
+	/* 0x00001e4c */ { 3, { 0x0000004f, 0x00000303, 0x00000301 } },
+	/* 0x00001e4d */ { 3, { 0x0000006f, 0x00000303, 0x00000301 } },
+	/* 0x00001e4e */ { 3, { 0x0000004f, 0x00000303, 0x00000308 } },
+	/* 0x00001e4f */ { 3, { 0x0000006f, 0x00000303, 0x00000308 } },
+	/* 0x00001e50 */ { 3, { 0x0000004f, 0x00000304, 0x00000300 } },
+	/* 0x00001e51 */ { 3, { 0x0000006f, 0x00000304, 0x00000300 } },
+	/* 0x00001e52 */ { 3, { 0x0000004f, 0x00000304, 0x00000301 } },
+	/* 0x00001e53 */ { 3, { 0x0000006f, 0x00000304, 0x00000301 } },
+	/* 0x00001e54 */ { 2, { 0x00000050, 0x00000301 } },
+	/* 0x00001e55 */ { 2, { 0x00000070, 0x00000301 } },
+	/* 0x00001e56 */ { 2, { 0x00000050, 0x00000307 } },
+	/* 0x00001e57 */ { 2, { 0x00000070, 0x00000307 } },
+	/* 0x00001e58 */ { 2, { 0x00000052, 0x00000307 } },
+	/* 0x00001e59 */ { 2, { 0x00000072, 0x00000307 } },
+	/* 0x00001e5a */ { 2, { 0x00000052, 0x00000323 } },
+	/* 0x00001e5b */ { 2, { 0x00000072, 0x00000323 } },
+	/* 0x00001e5c */ { 3, { 0x00000052, 0x00000323, 0x00000304 } },
+	/* 0x00001e5d */ { 3, { 0x00000072, 0x00000323, 0x00000304 } },
+	/* 0x00001e5e */ { 2, { 0x00000052, 0x00000331 } },
+	/* 0x00001e5f */ { 2, { 0x00000072, 0x00000331 } },
+	/* 0x00001e60 */ { 2, { 0x00000053, 0x00000307 } },
+	/* 0x00001e61 */ { 2, { 0x00000073, 0x00000307 } },
+	/* 0x00001e62 */ { 2, { 0x00000053, 0x00000323 } },
+	/* 0x00001e63 */ { 2, { 0x00000073, 0x00000323 } },
+	/* 0x00001e64 */ { 3, { 0x00000053, 0x00000301, 0x00000307 } },
+	/* 0x00001e65 */ { 3, { 0x00000073, 0x00000301, 0x00000307 } },
+	/* 0x00001e66 */ { 3, { 0x00000053, 0x0000030c, 0x00000307 } },
+	/* 0x00001e67 */ { 3, { 0x00000073, 0x0000030c, 0x00000307 } },
+	/* 0x00001e68 */ { 3, { 0x00000053, 0x00000323, 0x00000307 } },
+	/* 0x00001e69 */ { 3, { 0x00000073, 0x00000323, 0x00000307 } },
+	/* 0x00001e6a */ { 2, { 0x00000054, 0x00000307 } },
+	/* 0x00001e6b */ { 2, { 0x00000074, 0x00000307 } },
+	/* 0x00001e6c */ { 2, { 0x00000054, 0x00000323 } },
+	/* 0x00001e6d */ { 2, { 0x00000074, 0x00000323 } },
+	/* 0x00001e6e */ { 2, { 0x00000054, 0x00000331 } },
+	/* 0x00001e6f */ { 2, { 0x00000074, 0x00000331 } },
+	/* 0x00001e70 */ { 2, { 0x00000054, 0x0000032d } },
+	/* 0x00001e71 */ { 2, { 0x00000074, 0x0000032d } },
+	/* 0x00001e72 */ { 2, { 0x00000055, 0x00000324 } },
+	/* 0x00001e73 */ { 2, { 0x00000075, 0x00000324 } },
+	/* 0x00001e74 */ { 2, { 0x00000055, 0x00000330 } },
+	/* 0x00001e75 */ { 2, { 0x00000075, 0x00000330 } },
+	/* 0x00001e76 */ { 2, { 0x00000055, 0x0000032d } },
+	/* 0x00001e77 */ { 2, { 0x00000075, 0x0000032d } },
+	/* 0x00001e78 */ { 3, { 0x00000055, 0x00000303, 0x00000301 } },
+	/* 0x00001e79 */ { 3, { 0x00000075, 0x00000303, 0x00000301 } },
+	/* 0x00001e7a */ { 3, { 0x00000055, 0x00000304, 0x00000308 } },
+	/* 0x00001e7b */ { 3, { 0x00000075, 0x00000304, 0x00000308 } },
+	/* 0x00001e7c */ { 2, { 0x00000056, 0x00000303 } },
+	/* 0x00001e7d */ { 2, { 0x00000076, 0x00000303 } },
+	/* 0x00001e7e */ { 2, { 0x00000056, 0x00000323 } },
+	/* 0x00001e7f */ { 2, { 0x00000076, 0x00000323 } },
+	/* 0x00001e80 */ { 2, { 0x00000057, 0x00000300 } },
+	/* 0x00001e81 */ { 2, { 0x00000077, 0x00000300 } },
+	/* 0x00001e82 */ { 2, { 0x00000057, 0x00000301 } },
+	/* 0x00001e83 */ { 2, { 0x00000077, 0x00000301 } },
+	/* 0x00001e84 */ { 2, { 0x00000057, 0x00000308 } },
+	/* 0x00001e85 */ { 2, { 0x00000077, 0x00000308 } },
+	/* 0x00001e86 */ { 2, { 0x00000057, 0x00000307 } },
+	/* 0x00001e87 */ { 2, { 0x00000077, 0x00000307 } },
+	/* 0x00001e88 */ { 2, { 0x00000057, 0x00000323 } },
+	/* 0x00001e89 */ { 2, { 0x00000077, 0x00000323 } },
+	/* 0x00001e8a */ { 2, { 0x00000058, 0x00000307 } },
+	/* 0x00001e8b */ { 2, { 0x00000078, 0x00000307 } },
+	/* 0x00001e8c */ { 2, { 0x00000058, 0x00000308 } },
+	/* 0x00001e8d */ { 2, { 0x00000078, 0x00000308 } },
+	/* 0x00001e8e */ { 2, { 0x00000059, 0x00000307 } },
+	/* 0x00001e8f */ { 2, { 0x00000079, 0x00000307 } },
+	/* 0x00001e90 */ { 2, { 0x0000005a, 0x00000302 } },
+	/* 0x00001e91 */ { 2, { 0x0000007a, 0x00000302 } },
+	/* 0x00001e92 */ { 2, { 0x0000005a, 0x00000323 } },
+	/* 0x00001e93 */ { 2, { 0x0000007a, 0x00000323 } },
+	/* 0x00001e94 */ { 2, { 0x0000005a, 0x00000331 } },
+	/* 0x00001e95 */ { 2, { 0x0000007a, 0x00000331 } },
+	/* 0x00001e96 */ { 2, { 0x00000068, 0x00000331 } },
+	/* 0x00001e97 */ { 2, { 0x00000074, 0x00000308 } },
+	/* 0x00001e98 */ { 2, { 0x00000077, 0x0000030a } },
+	/* 0x00001e99 */ { 2, { 0x00000079, 0x0000030a } },
+	/* 0x00001e9a */ { 1, { 0x00001e9a } },
+	/* 0x00001e9b */ { 2, { 0x0000017f, 0x00000307 } },
+	/* 0x00001e9c */ { 1, { 0x00001e9c } },
+	/* 0x00001e9d */ { 1, { 0x00001e9d } },
+	/* 0x00001e9e */ { 1, { 0x00001e9e } },
+	/* 0x00001e9f */ { 1, { 0x00001e9f } },
+	/* 0x00001ea0 */ { 2, { 0x00000041, 0x00000323 } },
+	/* 0x00001ea1 */ { 2, { 0x00000061, 0x00000323 } },
+	/* 0x00001ea2 */ { 2, { 0x00000041, 0x00000309 } },
+	/* 0x00001ea3 */ { 2, { 0x00000061, 0x00000309 } },
+	/* 0x00001ea4 */ { 3, { 0x00000041, 0x00000302, 0x00000301 } },
+	/* 0x00001ea5 */ { 3, { 0x00000061, 0x00000302, 0x00000301 } },
+	/* 0x00001ea6 */ { 3, { 0x00000041, 0x00000302, 0x00000300 } },
+	/* 0x00001ea7 */ { 3, { 0x00000061, 0x00000302, 0x00000300 } },
+	/* 0x00001ea8 */ { 3, { 0x00000041, 0x00000302, 0x00000309 } },
+	/* 0x00001ea9 */ { 3, { 0x00000061, 0x00000302, 0x00000309 } },
+	/* 0x00001eaa */ { 3, { 0x00000041, 0x00000302, 0x00000303 } },
+	/* 0x00001eab */ { 3, { 0x00000061, 0x00000302, 0x00000303 } },
+	/* 0x00001eac */ { 3, { 0x00000041, 0x00000323, 0x00000302 } },
+	/* 0x00001ead */ { 3, { 0x00000061, 0x00000323, 0x00000302 } },
+	/* 0x00001eae */ { 3, { 0x00000041, 0x00000306, 0x00000301 } },
+	/* 0x00001eaf */ { 3, { 0x00000061, 0x00000306, 0x00000301 } },
+	/* 0x00001eb0 */ { 3, { 0x00000041, 0x00000306, 0x00000300 } },
+	/* 0x00001eb1 */ { 3, { 0x00000061, 0x00000306, 0x00000300 } },
+	/* 0x00001eb2 */ { 3, { 0x00000041, 0x00000306, 0x00000309 } },
+	/* 0x00001eb3 */ { 3, { 0x00000061, 0x00000306, 0x00000309 } },
+	/* 0x00001eb4 */ { 3, { 0x00000041, 0x00000306, 0x00000303 } },
+	/* 0x00001eb5 */ { 3, { 0x00000061, 0x00000306, 0x00000303 } },
+	/* 0x00001eb6 */ { 3, { 0x00000041, 0x00000323, 0x00000306 } },
+	/* 0x00001eb7 */ { 3, { 0x00000061, 0x00000323, 0x00000306 } },
+	/* 0x00001eb8 */ { 2, { 0x00000045, 0x00000323 } },
+	/* 0x00001eb9 */ { 2, { 0x00000065, 0x00000323 } },
+	/* 0x00001eba */ { 2, { 0x00000045, 0x00000309 } },
+	/* 0x00001ebb */ { 2, { 0x00000065, 0x00000309 } },
+	/* 0x00001ebc */ { 2, { 0x00000045, 0x00000303 } },
+	/* 0x00001ebd */ { 2, { 0x00000065, 0x00000303 } },
+	/* 0x00001ebe */ { 3, { 0x00000045, 0x00000302, 0x00000301 } },
+	/* 0x00001ebf */ { 3, { 0x00000065, 0x00000302, 0x00000301 } },
+	/* 0x00001ec0 */ { 3, { 0x00000045, 0x00000302, 0x00000300 } },
+	/* 0x00001ec1 */ { 3, { 0x00000065, 0x00000302, 0x00000300 } },
+	/* 0x00001ec2 */ { 3, { 0x00000045, 0x00000302, 0x00000309 } },
+	/* 0x00001ec3 */ { 3, { 0x00000065, 0x00000302, 0x00000309 } },
+	/* 0x00001ec4 */ { 3, { 0x00000045, 0x00000302, 0x00000303 } },
+	/* 0x00001ec5 */ { 3, { 0x00000065, 0x00000302, 0x00000303 } },
+	/* 0x00001ec6 */ { 3, { 0x00000045, 0x00000323, 0x00000302 } },
+	/* 0x00001ec7 */ { 3, { 0x00000065, 0x00000323, 0x00000302 } },
+	/* 0x00001ec8 */ { 2, { 0x00000049, 0x00000309 } },
+	/* 0x00001ec9 */ { 2, { 0x00000069, 0x00000309 } },
+	/* 0x00001eca */ { 2, { 0x00000049, 0x00000323 } },
+	/* 0x00001ecb */ { 2, { 0x00000069, 0x00000323 } },
+	/* 0x00001ecc */ { 2, { 0x0000004f, 0x00000323 } },
+	/* 0x00001ecd */ { 2, { 0x0000006f, 0x00000323 } },
+	/* 0x00001ece */ { 2, { 0x0000004f, 0x00000309 } },
+	/* 0x00001ecf */ { 2, { 0x0000006f, 0x00000309 } },
+	/* 0x00001ed0 */ { 3, { 0x0000004f, 0x00000302, 0x00000301 } },
+	/* 0x00001ed1 */ { 3, { 0x0000006f, 0x00000302, 0x00000301 } },
+	/* 0x00001ed2 */ { 3, { 0x0000004f, 0x00000302, 0x00000300 } },
+	/* 0x00001ed3 */ { 3, { 0x0000006f, 0x00000302, 0x00000300 } },
+	/* 0x00001ed4 */ { 3, { 0x0000004f, 0x00000302, 0x00000309 } },
+	/* 0x00001ed5 */ { 3, { 0x0000006f, 0x00000302, 0x00000309 } },
+	/* 0x00001ed6 */ { 3, { 0x0000004f, 0x00000302, 0x00000303 } },
+	/* 0x00001ed7 */ { 3, { 0x0000006f, 0x00000302, 0x00000303 } },
+	/* 0x00001ed8 */ { 3, { 0x0000004f, 0x00000323, 0x00000302 } },
+	/* 0x00001ed9 */ { 3, { 0x0000006f, 0x00000323, 0x00000302 } },
+	/* 0x00001eda */ { 3, { 0x0000004f, 0x0000031b, 0x00000301 } },
+	/* 0x00001edb */ { 3, { 0x0000006f, 0x0000031b, 0x00000301 } },
+	/* 0x00001edc */ { 3, { 0x0000004f, 0x0000031b, 0x00000300 } },
+	/* 0x00001edd */ { 3, { 0x0000006f, 0x0000031b, 0x00000300 } },
+	/* 0x00001ede */ { 3, { 0x0000004f, 0x0000031b, 0x00000309 } },
+	/* 0x00001edf */ { 3, { 0x0000006f, 0x0000031b, 0x00000309 } },
+	/* 0x00001ee0 */ { 3, { 0x0000004f, 0x0000031b, 0x00000303 } },
+	/* 0x00001ee1 */ { 3, { 0x0000006f, 0x0000031b, 0x00000303 } },
+	/* 0x00001ee2 */ { 3, { 0x0000004f, 0x0000031b, 0x00000323 } },
+	/* 0x00001ee3 */ { 3, { 0x0000006f, 0x0000031b, 0x00000323 } },
+	/* 0x00001ee4 */ { 2, { 0x00000055, 0x00000323 } },
+	/* 0x00001ee5 */ { 2, { 0x00000075, 0x00000323 } },
+	/* 0x00001ee6 */ { 2, { 0x00000055, 0x00000309 } },
+	/* 0x00001ee7 */ { 2, { 0x00000075, 0x00000309 } },
+	/* 0x00001ee8 */ { 3, { 0x00000055, 0x0000031b, 0x00000301 } },
+	/* 0x00001ee9 */ { 3, { 0x00000075, 0x0000031b, 0x00000301 } },
+	/* 0x00001eea */ { 3, { 0x00000055, 0x0000031b, 0x00000300 } },
+	/* 0x00001eeb */ { 3, { 0x00000075, 0x0000031b, 0x00000300 } },
+	/* 0x00001eec */ { 3, { 0x00000055, 0x0000031b, 0x00000309 } },
+	/* 0x00001eed */ { 3, { 0x00000075, 0x0000031b, 0x00000309 } },
+	/* 0x00001eee */ { 3, { 0x00000055, 0x0000031b, 0x00000303 } },
+	/* 0x00001eef */ { 3, { 0x00000075, 0x0000031b, 0x00000303 } },
+	/* 0x00001ef0 */ { 3, { 0x00000055, 0x0000031b, 0x00000323 } },
+	/* 0x00001ef1 */ { 3, { 0x00000075, 0x0000031b, 0x00000323 } },
+	/* 0x00001ef2 */ { 2, { 0x00000059, 0x00000300 } },
+	/* 0x00001ef3 */ { 2, { 0x00000079, 0x00000300 } },
+	/* 0x00001ef4 */ { 2, { 0x00000059, 0x00000323 } },
+	/* 0x00001ef5 */ { 2, { 0x00000079, 0x00000323 } },
+	/* 0x00001ef6 */ { 2, { 0x00000059, 0x00000309 } },
+	/* 0x00001ef7 */ { 2, { 0x00000079, 0x00000309 } },
+	/* 0x00001ef8 */ { 2, { 0x00000059, 0x00000303 } },
+	/* 0x00001ef9 */ { 2, { 0x00000079, 0x00000303 } },
+	/* 0x00001efa */ { 1, { 0x00001efa } },
+	/* 0x00001efb */ { 1, { 0x00001efb } },
+	/* 0x00001efc */ { 1, { 0x00001efc } },
+	/* 0x00001efd */ { 1, { 0x00001efd } },
+	/* 0x00001efe */ { 1, { 0x00001efe } },
+	/* 0x00001eff */ { 1, { 0x00001eff } }
+};
+
+static libfshfs_name_decomposition_mapping_t libfshfs_name_decomposition_mappings_0x00001f00[ 256 ] = {
+	/* 0x00001f00 */ { 2, { 0x000003b1, 0x00000313 } },
+	/* 0x00001f01 */ { 2, { 0x000003b1, 0x00000314 } },
+	/* 0x00001f02 */ { 3, { 0x000003b1, 0x00000313, 0x00000300 } },
+	/* 0x00001f03 */ { 3, { 0x000003b1, 0x00000314, 0x00000300 } },
+	/* 0x00001f04 */ { 3, { 0x000003b1, 0x00000313, 0x00000301 } },
+	/* 0x00001f05 */ { 3, { 0x000003b1, 0x00000314, 0x00000301 } },
+	/* 0x00001f06 */ { 3, { 0x000003b1, 0x00000313, 0x00000342 } },
+	/* 0x00001f07 */ { 3, { 0x000003b1, 0x00000314, 0x00000342 } },
+	/* 0x00001f08 */ { 2, { 0x00000391, 0x00000313 } },
+	/* 0x00001f09 */ { 2, { 0x00000391, 0x00000314 } },
+	/* 0x00001f0a */ { 3, { 0x00000391, 0x00000313, 0x00000300 } },
+	/* 0x00001f0b */ { 3, { 0x00000391, 0x00000314, 0x00000300 } },
+	/* 0x00001f0c */ { 3, { 0x00000391, 0x00000313, 0x00000301 } },
+	/* 0x00001f0d */ { 3, { 0x00000391, 0x00000314, 0x00000301 } },
+	/* 0x00001f0e */ { 3, { 0x00000391, 0x00000313, 0x00000342 } },
+	/* 0x00001f0f */ { 3, { 0x00000391, 0x00000314, 0x00000342 } },
+	/* 0x00001f10 */ { 2, { 0x000003b5, 0x00000313 } },
+	/* 0x00001f11 */ { 2, { 0x000003b5, 0x00000314 } },
+	/* 0x00001f12 */ { 3, { 0x000003b5, 0x00000313, 0x00000300 } },
+	/* 0x00001f13 */ { 3, { 0x000003b5, 0x00000314, 0x00000300 } },
+	/* 0x00001f14 */ { 3, { 0x000003b5, 0x00000313, 0x00000301 } },
+	/* 0x00001f15 */ { 3, { 0x000003b5, 0x00000314, 0x00000301 } },
+	/* 0x00001f16 */ { 1, { 0x00001f16 } },
+	/* 0x00001f17 */ { 1, { 0x00001f17 } },
+	/* 0x00001f18 */ { 2, { 0x00000395, 0x00000313 } },
+	/* 0x00001f19 */ { 2, { 0x00000395, 0x00000314 } },
+	/* 0x00001f1a */ { 3, { 0x00000395, 0x00000313, 0x00000300 } },
+	/* 0x00001f1b */ { 3, { 0x00000395, 0x00000314, 0x00000300 } },
+	/* 0x00001f1c */ { 3, { 0x00000395, 0x00000313, 0x00000301 } },
+	/* 0x00001f1d */ { 3, { 0x00000395, 0x00000314, 0x00000301 } },
+	/* 0x00001f1e */ { 1, { 0x00001f1e } },
+	/* 0x00001f1f */ { 1, { 0x00001f1f } },
+	/* 0x00001f20 */ { 2, { 0x000003b7, 0x00000313 } },
+	/* 0x00001f21 */ { 2, { 0x000003b7, 0x00000314 } },
+	/* 0x00001f22 */ { 3, { 0x000003b7, 0x00000313, 0x00000300 } },
+	/* 0x00001f23 */ { 3, { 0x000003b7, 0x00000314, 0x00000300 } },
+	/* 0x00001f24 */ { 3, { 0x000003b7, 0x00000313, 0x00000301 } },
+	/* 0x00001f25 */ { 3, { 0x000003b7, 0x00000314, 0x00000301 } },
+	/* 0x00001f26 */ { 3, { 0x000003b7, 0x00000313, 0x00000342 } },
+	/* 0x00001f27 */ { 3, { 0x000003b7, 0x00000314, 0x00000342 } },
+	/* 0x00001f28 */ { 2, { 0x00000397, 0x00000313 } },
+	/* 0x00001f29 */ { 2, { 0x00000397, 0x00000314 } },
+	/* 0x00001f2a */ { 3, { 0x00000397, 0x00000313, 0x00000300 } },
+	/* 0x00001f2b */ { 3, { 0x00000397, 0x00000314, 0x00000300 } },
+	/* 0x00001f2c */ { 3, { 0x00000397, 0x00000313, 0x00000301 } },
+	/* 0x00001f2d */ { 3, { 0x00000397, 0x00000314, 0x00000301 } },
+	/* 0x00001f2e */ { 3, { 0x00000397, 0x00000313, 0x00000342 } },
+	/* 0x00001f2f */ { 3, { 0x00000397, 0x00000314, 0x00000342 } },
+	/* 0x00001f30 */ { 2, { 0x000003b9, 0x00000313 } },
+	/* 0x00001f31 */ { 2, { 0x000003b9, 0x00000314 } },
+	/* 0x00001f32 */ { 3, { 0x000003b9, 0x00000313, 0x00000300 } },
+	/* 0x00001f33 */ { 3, { 0x000003b9, 0x00000314, 0x00000300 } },
+	/* 0x00001f34 */ { 3, { 0x000003b9, 0x00000313, 0x00000301 } },
+	/* 0x00001f35 */ { 3, { 0x000003b9, 0x00000314, 0x00000301 } },
+	/* 0x00001f36 */ { 3, { 0x000003b9, 0x00000313, 0x00000342 } },
+	/* 0x00001f37 */ { 3, { 0x000003b9, 0x00000314, 0x00000342 } },
+	/* 0x00001f38 */ { 2, { 0x00000399, 0x00000313 } },
+	/* 0x00001f39 */ { 2, { 0x00000399, 0x00000314 } },
+	/* 0x00001f3a */ { 3, { 0x00000399, 0x00000313, 0x00000300 } },
+	/* 0x00001f3b */ { 3, { 0x00000399, 0x00000314, 0x00000300 } },
+	/* 0x00001f3c */ { 3, { 0x00000399, 0x00000313, 0x00000301 } },
+	/* 0x00001f3d */ { 3, { 0x00000399, 0x00000314, 0x00000301 } },
+	/* 0x00001f3e */ { 3, { 0x00000399, 0x00000313, 0x00000342 } },
+	/* 0x00001f3f */ { 3, { 0x00000399, 0x00000314, 0x00000342 } },
+	/* 0x00001f40 */ { 2, { 0x000003bf, 0x00000313 } },
+	/* 0x00001f41 */ { 2, { 0x000003bf, 0x00000314 } },
+	/* 0x00001f42 */ { 3, { 0x000003bf, 0x00000313, 0x00000300 } },
+	/* 0x00001f43 */ { 3, { 0x000003bf, 0x00000314, 0x00000300 } },
+	/* 0x00001f44 */ { 3, { 0x000003bf, 0x00000313, 0x00000301 } },
+	/* 0x00001f45 */ { 3, { 0x000003bf, 0x00000314, 0x00000301 } },
+	/* 0x00001f46 */ { 1, { 0x00001f46 } },
+	/* 0x00001f47 */ { 1, { 0x00001f47 } },
+	/* 0x00001f48 */ { 2, { 0x0000039f, 0x00000313 } },
+	/* 0x00001f49 */ { 2, { 0x0000039f, 0x00000314 } },
+	/* 0x00001f4a */ { 3, { 0x0000039f, 0x00000313, 0x00000300 } },
+	/* 0x00001f4b */ { 3, { 0x0000039f, 0x00000314, 0x00000300 } },
+	/* 0x00001f4c */ { 3, { 0x0000039f, 0x00000313, 0x00000301 } },
+	/* 0x00001f4d */ { 3, { 0x0000039f, 0x00000314, 0x00000301 } },
+	/* 0x00001f4e */ { 1, { 0x00001f4e } },
+	/* 0x00001f4f */ { 1, { 0x00001f4f } },
+	/* 0x00001f50 */ { 2, { 0x000003c5, 0x00000313 } },
+	/* 0x00001f51 */ { 2, { 0x000003c5, 0x00000314 } },
+	/* 0x00001f52 */ { 3, { 0x000003c5, 0x00000313, 0x00000300 } },
+	/* 0x00001f53 */ { 3, { 0x000003c5, 0x00000314, 0x00000300 } },
+	/* 0x00001f54 */ { 3, { 0x000003c5, 0x00000313, 0x00000301 } },
+	/* 0x00001f55 */ { 3, { 0x000003c5, 0x00000314, 0x00000301 } },
+	/* 0x00001f56 */ { 3, { 0x000003c5, 0x00000313, 0x00000342 } },
+	/* 0x00001f57 */ { 3, { 0x000003c5, 0x00000314, 0x00000342 } },
+	/* 0x00001f58 */ { 1, { 0x00001f58 } },
+	/* 0x00001f59 */ { 2, { 0x000003a5, 0x00000314 } },
+	/* 0x00001f5a */ { 1, { 0x00001f5a } },
+	/* 0x00001f5b */ { 3, { 0x000003a5, 0x00000314, 0x00000300 } },
+	/* 0x00001f5c */ { 1, { 0x00001f5c } },
+	/* 0x00001f5d */ { 3, { 0x000003a5, 0x00000314, 0x00000301 } },
+	/* 0x00001f5e */ { 1, { 0x00001f5e } },
+	/* 0x00001f5f */ { 3, { 0x000003a5, 0x00000314, 0x00000342 } },
+	/* 0x00001f60 */ { 2, { 0x000003c9, 0x00000313 } },
+	/* 0x00001f61 */ { 2, { 0x000003c9, 0x00000314 } },
+	/* 0x00001f62 */ { 3, { 0x000003c9, 0x00000313, 0x00000300 } },
+	/* 0x00001f63 */ { 3, { 0x000003c9, 0x00000314, 0x00000300 } },
+	/* 0x00001f64 */ { 3, { 0x000003c9, 0x00000313, 0x00000301 } },
+	/* 0x00001f65 */ { 3, { 0x000003c9, 0x00000314, 0x00000301 } },
+	/* 0x00001f66 */ { 3, { 0x000003c9, 0x00000313, 0x00000342 } },
+	/* 0x00001f67 */ { 3, { 0x000003c9, 0x00000314, 0x00000342 } },
+	/* 0x00001f68 */ { 2, { 0x000003a9, 0x00000313 } },
+	/* 0x00001f69 */ { 2, { 0x000003a9, 0x00000314 } },
+	/* 0x00001f6a */ { 3, { 0x000003a9, 0x00000313, 0x00000300 } },
+	/* 0x00001f6b */ { 3, { 0x000003a9, 0x00000314, 0x00000300 } },
+	/* 0x00001f6c */ { 3, { 0x000003a9, 0x00000313, 0x00000301 } },
+	/* 0x00001f6d */ { 3, { 0x000003a9, 0x00000314, 0x00000301 } },
+	/* 0x00001f6e */ { 3, { 0x000003a9, 0x00000313, 0x00000342 } },
+	/* 0x00001f6f */ { 3, { 0x000003a9, 0x00000314, 0x00000342 } },
+	/* 0x00001f70 */ { 2, { 0x000003b1, 0x00000300 } },
+	/* 0x00001f71 */ { 2, { 0x000003b1, 0x00000301 } },
+	/* 0x00001f72 */ { 2, { 0x000003b5, 0x00000300 } },
+	/* 0x00001f73 */ { 2, { 0x000003b5, 0x00000301 } },
+	/* 0x00001f74 */ { 2, { 0x000003b7, 0x00000300 } },
+	/* 0x00001f75 */ { 2, { 0x000003b7, 0x00000301 } },
+	/* 0x00001f76 */ { 2, { 0x000003b9, 0x00000300 } },
+	/* 0x00001f77 */ { 2, { 0x000003b9, 0x00000301 } },
+	/* 0x00001f78 */ { 2, { 0x000003bf, 0x00000300 } },
+	/* 0x00001f79 */ { 2, { 0x000003bf, 0x00000301 } },
+	/* 0x00001f7a */ { 2, { 0x000003c5, 0x00000300 } },
+	/* 0x00001f7b */ { 2, { 0x000003c5, 0x00000301 } },
+	/* 0x00001f7c */ { 2, { 0x000003c9, 0x00000300 } },
+	/* 0x00001f7d */ { 2, { 0x000003c9, 0x00000301 } },
+	/* 0x00001f7e */ { 1, { 0x00001f7e } },
+	/* 0x00001f7f */ { 1, { 0x00001f7f } },
+	/* 0x00001f80 */ { 3, { 0x000003b1, 0x00000313, 0x00000345 } },
+	/* 0x00001f81 */ { 3, { 0x000003b1, 0x00000314, 0x00000345 } },
+	/* 0x00001f82 */ { 4, { 0x000003b1, 0x00000313, 0x00000300, 0x00000345 } },
+	/* 0x00001f83 */ { 4, { 0x000003b1, 0x00000314, 0x00000300, 0x00000345 } },
+	/* 0x00001f84 */ { 4, { 0x000003b1, 0x00000313, 0x00000301, 0x00000345 } },
+	/* 0x00001f85 */ { 4, { 0x000003b1, 0x00000314, 0x00000301, 0x00000345 } },
+	/* 0x00001f86 */ { 4, { 0x000003b1, 0x00000313, 0x00000342, 0x00000345 } },
+	/* 0x00001f87 */ { 4, { 0x000003b1, 0x00000314, 0x00000342, 0x00000345 } },
+	/* 0x00001f88 */ { 3, { 0x00000391, 0x00000313, 0x00000345 } },
+	/* 0x00001f89 */ { 3, { 0x00000391, 0x00000314, 0x00000345 } },
+	/* 0x00001f8a */ { 4, { 0x00000391, 0x00000313, 0x00000300, 0x00000345 } },
+	/* 0x00001f8b */ { 4, { 0x00000391, 0x00000314, 0x00000300, 0x00000345 } },
+	/* 0x00001f8c */ { 4, { 0x00000391, 0x00000313, 0x00000301, 0x00000345 } },
+	/* 0x00001f8d */ { 4, { 0x00000391, 0x00000314, 0x00000301, 0x00000345 } },
+	/* 0x00001f8e */ { 4, { 0x00000391, 0x00000313, 0x00000342, 0x00000345 } },
+	/* 0x00001f8f */ { 4, { 0x00000391, 0x00000314, 0x00000342, 0x00000345 } },
+	/* 0x00001f90 */ { 3, { 0x000003b7, 0x00000313, 0x00000345 } },
+	/* 0x00001f91 */ { 3, { 0x000003b7, 0x00000314, 0x00000345 } },
+	/* 0x00001f92 */ { 4, { 0x000003b7, 0x00000313, 0x00000300, 0x00000345 } },
+	/* 0x00001f93 */ { 4, { 0x000003b7, 0x00000314, 0x00000300, 0x00000345 } },
+	/* 0x00001f94 */ { 4, { 0x000003b7, 0x00000313, 0x00000301, 0x00000345 } },
+	/* 0x00001f95 */ { 4, { 0x000003b7, 0x00000314, 0x00000301, 0x00000345 } },
+	/* 0x00001f96 */ { 4, { 0x000003b7, 0x00000313, 0x00000342, 0x00000345 } },
+	/* 0x00001f97 */ { 4, { 0x000003b7, 0x00000314, 0x00000342, 0x00000345 } },
+	/* 0x00001f98 */ { 3, { 0x00000397, 0x00000313, 0x00000345 } },
+	/* 0x00001f99 */ { 3, { 0x00000397, 0x00000314, 0x00000345 } },
+	/* 0x00001f9a */ { 4, { 0x00000397, 0x00000313, 0x00000300, 0x00000345 } },
+	/* 0x00001f9b */ { 4, { 0x00000397, 0x00000314, 0x00000300, 0x00000345 } },
+	/* 0x00001f9c */ { 4, { 0x00000397, 0x00000313, 0x00000301, 0x00000345 } },
+	/* 0x00001f9d */ { 4, { 0x00000397, 0x00000314, 0x00000301, 0x00000345 } },
+	/* 0x00001f9e */ { 4, { 0x00000397, 0x00000313, 0x00000342, 0x00000345 } },
+	/* 0x00001f9f */ { 4, { 0x00000397, 0x00000314, 0x00000342, 0x00000345 } },
+	/* 0x00001fa0 */ { 3, { 0x000003c9, 0x00000313, 0x00000345 } },
+	/* 0x00001fa1 */ { 3, { 0x000003c9, 0x00000314, 0x00000345 } },
+	/* 0x00001fa2 */ { 4, { 0x000003c9, 0x00000313, 0x00000300, 0x00000345 } },
+	/* 0x00001fa3 */ { 4, { 0x000003c9, 0x00000314, 0x00000300, 0x00000345 } },
+	/* 0x00001fa4 */ { 4, { 0x000003c9, 0x00000313, 0x00000301, 0x00000345 } },
+	/* 0x00001fa5 */ { 4, { 0x000003c9, 0x00000314, 0x00000301, 0x00000345 } },
+	/* 0x00001fa6 */ { 4, { 0x000003c9, 0x00000313, 0x00000342, 0x00000345 } },
+	/* 0x00001fa7 */ { 4, { 0x000003c9, 0x00000314, 0x00000342, 0x00000345 } },
+	/* 0x00001fa8 */ { 3, { 0x000003a9, 0x00000313, 0x00000345 } },
+	/* 0x00001fa9 */ { 3, { 0x000003a9, 0x00000314, 0x00000345 } },
+	/* 0x00001faa */ { 4, { 0x000003a9, 0x00000313, 0x00000300, 0x00000345 } },
+	/* 0x00001fab */ { 4, { 0x000003a9, 0x00000314, 0x00000300, 0x00000345 } },
+	/* 0x00001fac */ { 4, { 0x000003a9, 0x00000313, 0x00000301, 0x00000345 } },
+	/* 0x00001fad */ { 4, { 0x000003a9, 0x00000314, 0x00000301, 0x00000345 } },
+	/* 0x00001fae */ { 4, { 0x000003a9, 0x00000313, 0x00000342, 0x00000345 } },
+	/* 0x00001faf */ { 4, { 0x000003a9, 0x00000314, 0x00000342, 0x00000345 } },
+	/* 0x00001fb0 */ { 2, { 0x000003b1, 0x00000306 } },
+	/* 0x00001fb1 */ { 2, { 0x000003b1, 0x00000304 } },
+	/* 0x00001fb2 */ { 3, { 0x000003b1, 0x00000300, 0x00000345 } },
+	/* 0x00001fb3 */ { 2, { 0x000003b1, 0x00000345 } },
+	/* 0x00001fb4 */ { 3, { 0x000003b1, 0x00000301, 0x00000345 } },
+	/* 0x00001fb5 */ { 1, { 0x00001fb5 } },
+	/* 0x00001fb6 */ { 2, { 0x000003b1, 0x00000342 } },
+	/* 0x00001fb7 */ { 3, { 0x000003b1, 0x00000342, 0x00000345 } },
+	/* 0x00001fb8 */ { 2, { 0x00000391, 0x00000306 } },
+	/* 0x00001fb9 */ { 2, { 0x00000391, 0x00000304 } },
+	/* 0x00001fba */ { 2, { 0x00000391, 0x00000300 } },
+	/* 0x00001fbb */ { 2, { 0x00000391, 0x00000301 } },
+	/* 0x00001fbc */ { 2, { 0x00000391, 0x00000345 } },
+	/* 0x00001fbd */ { 1, { 0x00001fbd } },
+	/* 0x00001fbe */ { 1, { 0x000003b9 } },
+	/* 0x00001fbf */ { 1, { 0x00001fbf } },
+	/* 0x00001fc0 */ { 1, { 0x00001fc0 } },
+	/* 0x00001fc1 */ { 2, { 0x000000a8, 0x00000342 } },
+	/* 0x00001fc2 */ { 3, { 0x000003b7, 0x00000300, 0x00000345 } },
+	/* 0x00001fc3 */ { 2, { 0x000003b7, 0x00000345 } },
+	/* 0x00001fc4 */ { 3, { 0x000003b7, 0x00000301, 0x00000345 } },
+	/* 0x00001fc5 */ { 1, { 0x00001fc5 } },
+	/* 0x00001fc6 */ { 2, { 0x000003b7, 0x00000342 } },
+	/* 0x00001fc7 */ { 3, { 0x000003b7, 0x00000342, 0x00000345 } },
+	/* 0x00001fc8 */ { 2, { 0x00000395, 0x00000300 } },
+	/* 0x00001fc9 */ { 2, { 0x00000395, 0x00000301 } },
+	/* 0x00001fca */ { 2, { 0x00000397, 0x00000300 } },
+	/* 0x00001fcb */ { 2, { 0x00000397, 0x00000301 } },
+	/* 0x00001fcc */ { 2, { 0x00000397, 0x00000345 } },
+	/* 0x00001fcd */ { 2, { 0x00001fbf, 0x00000300 } },
+	/* 0x00001fce */ { 2, { 0x00001fbf, 0x00000301 } },
+	/* 0x00001fcf */ { 2, { 0x00001fbf, 0x00000342 } },
+	/* 0x00001fd0 */ { 2, { 0x000003b9, 0x00000306 } },
+	/* 0x00001fd1 */ { 2, { 0x000003b9, 0x00000304 } },
+	/* 0x00001fd2 */ { 3, { 0x000003b9, 0x00000308, 0x00000300 } },
+	/* 0x00001fd3 */ { 3, { 0x000003b9, 0x00000308, 0x00000301 } },
+	/* 0x00001fd4 */ { 1, { 0x00001fd4 } },
+	/* 0x00001fd5 */ { 1, { 0x00001fd5 } },
+	/* 0x00001fd6 */ { 2, { 0x000003b9, 0x00000342 } },
+	/* 0x00001fd7 */ { 3, { 0x000003b9, 0x00000308, 0x00000342 } },
+	/* 0x00001fd8 */ { 2, { 0x00000399, 0x00000306 } },
+	/* 0x00001fd9 */ { 2, { 0x00000399, 0x00000304 } },
+	/* 0x00001fda */ { 2, { 0x00000399, 0x00000300 } },
+	/* 0x00001fdb */ { 2, { 0x00000399, 0x00000301 } },
+	/* 0x00001fdc */ { 1, { 0x00001fdc } },
+	/* 0x00001fdd */ { 2, { 0x00001ffe, 0x00000300 } },
+	/* 0x00001fde */ { 2, { 0x00001ffe, 0x00000301 } },
+	/* 0x00001fdf */ { 2, { 0x00001ffe, 0x00000342 } },
+	/* 0x00001fe0 */ { 2, { 0x000003c5, 0x00000306 } },
+	/* 0x00001fe1 */ { 2, { 0x000003c5, 0x00000304 } },
+	/* 0x00001fe2 */ { 3, { 0x000003c5, 0x00000308, 0x00000300 } },
+	/* 0x00001fe3 */ { 3, { 0x000003c5, 0x00000308, 0x00000301 } },
+	/* 0x00001fe4 */ { 2, { 0x000003c1, 0x00000313 } },
+	/* 0x00001fe5 */ { 2, { 0x000003c1, 0x00000314 } },
+	/* 0x00001fe6 */ { 2, { 0x000003c5, 0x00000342 } },
+	/* 0x00001fe7 */ { 3, { 0x000003c5, 0x00000308, 0x00000342 } },
+	/* 0x00001fe8 */ { 2, { 0x000003a5, 0x00000306 } },
+	/* 0x00001fe9 */ { 2, { 0x000003a5, 0x00000304 } },
+	/* 0x00001fea */ { 2, { 0x000003a5, 0x00000300 } },
+	/* 0x00001feb */ { 2, { 0x000003a5, 0x00000301 } },
+	/* 0x00001fec */ { 2, { 0x000003a1, 0x00000314 } },
+	/* 0x00001fed */ { 2, { 0x000000a8, 0x00000300 } },
+	/* 0x00001fee */ { 2, { 0x000000a8, 0x00000301 } },
+	/* 0x00001fef */ { 1, { 0x00000060 } },
+	/* 0x00001ff0 */ { 1, { 0x00001ff0 } },
+	/* 0x00001ff1 */ { 1, { 0x00001ff1 } },
+	/* 0x00001ff2 */ { 3, { 0x000003c9, 0x00000300, 0x00000345 } },
+	/* 0x00001ff3 */ { 2, { 0x000003c9, 0x00000345 } },
+	/* 0x00001ff4 */ { 3, { 0x000003c9, 0x00000301, 0x00000345 } },
+	/* 0x00001ff5 */ { 1, { 0x00001ff5 } },
+	/* 0x00001ff6 */ { 2, { 0x000003c9, 0x00000342 } },
+	/* 0x00001ff7 */ { 3, { 0x000003c9, 0x00000342, 0x00000345 } },
+	/* 0x00001ff8 */ { 2, { 0x0000039f, 0x00000300 } },
+	/* 0x00001ff9 */ { 2, { 0x0000039f, 0x00000301 } },
+	/* 0x00001ffa */ { 2, { 0x000003a9, 0x00000300 } },
+	/* 0x00001ffb */ { 2, { 0x000003a9, 0x00000301 } },
+	/* 0x00001ffc */ { 2, { 0x000003a9, 0x00000345 } },
+	/* 0x00001ffd */ { 1, { 0x000000b4 } },
+	/* 0x00001ffe */ { 1, { 0x00001ffe } },
+	/* 0x00001fff */ { 1, { 0x00001fff } }
+};
+
+static libfshfs_name_decomposition_mapping_t libfshfs_name_decomposition_mappings_0x00003000[ 256 ] = {
+	/* 0x00003000 */ { 1, { 0x00003000 } },
+	/* 0x00003001 */ { 1, { 0x00003001 } },
+	/* 0x00003002 */ { 1, { 0x00003002 } },
+	/* 0x00003003 */ { 1, { 0x00003003 } },
+	/* 0x00003004 */ { 1, { 0x00003004 } },
+	/* 0x00003005 */ { 1, { 0x00003005 } },
+	/* 0x00003006 */ { 1, { 0x00003006 } },
+	/* 0x00003007 */ { 1, { 0x00003007 } },
+	/* 0x00003008 */ { 1, { 0x00003008 } },
+	/* 0x00003009 */ { 1, { 0x00003009 } },
+	/* 0x0000300a */ { 1, { 0x0000300a } },
+	/* 0x0000300b */ { 1, { 0x0000300b } },
+	/* 0x0000300c */ { 1, { 0x0000300c } },
+	/* 0x0000300d */ { 1, { 0x0000300d } },
+	/* 0x0000300e */ { 1, { 0x0000300e } },
+	/* 0x0000300f */ { 1, { 0x0000300f } },
+	/* 0x00003010 */ { 1, { 0x00003010 } },
+	/* 0x00003011 */ { 1, { 0x00003011 } },
+	/* 0x00003012 */ { 1, { 0x00003012 } },
+	/* 0x00003013 */ { 1, { 0x00003013 } },
+	/* 0x00003014 */ { 1, { 0x00003014 } },
+	/* 0x00003015 */ { 1, { 0x00003015 } },
+	/* 0x00003016 */ { 1, { 0x00003016 } },
+	/* 0x00003017 */ { 1, { 0x00003017 } },
+	/* 0x00003018 */ { 1, { 0x00003018 } },
+	/* 0x00003019 */ { 1, { 0x00003019 } },
+	/* 0x0000301a */ { 1, { 0x0000301a } },
+	/* 0x0000301b */ { 1, { 0x0000301b } },
+	/* 0x0000301c */ { 1, { 0x0000301c } },
+	/* 0x0000301d */ { 1, { 0x0000301d } },
+	/* 0x0000301e */ { 1, { 0x0000301e } },
+	/* 0x0000301f */ { 1, { 0x0000301f } },
+	/* 0x00003020 */ { 1, { 0x00003020 } },
+	/* 0x00003021 */ { 1, { 0x00003021 } },
+	/* 0x00003022 */ { 1, { 0x00003022 } },
+	/* 0x00003023 */ { 1, { 0x00003023 } },
+	/* 0x00003024 */ { 1, { 0x00003024 } },
+	/* 0x00003025 */ { 1, { 0x00003025 } },
+	/* 0x00003026 */ { 1, { 0x00003026 } },
+	/* 0x00003027 */ { 1, { 0x00003027 } },
+	/* 0x00003028 */ { 1, { 0x00003028 } },
+	/* 0x00003029 */ { 1, { 0x00003029 } },
+	/* 0x0000302a */ { 1, { 0x0000302a } },
+	/* 0x0000302b */ { 1, { 0x0000302b } },
+	/* 0x0000302c */ { 1, { 0x0000302c } },
+	/* 0x0000302d */ { 1, { 0x0000302d } },
+	/* 0x0000302e */ { 1, { 0x0000302e } },
+	/* 0x0000302f */ { 1, { 0x0000302f } },
+	/* 0x00003030 */ { 1, { 0x00003030 } },
+	/* 0x00003031 */ { 1, { 0x00003031 } },
+	/* 0x00003032 */ { 1, { 0x00003032 } },
+	/* 0x00003033 */ { 1, { 0x00003033 } },
+	/* 0x00003034 */ { 1, { 0x00003034 } },
+	/* 0x00003035 */ { 1, { 0x00003035 } },
+	/* 0x00003036 */ { 1, { 0x00003036 } },
+	/* 0x00003037 */ { 1, { 0x00003037 } },
+	/* 0x00003038 */ { 1, { 0x00003038 } },
+	/* 0x00003039 */ { 1, { 0x00003039 } },
+	/* 0x0000303a */ { 1, { 0x0000303a } },
+	/* 0x0000303b */ { 1, { 0x0000303b } },
+	/* 0x0000303c */ { 1, { 0x0000303c } },
+	/* 0x0000303d */ { 1, { 0x0000303d } },
+	/* 0x0000303e */ { 1, { 0x0000303e } },
+	/* 0x0000303f */ { 1, { 0x0000303f } },
+	/* 0x00003040 */ { 1, { 0x00003040 } },
+	/* 0x00003041 */ { 1, { 0x00003041 } },
+	/* 0x00003042 */ { 1, { 0x00003042 } },
+	/* 0x00003043 */ { 1, { 0x00003043 } },
+	/* 0x00003044 */ { 1, { 0x00003044 } },
+	/* 0x00003045 */ { 1, { 0x00003045 } },
+	/* 0x00003046 */ { 1, { 0x00003046 } },
+	/* 0x00003047 */ { 1, { 0x00003047 } },
+	/* 0x00003048 */ { 1, { 0x00003048 } },
+	/* 0x00003049 */ { 1, { 0x00003049 } },
+	/* 0x0000304a */ { 1, { 0x0000304a } },
+	/* 0x0000304b */ { 1, { 0x0000304b } },
+	/* 0x0000304c */ { 2, { 0x0000304b, 0x00003099 } },
+	/* 0x0000304d */ { 1, { 0x0000304d } },
+	/* 0x0000304e */ { 2, { 0x0000304d, 0x00003099 } },
+	/* 0x0000304f */ { 1, { 0x0000304f } },
+	/* 0x00003050 */ { 2, { 0x0000304f, 0x00003099 } },
+	/* 0x00003051 */ { 1, { 0x00003051 } },
+	/* 0x00003052 */ { 2, { 0x00003051, 0x00003099 } },
+	/* 0x00003053 */ { 1, { 0x00003053 } },
+	/* 0x00003054 */ { 2, { 0x00003053, 0x00003099 } },
+	/* 0x00003055 */ { 1, { 0x00003055 } },
+	/* 0x00003056 */ { 2, { 0x00003055, 0x00003099 } },
+	/* 0x00003057 */ { 1, { 0x00003057 } },
+	/* 0x00003058 */ { 2, { 0x00003057, 0x00003099 } },
+	/* 0x00003059 */ { 1, { 0x00003059 } },
+	/* 0x0000305a */ { 2, { 0x00003059, 0x00003099 } },
+	/* 0x0000305b */ { 1, { 0x0000305b } },
+	/* 0x0000305c */ { 2, { 0x0000305b, 0x00003099 } },
+	/* 0x0000305d */ { 1, { 0x0000305d } },
+	/* 0x0000305e */ { 2, { 0x0000305d, 0x00003099 } },
+	/* 0x0000305f */ { 1, { 0x0000305f } },
+	/* 0x00003060 */ { 2, { 0x0000305f, 0x00003099 } },
+	/* 0x00003061 */ { 1, { 0x00003061 } },
+	/* 0x00003062 */ { 2, { 0x00003061, 0x00003099 } },
+	/* 0x00003063 */ { 1, { 0x00003063 } },
+	/* 0x00003064 */ { 1, { 0x00003064 } },
+	/* 0x00003065 */ { 2, { 0x00003064, 0x00003099 } },
+	/* 0x00003066 */ { 1, { 0x00003066 } },
+	/* 0x00003067 */ { 2, { 0x00003066, 0x00003099 } },
+	/* 0x00003068 */ { 1, { 0x00003068 } },
+	/* 0x00003069 */ { 2, { 0x00003068, 0x00003099 } },
+	/* 0x0000306a */ { 1, { 0x0000306a } },
+	/* 0x0000306b */ { 1, { 0x0000306b } },
+	/* 0x0000306c */ { 1, { 0x0000306c } },
+	/* 0x0000306d */ { 1, { 0x0000306d } },
+	/* 0x0000306e */ { 1, { 0x0000306e } },
+	/* 0x0000306f */ { 1, { 0x0000306f } },
+	/* 0x00003070 */ { 2, { 0x0000306f, 0x00003099 } },
+	/* 0x00003071 */ { 2, { 0x0000306f, 0x0000309a } },
+	/* 0x00003072 */ { 1, { 0x00003072 } },
+	/* 0x00003073 */ { 2, { 0x00003072, 0x00003099 } },
+	/* 0x00003074 */ { 2, { 0x00003072, 0x0000309a } },
+	/* 0x00003075 */ { 1, { 0x00003075 } },
+	/* 0x00003076 */ { 2, { 0x00003075, 0x00003099 } },
+	/* 0x00003077 */ { 2, { 0x00003075, 0x0000309a } },
+	/* 0x00003078 */ { 1, { 0x00003078 } },
+	/* 0x00003079 */ { 2, { 0x00003078, 0x00003099 } },
+	/* 0x0000307a */ { 2, { 0x00003078, 0x0000309a } },
+	/* 0x0000307b */ { 1, { 0x0000307b } },
+	/* 0x0000307c */ { 2, { 0x0000307b, 0x00003099 } },
+	/* 0x0000307d */ { 2, { 0x0000307b, 0x0000309a } },
+	/* 0x0000307e */ { 1, { 0x0000307e } },
+	/* 0x0000307f */ { 1, { 0x0000307f } },
+	/* 0x00003080 */ { 1, { 0x00003080 } },
+	/* 0x00003081 */ { 1, { 0x00003081 } },
+	/* 0x00003082 */ { 1, { 0x00003082 } },
+	/* 0x00003083 */ { 1, { 0x00003083 } },
+	/* 0x00003084 */ { 1, { 0x00003084 } },
+	/* 0x00003085 */ { 1, { 0x00003085 } },
+	/* 0x00003086 */ { 1, { 0x00003086 } },
+	/* 0x00003087 */ { 1, { 0x00003087 } },
+	/* 0x00003088 */ { 1, { 0x00003088 } },
+	/* 0x00003089 */ { 1, { 0x00003089 } },
+	/* 0x0000308a */ { 1, { 0x0000308a } },
+	/* 0x0000308b */ { 1, { 0x0000308b } },
+	/* 0x0000308c */ { 1, { 0x0000308c } },
+	/* 0x0000308d */ { 1, { 0x0000308d } },
+	/* 0x0000308e */ { 1, { 0x0000308e } },
+	/* 0x0000308f */ { 1, { 0x0000308f } },
+	/* 0x00003090 */ { 1, { 0x00003090 } },
+	/* 0x00003091 */ { 1, { 0x00003091 } },
+	/* 0x00003092 */ { 1, { 0x00003092 } },
+	/* 0x00003093 */ { 1, { 0x00003093 } },
+	/* 0x00003094 */ { 2, { 0x00003046, 0x00003099 } },
+	/* 0x00003095 */ { 1, { 0x00003095 } },
+	/* 0x00003096 */ { 1, { 0x00003096 } },
+	/* 0x00003097 */ { 1, { 0x00003097 } },
+	/* 0x00003098 */ { 1, { 0x00003098 } },
+	/* 0x00003099 */ { 1, { 0x00003099 } },
+	/* 0x0000309a */ { 1, { 0x0000309a } },
+	/* 0x0000309b */ { 1, { 0x0000309b } },
+	/* 0x0000309c */ { 1, { 0x0000309c } },
+	/* 0x0000309d */ { 1, { 0x0000309d } },
+	/* 0x0000309e */ { 2, { 0x0000309d, 0x00003099 } },
+	/* 0x0000309f */ { 1, { 0x0000309f } },
+	/* 0x000030a0 */ { 1, { 0x000030a0 } },
+	/* 0x000030a1 */ { 1, { 0x000030a1 } },
+	/* 0x000030a2 */ { 1, { 0x000030a2 } },
+	/* 0x000030a3 */ { 1, { 0x000030a3 } },
+	/* 0x000030a4 */ { 1, { 0x000030a4 } },
+	/* 0x000030a5 */ { 1, { 0x000030a5 } },
+	/* 0x000030a6 */ { 1, { 0x000030a6 } },
+	/* 0x000030a7 */ { 1, { 0x000030a7 } },
+	/* 0x000030a8 */ { 1, { 0x000030a8 } },
+	/* 0x000030a9 */ { 1, { 0x000030a9 } },
+	/* 0x000030aa */ { 1, { 0x000030aa } },
+	/* 0x000030ab */ { 1, { 0x000030ab } },
+	/* 0x000030ac */ { 2, { 0x000030ab, 0x00003099 } },
+	/* 0x000030ad */ { 1, { 0x000030ad } },
+	/* 0x000030ae */ { 2, { 0x000030ad, 0x00003099 } },
+	/* 0x000030af */ { 1, { 0x000030af } },
+	/* 0x000030b0 */ { 2, { 0x000030af, 0x00003099 } },
+	/* 0x000030b1 */ { 1, { 0x000030b1 } },
+	/* 0x000030b2 */ { 2, { 0x000030b1, 0x00003099 } },
+	/* 0x000030b3 */ { 1, { 0x000030b3 } },
+	/* 0x000030b4 */ { 2, { 0x000030b3, 0x00003099 } },
+	/* 0x000030b5 */ { 1, { 0x000030b5 } },
+	/* 0x000030b6 */ { 2, { 0x000030b5, 0x00003099 } },
+	/* 0x000030b7 */ { 1, { 0x000030b7 } },
+	/* 0x000030b8 */ { 2, { 0x000030b7, 0x00003099 } },
+	/* 0x000030b9 */ { 1, { 0x000030b9 } },
+	/* 0x000030ba */ { 2, { 0x000030b9, 0x00003099 } },
+	/* 0x000030bb */ { 1, { 0x000030bb } },
+	/* 0x000030bc */ { 2, { 0x000030bb, 0x00003099 } },
+	/* 0x000030bd */ { 1, { 0x000030bd } },
+	/* 0x000030be */ { 2, { 0x000030bd, 0x00003099 } },
+	/* 0x000030bf */ { 1, { 0x000030bf } },
+	/* 0x000030c0 */ { 2, { 0x000030bf, 0x00003099 } },
+	/* 0x000030c1 */ { 1, { 0x000030c1 } },
+	/* 0x000030c2 */ { 2, { 0x000030c1, 0x00003099 } },
+	/* 0x000030c3 */ { 1, { 0x000030c3 } },
+	/* 0x000030c4 */ { 1, { 0x000030c4 } },
+	/* 0x000030c5 */ { 2, { 0x000030c4, 0x00003099 } },
+	/* 0x000030c6 */ { 1, { 0x000030c6 } },
+	/* 0x000030c7 */ { 2, { 0x000030c6, 0x00003099 } },
+	/* 0x000030c8 */ { 1, { 0x000030c8 } },
+	/* 0x000030c9 */ { 2, { 0x000030c8, 0x00003099 } },
+	/* 0x000030ca */ { 1, { 0x000030ca } },
+	/* 0x000030cb */ { 1, { 0x000030cb } },
+	/* 0x000030cc */ { 1, { 0x000030cc } },
+	/* 0x000030cd */ { 1, { 0x000030cd } },
+	/* 0x000030ce */ { 1, { 0x000030ce } },
+	/* 0x000030cf */ { 1, { 0x000030cf } },
+	/* 0x000030d0 */ { 2, { 0x000030cf, 0x00003099 } },
+	/* 0x000030d1 */ { 2, { 0x000030cf, 0x0000309a } },
+	/* 0x000030d2 */ { 1, { 0x000030d2 } },
+	/* 0x000030d3 */ { 2, { 0x000030d2, 0x00003099 } },
+	/* 0x000030d4 */ { 2, { 0x000030d2, 0x0000309a } },
+	/* 0x000030d5 */ { 1, { 0x000030d5 } },
+	/* 0x000030d6 */ { 2, { 0x000030d5, 0x00003099 } },
+	/* 0x000030d7 */ { 2, { 0x000030d5, 0x0000309a } },
+	/* 0x000030d8 */ { 1, { 0x000030d8 } },
+	/* 0x000030d9 */ { 2, { 0x000030d8, 0x00003099 } },
+	/* 0x000030da */ { 2, { 0x000030d8, 0x0000309a } },
+	/* 0x000030db */ { 1, { 0x000030db } },
+	/* 0x000030dc */ { 2, { 0x000030db, 0x00003099 } },
+	/* 0x000030dd */ { 2, { 0x000030db, 0x0000309a } },
+	/* 0x000030de */ { 1, { 0x000030de } },
+	/* 0x000030df */ { 1, { 0x000030df } },
+	/* 0x000030e0 */ { 1, { 0x000030e0 } },
+	/* 0x000030e1 */ { 1, { 0x000030e1 } },
+	/* 0x000030e2 */ { 1, { 0x000030e2 } },
+	/* 0x000030e3 */ { 1, { 0x000030e3 } },
+	/* 0x000030e4 */ { 1, { 0x000030e4 } },
+	/* 0x000030e5 */ { 1, { 0x000030e5 } },
+	/* 0x000030e6 */ { 1, { 0x000030e6 } },
+	/* 0x000030e7 */ { 1, { 0x000030e7 } },
+	/* 0x000030e8 */ { 1, { 0x000030e8 } },
+	/* 0x000030e9 */ { 1, { 0x000030e9 } },
+	/* 0x000030ea */ { 1, { 0x000030ea } },
+	/* 0x000030eb */ { 1, { 0x000030eb } },
+	/* 0x000030ec */ { 1, { 0x000030ec } },
+	/* 0x000030ed */ { 1, { 0x000030ed } },
+	/* 0x000030ee */ { 1, { 0x000030ee } },
+	/* 0x000030ef */ { 1, { 0x000030ef } },
+	/* 0x000030f0 */ { 1, { 0x000030f0 } },
+	/* 0x000030f1 */ { 1, { 0x000030f1 } },
+	/* 0x000030f2 */ { 1, { 0x000030f2 } },
+	/* 0x000030f3 */ { 1, { 0x000030f3 } },
+	/* 0x000030f4 */ { 2, { 0x000030a6, 0x00003099 } },
+	/* 0x000030f5 */ { 1, { 0x000030f5 } },
+	/* 0x000030f6 */ { 1, { 0x000030f6 } },
+	/* 0x000030f7 */ { 2, { 0x000030ef, 0x00003099 } },
+	/* 0x000030f8 */ { 2, { 0x000030f0, 0x00003099 } },
+	/* 0x000030f9 */ { 2, { 0x000030f1, 0x00003099 } },
+	/* 0x000030fa */ { 2, { 0x000030f2, 0x00003099 } },
+	/* 0x000030fb */ { 1, { 0x000030fb } },
+	/* 0x000030fc */ { 1, { 0x000030fc } },
+	/* 0x000030fd */ { 1, { 0x000030fd } },
+	/* 0x000030fe */ { 2, { 0x000030fd, 0x00003099 } },
+	/* 0x000030ff */ { 1, { 0x000030ff } }
+};
+
+static libfshfs_name_decomposition_mapping_t libfshfs_name_decomposition_mappings_0x0000ac00[ 256 ] = {
+	/* 0x0000ac00 */ { 2, { 0x00001100, 0x00001161 } },
+	/* 0x0000ac01 */ { 1, { 0x0000ac01 } },
+	/* 0x0000ac02 */ { 1, { 0x0000ac02 } },
+	/* 0x0000ac03 */ { 1, { 0x0000ac03 } },
+	/* 0x0000ac04 */ { 1, { 0x0000ac04 } },
+	/* 0x0000ac05 */ { 1, { 0x0000ac05 } },
+	/* 0x0000ac06 */ { 1, { 0x0000ac06 } },
+	/* 0x0000ac07 */ { 1, { 0x0000ac07 } },
+	/* 0x0000ac08 */ { 1, { 0x0000ac08 } },
+	/* 0x0000ac09 */ { 1, { 0x0000ac09 } },
+	/* 0x0000ac0a */ { 1, { 0x0000ac0a } },
+	/* 0x0000ac0b */ { 1, { 0x0000ac0b } },
+	/* 0x0000ac0c */ { 1, { 0x0000ac0c } },
+	/* 0x0000ac0d */ { 1, { 0x0000ac0d } },
+	/* 0x0000ac0e */ { 1, { 0x0000ac0e } },
+	/* 0x0000ac0f */ { 1, { 0x0000ac0f } },
+	/* 0x0000ac10 */ { 1, { 0x0000ac10 } },
+	/* 0x0000ac11 */ { 1, { 0x0000ac11 } },
+	/* 0x0000ac12 */ { 1, { 0x0000ac12 } },
+	/* 0x0000ac13 */ { 1, { 0x0000ac13 } },
+	/* 0x0000ac14 */ { 1, { 0x0000ac14 } },
+	/* 0x0000ac15 */ { 1, { 0x0000ac15 } },
+	/* 0x0000ac16 */ { 1, { 0x0000ac16 } },
+	/* 0x0000ac17 */ { 1, { 0x0000ac17 } },
+	/* 0x0000ac18 */ { 1, { 0x0000ac18 } },
+	/* 0x0000ac19 */ { 1, { 0x0000ac19 } },
+	/* 0x0000ac1a */ { 1, { 0x0000ac1a } },
+	/* 0x0000ac1b */ { 1, { 0x0000ac1b } },
+	/* 0x0000ac1c */ { 1, { 0x0000ac1c } },
+	/* 0x0000ac1d */ { 1, { 0x0000ac1d } },
+	/* 0x0000ac1e */ { 1, { 0x0000ac1e } },
+	/* 0x0000ac1f */ { 1, { 0x0000ac1f } },
+	/* 0x0000ac20 */ { 1, { 0x0000ac20 } },
+	/* 0x0000ac21 */ { 1, { 0x0000ac21 } },
+	/* 0x0000ac22 */ { 1, { 0x0000ac22 } },
+	/* 0x0000ac23 */ { 1, { 0x0000ac23 } },
+	/* 0x0000ac24 */ { 1, { 0x0000ac24 } },
+	/* 0x0000ac25 */ { 1, { 0x0000ac25 } },
+	/* 0x0000ac26 */ { 1, { 0x0000ac26 } },
+	/* 0x0000ac27 */ { 1, { 0x0000ac27 } },
+	/* 0x0000ac28 */ { 1, { 0x0000ac28 } },
+	/* 0x0000ac29 */ { 1, { 0x0000ac29 } },
+	/* 0x0000ac2a */ { 1, { 0x0000ac2a } },
+	/* 0x0000ac2b */ { 1, { 0x0000ac2b } },
+	/* 0x0000ac2c */ { 1, { 0x0000ac2c } },
+	/* 0x0000ac2d */ { 1, { 0x0000ac2d } },
+	/* 0x0000ac2e */ { 1, { 0x0000ac2e } },
+	/* 0x0000ac2f */ { 1, { 0x0000ac2f } },
+	/* 0x0000ac30 */ { 1, { 0x0000ac30 } },
+	/* 0x0000ac31 */ { 1, { 0x0000ac31 } },
+	/* 0x0000ac32 */ { 1, { 0x0000ac32 } },
+	/* 0x0000ac33 */ { 1, { 0x0000ac33 } },
+	/* 0x0000ac34 */ { 1, { 0x0000ac34 } },
+	/* 0x0000ac35 */ { 1, { 0x0000ac35 } },
+	/* 0x0000ac36 */ { 1, { 0x0000ac36 } },
+	/* 0x0000ac37 */ { 1, { 0x0000ac37 } },
+	/* 0x0000ac38 */ { 1, { 0x0000ac38 } },
+	/* 0x0000ac39 */ { 1, { 0x0000ac39 } },
+	/* 0x0000ac3a */ { 1, { 0x0000ac3a } },
+	/* 0x0000ac3b */ { 1, { 0x0000ac3b } },
+	/* 0x0000ac3c */ { 1, { 0x0000ac3c } },
+	/* 0x0000ac3d */ { 1, { 0x0000ac3d } },
+	/* 0x0000ac3e */ { 1, { 0x0000ac3e } },
+	/* 0x0000ac3f */ { 1, { 0x0000ac3f } },
+	/* 0x0000ac40 */ { 1, { 0x0000ac40 } },
+	/* 0x0000ac41 */ { 1, { 0x0000ac41 } },
+	/* 0x0000ac42 */ { 1, { 0x0000ac42 } },
+	/* 0x0000ac43 */ { 1, { 0x0000ac43 } },
+	/* 0x0000ac44 */ { 1, { 0x0000ac44 } },
+	/* 0x0000ac45 */ { 1, { 0x0000ac45 } },
+	/* 0x0000ac46 */ { 1, { 0x0000ac46 } },
+	/* 0x0000ac47 */ { 1, { 0x0000ac47 } },
+	/* 0x0000ac48 */ { 1, { 0x0000ac48 } },
+	/* 0x0000ac49 */ { 1, { 0x0000ac49 } },
+	/* 0x0000ac4a */ { 1, { 0x0000ac4a } },
+	/* 0x0000ac4b */ { 1, { 0x0000ac4b } },
+	/* 0x0000ac4c */ { 1, { 0x0000ac4c } },
+	/* 0x0000ac4d */ { 1, { 0x0000ac4d } },
+	/* 0x0000ac4e */ { 1, { 0x0000ac4e } },
+	/* 0x0000ac4f */ { 1, { 0x0000ac4f } },
+	/* 0x0000ac50 */ { 1, { 0x0000ac50 } },
+	/* 0x0000ac51 */ { 1, { 0x0000ac51 } },
+	/* 0x0000ac52 */ { 1, { 0x0000ac52 } },
+	/* 0x0000ac53 */ { 1, { 0x0000ac53 } },
+	/* 0x0000ac54 */ { 1, { 0x0000ac54 } },
+	/* 0x0000ac55 */ { 1, { 0x0000ac55 } },
+	/* 0x0000ac56 */ { 1, { 0x0000ac56 } },
+	/* 0x0000ac57 */ { 1, { 0x0000ac57 } },
+	/* 0x0000ac58 */ { 1, { 0x0000ac58 } },
+	/* 0x0000ac59 */ { 1, { 0x0000ac59 } },
+	/* 0x0000ac5a */ { 1, { 0x0000ac5a } },
+	/* 0x0000ac5b */ { 1, { 0x0000ac5b } },
+	/* 0x0000ac5c */ { 1, { 0x0000ac5c } },
+	/* 0x0000ac5d */ { 1, { 0x0000ac5d } },
+	/* 0x0000ac5e */ { 1, { 0x0000ac5e } },
+	/* 0x0000ac5f */ { 1, { 0x0000ac5f } },
+	/* 0x0000ac60 */ { 1, { 0x0000ac60 } },
+	/* 0x0000ac61 */ { 1, { 0x0000ac61 } },
+	/* 0x0000ac62 */ { 1, { 0x0000ac62 } },
+	/* 0x0000ac63 */ { 1, { 0x0000ac63 } },
+	/* 0x0000ac64 */ { 1, { 0x0000ac64 } },
+	/* 0x0000ac65 */ { 1, { 0x0000ac65 } },
+	/* 0x0000ac66 */ { 1, { 0x0000ac66 } },
+	/* 0x0000ac67 */ { 1, { 0x0000ac67 } },
+	/* 0x0000ac68 */ { 1, { 0x0000ac68 } },
+	/* 0x0000ac69 */ { 1, { 0x0000ac69 } },
+	/* 0x0000ac6a */ { 1, { 0x0000ac6a } },
+	/* 0x0000ac6b */ { 1, { 0x0000ac6b } },
+	/* 0x0000ac6c */ { 1, { 0x0000ac6c } },
+	/* 0x0000ac6d */ { 1, { 0x0000ac6d } },
+	/* 0x0000ac6e */ { 1, { 0x0000ac6e } },
+	/* 0x0000ac6f */ { 1, { 0x0000ac6f } },
+	/* 0x0000ac70 */ { 1, { 0x0000ac70 } },
+	/* 0x0000ac71 */ { 1, { 0x0000ac71 } },
+	/* 0x0000ac72 */ { 1, { 0x0000ac72 } },
+	/* 0x0000ac73 */ { 1, { 0x0000ac73 } },
+	/* 0x0000ac74 */ { 1, { 0x0000ac74 } },
+	/* 0x0000ac75 */ { 1, { 0x0000ac75 } },
+	/* 0x0000ac76 */ { 1, { 0x0000ac76 } },
+	/* 0x0000ac77 */ { 1, { 0x0000ac77 } },
+	/* 0x0000ac78 */ { 1, { 0x0000ac78 } },
+	/* 0x0000ac79 */ { 1, { 0x0000ac79 } },
+	/* 0x0000ac7a */ { 1, { 0x0000ac7a } },
+	/* 0x0000ac7b */ { 1, { 0x0000ac7b } },
+	/* 0x0000ac7c */ { 1, { 0x0000ac7c } },
+	/* 0x0000ac7d */ { 1, { 0x0000ac7d } },
+	/* 0x0000ac7e */ { 1, { 0x0000ac7e } },
+	/* 0x0000ac7f */ { 1, { 0x0000ac7f } },
+	/* 0x0000ac80 */ { 1, { 0x0000ac80 } },
+	/* 0x0000ac81 */ { 1, { 0x0000ac81 } },
+	/* 0x0000ac82 */ { 1, { 0x0000ac82 } },
+	/* 0x0000ac83 */ { 1, { 0x0000ac83 } },
+	/* 0x0000ac84 */ { 1, { 0x0000ac84 } },
+	/* 0x0000ac85 */ { 1, { 0x0000ac85 } },
+	/* 0x0000ac86 */ { 1, { 0x0000ac86 } },
+	/* 0x0000ac87 */ { 1, { 0x0000ac87 } },
+	/* 0x0000ac88 */ { 1, { 0x0000ac88 } },
+	/* 0x0000ac89 */ { 1, { 0x0000ac89 } },
+	/* 0x0000ac8a */ { 1, { 0x0000ac8a } },
+	/* 0x0000ac8b */ { 1, { 0x0000ac8b } },
+	/* 0x0000ac8c */ { 1, { 0x0000ac8c } },
+	/* 0x0000ac8d */ { 1, { 0x0000ac8d } },
+	/* 0x0000ac8e */ { 1, { 0x0000ac8e } },
+	/* 0x0000ac8f */ { 1, { 0x0000ac8f } },
+	/* 0x0000ac90 */ { 1, { 0x0000ac90 } },
+	/* 0x0000ac91 */ { 1, { 0x0000ac91 } },
+	/* 0x0000ac92 */ { 1, { 0x0000ac92 } },
+	/* 0x0000ac93 */ { 1, { 0x0000ac93 } },
+	/* 0x0000ac94 */ { 1, { 0x0000ac94 } },
+	/* 0x0000ac95 */ { 1, { 0x0000ac95 } },
+	/* 0x0000ac96 */ { 1, { 0x0000ac96 } },
+	/* 0x0000ac97 */ { 1, { 0x0000ac97 } },
+	/* 0x0000ac98 */ { 1, { 0x0000ac98 } },
+	/* 0x0000ac99 */ { 1, { 0x0000ac99 } },
+	/* 0x0000ac9a */ { 1, { 0x0000ac9a } },
+	/* 0x0000ac9b */ { 1, { 0x0000ac9b } },
+	/* 0x0000ac9c */ { 1, { 0x0000ac9c } },
+	/* 0x0000ac9d */ { 1, { 0x0000ac9d } },
+	/* 0x0000ac9e */ { 1, { 0x0000ac9e } },
+	/* 0x0000ac9f */ { 1, { 0x0000ac9f } },
+	/* 0x0000aca0 */ { 1, { 0x0000aca0 } },
+	/* 0x0000aca1 */ { 1, { 0x0000aca1 } },
+	/* 0x0000aca2 */ { 1, { 0x0000aca2 } },
+	/* 0x0000aca3 */ { 1, { 0x0000aca3 } },
+	/* 0x0000aca4 */ { 1, { 0x0000aca4 } },
+	/* 0x0000aca5 */ { 1, { 0x0000aca5 } },
+	/* 0x0000aca6 */ { 1, { 0x0000aca6 } },
+	/* 0x0000aca7 */ { 1, { 0x0000aca7 } },
+	/* 0x0000aca8 */ { 1, { 0x0000aca8 } },
+	/* 0x0000aca9 */ { 1, { 0x0000aca9 } },
+	/* 0x0000acaa */ { 1, { 0x0000acaa } },
+	/* 0x0000acab */ { 1, { 0x0000acab } },
+	/* 0x0000acac */ { 1, { 0x0000acac } },
+	/* 0x0000acad */ { 1, { 0x0000acad } },
+	/* 0x0000acae */ { 1, { 0x0000acae } },
+	/* 0x0000acaf */ { 1, { 0x0000acaf } },
+	/* 0x0000acb0 */ { 1, { 0x0000acb0 } },
+	/* 0x0000acb1 */ { 1, { 0x0000acb1 } },
+	/* 0x0000acb2 */ { 1, { 0x0000acb2 } },
+	/* 0x0000acb3 */ { 1, { 0x0000acb3 } },
+	/* 0x0000acb4 */ { 1, { 0x0000acb4 } },
+	/* 0x0000acb5 */ { 1, { 0x0000acb5 } },
+	/* 0x0000acb6 */ { 1, { 0x0000acb6 } },
+	/* 0x0000acb7 */ { 1, { 0x0000acb7 } },
+	/* 0x0000acb8 */ { 1, { 0x0000acb8 } },
+	/* 0x0000acb9 */ { 1, { 0x0000acb9 } },
+	/* 0x0000acba */ { 1, { 0x0000acba } },
+	/* 0x0000acbb */ { 1, { 0x0000acbb } },
+	/* 0x0000acbc */ { 1, { 0x0000acbc } },
+	/* 0x0000acbd */ { 1, { 0x0000acbd } },
+	/* 0x0000acbe */ { 1, { 0x0000acbe } },
+	/* 0x0000acbf */ { 1, { 0x0000acbf } },
+	/* 0x0000acc0 */ { 1, { 0x0000acc0 } },
+	/* 0x0000acc1 */ { 1, { 0x0000acc1 } },
+	/* 0x0000acc2 */ { 1, { 0x0000acc2 } },
+	/* 0x0000acc3 */ { 1, { 0x0000acc3 } },
+	/* 0x0000acc4 */ { 1, { 0x0000acc4 } },
+	/* 0x0000acc5 */ { 1, { 0x0000acc5 } },
+	/* 0x0000acc6 */ { 1, { 0x0000acc6 } },
+	/* 0x0000acc7 */ { 1, { 0x0000acc7 } },
+	/* 0x0000acc8 */ { 1, { 0x0000acc8 } },
+	/* 0x0000acc9 */ { 1, { 0x0000acc9 } },
+	/* 0x0000acca */ { 1, { 0x0000acca } },
+	/* 0x0000accb */ { 1, { 0x0000accb } },
+	/* 0x0000accc */ { 1, { 0x0000accc } },
+	/* 0x0000accd */ { 1, { 0x0000accd } },
+	/* 0x0000acce */ { 1, { 0x0000acce } },
+	/* 0x0000accf */ { 1, { 0x0000accf } },
+	/* 0x0000acd0 */ { 1, { 0x0000acd0 } },
+	/* 0x0000acd1 */ { 1, { 0x0000acd1 } },
+	/* 0x0000acd2 */ { 1, { 0x0000acd2 } },
+	/* 0x0000acd3 */ { 1, { 0x0000acd3 } },
+	/* 0x0000acd4 */ { 1, { 0x0000acd4 } },
+	/* 0x0000acd5 */ { 1, { 0x0000acd5 } },
+	/* 0x0000acd6 */ { 1, { 0x0000acd6 } },
+	/* 0x0000acd7 */ { 1, { 0x0000acd7 } },
+	/* 0x0000acd8 */ { 1, { 0x0000acd8 } },
+	/* 0x0000acd9 */ { 1, { 0x0000acd9 } },
+	/* 0x0000acda */ { 1, { 0x0000acda } },
+	/* 0x0000acdb */ { 1, { 0x0000acdb } },
+	/* 0x0000acdc */ { 1, { 0x0000acdc } },
+	/* 0x0000acdd */ { 1, { 0x0000acdd } },
+	/* 0x0000acde */ { 1, { 0x0000acde } },
+	/* 0x0000acdf */ { 1, { 0x0000acdf } },
+	/* 0x0000ace0 */ { 1, { 0x0000ace0 } },
+	/* 0x0000ace1 */ { 1, { 0x0000ace1 } },
+	/* 0x0000ace2 */ { 1, { 0x0000ace2 } },
+	/* 0x0000ace3 */ { 1, { 0x0000ace3 } },
+	/* 0x0000ace4 */ { 1, { 0x0000ace4 } },
+	/* 0x0000ace5 */ { 1, { 0x0000ace5 } },
+	/* 0x0000ace6 */ { 1, { 0x0000ace6 } },
+	/* 0x0000ace7 */ { 1, { 0x0000ace7 } },
+	/* 0x0000ace8 */ { 1, { 0x0000ace8 } },
+	/* 0x0000ace9 */ { 1, { 0x0000ace9 } },
+	/* 0x0000acea */ { 1, { 0x0000acea } },
+	/* 0x0000aceb */ { 1, { 0x0000aceb } },
+	/* 0x0000acec */ { 1, { 0x0000acec } },
+	/* 0x0000aced */ { 1, { 0x0000aced } },
+	/* 0x0000acee */ { 1, { 0x0000acee } },
+	/* 0x0000acef */ { 1, { 0x0000acef } },
+	/* 0x0000acf0 */ { 1, { 0x0000acf0 } },
+	/* 0x0000acf1 */ { 1, { 0x0000acf1 } },
+	/* 0x0000acf2 */ { 1, { 0x0000acf2 } },
+	/* 0x0000acf3 */ { 1, { 0x0000acf3 } },
+	/* 0x0000acf4 */ { 1, { 0x0000acf4 } },
+	/* 0x0000acf5 */ { 1, { 0x0000acf5 } },
+	/* 0x0000acf6 */ { 1, { 0x0000acf6 } },
+	/* 0x0000acf7 */ { 1, { 0x0000acf7 } },
+	/* 0x0000acf8 */ { 1, { 0x0000acf8 } },
+	/* 0x0000acf9 */ { 1, { 0x0000acf9 } },
+	/* 0x0000acfa */ { 1, { 0x0000acfa } },
+	/* 0x0000acfb */ { 1, { 0x0000acfb } },
+	/* 0x0000acfc */ { 1, { 0x0000acfc } },
+	/* 0x0000acfd */ { 1, { 0x0000acfd } },
+	/* 0x0000acfe */ { 1, { 0x0000acfe } },
+	/* 0x0000acff */ { 1, { 0x0000acff } }
+};
+
+static libfshfs_name_decomposition_mapping_t libfshfs_name_decomposition_mappings_0x0000d700[ 256 ] = {
+	/* 0x0000d700 */ { 1, { 0x0000d700 } },
+	/* 0x0000d701 */ { 1, { 0x0000d701 } },
+	/* 0x0000d702 */ { 1, { 0x0000d702 } },
+	/* 0x0000d703 */ { 1, { 0x0000d703 } },
+	/* 0x0000d704 */ { 1, { 0x0000d704 } },
+	/* 0x0000d705 */ { 1, { 0x0000d705 } },
+	/* 0x0000d706 */ { 1, { 0x0000d706 } },
+	/* 0x0000d707 */ { 1, { 0x0000d707 } },
+	/* 0x0000d708 */ { 1, { 0x0000d708 } },
+	/* 0x0000d709 */ { 1, { 0x0000d709 } },
+	/* 0x0000d70a */ { 1, { 0x0000d70a } },
+	/* 0x0000d70b */ { 1, { 0x0000d70b } },
+	/* 0x0000d70c */ { 1, { 0x0000d70c } },
+	/* 0x0000d70d */ { 1, { 0x0000d70d } },
+	/* 0x0000d70e */ { 1, { 0x0000d70e } },
+	/* 0x0000d70f */ { 1, { 0x0000d70f } },
+	/* 0x0000d710 */ { 1, { 0x0000d710 } },
+	/* 0x0000d711 */ { 1, { 0x0000d711 } },
+	/* 0x0000d712 */ { 1, { 0x0000d712 } },
+	/* 0x0000d713 */ { 1, { 0x0000d713 } },
+	/* 0x0000d714 */ { 1, { 0x0000d714 } },
+	/* 0x0000d715 */ { 1, { 0x0000d715 } },
+	/* 0x0000d716 */ { 1, { 0x0000d716 } },
+	/* 0x0000d717 */ { 1, { 0x0000d717 } },
+	/* 0x0000d718 */ { 1, { 0x0000d718 } },
+	/* 0x0000d719 */ { 1, { 0x0000d719 } },
+	/* 0x0000d71a */ { 1, { 0x0000d71a } },
+	/* 0x0000d71b */ { 1, { 0x0000d71b } },
+	/* 0x0000d71c */ { 1, { 0x0000d71c } },
+	/* 0x0000d71d */ { 1, { 0x0000d71d } },
+	/* 0x0000d71e */ { 1, { 0x0000d71e } },
+	/* 0x0000d71f */ { 1, { 0x0000d71f } },
+	/* 0x0000d720 */ { 1, { 0x0000d720 } },
+	/* 0x0000d721 */ { 1, { 0x0000d721 } },
+	/* 0x0000d722 */ { 1, { 0x0000d722 } },
+	/* 0x0000d723 */ { 1, { 0x0000d723 } },
+	/* 0x0000d724 */ { 1, { 0x0000d724 } },
+	/* 0x0000d725 */ { 1, { 0x0000d725 } },
+	/* 0x0000d726 */ { 1, { 0x0000d726 } },
+	/* 0x0000d727 */ { 1, { 0x0000d727 } },
+	/* 0x0000d728 */ { 1, { 0x0000d728 } },
+	/* 0x0000d729 */ { 1, { 0x0000d729 } },
+	/* 0x0000d72a */ { 1, { 0x0000d72a } },
+	/* 0x0000d72b */ { 1, { 0x0000d72b } },
+	/* 0x0000d72c */ { 1, { 0x0000d72c } },
+	/* 0x0000d72d */ { 1, { 0x0000d72d } },
+	/* 0x0000d72e */ { 1, { 0x0000d72e } },
+	/* 0x0000d72f */ { 1, { 0x0000d72f } },
+	/* 0x0000d730 */ { 1, { 0x0000d730 } },
+	/* 0x0000d731 */ { 1, { 0x0000d731 } },
+	/* 0x0000d732 */ { 1, { 0x0000d732 } },
+	/* 0x0000d733 */ { 1, { 0x0000d733 } },
+	/* 0x0000d734 */ { 1, { 0x0000d734 } },
+	/* 0x0000d735 */ { 1, { 0x0000d735 } },
+	/* 0x0000d736 */ { 1, { 0x0000d736 } },
+	/* 0x0000d737 */ { 1, { 0x0000d737 } },
+	/* 0x0000d738 */ { 1, { 0x0000d738 } },
+	/* 0x0000d739 */ { 1, { 0x0000d739 } },
+	/* 0x0000d73a */ { 1, { 0x0000d73a } },
+	/* 0x0000d73b */ { 1, { 0x0000d73b } },
+	/* 0x0000d73c */ { 1, { 0x0000d73c } },
+	/* 0x0000d73d */ { 1, { 0x0000d73d } },
+	/* 0x0000d73e */ { 1, { 0x0000d73e } },
+	/* 0x0000d73f */ { 1, { 0x0000d73f } },
+	/* 0x0000d740 */ { 1, { 0x0000d740 } },
+	/* 0x0000d741 */ { 1, { 0x0000d741 } },
+	/* 0x0000d742 */ { 1, { 0x0000d742 } },
+	/* 0x0000d743 */ { 1, { 0x0000d743 } },
+	/* 0x0000d744 */ { 1, { 0x0000d744 } },
+	/* 0x0000d745 */ { 1, { 0x0000d745 } },
+	/* 0x0000d746 */ { 1, { 0x0000d746 } },
+	/* 0x0000d747 */ { 1, { 0x0000d747 } },
+	/* 0x0000d748 */ { 1, { 0x0000d748 } },
+	/* 0x0000d749 */ { 1, { 0x0000d749 } },
+	/* 0x0000d74a */ { 1, { 0x0000d74a } },
+	/* 0x0000d74b */ { 1, { 0x0000d74b } },
+	/* 0x0000d74c */ { 1, { 0x0000d74c } },
+	/* 0x0000d74d */ { 1, { 0x0000d74d } },
+	/* 0x0000d74e */ { 1, { 0x0000d74e } },
+	/* 0x0000d74f */ { 1, { 0x0000d74f } },
+	/* 0x0000d750 */ { 1, { 0x0000d750 } },
+	/* 0x0000d751 */ { 1, { 0x0000d751 } },
+	/* 0x0000d752 */ { 1, { 0x0000d752 } },
+	/* 0x0000d753 */ { 1, { 0x0000d753 } },
+	/* 0x0000d754 */ { 1, { 0x0000d754 } },
+	/* 0x0000d755 */ { 1, { 0x0000d755 } },
+	/* 0x0000d756 */ { 1, { 0x0000d756 } },
+	/* 0x0000d757 */ { 1, { 0x0000d757 } },
+	/* 0x0000d758 */ { 1, { 0x0000d758 } },
+	/* 0x0000d759 */ { 1, { 0x0000d759 } },
+	/* 0x0000d75a */ { 1, { 0x0000d75a } },
+	/* 0x0000d75b */ { 1, { 0x0000d75b } },
+	/* 0x0000d75c */ { 1, { 0x0000d75c } },
+	/* 0x0000d75d */ { 1, { 0x0000d75d } },
+	/* 0x0000d75e */ { 1, { 0x0000d75e } },
+	/* 0x0000d75f */ { 1, { 0x0000d75f } },
+	/* 0x0000d760 */ { 1, { 0x0000d760 } },
+	/* 0x0000d761 */ { 1, { 0x0000d761 } },
+	/* 0x0000d762 */ { 1, { 0x0000d762 } },
+	/* 0x0000d763 */ { 1, { 0x0000d763 } },
+	/* 0x0000d764 */ { 1, { 0x0000d764 } },
+	/* 0x0000d765 */ { 1, { 0x0000d765 } },
+	/* 0x0000d766 */ { 1, { 0x0000d766 } },
+	/* 0x0000d767 */ { 1, { 0x0000d767 } },
+	/* 0x0000d768 */ { 1, { 0x0000d768 } },
+	/* 0x0000d769 */ { 1, { 0x0000d769 } },
+	/* 0x0000d76a */ { 1, { 0x0000d76a } },
+	/* 0x0000d76b */ { 1, { 0x0000d76b } },
+	/* 0x0000d76c */ { 1, { 0x0000d76c } },
+	/* 0x0000d76d */ { 1, { 0x0000d76d } },
+	/* 0x0000d76e */ { 1, { 0x0000d76e } },
+	/* 0x0000d76f */ { 1, { 0x0000d76f } },
+	/* 0x0000d770 */ { 1, { 0x0000d770 } },
+	/* 0x0000d771 */ { 1, { 0x0000d771 } },
+	/* 0x0000d772 */ { 1, { 0x0000d772 } },
+	/* 0x0000d773 */ { 1, { 0x0000d773 } },
+	/* 0x0000d774 */ { 1, { 0x0000d774 } },
+	/* 0x0000d775 */ { 1, { 0x0000d775 } },
+	/* 0x0000d776 */ { 1, { 0x0000d776 } },
+	/* 0x0000d777 */ { 1, { 0x0000d777 } },
+	/* 0x0000d778 */ { 1, { 0x0000d778 } },
+	/* 0x0000d779 */ { 1, { 0x0000d779 } },
+	/* 0x0000d77a */ { 1, { 0x0000d77a } },
+	/* 0x0000d77b */ { 1, { 0x0000d77b } },
+	/* 0x0000d77c */ { 1, { 0x0000d77c } },
+	/* 0x0000d77d */ { 1, { 0x0000d77d } },
+	/* 0x0000d77e */ { 1, { 0x0000d77e } },
+	/* 0x0000d77f */ { 1, { 0x0000d77f } },
+	/* 0x0000d780 */ { 1, { 0x0000d780 } },
+	/* 0x0000d781 */ { 1, { 0x0000d781 } },
+	/* 0x0000d782 */ { 1, { 0x0000d782 } },
+	/* 0x0000d783 */ { 1, { 0x0000d783 } },
+	/* 0x0000d784 */ { 1, { 0x0000d784 } },
+	/* 0x0000d785 */ { 1, { 0x0000d785 } },
+	/* 0x0000d786 */ { 1, { 0x0000d786 } },
+	/* 0x0000d787 */ { 1, { 0x0000d787 } },
+	/* 0x0000d788 */ { 1, { 0x0000d788 } },
+	/* 0x0000d789 */ { 1, { 0x0000d789 } },
+	/* 0x0000d78a */ { 1, { 0x0000d78a } },
+	/* 0x0000d78b */ { 1, { 0x0000d78b } },
+	/* 0x0000d78c */ { 1, { 0x0000d78c } },
+	/* 0x0000d78d */ { 1, { 0x0000d78d } },
+	/* 0x0000d78e */ { 1, { 0x0000d78e } },
+	/* 0x0000d78f */ { 1, { 0x0000d78f } },
+	/* 0x0000d790 */ { 1, { 0x0000d790 } },
+	/* 0x0000d791 */ { 1, { 0x0000d791 } },
+	/* 0x0000d792 */ { 1, { 0x0000d792 } },
+	/* 0x0000d793 */ { 1, { 0x0000d793 } },
+	/* 0x0000d794 */ { 1, { 0x0000d794 } },
+	/* 0x0000d795 */ { 1, { 0x0000d795 } },
+	/* 0x0000d796 */ { 1, { 0x0000d796 } },
+	/* 0x0000d797 */ { 1, { 0x0000d797 } },
+	/* 0x0000d798 */ { 1, { 0x0000d798 } },
+	/* 0x0000d799 */ { 1, { 0x0000d799 } },
+	/* 0x0000d79a */ { 1, { 0x0000d79a } },
+	/* 0x0000d79b */ { 1, { 0x0000d79b } },
+	/* 0x0000d79c */ { 1, { 0x0000d79c } },
+	/* 0x0000d79d */ { 1, { 0x0000d79d } },
+	/* 0x0000d79e */ { 1, { 0x0000d79e } },
+	/* 0x0000d79f */ { 1, { 0x0000d79f } },
+	/* 0x0000d7a0 */ { 1, { 0x0000d7a0 } },
+	/* 0x0000d7a1 */ { 1, { 0x0000d7a1 } },
+	/* 0x0000d7a2 */ { 1, { 0x0000d7a2 } },
+	/* 0x0000d7a3 */ { 3, { 0x00001112, 0x00001175, 0x000011c2 } },
+	/* 0x0000d7a4 */ { 1, { 0x0000d7a4 } },
+	/* 0x0000d7a5 */ { 1, { 0x0000d7a5 } },
+	/* 0x0000d7a6 */ { 1, { 0x0000d7a6 } },
+	/* 0x0000d7a7 */ { 1, { 0x0000d7a7 } },
+	/* 0x0000d7a8 */ { 1, { 0x0000d7a8 } },
+	/* 0x0000d7a9 */ { 1, { 0x0000d7a9 } },
+	/* 0x0000d7aa */ { 1, { 0x0000d7aa } },
+	/* 0x0000d7ab */ { 1, { 0x0000d7ab } },
+	/* 0x0000d7ac */ { 1, { 0x0000d7ac } },
+	/* 0x0000d7ad */ { 1, { 0x0000d7ad } },
+	/* 0x0000d7ae */ { 1, { 0x0000d7ae } },
+	/* 0x0000d7af */ { 1, { 0x0000d7af } },
+	/* 0x0000d7b0 */ { 1, { 0x0000d7b0 } },
+	/* 0x0000d7b1 */ { 1, { 0x0000d7b1 } },
+	/* 0x0000d7b2 */ { 1, { 0x0000d7b2 } },
+	/* 0x0000d7b3 */ { 1, { 0x0000d7b3 } },
+	/* 0x0000d7b4 */ { 1, { 0x0000d7b4 } },
+	/* 0x0000d7b5 */ { 1, { 0x0000d7b5 } },
+	/* 0x0000d7b6 */ { 1, { 0x0000d7b6 } },
+	/* 0x0000d7b7 */ { 1, { 0x0000d7b7 } },
+	/* 0x0000d7b8 */ { 1, { 0x0000d7b8 } },
+	/* 0x0000d7b9 */ { 1, { 0x0000d7b9 } },
+	/* 0x0000d7ba */ { 1, { 0x0000d7ba } },
+	/* 0x0000d7bb */ { 1, { 0x0000d7bb } },
+	/* 0x0000d7bc */ { 1, { 0x0000d7bc } },
+	/* 0x0000d7bd */ { 1, { 0x0000d7bd } },
+	/* 0x0000d7be */ { 1, { 0x0000d7be } },
+	/* 0x0000d7bf */ { 1, { 0x0000d7bf } },
+	/* 0x0000d7c0 */ { 1, { 0x0000d7c0 } },
+	/* 0x0000d7c1 */ { 1, { 0x0000d7c1 } },
+	/* 0x0000d7c2 */ { 1, { 0x0000d7c2 } },
+	/* 0x0000d7c3 */ { 1, { 0x0000d7c3 } },
+	/* 0x0000d7c4 */ { 1, { 0x0000d7c4 } },
+	/* 0x0000d7c5 */ { 1, { 0x0000d7c5 } },
+	/* 0x0000d7c6 */ { 1, { 0x0000d7c6 } },
+	/* 0x0000d7c7 */ { 1, { 0x0000d7c7 } },
+	/* 0x0000d7c8 */ { 1, { 0x0000d7c8 } },
+	/* 0x0000d7c9 */ { 1, { 0x0000d7c9 } },
+	/* 0x0000d7ca */ { 1, { 0x0000d7ca } },
+	/* 0x0000d7cb */ { 1, { 0x0000d7cb } },
+	/* 0x0000d7cc */ { 1, { 0x0000d7cc } },
+	/* 0x0000d7cd */ { 1, { 0x0000d7cd } },
+	/* 0x0000d7ce */ { 1, { 0x0000d7ce } },
+	/* 0x0000d7cf */ { 1, { 0x0000d7cf } },
+	/* 0x0000d7d0 */ { 1, { 0x0000d7d0 } },
+	/* 0x0000d7d1 */ { 1, { 0x0000d7d1 } },
+	/* 0x0000d7d2 */ { 1, { 0x0000d7d2 } },
+	/* 0x0000d7d3 */ { 1, { 0x0000d7d3 } },
+	/* 0x0000d7d4 */ { 1, { 0x0000d7d4 } },
+	/* 0x0000d7d5 */ { 1, { 0x0000d7d5 } },
+	/* 0x0000d7d6 */ { 1, { 0x0000d7d6 } },
+	/* 0x0000d7d7 */ { 1, { 0x0000d7d7 } },
+	/* 0x0000d7d8 */ { 1, { 0x0000d7d8 } },
+	/* 0x0000d7d9 */ { 1, { 0x0000d7d9 } },
+	/* 0x0000d7da */ { 1, { 0x0000d7da } },
+	/* 0x0000d7db */ { 1, { 0x0000d7db } },
+	/* 0x0000d7dc */ { 1, { 0x0000d7dc } },
+	/* 0x0000d7dd */ { 1, { 0x0000d7dd } },
+	/* 0x0000d7de */ { 1, { 0x0000d7de } },
+	/* 0x0000d7df */ { 1, { 0x0000d7df } },
+	/* 0x0000d7e0 */ { 1, { 0x0000d7e0 } },
+	/* 0x0000d7e1 */ { 1, { 0x0000d7e1 } },
+	/* 0x0000d7e2 */ { 1, { 0x0000d7e2 } },
+	/* 0x0000d7e3 */ { 1, { 0x0000d7e3 } },
+	/* 0x0000d7e4 */ { 1, { 0x0000d7e4 } },
+	/* 0x0000d7e5 */ { 1, { 0x0000d7e5 } },
+	/* 0x0000d7e6 */ { 1, { 0x0000d7e6 } },
+	/* 0x0000d7e7 */ { 1, { 0x0000d7e7 } },
+	/* 0x0000d7e8 */ { 1, { 0x0000d7e8 } },
+	/* 0x0000d7e9 */ { 1, { 0x0000d7e9 } },
+	/* 0x0000d7ea */ { 1, { 0x0000d7ea } },
+	/* 0x0000d7eb */ { 1, { 0x0000d7eb } },
+	/* 0x0000d7ec */ { 1, { 0x0000d7ec } },
+	/* 0x0000d7ed */ { 1, { 0x0000d7ed } },
+	/* 0x0000d7ee */ { 1, { 0x0000d7ee } },
+	/* 0x0000d7ef */ { 1, { 0x0000d7ef } },
+	/* 0x0000d7f0 */ { 1, { 0x0000d7f0 } },
+	/* 0x0000d7f1 */ { 1, { 0x0000d7f1 } },
+	/* 0x0000d7f2 */ { 1, { 0x0000d7f2 } },
+	/* 0x0000d7f3 */ { 1, { 0x0000d7f3 } },
+	/* 0x0000d7f4 */ { 1, { 0x0000d7f4 } },
+	/* 0x0000d7f5 */ { 1, { 0x0000d7f5 } },
+	/* 0x0000d7f6 */ { 1, { 0x0000d7f6 } },
+	/* 0x0000d7f7 */ { 1, { 0x0000d7f7 } },
+	/* 0x0000d7f8 */ { 1, { 0x0000d7f8 } },
+	/* 0x0000d7f9 */ { 1, { 0x0000d7f9 } },
+	/* 0x0000d7fa */ { 1, { 0x0000d7fa } },
+	/* 0x0000d7fb */ { 1, { 0x0000d7fb } },
+	/* 0x0000d7fc */ { 1, { 0x0000d7fc } },
+	/* 0x0000d7fd */ { 1, { 0x0000d7fd } },
+	/* 0x0000d7fe */ { 1, { 0x0000d7fe } },
+	/* 0x0000d7ff */ { 1, { 0x0000d7ff } }
+};
+
+static libfshfs_name_decomposition_mapping_t libfshfs_name_decomposition_mappings_0x0000fb00[ 256 ] = {
+	/* 0x0000fb00 */ { 1, { 0x0000fb00 } },
+	/* 0x0000fb01 */ { 1, { 0x0000fb01 } },
+	/* 0x0000fb02 */ { 1, { 0x0000fb02 } },
+	/* 0x0000fb03 */ { 1, { 0x0000fb03 } },
+	/* 0x0000fb04 */ { 1, { 0x0000fb04 } },
+	/* 0x0000fb05 */ { 1, { 0x0000fb05 } },
+	/* 0x0000fb06 */ { 1, { 0x0000fb06 } },
+	/* 0x0000fb07 */ { 1, { 0x0000fb07 } },
+	/* 0x0000fb08 */ { 1, { 0x0000fb08 } },
+	/* 0x0000fb09 */ { 1, { 0x0000fb09 } },
+	/* 0x0000fb0a */ { 1, { 0x0000fb0a } },
+	/* 0x0000fb0b */ { 1, { 0x0000fb0b } },
+	/* 0x0000fb0c */ { 1, { 0x0000fb0c } },
+	/* 0x0000fb0d */ { 1, { 0x0000fb0d } },
+	/* 0x0000fb0e */ { 1, { 0x0000fb0e } },
+	/* 0x0000fb0f */ { 1, { 0x0000fb0f } },
+	/* 0x0000fb10 */ { 1, { 0x0000fb10 } },
+	/* 0x0000fb11 */ { 1, { 0x0000fb11 } },
+	/* 0x0000fb12 */ { 1, { 0x0000fb12 } },
+	/* 0x0000fb13 */ { 1, { 0x0000fb13 } },
+	/* 0x0000fb14 */ { 1, { 0x0000fb14 } },
+	/* 0x0000fb15 */ { 1, { 0x0000fb15 } },
+	/* 0x0000fb16 */ { 1, { 0x0000fb16 } },
+	/* 0x0000fb17 */ { 1, { 0x0000fb17 } },
+	/* 0x0000fb18 */ { 1, { 0x0000fb18 } },
+	/* 0x0000fb19 */ { 1, { 0x0000fb19 } },
+	/* 0x0000fb1a */ { 1, { 0x0000fb1a } },
+	/* 0x0000fb1b */ { 1, { 0x0000fb1b } },
+	/* 0x0000fb1c */ { 1, { 0x0000fb1c } },
+	/* 0x0000fb1d */ { 2, { 0x000005d9, 0x000005b4 } },
+	/* 0x0000fb1e */ { 1, { 0x0000fb1e } },
+	/* 0x0000fb1f */ { 2, { 0x000005f2, 0x000005b7 } },
+	/* 0x0000fb20 */ { 1, { 0x0000fb20 } },
+	/* 0x0000fb21 */ { 1, { 0x0000fb21 } },
+	/* 0x0000fb22 */ { 1, { 0x0000fb22 } },
+	/* 0x0000fb23 */ { 1, { 0x0000fb23 } },
+	/* 0x0000fb24 */ { 1, { 0x0000fb24 } },
+	/* 0x0000fb25 */ { 1, { 0x0000fb25 } },
+	/* 0x0000fb26 */ { 1, { 0x0000fb26 } },
+	/* 0x0000fb27 */ { 1, { 0x0000fb27 } },
+	/* 0x0000fb28 */ { 1, { 0x0000fb28 } },
+	/* 0x0000fb29 */ { 1, { 0x0000fb29 } },
+	/* 0x0000fb2a */ { 2, { 0x000005e9, 0x000005c1 } },
+	/* 0x0000fb2b */ { 2, { 0x000005e9, 0x000005c2 } },
+	/* 0x0000fb2c */ { 3, { 0x000005e9, 0x000005bc, 0x000005c1 } },
+	/* 0x0000fb2d */ { 3, { 0x000005e9, 0x000005bc, 0x000005c2 } },
+	/* 0x0000fb2e */ { 2, { 0x000005d0, 0x000005b7 } },
+	/* 0x0000fb2f */ { 2, { 0x000005d0, 0x000005b8 } },
+	/* 0x0000fb30 */ { 2, { 0x000005d0, 0x000005bc } },
+	/* 0x0000fb31 */ { 2, { 0x000005d1, 0x000005bc } },
+	/* 0x0000fb32 */ { 2, { 0x000005d2, 0x000005bc } },
+	/* 0x0000fb33 */ { 2, { 0x000005d3, 0x000005bc } },
+	/* 0x0000fb34 */ { 2, { 0x000005d4, 0x000005bc } },
+	/* 0x0000fb35 */ { 2, { 0x000005d5, 0x000005bc } },
+	/* 0x0000fb36 */ { 2, { 0x000005d6, 0x000005bc } },
+	/* 0x0000fb37 */ { 1, { 0x0000fb37 } },
+	/* 0x0000fb38 */ { 2, { 0x000005d8, 0x000005bc } },
+	/* 0x0000fb39 */ { 2, { 0x000005d9, 0x000005bc } },
+	/* 0x0000fb3a */ { 2, { 0x000005da, 0x000005bc } },
+	/* 0x0000fb3b */ { 2, { 0x000005db, 0x000005bc } },
+	/* 0x0000fb3c */ { 2, { 0x000005dc, 0x000005bc } },
+	/* 0x0000fb3d */ { 1, { 0x0000fb3d } },
+	/* 0x0000fb3e */ { 2, { 0x000005de, 0x000005bc } },
+	/* 0x0000fb3f */ { 1, { 0x0000fb3f } },
+	/* 0x0000fb40 */ { 2, { 0x000005e0, 0x000005bc } },
+	/* 0x0000fb41 */ { 2, { 0x000005e1, 0x000005bc } },
+	/* 0x0000fb42 */ { 1, { 0x0000fb42 } },
+	/* 0x0000fb43 */ { 2, { 0x000005e3, 0x000005bc } },
+	/* 0x0000fb44 */ { 2, { 0x000005e4, 0x000005bc } },
+	/* 0x0000fb45 */ { 1, { 0x0000fb45 } },
+	/* 0x0000fb46 */ { 2, { 0x000005e6, 0x000005bc } },
+	/* 0x0000fb47 */ { 2, { 0x000005e7, 0x000005bc } },
+	/* 0x0000fb48 */ { 2, { 0x000005e8, 0x000005bc } },
+	/* 0x0000fb49 */ { 2, { 0x000005e9, 0x000005bc } },
+	/* 0x0000fb4a */ { 2, { 0x000005ea, 0x000005bc } },
+	/* 0x0000fb4b */ { 2, { 0x000005d5, 0x000005b9 } },
+	/* 0x0000fb4c */ { 2, { 0x000005d1, 0x000005bf } },
+	/* 0x0000fb4d */ { 2, { 0x000005db, 0x000005bf } },
+	/* 0x0000fb4e */ { 2, { 0x000005e4, 0x000005bf } },
+	/* 0x0000fb4f */ { 1, { 0x0000fb4f } },
+	/* 0x0000fb50 */ { 1, { 0x0000fb50 } },
+	/* 0x0000fb51 */ { 1, { 0x0000fb51 } },
+	/* 0x0000fb52 */ { 1, { 0x0000fb52 } },
+	/* 0x0000fb53 */ { 1, { 0x0000fb53 } },
+	/* 0x0000fb54 */ { 1, { 0x0000fb54 } },
+	/* 0x0000fb55 */ { 1, { 0x0000fb55 } },
+	/* 0x0000fb56 */ { 1, { 0x0000fb56 } },
+	/* 0x0000fb57 */ { 1, { 0x0000fb57 } },
+	/* 0x0000fb58 */ { 1, { 0x0000fb58 } },
+	/* 0x0000fb59 */ { 1, { 0x0000fb59 } },
+	/* 0x0000fb5a */ { 1, { 0x0000fb5a } },
+	/* 0x0000fb5b */ { 1, { 0x0000fb5b } },
+	/* 0x0000fb5c */ { 1, { 0x0000fb5c } },
+	/* 0x0000fb5d */ { 1, { 0x0000fb5d } },
+	/* 0x0000fb5e */ { 1, { 0x0000fb5e } },
+	/* 0x0000fb5f */ { 1, { 0x0000fb5f } },
+	/* 0x0000fb60 */ { 1, { 0x0000fb60 } },
+	/* 0x0000fb61 */ { 1, { 0x0000fb61 } },
+	/* 0x0000fb62 */ { 1, { 0x0000fb62 } },
+	/* 0x0000fb63 */ { 1, { 0x0000fb63 } },
+	/* 0x0000fb64 */ { 1, { 0x0000fb64 } },
+	/* 0x0000fb65 */ { 1, { 0x0000fb65 } },
+	/* 0x0000fb66 */ { 1, { 0x0000fb66 } },
+	/* 0x0000fb67 */ { 1, { 0x0000fb67 } },
+	/* 0x0000fb68 */ { 1, { 0x0000fb68 } },
+	/* 0x0000fb69 */ { 1, { 0x0000fb69 } },
+	/* 0x0000fb6a */ { 1, { 0x0000fb6a } },
+	/* 0x0000fb6b */ { 1, { 0x0000fb6b } },
+	/* 0x0000fb6c */ { 1, { 0x0000fb6c } },
+	/* 0x0000fb6d */ { 1, { 0x0000fb6d } },
+	/* 0x0000fb6e */ { 1, { 0x0000fb6e } },
+	/* 0x0000fb6f */ { 1, { 0x0000fb6f } },
+	/* 0x0000fb70 */ { 1, { 0x0000fb70 } },
+	/* 0x0000fb71 */ { 1, { 0x0000fb71 } },
+	/* 0x0000fb72 */ { 1, { 0x0000fb72 } },
+	/* 0x0000fb73 */ { 1, { 0x0000fb73 } },
+	/* 0x0000fb74 */ { 1, { 0x0000fb74 } },
+	/* 0x0000fb75 */ { 1, { 0x0000fb75 } },
+	/* 0x0000fb76 */ { 1, { 0x0000fb76 } },
+	/* 0x0000fb77 */ { 1, { 0x0000fb77 } },
+	/* 0x0000fb78 */ { 1, { 0x0000fb78 } },
+	/* 0x0000fb79 */ { 1, { 0x0000fb79 } },
+	/* 0x0000fb7a */ { 1, { 0x0000fb7a } },
+	/* 0x0000fb7b */ { 1, { 0x0000fb7b } },
+	/* 0x0000fb7c */ { 1, { 0x0000fb7c } },
+	/* 0x0000fb7d */ { 1, { 0x0000fb7d } },
+	/* 0x0000fb7e */ { 1, { 0x0000fb7e } },
+	/* 0x0000fb7f */ { 1, { 0x0000fb7f } },
+	/* 0x0000fb80 */ { 1, { 0x0000fb80 } },
+	/* 0x0000fb81 */ { 1, { 0x0000fb81 } },
+	/* 0x0000fb82 */ { 1, { 0x0000fb82 } },
+	/* 0x0000fb83 */ { 1, { 0x0000fb83 } },
+	/* 0x0000fb84 */ { 1, { 0x0000fb84 } },
+	/* 0x0000fb85 */ { 1, { 0x0000fb85 } },
+	/* 0x0000fb86 */ { 1, { 0x0000fb86 } },
+	/* 0x0000fb87 */ { 1, { 0x0000fb87 } },
+	/* 0x0000fb88 */ { 1, { 0x0000fb88 } },
+	/* 0x0000fb89 */ { 1, { 0x0000fb89 } },
+	/* 0x0000fb8a */ { 1, { 0x0000fb8a } },
+	/* 0x0000fb8b */ { 1, { 0x0000fb8b } },
+	/* 0x0000fb8c */ { 1, { 0x0000fb8c } },
+	/* 0x0000fb8d */ { 1, { 0x0000fb8d } },
+	/* 0x0000fb8e */ { 1, { 0x0000fb8e } },
+	/* 0x0000fb8f */ { 1, { 0x0000fb8f } },
+	/* 0x0000fb90 */ { 1, { 0x0000fb90 } },
+	/* 0x0000fb91 */ { 1, { 0x0000fb91 } },
+	/* 0x0000fb92 */ { 1, { 0x0000fb92 } },
+	/* 0x0000fb93 */ { 1, { 0x0000fb93 } },
+	/* 0x0000fb94 */ { 1, { 0x0000fb94 } },
+	/* 0x0000fb95 */ { 1, { 0x0000fb95 } },
+	/* 0x0000fb96 */ { 1, { 0x0000fb96 } },
+	/* 0x0000fb97 */ { 1, { 0x0000fb97 } },
+	/* 0x0000fb98 */ { 1, { 0x0000fb98 } },
+	/* 0x0000fb99 */ { 1, { 0x0000fb99 } },
+	/* 0x0000fb9a */ { 1, { 0x0000fb9a } },
+	/* 0x0000fb9b */ { 1, { 0x0000fb9b } },
+	/* 0x0000fb9c */ { 1, { 0x0000fb9c } },
+	/* 0x0000fb9d */ { 1, { 0x0000fb9d } },
+	/* 0x0000fb9e */ { 1, { 0x0000fb9e } },
+	/* 0x0000fb9f */ { 1, { 0x0000fb9f } },
+	/* 0x0000fba0 */ { 1, { 0x0000fba0 } },
+	/* 0x0000fba1 */ { 1, { 0x0000fba1 } },
+	/* 0x0000fba2 */ { 1, { 0x0000fba2 } },
+	/* 0x0000fba3 */ { 1, { 0x0000fba3 } },
+	/* 0x0000fba4 */ { 1, { 0x0000fba4 } },
+	/* 0x0000fba5 */ { 1, { 0x0000fba5 } },
+	/* 0x0000fba6 */ { 1, { 0x0000fba6 } },
+	/* 0x0000fba7 */ { 1, { 0x0000fba7 } },
+	/* 0x0000fba8 */ { 1, { 0x0000fba8 } },
+	/* 0x0000fba9 */ { 1, { 0x0000fba9 } },
+	/* 0x0000fbaa */ { 1, { 0x0000fbaa } },
+	/* 0x0000fbab */ { 1, { 0x0000fbab } },
+	/* 0x0000fbac */ { 1, { 0x0000fbac } },
+	/* 0x0000fbad */ { 1, { 0x0000fbad } },
+	/* 0x0000fbae */ { 1, { 0x0000fbae } },
+	/* 0x0000fbaf */ { 1, { 0x0000fbaf } },
+	/* 0x0000fbb0 */ { 1, { 0x0000fbb0 } },
+	/* 0x0000fbb1 */ { 1, { 0x0000fbb1 } },
+	/* 0x0000fbb2 */ { 1, { 0x0000fbb2 } },
+	/* 0x0000fbb3 */ { 1, { 0x0000fbb3 } },
+	/* 0x0000fbb4 */ { 1, { 0x0000fbb4 } },
+	/* 0x0000fbb5 */ { 1, { 0x0000fbb5 } },
+	/* 0x0000fbb6 */ { 1, { 0x0000fbb6 } },
+	/* 0x0000fbb7 */ { 1, { 0x0000fbb7 } },
+	/* 0x0000fbb8 */ { 1, { 0x0000fbb8 } },
+	/* 0x0000fbb9 */ { 1, { 0x0000fbb9 } },
+	/* 0x0000fbba */ { 1, { 0x0000fbba } },
+	/* 0x0000fbbb */ { 1, { 0x0000fbbb } },
+	/* 0x0000fbbc */ { 1, { 0x0000fbbc } },
+	/* 0x0000fbbd */ { 1, { 0x0000fbbd } },
+	/* 0x0000fbbe */ { 1, { 0x0000fbbe } },
+	/* 0x0000fbbf */ { 1, { 0x0000fbbf } },
+	/* 0x0000fbc0 */ { 1, { 0x0000fbc0 } },
+	/* 0x0000fbc1 */ { 1, { 0x0000fbc1 } },
+	/* 0x0000fbc2 */ { 1, { 0x0000fbc2 } },
+	/* 0x0000fbc3 */ { 1, { 0x0000fbc3 } },
+	/* 0x0000fbc4 */ { 1, { 0x0000fbc4 } },
+	/* 0x0000fbc5 */ { 1, { 0x0000fbc5 } },
+	/* 0x0000fbc6 */ { 1, { 0x0000fbc6 } },
+	/* 0x0000fbc7 */ { 1, { 0x0000fbc7 } },
+	/* 0x0000fbc8 */ { 1, { 0x0000fbc8 } },
+	/* 0x0000fbc9 */ { 1, { 0x0000fbc9 } },
+	/* 0x0000fbca */ { 1, { 0x0000fbca } },
+	/* 0x0000fbcb */ { 1, { 0x0000fbcb } },
+	/* 0x0000fbcc */ { 1, { 0x0000fbcc } },
+	/* 0x0000fbcd */ { 1, { 0x0000fbcd } },
+	/* 0x0000fbce */ { 1, { 0x0000fbce } },
+	/* 0x0000fbcf */ { 1, { 0x0000fbcf } },
+	/* 0x0000fbd0 */ { 1, { 0x0000fbd0 } },
+	/* 0x0000fbd1 */ { 1, { 0x0000fbd1 } },
+	/* 0x0000fbd2 */ { 1, { 0x0000fbd2 } },
+	/* 0x0000fbd3 */ { 1, { 0x0000fbd3 } },
+	/* 0x0000fbd4 */ { 1, { 0x0000fbd4 } },
+	/* 0x0000fbd5 */ { 1, { 0x0000fbd5 } },
+	/* 0x0000fbd6 */ { 1, { 0x0000fbd6 } },
+	/* 0x0000fbd7 */ { 1, { 0x0000fbd7 } },
+	/* 0x0000fbd8 */ { 1, { 0x0000fbd8 } },
+	/* 0x0000fbd9 */ { 1, { 0x0000fbd9 } },
+	/* 0x0000fbda */ { 1, { 0x0000fbda } },
+	/* 0x0000fbdb */ { 1, { 0x0000fbdb } },
+	/* 0x0000fbdc */ { 1, { 0x0000fbdc } },
+	/* 0x0000fbdd */ { 1, { 0x0000fbdd } },
+	/* 0x0000fbde */ { 1, { 0x0000fbde } },
+	/* 0x0000fbdf */ { 1, { 0x0000fbdf } },
+	/* 0x0000fbe0 */ { 1, { 0x0000fbe0 } },
+	/* 0x0000fbe1 */ { 1, { 0x0000fbe1 } },
+	/* 0x0000fbe2 */ { 1, { 0x0000fbe2 } },
+	/* 0x0000fbe3 */ { 1, { 0x0000fbe3 } },
+	/* 0x0000fbe4 */ { 1, { 0x0000fbe4 } },
+	/* 0x0000fbe5 */ { 1, { 0x0000fbe5 } },
+	/* 0x0000fbe6 */ { 1, { 0x0000fbe6 } },
+	/* 0x0000fbe7 */ { 1, { 0x0000fbe7 } },
+	/* 0x0000fbe8 */ { 1, { 0x0000fbe8 } },
+	/* 0x0000fbe9 */ { 1, { 0x0000fbe9 } },
+	/* 0x0000fbea */ { 1, { 0x0000fbea } },
+	/* 0x0000fbeb */ { 1, { 0x0000fbeb } },
+	/* 0x0000fbec */ { 1, { 0x0000fbec } },
+	/* 0x0000fbed */ { 1, { 0x0000fbed } },
+	/* 0x0000fbee */ { 1, { 0x0000fbee } },
+	/* 0x0000fbef */ { 1, { 0x0000fbef } },
+	/* 0x0000fbf0 */ { 1, { 0x0000fbf0 } },
+	/* 0x0000fbf1 */ { 1, { 0x0000fbf1 } },
+	/* 0x0000fbf2 */ { 1, { 0x0000fbf2 } },
+	/* 0x0000fbf3 */ { 1, { 0x0000fbf3 } },
+	/* 0x0000fbf4 */ { 1, { 0x0000fbf4 } },
+	/* 0x0000fbf5 */ { 1, { 0x0000fbf5 } },
+	/* 0x0000fbf6 */ { 1, { 0x0000fbf6 } },
+	/* 0x0000fbf7 */ { 1, { 0x0000fbf7 } },
+	/* 0x0000fbf8 */ { 1, { 0x0000fbf8 } },
+	/* 0x0000fbf9 */ { 1, { 0x0000fbf9 } },
+	/* 0x0000fbfa */ { 1, { 0x0000fbfa } },
+	/* 0x0000fbfb */ { 1, { 0x0000fbfb } },
+	/* 0x0000fbfc */ { 1, { 0x0000fbfc } },
+	/* 0x0000fbfd */ { 1, { 0x0000fbfd } },
+	/* 0x0000fbfe */ { 1, { 0x0000fbfe } },
+	/* 0x0000fbff */ { 1, { 0x0000fbff } }
+};
+
+libfshfs_name_decomposition_mapping_t *libfshfs_name_decomposition_mappings[ 252 ] = {
+	/* 0x00000000 */ libfshfs_name_decomposition_mappings_0x00000000,
+	/* 0x00000100 */ libfshfs_name_decomposition_mappings_0x00000100,
+	/* 0x00000200 */ libfshfs_name_decomposition_mappings_0x00000200,
+	/* 0x00000300 */ libfshfs_name_decomposition_mappings_0x00000300,
+	/* 0x00000400 */ libfshfs_name_decomposition_mappings_0x00000400,
+	/* 0x00000500 */ NULL,
+	/* 0x00000600 */ libfshfs_name_decomposition_mappings_0x00000600,
+	/* 0x00000700 */ NULL,
+	/* 0x00000800 */ NULL,
+	/* 0x00000900 */ libfshfs_name_decomposition_mappings_0x00000900,
+	/* 0x00000a00 */ libfshfs_name_decomposition_mappings_0x00000a00,
+	/* 0x00000b00 */ libfshfs_name_decomposition_mappings_0x00000b00,
+	/* 0x00000c00 */ libfshfs_name_decomposition_mappings_0x00000c00,
+	/* 0x00000d00 */ libfshfs_name_decomposition_mappings_0x00000d00,
+	/* 0x00000e00 */ NULL,
+	/* 0x00000f00 */ libfshfs_name_decomposition_mappings_0x00000f00,
+	/* 0x00001000 */ libfshfs_name_decomposition_mappings_0x00001000,
+	/* 0x00001100 */ NULL,
+	/* 0x00001200 */ NULL,
+	/* 0x00001300 */ NULL,
+	/* 0x00001400 */ NULL,
+	/* 0x00001500 */ NULL,
+	/* 0x00001600 */ NULL,
+	/* 0x00001700 */ NULL,
+	/* 0x00001800 */ NULL,
+	/* 0x00001900 */ NULL,
+	/* 0x00001a00 */ NULL,
+	/* 0x00001b00 */ NULL,
+	/* 0x00001c00 */ NULL,
+	/* 0x00001d00 */ NULL,
+	/* 0x00001e00 */ libfshfs_name_decomposition_mappings_0x00001e00,
+	/* 0x00001f00 */ libfshfs_name_decomposition_mappings_0x00001f00,
+	/* 0x00002000 */ NULL,
+	/* 0x00002100 */ NULL,
+	/* 0x00002200 */ NULL,
+	/* 0x00002300 */ NULL,
+	/* 0x00002400 */ NULL,
+	/* 0x00002500 */ NULL,
+	/* 0x00002600 */ NULL,
+	/* 0x00002700 */ NULL,
+	/* 0x00002800 */ NULL,
+	/* 0x00002900 */ NULL,
+	/* 0x00002a00 */ NULL,
+	/* 0x00002b00 */ NULL,
+	/* 0x00002c00 */ NULL,
+	/* 0x00002d00 */ NULL,
+	/* 0x00002e00 */ NULL,
+	/* 0x00002f00 */ NULL,
+	/* 0x00003000 */ libfshfs_name_decomposition_mappings_0x00003000,
+	/* 0x00003100 */ NULL,
+	/* 0x00003200 */ NULL,
+	/* 0x00003300 */ NULL,
+	/* 0x00003400 */ NULL,
+	/* 0x00003500 */ NULL,
+	/* 0x00003600 */ NULL,
+	/* 0x00003700 */ NULL,
+	/* 0x00003800 */ NULL,
+	/* 0x00003900 */ NULL,
+	/* 0x00003a00 */ NULL,
+	/* 0x00003b00 */ NULL,
+	/* 0x00003c00 */ NULL,
+	/* 0x00003d00 */ NULL,
+	/* 0x00003e00 */ NULL,
+	/* 0x00003f00 */ NULL,
+	/* 0x00004000 */ NULL,
+	/* 0x00004100 */ NULL,
+	/* 0x00004200 */ NULL,
+	/* 0x00004300 */ NULL,
+	/* 0x00004400 */ NULL,
+	/* 0x00004500 */ NULL,
+	/* 0x00004600 */ NULL,
+	/* 0x00004700 */ NULL,
+	/* 0x00004800 */ NULL,
+	/* 0x00004900 */ NULL,
+	/* 0x00004a00 */ NULL,
+	/* 0x00004b00 */ NULL,
+	/* 0x00004c00 */ NULL,
+	/* 0x00004d00 */ NULL,
+	/* 0x00004e00 */ NULL,
+	/* 0x00004f00 */ NULL,
+	/* 0x00005000 */ NULL,
+	/* 0x00005100 */ NULL,
+	/* 0x00005200 */ NULL,
+	/* 0x00005300 */ NULL,
+	/* 0x00005400 */ NULL,
+	/* 0x00005500 */ NULL,
+	/* 0x00005600 */ NULL,
+	/* 0x00005700 */ NULL,
+	/* 0x00005800 */ NULL,
+	/* 0x00005900 */ NULL,
+	/* 0x00005a00 */ NULL,
+	/* 0x00005b00 */ NULL,
+	/* 0x00005c00 */ NULL,
+	/* 0x00005d00 */ NULL,
+	/* 0x00005e00 */ NULL,
+	/* 0x00005f00 */ NULL,
+	/* 0x00006000 */ NULL,
+	/* 0x00006100 */ NULL,
+	/* 0x00006200 */ NULL,
+	/* 0x00006300 */ NULL,
+	/* 0x00006400 */ NULL,
+	/* 0x00006500 */ NULL,
+	/* 0x00006600 */ NULL,
+	/* 0x00006700 */ NULL,
+	/* 0x00006800 */ NULL,
+	/* 0x00006900 */ NULL,
+	/* 0x00006a00 */ NULL,
+	/* 0x00006b00 */ NULL,
+	/* 0x00006c00 */ NULL,
+	/* 0x00006d00 */ NULL,
+	/* 0x00006e00 */ NULL,
+	/* 0x00006f00 */ NULL,
+	/* 0x00007000 */ NULL,
+	/* 0x00007100 */ NULL,
+	/* 0x00007200 */ NULL,
+	/* 0x00007300 */ NULL,
+	/* 0x00007400 */ NULL,
+	/* 0x00007500 */ NULL,
+	/* 0x00007600 */ NULL,
+	/* 0x00007700 */ NULL,
+	/* 0x00007800 */ NULL,
+	/* 0x00007900 */ NULL,
+	/* 0x00007a00 */ NULL,
+	/* 0x00007b00 */ NULL,
+	/* 0x00007c00 */ NULL,
+	/* 0x00007d00 */ NULL,
+	/* 0x00007e00 */ NULL,
+	/* 0x00007f00 */ NULL,
+	/* 0x00008000 */ NULL,
+	/* 0x00008100 */ NULL,
+	/* 0x00008200 */ NULL,
+	/* 0x00008300 */ NULL,
+	/* 0x00008400 */ NULL,
+	/* 0x00008500 */ NULL,
+	/* 0x00008600 */ NULL,
+	/* 0x00008700 */ NULL,
+	/* 0x00008800 */ NULL,
+	/* 0x00008900 */ NULL,
+	/* 0x00008a00 */ NULL,
+	/* 0x00008b00 */ NULL,
+	/* 0x00008c00 */ NULL,
+	/* 0x00008d00 */ NULL,
+	/* 0x00008e00 */ NULL,
+	/* 0x00008f00 */ NULL,
+	/* 0x00009000 */ NULL,
+	/* 0x00009100 */ NULL,
+	/* 0x00009200 */ NULL,
+	/* 0x00009300 */ NULL,
+	/* 0x00009400 */ NULL,
+	/* 0x00009500 */ NULL,
+	/* 0x00009600 */ NULL,
+	/* 0x00009700 */ NULL,
+	/* 0x00009800 */ NULL,
+	/* 0x00009900 */ NULL,
+	/* 0x00009a00 */ NULL,
+	/* 0x00009b00 */ NULL,
+	/* 0x00009c00 */ NULL,
+	/* 0x00009d00 */ NULL,
+	/* 0x00009e00 */ NULL,
+	/* 0x00009f00 */ NULL,
+	/* 0x0000a000 */ NULL,
+	/* 0x0000a100 */ NULL,
+	/* 0x0000a200 */ NULL,
+	/* 0x0000a300 */ NULL,
+	/* 0x0000a400 */ NULL,
+	/* 0x0000a500 */ NULL,
+	/* 0x0000a600 */ NULL,
+	/* 0x0000a700 */ NULL,
+	/* 0x0000a800 */ NULL,
+	/* 0x0000a900 */ NULL,
+	/* 0x0000aa00 */ NULL,
+	/* 0x0000ab00 */ NULL,
+	/* 0x0000ac00 */ libfshfs_name_decomposition_mappings_0x0000ac00,
+	/* 0x0000ad00 */ NULL,
+	/* 0x0000ae00 */ NULL,
+	/* 0x0000af00 */ NULL,
+	/* 0x0000b000 */ NULL,
+	/* 0x0000b100 */ NULL,
+	/* 0x0000b200 */ NULL,
+	/* 0x0000b300 */ NULL,
+	/* 0x0000b400 */ NULL,
+	/* 0x0000b500 */ NULL,
+	/* 0x0000b600 */ NULL,
+	/* 0x0000b700 */ NULL,
+	/* 0x0000b800 */ NULL,
+	/* 0x0000b900 */ NULL,
+	/* 0x0000ba00 */ NULL,
+	/* 0x0000bb00 */ NULL,
+	/* 0x0000bc00 */ NULL,
+	/* 0x0000bd00 */ NULL,
+	/* 0x0000be00 */ NULL,
+	/* 0x0000bf00 */ NULL,
+	/* 0x0000c000 */ NULL,
+	/* 0x0000c100 */ NULL,
+	/* 0x0000c200 */ NULL,
+	/* 0x0000c300 */ NULL,
+	/* 0x0000c400 */ NULL,
+	/* 0x0000c500 */ NULL,
+	/* 0x0000c600 */ NULL,
+	/* 0x0000c700 */ NULL,
+	/* 0x0000c800 */ NULL,
+	/* 0x0000c900 */ NULL,
+	/* 0x0000ca00 */ NULL,
+	/* 0x0000cb00 */ NULL,
+	/* 0x0000cc00 */ NULL,
+	/* 0x0000cd00 */ NULL,
+	/* 0x0000ce00 */ NULL,
+	/* 0x0000cf00 */ NULL,
+	/* 0x0000d000 */ NULL,
+	/* 0x0000d100 */ NULL,
+	/* 0x0000d200 */ NULL,
+	/* 0x0000d300 */ NULL,
+	/* 0x0000d400 */ NULL,
+	/* 0x0000d500 */ NULL,
+	/* 0x0000d600 */ NULL,
+	/* 0x0000d700 */ libfshfs_name_decomposition_mappings_0x0000d700,
+	/* 0x0000d800 */ NULL,
+	/* 0x0000d900 */ NULL,
+	/* 0x0000da00 */ NULL,
+	/* 0x0000db00 */ NULL,
+	/* 0x0000dc00 */ NULL,
+	/* 0x0000dd00 */ NULL,
+	/* 0x0000de00 */ NULL,
+	/* 0x0000df00 */ NULL,
+	/* 0x0000e000 */ NULL,
+	/* 0x0000e100 */ NULL,
+	/* 0x0000e200 */ NULL,
+	/* 0x0000e300 */ NULL,
+	/* 0x0000e400 */ NULL,
+	/* 0x0000e500 */ NULL,
+	/* 0x0000e600 */ NULL,
+	/* 0x0000e700 */ NULL,
+	/* 0x0000e800 */ NULL,
+	/* 0x0000e900 */ NULL,
+	/* 0x0000ea00 */ NULL,
+	/* 0x0000eb00 */ NULL,
+	/* 0x0000ec00 */ NULL,
+	/* 0x0000ed00 */ NULL,
+	/* 0x0000ee00 */ NULL,
+	/* 0x0000ef00 */ NULL,
+	/* 0x0000f000 */ NULL,
+	/* 0x0000f100 */ NULL,
+	/* 0x0000f200 */ NULL,
+	/* 0x0000f300 */ NULL,
+	/* 0x0000f400 */ NULL,
+	/* 0x0000f500 */ NULL,
+	/* 0x0000f600 */ NULL,
+	/* 0x0000f700 */ NULL,
+	/* 0x0000f800 */ NULL,
+	/* 0x0000f900 */ NULL,
+	/* 0x0000fa00 */ NULL,
+	/* 0x0000fb00 */ libfshfs_name_decomposition_mappings_0x0000fb00
+};
+
@@ -0,0 +1,70 @@
+/*
+ * Name case folding and decomposition mappings
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/* This file was generated by generate_name_mappings.py, do not edit
+ */
+
+#if !defined( _LIBFSHFS_NAME_MAPPINGS_H )
+#define _LIBFSHFS_NAME_MAPPINGS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfshfs_extern.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define LIBFSHFS_NAME_CASE_FOLDING_MAPPINGS_NUMBER_OF_PAGES		0x01eaUL
+#define LIBFSHFS_NAME_DECOMPOSITION_MAPPINGS_NUMBER_OF_PAGES		0x00fcUL
+
+typedef struct libfshfs_name_decomposition_mapping libfshfs_name_decomposition_mapping_t;
+
+struct libfshfs_name_decomposition_mapping
+{
+	/* The number of characters
+	 */
+	uint8_t number_of_characters;
+
+	/* The characters
+	 */
+	uint32_t characters[ 4 ];
+};
+
+/* The case folding mappings, per page of 256 characters, where a page
+ * without mappings is NULL
+ */
+LIBFSHFS_EXTERN_VARIABLE \
+uint32_t *libfshfs_name_case_folding_mappings[ 490 ];
+
+/* The decomposition mappings, per page of 256 characters, where a page
+ * without mappings is NULL
+ */
+LIBFSHFS_EXTERN_VARIABLE \
+libfshfs_name_decomposition_mapping_t *libfshfs_name_decomposition_mappings[ 252 ];
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSHFS_NAME_MAPPINGS_H ) */
+
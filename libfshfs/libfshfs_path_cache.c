@@ -0,0 +1,484 @@
+/*
+ * Path cache functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfshfs_libcerror.h"
+#include "libfshfs_path_cache.h"
+
+/* Determines the index of the path cache entry of a specific parent identifier and name hash
+ */
+#define libfshfs_path_cache_get_entry_index( path_cache, parent_identifier, name_hash ) \
+	(int) ( ( (uint32_t) ( name_hash ) ^ (uint32_t) ( ( parent_identifier ) * 0x9e3779b1UL ) ) % (uint32_t) ( path_cache )->number_of_entries )
+
+/* Creates a path cache
+ * Make sure the value path_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_path_cache_initialize(
+     libfshfs_path_cache_t **path_cache,
+     int number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_path_cache_initialize";
+	size_t entries_size   = 0;
+
+	if( path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid path cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries <= 0 )
+	 || ( (size_t) number_of_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfshfs_path_cache_entry_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*path_cache = memory_allocate_structure(
+	               libfshfs_path_cache_t );
+
+	if( *path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *path_cache,
+	     0,
+	     sizeof( libfshfs_path_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear path cache.",
+		 function );
+
+		memory_free(
+		 *path_cache );
+
+		*path_cache = NULL;
+
+		return( -1 );
+	}
+	entries_size = sizeof( libfshfs_path_cache_entry_t ) * number_of_entries;
+
+	( *path_cache )->entries = (libfshfs_path_cache_entry_t *) memory_allocate(
+	                                                            entries_size );
+
+	if( ( *path_cache )->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *path_cache )->entries,
+	     0,
+	     entries_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entries.",
+		 function );
+
+		goto on_error;
+	}
+	( *path_cache )->number_of_entries = number_of_entries;
+
+	return( 1 );
+
+on_error:
+	if( *path_cache != NULL )
+	{
+		if( ( *path_cache )->entries != NULL )
+		{
+			memory_free(
+			 ( *path_cache )->entries );
+		}
+		memory_free(
+		 *path_cache );
+
+		*path_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a path cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_path_cache_free(
+     libfshfs_path_cache_t **path_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_path_cache_free";
+	int entry_index       = 0;
+	int result            = 1;
+
+	if( path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path_cache != NULL )
+	{
+		if( ( *path_cache )->entries != NULL )
+		{
+			for( entry_index = 0;
+			     entry_index < ( *path_cache )->number_of_entries;
+			     entry_index++ )
+			{
+				if( libfshfs_path_cache_entry_clear(
+				     &( ( *path_cache )->entries[ entry_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to clear entry: %d.",
+					 function,
+					 entry_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *path_cache )->entries );
+		}
+		memory_free(
+		 *path_cache );
+
+		*path_cache = NULL;
+	}
+	return( result );
+}
+
+/* Clears a path cache entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_path_cache_entry_clear(
+     libfshfs_path_cache_entry_t *path_cache_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_path_cache_entry_clear";
+
+	if( path_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_cache_entry->name != NULL )
+	{
+		memory_free(
+		 path_cache_entry->name );
+	}
+	path_cache_entry->parent_identifier = 0;
+	path_cache_entry->name_hash         = 0;
+	path_cache_entry->name_type         = 0;
+	path_cache_entry->name              = NULL;
+	path_cache_entry->name_size         = 0;
+	path_cache_entry->identifier        = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the cached identifier of a specific parent identifier and name
+ * The name must be the same encoded string as used to set the entry
+ * The identifier is set to 0 if the name is cached as not found
+ * Returns 1 if successful, 0 if not cached or -1 on error
+ */
+int libfshfs_path_cache_get_identifier(
+     libfshfs_path_cache_t *path_cache,
+     uint32_t parent_identifier,
+     uint32_t name_hash,
+     uint8_t name_type,
+     const uint8_t *name,
+     size_t name_size,
+     uint32_t *identifier,
+     libcerror_error_t **error )
+{
+	libfshfs_path_cache_entry_t *path_cache_entry = NULL;
+	static char *function                         = "libfshfs_path_cache_get_identifier";
+	int entry_index                               = 0;
+
+	if( path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_cache->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid path cache - missing entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier.",
+		 function );
+
+		return( -1 );
+	}
+	entry_index = libfshfs_path_cache_get_entry_index(
+	               path_cache,
+	               parent_identifier,
+	               name_hash );
+
+	path_cache_entry = &( path_cache->entries[ entry_index ] );
+
+	if( ( path_cache_entry->name == NULL )
+	 || ( path_cache_entry->parent_identifier != parent_identifier )
+	 || ( path_cache_entry->name_hash != name_hash )
+	 || ( path_cache_entry->name_type != name_type )
+	 || ( path_cache_entry->name_size != name_size ) )
+	{
+		return( 0 );
+	}
+	if( memory_compare(
+	     path_cache_entry->name,
+	     name,
+	     name_size ) != 0 )
+	{
+		return( 0 );
+	}
+	*identifier = path_cache_entry->identifier;
+
+	return( 1 );
+}
+
+/* Sets the cached identifier of a specific parent identifier and name
+ * An identifier of 0 indicates the name was not found
+ * The entry replaces the entry previously cached in the same slot
+ * Only the name and identifiers are cached, hence no B-tree node is kept referenced
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_path_cache_set_identifier(
+     libfshfs_path_cache_t *path_cache,
+     uint32_t parent_identifier,
+     uint32_t name_hash,
+     uint8_t name_type,
+     const uint8_t *name,
+     size_t name_size,
+     uint32_t identifier,
+     libcerror_error_t **error )
+{
+	libfshfs_path_cache_entry_t *path_cache_entry = NULL;
+	static char *function                         = "libfshfs_path_cache_set_identifier";
+	int entry_index                               = 0;
+
+	if( path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_cache->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid path cache - missing entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_size == 0 )
+	 || ( name_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	entry_index = libfshfs_path_cache_get_entry_index(
+	               path_cache,
+	               parent_identifier,
+	               name_hash );
+
+	path_cache_entry = &( path_cache->entries[ entry_index ] );
+
+	if( libfshfs_path_cache_entry_clear(
+	     path_cache_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear entry: %d.",
+		 function,
+		 entry_index );
+
+		goto on_error;
+	}
+	path_cache_entry->name = (uint8_t *) memory_allocate(
+	                                      sizeof( uint8_t ) * name_size );
+
+	if( path_cache_entry->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     path_cache_entry->name,
+	     name,
+	     name_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		goto on_error;
+	}
+	path_cache_entry->parent_identifier = parent_identifier;
+	path_cache_entry->name_hash         = name_hash;
+	path_cache_entry->name_type         = name_type;
+	path_cache_entry->name_size         = name_size;
+	path_cache_entry->identifier        = identifier;
+
+	return( 1 );
+
+on_error:
+	libfshfs_path_cache_entry_clear(
+	 path_cache_entry,
+	 NULL );
+
+	return( -1 );
+}
+
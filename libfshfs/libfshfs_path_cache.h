@@ -0,0 +1,114 @@
+/*
+ * Path cache functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSHFS_PATH_CACHE_H )
+#define _LIBFSHFS_PATH_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfshfs_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfshfs_path_cache_entry libfshfs_path_cache_entry_t;
+
+struct libfshfs_path_cache_entry
+{
+	/* The parent identifier (CNID)
+	 */
+	uint32_t parent_identifier;
+
+	/* The (case folded) name hash
+	 */
+	uint32_t name_hash;
+
+	/* The name type
+	 */
+	uint8_t name_type;
+
+	/* The name
+	 */
+	uint8_t *name;
+
+	/* The name size
+	 */
+	size_t name_size;
+
+	/* The identifier (CNID) of the entry with the name or 0 if the name was not found
+	 */
+	uint32_t identifier;
+};
+
+typedef struct libfshfs_path_cache libfshfs_path_cache_t;
+
+struct libfshfs_path_cache
+{
+	/* The entries
+	 */
+	libfshfs_path_cache_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+};
+
+int libfshfs_path_cache_initialize(
+     libfshfs_path_cache_t **path_cache,
+     int number_of_entries,
+     libcerror_error_t **error );
+
+int libfshfs_path_cache_free(
+     libfshfs_path_cache_t **path_cache,
+     libcerror_error_t **error );
+
+int libfshfs_path_cache_entry_clear(
+     libfshfs_path_cache_entry_t *path_cache_entry,
+     libcerror_error_t **error );
+
+int libfshfs_path_cache_get_identifier(
+     libfshfs_path_cache_t *path_cache,
+     uint32_t parent_identifier,
+     uint32_t name_hash,
+     uint8_t name_type,
+     const uint8_t *name,
+     size_t name_size,
+     uint32_t *identifier,
+     libcerror_error_t **error );
+
+int libfshfs_path_cache_set_identifier(
+     libfshfs_path_cache_t *path_cache,
+     uint32_t parent_identifier,
+     uint32_t name_hash,
+     uint8_t name_type,
+     const uint8_t *name,
+     size_t name_size,
+     uint32_t identifier,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSHFS_PATH_CACHE_H ) */
+
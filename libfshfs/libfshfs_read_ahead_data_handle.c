@@ -0,0 +1,632 @@
+/*
+ * The read-ahead data handle functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfshfs_definitions.h"
+#include "libfshfs_libbfio.h"
+#include "libfshfs_libcerror.h"
+#include "libfshfs_libfdata.h"
+#include "libfshfs_read_ahead_data_handle.h"
+#include "libfshfs_unused.h"
+
+/* Creates a read-ahead data handle
+ * Make sure the value data_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_read_ahead_data_handle_initialize(
+     libfshfs_read_ahead_data_handle_t **data_handle,
+     size_t maximum_window_size,
+     int number_of_segments,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_read_ahead_data_handle_initialize";
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_window_size == 0 )
+	 || ( maximum_window_size > (size_t) LIBFSHFS_READ_AHEAD_MAXIMUM_WINDOW_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum window size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_segments <= 0 )
+	 || ( (size_t) number_of_segments > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( off64_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of segments value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*data_handle = memory_allocate_structure(
+	                libfshfs_read_ahead_data_handle_t );
+
+	if( *data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *data_handle,
+	     0,
+	     sizeof( libfshfs_read_ahead_data_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data handle.",
+		 function );
+
+		memory_free(
+		 *data_handle );
+
+		*data_handle = NULL;
+
+		return( -1 );
+	}
+	( *data_handle )->segment_end_offsets = (off64_t *) memory_allocate(
+	                                                     sizeof( off64_t ) * number_of_segments );
+
+	if( ( *data_handle )->segment_end_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segment end offsets.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *data_handle )->segment_end_offsets,
+	     0,
+	     sizeof( off64_t ) * number_of_segments ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear segment end offsets.",
+		 function );
+
+		goto on_error;
+	}
+	( *data_handle )->number_of_segments  = number_of_segments;
+	( *data_handle )->sequential_offset   = -1;
+	( *data_handle )->maximum_window_size = maximum_window_size;
+
+	return( 1 );
+
+on_error:
+	if( *data_handle != NULL )
+	{
+		if( ( *data_handle )->segment_end_offsets != NULL )
+		{
+			memory_free(
+			 ( *data_handle )->segment_end_offsets );
+		}
+		memory_free(
+		 *data_handle );
+
+		*data_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a read-ahead data handle
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_read_ahead_data_handle_free(
+     libfshfs_read_ahead_data_handle_t **data_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_read_ahead_data_handle_free";
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_handle != NULL )
+	{
+		if( ( *data_handle )->buffer != NULL )
+		{
+			memory_free(
+			 ( *data_handle )->buffer );
+		}
+		memory_free(
+		 ( *data_handle )->segment_end_offsets );
+
+		memory_free(
+		 *data_handle );
+
+		*data_handle = NULL;
+	}
+	return( 1 );
+}
+
+/* Sets the range of a segment
+ * The segment end offset bounds the read-ahead, so it does not cross an extent
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_read_ahead_data_handle_set_segment(
+     libfshfs_read_ahead_data_handle_t *data_handle,
+     int segment_index,
+     off64_t segment_offset,
+     size64_t segment_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_read_ahead_data_handle_set_segment";
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( segment_index < 0 )
+	 || ( segment_index >= data_handle->number_of_segments ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_size > (size64_t) ( INT64_MAX - segment_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid segment size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	data_handle->segment_end_offsets[ segment_index ] = segment_offset + (off64_t) segment_size;
+
+	return( 1 );
+}
+
+/* Reads data from the current offset into a buffer
+ * Callback for the data stream
+ *
+ * Sequential reads are detected and served from a read-ahead buffer, that is
+ * filled with a window that doubles on every refill, up to the maximum window
+ * size or the end of the segment. A non-sequential read resets the window.
+ *
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfshfs_read_ahead_data_handle_read_segment_data(
+         libfshfs_read_ahead_data_handle_t *data_handle,
+         libbfio_handle_t *file_io_handle,
+         int segment_index,
+         int segment_file_index LIBFSHFS_ATTRIBUTE_UNUSED,
+         uint8_t *segment_data,
+         size_t segment_data_size,
+         uint32_t segment_flags,
+         uint8_t read_flags LIBFSHFS_ATTRIBUTE_UNUSED,
+         libcerror_error_t **error )
+{
+	uint8_t *reallocation      = NULL;
+	static char *function      = "libfshfs_read_ahead_data_handle_read_segment_data";
+	size_t buffer_data_offset  = 0;
+	size_t fill_size           = 0;
+	size_t read_size           = 0;
+	size_t segment_data_offset = 0;
+	ssize_t read_count         = 0;
+	off64_t segment_end_offset = 0;
+	uint8_t is_sequential      = 0;
+
+	LIBFSHFS_UNREFERENCED_PARAMETER( segment_file_index )
+	LIBFSHFS_UNREFERENCED_PARAMETER( read_flags )
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_handle->current_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data handle - current offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( segment_index < 0 )
+	 || ( segment_index >= data_handle->number_of_segments ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment data.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid segment data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( segment_flags & LIBFDATA_RANGE_FLAG_IS_SPARSE ) != 0 )
+	{
+		if( memory_set(
+		     segment_data,
+		     0,
+		     segment_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear segment data.",
+			 function );
+
+			return( -1 );
+		}
+		data_handle->current_offset   += (off64_t) segment_data_size;
+		data_handle->sequential_offset = data_handle->current_offset;
+
+		return( (ssize_t) segment_data_size );
+	}
+	segment_end_offset = data_handle->segment_end_offsets[ segment_index ];
+
+	if( data_handle->current_offset == data_handle->sequential_offset )
+	{
+		is_sequential = 1;
+	}
+	if( ( data_handle->buffer_data_size > 0 )
+	 && ( data_handle->current_offset >= data_handle->buffer_offset )
+	 && ( data_handle->current_offset < ( data_handle->buffer_offset + (off64_t) data_handle->buffer_data_size ) ) )
+	{
+		buffer_data_offset = (size_t) ( data_handle->current_offset - data_handle->buffer_offset );
+		read_size          = data_handle->buffer_data_size - buffer_data_offset;
+
+		if( read_size > segment_data_size )
+		{
+			read_size = segment_data_size;
+		}
+		if( memory_copy(
+		     segment_data,
+		     &( data_handle->buffer[ buffer_data_offset ] ),
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy read-ahead data.",
+			 function );
+
+			return( -1 );
+		}
+		segment_data_offset          = read_size;
+		data_handle->current_offset += (off64_t) read_size;
+	}
+	if( segment_data_offset < segment_data_size )
+	{
+		read_size = segment_data_size - segment_data_offset;
+
+		if( is_sequential == 0 )
+		{
+			data_handle->window_size = 0;
+		}
+		else if( data_handle->window_size == 0 )
+		{
+			data_handle->window_size = LIBFSHFS_READ_AHEAD_MINIMUM_WINDOW_SIZE;
+		}
+		else if( data_handle->window_size <= ( data_handle->maximum_window_size / 2 ) )
+		{
+			data_handle->window_size *= 2;
+		}
+		else
+		{
+			data_handle->window_size = data_handle->maximum_window_size;
+		}
+		if( data_handle->window_size > data_handle->maximum_window_size )
+		{
+			data_handle->window_size = data_handle->maximum_window_size;
+		}
+		fill_size = 0;
+
+		if( data_handle->current_offset < segment_end_offset )
+		{
+			fill_size = data_handle->window_size;
+
+			if( (size64_t) fill_size > (size64_t) ( segment_end_offset - data_handle->current_offset ) )
+			{
+				fill_size = (size_t) ( segment_end_offset - data_handle->current_offset );
+			}
+		}
+		if( fill_size > read_size )
+		{
+			if( fill_size > data_handle->buffer_size )
+			{
+				reallocation = (uint8_t *) memory_reallocate(
+				                data_handle->buffer,
+				                sizeof( uint8_t ) * data_handle->window_size );
+
+				if( reallocation == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to resize read-ahead buffer.",
+					 function );
+
+					return( -1 );
+				}
+				data_handle->buffer      = reallocation;
+				data_handle->buffer_size = data_handle->window_size;
+			}
+			data_handle->buffer_data_size = 0;
+
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              file_io_handle,
+			              data_handle->buffer,
+			              fill_size,
+			              data_handle->current_offset,
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read read-ahead data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 data_handle->current_offset,
+				 data_handle->current_offset );
+
+				return( -1 );
+			}
+			if( data_handle->statistics != NULL )
+			{
+				if( libfshfs_statistics_add_read(
+				     data_handle->statistics,
+				     LIBFSHFS_STATISTICS_REGION_DATA,
+				     (uint64_t) read_count,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to add read to statistics.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			data_handle->buffer_offset    = data_handle->current_offset;
+			data_handle->buffer_data_size = (size_t) read_count;
+
+			if( read_size > (size_t) read_count )
+			{
+				read_size = (size_t) read_count;
+			}
+			if( memory_copy(
+			     &( segment_data[ segment_data_offset ] ),
+			     data_handle->buffer,
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy read-ahead data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              file_io_handle,
+			              &( segment_data[ segment_data_offset ] ),
+			              read_size,
+			              data_handle->current_offset,
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read segment data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 data_handle->current_offset,
+				 data_handle->current_offset );
+
+				return( -1 );
+			}
+			if( data_handle->statistics != NULL )
+			{
+				if( libfshfs_statistics_add_read(
+				     data_handle->statistics,
+				     LIBFSHFS_STATISTICS_REGION_DATA,
+				     (uint64_t) read_count,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to add read to statistics.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			read_size = (size_t) read_count;
+		}
+		segment_data_offset         += read_size;
+		data_handle->current_offset += (off64_t) read_size;
+	}
+	data_handle->sequential_offset = data_handle->current_offset;
+
+	return( (ssize_t) segment_data_offset );
+}
+
+/* Seeks a certain offset of the data
+ * Callback for the data stream
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t libfshfs_read_ahead_data_handle_seek_segment_offset(
+         libfshfs_read_ahead_data_handle_t *data_handle,
+         libbfio_handle_t *file_io_handle LIBFSHFS_ATTRIBUTE_UNUSED,
+         int segment_index LIBFSHFS_ATTRIBUTE_UNUSED,
+         int segment_file_index LIBFSHFS_ATTRIBUTE_UNUSED,
+         off64_t segment_offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libfshfs_read_ahead_data_handle_seek_segment_offset";
+
+	LIBFSHFS_UNREFERENCED_PARAMETER( file_io_handle )
+	LIBFSHFS_UNREFERENCED_PARAMETER( segment_index )
+	LIBFSHFS_UNREFERENCED_PARAMETER( segment_file_index )
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	data_handle->current_offset = segment_offset;
+
+	return( segment_offset );
+}
+
@@ -0,0 +1,127 @@
+/*
+ * The read-ahead data handle functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSHFS_READ_AHEAD_DATA_HANDLE_H )
+#define _LIBFSHFS_READ_AHEAD_DATA_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfshfs_libbfio.h"
+#include "libfshfs_libcerror.h"
+#include "libfshfs_statistics.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfshfs_read_ahead_data_handle libfshfs_read_ahead_data_handle_t;
+
+struct libfshfs_read_ahead_data_handle
+{
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* The segment end offsets
+	 */
+	off64_t *segment_end_offsets;
+
+	/* The number of segments
+	 */
+	int number_of_segments;
+
+	/* The offset where the next sequential read is expected to start
+	 */
+	off64_t sequential_offset;
+
+	/* The read-ahead window size
+	 */
+	size_t window_size;
+
+	/* The maximum read-ahead window size
+	 */
+	size_t maximum_window_size;
+
+	/* The read-ahead buffer
+	 */
+	uint8_t *buffer;
+
+	/* The allocated size of the read-ahead buffer
+	 */
+	size_t buffer_size;
+
+	/* The offset of the data in the read-ahead buffer
+	 */
+	off64_t buffer_offset;
+
+	/* The size of the data in the read-ahead buffer
+	 */
+	size_t buffer_data_size;
+
+	/* The statistics, where NULL if not available
+	 * The statistics are not owned by the data handle
+	 */
+	libfshfs_statistics_t *statistics;
+};
+
+int libfshfs_read_ahead_data_handle_initialize(
+     libfshfs_read_ahead_data_handle_t **data_handle,
+     size_t maximum_window_size,
+     int number_of_segments,
+     libcerror_error_t **error );
+
+int libfshfs_read_ahead_data_handle_free(
+     libfshfs_read_ahead_data_handle_t **data_handle,
+     libcerror_error_t **error );
+
+int libfshfs_read_ahead_data_handle_set_segment(
+     libfshfs_read_ahead_data_handle_t *data_handle,
+     int segment_index,
+     off64_t segment_offset,
+     size64_t segment_size,
+     libcerror_error_t **error );
+
+ssize_t libfshfs_read_ahead_data_handle_read_segment_data(
+         libfshfs_read_ahead_data_handle_t *data_handle,
+         libbfio_handle_t *file_io_handle,
+         int segment_index,
+         int segment_file_index,
+         uint8_t *segment_data,
+         size_t segment_data_size,
+         uint32_t segment_flags,
+         uint8_t read_flags,
+         libcerror_error_t **error );
+
+off64_t libfshfs_read_ahead_data_handle_seek_segment_offset(
+         libfshfs_read_ahead_data_handle_t *data_handle,
+         libbfio_handle_t *file_io_handle,
+         int segment_index,
+         int segment_file_index,
+         off64_t segment_offset,
+         libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSHFS_READ_AHEAD_DATA_HANDLE_H ) */
+
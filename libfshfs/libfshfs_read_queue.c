@@ -0,0 +1,1937 @@
+/*
+ * Read queue functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfshfs_definitions.h"
+#include "libfshfs_extended_attribute.h"
+#include "libfshfs_file_entry.h"
+#include "libfshfs_libbfio.h"
+#include "libfshfs_libcdata.h"
+#include "libfshfs_libcerror.h"
+#include "libfshfs_libcthreads.h"
+#include "libfshfs_read_queue.h"
+#include "libfshfs_read_request.h"
+#include "libfshfs_types.h"
+#include "libfshfs_worker_file_io_handle.h"
+
+/* Creates a read queue
+ * Make sure the value read_queue is referencing, is set to NULL
+ * The read requests are processed by number_of_threads worker threads, or
+ * synchronously by poll and wait if number_of_threads is 0 or multi-thread
+ * support is not available
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_read_queue_initialize(
+     libfshfs_read_queue_t **read_queue,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libfshfs_internal_read_queue_t *internal_read_queue = NULL;
+	static char *function                               = "libfshfs_read_queue_initialize";
+
+	if( read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_queue != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read queue value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads < 0 )
+	 || ( number_of_threads > LIBFSHFS_READ_QUEUE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_read_queue = memory_allocate_structure(
+	                       libfshfs_internal_read_queue_t );
+
+	if( internal_read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read queue.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_read_queue,
+	     0,
+	     sizeof( libfshfs_internal_read_queue_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read queue.",
+		 function );
+
+		memory_free(
+		 internal_read_queue );
+
+		return( -1 );
+	}
+	if( libcdata_list_initialize(
+	     &( internal_read_queue->pending_requests ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create pending requests list.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_list_initialize(
+	     &( internal_read_queue->completed_requests ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create completed requests list.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( internal_read_queue->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( internal_read_queue->completed_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create completed condition.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( internal_read_queue->worker_file_io_handles ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create worker file IO handles array.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_threads > 0 )
+	{
+		if( libcthreads_thread_pool_create(
+		     &( internal_read_queue->thread_pool ),
+		     NULL,
+		     number_of_threads,
+		     LIBFSHFS_READ_QUEUE_MAXIMUM_NUMBER_OF_QUEUED_REQUESTS,
+		     (int (*)(intptr_t *, void *)) &libfshfs_read_queue_process_request_callback,
+		     (void *) internal_read_queue,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		internal_read_queue->number_of_threads = number_of_threads;
+	}
+#endif
+	*read_queue = (libfshfs_read_queue_t *) internal_read_queue;
+
+	return( 1 );
+
+on_error:
+	if( internal_read_queue != NULL )
+	{
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+		if( internal_read_queue->worker_file_io_handles != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_read_queue->worker_file_io_handles ),
+			 NULL,
+			 NULL );
+		}
+		if( internal_read_queue->completed_condition != NULL )
+		{
+			libcthreads_condition_free(
+			 &( internal_read_queue->completed_condition ),
+			 NULL );
+		}
+		if( internal_read_queue->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( internal_read_queue->mutex ),
+			 NULL );
+		}
+#endif
+		if( internal_read_queue->completed_requests != NULL )
+		{
+			libcdata_list_free(
+			 &( internal_read_queue->completed_requests ),
+			 NULL,
+			 NULL );
+		}
+		if( internal_read_queue->pending_requests != NULL )
+		{
+			libcdata_list_free(
+			 &( internal_read_queue->pending_requests ),
+			 NULL,
+			 NULL );
+		}
+		memory_free(
+		 internal_read_queue );
+	}
+	return( -1 );
+}
+
+/* Frees a read queue
+ * The worker threads finish the read requests that were already submitted
+ * but read requests that were not yet reported are freed without calling
+ * their completion function
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_read_queue_free(
+     libfshfs_read_queue_t **read_queue,
+     libcerror_error_t **error )
+{
+	libfshfs_internal_read_queue_t *internal_read_queue = NULL;
+	static char *function                               = "libfshfs_read_queue_free";
+	int result                                          = 1;
+
+	if( read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_queue != NULL )
+	{
+		internal_read_queue = (libfshfs_internal_read_queue_t *) *read_queue;
+		*read_queue         = NULL;
+
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+		if( internal_read_queue->thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_join(
+			     &( internal_read_queue->thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libcdata_array_free(
+		     &( internal_read_queue->worker_file_io_handles ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfshfs_worker_file_io_handle_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free worker file IO handles array.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_condition_free(
+		     &( internal_read_queue->completed_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free completed condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( internal_read_queue->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		/* The read requests own the list elements that contain them
+		 * hence they are removed from the lists before the lists are freed
+		 */
+		if( libfshfs_internal_read_queue_free_requests(
+		     internal_read_queue,
+		     internal_read_queue->completed_requests,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free completed requests.",
+			 function );
+
+			result = -1;
+		}
+		if( libfshfs_internal_read_queue_free_requests(
+		     internal_read_queue,
+		     internal_read_queue->pending_requests,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free pending requests.",
+			 function );
+
+			result = -1;
+		}
+		if( libcdata_list_free(
+		     &( internal_read_queue->completed_requests ),
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free completed requests list.",
+			 function );
+
+			result = -1;
+		}
+		if( libcdata_list_free(
+		     &( internal_read_queue->pending_requests ),
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free pending requests list.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_read_queue );
+	}
+	return( result );
+}
+
+/* Frees the read requests in a list of read requests
+ * This function does not grab the mutex and must only be called when
+ * no worker threads are active
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_internal_read_queue_free_requests(
+     libfshfs_internal_read_queue_t *internal_read_queue,
+     libcdata_list_t *requests,
+     libcerror_error_t **error )
+{
+	libcdata_list_element_t *list_element = NULL;
+	libfshfs_read_request_t *read_request = NULL;
+	static char *function                 = "libfshfs_internal_read_queue_free_requests";
+
+	if( internal_read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		if( libcdata_list_get_first_element(
+		     requests,
+		     &list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve first list element.",
+			 function );
+
+			return( -1 );
+		}
+		if( list_element == NULL )
+		{
+			break;
+		}
+		if( libcdata_list_element_get_value(
+		     list_element,
+		     (intptr_t **) &read_request,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve read request from list element.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcdata_list_remove_element(
+		     requests,
+		     list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove list element.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfshfs_read_request_free(
+		     &read_request,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read request.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	while( list_element != NULL );
+
+	return( 1 );
+}
+
+/* Removes the first read request from a list of read requests
+ * If wait_for_request is set and the list is empty the function waits until
+ * a worker thread completes a read request or no read requests are outstanding
+ * Returns 1 if successful, 0 if no read request is available or -1 on error
+ */
+int libfshfs_internal_read_queue_pop_request(
+     libfshfs_internal_read_queue_t *internal_read_queue,
+     libcdata_list_t *requests,
+     uint8_t wait_for_request,
+     libfshfs_read_request_t **read_request,
+     libcerror_error_t **error )
+{
+	libcdata_list_element_t *list_element = NULL;
+	static char *function                 = "libfshfs_internal_read_queue_pop_request";
+	int result                            = 0;
+
+	if( internal_read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read request.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_list_get_first_element(
+	     requests,
+	     &list_element,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first list element.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( ( wait_for_request != 0 )
+	 && ( internal_read_queue->thread_pool != NULL ) )
+	{
+		while( ( list_element == NULL )
+		    && ( internal_read_queue->number_of_outstanding_requests > 0 ) )
+		{
+			if( libcthreads_condition_wait(
+			     internal_read_queue->completed_condition,
+			     internal_read_queue->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for completed condition.",
+				 function );
+
+				goto on_error;
+			}
+			if( libcdata_list_get_first_element(
+			     requests,
+			     &list_element,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve first list element.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+#endif
+	if( list_element != NULL )
+	{
+		if( libcdata_list_element_get_value(
+		     list_element,
+		     (intptr_t **) read_request,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve read request from list element.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcdata_list_remove_element(
+		     requests,
+		     list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove list element.",
+			 function );
+
+			goto on_error;
+		}
+		/* A read request is no longer outstanding once it is removed
+		 * from the completed requests
+		 */
+		if( requests == internal_read_queue->completed_requests )
+		{
+			internal_read_queue->number_of_outstanding_requests -= 1;
+
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+			if( internal_read_queue->number_of_outstanding_requests == 0 )
+			{
+				if( libcthreads_condition_broadcast(
+				     internal_read_queue->completed_condition,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to broadcast completed condition.",
+					 function );
+
+					goto on_error;
+				}
+			}
+#endif
+		}
+		result = 1;
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 internal_read_queue->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Appends a processed read request to the completed read requests
+ * If the read request cannot be appended it is freed and counted as lost,
+ * so that wait does not block on it
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_internal_read_queue_append_completed_request(
+     libfshfs_internal_read_queue_t *internal_read_queue,
+     libfshfs_read_request_t *read_request,
+     libcerror_error_t **error )
+{
+	libfshfs_read_request_t *lost_read_request = NULL;
+	static char *function                      = "libfshfs_internal_read_queue_append_completed_request";
+	int result                                 = 1;
+
+	if( internal_read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read request.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_list_append_element(
+	     internal_read_queue->completed_requests,
+	     read_request->list_element,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append read request to completed requests list.",
+		 function );
+
+		internal_read_queue->number_of_outstanding_requests -= 1;
+		internal_read_queue->number_of_lost_requests        += 1;
+
+		lost_read_request = read_request;
+		result            = -1;
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_condition_broadcast(
+	     internal_read_queue->completed_condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast completed condition.",
+		 function );
+
+		result = -1;
+	}
+#endif
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	if( lost_read_request != NULL )
+	{
+		/* The list element is not part of a list hence the read request can be freed
+		 */
+		libfshfs_read_request_free(
+		 &lost_read_request,
+		 NULL );
+	}
+	return( result );
+}
+
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+
+/* Grabs a worker file IO handle for a specific file IO handle
+ * A cloned file IO handle that is not in use is reused otherwise a new
+ * clone is created, hence there are at most as many clones of a file IO
+ * handle as there are worker threads
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_internal_read_queue_grab_file_io_handle(
+     libfshfs_internal_read_queue_t *internal_read_queue,
+     libbfio_handle_t *source_file_io_handle,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	libfshfs_worker_file_io_handle_t *safe_worker_file_io_handle = NULL;
+	libfshfs_worker_file_io_handle_t *worker_file_io_handle      = NULL;
+	static char *function                                        = "libfshfs_internal_read_queue_grab_file_io_handle";
+	int entry_index                                              = 0;
+	int number_of_worker_file_io_handles                         = 0;
+	int worker_file_io_handle_index                              = 0;
+
+	if( internal_read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     internal_read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_read_queue->worker_file_io_handles,
+	     &number_of_worker_file_io_handles,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of worker file IO handles.",
+		 function );
+
+		goto on_error;
+	}
+	for( worker_file_io_handle_index = 0;
+	     worker_file_io_handle_index < number_of_worker_file_io_handles;
+	     worker_file_io_handle_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_read_queue->worker_file_io_handles,
+		     worker_file_io_handle_index,
+		     (intptr_t **) &worker_file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve worker file IO handle: %d.",
+			 function,
+			 worker_file_io_handle_index );
+
+			goto on_error;
+		}
+		if( ( worker_file_io_handle != NULL )
+		 && ( worker_file_io_handle->source_file_io_handle == source_file_io_handle )
+		 && ( worker_file_io_handle->is_in_use == 0 ) )
+		{
+			break;
+		}
+		worker_file_io_handle = NULL;
+	}
+	if( worker_file_io_handle == NULL )
+	{
+		if( libfshfs_worker_file_io_handle_initialize(
+		     &safe_worker_file_io_handle,
+		     source_file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create worker file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcdata_array_append_entry(
+		     internal_read_queue->worker_file_io_handles,
+		     &entry_index,
+		     (intptr_t *) safe_worker_file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append worker file IO handle to array.",
+			 function );
+
+			goto on_error;
+		}
+		worker_file_io_handle      = safe_worker_file_io_handle;
+		safe_worker_file_io_handle = NULL;
+	}
+	worker_file_io_handle->is_in_use = 1;
+
+	*file_io_handle = worker_file_io_handle->file_io_handle;
+
+	if( libcthreads_mutex_release(
+	     internal_read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( safe_worker_file_io_handle != NULL )
+	{
+		libfshfs_worker_file_io_handle_free(
+		 &safe_worker_file_io_handle,
+		 NULL );
+	}
+	libcthreads_mutex_release(
+	 internal_read_queue->mutex,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Releases a worker file IO handle that was grabbed by a worker thread
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_internal_read_queue_release_file_io_handle(
+     libfshfs_internal_read_queue_t *internal_read_queue,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libfshfs_worker_file_io_handle_t *worker_file_io_handle = NULL;
+	static char *function                                   = "libfshfs_internal_read_queue_release_file_io_handle";
+	int number_of_worker_file_io_handles                    = 0;
+	int result                                              = -1;
+	int worker_file_io_handle_index                         = 0;
+
+	if( internal_read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     internal_read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_read_queue->worker_file_io_handles,
+	     &number_of_worker_file_io_handles,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of worker file IO handles.",
+		 function );
+
+		number_of_worker_file_io_handles = 0;
+	}
+	for( worker_file_io_handle_index = 0;
+	     worker_file_io_handle_index < number_of_worker_file_io_handles;
+	     worker_file_io_handle_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_read_queue->worker_file_io_handles,
+		     worker_file_io_handle_index,
+		     (intptr_t **) &worker_file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve worker file IO handle: %d.",
+			 function,
+			 worker_file_io_handle_index );
+
+			break;
+		}
+		if( ( worker_file_io_handle != NULL )
+		 && ( worker_file_io_handle->file_io_handle == file_io_handle ) )
+		{
+			worker_file_io_handle->is_in_use = 0;
+
+			result = 1;
+
+			break;
+		}
+	}
+	if( ( result != 1 )
+	 && ( worker_file_io_handle_index >= number_of_worker_file_io_handles ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing worker file IO handle.",
+		 function );
+	}
+	if( libcthreads_mutex_release(
+	     internal_read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT ) */
+
+/* Processes a read request on a worker thread
+ * The read request is always added to the completed read requests, with
+ * its read error if the data could not be read, or counted as lost
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_read_queue_process_request_callback(
+     libfshfs_read_request_t *read_request,
+     libfshfs_internal_read_queue_t *internal_read_queue )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	static char *function            = "libfshfs_read_queue_process_request_callback";
+	int result                       = 1;
+
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	libbfio_handle_t *source_file_io_handle = NULL;
+#endif
+
+	if( read_request == NULL )
+	{
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libfshfs_read_request_get_file_io_handle(
+	     read_request,
+	     &source_file_io_handle,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file IO handle.",
+		 function );
+
+		result = -1;
+	}
+	else if( libfshfs_internal_read_queue_grab_file_io_handle(
+	          internal_read_queue,
+	          source_file_io_handle,
+	          &file_io_handle,
+	          &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to grab worker file IO handle.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	if( result == 1 )
+	{
+		if( libfshfs_read_request_process(
+		     read_request,
+		     file_io_handle,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to process read request.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( file_io_handle != NULL )
+	{
+		libfshfs_internal_read_queue_release_file_io_handle(
+		 internal_read_queue,
+		 file_io_handle,
+		 NULL );
+	}
+#endif
+	/* A read request that could not be processed is completed with an error
+	 */
+	if( result != 1 )
+	{
+		read_request->read_count = -1;
+
+		if( read_request->read_error == NULL )
+		{
+			read_request->read_error = error;
+			error                    = NULL;
+		}
+	}
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( libfshfs_internal_read_queue_append_completed_request(
+	     internal_read_queue,
+	     read_request,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Submits a read request
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_internal_read_queue_submit_request(
+     libfshfs_internal_read_queue_t *internal_read_queue,
+     libfshfs_read_request_t *read_request,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_internal_read_queue_submit_request";
+	int result            = 1;
+
+	if( internal_read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read request.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_read_queue->number_of_outstanding_requests += 1;
+
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( internal_read_queue->thread_pool == NULL )
+#endif
+	{
+		if( libcdata_list_append_element(
+		     internal_read_queue->pending_requests,
+		     read_request->list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append read request to pending requests list.",
+			 function );
+
+			internal_read_queue->number_of_outstanding_requests -= 1;
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	/* The thread pool is not pushed to while holding the mutex since the push
+	 * blocks when the maximum number of queued requests has been reached
+	 */
+	if( ( result == 1 )
+	 && ( internal_read_queue->thread_pool != NULL ) )
+	{
+		if( libcthreads_thread_pool_push(
+		     internal_read_queue->thread_pool,
+		     (intptr_t *) read_request,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push read request onto thread pool.",
+			 function );
+
+			if( libcthreads_mutex_grab(
+			     internal_read_queue->mutex,
+			     NULL ) == 1 )
+			{
+				internal_read_queue->number_of_outstanding_requests -= 1;
+
+				libcthreads_mutex_release(
+				 internal_read_queue->mutex,
+				 NULL );
+			}
+			result = -1;
+		}
+	}
+#endif
+	return( result );
+}
+
+/* Submits a read of file entry data at a specific offset
+ * The file entry, buffer and completion data must remain available until
+ * the completion function has been called
+ * The completion function is called by poll or wait with the number of bytes
+ * read or -1 if the data could not be read and should return 1 if successful
+ * or -1 on error
+ * The completion function can submit further reads, which wait also waits for
+ * The data stream of the file entry is determined before the read is submitted
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_read_queue_submit_file_entry_read(
+     libfshfs_read_queue_t *read_queue,
+     libfshfs_file_entry_t *file_entry,
+     uint8_t *buffer,
+     size_t buffer_size,
+     off64_t offset,
+     int (*completion_function)(
+            uint8_t *buffer,
+            ssize_t read_count,
+            void *completion_data,
+            libcerror_error_t **error ),
+     void *completion_data,
+     libcerror_error_t **error )
+{
+	libfshfs_internal_read_queue_t *internal_read_queue = NULL;
+	libfshfs_read_request_t *read_request               = NULL;
+	static char *function                               = "libfshfs_read_queue_submit_file_entry_read";
+
+	if( read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	internal_read_queue = (libfshfs_internal_read_queue_t *) read_queue;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfshfs_read_request_initialize(
+	     &read_request,
+	     file_entry,
+	     NULL,
+	     buffer,
+	     buffer_size,
+	     offset,
+	     completion_function,
+	     completion_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read request.",
+		 function );
+
+		goto on_error;
+	}
+	/* The data stream is determined by the caller so that the worker threads
+	 * do not need to access the B-tree files
+	 */
+	if( libfshfs_internal_file_entry_determine_data_stream(
+	     (libfshfs_internal_file_entry_t *) file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine data stream of file entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfshfs_internal_read_queue_submit_request(
+	     internal_read_queue,
+	     read_request,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to submit read request.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( read_request != NULL )
+	{
+		libfshfs_read_request_free(
+		 &read_request,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Submits a read of extended attribute data at a specific offset
+ * The extended attribute, buffer and completion data must remain available until
+ * the completion function has been called
+ * The completion function is called by poll or wait with the number of bytes
+ * read or -1 if the data could not be read and should return 1 if successful
+ * or -1 on error
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_read_queue_submit_extended_attribute_read(
+     libfshfs_read_queue_t *read_queue,
+     libfshfs_extended_attribute_t *extended_attribute,
+     uint8_t *buffer,
+     size_t buffer_size,
+     off64_t offset,
+     int (*completion_function)(
+            uint8_t *buffer,
+            ssize_t read_count,
+            void *completion_data,
+            libcerror_error_t **error ),
+     void *completion_data,
+     libcerror_error_t **error )
+{
+	libfshfs_internal_read_queue_t *internal_read_queue = NULL;
+	libfshfs_read_request_t *read_request               = NULL;
+	static char *function                               = "libfshfs_read_queue_submit_extended_attribute_read";
+
+	if( read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	internal_read_queue = (libfshfs_internal_read_queue_t *) read_queue;
+
+	if( extended_attribute == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extended attribute.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfshfs_read_request_initialize(
+	     &read_request,
+	     NULL,
+	     extended_attribute,
+	     buffer,
+	     buffer_size,
+	     offset,
+	     completion_function,
+	     completion_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read request.",
+		 function );
+
+		goto on_error;
+	}
+	/* The data stream is determined by the caller so that the worker threads
+	 * do not need to access the B-tree files
+	 */
+	if( libfshfs_internal_extended_attribute_determine_data_stream(
+	     (libfshfs_internal_extended_attribute_t *) extended_attribute,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine data stream of extended attribute.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfshfs_internal_read_queue_submit_request(
+	     internal_read_queue,
+	     read_request,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to submit read request.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( read_request != NULL )
+	{
+		libfshfs_read_request_free(
+		 &read_request,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reports completed read requests to their completion function
+ * Pending read requests are processed first if no worker threads are used
+ * If wait_for_completion is set the function returns when all outstanding
+ * read requests have been reported
+ * The completion function of a read request that failed is called with a read
+ * count of -1, once all completed read requests have been reported -1 is
+ * returned with the error of the first read request that failed
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_internal_read_queue_complete_requests(
+     libfshfs_internal_read_queue_t *internal_read_queue,
+     uint8_t wait_for_completion,
+     int *number_of_completed_requests,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *read_error         = NULL;
+	libfshfs_read_request_t *read_request = NULL;
+	static char *function                 = "libfshfs_internal_read_queue_complete_requests";
+	int number_of_failed_requests         = 0;
+	int number_of_lost_requests           = 0;
+	int result                            = 0;
+
+	if( internal_read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_completed_requests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of completed requests.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_completed_requests = 0;
+
+	do
+	{
+		result = libfshfs_internal_read_queue_pop_request(
+		          internal_read_queue,
+		          internal_read_queue->completed_requests,
+		          wait_for_completion,
+		          &read_request,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve completed read request.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			*number_of_completed_requests += 1;
+
+			if( libfshfs_read_request_complete(
+			     read_request,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to complete read request.",
+				 function );
+
+				goto on_error;
+			}
+			if( read_request->read_count < 0 )
+			{
+				/* Keep the error of the first read request that failed
+				 */
+				if( read_error == NULL )
+				{
+					read_error               = read_request->read_error;
+					read_request->read_error = NULL;
+				}
+				number_of_failed_requests += 1;
+			}
+			if( libfshfs_read_request_free(
+			     &read_request,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free read request.",
+				 function );
+
+				goto on_error;
+			}
+			continue;
+		}
+		/* Without worker threads the pending read requests are processed here
+		 */
+		result = libfshfs_internal_read_queue_pop_request(
+		          internal_read_queue,
+		          internal_read_queue->pending_requests,
+		          0,
+		          &read_request,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve pending read request.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( libfshfs_read_request_process(
+			     read_request,
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to process read request.",
+				 function );
+
+				read_request->read_count = -1;
+			}
+			/* The read request is owned by the completed read requests
+			 * or freed if it could not be appended
+			 */
+			result = libfshfs_internal_read_queue_append_completed_request(
+			          internal_read_queue,
+			          read_request,
+			          error );
+
+			read_request = NULL;
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append completed read request.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	while( result != 0 );
+
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	number_of_lost_requests = internal_read_queue->number_of_lost_requests;
+
+	internal_read_queue->number_of_lost_requests = 0;
+
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( number_of_failed_requests > 0 )
+	{
+		if( ( error != NULL )
+		 && ( *error == NULL ) )
+		{
+			*error     = read_error;
+			read_error = NULL;
+		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data of %d read request(s).",
+		 function,
+		 number_of_failed_requests );
+
+		goto on_error;
+	}
+	if( number_of_lost_requests > 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to complete %d read request(s).",
+		 function,
+		 number_of_lost_requests );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( read_error != NULL )
+	{
+		libcerror_error_free(
+		 &read_error );
+	}
+	if( read_request != NULL )
+	{
+		libfshfs_read_request_free(
+		 &read_request,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reports the read requests that have completed without blocking
+ * If the data of a read request could not be read -1 is returned, after
+ * all completed read requests have been reported, with the read error
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_read_queue_poll(
+     libfshfs_read_queue_t *read_queue,
+     int *number_of_completed_requests,
+     libcerror_error_t **error )
+{
+	libfshfs_internal_read_queue_t *internal_read_queue = NULL;
+	static char *function                               = "libfshfs_read_queue_poll";
+
+	if( read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	internal_read_queue = (libfshfs_internal_read_queue_t *) read_queue;
+
+	if( libfshfs_internal_read_queue_complete_requests(
+	     internal_read_queue,
+	     0,
+	     number_of_completed_requests,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to complete read requests.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Waits until all outstanding read requests have completed and reports them
+ * If the data of a read request could not be read -1 is returned, after
+ * all completed read requests have been reported, with the read error
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_read_queue_wait(
+     libfshfs_read_queue_t *read_queue,
+     int *number_of_completed_requests,
+     libcerror_error_t **error )
+{
+	libfshfs_internal_read_queue_t *internal_read_queue = NULL;
+	static char *function                               = "libfshfs_read_queue_wait";
+
+	if( read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	internal_read_queue = (libfshfs_internal_read_queue_t *) read_queue;
+
+	if( libfshfs_internal_read_queue_complete_requests(
+	     internal_read_queue,
+	     1,
+	     number_of_completed_requests,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to complete read requests.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of read requests that were submitted but not yet reported
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_read_queue_get_number_of_outstanding_requests(
+     libfshfs_read_queue_t *read_queue,
+     int *number_of_outstanding_requests,
+     libcerror_error_t **error )
+{
+	libfshfs_internal_read_queue_t *internal_read_queue = NULL;
+	static char *function                               = "libfshfs_read_queue_get_number_of_outstanding_requests";
+
+	if( read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	internal_read_queue = (libfshfs_internal_read_queue_t *) read_queue;
+
+	if( number_of_outstanding_requests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of outstanding requests.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_outstanding_requests = internal_read_queue->number_of_outstanding_requests;
+
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
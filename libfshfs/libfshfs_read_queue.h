@@ -0,0 +1,197 @@
+/*
+ * Read queue functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSHFS_READ_QUEUE_H )
+#define _LIBFSHFS_READ_QUEUE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfshfs_extern.h"
+#include "libfshfs_libcdata.h"
+#include "libfshfs_libcerror.h"
+#include "libfshfs_libcthreads.h"
+#include "libfshfs_libbfio.h"
+#include "libfshfs_read_request.h"
+#include "libfshfs_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfshfs_internal_read_queue libfshfs_internal_read_queue_t;
+
+struct libfshfs_internal_read_queue
+{
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+	/* The pending read requests, that are processed by poll and wait
+	 * when no threads are used
+	 */
+	libcdata_list_t *pending_requests;
+
+	/* The completed read requests, that are reported by poll and wait
+	 */
+	libcdata_list_t *completed_requests;
+
+	/* The number of read requests that were submitted but not yet reported
+	 */
+	int number_of_outstanding_requests;
+
+	/* The number of read requests that could not be added to the completed
+	 * read requests and are reported as an error by poll and wait
+	 */
+	int number_of_lost_requests;
+
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	/* The thread pool
+	 */
+	libcthreads_thread_pool_t *thread_pool;
+
+	/* The worker file IO handles, clones of the file IO handles of the
+	 * read requests so that worker threads do not share a file offset
+	 */
+	libcdata_array_t *worker_file_io_handles;
+
+	/* The mutex that protects the request lists and counters
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition that is signalled when a read request completes
+	 */
+	libcthreads_condition_t *completed_condition;
+#endif
+};
+
+LIBFSHFS_EXTERN \
+int libfshfs_read_queue_initialize(
+     libfshfs_read_queue_t **read_queue,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+LIBFSHFS_EXTERN \
+int libfshfs_read_queue_free(
+     libfshfs_read_queue_t **read_queue,
+     libcerror_error_t **error );
+
+int libfshfs_internal_read_queue_pop_request(
+     libfshfs_internal_read_queue_t *internal_read_queue,
+     libcdata_list_t *requests,
+     uint8_t wait_for_request,
+     libfshfs_read_request_t **read_request,
+     libcerror_error_t **error );
+
+int libfshfs_internal_read_queue_append_completed_request(
+     libfshfs_internal_read_queue_t *internal_read_queue,
+     libfshfs_read_request_t *read_request,
+     libcerror_error_t **error );
+
+int libfshfs_internal_read_queue_free_requests(
+     libfshfs_internal_read_queue_t *internal_read_queue,
+     libcdata_list_t *requests,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+
+int libfshfs_internal_read_queue_grab_file_io_handle(
+     libfshfs_internal_read_queue_t *internal_read_queue,
+     libbfio_handle_t *source_file_io_handle,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error );
+
+int libfshfs_internal_read_queue_release_file_io_handle(
+     libfshfs_internal_read_queue_t *internal_read_queue,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT ) */
+
+int libfshfs_read_queue_process_request_callback(
+     libfshfs_read_request_t *read_request,
+     libfshfs_internal_read_queue_t *internal_read_queue );
+
+int libfshfs_internal_read_queue_submit_request(
+     libfshfs_internal_read_queue_t *internal_read_queue,
+     libfshfs_read_request_t *read_request,
+     libcerror_error_t **error );
+
+LIBFSHFS_EXTERN \
+int libfshfs_read_queue_submit_file_entry_read(
+     libfshfs_read_queue_t *read_queue,
+     libfshfs_file_entry_t *file_entry,
+     uint8_t *buffer,
+     size_t buffer_size,
+     off64_t offset,
+     int (*completion_function)(
+            uint8_t *buffer,
+            ssize_t read_count,
+            void *completion_data,
+            libcerror_error_t **error ),
+     void *completion_data,
+     libcerror_error_t **error );
+
+LIBFSHFS_EXTERN \
+int libfshfs_read_queue_submit_extended_attribute_read(
+     libfshfs_read_queue_t *read_queue,
+     libfshfs_extended_attribute_t *extended_attribute,
+     uint8_t *buffer,
+     size_t buffer_size,
+     off64_t offset,
+     int (*completion_function)(
+            uint8_t *buffer,
+            ssize_t read_count,
+            void *completion_data,
+            libcerror_error_t **error ),
+     void *completion_data,
+     libcerror_error_t **error );
+
+int libfshfs_internal_read_queue_complete_requests(
+     libfshfs_internal_read_queue_t *internal_read_queue,
+     uint8_t wait_for_completion,
+     int *number_of_completed_requests,
+     libcerror_error_t **error );
+
+LIBFSHFS_EXTERN \
+int libfshfs_read_queue_poll(
+     libfshfs_read_queue_t *read_queue,
+     int *number_of_completed_requests,
+     libcerror_error_t **error );
+
+LIBFSHFS_EXTERN \
+int libfshfs_read_queue_wait(
+     libfshfs_read_queue_t *read_queue,
+     int *number_of_completed_requests,
+     libcerror_error_t **error );
+
+LIBFSHFS_EXTERN \
+int libfshfs_read_queue_get_number_of_outstanding_requests(
+     libfshfs_read_queue_t *read_queue,
+     int *number_of_outstanding_requests,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSHFS_READ_QUEUE_H ) */
+
@@ -0,0 +1,163 @@
+/*
+ * Read range functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libfshfs_definitions.h"
+#include "libfshfs_libcerror.h"
+#include "libfshfs_read_range.h"
+
+/* Compares two read ranges by offset
+ * Returns -1 if the first range is less than the second, 0 if equal or 1 if greater
+ */
+int libfshfs_read_range_compare_by_offset(
+     const libfshfs_read_range_t *first_read_range,
+     const libfshfs_read_range_t *second_read_range )
+{
+	if( first_read_range->offset < second_read_range->offset )
+	{
+		return( -1 );
+	}
+	else if( first_read_range->offset > second_read_range->offset )
+	{
+		return( 1 );
+	}
+	/* Keep the order of the request for ranges that start at the same offset
+	 */
+	if( first_read_range->index < second_read_range->index )
+	{
+		return( -1 );
+	}
+	else if( first_read_range->index > second_read_range->index )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+
+/* Determines the span of sorted read ranges that can be read with a single read
+ * Ranges that overlap or are separated by a gap of at most the maximum gap size
+ * are coalesced, as long as the span does not exceed the maximum span size
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_read_range_get_span(
+     const libfshfs_read_range_t *read_ranges,
+     int number_of_ranges,
+     int first_range_index,
+     int *last_range_index,
+     off64_t *span_offset,
+     size_t *span_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libfshfs_read_range_get_span";
+	off64_t range_end_offset  = 0;
+	off64_t safe_span_offset  = 0;
+	off64_t span_end_offset   = 0;
+	int safe_last_range_index = 0;
+
+	if( read_ranges == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read ranges.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_range_index < 0 )
+	 || ( first_range_index >= number_of_ranges ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first range index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( last_range_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid last range index.",
+		 function );
+
+		return( -1 );
+	}
+	if( span_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid span offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( span_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid span size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_span_offset      = read_ranges[ first_range_index ].offset;
+	span_end_offset       = safe_span_offset + (off64_t) read_ranges[ first_range_index ].size;
+	safe_last_range_index = first_range_index;
+
+	while( ( safe_last_range_index + 1 ) < number_of_ranges )
+	{
+		if( read_ranges[ safe_last_range_index + 1 ].offset > ( span_end_offset + LIBFSHFS_READ_RANGES_MAXIMUM_GAP_SIZE ) )
+		{
+			break;
+		}
+		range_end_offset = read_ranges[ safe_last_range_index + 1 ].offset + (off64_t) read_ranges[ safe_last_range_index + 1 ].size;
+
+		if( range_end_offset < span_end_offset )
+		{
+			range_end_offset = span_end_offset;
+		}
+		if( ( range_end_offset - safe_span_offset ) > LIBFSHFS_READ_RANGES_MAXIMUM_SPAN_SIZE )
+		{
+			break;
+		}
+		span_end_offset = range_end_offset;
+
+		safe_last_range_index++;
+	}
+	*last_range_index = safe_last_range_index;
+	*span_offset      = safe_span_offset;
+	*span_size        = (size_t) ( span_end_offset - safe_span_offset );
+
+	return( 1 );
+}
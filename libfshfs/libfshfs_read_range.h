@@ -0,0 +1,73 @@
+/*
+ * Read range functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSHFS_READ_RANGE_H )
+#define _LIBFSHFS_READ_RANGE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfshfs_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfshfs_read_range libfshfs_read_range_t;
+
+struct libfshfs_read_range
+{
+	/* The offset of the range in the data
+	 */
+	off64_t offset;
+
+	/* The size of the range
+	 */
+	size_t size;
+
+	/* The buffer to read the range into
+	 */
+	uint8_t *buffer;
+
+	/* The index of the range in the read request
+	 */
+	int index;
+};
+
+int libfshfs_read_range_compare_by_offset(
+     const libfshfs_read_range_t *first_read_range,
+     const libfshfs_read_range_t *second_read_range );
+
+int libfshfs_read_range_get_span(
+     const libfshfs_read_range_t *read_ranges,
+     int number_of_ranges,
+     int first_range_index,
+     int *last_range_index,
+     off64_t *span_offset,
+     size_t *span_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSHFS_READ_RANGE_H ) */
+
@@ -0,0 +1,467 @@
+/*
+ * Read request functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfshfs_extended_attribute.h"
+#include "libfshfs_file_entry.h"
+#include "libfshfs_libbfio.h"
+#include "libfshfs_libcdata.h"
+#include "libfshfs_libcerror.h"
+#include "libfshfs_read_request.h"
+#include "libfshfs_types.h"
+
+/* Creates a read request
+ * Make sure the value read_request is referencing, is set to NULL
+ * Either a file entry or an extended attribute must be provided
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_read_request_initialize(
+     libfshfs_read_request_t **read_request,
+     libfshfs_file_entry_t *file_entry,
+     libfshfs_extended_attribute_t *extended_attribute,
+     uint8_t *buffer,
+     size_t buffer_size,
+     off64_t offset,
+     int (*completion_function)(
+            uint8_t *buffer,
+            ssize_t read_count,
+            void *completion_data,
+            libcerror_error_t **error ),
+     void *completion_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_read_request_initialize";
+
+	if( read_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read request.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_request != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read request value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( file_entry == NULL )
+	  &&  ( extended_attribute == NULL ) )
+	 || ( ( file_entry != NULL )
+	  &&  ( extended_attribute != NULL ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry and extended attribute - exactly one value is required.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( completion_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid completion function.",
+		 function );
+
+		return( -1 );
+	}
+	*read_request = memory_allocate_structure(
+	                 libfshfs_read_request_t );
+
+	if( *read_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read request.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *read_request,
+	     0,
+	     sizeof( libfshfs_read_request_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read request.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_list_element_initialize(
+	     &( ( *read_request )->list_element ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create list element.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_list_element_set_value(
+	     ( *read_request )->list_element,
+	     (intptr_t *) *read_request,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set read request in list element.",
+		 function );
+
+		goto on_error;
+	}
+	( *read_request )->file_entry          = file_entry;
+	( *read_request )->extended_attribute  = extended_attribute;
+	( *read_request )->buffer              = buffer;
+	( *read_request )->buffer_size         = buffer_size;
+	( *read_request )->offset              = offset;
+	( *read_request )->read_count          = -1;
+	( *read_request )->completion_function = completion_function;
+	( *read_request )->completion_data     = completion_data;
+
+	return( 1 );
+
+on_error:
+	if( *read_request != NULL )
+	{
+		if( ( *read_request )->list_element != NULL )
+		{
+			libcdata_list_element_free(
+			 &( ( *read_request )->list_element ),
+			 NULL,
+			 NULL );
+		}
+		memory_free(
+		 *read_request );
+
+		*read_request = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a read request
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_read_request_free(
+     libfshfs_read_request_t **read_request,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_read_request_free";
+	int result            = 1;
+
+	if( read_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read request.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_request != NULL )
+	{
+		/* The file entry, extended attribute, buffer and completion data
+		 * are referenced and freed elsewhere
+		 */
+		if( ( *read_request )->list_element != NULL )
+		{
+			if( libcdata_list_element_free(
+			     &( ( *read_request )->list_element ),
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free list element.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *read_request )->read_error != NULL )
+		{
+			libcerror_error_free(
+			 &( ( *read_request )->read_error ) );
+		}
+		memory_free(
+		 *read_request );
+
+		*read_request = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves the file IO handle of the file entry or extended attribute
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_read_request_get_file_io_handle(
+     libfshfs_read_request_t *read_request,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_read_request_get_file_io_handle";
+
+	if( read_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read request.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_request->file_entry != NULL )
+	{
+		*file_io_handle = ( (libfshfs_internal_file_entry_t *) read_request->file_entry )->file_io_handle;
+	}
+	else if( read_request->extended_attribute != NULL )
+	{
+		*file_io_handle = ( (libfshfs_internal_extended_attribute_t *) read_request->extended_attribute )->file_io_handle;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid read request - missing file entry and extended attribute.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Processes a read request
+ * The data is read with file_io_handle or the file IO handle of the file entry
+ * or extended attribute if NULL
+ * If the data could not be read the read count is set to -1 and the error is
+ * stored in the read request
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_read_request_process(
+     libfshfs_read_request_t *read_request,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_read_request_process";
+
+	if( read_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read request.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_request->read_error != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read request - read error value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		if( libfshfs_read_request_get_file_io_handle(
+		     read_request,
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file IO handle.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( read_request->file_entry != NULL )
+	{
+		read_request->read_count = libfshfs_internal_file_entry_read_buffer_at_offset(
+		                            (libfshfs_internal_file_entry_t *) read_request->file_entry,
+		                            file_io_handle,
+		                            read_request->buffer,
+		                            read_request->buffer_size,
+		                            read_request->offset,
+		                            &( read_request->read_error ) );
+	}
+	else
+	{
+		read_request->read_count = libfshfs_internal_extended_attribute_read_buffer_at_offset(
+		                            (libfshfs_internal_extended_attribute_t *) read_request->extended_attribute,
+		                            file_io_handle,
+		                            read_request->buffer,
+		                            read_request->buffer_size,
+		                            read_request->offset,
+		                            &( read_request->read_error ) );
+	}
+	if( read_request->read_count < 0 )
+	{
+		libcerror_error_set(
+		 &( read_request->read_error ),
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 read_request->offset,
+		 read_request->offset );
+
+		read_request->read_count = -1;
+	}
+	return( 1 );
+}
+
+/* Reports a processed read request to its completion function
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_read_request_complete(
+     libfshfs_read_request_t *read_request,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_read_request_complete";
+
+	if( read_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read request.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_request->completion_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid read request - missing completion function.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_request->completion_function(
+	     read_request->buffer,
+	     read_request->read_count,
+	     read_request->completion_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: completion function failed.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,126 @@
+/*
+ * Read request functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSHFS_READ_REQUEST_H )
+#define _LIBFSHFS_READ_REQUEST_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfshfs_libbfio.h"
+#include "libfshfs_libcdata.h"
+#include "libfshfs_libcerror.h"
+#include "libfshfs_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfshfs_read_request libfshfs_read_request_t;
+
+struct libfshfs_read_request
+{
+	/* The file entry to read from
+	 */
+	libfshfs_file_entry_t *file_entry;
+
+	/* The extended attribute to read from
+	 */
+	libfshfs_extended_attribute_t *extended_attribute;
+
+	/* The buffer to read into
+	 */
+	uint8_t *buffer;
+
+	/* The size of the buffer
+	 */
+	size_t buffer_size;
+
+	/* The offset of the data to read
+	 */
+	off64_t offset;
+
+	/* The number of bytes read or -1 on error
+	 */
+	ssize_t read_count;
+
+	/* The error if the data could not be read
+	 */
+	libcerror_error_t *read_error;
+
+	/* The completion function
+	 */
+	int (*completion_function)(
+	       uint8_t *buffer,
+	       ssize_t read_count,
+	       void *completion_data,
+	       libcerror_error_t **error );
+
+	/* The completion data
+	 */
+	void *completion_data;
+
+	/* The list element that contains the read request
+	 * It is allocated with the read request so that a processed read request
+	 * can always be added to the completed read requests
+	 */
+	libcdata_list_element_t *list_element;
+};
+
+int libfshfs_read_request_initialize(
+     libfshfs_read_request_t **read_request,
+     libfshfs_file_entry_t *file_entry,
+     libfshfs_extended_attribute_t *extended_attribute,
+     uint8_t *buffer,
+     size_t buffer_size,
+     off64_t offset,
+     int (*completion_function)(
+            uint8_t *buffer,
+            ssize_t read_count,
+            void *completion_data,
+            libcerror_error_t **error ),
+     void *completion_data,
+     libcerror_error_t **error );
+
+int libfshfs_read_request_free(
+     libfshfs_read_request_t **read_request,
+     libcerror_error_t **error );
+
+int libfshfs_read_request_get_file_io_handle(
+     libfshfs_read_request_t *read_request,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error );
+
+int libfshfs_read_request_process(
+     libfshfs_read_request_t *read_request,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libfshfs_read_request_complete(
+     libfshfs_read_request_t *read_request,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSHFS_READ_REQUEST_H ) */
+
@@ -0,0 +1,58 @@
+/*
+ * Read run definitions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSHFS_READ_RUN_H )
+#define _LIBFSHFS_READ_RUN_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfshfs_read_run libfshfs_read_run_t;
+
+struct libfshfs_read_run
+{
+	/* The offset of the run in the data
+	 */
+	off64_t data_offset;
+
+	/* The offset of the run in the volume, 0 for a sparse run
+	 */
+	off64_t volume_offset;
+
+	/* The size of the run
+	 */
+	size64_t size;
+
+	/* The flags
+	 */
+	uint32_t flags;
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSHFS_READ_RUN_H ) */
+
@@ -0,0 +1,582 @@
+/*
+ * Statistics functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_CLOCK_GETTIME ) && !defined( WINAPI )
+#include <time.h>
+#endif
+
+#include "libfshfs_libcerror.h"
+#include "libfshfs_libcthreads.h"
+#include "libfshfs_statistics.h"
+
+/* Creates statistics
+ * Make sure the value statistics is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_statistics_initialize(
+     libfshfs_statistics_t **statistics,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_statistics_initialize";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( *statistics != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid statistics value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*statistics = memory_allocate_structure(
+	               libfshfs_statistics_t );
+
+	if( *statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create statistics.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *statistics,
+	     0,
+	     sizeof( libfshfs_statistics_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear statistics.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *statistics )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *statistics != NULL )
+	{
+		memory_free(
+		 *statistics );
+
+		*statistics = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_statistics_free(
+     libfshfs_statistics_t **statistics,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_statistics_free";
+	int result            = 1;
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( *statistics != NULL )
+	{
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *statistics )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *statistics );
+
+		*statistics = NULL;
+	}
+	return( result );
+}
+
+/* Resets the statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_statistics_reset(
+     libfshfs_statistics_t *statistics,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_statistics_reset";
+	int result            = 1;
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     statistics->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( memory_set(
+	     &( statistics->values ),
+	     0,
+	     sizeof( libfshfs_volume_statistics_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear statistics values.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     statistics->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a snapshot of the statistics values
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_statistics_get_values(
+     libfshfs_statistics_t *statistics,
+     libfshfs_volume_statistics_t *volume_statistics,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_statistics_get_values";
+	int result            = 1;
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume statistics.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     statistics->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( memory_copy(
+	     volume_statistics,
+	     &( statistics->values ),
+	     sizeof( libfshfs_volume_statistics_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy statistics values.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     statistics->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Adds a read to the statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_statistics_add_read(
+     libfshfs_statistics_t *statistics,
+     int region,
+     uint64_t read_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_statistics_add_read";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( region < 0 )
+	 || ( region >= LIBFSHFS_STATISTICS_NUMBER_OF_REGIONS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid region value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     statistics->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	statistics->values.number_of_reads[ region ] += 1;
+	statistics->values.read_sizes[ region ]      += read_size;
+
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     statistics->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Adds B-tree node cache values to the statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_statistics_add_node_cache_values(
+     libfshfs_statistics_t *statistics,
+     int region,
+     uint64_t number_of_hits,
+     uint64_t number_of_misses,
+     uint64_t number_of_evictions,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_statistics_add_node_cache_values";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( region < 0 )
+	 || ( region >= LIBFSHFS_STATISTICS_NUMBER_OF_BTREES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid region value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     statistics->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	statistics->values.number_of_node_cache_hits[ region ]      += number_of_hits;
+	statistics->values.number_of_node_cache_misses[ region ]    += number_of_misses;
+	statistics->values.number_of_node_cache_evictions[ region ] += number_of_evictions;
+
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     statistics->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Adds a decompressed block to the statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_statistics_add_decompression(
+     libfshfs_statistics_t *statistics,
+     int compression_method,
+     uint64_t decompressed_size,
+     uint64_t decompression_time,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_statistics_add_decompression";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compression_method < 0 )
+	 || ( compression_method >= LIBFSHFS_STATISTICS_NUMBER_OF_COMPRESSION_METHODS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compression method value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     statistics->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	statistics->values.number_of_decompressed_blocks[ compression_method ] += 1;
+	statistics->values.decompressed_sizes[ compression_method ]            += decompressed_size;
+	statistics->values.decompression_time                                  += decompression_time;
+
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     statistics->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves a monotonic timestamp in nanoseconds
+ * The timestamp is 0 if no monotonic clock is available
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_statistics_get_timestamp(
+     int64_t *timestamp,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+
+#elif defined( HAVE_CLOCK_GETTIME )
+	struct timespec current_time;
+#endif
+
+	static char *function = "libfshfs_statistics_get_timestamp";
+
+	if( timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	*timestamp = 0;
+
+#if defined( WINAPI )
+	if( ( QueryPerformanceFrequency(
+	       &frequency ) != 0 )
+	 && ( frequency.QuadPart > 0 )
+	 && ( QueryPerformanceCounter(
+	       &counter ) != 0 ) )
+	{
+		*timestamp = (int64_t) ( ( counter.QuadPart / frequency.QuadPart ) * 1000000000 )
+		           + (int64_t) ( ( ( counter.QuadPart % frequency.QuadPart ) * 1000000000 ) / frequency.QuadPart );
+	}
+#elif defined( HAVE_CLOCK_GETTIME )
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &current_time ) == 0 )
+	{
+		*timestamp = ( (int64_t) current_time.tv_sec * 1000000000 ) + current_time.tv_nsec;
+	}
+#endif
+	return( 1 );
+}
+
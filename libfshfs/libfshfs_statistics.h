@@ -0,0 +1,99 @@
+/*
+ * Statistics functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSHFS_STATISTICS_H )
+#define _LIBFSHFS_STATISTICS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfshfs_definitions.h"
+#include "libfshfs_libcerror.h"
+#include "libfshfs_libcthreads.h"
+#include "libfshfs_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfshfs_statistics libfshfs_statistics_t;
+
+struct libfshfs_statistics
+{
+	/* The statistics values
+	 */
+	libfshfs_volume_statistics_t values;
+
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libfshfs_statistics_initialize(
+     libfshfs_statistics_t **statistics,
+     libcerror_error_t **error );
+
+int libfshfs_statistics_free(
+     libfshfs_statistics_t **statistics,
+     libcerror_error_t **error );
+
+int libfshfs_statistics_reset(
+     libfshfs_statistics_t *statistics,
+     libcerror_error_t **error );
+
+int libfshfs_statistics_get_values(
+     libfshfs_statistics_t *statistics,
+     libfshfs_volume_statistics_t *volume_statistics,
+     libcerror_error_t **error );
+
+int libfshfs_statistics_add_read(
+     libfshfs_statistics_t *statistics,
+     int region,
+     uint64_t read_size,
+     libcerror_error_t **error );
+
+int libfshfs_statistics_add_node_cache_values(
+     libfshfs_statistics_t *statistics,
+     int region,
+     uint64_t number_of_hits,
+     uint64_t number_of_misses,
+     uint64_t number_of_evictions,
+     libcerror_error_t **error );
+
+int libfshfs_statistics_add_decompression(
+     libfshfs_statistics_t *statistics,
+     int compression_method,
+     uint64_t decompressed_size,
+     uint64_t decompression_time,
+     libcerror_error_t **error );
+
+int libfshfs_statistics_get_timestamp(
+     int64_t *timestamp,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSHFS_STATISTICS_H ) */
+
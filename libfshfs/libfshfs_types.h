@@ -37,16 +37,127 @@
 typedef struct libfshfs_data_stream {}		libfshfs_data_stream_t;
 typedef struct libfshfs_extended_attribute {}	libfshfs_extended_attribute_t;
 typedef struct libfshfs_file_entry {}		libfshfs_file_entry_t;
+typedef struct libfshfs_read_queue {}		libfshfs_read_queue_t;
 typedef struct libfshfs_volume {}		libfshfs_volume_t;
 
 #else
 typedef intptr_t libfshfs_data_stream_t;
 typedef intptr_t libfshfs_extended_attribute_t;
 typedef intptr_t libfshfs_file_entry_t;
+typedef intptr_t libfshfs_read_queue_t;
 typedef intptr_t libfshfs_volume_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
+/* The file entry stat values
+ */
+typedef struct libfshfs_file_entry_stat libfshfs_file_entry_stat_t;
+
+struct libfshfs_file_entry_stat
+{
+	/* The data fork size
+	 */
+	uint64_t data_fork_size;
+
+	/* The resource fork size
+	 */
+	uint64_t resource_fork_size;
+
+	/* The identifier (or catalog node identifier (CNID))
+	 */
+	uint32_t identifier;
+
+	/* The creation time
+	 */
+	uint32_t creation_time;
+
+	/* The modification time
+	 */
+	uint32_t modification_time;
+
+	/* The entry modification time
+	 */
+	uint32_t entry_modification_time;
+
+	/* The access time
+	 */
+	uint32_t access_time;
+
+	/* The owner identifier
+	 */
+	uint32_t owner_identifier;
+
+	/* The group identifier
+	 */
+	uint32_t group_identifier;
+
+	/* The number of links
+	 */
+	uint32_t number_of_links;
+
+	/* The offset of the UTF-8 encoded name in the names buffer
+	 */
+	uint32_t name_offset;
+
+	/* The size of the UTF-8 encoded name including the end of string character
+	 */
+	uint32_t name_size;
+
+	/* The file mode
+	 */
+	uint16_t file_mode;
+};
+
+/* The volume statistics array sizes
+ */
+#define LIBFSHFS_STATISTICS_NUMBER_OF_REGIONS			5
+#define LIBFSHFS_STATISTICS_NUMBER_OF_BTREES			3
+#define LIBFSHFS_STATISTICS_NUMBER_OF_COMPRESSION_METHODS	8
+
+/* The volume statistics
+ * The read values are indexed by LIBFSHFS_STATISTICS_REGION, the B-tree node
+ * cache values by the catalog, extents and attributes LIBFSHFS_STATISTICS_REGION
+ * and the decompression values by LIBFSHFS_STATISTICS_COMPRESSION_METHOD
+ * A snapshot of the statistics is not exact when the volume is accessed by
+ * multiple threads, since reads that are in progress can be partially counted
+ */
+typedef struct libfshfs_volume_statistics libfshfs_volume_statistics_t;
+
+struct libfshfs_volume_statistics
+{
+	/* The number of bytes read per region
+	 */
+	uint64_t read_sizes[ LIBFSHFS_STATISTICS_NUMBER_OF_REGIONS ];
+
+	/* The number of reads per region
+	 */
+	uint64_t number_of_reads[ LIBFSHFS_STATISTICS_NUMBER_OF_REGIONS ];
+
+	/* The number of B-tree node cache hits per B-tree
+	 */
+	uint64_t number_of_node_cache_hits[ LIBFSHFS_STATISTICS_NUMBER_OF_BTREES ];
+
+	/* The number of B-tree node cache misses per B-tree
+	 */
+	uint64_t number_of_node_cache_misses[ LIBFSHFS_STATISTICS_NUMBER_OF_BTREES ];
+
+	/* The number of B-tree node cache evictions per B-tree
+	 */
+	uint64_t number_of_node_cache_evictions[ LIBFSHFS_STATISTICS_NUMBER_OF_BTREES ];
+
+	/* The number of decompressed blocks per compression method
+	 */
+	uint64_t number_of_decompressed_blocks[ LIBFSHFS_STATISTICS_NUMBER_OF_COMPRESSION_METHODS ];
+
+	/* The number of decompressed bytes per compression method
+	 */
+	uint64_t decompressed_sizes[ LIBFSHFS_STATISTICS_NUMBER_OF_COMPRESSION_METHODS ];
+
+	/* The cumulative decompression time in nanoseconds
+	 */
+	uint64_t decompression_time;
+};
+
 #endif /* defined( HAVE_LOCAL_LIBFSHFS ) */
 
 #endif /* !defined( _LIBFSHFS_INTERNAL_TYPES_H ) */
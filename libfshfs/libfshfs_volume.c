@@ -25,9 +25,16 @@
 #include <types.h>
 #include <wide_string.h>
 
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libfshfs_allocation_bitmap.h"
+#include "libfshfs_allocation_block_stream.h"
 #include "libfshfs_debug.h"
 #include "libfshfs_definitions.h"
 #include "libfshfs_directory_entry.h"
+#include "libfshfs_extent.h"
 #include "libfshfs_file_entry.h"
 #include "libfshfs_fork_descriptor.h"
 #include "libfshfs_io_handle.h"
@@ -35,7 +42,11 @@
 #include "libfshfs_libcerror.h"
 #include "libfshfs_libcnotify.h"
 #include "libfshfs_libcthreads.h"
+#include "libfshfs_libfdata.h"
+#include "libfshfs_lookup_target.h"
 #include "libfshfs_master_directory_block.h"
+#include "libfshfs_memory_map.h"
+#include "libfshfs_statistics.h"
 #include "libfshfs_thread_record.h"
 #include "libfshfs_volume.h"
 #include "libfshfs_volume_header.h"
@@ -150,8 +161,8 @@ int libfshfs_volume_free(
      libcerror_error_t **error )
 {
 	libfshfs_internal_volume_t *internal_volume = NULL;
-	static char *function                        = "libfshfs_volume_free";
-	int result                                   = 1;
+	static char *function                       = "libfshfs_volume_free";
+	int result                                  = 1;
 
 	if( volume == NULL )
 	{
@@ -259,19 +270,16 @@ int libfshfs_volume_signal_abort(
 	return( 1 );
 }
 
-/* Opens a volume
+/* Retrieves the maximum read-ahead size
  * Returns 1 if successful or -1 on error
  */
-int libfshfs_volume_open(
+int libfshfs_volume_get_maximum_read_ahead_size(
      libfshfs_volume_t *volume,
-     const char *filename,
-     int access_flags,
+     size_t *maximum_read_ahead_size,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle            = NULL;
 	libfshfs_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfshfs_volume_open";
-	size_t string_length                        = 0;
+	static char *function                       = "libfshfs_volume_get_maximum_read_ahead_size";
 
 	if( volume == NULL )
 	{
@@ -286,102 +294,110 @@ int libfshfs_volume_open(
 	}
 	internal_volume = (libfshfs_internal_volume_t *) volume;
 
-	if( filename == NULL )
+	if( internal_volume->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( ( access_flags & LIBFSHFS_ACCESS_FLAG_READ ) == 0 )
-	 && ( ( access_flags & LIBFSHFS_ACCESS_FLAG_WRITE ) == 0 ) )
+	if( maximum_read_ahead_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported access flags.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum read-ahead size.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBFSHFS_ACCESS_FLAG_WRITE ) != 0 )
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: write access currently not supported.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
+#endif
+	*maximum_read_ahead_size = internal_volume->io_handle->maximum_read_ahead_size;
+
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libbfio_handle_set_track_offsets_read(
-	     file_io_handle,
-	     1,
-	     error ) != 1 )
+#endif
+	return( 1 );
+}
+
+/* Sets the maximum read-ahead size
+ * The read-ahead is applied to data streams created after this call
+ * A value of 0 disables read-ahead
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_volume_set_maximum_read_ahead_size(
+     libfshfs_volume_t *volume,
+     size_t maximum_read_ahead_size,
+     libcerror_error_t **error )
+{
+	libfshfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfshfs_volume_set_maximum_read_ahead_size";
+
+	if( volume == NULL )
 	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set track offsets read in file IO handle.",
-                 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#endif
-	string_length = narrow_string_length(
-	                 filename );
+	internal_volume = (libfshfs_internal_volume_t *) volume;
 
-	if( libbfio_file_set_name(
-	     file_io_handle,
-	     filename,
-	     string_length + 1,
-	     error ) != 1 )
+	if( internal_volume->io_handle == NULL )
 	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set filename in file IO handle.",
-                 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfshfs_volume_open_file_io_handle(
-	     volume,
-	     file_io_handle,
-	     access_flags,
-	     error ) != 1 )
+	if( maximum_read_ahead_size > (size_t) LIBFSHFS_READ_AHEAD_MAXIMUM_WINDOW_SIZE )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open volume: %s.",
-		 function,
-		 filename );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum read-ahead size value exceeds maximum.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 #if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
@@ -398,7 +414,7 @@ int libfshfs_volume_open(
 		return( -1 );
 	}
 #endif
-	internal_volume->file_io_handle_created_in_library = 1;
+	internal_volume->io_handle->maximum_read_ahead_size = maximum_read_ahead_size;
 
 #if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -416,32 +432,18 @@ int libfshfs_volume_open(
 	}
 #endif
 	return( 1 );
-
-on_error:
-	if( file_io_handle != NULL )
-	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
-	}
-        return( -1 );
 }
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
-
-/* Opens a volume
+/* Retrieves the value to indicate if the volume file should be memory mapped
  * Returns 1 if successful or -1 on error
  */
-int libfshfs_volume_open_wide(
+int libfshfs_volume_get_use_memory_mapping(
      libfshfs_volume_t *volume,
-     const wchar_t *filename,
-     int access_flags,
+     uint8_t *use_memory_mapping,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle            = NULL;
 	libfshfs_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfshfs_volume_open_wide";
-	size_t string_length                        = 0;
+	static char *function                       = "libfshfs_volume_get_use_memory_mapping";
 
 	if( volume == NULL )
 	{
@@ -456,103 +458,79 @@ int libfshfs_volume_open_wide(
 	}
 	internal_volume = (libfshfs_internal_volume_t *) volume;
 
-	if( filename == NULL )
+	if( use_memory_mapping == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
+		 "%s: invalid use memory mapping.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( ( access_flags & LIBFSHFS_ACCESS_FLAG_READ ) == 0 )
-	 && ( ( access_flags & LIBFSHFS_ACCESS_FLAG_WRITE ) == 0 ) )
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported access flags.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBFSHFS_ACCESS_FLAG_WRITE ) != 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: write access currently not supported.",
-		 function );
+#endif
+	*use_memory_mapping = internal_volume->use_memory_mapping;
 
-		return( -1 );
-	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
-		goto on_error;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libbfio_handle_set_track_offsets_read(
-	     file_io_handle,
-	     1,
-	     error ) != 1 )
-	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set track offsets read in file IO handle.",
-                 function );
-
-		goto on_error;
+		return( -1 );
 	}
 #endif
-	string_length = wide_string_length(
-	                 filename );
+	return( 1 );
+}
 
-	if( libbfio_file_set_name_wide(
-	     file_io_handle,
-	     filename,
-	     string_length + 1,
-	     error ) != 1 )
-	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set filename in file IO handle.",
-                 function );
+/* Sets the value to indicate if the volume file should be memory mapped
+ * Memory mapping is only applied by libfshfs_volume_open and falls back
+ * to regular reads if the file cannot be memory mapped. B-tree nodes
+ * are then read directly from the mapped file data.
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_volume_set_use_memory_mapping(
+     libfshfs_volume_t *volume,
+     uint8_t use_memory_mapping,
+     libcerror_error_t **error )
+{
+	libfshfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfshfs_volume_set_use_memory_mapping";
 
-		goto on_error;
-	}
-	if( libfshfs_volume_open_file_io_handle(
-	     volume,
-	     file_io_handle,
-	     access_flags,
-	     error ) != 1 )
+	if( volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open volume: %ls.",
-		 function,
-		 filename );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
+	internal_volume = (libfshfs_internal_volume_t *) volume;
+
 #if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_volume->read_write_lock,
@@ -568,7 +546,7 @@ int libfshfs_volume_open_wide(
 		return( -1 );
 	}
 #endif
-	internal_volume->file_io_handle_created_in_library = 1;
+	internal_volume->use_memory_mapping = (uint8_t) ( use_memory_mapping != 0 );
 
 #if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -586,33 +564,18 @@ int libfshfs_volume_open_wide(
 	}
 #endif
 	return( 1 );
-
-on_error:
-	if( file_io_handle != NULL )
-	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
-	}
-        return( -1 );
 }
 
-#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
-
-/* Opens a volume using a Basic File IO (bfio) handle
+/* Retrieves the value to indicate if the volume should be opened lazily
  * Returns 1 if successful or -1 on error
  */
-int libfshfs_volume_open_file_io_handle(
+int libfshfs_volume_get_use_lazy_open(
      libfshfs_volume_t *volume,
-     libbfio_handle_t *file_io_handle,
-     int access_flags,
+     uint8_t *use_lazy_open,
      libcerror_error_t **error )
 {
 	libfshfs_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfshfs_volume_open_file_io_handle";
-	uint8_t file_io_handle_opened_in_library    = 0;
-	int bfio_access_flags                       = 0;
-	int file_io_handle_is_open                  = 0;
+	static char *function                       = "libfshfs_volume_get_use_lazy_open";
 
 	if( volume == NULL )
 	{
@@ -627,24 +590,149 @@ int libfshfs_volume_open_file_io_handle(
 	}
 	internal_volume = (libfshfs_internal_volume_t *) volume;
 
-	if( internal_volume->file_io_handle != NULL )
+	if( use_lazy_open == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid volume - file IO handle already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid use lazy open.",
 		 function );
 
 		return( -1 );
 	}
-	if( file_io_handle == NULL )
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*use_lazy_open = internal_volume->use_lazy_open;
+
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the value to indicate if the volume should be opened lazily
+ * When set, reading the extents (overflow) and attributes B-tree files
+ * is deferred from open until they are first needed. The catalog B-tree
+ * file is always read on open.
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_volume_set_use_lazy_open(
+     libfshfs_volume_t *volume,
+     uint8_t use_lazy_open,
+     libcerror_error_t **error )
+{
+	libfshfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfshfs_volume_set_use_lazy_open";
+
+	if( volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file IO handle.",
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfshfs_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_volume->use_lazy_open = (uint8_t) ( use_lazy_open != 0 );
+
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Opens a volume
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_volume_open(
+     libfshfs_volume_t *volume,
+     const char *filename,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle            = NULL;
+	libfshfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfshfs_volume_open";
+	size_t string_length                        = 0;
+	int result                                  = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfshfs_internal_volume_t *) volume;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
@@ -672,55 +760,104 @@ int libfshfs_volume_open_file_io_handle(
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBFSHFS_ACCESS_FLAG_READ ) != 0 )
-	{
-		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
-	}
-	file_io_handle_is_open = libbfio_handle_is_open(
-	                          file_io_handle,
-	                          error );
-
-	if( file_io_handle_is_open == -1 )
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open volume.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
 		 function );
 
 		goto on_error;
 	}
-	else if( file_io_handle_is_open == 0 )
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libbfio_handle_set_track_offsets_read(
+	     file_io_handle,
+	     1,
+	     error ) != 1 )
 	{
-		if( libbfio_handle_open(
-		     file_io_handle,
-		     bfio_access_flags,
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set track offsets read in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+#endif
+	string_length = narrow_string_length(
+	                 filename );
+
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     string_length + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+	if( internal_volume->use_memory_mapping != 0 )
+	{
+		if( libfshfs_memory_map_initialize(
+		     &( internal_volume->memory_map ),
 		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create memory map.",
+			 function );
+
+			goto on_error;
+		}
+		result = libfshfs_memory_map_open(
+		          internal_volume->memory_map,
+		          filename,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_OPEN_FAILED,
-			 "%s: unable to open file IO handle.",
-			 function );
+			 "%s: unable to memory map file: %s.",
+			 function,
+			 filename );
 
 			goto on_error;
 		}
-		file_io_handle_opened_in_library = 1;
+		else if( result != 0 )
+		{
+			internal_volume->io_handle->mapped_data      = internal_volume->memory_map->data;
+			internal_volume->io_handle->mapped_data_size = internal_volume->memory_map->data_size;
+		}
 	}
-	if( libfshfs_internal_volume_open_read(
-	     internal_volume,
+	if( libfshfs_volume_open_file_io_handle(
+	     volume,
 	     file_io_handle,
-	     1024,
+	     access_flags,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read from file IO handle.",
-		 function );
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open volume: %s.",
+		 function,
+		 filename );
 
 		goto on_error;
 	}
@@ -739,8 +876,7 @@ int libfshfs_volume_open_file_io_handle(
 		return( -1 );
 	}
 #endif
-	internal_volume->file_io_handle                   = file_io_handle;
-	internal_volume->file_io_handle_opened_in_library = file_io_handle_opened_in_library;
+	internal_volume->file_io_handle_created_in_library = 1;
 
 #if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -760,25 +896,39 @@ int libfshfs_volume_open_file_io_handle(
 	return( 1 );
 
 on_error:
-	if( file_io_handle_opened_in_library != 0 )
+	if( internal_volume->memory_map != NULL )
 	{
-		libbfio_handle_close(
-		 file_io_handle,
-		 error );
+		internal_volume->io_handle->mapped_data      = NULL;
+		internal_volume->io_handle->mapped_data_size = 0;
+
+		libfshfs_memory_map_free(
+		 &( internal_volume->memory_map ),
+		 NULL );
 	}
-	return( -1 );
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+        return( -1 );
 }
 
-/* Closes a volume
- * Returns 0 if successful or -1 on error
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Opens a volume
+ * Returns 1 if successful or -1 on error
  */
-int libfshfs_volume_close(
+int libfshfs_volume_open_wide(
      libfshfs_volume_t *volume,
+     const wchar_t *filename,
+     int access_flags,
      libcerror_error_t **error )
 {
+	libbfio_handle_t *file_io_handle            = NULL;
 	libfshfs_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfshfs_volume_close";
-	int result                                  = 0;
+	static char *function                       = "libfshfs_volume_open_wide";
+	size_t string_length                        = 0;
 
 	if( volume == NULL )
 	{
@@ -793,161 +943,3003 @@ int libfshfs_volume_close(
 	}
 	internal_volume = (libfshfs_internal_volume_t *) volume;
 
-	if( internal_volume->file_io_handle == NULL )
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid volume - missing file IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	if( ( ( access_flags & LIBFSHFS_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBFSHFS_ACCESS_FLAG_WRITE ) == 0 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
-		 function );
-
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBFSHFS_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libbfio_handle_set_track_offsets_read(
+	     file_io_handle,
+	     1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set track offsets read in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+#endif
+	string_length = wide_string_length(
+	                 filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     string_length + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+	if( libfshfs_volume_open_file_io_handle(
+	     volume,
+	     file_io_handle,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open volume: %ls.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_volume->file_io_handle_created_in_library = 1;
+
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+        return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Opens a volume using a Basic File IO (bfio) handle
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_volume_open_file_io_handle(
+     libfshfs_volume_t *volume,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libfshfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfshfs_volume_open_file_io_handle";
+	uint8_t file_io_handle_opened_in_library    = 0;
+	int bfio_access_flags                       = 0;
+	int file_io_handle_is_open                  = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfshfs_internal_volume_t *) volume;
+
+	if( internal_volume->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBFSHFS_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBFSHFS_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBFSHFS_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBFSHFS_ACCESS_FLAG_READ ) != 0 )
+	{
+		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open volume.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     bfio_access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle_opened_in_library = 1;
+	}
+	if( libfshfs_internal_volume_open_read(
+	     internal_volume,
+	     file_io_handle,
+	     1024,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_volume->file_io_handle                   = file_io_handle;
+	internal_volume->file_io_handle_opened_in_library = file_io_handle_opened_in_library;
+
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 error );
+	}
+	return( -1 );
+}
+
+/* Opens a volume from data in memory
+ * The data is owned by the caller and must remain available until the volume is closed
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_volume_open_memory(
+     libfshfs_volume_t *volume,
+     const uint8_t *data,
+     size_t data_size,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle            = NULL;
+	libfshfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfshfs_volume_open_memory";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfshfs_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBFSHFS_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBFSHFS_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBFSHFS_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	/* The volume header is read by means of a memory range file IO handle,
+	 * B-tree nodes and file data are read directly from the data
+	 */
+	if( libbfio_memory_range_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_memory_range_set(
+	     file_io_handle,
+	     (uint8_t *) data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set memory range in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	internal_volume->io_handle->mapped_data      = data;
+	internal_volume->io_handle->mapped_data_size = (size64_t) data_size;
+
+	if( libfshfs_volume_open_file_io_handle(
+	     volume,
+	     file_io_handle,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open volume from memory.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_volume->file_io_handle_created_in_library = 1;
+
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	internal_volume->io_handle->mapped_data      = NULL;
+	internal_volume->io_handle->mapped_data_size = 0;
+
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes a volume
+ * Returns 0 if successful or -1 on error
+ */
+int libfshfs_volume_close(
+     libfshfs_volume_t *volume,
+     libcerror_error_t **error )
+{
+	libfshfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfshfs_volume_close";
+	int result                                  = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfshfs_internal_volume_t *) volume;
+
+	if( internal_volume->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( internal_volume->file_io_handle_created_in_library != 0 )
+		{
+			if( libfshfs_debug_print_read_offsets(
+			     internal_volume->file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print the read offsets.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+#endif
+	if( internal_volume->file_io_handle_opened_in_library != 0 )
+	{
+		if( libbfio_handle_close(
+		     internal_volume->file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_volume->file_io_handle_opened_in_library = 0;
+	}
+	if( internal_volume->file_io_handle_created_in_library != 0 )
+	{
+		if( libbfio_handle_free(
+		     &( internal_volume->file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_volume->file_io_handle_created_in_library = 0;
+	}
+	internal_volume->file_io_handle = NULL;
+
+	if( libfshfs_io_handle_clear(
+	     internal_volume->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear IO handle.",
+		 function );
+
+		result = -1;
+	}
+	if( internal_volume->volume_header != NULL )
+	{
+		if( libfshfs_volume_header_free(
+		     &( internal_volume->volume_header ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free volume header.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_volume->master_directory_block != NULL )
+	{
+		if( libfshfs_master_directory_block_free(
+		     &( internal_volume->master_directory_block ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free master directory block.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_volume->file_system != NULL )
+	{
+		if( libfshfs_file_system_free(
+		     &( internal_volume->file_system ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file system.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_volume->root_directory_entry != NULL )
+	{
+		if( libfshfs_directory_entry_free(
+		     &( internal_volume->root_directory_entry ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free root directory entry.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_volume->allocation_bitmap != NULL )
+	{
+		if( libfshfs_allocation_bitmap_free(
+		     &( internal_volume->allocation_bitmap ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free allocation bitmap.",
+			 function );
+
+			result = -1;
+		}
+	}
+	/* The memory map is freed last since B-tree nodes can reference the mapped data
+	 */
+	if( internal_volume->memory_map != NULL )
+	{
+		if( libfshfs_memory_map_free(
+		     &( internal_volume->memory_map ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free memory map.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Opens a volume for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_internal_volume_open_read(
+     libfshfs_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	uint8_t signature[ 2 ];
+
+	libfshfs_fork_descriptor_t *attributes_file_fork_descriptor = NULL;
+	libfshfs_fork_descriptor_t *catalog_file_fork_descriptor    = NULL;
+	libfshfs_fork_descriptor_t *extents_file_fork_descriptor    = NULL;
+	static char *function                                       = "libfshfs_internal_volume_open_read";
+	ssize_t read_count                                          = 0;
+	uint8_t use_case_folding                                    = 0;
+	int result                                                  = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->volume_header != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - volume header value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->master_directory_block != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - master directory block value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->file_system != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - file system value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->root_directory_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - root directory entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              signature,
+	              2,
+	              file_offset,
+	              error );
+
+	if( read_count != 2 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read signature at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		goto on_error;
+	}
+	if( internal_volume->io_handle->statistics != NULL )
+	{
+		if( libfshfs_statistics_add_read(
+		     internal_volume->io_handle->statistics,
+		     LIBFSHFS_STATISTICS_REGION_METADATA,
+		     (uint64_t) 2,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add read to statistics.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( memory_compare(
+	     "BD",
+	     signature,
+	     2 ) == 0 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading master directory block:\n" );
+		}
+#endif
+		if( libfshfs_master_directory_block_initialize(
+		     &( internal_volume->master_directory_block ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create master directory block.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfshfs_master_directory_block_read_file_io_handle(
+		     internal_volume->master_directory_block,
+		     file_io_handle,
+		     file_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read master directory block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+		if( internal_volume->io_handle->statistics != NULL )
+		{
+			if( libfshfs_statistics_add_read(
+			     internal_volume->io_handle->statistics,
+			     LIBFSHFS_STATISTICS_REGION_METADATA,
+			     (uint64_t) 512,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to add read to statistics.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		internal_volume->io_handle->file_system_type = LIBFSHFS_FILE_SYSTEM_TYPE_HFS;
+		internal_volume->io_handle->block_size       = 512;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		use_case_folding = 1;
+
+		extents_file_fork_descriptor = internal_volume->master_directory_block->extents_file_fork_descriptor;
+		catalog_file_fork_descriptor = internal_volume->master_directory_block->catalog_file_fork_descriptor;
+#endif
+
+/* TODO impement classic HFS support */
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: classic HFS not supported.",
+		 function );
+
+		goto on_error;
+	}
+	else
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading volume header:\n" );
+		}
+#endif
+		if( libfshfs_volume_header_initialize(
+		     &( internal_volume->volume_header ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create volume header.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfshfs_volume_header_read_file_io_handle(
+		     internal_volume->volume_header,
+		     file_io_handle,
+		     file_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read volume header at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+		if( internal_volume->io_handle->statistics != NULL )
+		{
+			if( libfshfs_statistics_add_read(
+			     internal_volume->io_handle->statistics,
+			     LIBFSHFS_STATISTICS_REGION_METADATA,
+			     (uint64_t) 1024,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to add read to statistics.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		internal_volume->io_handle->file_system_type = internal_volume->volume_header->file_system_type;
+		internal_volume->io_handle->block_size       = internal_volume->volume_header->allocation_block_size;
+
+		if( internal_volume->volume_header->file_system_type == LIBFSHFS_FILE_SYSTEM_TYPE_HFS_PLUS )
+		{
+			use_case_folding = 1;
+		}
+		extents_file_fork_descriptor    = internal_volume->volume_header->extents_file_fork_descriptor;
+		catalog_file_fork_descriptor    = internal_volume->volume_header->catalog_file_fork_descriptor;
+		attributes_file_fork_descriptor = internal_volume->volume_header->attributes_file_fork_descriptor;
+	}
+	if( libfshfs_file_system_initialize(
+	     &( internal_volume->file_system ),
+	     use_case_folding,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file system.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_volume->use_lazy_open != 0 )
+	{
+		if( libfshfs_file_system_set_deferred_files(
+		     internal_volume->file_system,
+		     internal_volume->io_handle,
+		     extents_file_fork_descriptor,
+		     attributes_file_fork_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set deferred B-tree files.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading extents B-tree file:\n" );
+		}
+#endif
+		if( libfshfs_file_system_read_extents_file(
+		     internal_volume->file_system,
+		     internal_volume->io_handle,
+		     file_io_handle,
+		     extents_file_fork_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to read extents B-tree file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading catalog B-tree file:\n" );
+	}
+#endif
+	if( libfshfs_file_system_read_catalog_file(
+	     internal_volume->file_system,
+	     internal_volume->io_handle,
+	     file_io_handle,
+	     catalog_file_fork_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to read catalog B-tree file.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( internal_volume->use_lazy_open == 0 )
+	 && ( attributes_file_fork_descriptor != NULL ) )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading attributes B-tree file:\n" );
+		}
+#endif
+		if( libfshfs_file_system_read_attributes_file(
+		     internal_volume->file_system,
+		     internal_volume->io_handle,
+		     file_io_handle,
+		     attributes_file_fork_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to read attributes B-tree file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading root directory entry:\n" );
+	}
+#endif
+	result = libfshfs_file_system_get_directory_entry_by_identifier(
+	          internal_volume->file_system,
+	          internal_volume->io_handle,
+	          file_io_handle,
+	          LIBFSHFS_ROOT_DIRECTORY_IDENTIFIER,
+	          &( internal_volume->root_directory_entry ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root directory entry from catalog B-tree file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( internal_volume->root_directory_entry != NULL )
+	{
+		libfshfs_directory_entry_free(
+		 &( internal_volume->root_directory_entry ),
+		 NULL );
+	}
+	if( internal_volume->file_system != NULL )
+	{
+		libfshfs_file_system_free(
+		 &( internal_volume->file_system ),
+		 NULL );
+	}
+	if( internal_volume->master_directory_block != NULL )
+	{
+		libfshfs_master_directory_block_free(
+		 &( internal_volume->master_directory_block ),
+		 NULL );
+	}
+	if( internal_volume->volume_header != NULL )
+	{
+		libfshfs_volume_header_free(
+		 &( internal_volume->volume_header ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the file system type
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_volume_get_file_system_type(
+     libfshfs_volume_t *volume,
+     uint8_t *file_system_type,
+     libcerror_error_t **error )
+{
+	libfshfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfshfs_volume_get_file_system_type";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfshfs_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system type.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*file_system_type = internal_volume->io_handle->file_system_type;
+
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded name
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_volume_get_utf8_name_size(
+     libfshfs_volume_t *volume,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfshfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfshfs_volume_get_utf8_name_size";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfshfs_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->root_directory_entry != NULL )
+	{
+		result = libfshfs_directory_entry_get_utf8_name_size(
+		          internal_volume->root_directory_entry,
+		          utf8_string_size,
+		          error );
+	}
+	else
+	{
+		result = libfshfs_master_directory_block_get_utf8_volume_label_size(
+		          internal_volume->master_directory_block,
+		          utf8_string_size,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string size.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the UTF-8 encoded name
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_volume_get_utf8_name(
+     libfshfs_volume_t *volume,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfshfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfshfs_volume_get_utf8_name";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfshfs_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->root_directory_entry != NULL )
+	{
+		result = libfshfs_directory_entry_get_utf8_name(
+		          internal_volume->root_directory_entry,
+		          utf8_string,
+		          utf8_string_size,
+		          error );
+	}
+	else
+	{
+		result = libfshfs_master_directory_block_get_utf8_volume_label(
+		          internal_volume->master_directory_block,
+		          utf8_string,
+		          utf8_string_size,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the size of the UTF-16 encoded name
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_volume_get_utf16_name_size(
+     libfshfs_volume_t *volume,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfshfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfshfs_volume_get_utf16_name_size";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfshfs_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->root_directory_entry != NULL )
+	{
+		result = libfshfs_directory_entry_get_utf16_name_size(
+		          internal_volume->root_directory_entry,
+		          utf16_string_size,
+		          error );
+	}
+	else
+	{
+		result = libfshfs_master_directory_block_get_utf16_volume_label_size(
+		          internal_volume->master_directory_block,
+		          utf16_string_size,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string size.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the UTF-16 encoded name
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_volume_get_utf16_name(
+     libfshfs_volume_t *volume,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfshfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfshfs_volume_get_utf16_name";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfshfs_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->root_directory_entry != NULL )
+	{
+		result = libfshfs_directory_entry_get_utf16_name(
+		          internal_volume->root_directory_entry,
+		          utf16_string,
+		          utf16_string_size,
+		          error );
+	}
+	else
+	{
+		result = libfshfs_master_directory_block_get_utf16_volume_label(
+		          internal_volume->master_directory_block,
+		          utf16_string,
+		          utf16_string_size,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the root directory file entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_volume_get_root_directory(
+     libfshfs_volume_t *volume,
+     libfshfs_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfshfs_directory_entry_t *safe_directory_entry = NULL;
+	libfshfs_internal_volume_t *internal_volume      = NULL;
+	static char *function                            = "libfshfs_volume_get_root_directory";
+	int result                                       = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfshfs_internal_volume_t *) volume;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfshfs_directory_entry_clone(
+	     &safe_directory_entry,
+	     internal_volume->root_directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to clone root directory entry.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		/* libfshfs_file_entry_initialize takes over management of directory_entry
+		 */
+		if( libfshfs_file_entry_initialize(
+		     file_entry,
+		     internal_volume->io_handle,
+		     internal_volume->file_io_handle,
+		     internal_volume->file_system,
+		     safe_directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file entry.",
+			 function );
+
+			libfshfs_directory_entry_free(
+			 &safe_directory_entry,
+			 NULL );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the file entry for a specific identifier (or catalog node identifier (CNID))
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfshfs_volume_get_file_entry_by_identifier(
+     libfshfs_volume_t *volume,
+     uint32_t identifier,
+     libfshfs_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfshfs_directory_entry_t *directory_entry = NULL;
+	libfshfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfshfs_volume_get_file_entry_by_identifier";
+	int result                                  = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfshfs_internal_volume_t *) volume;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfshfs_file_system_get_directory_entry_by_identifier(
+	          internal_volume->file_system,
+	          internal_volume->io_handle,
+	          internal_volume->file_io_handle,
+	          identifier,
+	          &directory_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entry: %" PRIu32 ".",
+		 function,
+		 identifier );
+
+		result = -1;
+	}
+	else if( result != 0 )
+	{
+		/* libfshfs_file_entry_initialize takes over management of directory_entry
+		 */
+		if( libfshfs_file_entry_initialize(
+		     file_entry,
+		     internal_volume->io_handle,
+		     internal_volume->file_io_handle,
+		     internal_volume->file_system,
+		     directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file entry.",
+			 function );
+
+			libfshfs_directory_entry_free(
+			 &directory_entry,
+			 NULL );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads the catalog index if not already read
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_internal_volume_read_catalog_index(
+     libfshfs_internal_volume_t *internal_volume,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_internal_volume_read_catalog_index";
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->file_system->catalog_index == NULL )
+	{
+		if( libfshfs_file_system_read_catalog_index(
+		     internal_volume->file_system,
+		     internal_volume->io_handle,
+		     internal_volume->file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read catalog index.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of file entries
+ * The file entries are determined with a single pass over the catalog B-tree file
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_volume_get_number_of_file_entries(
+     libfshfs_volume_t *volume,
+     int *number_of_file_entries,
+     libcerror_error_t **error )
+{
+	libfshfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfshfs_volume_get_number_of_file_entries";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfshfs_internal_volume_t *) volume;
+
+	if( number_of_file_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of file entries.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfshfs_internal_volume_read_catalog_index(
+	     internal_volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read catalog index.",
+		 function );
+
+		result = -1;
+	}
+	else if( libfshfs_file_system_get_number_of_directory_entries(
+	          internal_volume->file_system,
+	          number_of_file_entries,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of directory entries.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the identifier of a specific file entry
+ * The file entries are sorted by identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_volume_get_file_entry_identifier_by_index(
+     libfshfs_volume_t *volume,
+     int file_entry_index,
+     uint32_t *identifier,
+     libcerror_error_t **error )
+{
+	libfshfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfshfs_volume_get_file_entry_identifier_by_index";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfshfs_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfshfs_internal_volume_read_catalog_index(
+	     internal_volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read catalog index.",
+		 function );
+
+		result = -1;
+	}
+	else if( libfshfs_file_system_get_directory_entry_identifier_by_index(
+	          internal_volume->file_system,
+	          file_entry_index,
+	          identifier,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve identifier of directory entry: %d.",
+		 function,
+		 file_entry_index );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the file entry for an UTF-8 encoded path
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
+ */
+int libfshfs_volume_get_file_entry_by_utf8_path(
+     libfshfs_volume_t *volume,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfshfs_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfshfs_directory_entry_t *directory_entry = NULL;
+	libfshfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfshfs_volume_get_file_entry_by_utf8_path";
+	int result                                  = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfshfs_internal_volume_t *) volume;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfshfs_file_system_get_directory_entry_by_utf8_path(
+	          internal_volume->file_system,
+	          internal_volume->io_handle,
+	          internal_volume->file_io_handle,
+	          utf8_string,
+	          utf8_string_length,
+	          &directory_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entry.",
+		 function );
+
+		result = -1;
+	}
+	else if( result != 0 )
+	{
+		/* libfshfs_file_entry_initialize takes over management of directory_entry
+		 */
+		if( libfshfs_file_entry_initialize(
+		     file_entry,
+		     internal_volume->io_handle,
+		     internal_volume->file_io_handle,
+		     internal_volume->file_system,
+		     directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file entry.",
+			 function );
+
+			libfshfs_directory_entry_free(
+			 &directory_entry,
+			 NULL );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		libfshfs_file_entry_free(
+		 file_entry,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the file entry for an UTF-16 encoded path
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
+ */
+int libfshfs_volume_get_file_entry_by_utf16_path(
+     libfshfs_volume_t *volume,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libfshfs_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfshfs_directory_entry_t *directory_entry = NULL;
+	libfshfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfshfs_volume_get_file_entry_by_utf16_path";
+	int result                                  = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfshfs_internal_volume_t *) volume;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfshfs_file_system_get_directory_entry_by_utf16_path(
+	          internal_volume->file_system,
+	          internal_volume->io_handle,
+	          internal_volume->file_io_handle,
+	          utf16_string,
+	          utf16_string_length,
+	          &directory_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entry.",
+		 function );
+
+		result = -1;
+	}
+	else if( result != 0 )
+	{
+		/* libfshfs_file_entry_initialize takes over management of directory_entry
+		 */
+		if( libfshfs_file_entry_initialize(
+		     file_entry,
+		     internal_volume->io_handle,
+		     internal_volume->file_io_handle,
+		     internal_volume->file_system,
+		     directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file entry.",
+			 function );
+
+			libfshfs_directory_entry_free(
+			 &directory_entry,
+			 NULL );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		libfshfs_file_entry_free(
+		 file_entry,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the file entries of lookup targets
+ * The lookup targets are sorted by catalog key while they are looked up
+ * File entries of lookup targets that are not available are set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_internal_volume_get_file_entries_by_lookup_targets(
+     libfshfs_internal_volume_t *internal_volume,
+     libfshfs_lookup_target_t *lookup_targets,
+     int number_of_lookup_targets,
+     libfshfs_file_entry_t **file_entries,
+     libcerror_error_t **error )
+{
+	libfshfs_lookup_target_t *lookup_target = NULL;
+	static char *function                   = "libfshfs_internal_volume_get_file_entries_by_lookup_targets";
+	int lookup_target_index                 = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( lookup_targets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lookup targets.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_lookup_targets < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of lookup targets value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfshfs_file_system_get_directory_entries_by_lookup_targets(
+	     internal_volume->file_system,
+	     internal_volume->io_handle,
+	     internal_volume->file_io_handle,
+	     lookup_targets,
+	     number_of_lookup_targets,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entries of lookup targets.",
+		 function );
+
+		return( -1 );
+	}
+	for( lookup_target_index = 0;
+	     lookup_target_index < number_of_lookup_targets;
+	     lookup_target_index++ )
+	{
+		lookup_target = &( lookup_targets[ lookup_target_index ] );
+
+		if( lookup_target->directory_entry == NULL )
+		{
+			continue;
+		}
+		/* libfshfs_file_entry_initialize takes over management of directory_entry
+		 */
+		if( libfshfs_file_entry_initialize(
+		     &( file_entries[ lookup_target->index ] ),
+		     internal_volume->io_handle,
+		     internal_volume->file_io_handle,
+		     internal_volume->file_system,
+		     lookup_target->directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file entry of lookup target: %d.",
+			 function,
+			 lookup_target->index );
+
+			return( -1 );
+		}
+		lookup_target->directory_entry = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves the file entries for specific identifiers (or catalog node identifiers (CNIDs))
+ * The file entries array must contain number_of_identifiers elements
+ * The identifiers are looked up in the order of their thread records and then
+ * in the order of their catalog keys, so that identifiers with records that are
+ * stored in the same leaf node of the catalog B-tree share the lookup of that node
+ * File entries of identifiers that are not available are set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_volume_get_file_entries_by_identifiers(
+     libfshfs_volume_t *volume,
+     const uint32_t *identifiers,
+     int number_of_identifiers,
+     libfshfs_file_entry_t **file_entries,
+     libcerror_error_t **error )
+{
+	libfshfs_internal_volume_t *internal_volume = NULL;
+	libfshfs_lookup_target_t *lookup_targets    = NULL;
+	static char *function                       = "libfshfs_volume_get_file_entries_by_identifiers";
+	int identifier_index                        = 0;
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfshfs_internal_volume_t *) volume;
+
+	if( identifiers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifiers.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_identifiers < 0 )
+	 || ( (size_t) number_of_identifiers > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfshfs_lookup_target_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of identifiers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_identifiers == 0 )
+	{
+		return( 1 );
+	}
+	if( memory_set(
+	     file_entries,
+	     0,
+	     sizeof( libfshfs_file_entry_t * ) * number_of_identifiers ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file entries.",
+		 function );
+
+		return( -1 );
+	}
+	lookup_targets = (libfshfs_lookup_target_t *) memory_allocate(
+	                                               sizeof( libfshfs_lookup_target_t ) * number_of_identifiers );
+
+	if( lookup_targets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create lookup targets.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     lookup_targets,
+	     0,
+	     sizeof( libfshfs_lookup_target_t ) * number_of_identifiers ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear lookup targets.",
+		 function );
+
+		memory_free(
+		 lookup_targets );
+
+		return( -1 );
+	}
+	for( identifier_index = 0;
+	     identifier_index < number_of_identifiers;
+	     identifier_index++ )
+	{
+		lookup_targets[ identifier_index ].identifier = identifiers[ identifier_index ];
+		lookup_targets[ identifier_index ].index      = identifier_index;
+	}
+
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		memory_free(
+		 lookup_targets );
+
 		return( -1 );
 	}
 #endif
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( libfshfs_internal_volume_get_file_entries_by_lookup_targets(
+	     internal_volume,
+	     lookup_targets,
+	     number_of_identifiers,
+	     file_entries,
+	     error ) != 1 )
 	{
-		if( internal_volume->file_io_handle_created_in_library != 0 )
-		{
-			if( libfshfs_debug_print_read_offsets(
-			     internal_volume->file_io_handle,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print the read offsets.",
-				 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entries.",
+		 function );
 
-				result = -1;
-			}
-		}
+		result = -1;
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		result = -1;
 	}
 #endif
-	if( internal_volume->file_io_handle_opened_in_library != 0 )
+	for( identifier_index = 0;
+	     identifier_index < number_of_identifiers;
+	     identifier_index++ )
 	{
-		if( libbfio_handle_close(
-		     internal_volume->file_io_handle,
-		     error ) != 0 )
+		if( libfshfs_lookup_target_clear(
+		     &( lookup_targets[ identifier_index ] ),
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close file IO handle.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear lookup target: %d.",
+			 function,
+			 identifier_index );
 
 			result = -1;
 		}
-		internal_volume->file_io_handle_opened_in_library = 0;
 	}
-	if( internal_volume->file_io_handle_created_in_library != 0 )
+	memory_free(
+	 lookup_targets );
+
+	if( result != 1 )
 	{
-		if( libbfio_handle_free(
-		     &( internal_volume->file_io_handle ),
-		     error ) != 1 )
+		for( identifier_index = 0;
+		     identifier_index < number_of_identifiers;
+		     identifier_index++ )
+		{
+			if( file_entries[ identifier_index ] != NULL )
+			{
+				libfshfs_file_entry_free(
+				 &( file_entries[ identifier_index ] ),
+				 NULL );
+			}
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the file entries for UTF-8 encoded paths
+ * The file entries array must contain number_of_paths elements
+ * The paths are looked up one path segment at a time in the order of the catalog
+ * keys of the segments, so that segments with records that are stored in the same
+ * leaf node of the catalog B-tree share the lookup of that node
+ * File entries of paths that are not available are set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_volume_get_file_entries_by_utf8_paths(
+     libfshfs_volume_t *volume,
+     const uint8_t **utf8_strings,
+     const size_t *utf8_string_lengths,
+     int number_of_paths,
+     libfshfs_file_entry_t **file_entries,
+     libcerror_error_t **error )
+{
+	libfshfs_internal_volume_t *internal_volume = NULL;
+	libfshfs_lookup_target_t *lookup_targets    = NULL;
+	static char *function                       = "libfshfs_volume_get_file_entries_by_utf8_paths";
+	int path_index                              = 0;
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfshfs_internal_volume_t *) volume;
+
+	if( utf8_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_lengths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string lengths.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_paths < 0 )
+	 || ( (size_t) number_of_paths > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfshfs_lookup_target_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of paths value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entries.",
+		 function );
+
+		return( -1 );
+	}
+	for( path_index = 0;
+	     path_index < number_of_paths;
+	     path_index++ )
+	{
+		if( utf8_strings[ path_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid UTF-8 string: %d.",
+			 function,
+			 path_index );
+
+			return( -1 );
+		}
+		if( utf8_string_lengths[ path_index ] > (size_t) SSIZE_MAX )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free file IO handle.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid UTF-8 string: %d length value exceeds maximum.",
+			 function,
+			 path_index );
 
-			result = -1;
+			return( -1 );
 		}
-		internal_volume->file_io_handle_created_in_library = 0;
 	}
-	internal_volume->file_io_handle = NULL;
+	if( number_of_paths == 0 )
+	{
+		return( 1 );
+	}
+	if( memory_set(
+	     file_entries,
+	     0,
+	     sizeof( libfshfs_file_entry_t * ) * number_of_paths ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file entries.",
+		 function );
 
-	if( libfshfs_io_handle_clear(
-	     internal_volume->io_handle,
+		return( -1 );
+	}
+	lookup_targets = (libfshfs_lookup_target_t *) memory_allocate(
+	                                               sizeof( libfshfs_lookup_target_t ) * number_of_paths );
+
+	if( lookup_targets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create lookup targets.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     lookup_targets,
+	     0,
+	     sizeof( libfshfs_lookup_target_t ) * number_of_paths ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear lookup targets.",
+		 function );
+
+		memory_free(
+		 lookup_targets );
+
+		return( -1 );
+	}
+	for( path_index = 0;
+	     path_index < number_of_paths;
+	     path_index++ )
+	{
+		lookup_targets[ path_index ].utf8_path        = utf8_strings[ path_index ];
+		lookup_targets[ path_index ].utf8_path_length = utf8_string_lengths[ path_index ];
+		lookup_targets[ path_index ].index            = path_index;
+	}
+
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to clear IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		memory_free(
+		 lookup_targets );
+
+		return( -1 );
+	}
+#endif
+	if( libfshfs_internal_volume_get_file_entries_by_lookup_targets(
+	     internal_volume,
+	     lookup_targets,
+	     number_of_paths,
+	     file_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entries.",
 		 function );
 
 		result = -1;
 	}
-	if( internal_volume->volume_header != NULL )
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
 	{
-		if( libfshfs_volume_header_free(
-		     &( internal_volume->volume_header ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free volume header.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
 
-			result = -1;
-		}
+		result = -1;
 	}
-	if( internal_volume->master_directory_block != NULL )
+#endif
+	for( path_index = 0;
+	     path_index < number_of_paths;
+	     path_index++ )
 	{
-		if( libfshfs_master_directory_block_free(
-		     &( internal_volume->master_directory_block ),
+		if( libfshfs_lookup_target_clear(
+		     &( lookup_targets[ path_index ] ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free master directory block.",
-			 function );
+			 "%s: unable to clear lookup target: %d.",
+			 function,
+			 path_index );
 
 			result = -1;
 		}
 	}
-	if( internal_volume->file_system != NULL )
+	memory_free(
+	 lookup_targets );
+
+	if( result != 1 )
 	{
-		if( libfshfs_file_system_free(
-		     &( internal_volume->file_system ),
-		     error ) != 1 )
+		for( path_index = 0;
+		     path_index < number_of_paths;
+		     path_index++ )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free file system.",
-			 function );
-
-			result = -1;
+			if( file_entries[ path_index ] != NULL )
+			{
+				libfshfs_file_entry_free(
+				 &( file_entries[ path_index ] ),
+				 NULL );
+			}
 		}
 	}
-	if( internal_volume->root_directory_entry != NULL )
+	return( result );
+}
+
+/* Reads the attributes index
+ * The attributes index is read with a single pass over the attributes B-tree file
+ * and speeds up retrieving the extended attributes of many file entries
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_volume_read_attributes_index(
+     libfshfs_volume_t *volume,
+     libcerror_error_t **error )
+{
+	libfshfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfshfs_volume_read_attributes_index";
+	int result                                  = 1;
+
+	if( volume == NULL )
 	{
-		if( libfshfs_directory_entry_free(
-		     &( internal_volume->root_directory_entry ),
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfshfs_internal_volume_t *) volume;
+
+	if( internal_volume->file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing file system.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->file_system->attributes_index == NULL )
+	{
+		if( libfshfs_file_system_read_attributes_index(
+		     internal_volume->file_system,
+		     internal_volume->file_io_handle,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free root directory entry.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read attributes index.",
 			 function );
 
 			result = -1;
@@ -971,26 +3963,20 @@ int libfshfs_volume_close(
 	return( result );
 }
 
-/* Opens a volume for reading
+/* Reads the indirect node index
+ * The indirect node index is read with a single pass over the children of the private
+ * directories and speeds up resolving the targets of many hard links
  * Returns 1 if successful or -1 on error
  */
-int libfshfs_internal_volume_open_read(
-     libfshfs_internal_volume_t *internal_volume,
-     libbfio_handle_t *file_io_handle,
-     off64_t file_offset,
+int libfshfs_volume_read_indirect_node_index(
+     libfshfs_volume_t *volume,
      libcerror_error_t **error )
 {
-	uint8_t signature[ 2 ];
-
-	libfshfs_fork_descriptor_t *attributes_file_fork_descriptor = NULL;
-	libfshfs_fork_descriptor_t *catalog_file_fork_descriptor    = NULL;
-	libfshfs_fork_descriptor_t *extents_file_fork_descriptor    = NULL;
-	static char *function                                       = "libfshfs_internal_volume_open_read";
-	ssize_t read_count                                          = 0;
-	uint8_t use_case_folding                                    = 0;
-	int result                                                  = 0;
+	libfshfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfshfs_volume_read_indirect_node_index";
+	int result                                  = 1;
 
-	if( internal_volume == NULL )
+	if( volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1001,301 +3987,319 @@ int libfshfs_internal_volume_open_read(
 
 		return( -1 );
 	}
-	if( internal_volume->io_handle == NULL )
+	internal_volume = (libfshfs_internal_volume_t *) volume;
+
+	if( internal_volume->file_system == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid volume - missing IO handle.",
+		 "%s: invalid volume - missing file system.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_volume->volume_header != NULL )
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid volume - volume header value already set.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_volume->master_directory_block != NULL )
+#endif
+	if( internal_volume->file_system->indirect_node_index == NULL )
+	{
+		if( libfshfs_file_system_read_indirect_node_index(
+		     internal_volume->file_system,
+		     internal_volume->io_handle,
+		     internal_volume->file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read indirect node index.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid volume - master directory block value already set.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_volume->file_system != NULL )
+#endif
+	return( result );
+}
+
+/* Iterates over the directory and file records in the catalog
+ * The catalog B-tree leaf nodes are read sequentially, without creating file entries
+ * The callback function is called for every directory and file record with
+ * the parent identifier, the name data as stored in the catalog and the stat values
+ * of the record. The name data and stat values are only valid during the callback
+ * The callback function should return 1 to continue, 0 to stop or -1 on error
+ * The callback function is called with the volume write lock held, since the name data
+ * references the cached catalog B-tree nodes. It must not call libfshfs_volume functions
+ * on the same volume
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_volume_iterate_catalog_records(
+     libfshfs_volume_t *volume,
+     int (*callback_function)(
+            uint32_t parent_identifier,
+            const uint8_t *name_data,
+            size_t name_size,
+            const libfshfs_file_entry_stat_t *stat_value,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libfshfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfshfs_volume_iterate_catalog_records";
+	int result                                  = 1;
+
+	if( volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid volume - file system value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_volume->root_directory_entry != NULL )
+	internal_volume = (libfshfs_internal_volume_t *) volume;
+
+	if( internal_volume->file_system == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid volume - root directory entry value already set.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing file system.",
 		 function );
 
 		return( -1 );
 	}
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              file_io_handle,
-	              signature,
-	              2,
-	              file_offset,
-	              error );
-
-	if( read_count != 2 )
+	if( callback_function == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read signature at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 file_offset,
-		 file_offset );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( memory_compare(
-	     "BD",
-	     signature,
-	     2 ) == 0 )
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "Reading master directory block:\n" );
-		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
 #endif
-		if( libfshfs_master_directory_block_initialize(
-		     &( internal_volume->master_directory_block ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create master directory block.",
-			 function );
+	if( libfshfs_file_system_iterate_catalog_records(
+	     internal_volume->file_system,
+	     internal_volume->io_handle,
+	     internal_volume->file_io_handle,
+	     callback_function,
+	     callback_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to iterate catalog records.",
+		 function );
 
-			goto on_error;
-		}
-		if( libfshfs_master_directory_block_read_file_io_handle(
-		     internal_volume->master_directory_block,
-		     file_io_handle,
-		     file_offset,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read master directory block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-			 function,
-			 file_offset,
-			 file_offset );
+		result = -1;
+	}
+#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
 
-			goto on_error;
-		}
-		internal_volume->io_handle->file_system_type = LIBFSHFS_FILE_SYSTEM_TYPE_HFS;
-		internal_volume->io_handle->block_size       = 512;
+		return( -1 );
+	}
+#endif
+	return( result );
+}
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		use_case_folding = 1;
+/* Reads the allocation bitmap if not already read
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_internal_volume_read_allocation_bitmap(
+     libfshfs_internal_volume_t *internal_volume,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *extents = NULL;
+	libfdata_stream_t *stream = NULL;
+	static char *function     = "libfshfs_internal_volume_read_allocation_bitmap";
 
-		extents_file_fork_descriptor = internal_volume->master_directory_block->extents_file_fork_descriptor;
-		catalog_file_fork_descriptor = internal_volume->master_directory_block->catalog_file_fork_descriptor;
-#endif
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
 
-/* TODO impement classic HFS support */
+		return( -1 );
+	}
+	if( internal_volume->allocation_bitmap != NULL )
+	{
+		return( 1 );
+	}
+	/* The HFS volume bitmap is stored in the blocks following the master directory block
+	 * and not in an allocation file
+	 */
+	if( internal_volume->volume_header == NULL )
+	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: classic HFS not supported.",
+		 "%s: unsupported volume - missing volume header.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	else
+	if( internal_volume->volume_header->allocation_file_fork_descriptor == NULL )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "Reading volume header:\n" );
-		}
-#endif
-		if( libfshfs_volume_header_initialize(
-		     &( internal_volume->volume_header ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create volume header.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfshfs_volume_header_read_file_io_handle(
-		     internal_volume->volume_header,
-		     file_io_handle,
-		     file_offset,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read volume header at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-			 function,
-			 file_offset,
-			 file_offset );
-
-			goto on_error;
-		}
-		internal_volume->io_handle->file_system_type = internal_volume->volume_header->file_system_type;
-		internal_volume->io_handle->block_size       = internal_volume->volume_header->allocation_block_size;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - invalid volume header - missing allocation file fork descriptor.",
+		 function );
 
-		if( internal_volume->volume_header->file_system_type == LIBFSHFS_FILE_SYSTEM_TYPE_HFS_PLUS )
-		{
-			use_case_folding = 1;
-		}
-		extents_file_fork_descriptor    = internal_volume->volume_header->extents_file_fork_descriptor;
-		catalog_file_fork_descriptor    = internal_volume->volume_header->catalog_file_fork_descriptor;
-		attributes_file_fork_descriptor = internal_volume->volume_header->attributes_file_fork_descriptor;
+		return( -1 );
 	}
-	if( libfshfs_file_system_initialize(
-	     &( internal_volume->file_system ),
-	     use_case_folding,
+	if( libfshfs_file_system_get_extents(
+	     internal_volume->file_system,
+	     internal_volume->file_io_handle,
+	     LIBFSHFS_ALLOCATION_FILE_IDENTIFIER,
+	     LIBFSHFS_FORK_TYPE_DATA,
+	     internal_volume->volume_header->allocation_file_fork_descriptor,
+	     &extents,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file system.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve extents of allocation file.",
 		 function );
 
 		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "Reading extents B-tree file:\n" );
-	}
-#endif
-	if( libfshfs_file_system_read_extents_file(
-	     internal_volume->file_system,
+	if( libfshfs_allocation_block_stream_initialize_from_extents(
+	     &stream,
 	     internal_volume->io_handle,
-	     file_io_handle,
-	     extents_file_fork_descriptor,
+	     extents,
+	     (size64_t) internal_volume->volume_header->allocation_file_fork_descriptor->size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to read extents B-tree file.",
+		 "%s: unable to create allocation file data stream.",
 		 function );
 
 		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "Reading catalog B-tree file:\n" );
-	}
-#endif
-	if( libfshfs_file_system_read_catalog_file(
-	     internal_volume->file_system,
-	     internal_volume->io_handle,
-	     file_io_handle,
-	     catalog_file_fork_descriptor,
+	if( libfshfs_allocation_bitmap_initialize(
+	     &( internal_volume->allocation_bitmap ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to read catalog B-tree file.",
+		 "%s: unable to create allocation bitmap.",
 		 function );
 
 		goto on_error;
 	}
-	if( attributes_file_fork_descriptor != NULL )
+	if( libfshfs_allocation_bitmap_read_data_stream(
+	     internal_volume->allocation_bitmap,
+	     internal_volume->file_io_handle,
+	     stream,
+	     internal_volume->volume_header->number_of_blocks,
+	     error ) != 1 )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "Reading attributes B-tree file:\n" );
-		}
-#endif
-		if( libfshfs_file_system_read_attributes_file(
-		     internal_volume->file_system,
-		     internal_volume->io_handle,
-		     file_io_handle,
-		     attributes_file_fork_descriptor,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to read attributes B-tree file.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read allocation bitmap.",
+		 function );
 
-			goto on_error;
-		}
+		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( libfdata_stream_free(
+	     &stream,
+	     error ) != 1 )
 	{
-		libcnotify_printf(
-		 "Reading root directory entry:\n" );
-	}
-#endif
-	result = libfshfs_file_system_get_directory_entry_by_identifier(
-	          internal_volume->file_system,
-	          internal_volume->io_handle,
-	          file_io_handle,
-	          LIBFSHFS_ROOT_DIRECTORY_IDENTIFIER,
-	          &( internal_volume->root_directory_entry ),
-	          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free allocation file data stream.",
+		 function );
 
-	if( result == -1 )
+		goto on_error;
+	}
+	if( libcdata_array_free(
+	     &extents,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfshfs_extent_free,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve root directory entry from catalog B-tree file.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free extents array.",
 		 function );
 
 		goto on_error;
@@ -1303,44 +4307,39 @@ int libfshfs_internal_volume_open_read(
 	return( 1 );
 
 on_error:
-	if( internal_volume->root_directory_entry != NULL )
-	{
-		libfshfs_directory_entry_free(
-		 &( internal_volume->root_directory_entry ),
-		 NULL );
-	}
-	if( internal_volume->file_system != NULL )
+	if( internal_volume->allocation_bitmap != NULL )
 	{
-		libfshfs_file_system_free(
-		 &( internal_volume->file_system ),
+		libfshfs_allocation_bitmap_free(
+		 &( internal_volume->allocation_bitmap ),
 		 NULL );
 	}
-	if( internal_volume->master_directory_block != NULL )
+	if( stream != NULL )
 	{
-		libfshfs_master_directory_block_free(
-		 &( internal_volume->master_directory_block ),
+		libfdata_stream_free(
+		 &stream,
 		 NULL );
 	}
-	if( internal_volume->volume_header != NULL )
+	if( extents != NULL )
 	{
-		libfshfs_volume_header_free(
-		 &( internal_volume->volume_header ),
+		libcdata_array_free(
+		 &extents,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfshfs_extent_free,
 		 NULL );
 	}
 	return( -1 );
 }
 
-/* Retrieves the size of the UTF-8 encoded name
- * The returned size includes the end of string character
+/* Retrieves the number of free (unallocated) blocks
+ * The number of free blocks is determined from the allocation bitmap
  * Returns 1 if successful or -1 on error
  */
-int libfshfs_volume_get_utf8_name_size(
+int libfshfs_volume_get_number_of_free_blocks(
      libfshfs_volume_t *volume,
-     size_t *utf8_string_size,
+     uint32_t *number_of_free_blocks,
      libcerror_error_t **error )
 {
 	libfshfs_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfshfs_volume_get_utf8_name_size";
+	static char *function                       = "libfshfs_volume_get_number_of_free_blocks";
 	int result                                  = 1;
 
 	if( volume == NULL )
@@ -1357,7 +4356,7 @@ int libfshfs_volume_get_utf8_name_size(
 	internal_volume = (libfshfs_internal_volume_t *) volume;
 
 #if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1365,39 +4364,41 @@ int libfshfs_volume_get_utf8_name_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( internal_volume->root_directory_entry != NULL )
-	{
-		result = libfshfs_directory_entry_get_utf8_name_size(
-		          internal_volume->root_directory_entry,
-		          utf8_string_size,
-		          error );
-	}
-	else
+	if( libfshfs_internal_volume_read_allocation_bitmap(
+	     internal_volume,
+	     error ) != 1 )
 	{
-		result = libfshfs_master_directory_block_get_utf8_volume_label_size(
-		          internal_volume->master_directory_block,
-		          utf8_string_size,
-		          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read allocation bitmap.",
+		 function );
+
+		result = -1;
 	}
-	if( result != 1 )
+	else if( libfshfs_allocation_bitmap_get_number_of_free_blocks(
+	          internal_volume->allocation_bitmap,
+	          number_of_free_blocks,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-8 string size.",
+		 "%s: unable to retrieve number of free blocks from allocation bitmap.",
 		 function );
 
 		result = -1;
 	}
 #if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1405,7 +4406,7 @@ int libfshfs_volume_get_utf8_name_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
@@ -1414,18 +4415,16 @@ int libfshfs_volume_get_utf8_name_size(
 	return( result );
 }
 
-/* Retrieves the UTF-8 encoded name
- * The size should include the end of string character
- * Returns 1 if successful or -1 on error
+/* Determines if a specific block is allocated
+ * Returns 1 if allocated, 0 if not or -1 on error
  */
-int libfshfs_volume_get_utf8_name(
+int libfshfs_volume_is_block_allocated(
      libfshfs_volume_t *volume,
-     uint8_t *utf8_string,
-     size_t utf8_string_size,
+     uint32_t block_number,
      libcerror_error_t **error )
 {
 	libfshfs_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfshfs_volume_get_utf8_name";
+	static char *function                       = "libfshfs_volume_is_block_allocated";
 	int result                                  = 1;
 
 	if( volume == NULL )
@@ -1442,7 +4441,7 @@ int libfshfs_volume_get_utf8_name(
 	internal_volume = (libfshfs_internal_volume_t *) volume;
 
 #if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1450,41 +4449,45 @@ int libfshfs_volume_get_utf8_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	if( internal_volume->root_directory_entry != NULL )
-	{
-		result = libfshfs_directory_entry_get_utf8_name(
-		          internal_volume->root_directory_entry,
-		          utf8_string,
-		          utf8_string_size,
-		          error );
-	}
-	else
-	{
-		result = libfshfs_master_directory_block_get_utf8_volume_label(
-		          internal_volume->master_directory_block,
-		          utf8_string,
-		          utf8_string_size,
-		          error );
-	}
-	if( result != 1 )
+#endif
+	if( libfshfs_internal_volume_read_allocation_bitmap(
+	     internal_volume,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-8 string.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read allocation bitmap.",
 		 function );
 
 		result = -1;
 	}
+	else
+	{
+		result = libfshfs_allocation_bitmap_is_block_allocated(
+		          internal_volume->allocation_bitmap,
+		          block_number,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if block: %" PRIu32 " is allocated.",
+			 function,
+			 block_number );
+		}
+	}
 #if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1492,7 +4495,7 @@ int libfshfs_volume_get_utf8_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
@@ -1501,17 +4504,20 @@ int libfshfs_volume_get_utf8_name(
 	return( result );
 }
 
-/* Retrieves the size of the UTF-16 encoded name
- * The returned size includes the end of string character
- * Returns 1 if successful or -1 on error
+/* Retrieves the next run of allocated or unallocated blocks, at or after a specific block
+ * Set is_allocated to 0 to retrieve a run of unallocated blocks
+ * Returns 1 if successful, 0 if no such run or -1 on error
  */
-int libfshfs_volume_get_utf16_name_size(
+int libfshfs_volume_get_next_block_run(
      libfshfs_volume_t *volume,
-     size_t *utf16_string_size,
+     uint32_t block_number,
+     uint8_t is_allocated,
+     uint32_t *run_block_number,
+     uint32_t *run_number_of_blocks,
      libcerror_error_t **error )
 {
 	libfshfs_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfshfs_volume_get_utf16_name_size";
+	static char *function                       = "libfshfs_volume_get_next_block_run";
 	int result                                  = 1;
 
 	if( volume == NULL )
@@ -1528,7 +4534,7 @@ int libfshfs_volume_get_utf16_name_size(
 	internal_volume = (libfshfs_internal_volume_t *) volume;
 
 #if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1536,39 +4542,48 @@ int libfshfs_volume_get_utf16_name_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( internal_volume->root_directory_entry != NULL )
-	{
-		result = libfshfs_directory_entry_get_utf16_name_size(
-		          internal_volume->root_directory_entry,
-		          utf16_string_size,
-		          error );
-	}
-	else
-	{
-		result = libfshfs_master_directory_block_get_utf16_volume_label_size(
-		          internal_volume->master_directory_block,
-		          utf16_string_size,
-		          error );
-	}
-	if( result != 1 )
+	if( libfshfs_internal_volume_read_allocation_bitmap(
+	     internal_volume,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-16 string size.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read allocation bitmap.",
 		 function );
 
 		result = -1;
 	}
+	else
+	{
+		result = libfshfs_allocation_bitmap_get_next_block_run(
+		          internal_volume->allocation_bitmap,
+		          block_number,
+		          is_allocated,
+		          run_block_number,
+		          run_number_of_blocks,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next block run after block: %" PRIu32 ".",
+			 function,
+			 block_number );
+		}
+	}
 #if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1576,7 +4591,7 @@ int libfshfs_volume_get_utf16_name_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
@@ -1585,21 +4600,22 @@ int libfshfs_volume_get_utf16_name_size(
 	return( result );
 }
 
-/* Retrieves the UTF-16 encoded name
- * The size should include the end of string character
- * Returns 1 if successful or -1 on error
+/* Retrieves the next unallocated block run
+ * The allocation bitmap is read if it was not read before
+ * The volume read/write lock is only held while retrieving the block run
+ * Returns 1 if successful, 0 if no such run or -1 on error
  */
-int libfshfs_volume_get_utf16_name(
-     libfshfs_volume_t *volume,
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
+int libfshfs_internal_volume_get_next_unallocated_block_run(
+     libfshfs_internal_volume_t *internal_volume,
+     uint32_t block_number,
+     uint32_t *run_block_number,
+     uint32_t *run_number_of_blocks,
      libcerror_error_t **error )
 {
-	libfshfs_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfshfs_volume_get_utf16_name";
-	int result                                  = 1;
+	static char *function = "libfshfs_internal_volume_get_next_unallocated_block_run";
+	int result            = 0;
 
-	if( volume == NULL )
+	if( internal_volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1610,10 +4626,8 @@ int libfshfs_volume_get_utf16_name(
 
 		return( -1 );
 	}
-	internal_volume = (libfshfs_internal_volume_t *) volume;
-
 #if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1621,41 +4635,48 @@ int libfshfs_volume_get_utf16_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( internal_volume->root_directory_entry != NULL )
-	{
-		result = libfshfs_directory_entry_get_utf16_name(
-		          internal_volume->root_directory_entry,
-		          utf16_string,
-		          utf16_string_size,
-		          error );
-	}
-	else
-	{
-		result = libfshfs_master_directory_block_get_utf16_volume_label(
-		          internal_volume->master_directory_block,
-		          utf16_string,
-		          utf16_string_size,
-		          error );
-	}
-	if( result != 1 )
+	if( libfshfs_internal_volume_read_allocation_bitmap(
+	     internal_volume,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-16 string.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read allocation bitmap.",
 		 function );
 
 		result = -1;
 	}
+	else
+	{
+		result = libfshfs_allocation_bitmap_get_next_block_run(
+		          internal_volume->allocation_bitmap,
+		          block_number,
+		          0,
+		          run_block_number,
+		          run_number_of_blocks,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve unallocated block run after block: %" PRIu32 ".",
+			 function,
+			 block_number );
+		}
+	}
 #if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1663,7 +4684,7 @@ int libfshfs_volume_get_utf16_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
@@ -1672,20 +4693,37 @@ int libfshfs_volume_get_utf16_name(
 	return( result );
 }
 
-/* Retrieves the root directory file entry
+/* Reads the unallocated blocks
+ * The volume read/write lock is not held while the blocks are read and while
+ * the callback function is called, so the callback function can use the volume
  * Returns 1 if successful or -1 on error
  */
-int libfshfs_volume_get_root_directory(
-     libfshfs_volume_t *volume,
-     libfshfs_file_entry_t **file_entry,
+int libfshfs_internal_volume_read_unallocated_blocks(
+     libfshfs_internal_volume_t *internal_volume,
+     size_t maximum_read_size,
+     int (*callback_function)(
+            off64_t volume_offset,
+            const uint8_t *data,
+            size_t data_size,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
      libcerror_error_t **error )
 {
-	libfshfs_directory_entry_t *safe_directory_entry = NULL;
-	libfshfs_internal_volume_t *internal_volume      = NULL;
-	static char *function                            = "libfshfs_volume_get_root_directory";
-	int result                                       = 1;
+	uint8_t *buffer               = NULL;
+	static char *function         = "libfshfs_internal_volume_read_unallocated_blocks";
+	size64_t run_size             = 0;
+	size_t read_size              = 0;
+	size_t buffer_size            = 0;
+	ssize_t read_count            = 0;
+	off64_t run_offset            = 0;
+	uint32_t block_number         = 0;
+	uint32_t run_block_number     = 0;
+	uint32_t run_number_of_blocks = 0;
+	uint8_t stop_reading          = 0;
+	int result                    = 0;
 
-	if( volume == NULL )
+	if( internal_volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1696,116 +4734,225 @@ int libfshfs_volume_get_root_directory(
 
 		return( -1 );
 	}
-	internal_volume = (libfshfs_internal_volume_t *) volume;
-
-	if( file_entry == NULL )
+	if( internal_volume->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file entry.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( *file_entry != NULL )
+	if( internal_volume->io_handle->block_size == 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file entry value already set.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid volume - invalid IO handle - block size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	if( ( maximum_read_size == 0 )
+	 || ( maximum_read_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum read size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	if( libfshfs_directory_entry_clone(
-	     &safe_directory_entry,
-	     internal_volume->root_directory_entry,
-	     error ) != 1 )
+	if( callback_function == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to clone root directory entry.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
-	else
+	/* Read whole blocks so that the reads remain aligned with the allocation blocks
+	 */
+	buffer_size = maximum_read_size - ( maximum_read_size % internal_volume->io_handle->block_size );
+
+	if( buffer_size == 0 )
 	{
-		/* libfshfs_file_entry_initialize takes over management of directory_entry
-		 */
-		if( libfshfs_file_entry_initialize(
-		     file_entry,
-		     internal_volume->io_handle,
-		     internal_volume->file_io_handle,
-		     internal_volume->file_system,
-		     safe_directory_entry,
-		     error ) != 1 )
+		buffer_size = internal_volume->io_handle->block_size;
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * buffer_size );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	while( stop_reading == 0 )
+	{
+		if( internal_volume->io_handle->abort != 0 )
+		{
+			break;
+		}
+		result = libfshfs_internal_volume_get_next_unallocated_block_run(
+		          internal_volume,
+		          block_number,
+		          &run_block_number,
+		          &run_number_of_blocks,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create file entry.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve unallocated block run after block: %" PRIu32 ".",
+			 function,
+			 block_number );
 
-			libfshfs_directory_entry_free(
-			 &safe_directory_entry,
-			 NULL );
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		run_offset = (off64_t) run_block_number * internal_volume->io_handle->block_size;
+		run_size   = (size64_t) run_number_of_blocks * internal_volume->io_handle->block_size;
 
-			result = -1;
+		while( run_size > 0 )
+		{
+			if( internal_volume->io_handle->abort != 0 )
+			{
+				break;
+			}
+			read_size = buffer_size;
+
+			if( (size64_t) read_size > run_size )
+			{
+				read_size = (size_t) run_size;
+			}
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              internal_volume->file_io_handle,
+			              buffer,
+			              read_size,
+			              run_offset,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read unallocated blocks at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 run_offset,
+				 run_offset );
+
+				goto on_error;
+			}
+			if( internal_volume->io_handle->statistics != NULL )
+			{
+				if( libfshfs_statistics_add_read(
+				     internal_volume->io_handle->statistics,
+				     LIBFSHFS_STATISTICS_REGION_DATA,
+				     (uint64_t) read_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to add read to statistics.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			result = callback_function(
+			          run_offset,
+			          buffer,
+			          read_size,
+			          callback_data,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: callback function failed for unallocated blocks at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 run_offset,
+				 run_offset );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				stop_reading = 1;
+
+				break;
+			}
+			run_offset += (off64_t) read_size;
+			run_size   -= (size64_t) read_size;
 		}
+		block_number = run_block_number + run_number_of_blocks;
 	}
-#if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+	memory_free(
+	 buffer );
 
-		return( -1 );
+	return( 1 );
+
+on_error:
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
 	}
-#endif
-	return( result );
+	return( -1 );
 }
 
-/* Retrieves the file entry for a specific identifier (or catalog node identifier (CNID))
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Reads the unallocated blocks
+ * The unallocated blocks are determined from the allocation bitmap. Every run
+ * of contiguous unallocated blocks is read with reads of at most the maximum
+ * read size, rounded down to a multiple of the block size.
+ * The callback function is called for every read with the offset of the data
+ * relative to the start of the volume. The data is only valid during the callback
+ * The callback function should return 1 to continue, 0 to stop or -1 on error
+ * The volume is only locked while the next run is determined, hence the
+ * callback function can use the volume
+ * Returns 1 if successful or -1 on error
  */
-int libfshfs_volume_get_file_entry_by_identifier(
+int libfshfs_volume_read_unallocated_blocks(
      libfshfs_volume_t *volume,
-     uint32_t identifier,
-     libfshfs_file_entry_t **file_entry,
+     size_t maximum_read_size,
+     int (*callback_function)(
+            off64_t volume_offset,
+            const uint8_t *data,
+            size_t data_size,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
      libcerror_error_t **error )
 {
-	libfshfs_directory_entry_t *directory_entry = NULL;
 	libfshfs_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfshfs_volume_get_file_entry_by_identifier";
-	int result                                  = 0;
+	static char *function                       = "libfshfs_volume_read_unallocated_blocks";
 
 	if( volume == NULL )
 	{
@@ -1820,121 +4967,40 @@ int libfshfs_volume_get_file_entry_by_identifier(
 	}
 	internal_volume = (libfshfs_internal_volume_t *) volume;
 
-	if( file_entry == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file entry.",
-		 function );
-
-		return( -1 );
-	}
-	if( *file_entry != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file entry value already set.",
-		 function );
-
-		return( -1 );
-	}
-#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
-		 function );
-
-		return( -1 );
-	}
-#endif
-	result = libfshfs_file_system_get_directory_entry_by_identifier(
-	          internal_volume->file_system,
-	          internal_volume->io_handle,
-	          internal_volume->file_io_handle,
-	          identifier,
-	          &directory_entry,
-	          error );
-
-	if( result == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve directory entry: %" PRIu32 ".",
-		 function,
-		 identifier );
-
-		result = -1;
-	}
-	else if( result != 0 )
-	{
-		/* libfshfs_file_entry_initialize takes over management of directory_entry
-		 */
-		if( libfshfs_file_entry_initialize(
-		     file_entry,
-		     internal_volume->io_handle,
-		     internal_volume->file_io_handle,
-		     internal_volume->file_system,
-		     directory_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create file entry.",
-			 function );
-
-			libfshfs_directory_entry_free(
-			 &directory_entry,
-			 NULL );
-
-			result = -1;
-		}
-	}
-#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_volume->read_write_lock,
+	if( libfshfs_internal_volume_read_unallocated_blocks(
+	     internal_volume,
+	     maximum_read_size,
+	     callback_function,
+	     callback_data,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read unallocated blocks.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	return( result );
+	return( 1 );
 }
 
-/* Retrieves the file entry for an UTF-8 encoded path
- * Returns 1 if successful, 0 if no such file entry or -1 on error
+/* Retrieves the statistics
+ * The statistics accumulate from the creation of the volume, over open and
+ * close, until they are reset. The statistics are a snapshot and are not exact
+ * when the volume is accessed by multiple threads, since reads that are in
+ * progress can be partially counted
+ * Returns 1 if successful or -1 on error
  */
-int libfshfs_volume_get_file_entry_by_utf8_path(
+int libfshfs_volume_get_statistics(
      libfshfs_volume_t *volume,
-     const uint8_t *utf8_string,
-     size_t utf8_string_length,
-     libfshfs_file_entry_t **file_entry,
+     libfshfs_volume_statistics_t *statistics,
      libcerror_error_t **error )
 {
-	libfshfs_directory_entry_t *directory_entry = NULL;
 	libfshfs_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfshfs_volume_get_file_entry_by_utf8_path";
-	int result                                  = 0;
+	static char *function                       = "libfshfs_volume_get_statistics";
+	int result                                  = 1;
 
 	if( volume == NULL )
 	{
@@ -1949,30 +5015,41 @@ int libfshfs_volume_get_file_entry_by_utf8_path(
 	}
 	internal_volume = (libfshfs_internal_volume_t *) volume;
 
-	if( file_entry == NULL )
+	if( internal_volume->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file entry.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( *file_entry != NULL )
+	if( internal_volume->io_handle->statistics == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file entry value already set.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - invalid IO handle - missing statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1980,60 +5057,28 @@ int libfshfs_volume_get_file_entry_by_utf8_path(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	result = libfshfs_file_system_get_directory_entry_by_utf8_path(
-	          internal_volume->file_system,
-	          internal_volume->io_handle,
-	          internal_volume->file_io_handle,
-	          utf8_string,
-	          utf8_string_length,
-	          &directory_entry,
-	          error );
-
-	if( result == -1 )
+	if( libfshfs_statistics_get_values(
+	     internal_volume->io_handle->statistics,
+	     statistics,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve directory entry.",
+		 "%s: unable to retrieve statistics values.",
 		 function );
 
 		result = -1;
 	}
-	else if( result != 0 )
-	{
-		/* libfshfs_file_entry_initialize takes over management of directory_entry
-		 */
-		if( libfshfs_file_entry_initialize(
-		     file_entry,
-		     internal_volume->io_handle,
-		     internal_volume->file_io_handle,
-		     internal_volume->file_system,
-		     directory_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create file entry.",
-			 function );
-
-			libfshfs_directory_entry_free(
-			 &directory_entry,
-			 NULL );
-
-			result = -1;
-		}
-	}
 #if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2041,33 +5086,25 @@ int libfshfs_volume_get_file_entry_by_utf8_path(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
-		libfshfs_file_entry_free(
-		 file_entry,
-		 NULL );
-
 		return( -1 );
 	}
 #endif
 	return( result );
 }
 
-/* Retrieves the file entry for an UTF-16 encoded path
- * Returns 1 if successful, 0 if no such file entry or -1 on error
+/* Resets the statistics
+ * Returns 1 if successful or -1 on error
  */
-int libfshfs_volume_get_file_entry_by_utf16_path(
+int libfshfs_volume_reset_statistics(
      libfshfs_volume_t *volume,
-     const uint16_t *utf16_string,
-     size_t utf16_string_length,
-     libfshfs_file_entry_t **file_entry,
      libcerror_error_t **error )
 {
-	libfshfs_directory_entry_t *directory_entry = NULL;
 	libfshfs_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfshfs_volume_get_file_entry_by_utf16_path";
-	int result                                  = 0;
+	static char *function                       = "libfshfs_volume_reset_statistics";
+	int result                                  = 1;
 
 	if( volume == NULL )
 	{
@@ -2082,24 +5119,13 @@ int libfshfs_volume_get_file_entry_by_utf16_path(
 	}
 	internal_volume = (libfshfs_internal_volume_t *) volume;
 
-	if( file_entry == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file entry.",
-		 function );
-
-		return( -1 );
-	}
-	if( *file_entry != NULL )
+	if( internal_volume->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file entry value already set.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
 		 function );
 
 		return( -1 );
@@ -2119,52 +5145,19 @@ int libfshfs_volume_get_file_entry_by_utf16_path(
 		return( -1 );
 	}
 #endif
-	result = libfshfs_file_system_get_directory_entry_by_utf16_path(
-	          internal_volume->file_system,
-	          internal_volume->io_handle,
-	          internal_volume->file_io_handle,
-	          utf16_string,
-	          utf16_string_length,
-	          &directory_entry,
-	          error );
-
-	if( result == -1 )
+	if( libfshfs_statistics_reset(
+	     internal_volume->io_handle->statistics,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve directory entry.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset statistics.",
 		 function );
 
 		result = -1;
 	}
-	else if( result != 0 )
-	{
-		/* libfshfs_file_entry_initialize takes over management of directory_entry
-		 */
-		if( libfshfs_file_entry_initialize(
-		     file_entry,
-		     internal_volume->io_handle,
-		     internal_volume->file_io_handle,
-		     internal_volume->file_system,
-		     directory_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create file entry.",
-			 function );
-
-			libfshfs_directory_entry_free(
-			 &directory_entry,
-			 NULL );
-
-			result = -1;
-		}
-	}
 #if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_volume->read_write_lock,
@@ -2177,10 +5170,6 @@ int libfshfs_volume_get_file_entry_by_utf16_path(
 		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		libfshfs_file_entry_free(
-		 file_entry,
-		 NULL );
-
 		return( -1 );
 	}
 #endif
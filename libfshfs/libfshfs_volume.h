@@ -30,13 +30,16 @@
 #include "libfshfs_btree_file.h"
 #include "libfshfs_directory_entry.h"
 
+#include "libfshfs_allocation_bitmap.h"
 #include "libfshfs_extern.h"
 #include "libfshfs_file_system.h"
 #include "libfshfs_io_handle.h"
 #include "libfshfs_libbfio.h"
 #include "libfshfs_libcerror.h"
 #include "libfshfs_libcthreads.h"
+#include "libfshfs_lookup_target.h"
 #include "libfshfs_master_directory_block.h"
+#include "libfshfs_memory_map.h"
 #include "libfshfs_types.h"
 #include "libfshfs_volume_header.h"
 
@@ -80,6 +83,23 @@ struct libfshfs_internal_volume
 	 */
 	libfshfs_directory_entry_t *root_directory_entry;
 
+	/* The allocation bitmap
+	 */
+	libfshfs_allocation_bitmap_t *allocation_bitmap;
+
+	/* Value to indicate if the volume file should be memory mapped
+	 */
+	uint8_t use_memory_mapping;
+
+	/* The memory map
+	 */
+	libfshfs_memory_map_t *memory_map;
+
+	/* Value to indicate if reading the extents and attributes B-tree files
+	 * should be deferred until first use
+	 */
+	uint8_t use_lazy_open;
+
 #if defined( HAVE_LIBFSHFS_MULTI_THREAD_SUPPORT )
 	/* The read/write lock
 	 */
@@ -102,6 +122,42 @@ int libfshfs_volume_signal_abort(
      libfshfs_volume_t *volume,
      libcerror_error_t **error );
 
+LIBFSHFS_EXTERN \
+int libfshfs_volume_get_maximum_read_ahead_size(
+     libfshfs_volume_t *volume,
+     size_t *maximum_read_ahead_size,
+     libcerror_error_t **error );
+
+LIBFSHFS_EXTERN \
+int libfshfs_volume_set_maximum_read_ahead_size(
+     libfshfs_volume_t *volume,
+     size_t maximum_read_ahead_size,
+     libcerror_error_t **error );
+
+LIBFSHFS_EXTERN \
+int libfshfs_volume_get_use_memory_mapping(
+     libfshfs_volume_t *volume,
+     uint8_t *use_memory_mapping,
+     libcerror_error_t **error );
+
+LIBFSHFS_EXTERN \
+int libfshfs_volume_set_use_memory_mapping(
+     libfshfs_volume_t *volume,
+     uint8_t use_memory_mapping,
+     libcerror_error_t **error );
+
+LIBFSHFS_EXTERN \
+int libfshfs_volume_get_use_lazy_open(
+     libfshfs_volume_t *volume,
+     uint8_t *use_lazy_open,
+     libcerror_error_t **error );
+
+LIBFSHFS_EXTERN \
+int libfshfs_volume_set_use_lazy_open(
+     libfshfs_volume_t *volume,
+     uint8_t use_lazy_open,
+     libcerror_error_t **error );
+
 LIBFSHFS_EXTERN \
 int libfshfs_volume_open(
      libfshfs_volume_t *volume,
@@ -127,6 +183,14 @@ int libfshfs_volume_open_file_io_handle(
      int access_flags,
      libcerror_error_t **error );
 
+LIBFSHFS_EXTERN \
+int libfshfs_volume_open_memory(
+     libfshfs_volume_t *volume,
+     const uint8_t *data,
+     size_t data_size,
+     int access_flags,
+     libcerror_error_t **error );
+
 LIBFSHFS_EXTERN \
 int libfshfs_volume_close(
      libfshfs_volume_t *volume,
@@ -138,6 +202,12 @@ int libfshfs_internal_volume_open_read(
      off64_t file_offset,
      libcerror_error_t **error );
 
+LIBFSHFS_EXTERN \
+int libfshfs_volume_get_file_system_type(
+     libfshfs_volume_t *volume,
+     uint8_t *file_system_type,
+     libcerror_error_t **error );
+
 LIBFSHFS_EXTERN \
 int libfshfs_volume_get_utf8_name_size(
      libfshfs_volume_t *volume,
@@ -177,6 +247,23 @@ int libfshfs_volume_get_file_entry_by_identifier(
      libfshfs_file_entry_t **file_entry,
      libcerror_error_t **error );
 
+int libfshfs_internal_volume_read_catalog_index(
+     libfshfs_internal_volume_t *internal_volume,
+     libcerror_error_t **error );
+
+LIBFSHFS_EXTERN \
+int libfshfs_volume_get_number_of_file_entries(
+     libfshfs_volume_t *volume,
+     int *number_of_file_entries,
+     libcerror_error_t **error );
+
+LIBFSHFS_EXTERN \
+int libfshfs_volume_get_file_entry_identifier_by_index(
+     libfshfs_volume_t *volume,
+     int file_entry_index,
+     uint32_t *identifier,
+     libcerror_error_t **error );
+
 LIBFSHFS_EXTERN \
 int libfshfs_volume_get_file_entry_by_utf8_path(
      libfshfs_volume_t *volume,
@@ -193,6 +280,121 @@ int libfshfs_volume_get_file_entry_by_utf16_path(
      libfshfs_file_entry_t **file_entry,
      libcerror_error_t **error );
 
+int libfshfs_internal_volume_get_file_entries_by_lookup_targets(
+     libfshfs_internal_volume_t *internal_volume,
+     libfshfs_lookup_target_t *lookup_targets,
+     int number_of_lookup_targets,
+     libfshfs_file_entry_t **file_entries,
+     libcerror_error_t **error );
+
+LIBFSHFS_EXTERN \
+int libfshfs_volume_get_file_entries_by_identifiers(
+     libfshfs_volume_t *volume,
+     const uint32_t *identifiers,
+     int number_of_identifiers,
+     libfshfs_file_entry_t **file_entries,
+     libcerror_error_t **error );
+
+LIBFSHFS_EXTERN \
+int libfshfs_volume_get_file_entries_by_utf8_paths(
+     libfshfs_volume_t *volume,
+     const uint8_t **utf8_strings,
+     const size_t *utf8_string_lengths,
+     int number_of_paths,
+     libfshfs_file_entry_t **file_entries,
+     libcerror_error_t **error );
+
+LIBFSHFS_EXTERN \
+int libfshfs_volume_read_attributes_index(
+     libfshfs_volume_t *volume,
+     libcerror_error_t **error );
+
+LIBFSHFS_EXTERN \
+int libfshfs_volume_read_indirect_node_index(
+     libfshfs_volume_t *volume,
+     libcerror_error_t **error );
+
+LIBFSHFS_EXTERN \
+int libfshfs_volume_iterate_catalog_records(
+     libfshfs_volume_t *volume,
+     int (*callback_function)(
+            uint32_t parent_identifier,
+            const uint8_t *name_data,
+            size_t name_size,
+            const libfshfs_file_entry_stat_t *stat_value,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libfshfs_internal_volume_read_allocation_bitmap(
+     libfshfs_internal_volume_t *internal_volume,
+     libcerror_error_t **error );
+
+LIBFSHFS_EXTERN \
+int libfshfs_volume_get_number_of_free_blocks(
+     libfshfs_volume_t *volume,
+     uint32_t *number_of_free_blocks,
+     libcerror_error_t **error );
+
+LIBFSHFS_EXTERN \
+int libfshfs_volume_is_block_allocated(
+     libfshfs_volume_t *volume,
+     uint32_t block_number,
+     libcerror_error_t **error );
+
+LIBFSHFS_EXTERN \
+int libfshfs_volume_get_next_block_run(
+     libfshfs_volume_t *volume,
+     uint32_t block_number,
+     uint8_t is_allocated,
+     uint32_t *run_block_number,
+     uint32_t *run_number_of_blocks,
+     libcerror_error_t **error );
+
+int libfshfs_internal_volume_get_next_unallocated_block_run(
+     libfshfs_internal_volume_t *internal_volume,
+     uint32_t block_number,
+     uint32_t *run_block_number,
+     uint32_t *run_number_of_blocks,
+     libcerror_error_t **error );
+
+int libfshfs_internal_volume_read_unallocated_blocks(
+     libfshfs_internal_volume_t *internal_volume,
+     size_t maximum_read_size,
+     int (*callback_function)(
+            off64_t volume_offset,
+            const uint8_t *data,
+            size_t data_size,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBFSHFS_EXTERN \
+int libfshfs_volume_read_unallocated_blocks(
+     libfshfs_volume_t *volume,
+     size_t maximum_read_size,
+     int (*callback_function)(
+            off64_t volume_offset,
+            const uint8_t *data,
+            size_t data_size,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBFSHFS_EXTERN \
+int libfshfs_volume_get_statistics(
+     libfshfs_volume_t *volume,
+     libfshfs_volume_statistics_t *statistics,
+     libcerror_error_t **error );
+
+LIBFSHFS_EXTERN \
+int libfshfs_volume_reset_statistics(
+     libfshfs_volume_t *volume,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
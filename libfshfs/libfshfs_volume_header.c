@@ -388,6 +388,10 @@ int libfshfs_volume_header_read_data(
 	 ( (fshfs_volume_header_t *) data )->allocation_block_size,
 	 volume_header->allocation_block_size );
 
+	byte_stream_copy_to_uint32_big_endian(
+	 ( (fshfs_volume_header_t *) data )->number_of_blocks,
+	 volume_header->number_of_blocks );
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -530,13 +534,10 @@ int libfshfs_volume_header_read_data(
 		 function,
 		 volume_header->allocation_block_size );
 
-		byte_stream_copy_to_uint32_big_endian(
-		 ( (fshfs_volume_header_t *) data )->number_of_blocks,
-		 value_32bit );
 		libcnotify_printf(
 		 "%s: number of blocks\t\t\t: %" PRIu32 "\n",
 		 function,
-		 value_32bit );
+		 volume_header->number_of_blocks );
 
 		byte_stream_copy_to_uint32_big_endian(
 		 ( (fshfs_volume_header_t *) data )->number_of_unused_blocks,
@@ -45,6 +45,10 @@ struct libfshfs_volume_header
 	 */
 	uint32_t allocation_block_size;
 
+	/* The number of (allocation) blocks
+	 */
+	uint32_t number_of_blocks;
+
 	/* Allocation file fork descriptor
 	 */
 	libfshfs_fork_descriptor_t *allocation_file_fork_descriptor;
@@ -0,0 +1,236 @@
+/*
+ * Worker file IO handle functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfshfs_libbfio.h"
+#include "libfshfs_libcerror.h"
+#include "libfshfs_worker_file_io_handle.h"
+
+/* Creates a worker file IO handle
+ * Make sure the value worker_file_io_handle is referencing, is set to NULL
+ * The source file IO handle is cloned so that a worker thread can read
+ * without sharing the offset of the source file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_worker_file_io_handle_initialize(
+     libfshfs_worker_file_io_handle_t **worker_file_io_handle,
+     libbfio_handle_t *source_file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function      = "libfshfs_worker_file_io_handle_initialize";
+	int file_io_handle_is_open = 0;
+
+	if( worker_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *worker_file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid worker file IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	*worker_file_io_handle = memory_allocate_structure(
+	                          libfshfs_worker_file_io_handle_t );
+
+	if( *worker_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create worker file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *worker_file_io_handle,
+	     0,
+	     sizeof( libfshfs_worker_file_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear worker file IO handle.",
+		 function );
+
+		memory_free(
+		 *worker_file_io_handle );
+
+		*worker_file_io_handle = NULL;
+
+		return( -1 );
+	}
+	if( libbfio_handle_clone(
+	     &( ( *worker_file_io_handle )->file_io_handle ),
+	     source_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to clone file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          ( *worker_file_io_handle )->file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if cloned file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     ( *worker_file_io_handle )->file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open cloned file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	( *worker_file_io_handle )->source_file_io_handle = source_file_io_handle;
+
+	return( 1 );
+
+on_error:
+	if( *worker_file_io_handle != NULL )
+	{
+		if( ( *worker_file_io_handle )->file_io_handle != NULL )
+		{
+			libbfio_handle_free(
+			 &( ( *worker_file_io_handle )->file_io_handle ),
+			 NULL );
+		}
+		memory_free(
+		 *worker_file_io_handle );
+
+		*worker_file_io_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a worker file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libfshfs_worker_file_io_handle_free(
+     libfshfs_worker_file_io_handle_t **worker_file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfshfs_worker_file_io_handle_free";
+	int result            = 1;
+
+	if( worker_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *worker_file_io_handle != NULL )
+	{
+		/* The source file IO handle is referenced and freed elsewhere
+		 */
+		if( libbfio_handle_close(
+		     ( *worker_file_io_handle )->file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close cloned file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		if( libbfio_handle_free(
+		     &( ( *worker_file_io_handle )->file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free cloned file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *worker_file_io_handle );
+
+		*worker_file_io_handle = NULL;
+	}
+	return( result );
+}
+
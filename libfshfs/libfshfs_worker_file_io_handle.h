@@ -0,0 +1,67 @@
+/*
+ * Worker file IO handle functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBFSHFS_WORKER_FILE_IO_HANDLE_H )
+#define _LIBFSHFS_WORKER_FILE_IO_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfshfs_libbfio.h"
+#include "libfshfs_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfshfs_worker_file_io_handle libfshfs_worker_file_io_handle_t;
+
+struct libfshfs_worker_file_io_handle
+{
+	/* The file IO handle that was cloned
+	 */
+	libbfio_handle_t *source_file_io_handle;
+
+	/* The cloned file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* Value to indicate the cloned file IO handle is used by a worker thread
+	 */
+	uint8_t is_in_use;
+};
+
+int libfshfs_worker_file_io_handle_initialize(
+     libfshfs_worker_file_io_handle_t **worker_file_io_handle,
+     libbfio_handle_t *source_file_io_handle,
+     libcerror_error_t **error );
+
+int libfshfs_worker_file_io_handle_free(
+     libfshfs_worker_file_io_handle_t **worker_file_io_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSHFS_WORKER_FILE_IO_HANDLE_H ) */
+
@@ -0,0 +1,1391 @@
+/*
+ * Library allocation_bitmap type test program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fshfs_test_libcerror.h"
+#include "fshfs_test_libfshfs.h"
+#include "fshfs_test_macros.h"
+#include "fshfs_test_memory.h"
+#include "fshfs_test_unused.h"
+
+#include "../libfshfs/libfshfs_allocation_bitmap.h"
+
+uint8_t fshfs_test_allocation_bitmap_data1[ 17 ] = {
+	0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0xff };
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+/* Tests the libfshfs_allocation_bitmap_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_allocation_bitmap_initialize(
+     void )
+{
+	libcerror_error_t *error                        = NULL;
+	libfshfs_allocation_bitmap_t *allocation_bitmap = NULL;
+	int result                                      = 0;
+
+#if defined( HAVE_FSHFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests                 = 1;
+	int number_of_memset_fail_tests                 = 1;
+	int test_number                                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfshfs_allocation_bitmap_initialize(
+	          &allocation_bitmap,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "allocation_bitmap",
+	 allocation_bitmap );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_allocation_bitmap_free(
+	          &allocation_bitmap,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "allocation_bitmap",
+	 allocation_bitmap );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_allocation_bitmap_initialize(
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	allocation_bitmap = (libfshfs_allocation_bitmap_t *) 0x12345678UL;
+
+	result = libfshfs_allocation_bitmap_initialize(
+	          &allocation_bitmap,
+	          &error );
+
+	allocation_bitmap = NULL;
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSHFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfshfs_allocation_bitmap_initialize with malloc failing
+		 */
+		fshfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfshfs_allocation_bitmap_initialize(
+		          &allocation_bitmap,
+		          &error );
+
+		if( fshfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fshfs_test_malloc_attempts_before_fail = -1;
+
+			if( allocation_bitmap != NULL )
+			{
+				libfshfs_allocation_bitmap_free(
+				 &allocation_bitmap,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSHFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSHFS_TEST_ASSERT_IS_NULL(
+			 "allocation_bitmap",
+			 allocation_bitmap );
+
+			FSHFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfshfs_allocation_bitmap_initialize with memset failing
+		 */
+		fshfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfshfs_allocation_bitmap_initialize(
+		          &allocation_bitmap,
+		          &error );
+
+		if( fshfs_test_memset_attempts_before_fail != -1 )
+		{
+			fshfs_test_memset_attempts_before_fail = -1;
+
+			if( allocation_bitmap != NULL )
+			{
+				libfshfs_allocation_bitmap_free(
+				 &allocation_bitmap,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSHFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSHFS_TEST_ASSERT_IS_NULL(
+			 "allocation_bitmap",
+			 allocation_bitmap );
+
+			FSHFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSHFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( allocation_bitmap != NULL )
+	{
+		libfshfs_allocation_bitmap_free(
+		 &allocation_bitmap,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_allocation_bitmap_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_allocation_bitmap_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfshfs_allocation_bitmap_free(
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_allocation_bitmap_get_population_count function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_allocation_bitmap_get_population_count(
+     void )
+{
+	uint32_t population_count = 0;
+
+	/* Test regular cases
+	 */
+	population_count = libfshfs_allocation_bitmap_get_population_count(
+	                    0 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "population_count",
+	 population_count,
+	 (uint32_t) 0 );
+
+	population_count = libfshfs_allocation_bitmap_get_population_count(
+	                    0x8000000000000101UL );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "population_count",
+	 population_count,
+	 (uint32_t) 3 );
+
+	population_count = libfshfs_allocation_bitmap_get_population_count(
+	                    UINT64_MAX );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "population_count",
+	 population_count,
+	 (uint32_t) 64 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfshfs_allocation_bitmap_get_leading_zero_count function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_allocation_bitmap_get_leading_zero_count(
+     void )
+{
+	uint32_t leading_zero_count = 0;
+
+	/* Test regular cases
+	 */
+	leading_zero_count = libfshfs_allocation_bitmap_get_leading_zero_count(
+	                      0 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "leading_zero_count",
+	 leading_zero_count,
+	 (uint32_t) 64 );
+
+	leading_zero_count = libfshfs_allocation_bitmap_get_leading_zero_count(
+	                      0x8000000000000000UL );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "leading_zero_count",
+	 leading_zero_count,
+	 (uint32_t) 0 );
+
+	leading_zero_count = libfshfs_allocation_bitmap_get_leading_zero_count(
+	                      0x0000000000100000UL );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "leading_zero_count",
+	 leading_zero_count,
+	 (uint32_t) 43 );
+
+	leading_zero_count = libfshfs_allocation_bitmap_get_leading_zero_count(
+	                      1 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "leading_zero_count",
+	 leading_zero_count,
+	 (uint32_t) 63 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfshfs_allocation_bitmap_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_allocation_bitmap_read_data(
+     void )
+{
+	libcerror_error_t *error                        = NULL;
+	libfshfs_allocation_bitmap_t *allocation_bitmap = NULL;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	result = libfshfs_allocation_bitmap_initialize(
+	          &allocation_bitmap,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "allocation_bitmap",
+	 allocation_bitmap );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfshfs_allocation_bitmap_read_data(
+	          allocation_bitmap,
+	          fshfs_test_allocation_bitmap_data1,
+	          17,
+	          130,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_SIZE(
+	 "allocation_bitmap->data_size",
+	 allocation_bitmap->data_size,
+	 (size_t) 24 );
+
+	/* The bits beyond the last block are not counted
+	 */
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "allocation_bitmap->number_of_allocated_blocks",
+	 allocation_bitmap->number_of_allocated_blocks,
+	 (uint32_t) 15 );
+
+	/* Test error cases
+	 */
+	result = libfshfs_allocation_bitmap_read_data(
+	          allocation_bitmap,
+	          fshfs_test_allocation_bitmap_data1,
+	          17,
+	          130,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_allocation_bitmap_free(
+	          &allocation_bitmap,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "allocation_bitmap",
+	 allocation_bitmap );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libfshfs_allocation_bitmap_initialize(
+	          &allocation_bitmap,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "allocation_bitmap",
+	 allocation_bitmap );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_allocation_bitmap_read_data(
+	          NULL,
+	          fshfs_test_allocation_bitmap_data1,
+	          17,
+	          130,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_allocation_bitmap_read_data(
+	          allocation_bitmap,
+	          NULL,
+	          17,
+	          130,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_allocation_bitmap_read_data(
+	          allocation_bitmap,
+	          fshfs_test_allocation_bitmap_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          130,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_allocation_bitmap_read_data(
+	          allocation_bitmap,
+	          fshfs_test_allocation_bitmap_data1,
+	          16,
+	          130,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_allocation_bitmap_read_data(
+	          allocation_bitmap,
+	          fshfs_test_allocation_bitmap_data1,
+	          17,
+	          0,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSHFS_TEST_MEMORY )
+
+	/* Test libfshfs_allocation_bitmap_read_data with malloc failing
+	 */
+	fshfs_test_malloc_attempts_before_fail = 0;
+
+	result = libfshfs_allocation_bitmap_read_data(
+	          allocation_bitmap,
+	          fshfs_test_allocation_bitmap_data1,
+	          17,
+	          130,
+	          &error );
+
+	if( fshfs_test_malloc_attempts_before_fail != -1 )
+	{
+		fshfs_test_malloc_attempts_before_fail = -1;
+	}
+	else
+	{
+		FSHFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FSHFS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_FSHFS_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libfshfs_allocation_bitmap_free(
+	          &allocation_bitmap,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "allocation_bitmap",
+	 allocation_bitmap );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( allocation_bitmap != NULL )
+	{
+		libfshfs_allocation_bitmap_free(
+		 &allocation_bitmap,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_allocation_bitmap_read_data function with a bitmap that is larger than a chunk
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_allocation_bitmap_read_data_with_chunks(
+     void )
+{
+	libcerror_error_t *error                        = NULL;
+	libfshfs_allocation_bitmap_t *allocation_bitmap = NULL;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	result = libfshfs_allocation_bitmap_initialize(
+	          &allocation_bitmap,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "allocation_bitmap",
+	 allocation_bitmap );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	allocation_bitmap->chunk_size = 8;
+
+	result = libfshfs_allocation_bitmap_read_data(
+	          allocation_bitmap,
+	          fshfs_test_allocation_bitmap_data1,
+	          17,
+	          130,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "allocation_bitmap->number_of_chunks",
+	 allocation_bitmap->number_of_chunks,
+	 3 );
+
+	FSHFS_TEST_ASSERT_EQUAL_SIZE(
+	 "allocation_bitmap->data_size",
+	 allocation_bitmap->data_size,
+	 (size_t) 24 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "allocation_bitmap->number_of_allocated_blocks",
+	 allocation_bitmap->number_of_allocated_blocks,
+	 (uint32_t) 15 );
+
+	result = libfshfs_allocation_bitmap_free_data(
+	          allocation_bitmap,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	allocation_bitmap->chunk_size = 12;
+
+	result = libfshfs_allocation_bitmap_read_data(
+	          allocation_bitmap,
+	          fshfs_test_allocation_bitmap_data1,
+	          17,
+	          130,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_allocation_bitmap_free(
+	          &allocation_bitmap,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "allocation_bitmap",
+	 allocation_bitmap );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( allocation_bitmap != NULL )
+	{
+		libfshfs_allocation_bitmap_free(
+		 &allocation_bitmap,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_allocation_bitmap_get_number_of_free_blocks function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_allocation_bitmap_get_number_of_free_blocks(
+     libfshfs_allocation_bitmap_t *allocation_bitmap )
+{
+	libcerror_error_t *error       = NULL;
+	uint32_t number_of_free_blocks = 0;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	result = libfshfs_allocation_bitmap_get_number_of_free_blocks(
+	          allocation_bitmap,
+	          &number_of_free_blocks,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_free_blocks",
+	 number_of_free_blocks,
+	 (uint32_t) 115 );
+
+	/* Test error cases
+	 */
+	result = libfshfs_allocation_bitmap_get_number_of_free_blocks(
+	          NULL,
+	          &number_of_free_blocks,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_allocation_bitmap_get_number_of_free_blocks(
+	          allocation_bitmap,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_allocation_bitmap_is_block_allocated function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_allocation_bitmap_is_block_allocated(
+     libfshfs_allocation_bitmap_t *allocation_bitmap )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfshfs_allocation_bitmap_is_block_allocated(
+	          allocation_bitmap,
+	          11,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_allocation_bitmap_is_block_allocated(
+	          allocation_bitmap,
+	          12,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_allocation_bitmap_is_block_allocated(
+	          allocation_bitmap,
+	          129,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_allocation_bitmap_is_block_allocated(
+	          NULL,
+	          11,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_allocation_bitmap_is_block_allocated(
+	          allocation_bitmap,
+	          130,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_allocation_bitmap_get_next_block_run function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_allocation_bitmap_get_next_block_run(
+     libfshfs_allocation_bitmap_t *allocation_bitmap )
+{
+	libcerror_error_t *error      = NULL;
+	uint32_t run_block_number     = 0;
+	uint32_t run_number_of_blocks = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = libfshfs_allocation_bitmap_get_next_block_run(
+	          allocation_bitmap,
+	          0,
+	          1,
+	          &run_block_number,
+	          &run_number_of_blocks,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "run_block_number",
+	 run_block_number,
+	 (uint32_t) 0 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "run_number_of_blocks",
+	 run_number_of_blocks,
+	 (uint32_t) 12 );
+
+	result = libfshfs_allocation_bitmap_get_next_block_run(
+	          allocation_bitmap,
+	          0,
+	          0,
+	          &run_block_number,
+	          &run_number_of_blocks,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "run_block_number",
+	 run_block_number,
+	 (uint32_t) 12 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "run_number_of_blocks",
+	 run_number_of_blocks,
+	 (uint32_t) 115 );
+
+	/* Test a run that crosses a 64-bit word boundary and ends at the last block
+	 */
+	result = libfshfs_allocation_bitmap_get_next_block_run(
+	          allocation_bitmap,
+	          12,
+	          1,
+	          &run_block_number,
+	          &run_number_of_blocks,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "run_block_number",
+	 run_block_number,
+	 (uint32_t) 127 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "run_number_of_blocks",
+	 run_number_of_blocks,
+	 (uint32_t) 3 );
+
+	/* Test that the bits beyond the last block are not considered unallocated
+	 */
+	result = libfshfs_allocation_bitmap_get_next_block_run(
+	          allocation_bitmap,
+	          127,
+	          0,
+	          &run_block_number,
+	          &run_number_of_blocks,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_allocation_bitmap_get_next_block_run(
+	          allocation_bitmap,
+	          130,
+	          1,
+	          &run_block_number,
+	          &run_number_of_blocks,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_allocation_bitmap_get_next_block_run(
+	          NULL,
+	          0,
+	          1,
+	          &run_block_number,
+	          &run_number_of_blocks,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_allocation_bitmap_get_next_block_run(
+	          allocation_bitmap,
+	          0,
+	          1,
+	          NULL,
+	          &run_number_of_blocks,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_allocation_bitmap_get_next_block_run(
+	          allocation_bitmap,
+	          0,
+	          1,
+	          &run_block_number,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSHFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSHFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSHFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSHFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+	libcerror_error_t *error                        = NULL;
+	libfshfs_allocation_bitmap_t *allocation_bitmap = NULL;
+	int result                                      = 0;
+#endif
+
+	FSHFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSHFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_allocation_bitmap_initialize",
+	 fshfs_test_allocation_bitmap_initialize );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_allocation_bitmap_free",
+	 fshfs_test_allocation_bitmap_free );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_allocation_bitmap_get_population_count",
+	 fshfs_test_allocation_bitmap_get_population_count );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_allocation_bitmap_get_leading_zero_count",
+	 fshfs_test_allocation_bitmap_get_leading_zero_count );
+
+	/* TODO add tests for libfshfs_allocation_bitmap_allocate_data */
+
+	/* TODO add tests for libfshfs_allocation_bitmap_finalize_data */
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_allocation_bitmap_read_data",
+	 fshfs_test_allocation_bitmap_read_data );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_allocation_bitmap_read_data_with_chunks",
+	 fshfs_test_allocation_bitmap_read_data_with_chunks );
+
+	/* TODO add tests for libfshfs_allocation_bitmap_read_data_stream */
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize allocation_bitmap for tests
+	 */
+	result = libfshfs_allocation_bitmap_initialize(
+	          &allocation_bitmap,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "allocation_bitmap",
+	 allocation_bitmap );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_allocation_bitmap_read_data(
+	          allocation_bitmap,
+	          fshfs_test_allocation_bitmap_data1,
+	          17,
+	          130,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_RUN_WITH_ARGS(
+	 "libfshfs_allocation_bitmap_get_number_of_free_blocks",
+	 fshfs_test_allocation_bitmap_get_number_of_free_blocks,
+	 allocation_bitmap );
+
+	FSHFS_TEST_RUN_WITH_ARGS(
+	 "libfshfs_allocation_bitmap_is_block_allocated",
+	 fshfs_test_allocation_bitmap_is_block_allocated,
+	 allocation_bitmap );
+
+	/* TODO add tests for libfshfs_allocation_bitmap_find_block */
+
+	FSHFS_TEST_RUN_WITH_ARGS(
+	 "libfshfs_allocation_bitmap_get_next_block_run",
+	 fshfs_test_allocation_bitmap_get_next_block_run,
+	 allocation_bitmap );
+
+	/* Clean up
+	 */
+	result = libfshfs_allocation_bitmap_free(
+	          &allocation_bitmap,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "allocation_bitmap",
+	 allocation_bitmap );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize allocation_bitmap with a bitmap that spans multiple chunks for tests
+	 */
+	result = libfshfs_allocation_bitmap_initialize(
+	          &allocation_bitmap,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "allocation_bitmap",
+	 allocation_bitmap );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	allocation_bitmap->chunk_size = 8;
+
+	result = libfshfs_allocation_bitmap_read_data(
+	          allocation_bitmap,
+	          fshfs_test_allocation_bitmap_data1,
+	          17,
+	          130,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_RUN_WITH_ARGS(
+	 "libfshfs_allocation_bitmap_get_number_of_free_blocks with chunks",
+	 fshfs_test_allocation_bitmap_get_number_of_free_blocks,
+	 allocation_bitmap );
+
+	FSHFS_TEST_RUN_WITH_ARGS(
+	 "libfshfs_allocation_bitmap_is_block_allocated with chunks",
+	 fshfs_test_allocation_bitmap_is_block_allocated,
+	 allocation_bitmap );
+
+	FSHFS_TEST_RUN_WITH_ARGS(
+	 "libfshfs_allocation_bitmap_get_next_block_run with chunks",
+	 fshfs_test_allocation_bitmap_get_next_block_run,
+	 allocation_bitmap );
+
+	/* Clean up
+	 */
+	result = libfshfs_allocation_bitmap_free(
+	          &allocation_bitmap,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "allocation_bitmap",
+	 allocation_bitmap );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( allocation_bitmap != NULL )
+	{
+		libfshfs_allocation_bitmap_free(
+		 &allocation_bitmap,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,675 @@
+/*
+ * Library attributes_index type test program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fshfs_test_libcerror.h"
+#include "fshfs_test_libfshfs.h"
+#include "fshfs_test_macros.h"
+#include "fshfs_test_memory.h"
+#include "fshfs_test_unused.h"
+
+#include "../libfshfs/libfshfs_attributes_index.h"
+#include "../libfshfs/libfshfs_definitions.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+/* Tests the libfshfs_attributes_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_attributes_index_initialize(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libfshfs_attributes_index_t *attributes_index = NULL;
+	int result                                    = 0;
+
+#if defined( HAVE_FSHFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests               = 1;
+	int number_of_memset_fail_tests               = 1;
+	int test_number                               = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfshfs_attributes_index_initialize(
+	          &attributes_index,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "attributes_index",
+	 attributes_index );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_attributes_index_free(
+	          &attributes_index,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "attributes_index",
+	 attributes_index );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_attributes_index_initialize(
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	attributes_index = (libfshfs_attributes_index_t *) 0x12345678UL;
+
+	result = libfshfs_attributes_index_initialize(
+	          &attributes_index,
+	          &error );
+
+	attributes_index = NULL;
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSHFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfshfs_attributes_index_initialize with malloc failing
+		 */
+		fshfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfshfs_attributes_index_initialize(
+		          &attributes_index,
+		          &error );
+
+		if( fshfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fshfs_test_malloc_attempts_before_fail = -1;
+
+			if( attributes_index != NULL )
+			{
+				libfshfs_attributes_index_free(
+				 &attributes_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSHFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSHFS_TEST_ASSERT_IS_NULL(
+			 "attributes_index",
+			 attributes_index );
+
+			FSHFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfshfs_attributes_index_initialize with memset failing
+		 */
+		fshfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfshfs_attributes_index_initialize(
+		          &attributes_index,
+		          &error );
+
+		if( fshfs_test_memset_attempts_before_fail != -1 )
+		{
+			fshfs_test_memset_attempts_before_fail = -1;
+
+			if( attributes_index != NULL )
+			{
+				libfshfs_attributes_index_free(
+				 &attributes_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSHFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSHFS_TEST_ASSERT_IS_NULL(
+			 "attributes_index",
+			 attributes_index );
+
+			FSHFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSHFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( attributes_index != NULL )
+	{
+		libfshfs_attributes_index_free(
+		 &attributes_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_attributes_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_attributes_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfshfs_attributes_index_free(
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_attributes_index_append_record function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_attributes_index_append_record(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libfshfs_attributes_index_t *attributes_index = NULL;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libfshfs_attributes_index_initialize(
+	          &attributes_index,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "attributes_index",
+	 attributes_index );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfshfs_attributes_index_append_record(
+	          attributes_index,
+	          16,
+	          5,
+	          3,
+	          0,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_attributes_index_append_record(
+	          attributes_index,
+	          16,
+	          6,
+	          0,
+	          LIBFSHFS_ATTRIBUTES_INDEX_FLAG_HAS_COMPRESSED_DATA,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_attributes_index_append_record(
+	          attributes_index,
+	          24,
+	          6,
+	          1,
+	          0,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "attributes_index->number_of_entries",
+	 attributes_index->number_of_entries,
+	 2 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT16(
+	 "attributes_index->entries[ 0 ].number_of_records",
+	 attributes_index->entries[ 0 ].number_of_records,
+	 2 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT8(
+	 "attributes_index->entries[ 0 ].flags",
+	 attributes_index->entries[ 0 ].flags,
+	 LIBFSHFS_ATTRIBUTES_INDEX_FLAG_HAS_COMPRESSED_DATA );
+
+	/* Test error cases
+	 */
+	result = libfshfs_attributes_index_append_record(
+	          NULL,
+	          32,
+	          6,
+	          2,
+	          0,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test identifier not in key order
+	 */
+	result = libfshfs_attributes_index_append_record(
+	          attributes_index,
+	          20,
+	          6,
+	          2,
+	          0,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_attributes_index_free(
+	          &attributes_index,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "attributes_index",
+	 attributes_index );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( attributes_index != NULL )
+	{
+		libfshfs_attributes_index_free(
+		 &attributes_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_attributes_index_get_entry_by_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_attributes_index_get_entry_by_identifier(
+     void )
+{
+	libcerror_error_t *error                                  = NULL;
+	libfshfs_attributes_index_t *attributes_index             = NULL;
+	libfshfs_attributes_index_entry_t *attributes_index_entry = NULL;
+	uint32_t identifier                                       = 0;
+	int result                                                = 0;
+
+	/* Initialize test
+	 */
+	result = libfshfs_attributes_index_initialize(
+	          &attributes_index,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "attributes_index",
+	 attributes_index );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( identifier = 16;
+	     identifier < 1024;
+	     identifier += 2 )
+	{
+		result = libfshfs_attributes_index_append_record(
+		          attributes_index,
+		          identifier,
+		          identifier / 8,
+		          (uint16_t) ( identifier % 8 ),
+		          0,
+		          &error );
+
+		FSHFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSHFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	result = libfshfs_attributes_index_get_entry_by_identifier(
+	          attributes_index,
+	          514,
+	          &attributes_index_entry,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "attributes_index_entry",
+	 attributes_index_entry );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "attributes_index_entry->identifier",
+	 attributes_index_entry->identifier,
+	 514 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "attributes_index_entry->node_number",
+	 attributes_index_entry->node_number,
+	 64 );
+
+	attributes_index_entry = NULL;
+
+	result = libfshfs_attributes_index_get_entry_by_identifier(
+	          attributes_index,
+	          515,
+	          &attributes_index_entry,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "attributes_index_entry",
+	 attributes_index_entry );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_attributes_index_get_entry_by_identifier(
+	          NULL,
+	          514,
+	          &attributes_index_entry,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_attributes_index_get_entry_by_identifier(
+	          attributes_index,
+	          514,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_attributes_index_free(
+	          &attributes_index,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "attributes_index",
+	 attributes_index );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( attributes_index != NULL )
+	{
+		libfshfs_attributes_index_free(
+		 &attributes_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSHFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSHFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSHFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSHFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSHFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSHFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_attributes_index_initialize",
+	 fshfs_test_attributes_index_initialize );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_attributes_index_free",
+	 fshfs_test_attributes_index_free );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_attributes_index_append_record",
+	 fshfs_test_attributes_index_append_record );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_attributes_index_get_entry_by_identifier",
+	 fshfs_test_attributes_index_get_entry_by_identifier );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+}
+
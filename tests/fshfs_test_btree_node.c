@@ -35,6 +35,10 @@
 
 #include "../libfshfs/libfshfs_btree_node.h"
 
+uint8_t fshfs_test_btree_node_data1[ 32 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x1a, 0x00, 0x14, 0x00, 0x0e };
+
 #if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
 
 /* Tests the libfshfs_btree_node_initialize function
@@ -254,6 +258,160 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfshfs_btree_node_initialize_from_mapped_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_btree_node_initialize_from_mapped_data(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libfshfs_btree_node_t *btree_node = NULL;
+	int result                        = 0;
+
+	/* Test regular cases
+	 */
+	result = libfshfs_btree_node_initialize_from_mapped_data(
+	          &btree_node,
+	          fshfs_test_btree_node_data1,
+	          32,
+	          0,
+	          32,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "btree_node",
+	 btree_node );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "btree_node->data_is_mapped",
+	 (int) btree_node->data_is_mapped,
+	 1 );
+
+	FSHFS_TEST_ASSERT_EQUAL_SIZE(
+	 "btree_node->data_size",
+	 btree_node->data_size,
+	 (size_t) 32 );
+
+	result = libfshfs_btree_node_read_data(
+	          btree_node,
+	          btree_node->data,
+	          btree_node->data_size,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_btree_node_free(
+	          &btree_node,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "btree_node",
+	 btree_node );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_btree_node_initialize_from_mapped_data(
+	          NULL,
+	          fshfs_test_btree_node_data1,
+	          32,
+	          0,
+	          32,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_btree_node_initialize_from_mapped_data(
+	          &btree_node,
+	          NULL,
+	          32,
+	          0,
+	          32,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_btree_node_initialize_from_mapped_data(
+	          &btree_node,
+	          fshfs_test_btree_node_data1,
+	          32,
+	          16,
+	          32,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( btree_node != NULL )
+	{
+		libfshfs_btree_node_free(
+		 &btree_node,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libfshfs_btree_node_free function
  * Returns 1 if successful or 0 if not
  */
@@ -292,6 +450,305 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfshfs_btree_node_add_reference function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_btree_node_add_reference(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libfshfs_btree_node_t *btree_node = NULL;
+	libfshfs_btree_node_t *reference  = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfshfs_btree_node_initialize(
+	          &btree_node,
+	          512,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "btree_node",
+	 btree_node );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfshfs_btree_node_add_reference(
+	          btree_node,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "btree_node->number_of_references",
+	 btree_node->number_of_references,
+	 1 );
+
+	/* Freeing a referenced node only releases the reference
+	 */
+	reference = btree_node;
+
+	result = libfshfs_btree_node_free(
+	          &reference,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "reference",
+	 reference );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "btree_node->number_of_references",
+	 btree_node->number_of_references,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfshfs_btree_node_add_reference(
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_btree_node_free(
+	          &btree_node,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "btree_node",
+	 btree_node );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( btree_node != NULL )
+	{
+		libfshfs_btree_node_free(
+		 &btree_node,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_btree_node_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_btree_node_read_data(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libfshfs_btree_node_t *btree_node = NULL;
+	const uint8_t *record_data        = NULL;
+	size_t record_data_size           = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfshfs_btree_node_initialize(
+	          &btree_node,
+	          32,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "btree_node",
+	 btree_node );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfshfs_btree_node_read_data(
+	          btree_node,
+	          fshfs_test_btree_node_data1,
+	          32,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT16(
+	 "btree_node->number_of_records",
+	 btree_node->number_of_records,
+	 (uint16_t) 2 );
+
+	result = libfshfs_btree_node_get_record_data_by_index(
+	          btree_node,
+	          1,
+	          &record_data,
+	          &record_data_size,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_SIZE(
+	 "record_data_size",
+	 record_data_size,
+	 (size_t) 6 );
+
+	/* Test error cases
+	 */
+	result = libfshfs_btree_node_get_record_data_by_index(
+	          btree_node,
+	          2,
+	          &record_data,
+	          &record_data_size,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_btree_node_read_data(
+	          btree_node,
+	          fshfs_test_btree_node_data1,
+	          32,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_btree_node_read_data(
+	          NULL,
+	          fshfs_test_btree_node_data1,
+	          32,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_btree_node_free(
+	          &btree_node,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "btree_node",
+	 btree_node );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( btree_node != NULL )
+	{
+		libfshfs_btree_node_free(
+		 &btree_node,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
 
 /* The main program
@@ -315,17 +772,27 @@ int main(
 	 "libfshfs_btree_node_initialize",
 	 fshfs_test_btree_node_initialize );
 
+	FSHFS_TEST_RUN(
+	 "libfshfs_btree_node_initialize_from_mapped_data",
+	 fshfs_test_btree_node_initialize_from_mapped_data );
+
 	FSHFS_TEST_RUN(
 	 "libfshfs_btree_node_free",
 	 fshfs_test_btree_node_free );
 
+	FSHFS_TEST_RUN(
+	 "libfshfs_btree_node_add_reference",
+	 fshfs_test_btree_node_add_reference );
+
 	/* TODO: add tests for libfshfs_btree_node_record_initialize */
 
 	/* TODO: add tests for libfshfs_btree_node_record_free */
 
-	/* TODO: add tests for libfshfs_btree_node_get_record_data_by_index */
+	FSHFS_TEST_RUN(
+	 "libfshfs_btree_node_read_data",
+	 fshfs_test_btree_node_read_data );
 
-	/* TODO: add tests for libfshfs_btree_node_read */
+	/* TODO: add tests for libfshfs_btree_node_read_file_io_handle */
 
 	/* TODO: add tests for libfshfs_btree_node_read_descriptor */
 
@@ -0,0 +1,726 @@
+/*
+ * Library catalog_index type test program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fshfs_test_libcerror.h"
+#include "fshfs_test_libfshfs.h"
+#include "fshfs_test_macros.h"
+#include "fshfs_test_memory.h"
+#include "fshfs_test_unused.h"
+
+#include "../libfshfs/libfshfs_catalog_index.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+/* Tests the libfshfs_catalog_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_catalog_index_initialize(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libfshfs_catalog_index_t *catalog_index = NULL;
+	int result                              = 0;
+
+#if defined( HAVE_FSHFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests         = 1;
+	int number_of_memset_fail_tests         = 1;
+	int test_number                         = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfshfs_catalog_index_initialize(
+	          &catalog_index,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog_index",
+	 catalog_index );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_catalog_index_free(
+	          &catalog_index,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "catalog_index",
+	 catalog_index );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_catalog_index_initialize(
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	catalog_index = (libfshfs_catalog_index_t *) 0x12345678UL;
+
+	result = libfshfs_catalog_index_initialize(
+	          &catalog_index,
+	          &error );
+
+	catalog_index = NULL;
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSHFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfshfs_catalog_index_initialize with malloc failing
+		 */
+		fshfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfshfs_catalog_index_initialize(
+		          &catalog_index,
+		          &error );
+
+		if( fshfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fshfs_test_malloc_attempts_before_fail = -1;
+
+			if( catalog_index != NULL )
+			{
+				libfshfs_catalog_index_free(
+				 &catalog_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSHFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSHFS_TEST_ASSERT_IS_NULL(
+			 "catalog_index",
+			 catalog_index );
+
+			FSHFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfshfs_catalog_index_initialize with memset failing
+		 */
+		fshfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfshfs_catalog_index_initialize(
+		          &catalog_index,
+		          &error );
+
+		if( fshfs_test_memset_attempts_before_fail != -1 )
+		{
+			fshfs_test_memset_attempts_before_fail = -1;
+
+			if( catalog_index != NULL )
+			{
+				libfshfs_catalog_index_free(
+				 &catalog_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSHFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSHFS_TEST_ASSERT_IS_NULL(
+			 "catalog_index",
+			 catalog_index );
+
+			FSHFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSHFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( catalog_index != NULL )
+	{
+		libfshfs_catalog_index_free(
+		 &catalog_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_catalog_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_catalog_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfshfs_catalog_index_free(
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_catalog_index_append_record function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_catalog_index_append_record(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libfshfs_catalog_index_t *catalog_index = NULL;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libfshfs_catalog_index_initialize(
+	          &catalog_index,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog_index",
+	 catalog_index );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfshfs_catalog_index_append_record(
+	          catalog_index,
+	          24,
+	          5,
+	          3,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_catalog_index_append_record(
+	          catalog_index,
+	          16,
+	          6,
+	          0,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "catalog_index->number_of_entries",
+	 catalog_index->number_of_entries,
+	 2 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT8(
+	 "catalog_index->is_sorted",
+	 catalog_index->is_sorted,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfshfs_catalog_index_append_record(
+	          NULL,
+	          32,
+	          6,
+	          2,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_catalog_index_free(
+	          &catalog_index,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "catalog_index",
+	 catalog_index );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( catalog_index != NULL )
+	{
+		libfshfs_catalog_index_free(
+		 &catalog_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_catalog_index_get_entry_by_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_catalog_index_get_entry_by_identifier(
+     void )
+{
+	libcerror_error_t *error                            = NULL;
+	libfshfs_catalog_index_t *catalog_index             = NULL;
+	libfshfs_catalog_index_entry_t *catalog_index_entry = NULL;
+	uint32_t identifier                                 = 0;
+	int number_of_entries                               = 0;
+	int result                                          = 0;
+
+	/* Initialize test
+	 */
+	result = libfshfs_catalog_index_initialize(
+	          &catalog_index,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog_index",
+	 catalog_index );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Append the records in descending order of identifier
+	 */
+	for( identifier = 1022;
+	     identifier >= 16;
+	     identifier -= 2 )
+	{
+		result = libfshfs_catalog_index_append_record(
+		          catalog_index,
+		          identifier,
+		          identifier / 8,
+		          (uint16_t) ( identifier % 8 ),
+		          &error );
+
+		FSHFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSHFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error case where the index is not sorted
+	 */
+	result = libfshfs_catalog_index_get_entry_by_identifier(
+	          catalog_index,
+	          514,
+	          &catalog_index_entry,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_catalog_index_sort(
+	          catalog_index,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_catalog_index_get_number_of_entries(
+	          catalog_index,
+	          &number_of_entries,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 504 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_catalog_index_get_entry_by_index(
+	          catalog_index,
+	          0,
+	          &catalog_index_entry,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "catalog_index_entry->identifier",
+	 catalog_index_entry->identifier,
+	 16 );
+
+	/* Test regular cases
+	 */
+	catalog_index_entry = NULL;
+
+	result = libfshfs_catalog_index_get_entry_by_identifier(
+	          catalog_index,
+	          514,
+	          &catalog_index_entry,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog_index_entry",
+	 catalog_index_entry );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "catalog_index_entry->identifier",
+	 catalog_index_entry->identifier,
+	 514 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "catalog_index_entry->node_number",
+	 catalog_index_entry->node_number,
+	 64 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT16(
+	 "catalog_index_entry->record_index",
+	 catalog_index_entry->record_index,
+	 2 );
+
+	catalog_index_entry = NULL;
+
+	result = libfshfs_catalog_index_get_entry_by_identifier(
+	          catalog_index,
+	          515,
+	          &catalog_index_entry,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "catalog_index_entry",
+	 catalog_index_entry );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_catalog_index_get_entry_by_identifier(
+	          NULL,
+	          514,
+	          &catalog_index_entry,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_catalog_index_get_entry_by_identifier(
+	          catalog_index,
+	          514,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_catalog_index_get_entry_by_index(
+	          catalog_index,
+	          504,
+	          &catalog_index_entry,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_catalog_index_free(
+	          &catalog_index,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "catalog_index",
+	 catalog_index );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( catalog_index != NULL )
+	{
+		libfshfs_catalog_index_free(
+		 &catalog_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSHFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSHFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSHFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSHFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSHFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSHFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_catalog_index_initialize",
+	 fshfs_test_catalog_index_initialize );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_catalog_index_free",
+	 fshfs_test_catalog_index_free );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_catalog_index_append_record",
+	 fshfs_test_catalog_index_append_record );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_catalog_index_get_entry_by_identifier",
+	 fshfs_test_catalog_index_get_entry_by_identifier );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,843 @@
+/*
+ * Library directory_entries_page type test program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fshfs_test_libcerror.h"
+#include "fshfs_test_libfshfs.h"
+#include "fshfs_test_macros.h"
+#include "fshfs_test_memory.h"
+#include "fshfs_test_unused.h"
+
+#include "../libfshfs/libfshfs_definitions.h"
+#include "../libfshfs/libfshfs_directory_entries_page.h"
+#include "../libfshfs/libfshfs_directory_entry.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+/* Tests the libfshfs_directory_entries_page_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_directory_entries_page_initialize(
+     void )
+{
+	libcerror_error_t *error                                  = NULL;
+	libfshfs_directory_entries_page_t *directory_entries_page = NULL;
+	int result                                                = 0;
+
+#if defined( HAVE_FSHFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests                           = 2;
+	int number_of_memset_fail_tests                           = 1;
+	int test_number                                           = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfshfs_directory_entries_page_initialize(
+	          &directory_entries_page,
+	          16,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entries_page",
+	 directory_entries_page );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_directory_entries_page_free(
+	          &directory_entries_page,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "directory_entries_page",
+	 directory_entries_page );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_directory_entries_page_initialize(
+	          NULL,
+	          16,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	directory_entries_page = (libfshfs_directory_entries_page_t *) 0x12345678UL;
+
+	result = libfshfs_directory_entries_page_initialize(
+	          &directory_entries_page,
+	          16,
+	          &error );
+
+	directory_entries_page = NULL;
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_directory_entries_page_initialize(
+	          &directory_entries_page,
+	          0,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "directory_entries_page",
+	 directory_entries_page );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSHFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfshfs_directory_entries_page_initialize with malloc failing
+		 */
+		fshfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfshfs_directory_entries_page_initialize(
+		          &directory_entries_page,
+		          16,
+		          &error );
+
+		if( fshfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fshfs_test_malloc_attempts_before_fail = -1;
+
+			if( directory_entries_page != NULL )
+			{
+				libfshfs_directory_entries_page_free(
+				 &directory_entries_page,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSHFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSHFS_TEST_ASSERT_IS_NULL(
+			 "directory_entries_page",
+			 directory_entries_page );
+
+			FSHFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfshfs_directory_entries_page_initialize with memset failing
+		 */
+		fshfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfshfs_directory_entries_page_initialize(
+		          &directory_entries_page,
+		          16,
+		          &error );
+
+		if( fshfs_test_memset_attempts_before_fail != -1 )
+		{
+			fshfs_test_memset_attempts_before_fail = -1;
+
+			if( directory_entries_page != NULL )
+			{
+				libfshfs_directory_entries_page_free(
+				 &directory_entries_page,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSHFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSHFS_TEST_ASSERT_IS_NULL(
+			 "directory_entries_page",
+			 directory_entries_page );
+
+			FSHFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSHFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_entries_page != NULL )
+	{
+		libfshfs_directory_entries_page_free(
+		 &directory_entries_page,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_directory_entries_page_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_directory_entries_page_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfshfs_directory_entries_page_free(
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_directory_entries_page_empty function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_directory_entries_page_empty(
+     void )
+{
+	libcerror_error_t *error                                  = NULL;
+	libfshfs_directory_entries_page_t *directory_entries_page = NULL;
+	libfshfs_directory_entry_t *directory_entry               = NULL;
+	int entry_index                                           = 0;
+	int number_of_entries                                     = 0;
+	int result                                                = 0;
+
+	/* Initialize test
+	 */
+	result = libfshfs_directory_entries_page_initialize(
+	          &directory_entries_page,
+	          16,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entries_page",
+	 directory_entries_page );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_directory_entry_initialize(
+	          &directory_entry,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_append_entry(
+	          directory_entries_page->directory_entries,
+	          &entry_index,
+	          (intptr_t *) directory_entry,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	directory_entry = NULL;
+
+	/* Test regular cases
+	 */
+	result = libfshfs_directory_entries_page_empty(
+	          directory_entries_page,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "directory_entries_page->first_entry_index",
+	 directory_entries_page->first_entry_index,
+	 1 );
+
+	result = libfshfs_directory_entries_page_get_number_of_entries(
+	          directory_entries_page,
+	          &number_of_entries,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 0 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_directory_entries_page_empty(
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_directory_entries_page_free(
+	          &directory_entries_page,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "directory_entries_page",
+	 directory_entries_page );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_entry != NULL )
+	{
+		libfshfs_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	if( directory_entries_page != NULL )
+	{
+		libfshfs_directory_entries_page_free(
+		 &directory_entries_page,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_directory_entries_page_reset function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_directory_entries_page_reset(
+     void )
+{
+	libcerror_error_t *error                                  = NULL;
+	libfshfs_directory_entries_page_t *directory_entries_page = NULL;
+	int result                                                = 0;
+
+	/* Initialize test
+	 */
+	result = libfshfs_directory_entries_page_initialize(
+	          &directory_entries_page,
+	          16,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entries_page",
+	 directory_entries_page );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	directory_entries_page->first_entry_index = 32;
+	directory_entries_page->next_node_number  = 5;
+	directory_entries_page->next_record_index = 3;
+	directory_entries_page->is_last_page      = 1;
+
+	/* Test regular cases
+	 */
+	result = libfshfs_directory_entries_page_reset(
+	          directory_entries_page,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "directory_entries_page->first_entry_index",
+	 directory_entries_page->first_entry_index,
+	 0 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "directory_entries_page->next_node_number",
+	 directory_entries_page->next_node_number,
+	 (uint32_t) 0 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT8(
+	 "directory_entries_page->is_last_page",
+	 directory_entries_page->is_last_page,
+	 (uint8_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libfshfs_directory_entries_page_reset(
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_directory_entries_page_free(
+	          &directory_entries_page,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "directory_entries_page",
+	 directory_entries_page );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_entries_page != NULL )
+	{
+		libfshfs_directory_entries_page_free(
+		 &directory_entries_page,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_directory_entries_page_get_entry_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_directory_entries_page_get_entry_by_index(
+     void )
+{
+	libcerror_error_t *error                                  = NULL;
+	libfshfs_directory_entries_page_t *directory_entries_page = NULL;
+	libfshfs_directory_entry_t *directory_entry               = NULL;
+	int entry_index                                           = 0;
+	int result                                                = 0;
+
+	/* Initialize test
+	 */
+	result = libfshfs_directory_entries_page_initialize(
+	          &directory_entries_page,
+	          16,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entries_page",
+	 directory_entries_page );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_directory_entry_initialize(
+	          &directory_entry,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_append_entry(
+	          directory_entries_page->directory_entries,
+	          &entry_index,
+	          (intptr_t *) directory_entry,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	directory_entry = NULL;
+
+	directory_entries_page->first_entry_index = 4;
+
+	/* Test regular cases
+	 */
+	result = libfshfs_directory_entries_page_get_entry_by_index(
+	          directory_entries_page,
+	          4,
+	          &directory_entry,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	directory_entry = NULL;
+
+	result = libfshfs_directory_entries_page_get_entry_by_index(
+	          directory_entries_page,
+	          3,
+	          &directory_entry,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_directory_entries_page_get_entry_by_index(
+	          directory_entries_page,
+	          5,
+	          &directory_entry,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_directory_entries_page_get_entry_by_index(
+	          NULL,
+	          4,
+	          &directory_entry,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_directory_entries_page_get_entry_by_index(
+	          directory_entries_page,
+	          -1,
+	          &directory_entry,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_directory_entries_page_get_entry_by_index(
+	          directory_entries_page,
+	          4,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_directory_entries_page_free(
+	          &directory_entries_page,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "directory_entries_page",
+	 directory_entries_page );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_entries_page != NULL )
+	{
+		libfshfs_directory_entries_page_free(
+		 &directory_entries_page,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSHFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSHFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSHFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSHFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSHFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSHFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_directory_entries_page_initialize",
+	 fshfs_test_directory_entries_page_initialize );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_directory_entries_page_free",
+	 fshfs_test_directory_entries_page_free );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_directory_entries_page_empty",
+	 fshfs_test_directory_entries_page_empty );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_directory_entries_page_reset",
+	 fshfs_test_directory_entries_page_reset );
+
+	/* TODO add tests for libfshfs_directory_entries_page_get_number_of_entries */
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_directory_entries_page_get_entry_by_index",
+	 fshfs_test_directory_entries_page_get_entry_by_index );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+}
+
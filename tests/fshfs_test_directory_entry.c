@@ -633,6 +633,62 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfshfs_directory_entry_get_number_of_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_directory_entry_get_number_of_entries(
+     libfshfs_directory_entry_t *directory_entry )
+{
+	libcerror_error_t *error   = NULL;
+	uint32_t number_of_entries = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libfshfs_directory_entry_get_number_of_entries(
+	          directory_entry,
+	          &number_of_entries,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_directory_entry_get_number_of_entries(
+	          NULL,
+	          &number_of_entries,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libfshfs_directory_entry_get_creation_time function
  * Returns 1 if successful or 0 if not
  */
@@ -1833,6 +1889,8 @@ int main(
 
 /* TODO add tests for libfshfs_directory_entry_set_name */
 
+/* TODO add tests for libfshfs_directory_entry_set_name_from_node */
+
 /* TODO add tests for libfshfs_directory_entry_set_catalog_record */
 
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
@@ -1928,6 +1986,11 @@ int main(
 	 fshfs_test_directory_entry_get_identifier,
 	 directory_entry );
 
+	FSHFS_TEST_RUN_WITH_ARGS(
+	 "libfshfs_directory_entry_get_number_of_entries",
+	 fshfs_test_directory_entry_get_number_of_entries,
+	 directory_entry );
+
 	FSHFS_TEST_RUN_WITH_ARGS(
 	 "libfshfs_directory_entry_get_creation_time",
 	 fshfs_test_directory_entry_get_creation_time,
@@ -776,6 +776,84 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfshfs_directory_record_get_number_of_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_directory_record_get_number_of_entries(
+     libfshfs_directory_record_t *directory_record )
+{
+	libcerror_error_t *error   = NULL;
+	uint32_t number_of_entries = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libfshfs_directory_record_get_number_of_entries(
+	          directory_record,
+	          &number_of_entries,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_entries",
+	 number_of_entries,
+	 (uint32_t) 7 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_directory_record_get_number_of_entries(
+	          NULL,
+	          &number_of_entries,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_directory_record_get_number_of_entries(
+	          directory_record,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libfshfs_directory_record_get_creation_time function
  * Returns 1 if successful or 0 if not
  */
@@ -1446,6 +1524,11 @@ int main(
 	 fshfs_test_directory_record_get_identifier,
 	 directory_record );
 
+	FSHFS_TEST_RUN_WITH_ARGS(
+	 "libfshfs_directory_record_get_number_of_entries",
+	 fshfs_test_directory_record_get_number_of_entries,
+	 directory_record );
+
 	FSHFS_TEST_RUN_WITH_ARGS(
 	 "libfshfs_directory_record_get_creation_time",
 	 fshfs_test_directory_record_get_creation_time,
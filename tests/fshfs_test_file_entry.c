@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -33,18 +34,5060 @@
 
 #include <time.h>
 
+#include "fshfs_test_functions.h"
+#include "fshfs_test_libbfio.h"
 #include "fshfs_test_libcerror.h"
+#include "fshfs_test_libfdata.h"
 #include "fshfs_test_libfshfs.h"
 #include "fshfs_test_macros.h"
 #include "fshfs_test_memory.h"
 #include "fshfs_test_unused.h"
 
+#include "../libfshfs/libfshfs_allocation_block_stream.h"
+#include "../libfshfs/libfshfs_catalog_btree_file.h"
+#include "../libfshfs/libfshfs_catalog_btree_key.h"
+#include "../libfshfs/libfshfs_compressed_data_header.h"
+#include "../libfshfs/libfshfs_definitions.h"
+#include "../libfshfs/libfshfs_directory_entries_page.h"
+#include "../libfshfs/libfshfs_directory_entry.h"
+#include "../libfshfs/libfshfs_extent.h"
 #include "../libfshfs/libfshfs_file_entry.h"
+#include "../libfshfs/libfshfs_file_system.h"
+#include "../libfshfs/libfshfs_fork_descriptor.h"
+#include "../libfshfs/libfshfs_io_handle.h"
+#include "../libfshfs/libfshfs_libcdata.h"
+#include "../libfshfs/libfshfs_read_range.h"
+#include "../libfshfs/libfshfs_statistics.h"
 
 #define FSHFS_TEST_FILE_ENTRY_READ_BUFFER_SIZE	4096
 
+#define FSHFS_TEST_FILE_ENTRY_READ_RANGES_DATA_SIZE	2097152
+#define FSHFS_TEST_FILE_ENTRY_NUMBER_OF_READ_RANGES	9
+
+#define FSHFS_TEST_FILE_ENTRY_CATALOG_DATA_SIZE		12288
+
+/* The catalog B-tree header node descriptor and header record
+ */
+uint8_t fshfs_test_file_entry_catalog_header_node_data1[ 120 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+	0x10, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* The catalog B-tree leaf node descriptor and records, the record offsets
+ * are stored at the end of the node
+ */
+uint8_t fshfs_test_file_entry_catalog_leaf_node_data1[ 1018 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0e,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x72, 0x00, 0x6f, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0xdc, 0x3e, 0x12, 0x00, 0xdc, 0x3e,
+	0x12, 0x01, 0xdc, 0x3e, 0x12, 0x02, 0xdc, 0x3e, 0x12, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x41, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x72, 0x00, 0x6f, 0x00, 0x6f, 0x00, 0x74,
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x61, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xdc, 0x3e, 0x12, 0x10, 0xdc, 0x3e, 0x12, 0x11, 0xdc, 0x3e,
+	0x12, 0x12, 0xdc, 0x3e, 0x12, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf5, 0x00, 0x00,
+	0x00, 0x14, 0x00, 0x00, 0x81, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x62, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0xdc, 0x3e, 0x12, 0x20, 0xdc, 0x3e, 0x12, 0x21,
+	0xdc, 0x3e, 0x12, 0x22, 0xdc, 0x3e, 0x12, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf5,
+	0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x41, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x63, 0x00, 0x63,
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xdc, 0x3e, 0x12, 0x30,
+	0xdc, 0x3e, 0x12, 0x31, 0xdc, 0x3e, 0x12, 0x32, 0xdc, 0x3e, 0x12, 0x33, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0xf5, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x81, 0xa4, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x11, 0x00, 0x01,
+	0x00, 0x64, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xdc, 0x3e,
+	0x12, 0x40, 0xdc, 0x3e, 0x12, 0x41, 0xdc, 0x3e, 0x12, 0x42, 0xdc, 0x3e, 0x12, 0x43, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0xf5, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x81, 0xa4, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint16_t fshfs_test_file_entry_catalog_leaf_node_record_offsets1[ 7 ] = {
+	14, 118, 144, 402, 500, 760, 1018 };
+
+uint8_t fshfs_test_file_entry_catalog_data[ FSHFS_TEST_FILE_ENTRY_CATALOG_DATA_SIZE ];
+
+typedef struct fshfs_test_file_entry_sub_records fshfs_test_file_entry_sub_records_t;
+
+struct fshfs_test_file_entry_sub_records
+{
+	/* The parent identifiers
+	 */
+	uint32_t parent_identifiers[ 8 ];
+
+	/* The identifiers
+	 */
+	uint32_t identifiers[ 8 ];
+
+	/* The number of records
+	 */
+	int number_of_records;
+
+	/* The maximum number of records to iterate
+	 */
+	int maximum_number_of_records;
+};
+
 #if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
 
+/* Frees a file system created by fshfs_test_file_entry_initialize_file_system
+ * Returns 1 if successful or -1 on error
+ */
+int fshfs_test_file_entry_free_file_system(
+     libfshfs_io_handle_t **io_handle,
+     libbfio_handle_t **file_io_handle,
+     libfshfs_file_system_t **file_system,
+     libcerror_error_t **error )
+{
+	int result = 1;
+
+	if( *file_system != NULL )
+	{
+		if( libfshfs_file_system_free(
+		     file_system,
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( *file_io_handle != NULL )
+	{
+		if( fshfs_test_close_file_io_handle(
+		     file_io_handle,
+		     error ) != 0 )
+		{
+			result = -1;
+		}
+	}
+	if( *io_handle != NULL )
+	{
+		if( libfshfs_io_handle_free(
+		     io_handle,
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Creates a file system with a catalog B-tree file for testing
+ * The catalog B-tree file consists of a header node and a leaf node stored
+ * from block 1 of the test data. The root directory (CNID 2) contains
+ * the file "a" (CNID 16), the directory "b" (CNID 17) and the file "cc" (CNID 18),
+ * where the directory "b" contains the file "d" (CNID 19)
+ * Returns 1 if successful or -1 on error
+ */
+int fshfs_test_file_entry_initialize_file_system(
+     libfshfs_io_handle_t **io_handle,
+     libbfio_handle_t **file_io_handle,
+     libfshfs_file_system_t **file_system,
+     libcerror_error_t **error )
+{
+	libfshfs_fork_descriptor_t *fork_descriptor = NULL;
+	size_t data_offset                          = 0;
+	uint16_t record_offset                      = 0;
+	int record_index                            = 0;
+
+	if( memory_set(
+	     fshfs_test_file_entry_catalog_data,
+	     0,
+	     FSHFS_TEST_FILE_ENTRY_CATALOG_DATA_SIZE ) == NULL )
+	{
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( fshfs_test_file_entry_catalog_data[ 4096 ] ),
+	     fshfs_test_file_entry_catalog_header_node_data1,
+	     120 ) == NULL )
+	{
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( fshfs_test_file_entry_catalog_data[ 8192 ] ),
+	     fshfs_test_file_entry_catalog_leaf_node_data1,
+	     1018 ) == NULL )
+	{
+		return( -1 );
+	}
+	/* The record offsets are stored in reverse order at the end of the leaf node
+	 */
+	for( record_index = 0;
+	     record_index < 7;
+	     record_index++ )
+	{
+		data_offset   = FSHFS_TEST_FILE_ENTRY_CATALOG_DATA_SIZE - ( ( record_index + 1 ) * 2 );
+		record_offset = fshfs_test_file_entry_catalog_leaf_node_record_offsets1[ record_index ];
+
+		fshfs_test_file_entry_catalog_data[ data_offset ]     = (uint8_t) ( record_offset >> 8 );
+		fshfs_test_file_entry_catalog_data[ data_offset + 1 ] = (uint8_t) ( record_offset & 0xff );
+	}
+	if( libfshfs_io_handle_initialize(
+	     io_handle,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	( *io_handle )->file_system_type = LIBFSHFS_FILE_SYSTEM_TYPE_HFS_PLUS;
+	( *io_handle )->block_size       = 4096;
+
+	if( fshfs_test_open_file_io_handle(
+	     file_io_handle,
+	     fshfs_test_file_entry_catalog_data,
+	     FSHFS_TEST_FILE_ENTRY_CATALOG_DATA_SIZE,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfshfs_file_system_initialize(
+	     file_system,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfshfs_fork_descriptor_initialize(
+	     &fork_descriptor,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	fork_descriptor->size                        = 8192;
+	fork_descriptor->number_of_blocks            = 2;
+	fork_descriptor->extents[ 0 ][ 0 ]           = 1;
+	fork_descriptor->extents[ 0 ][ 1 ]           = 2;
+	fork_descriptor->number_of_blocks_in_extents = 2;
+
+	if( libfshfs_file_system_read_catalog_file(
+	     *file_system,
+	     *io_handle,
+	     *file_io_handle,
+	     fork_descriptor,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfshfs_fork_descriptor_free(
+	     &fork_descriptor,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( fork_descriptor != NULL )
+	{
+		libfshfs_fork_descriptor_free(
+		 &fork_descriptor,
+		 NULL );
+	}
+	fshfs_test_file_entry_free_file_system(
+	 io_handle,
+	 file_io_handle,
+	 file_system,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Creates a file entry of the root directory in the test file system
+ * Returns 1 if successful or -1 on error
+ */
+int fshfs_test_file_entry_initialize_root_directory(
+     libfshfs_file_entry_t **file_entry,
+     libfshfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfshfs_file_system_t *file_system,
+     libcerror_error_t **error )
+{
+	libfshfs_directory_entry_t *directory_entry = NULL;
+
+	if( libfshfs_file_system_get_directory_entry_by_identifier(
+	     file_system,
+	     io_handle,
+	     file_io_handle,
+	     LIBFSHFS_ROOT_DIRECTORY_IDENTIFIER,
+	     &directory_entry,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfshfs_file_entry_initialize(
+	     file_entry,
+	     io_handle,
+	     file_io_handle,
+	     file_system,
+	     directory_entry,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( directory_entry != NULL )
+	{
+		libfshfs_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Creates a file entry of the file "a" (CNID 16) in the test file system
+ * The data fork of the file is changed to data of the specified size, where
+ * the first block is stored in block 2 of the test data and the data beyond
+ * the first block is sparse
+ * Returns 1 if successful or -1 on error
+ */
+int fshfs_test_file_entry_initialize_regular_file(
+     libfshfs_file_entry_t **file_entry,
+     libfshfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfshfs_file_system_t *file_system,
+     size64_t data_size,
+     libcerror_error_t **error )
+{
+	libfshfs_file_entry_t *root_directory       = NULL;
+	libfshfs_fork_descriptor_t *fork_descriptor = NULL;
+
+	if( fshfs_test_file_entry_initialize_root_directory(
+	     &root_directory,
+	     io_handle,
+	     file_io_handle,
+	     file_system,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfshfs_file_entry_get_sub_file_entry_by_index(
+	     root_directory,
+	     0,
+	     file_entry,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfshfs_directory_entry_get_data_fork_descriptor(
+	     ( (libfshfs_internal_file_entry_t *) *file_entry )->directory_entry,
+	     &fork_descriptor,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	fork_descriptor->size                        = data_size;
+	fork_descriptor->number_of_blocks            = 1;
+	fork_descriptor->extents[ 0 ][ 0 ]           = 2;
+	fork_descriptor->extents[ 0 ][ 1 ]           = 1;
+	fork_descriptor->number_of_blocks_in_extents = 1;
+
+	if( libfshfs_file_entry_free(
+	     &root_directory,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *file_entry != NULL )
+	{
+		libfshfs_file_entry_free(
+		 file_entry,
+		 NULL );
+	}
+	if( root_directory != NULL )
+	{
+		libfshfs_file_entry_free(
+		 &root_directory,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees an internal file entry with extents
+ * Returns 1 if successful or -1 on error
+ */
+int fshfs_test_internal_file_entry_free_with_extents(
+     libfshfs_internal_file_entry_t **internal_file_entry,
+     libcerror_error_t **error )
+{
+	int result = 1;
+
+	if( *internal_file_entry == NULL )
+	{
+		return( 1 );
+	}
+	if( ( *internal_file_entry )->extents_array != NULL )
+	{
+		if( libcdata_array_free(
+		     &( ( *internal_file_entry )->extents_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfshfs_extent_free,
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( ( *internal_file_entry )->read_runs != NULL )
+	{
+		memory_free(
+		 ( *internal_file_entry )->read_runs );
+	}
+	memory_free(
+	 *internal_file_entry );
+
+	*internal_file_entry = NULL;
+
+	return( result );
+}
+
+/* Creates an internal file entry with extents for testing the read runs
+ * The extents consist of 2 physically contiguous extents, a separate extent
+ * and 1 block of data beyond the last extent
+ * Returns 1 if successful or -1 on error
+ */
+int fshfs_test_internal_file_entry_initialize_with_extents(
+     libfshfs_internal_file_entry_t **internal_file_entry,
+     libfshfs_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	uint32_t block_numbers[ 3 ]    = { 10, 12, 20 };
+	uint64_t number_of_blocks[ 3 ] = { 2, 1, 1 };
+
+	libfshfs_extent_t *extent      = NULL;
+	int entry_index                = 0;
+	int extent_index               = 0;
+
+	*internal_file_entry = memory_allocate_structure(
+	                        libfshfs_internal_file_entry_t );
+
+	if( *internal_file_entry == NULL )
+	{
+		return( -1 );
+	}
+	if( memory_set(
+	     *internal_file_entry,
+	     0,
+	     sizeof( libfshfs_internal_file_entry_t ) ) == NULL )
+	{
+		memory_free(
+		 *internal_file_entry );
+
+		*internal_file_entry = NULL;
+
+		return( -1 );
+	}
+	( *internal_file_entry )->io_handle = io_handle;
+	( *internal_file_entry )->data_size = 5 * 4096;
+
+	if( libcdata_array_initialize(
+	     &( ( *internal_file_entry )->extents_array ),
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( extent_index = 0;
+	     extent_index < 3;
+	     extent_index++ )
+	{
+		if( libfshfs_extent_initialize(
+		     &extent,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		extent->block_number     = block_numbers[ extent_index ];
+		extent->number_of_blocks = number_of_blocks[ extent_index ];
+
+		if( libcdata_array_append_entry(
+		     ( *internal_file_entry )->extents_array,
+		     &entry_index,
+		     (intptr_t *) extent,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		extent = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( extent != NULL )
+	{
+		libfshfs_extent_free(
+		 &extent,
+		 NULL );
+	}
+	fshfs_test_internal_file_entry_free_with_extents(
+	 internal_file_entry,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Tests the libfshfs_internal_file_entry_determine_read_runs function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_internal_file_entry_determine_read_runs(
+     void )
+{
+	libcerror_error_t *error                            = NULL;
+	libfshfs_internal_file_entry_t *internal_file_entry = NULL;
+	libfshfs_io_handle_t *io_handle                     = NULL;
+	int result                                          = 0;
+
+	/* Initialize test
+	 */
+	result = libfshfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->block_size = 4096;
+
+	result = fshfs_test_internal_file_entry_initialize_with_extents(
+	          &internal_file_entry,
+	          io_handle,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_file_entry",
+	 internal_file_entry );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The first 2 extents are physically contiguous and combined into a single read run
+	 * and the data beyond the last extent is read as a sparse read run
+	 */
+	result = libfshfs_internal_file_entry_determine_read_runs(
+	          internal_file_entry,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_file_entry->read_runs",
+	 internal_file_entry->read_runs );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT8(
+	 "internal_file_entry->read_runs_determined",
+	 internal_file_entry->read_runs_determined,
+	 1 );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "internal_file_entry->number_of_read_runs",
+	 internal_file_entry->number_of_read_runs,
+	 3 );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT64(
+	 "internal_file_entry->read_runs[ 0 ].data_offset",
+	 (int64_t) internal_file_entry->read_runs[ 0 ].data_offset,
+	 (int64_t) 0 );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT64(
+	 "internal_file_entry->read_runs[ 0 ].volume_offset",
+	 (int64_t) internal_file_entry->read_runs[ 0 ].volume_offset,
+	 (int64_t) ( 10 * 4096 ) );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT64(
+	 "internal_file_entry->read_runs[ 0 ].size",
+	 (uint64_t) internal_file_entry->read_runs[ 0 ].size,
+	 (uint64_t) ( 3 * 4096 ) );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "internal_file_entry->read_runs[ 0 ].flags",
+	 internal_file_entry->read_runs[ 0 ].flags,
+	 (uint32_t) 0 );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT64(
+	 "internal_file_entry->read_runs[ 1 ].data_offset",
+	 (int64_t) internal_file_entry->read_runs[ 1 ].data_offset,
+	 (int64_t) ( 3 * 4096 ) );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT64(
+	 "internal_file_entry->read_runs[ 1 ].volume_offset",
+	 (int64_t) internal_file_entry->read_runs[ 1 ].volume_offset,
+	 (int64_t) ( 20 * 4096 ) );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT64(
+	 "internal_file_entry->read_runs[ 1 ].size",
+	 (uint64_t) internal_file_entry->read_runs[ 1 ].size,
+	 (uint64_t) 4096 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "internal_file_entry->read_runs[ 1 ].flags",
+	 internal_file_entry->read_runs[ 1 ].flags,
+	 (uint32_t) 0 );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT64(
+	 "internal_file_entry->read_runs[ 2 ].data_offset",
+	 (int64_t) internal_file_entry->read_runs[ 2 ].data_offset,
+	 (int64_t) ( 4 * 4096 ) );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT64(
+	 "internal_file_entry->read_runs[ 2 ].volume_offset",
+	 (int64_t) internal_file_entry->read_runs[ 2 ].volume_offset,
+	 (int64_t) 0 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT64(
+	 "internal_file_entry->read_runs[ 2 ].size",
+	 (uint64_t) internal_file_entry->read_runs[ 2 ].size,
+	 (uint64_t) 4096 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "internal_file_entry->read_runs[ 2 ].flags",
+	 internal_file_entry->read_runs[ 2 ].flags,
+	 (uint32_t) LIBFSHFS_EXTENT_FLAG_IS_SPARSE );
+
+	/* The read runs are trimmed to the size of the data
+	 */
+	memory_free(
+	 internal_file_entry->read_runs );
+
+	internal_file_entry->read_runs            = NULL;
+	internal_file_entry->read_runs_determined = 0;
+	internal_file_entry->data_size            = ( 2 * 4096 ) + 100;
+
+	result = libfshfs_internal_file_entry_determine_read_runs(
+	          internal_file_entry,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "internal_file_entry->number_of_read_runs",
+	 internal_file_entry->number_of_read_runs,
+	 1 );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT64(
+	 "internal_file_entry->read_runs[ 0 ].volume_offset",
+	 (int64_t) internal_file_entry->read_runs[ 0 ].volume_offset,
+	 (int64_t) ( 10 * 4096 ) );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT64(
+	 "internal_file_entry->read_runs[ 0 ].size",
+	 (uint64_t) internal_file_entry->read_runs[ 0 ].size,
+	 (uint64_t) ( ( 2 * 4096 ) + 100 ) );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "internal_file_entry->read_runs[ 0 ].flags",
+	 internal_file_entry->read_runs[ 0 ].flags,
+	 (uint32_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libfshfs_internal_file_entry_determine_read_runs(
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test determine read runs with read runs value already set
+	 */
+	result = libfshfs_internal_file_entry_determine_read_runs(
+	          internal_file_entry,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test determine read runs with compressed data
+	 */
+	memory_free(
+	 internal_file_entry->read_runs );
+
+	internal_file_entry->read_runs            = NULL;
+	internal_file_entry->read_runs_determined = 0;
+
+	result = libfshfs_compressed_data_header_initialize(
+	          &( internal_file_entry->compressed_data_header ),
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_internal_file_entry_determine_read_runs(
+	          internal_file_entry,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "internal_file_entry->read_runs",
+	 internal_file_entry->read_runs );
+
+	result = libfshfs_compressed_data_header_free(
+	          &( internal_file_entry->compressed_data_header ),
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = fshfs_test_internal_file_entry_free_with_extents(
+	          &internal_file_entry,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "internal_file_entry",
+	 internal_file_entry );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( internal_file_entry != NULL )
+	{
+		if( internal_file_entry->compressed_data_header != NULL )
+		{
+			libfshfs_compressed_data_header_free(
+			 &( internal_file_entry->compressed_data_header ),
+			 NULL );
+		}
+		fshfs_test_internal_file_entry_free_with_extents(
+		 &internal_file_entry,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfshfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_internal_file_entry_get_number_of_read_runs function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_internal_file_entry_get_number_of_read_runs(
+     void )
+{
+	libcerror_error_t *error                            = NULL;
+	libfshfs_internal_file_entry_t *internal_file_entry = NULL;
+	libfshfs_io_handle_t *io_handle                     = NULL;
+	int number_of_read_runs                             = 0;
+	int result                                          = 0;
+
+	/* Initialize test
+	 */
+	result = libfshfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->block_size = 4096;
+
+	result = fshfs_test_internal_file_entry_initialize_with_extents(
+	          &internal_file_entry,
+	          io_handle,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_file_entry",
+	 internal_file_entry );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfshfs_internal_file_entry_get_number_of_read_runs(
+	          internal_file_entry,
+	          &number_of_read_runs,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_read_runs",
+	 number_of_read_runs,
+	 3 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT8(
+	 "internal_file_entry->read_runs_determined",
+	 internal_file_entry->read_runs_determined,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libfshfs_internal_file_entry_get_number_of_read_runs(
+	          NULL,
+	          &number_of_read_runs,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_internal_file_entry_get_number_of_read_runs(
+	          internal_file_entry,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = fshfs_test_internal_file_entry_free_with_extents(
+	          &internal_file_entry,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "internal_file_entry",
+	 internal_file_entry );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( internal_file_entry != NULL )
+	{
+		fshfs_test_internal_file_entry_free_with_extents(
+		 &internal_file_entry,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfshfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_internal_file_entry_get_read_run_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_internal_file_entry_get_read_run_by_index(
+     void )
+{
+	libcerror_error_t *error                            = NULL;
+	libfshfs_internal_file_entry_t *internal_file_entry = NULL;
+	libfshfs_io_handle_t *io_handle                     = NULL;
+	size64_t size                                       = 0;
+	off64_t data_offset                                 = 0;
+	off64_t volume_offset                               = 0;
+	uint32_t flags                                      = 0;
+	int result                                          = 0;
+
+	/* Initialize test
+	 */
+	result = libfshfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->block_size = 4096;
+
+	result = fshfs_test_internal_file_entry_initialize_with_extents(
+	          &internal_file_entry,
+	          io_handle,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_file_entry",
+	 internal_file_entry );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The first 2 extents are physically contiguous and combined into a single read run
+	 */
+	result = libfshfs_internal_file_entry_get_read_run_by_index(
+	          internal_file_entry,
+	          0,
+	          &data_offset,
+	          &volume_offset,
+	          &size,
+	          &flags,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT64(
+	 "data_offset",
+	 (int64_t) data_offset,
+	 (int64_t) 0 );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT64(
+	 "volume_offset",
+	 (int64_t) volume_offset,
+	 (int64_t) ( 10 * 4096 ) );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) ( 3 * 4096 ) );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "flags",
+	 flags,
+	 (uint32_t) 0 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_internal_file_entry_get_read_run_by_index(
+	          internal_file_entry,
+	          1,
+	          &data_offset,
+	          &volume_offset,
+	          &size,
+	          &flags,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT64(
+	 "data_offset",
+	 (int64_t) data_offset,
+	 (int64_t) ( 3 * 4096 ) );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT64(
+	 "volume_offset",
+	 (int64_t) volume_offset,
+	 (int64_t) ( 20 * 4096 ) );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) 4096 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "flags",
+	 flags,
+	 (uint32_t) 0 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The data beyond the last extent is read as a sparse read run
+	 */
+	result = libfshfs_internal_file_entry_get_read_run_by_index(
+	          internal_file_entry,
+	          2,
+	          &data_offset,
+	          &volume_offset,
+	          &size,
+	          &flags,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT64(
+	 "data_offset",
+	 (int64_t) data_offset,
+	 (int64_t) ( 4 * 4096 ) );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT64(
+	 "volume_offset",
+	 (int64_t) volume_offset,
+	 (int64_t) 0 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) 4096 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "flags",
+	 flags,
+	 (uint32_t) LIBFSHFS_EXTENT_FLAG_IS_SPARSE );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_internal_file_entry_get_read_run_by_index(
+	          NULL,
+	          0,
+	          &data_offset,
+	          &volume_offset,
+	          &size,
+	          &flags,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_internal_file_entry_get_read_run_by_index(
+	          internal_file_entry,
+	          -1,
+	          &data_offset,
+	          &volume_offset,
+	          &size,
+	          &flags,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_internal_file_entry_get_read_run_by_index(
+	          internal_file_entry,
+	          3,
+	          &data_offset,
+	          &volume_offset,
+	          &size,
+	          &flags,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_internal_file_entry_get_read_run_by_index(
+	          internal_file_entry,
+	          0,
+	          NULL,
+	          &volume_offset,
+	          &size,
+	          &flags,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_internal_file_entry_get_read_run_by_index(
+	          internal_file_entry,
+	          0,
+	          &data_offset,
+	          NULL,
+	          &size,
+	          &flags,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_internal_file_entry_get_read_run_by_index(
+	          internal_file_entry,
+	          0,
+	          &data_offset,
+	          &volume_offset,
+	          NULL,
+	          &flags,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_internal_file_entry_get_read_run_by_index(
+	          internal_file_entry,
+	          0,
+	          &data_offset,
+	          &volume_offset,
+	          &size,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = fshfs_test_internal_file_entry_free_with_extents(
+	          &internal_file_entry,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "internal_file_entry",
+	 internal_file_entry );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( internal_file_entry != NULL )
+	{
+		fshfs_test_internal_file_entry_free_with_extents(
+		 &internal_file_entry,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfshfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_file_entry_get_number_of_read_runs function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_file_entry_get_number_of_read_runs(
+     void )
+{
+	libbfio_handle_t *file_io_handle    = NULL;
+	libcerror_error_t *error            = NULL;
+	libfshfs_file_entry_t *file_entry   = NULL;
+	libfshfs_file_system_t *file_system = NULL;
+	libfshfs_io_handle_t *io_handle     = NULL;
+	int number_of_read_runs             = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = fshfs_test_file_entry_initialize_file_system(
+	          &io_handle,
+	          &file_io_handle,
+	          &file_system,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fshfs_test_file_entry_initialize_regular_file(
+	          &file_entry,
+	          io_handle,
+	          file_io_handle,
+	          file_system,
+	          2 * 4096,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_entry",
+	 file_entry );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfshfs_file_entry_get_number_of_read_runs(
+	          file_entry,
+	          &number_of_read_runs,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_read_runs",
+	 number_of_read_runs,
+	 2 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_file_entry_get_number_of_read_runs(
+	          NULL,
+	          &number_of_read_runs,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_file_entry_get_number_of_read_runs(
+	          file_entry,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_file_entry_free(
+	          &file_entry,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "file_entry",
+	 file_entry );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fshfs_test_file_entry_free_file_system(
+	          &io_handle,
+	          &file_io_handle,
+	          &file_system,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_entry != NULL )
+	{
+		libfshfs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	fshfs_test_file_entry_free_file_system(
+	 &io_handle,
+	 &file_io_handle,
+	 &file_system,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libfshfs_file_entry_get_read_run_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_file_entry_get_read_run_by_index(
+     void )
+{
+	libbfio_handle_t *file_io_handle    = NULL;
+	libcerror_error_t *error            = NULL;
+	libfshfs_file_entry_t *file_entry   = NULL;
+	libfshfs_file_system_t *file_system = NULL;
+	libfshfs_io_handle_t *io_handle     = NULL;
+	size64_t size                       = 0;
+	off64_t data_offset                 = 0;
+	off64_t volume_offset               = 0;
+	uint32_t flags                      = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = fshfs_test_file_entry_initialize_file_system(
+	          &io_handle,
+	          &file_io_handle,
+	          &file_system,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fshfs_test_file_entry_initialize_regular_file(
+	          &file_entry,
+	          io_handle,
+	          file_io_handle,
+	          file_system,
+	          2 * 4096,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_entry",
+	 file_entry );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfshfs_file_entry_get_read_run_by_index(
+	          file_entry,
+	          0,
+	          &data_offset,
+	          &volume_offset,
+	          &size,
+	          &flags,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT64(
+	 "data_offset",
+	 (int64_t) data_offset,
+	 (int64_t) 0 );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT64(
+	 "volume_offset",
+	 (int64_t) volume_offset,
+	 (int64_t) ( 2 * 4096 ) );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) 4096 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "flags",
+	 flags,
+	 (uint32_t) 0 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The data beyond the last extent is read as a sparse read run
+	 */
+	result = libfshfs_file_entry_get_read_run_by_index(
+	          file_entry,
+	          1,
+	          &data_offset,
+	          &volume_offset,
+	          &size,
+	          &flags,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT64(
+	 "data_offset",
+	 (int64_t) data_offset,
+	 (int64_t) 4096 );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT64(
+	 "volume_offset",
+	 (int64_t) volume_offset,
+	 (int64_t) 0 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) 4096 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "flags",
+	 flags,
+	 (uint32_t) LIBFSHFS_EXTENT_FLAG_IS_SPARSE );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_file_entry_get_read_run_by_index(
+	          NULL,
+	          0,
+	          &data_offset,
+	          &volume_offset,
+	          &size,
+	          &flags,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_file_entry_get_read_run_by_index(
+	          file_entry,
+	          -1,
+	          &data_offset,
+	          &volume_offset,
+	          &size,
+	          &flags,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_file_entry_get_read_run_by_index(
+	          file_entry,
+	          2,
+	          &data_offset,
+	          &volume_offset,
+	          &size,
+	          &flags,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_file_entry_get_read_run_by_index(
+	          file_entry,
+	          0,
+	          NULL,
+	          &volume_offset,
+	          &size,
+	          &flags,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_file_entry_get_read_run_by_index(
+	          file_entry,
+	          0,
+	          &data_offset,
+	          NULL,
+	          &size,
+	          &flags,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_file_entry_get_read_run_by_index(
+	          file_entry,
+	          0,
+	          &data_offset,
+	          &volume_offset,
+	          NULL,
+	          &flags,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_file_entry_get_read_run_by_index(
+	          file_entry,
+	          0,
+	          &data_offset,
+	          &volume_offset,
+	          &size,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_file_entry_free(
+	          &file_entry,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "file_entry",
+	 file_entry );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fshfs_test_file_entry_free_file_system(
+	          &io_handle,
+	          &file_io_handle,
+	          &file_system,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_entry != NULL )
+	{
+		libfshfs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	fshfs_test_file_entry_free_file_system(
+	 &io_handle,
+	 &file_io_handle,
+	 &file_system,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libfshfs_internal_file_entry_get_sub_directory_entry_from_page function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_internal_file_entry_get_sub_directory_entry_from_page(
+     void )
+{
+	libcerror_error_t *error                            = NULL;
+	libfshfs_directory_entry_t *directory_entry         = NULL;
+	libfshfs_directory_entry_t *sub_directory_entry     = NULL;
+	libfshfs_internal_file_entry_t *internal_file_entry = NULL;
+	int entry_index                                     = 0;
+	int result                                          = 0;
+
+	/* Initialize test
+	 */
+	internal_file_entry = memory_allocate_structure(
+	                       libfshfs_internal_file_entry_t );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_file_entry",
+	 internal_file_entry );
+
+	result = memory_set(
+	          internal_file_entry,
+	          0,
+	          sizeof( libfshfs_internal_file_entry_t ) ) != NULL;
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	internal_file_entry->sub_file_entries_page_size = 4;
+
+	result = libfshfs_directory_entries_page_initialize(
+	          &( internal_file_entry->sub_directory_entries_page ),
+	          4,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_directory_entry_initialize(
+	          &directory_entry,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_append_entry(
+	          internal_file_entry->sub_directory_entries_page->directory_entries,
+	          &entry_index,
+	          (intptr_t *) directory_entry,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	directory_entry = NULL;
+
+	/* The page contains the only sub catalog record of the directory
+	 */
+	internal_file_entry->sub_directory_entries_page->is_last_page = 1;
+
+	/* Test regular cases
+	 */
+	result = libfshfs_internal_file_entry_get_sub_directory_entry_from_page(
+	          internal_file_entry,
+	          0,
+	          &sub_directory_entry,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_directory_entry",
+	 sub_directory_entry );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_internal_file_entry_get_sub_directory_entry_from_page(
+	          NULL,
+	          0,
+	          &sub_directory_entry,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_internal_file_entry_get_sub_directory_entry_from_page(
+	          internal_file_entry,
+	          -1,
+	          &sub_directory_entry,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test an index beyond the sub catalog records, such as when the number
+	 * of entries (valence) of the directory record exceeds the catalog records
+	 */
+	result = libfshfs_internal_file_entry_get_sub_directory_entry_from_page(
+	          internal_file_entry,
+	          1,
+	          &sub_directory_entry,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_directory_entries_page_free(
+	          &( internal_file_entry->sub_directory_entries_page ),
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 internal_file_entry );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_entry != NULL )
+	{
+		libfshfs_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	if( internal_file_entry != NULL )
+	{
+		if( internal_file_entry->sub_directory_entries_page != NULL )
+		{
+			libfshfs_directory_entries_page_free(
+			 &( internal_file_entry->sub_directory_entries_page ),
+			 NULL );
+		}
+		memory_free(
+		 internal_file_entry );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_internal_file_entry_read_ranges function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_internal_file_entry_read_ranges(
+     void )
+{
+	libfshfs_read_range_t read_ranges[ FSHFS_TEST_FILE_ENTRY_NUMBER_OF_READ_RANGES ];
+	uint8_t *buffers[ FSHFS_TEST_FILE_ENTRY_NUMBER_OF_READ_RANGES ];
+	ssize_t read_counts[ FSHFS_TEST_FILE_ENTRY_NUMBER_OF_READ_RANGES ];
+
+	/* The ranges are out of order, overlap, are adjacent, are separated by more
+	 * than the maximum gap size, exceed the maximum span size when coalesced
+	 * and extend beyond the end of the data
+	 */
+	off64_t offsets[ FSHFS_TEST_FILE_ENTRY_NUMBER_OF_READ_RANGES ] = {
+		4096, 4000, 4352, 0, 4416 + LIBFSHFS_READ_RANGES_MAXIMUM_GAP_SIZE + 1,
+		FSHFS_TEST_FILE_ENTRY_READ_RANGES_DATA_SIZE - 8, 100000,
+		100000 + LIBFSHFS_READ_RANGES_MAXIMUM_SPAN_SIZE - 16, 50 };
+
+	size_t sizes[ FSHFS_TEST_FILE_ENTRY_NUMBER_OF_READ_RANGES ] = {
+		256, 200, 64, 16, 32, 16, LIBFSHFS_READ_RANGES_MAXIMUM_SPAN_SIZE - 16, 32, 0 };
+
+	ssize_t expected_read_counts[ FSHFS_TEST_FILE_ENTRY_NUMBER_OF_READ_RANGES ] = {
+		256, 200, 64, 16, 32, 8, LIBFSHFS_READ_RANGES_MAXIMUM_SPAN_SIZE - 16, 32, 0 };
+
+	libcerror_error_t *error                            = NULL;
+	libfdata_stream_t *data_stream                      = NULL;
+	libfshfs_internal_file_entry_t *internal_file_entry = NULL;
+	uint8_t *data                                       = NULL;
+	size_t data_offset                                  = 0;
+	size_t range_data_offset                            = 0;
+	int range_index                                     = 0;
+	int result                                          = 0;
+
+	for( range_index = 0;
+	     range_index < FSHFS_TEST_FILE_ENTRY_NUMBER_OF_READ_RANGES;
+	     range_index++ )
+	{
+		buffers[ range_index ] = NULL;
+	}
+	/* Initialize test
+	 */
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * FSHFS_TEST_FILE_ENTRY_READ_RANGES_DATA_SIZE );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	for( data_offset = 0;
+	     data_offset < FSHFS_TEST_FILE_ENTRY_READ_RANGES_DATA_SIZE;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) ( data_offset % 251 );
+	}
+	for( range_index = 0;
+	     range_index < FSHFS_TEST_FILE_ENTRY_NUMBER_OF_READ_RANGES;
+	     range_index++ )
+	{
+		buffers[ range_index ] = (uint8_t *) memory_allocate(
+		                                      sizeof( uint8_t ) * ( sizes[ range_index ] + 1 ) );
+
+		FSHFS_TEST_ASSERT_IS_NOT_NULL(
+		 "buffers[ range_index ]",
+		 buffers[ range_index ] );
+
+		read_ranges[ range_index ].offset = offsets[ range_index ];
+		read_ranges[ range_index ].size   = sizes[ range_index ];
+		read_ranges[ range_index ].buffer = buffers[ range_index ];
+		read_ranges[ range_index ].index  = range_index;
+
+		read_counts[ range_index ] = -1;
+	}
+	qsort(
+	 read_ranges,
+	 (size_t) FSHFS_TEST_FILE_ENTRY_NUMBER_OF_READ_RANGES,
+	 sizeof( libfshfs_read_range_t ),
+	 (int (*)(const void *, const void *)) &libfshfs_read_range_compare_by_offset );
+
+	result = libfshfs_allocation_block_stream_initialize_from_data(
+	          &data_stream,
+	          data,
+	          FSHFS_TEST_FILE_ENTRY_READ_RANGES_DATA_SIZE,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "data_stream",
+	 data_stream );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_file_entry = memory_allocate_structure(
+	                       libfshfs_internal_file_entry_t );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_file_entry",
+	 internal_file_entry );
+
+	result = memory_set(
+	          internal_file_entry,
+	          0,
+	          sizeof( libfshfs_internal_file_entry_t ) ) != NULL;
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	internal_file_entry->data_stream = data_stream;
+
+	/* Test regular cases
+	 */
+	result = libfshfs_internal_file_entry_read_ranges(
+	          internal_file_entry,
+	          read_ranges,
+	          FSHFS_TEST_FILE_ENTRY_NUMBER_OF_READ_RANGES,
+	          read_counts,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( range_index = 0;
+	     range_index < FSHFS_TEST_FILE_ENTRY_NUMBER_OF_READ_RANGES;
+	     range_index++ )
+	{
+		FSHFS_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_counts[ range_index ]",
+		 read_counts[ range_index ],
+		 expected_read_counts[ range_index ] );
+
+		for( range_data_offset = 0;
+		     range_data_offset < (size_t) read_counts[ range_index ];
+		     range_data_offset++ )
+		{
+			data_offset = (size_t) offsets[ range_index ] + range_data_offset;
+
+			FSHFS_TEST_ASSERT_EQUAL_UINT8(
+			 "buffers[ range_index ][ range_data_offset ]",
+			 buffers[ range_index ][ range_data_offset ],
+			 data[ data_offset ] );
+		}
+	}
+	result = libfshfs_internal_file_entry_read_ranges(
+	          internal_file_entry,
+	          read_ranges,
+	          0,
+	          read_counts,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_internal_file_entry_read_ranges(
+	          NULL,
+	          read_ranges,
+	          FSHFS_TEST_FILE_ENTRY_NUMBER_OF_READ_RANGES,
+	          read_counts,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	internal_file_entry->data_stream = NULL;
+
+	result = libfshfs_internal_file_entry_read_ranges(
+	          internal_file_entry,
+	          read_ranges,
+	          FSHFS_TEST_FILE_ENTRY_NUMBER_OF_READ_RANGES,
+	          read_counts,
+	          &error );
+
+	internal_file_entry->data_stream = data_stream;
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_internal_file_entry_read_ranges(
+	          internal_file_entry,
+	          NULL,
+	          FSHFS_TEST_FILE_ENTRY_NUMBER_OF_READ_RANGES,
+	          read_counts,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_internal_file_entry_read_ranges(
+	          internal_file_entry,
+	          read_ranges,
+	          -1,
+	          read_counts,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_internal_file_entry_read_ranges(
+	          internal_file_entry,
+	          read_ranges,
+	          FSHFS_TEST_FILE_ENTRY_NUMBER_OF_READ_RANGES,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 internal_file_entry );
+
+	internal_file_entry = NULL;
+
+	result = libfdata_stream_free(
+	          &data_stream,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "data_stream",
+	 data_stream );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( range_index = 0;
+	     range_index < FSHFS_TEST_FILE_ENTRY_NUMBER_OF_READ_RANGES;
+	     range_index++ )
+	{
+		memory_free(
+		 buffers[ range_index ] );
+	}
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( internal_file_entry != NULL )
+	{
+		memory_free(
+		 internal_file_entry );
+	}
+	if( data_stream != NULL )
+	{
+		libfdata_stream_free(
+		 &data_stream,
+		 NULL );
+	}
+	for( range_index = 0;
+	     range_index < FSHFS_TEST_FILE_ENTRY_NUMBER_OF_READ_RANGES;
+	     range_index++ )
+	{
+		if( buffers[ range_index ] != NULL )
+		{
+			memory_free(
+			 buffers[ range_index ] );
+		}
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_file_entry_read_buffers_at_offsets function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_file_entry_read_buffers_at_offsets(
+     void )
+{
+	libfshfs_volume_statistics_t volume_statistics;
+	uint8_t buffer_data[ 4 ][ 256 ];
+	uint8_t *buffers[ 4 ];
+	ssize_t read_counts[ 4 ];
+
+	/* The ranges are out of order and adjacent and are coalesced into a single read
+	 */
+	off64_t coalesced_offsets[ 4 ] = {
+		2048, 0, 16, 1024 };
+
+	size_t coalesced_sizes[ 4 ] = {
+		64, 16, 32, 128 };
+
+	/* The ranges extend beyond the end of the data
+	 */
+	off64_t truncated_offsets[ 3 ] = {
+		3900, 4008, 10 };
+
+	size_t truncated_sizes[ 3 ] = {
+		200, 16, 8 };
+
+	ssize_t truncated_read_counts[ 3 ] = {
+		100, 0, 8 };
+
+	libbfio_handle_t *file_io_handle      = NULL;
+	libcerror_error_t *error              = NULL;
+	libfshfs_file_entry_t *file_entry     = NULL;
+	libfshfs_file_entry_t *root_directory = NULL;
+	libfshfs_file_system_t *file_system   = NULL;
+	libfshfs_io_handle_t *io_handle       = NULL;
+	size_t range_data_offset              = 0;
+	off64_t data_offset                   = 0;
+	int range_index                       = 0;
+	int result                            = 0;
+
+	for( range_index = 0;
+	     range_index < 4;
+	     range_index++ )
+	{
+		buffers[ range_index ] = buffer_data[ range_index ];
+	}
+	/* Initialize test
+	 */
+	result = fshfs_test_file_entry_initialize_file_system(
+	          &io_handle,
+	          &file_io_handle,
+	          &file_system,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Read the data directly so that every read of the data is counted
+	 */
+	io_handle->maximum_read_ahead_size = 0;
+
+	result = fshfs_test_file_entry_initialize_regular_file(
+	          &file_entry,
+	          io_handle,
+	          file_io_handle,
+	          file_system,
+	          4000,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_entry",
+	 file_entry );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fshfs_test_file_entry_initialize_root_directory(
+	          &root_directory,
+	          io_handle,
+	          file_io_handle,
+	          file_system,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "root_directory",
+	 root_directory );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_statistics_reset(
+	          io_handle->statistics,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = memory_set(
+	          buffer_data,
+	          0xff,
+	          sizeof( uint8_t ) * 4 * 256 ) != NULL;
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfshfs_file_entry_read_buffers_at_offsets(
+	          file_entry,
+	          coalesced_offsets,
+	          coalesced_sizes,
+	          buffers,
+	          4,
+	          read_counts,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( range_index = 0;
+	     range_index < 4;
+	     range_index++ )
+	{
+		FSHFS_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_counts[ range_index ]",
+		 read_counts[ range_index ],
+		 (ssize_t) coalesced_sizes[ range_index ] );
+
+		for( range_data_offset = 0;
+		     range_data_offset < coalesced_sizes[ range_index ];
+		     range_data_offset++ )
+		{
+			data_offset = coalesced_offsets[ range_index ] + (off64_t) range_data_offset;
+
+			FSHFS_TEST_ASSERT_EQUAL_UINT8(
+			 "buffers[ range_index ][ range_data_offset ]",
+			 buffers[ range_index ][ range_data_offset ],
+			 fshfs_test_file_entry_catalog_data[ ( 2 * 4096 ) + data_offset ] );
+		}
+	}
+	result = libfshfs_statistics_get_values(
+	          io_handle->statistics,
+	          &volume_statistics,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT64(
+	 "volume_statistics.number_of_reads[ LIBFSHFS_STATISTICS_REGION_DATA ]",
+	 volume_statistics.number_of_reads[ LIBFSHFS_STATISTICS_REGION_DATA ],
+	 (uint64_t) 1 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT64(
+	 "volume_statistics.read_sizes[ LIBFSHFS_STATISTICS_REGION_DATA ]",
+	 volume_statistics.read_sizes[ LIBFSHFS_STATISTICS_REGION_DATA ],
+	 (uint64_t) ( 2048 + 64 ) );
+
+	/* Test that the ranges are truncated at the end of the data
+	 */
+	result = memory_set(
+	          buffer_data,
+	          0xff,
+	          sizeof( uint8_t ) * 4 * 256 ) != NULL;
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfshfs_file_entry_read_buffers_at_offsets(
+	          file_entry,
+	          truncated_offsets,
+	          truncated_sizes,
+	          buffers,
+	          3,
+	          read_counts,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( range_index = 0;
+	     range_index < 3;
+	     range_index++ )
+	{
+		FSHFS_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_counts[ range_index ]",
+		 read_counts[ range_index ],
+		 truncated_read_counts[ range_index ] );
+
+		for( range_data_offset = 0;
+		     range_data_offset < (size_t) read_counts[ range_index ];
+		     range_data_offset++ )
+		{
+			data_offset = truncated_offsets[ range_index ] + (off64_t) range_data_offset;
+
+			FSHFS_TEST_ASSERT_EQUAL_UINT8(
+			 "buffers[ range_index ][ range_data_offset ]",
+			 buffers[ range_index ][ range_data_offset ],
+			 fshfs_test_file_entry_catalog_data[ ( 2 * 4096 ) + data_offset ] );
+		}
+	}
+	/* Test that no ranges are read
+	 */
+	result = libfshfs_file_entry_read_buffers_at_offsets(
+	          file_entry,
+	          truncated_offsets,
+	          truncated_sizes,
+	          buffers,
+	          0,
+	          read_counts,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_file_entry_read_buffers_at_offsets(
+	          NULL,
+	          coalesced_offsets,
+	          coalesced_sizes,
+	          buffers,
+	          4,
+	          read_counts,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test read buffers at offsets of a directory
+	 */
+	result = libfshfs_file_entry_read_buffers_at_offsets(
+	          root_directory,
+	          coalesced_offsets,
+	          coalesced_sizes,
+	          buffers,
+	          4,
+	          read_counts,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_file_entry_read_buffers_at_offsets(
+	          file_entry,
+	          NULL,
+	          coalesced_sizes,
+	          buffers,
+	          4,
+	          read_counts,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_file_entry_read_buffers_at_offsets(
+	          file_entry,
+	          coalesced_offsets,
+	          NULL,
+	          buffers,
+	          4,
+	          read_counts,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_file_entry_read_buffers_at_offsets(
+	          file_entry,
+	          coalesced_offsets,
+	          coalesced_sizes,
+	          NULL,
+	          4,
+	          read_counts,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_file_entry_read_buffers_at_offsets(
+	          file_entry,
+	          coalesced_offsets,
+	          coalesced_sizes,
+	          buffers,
+	          4,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_file_entry_read_buffers_at_offsets(
+	          file_entry,
+	          coalesced_offsets,
+	          coalesced_sizes,
+	          buffers,
+	          -1,
+	          read_counts,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test read buffers at offsets with a negative offset
+	 */
+	coalesced_offsets[ 0 ] = -1;
+
+	result = libfshfs_file_entry_read_buffers_at_offsets(
+	          file_entry,
+	          coalesced_offsets,
+	          coalesced_sizes,
+	          buffers,
+	          4,
+	          read_counts,
+	          &error );
+
+	coalesced_offsets[ 0 ] = 2048;
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test read buffers at offsets with a missing buffer
+	 */
+	buffers[ 0 ] = NULL;
+
+	result = libfshfs_file_entry_read_buffers_at_offsets(
+	          file_entry,
+	          coalesced_offsets,
+	          coalesced_sizes,
+	          buffers,
+	          4,
+	          read_counts,
+	          &error );
+
+	buffers[ 0 ] = buffer_data[ 0 ];
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_file_entry_free(
+	          &root_directory,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "root_directory",
+	 root_directory );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_file_entry_free(
+	          &file_entry,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "file_entry",
+	 file_entry );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fshfs_test_file_entry_free_file_system(
+	          &io_handle,
+	          &file_io_handle,
+	          &file_system,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( root_directory != NULL )
+	{
+		libfshfs_file_entry_free(
+		 &root_directory,
+		 NULL );
+	}
+	if( file_entry != NULL )
+	{
+		libfshfs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	fshfs_test_file_entry_free_file_system(
+	 &io_handle,
+	 &file_io_handle,
+	 &file_system,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Collects the identifiers of the sub catalog records
+ * Callback function for libfshfs_catalog_btree_file_iterate_sub_records
+ * Returns 1 to continue, 0 to stop or -1 on error
+ */
+int fshfs_test_file_entry_collect_sub_record(
+     libfshfs_catalog_btree_key_t *node_key,
+     const libfshfs_file_entry_stat_t *stat_value,
+     uint32_t link_reference FSHFS_TEST_ATTRIBUTE_UNUSED,
+     void *callback_data,
+     libcerror_error_t **error FSHFS_TEST_ATTRIBUTE_UNUSED )
+{
+	fshfs_test_file_entry_sub_records_t *sub_records = NULL;
+
+	FSHFS_TEST_UNREFERENCED_PARAMETER( link_reference )
+	FSHFS_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( ( node_key == NULL )
+	 || ( stat_value == NULL )
+	 || ( callback_data == NULL ) )
+	{
+		return( -1 );
+	}
+	sub_records = (fshfs_test_file_entry_sub_records_t *) callback_data;
+
+	if( sub_records->number_of_records >= 8 )
+	{
+		return( -1 );
+	}
+	sub_records->parent_identifiers[ sub_records->number_of_records ] = node_key->parent_identifier;
+	sub_records->identifiers[ sub_records->number_of_records++ ]      = stat_value->identifier;
+
+	if( sub_records->number_of_records >= sub_records->maximum_number_of_records )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Collects the parent identifiers and identifiers of the catalog records
+ * Callback function for libfshfs_file_system_iterate_catalog_records
+ * Returns 1 to continue, 0 to stop or -1 on error
+ */
+int fshfs_test_file_entry_collect_record(
+     uint32_t parent_identifier,
+     const uint8_t *name_data,
+     size_t name_size FSHFS_TEST_ATTRIBUTE_UNUSED,
+     const libfshfs_file_entry_stat_t *stat_value,
+     void *callback_data,
+     libcerror_error_t **error FSHFS_TEST_ATTRIBUTE_UNUSED )
+{
+	fshfs_test_file_entry_sub_records_t *records = NULL;
+
+	FSHFS_TEST_UNREFERENCED_PARAMETER( name_size )
+	FSHFS_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( ( name_data == NULL )
+	 || ( stat_value == NULL )
+	 || ( callback_data == NULL ) )
+	{
+		return( -1 );
+	}
+	records = (fshfs_test_file_entry_sub_records_t *) callback_data;
+
+	if( records->number_of_records >= 8 )
+	{
+		return( -1 );
+	}
+	records->parent_identifiers[ records->number_of_records ] = parent_identifier;
+	records->identifiers[ records->number_of_records++ ]      = stat_value->identifier;
+
+	if( records->number_of_records >= records->maximum_number_of_records )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Tests the libfshfs_catalog_btree_file_get_stat_from_key function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_catalog_btree_file_get_stat_from_key(
+     void )
+{
+	libfshfs_catalog_btree_key_t node_key;
+	libfshfs_file_entry_stat_t stat_value;
+
+	libcerror_error_t *error = NULL;
+	uint32_t link_reference  = 0;
+	int result               = 0;
+
+	result = memory_set(
+	          &node_key,
+	          0,
+	          sizeof( libfshfs_catalog_btree_key_t ) ) != NULL;
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	node_key.record_data      = &( fshfs_test_file_entry_catalog_leaf_node_data1[ 154 ] );
+	node_key.record_data_size = 248;
+
+	result = libfshfs_catalog_btree_file_get_stat_from_key(
+	          &node_key,
+	          &stat_value,
+	          &link_reference,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "stat_value.identifier",
+	 stat_value.identifier,
+	 16 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "stat_value.creation_time",
+	 stat_value.creation_time,
+	 0xdc3e1210UL );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "stat_value.modification_time",
+	 stat_value.modification_time,
+	 0xdc3e1211UL );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "stat_value.entry_modification_time",
+	 stat_value.entry_modification_time,
+	 0xdc3e1212UL );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "stat_value.access_time",
+	 stat_value.access_time,
+	 0xdc3e1213UL );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "stat_value.owner_identifier",
+	 stat_value.owner_identifier,
+	 501 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "stat_value.group_identifier",
+	 stat_value.group_identifier,
+	 20 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT16(
+	 "stat_value.file_mode",
+	 stat_value.file_mode,
+	 0x81a4 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT64(
+	 "stat_value.data_fork_size",
+	 stat_value.data_fork_size,
+	 (uint64_t) 5 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT64(
+	 "stat_value.resource_fork_size",
+	 stat_value.resource_fork_size,
+	 (uint64_t) 0 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "stat_value.number_of_links",
+	 stat_value.number_of_links,
+	 1 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "link_reference",
+	 link_reference,
+	 0 );
+
+	/* Test a directory record
+	 */
+	node_key.record_data      = &( fshfs_test_file_entry_catalog_leaf_node_data1[ 412 ] );
+	node_key.record_data_size = 88;
+
+	result = libfshfs_catalog_btree_file_get_stat_from_key(
+	          &node_key,
+	          &stat_value,
+	          &link_reference,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "stat_value.identifier",
+	 stat_value.identifier,
+	 17 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT16(
+	 "stat_value.file_mode",
+	 stat_value.file_mode,
+	 0x41ed );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT64(
+	 "stat_value.data_fork_size",
+	 stat_value.data_fork_size,
+	 (uint64_t) 0 );
+
+	/* Test a file record with a resource fork
+	 */
+	node_key.record_data      = &( fshfs_test_file_entry_catalog_leaf_node_data1[ 512 ] );
+	node_key.record_data_size = 248;
+
+	result = libfshfs_catalog_btree_file_get_stat_from_key(
+	          &node_key,
+	          &stat_value,
+	          &link_reference,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "stat_value.identifier",
+	 stat_value.identifier,
+	 18 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT64(
+	 "stat_value.resource_fork_size",
+	 stat_value.resource_fork_size,
+	 (uint64_t) 10 );
+
+	/* Test a thread record
+	 */
+	node_key.record_data      = &( fshfs_test_file_entry_catalog_leaf_node_data1[ 126 ] );
+	node_key.record_data_size = 18;
+
+	result = libfshfs_catalog_btree_file_get_stat_from_key(
+	          &node_key,
+	          &stat_value,
+	          &link_reference,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_catalog_btree_file_get_stat_from_key(
+	          NULL,
+	          &stat_value,
+	          &link_reference,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	node_key.record_data      = &( fshfs_test_file_entry_catalog_leaf_node_data1[ 154 ] );
+	node_key.record_data_size = 248;
+
+	result = libfshfs_catalog_btree_file_get_stat_from_key(
+	          &node_key,
+	          NULL,
+	          &link_reference,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_catalog_btree_file_get_stat_from_key(
+	          &node_key,
+	          &stat_value,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a record data size that is too small for a file record
+	 */
+	node_key.record_data_size = 247;
+
+	result = libfshfs_catalog_btree_file_get_stat_from_key(
+	          &node_key,
+	          &stat_value,
+	          &link_reference,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	node_key.record_data_size = 1;
+
+	result = libfshfs_catalog_btree_file_get_stat_from_key(
+	          &node_key,
+	          &stat_value,
+	          &link_reference,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	node_key.record_data      = NULL;
+	node_key.record_data_size = 248;
+
+	result = libfshfs_catalog_btree_file_get_stat_from_key(
+	          &node_key,
+	          &stat_value,
+	          &link_reference,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_catalog_btree_file_iterate_sub_records function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_catalog_btree_file_iterate_sub_records(
+     void )
+{
+	fshfs_test_file_entry_sub_records_t sub_records;
+
+	libbfio_handle_t *file_io_handle      = NULL;
+	libcerror_error_t *error              = NULL;
+	libfshfs_file_system_t *file_system   = NULL;
+	libfshfs_io_handle_t *io_handle       = NULL;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = fshfs_test_file_entry_initialize_file_system(
+	          &io_handle,
+	          &file_io_handle,
+	          &file_system,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	sub_records.number_of_records         = 0;
+	sub_records.maximum_number_of_records = 4;
+
+	result = libfshfs_catalog_btree_file_iterate_sub_records(
+	          file_system->catalog_btree_file,
+	          io_handle,
+	          file_io_handle,
+	          file_system->catalog_btree_node_cache,
+	          LIBFSHFS_ROOT_DIRECTORY_IDENTIFIER,
+	          &fshfs_test_file_entry_collect_sub_record,
+	          (void *) &sub_records,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The thread record of the root directory and the records of other parents are skipped
+	 */
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "sub_records.number_of_records",
+	 sub_records.number_of_records,
+	 3 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "sub_records.identifiers[ 0 ]",
+	 sub_records.identifiers[ 0 ],
+	 16 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "sub_records.identifiers[ 1 ]",
+	 sub_records.identifiers[ 1 ],
+	 17 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "sub_records.identifiers[ 2 ]",
+	 sub_records.identifiers[ 2 ],
+	 18 );
+
+	sub_records.number_of_records         = 0;
+	sub_records.maximum_number_of_records = 4;
+
+	result = libfshfs_catalog_btree_file_iterate_sub_records(
+	          file_system->catalog_btree_file,
+	          io_handle,
+	          file_io_handle,
+	          file_system->catalog_btree_node_cache,
+	          17,
+	          &fshfs_test_file_entry_collect_sub_record,
+	          (void *) &sub_records,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "sub_records.number_of_records",
+	 sub_records.number_of_records,
+	 1 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "sub_records.identifiers[ 0 ]",
+	 sub_records.identifiers[ 0 ],
+	 19 );
+
+	/* Test the callback function stopping the iteration
+	 */
+	sub_records.number_of_records         = 0;
+	sub_records.maximum_number_of_records = 1;
+
+	result = libfshfs_catalog_btree_file_iterate_sub_records(
+	          file_system->catalog_btree_file,
+	          io_handle,
+	          file_io_handle,
+	          file_system->catalog_btree_node_cache,
+	          LIBFSHFS_ROOT_DIRECTORY_IDENTIFIER,
+	          &fshfs_test_file_entry_collect_sub_record,
+	          (void *) &sub_records,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "sub_records.number_of_records",
+	 sub_records.number_of_records,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libfshfs_catalog_btree_file_iterate_sub_records(
+	          NULL,
+	          io_handle,
+	          file_io_handle,
+	          file_system->catalog_btree_node_cache,
+	          LIBFSHFS_ROOT_DIRECTORY_IDENTIFIER,
+	          &fshfs_test_file_entry_collect_sub_record,
+	          (void *) &sub_records,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_catalog_btree_file_iterate_sub_records(
+	          file_system->catalog_btree_file,
+	          io_handle,
+	          file_io_handle,
+	          file_system->catalog_btree_node_cache,
+	          LIBFSHFS_ROOT_DIRECTORY_IDENTIFIER,
+	          NULL,
+	          (void *) &sub_records,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test the callback function failing
+	 */
+	result = libfshfs_catalog_btree_file_iterate_sub_records(
+	          file_system->catalog_btree_file,
+	          io_handle,
+	          file_io_handle,
+	          file_system->catalog_btree_node_cache,
+	          LIBFSHFS_ROOT_DIRECTORY_IDENTIFIER,
+	          &fshfs_test_file_entry_collect_sub_record,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = fshfs_test_file_entry_free_file_system(
+	          &io_handle,
+	          &file_io_handle,
+	          &file_system,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	fshfs_test_file_entry_free_file_system(
+	 &io_handle,
+	 &file_io_handle,
+	 &file_system,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libfshfs_file_system_iterate_catalog_records function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_file_system_iterate_catalog_records(
+     void )
+{
+	fshfs_test_file_entry_sub_records_t records;
+
+	libbfio_handle_t *file_io_handle    = NULL;
+	libcerror_error_t *error            = NULL;
+	libfshfs_file_system_t *file_system = NULL;
+	libfshfs_io_handle_t *io_handle     = NULL;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = fshfs_test_file_entry_initialize_file_system(
+	          &io_handle,
+	          &file_io_handle,
+	          &file_system,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	records.number_of_records         = 0;
+	records.maximum_number_of_records = 8;
+
+	result = libfshfs_file_system_iterate_catalog_records(
+	          file_system,
+	          io_handle,
+	          file_io_handle,
+	          &fshfs_test_file_entry_collect_record,
+	          (void *) &records,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The thread record of the root directory is skipped
+	 */
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "records.number_of_records",
+	 records.number_of_records,
+	 5 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "records.parent_identifiers[ 0 ]",
+	 records.parent_identifiers[ 0 ],
+	 1 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "records.identifiers[ 0 ]",
+	 records.identifiers[ 0 ],
+	 2 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "records.parent_identifiers[ 1 ]",
+	 records.parent_identifiers[ 1 ],
+	 2 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "records.identifiers[ 1 ]",
+	 records.identifiers[ 1 ],
+	 16 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "records.parent_identifiers[ 2 ]",
+	 records.parent_identifiers[ 2 ],
+	 2 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "records.identifiers[ 2 ]",
+	 records.identifiers[ 2 ],
+	 17 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "records.parent_identifiers[ 3 ]",
+	 records.parent_identifiers[ 3 ],
+	 2 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "records.identifiers[ 3 ]",
+	 records.identifiers[ 3 ],
+	 18 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "records.parent_identifiers[ 4 ]",
+	 records.parent_identifiers[ 4 ],
+	 17 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "records.identifiers[ 4 ]",
+	 records.identifiers[ 4 ],
+	 19 );
+
+	/* Test the callback function stopping the iteration
+	 */
+	records.number_of_records         = 0;
+	records.maximum_number_of_records = 2;
+
+	result = libfshfs_file_system_iterate_catalog_records(
+	          file_system,
+	          io_handle,
+	          file_io_handle,
+	          &fshfs_test_file_entry_collect_record,
+	          (void *) &records,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "records.number_of_records",
+	 records.number_of_records,
+	 2 );
+
+	/* Test an aborted iteration
+	 */
+	records.number_of_records         = 0;
+	records.maximum_number_of_records = 8;
+
+	io_handle->abort = 1;
+
+	result = libfshfs_file_system_iterate_catalog_records(
+	          file_system,
+	          io_handle,
+	          file_io_handle,
+	          &fshfs_test_file_entry_collect_record,
+	          (void *) &records,
+	          &error );
+
+	io_handle->abort = 0;
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "records.number_of_records",
+	 records.number_of_records,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfshfs_file_system_iterate_catalog_records(
+	          NULL,
+	          io_handle,
+	          file_io_handle,
+	          &fshfs_test_file_entry_collect_record,
+	          (void *) &records,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_file_system_iterate_catalog_records(
+	          file_system,
+	          NULL,
+	          file_io_handle,
+	          &fshfs_test_file_entry_collect_record,
+	          (void *) &records,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_file_system_iterate_catalog_records(
+	          file_system,
+	          io_handle,
+	          file_io_handle,
+	          NULL,
+	          (void *) &records,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test the callback function failing
+	 */
+	result = libfshfs_file_system_iterate_catalog_records(
+	          file_system,
+	          io_handle,
+	          file_io_handle,
+	          &fshfs_test_file_entry_collect_record,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = fshfs_test_file_entry_free_file_system(
+	          &io_handle,
+	          &file_io_handle,
+	          &file_system,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	fshfs_test_file_entry_free_file_system(
+	 &io_handle,
+	 &file_io_handle,
+	 &file_system,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libfshfs_catalog_btree_file_get_number_of_sub_records function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_catalog_btree_file_get_number_of_sub_records(
+     void )
+{
+	libbfio_handle_t *file_io_handle    = NULL;
+	libcerror_error_t *error            = NULL;
+	libfshfs_file_system_t *file_system = NULL;
+	libfshfs_io_handle_t *io_handle     = NULL;
+	int number_of_sub_records           = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = fshfs_test_file_entry_initialize_file_system(
+	          &io_handle,
+	          &file_io_handle,
+	          &file_system,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfshfs_catalog_btree_file_get_number_of_sub_records(
+	          file_system->catalog_btree_file,
+	          io_handle,
+	          file_io_handle,
+	          file_system->catalog_btree_node_cache,
+	          LIBFSHFS_ROOT_DIRECTORY_IDENTIFIER,
+	          &number_of_sub_records,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The thread record of the root directory and the records of other parents are not counted
+	 */
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sub_records",
+	 number_of_sub_records,
+	 3 );
+
+	result = libfshfs_catalog_btree_file_get_number_of_sub_records(
+	          file_system->catalog_btree_file,
+	          io_handle,
+	          file_io_handle,
+	          file_system->catalog_btree_node_cache,
+	          17,
+	          &number_of_sub_records,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sub_records",
+	 number_of_sub_records,
+	 1 );
+
+	result = libfshfs_catalog_btree_file_get_number_of_sub_records(
+	          file_system->catalog_btree_file,
+	          io_handle,
+	          file_io_handle,
+	          file_system->catalog_btree_node_cache,
+	          16,
+	          &number_of_sub_records,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sub_records",
+	 number_of_sub_records,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfshfs_catalog_btree_file_get_number_of_sub_records(
+	          NULL,
+	          io_handle,
+	          file_io_handle,
+	          file_system->catalog_btree_node_cache,
+	          LIBFSHFS_ROOT_DIRECTORY_IDENTIFIER,
+	          &number_of_sub_records,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_catalog_btree_file_get_number_of_sub_records(
+	          file_system->catalog_btree_file,
+	          io_handle,
+	          file_io_handle,
+	          file_system->catalog_btree_node_cache,
+	          LIBFSHFS_ROOT_DIRECTORY_IDENTIFIER,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = fshfs_test_file_entry_free_file_system(
+	          &io_handle,
+	          &file_io_handle,
+	          &file_system,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	fshfs_test_file_entry_free_file_system(
+	 &io_handle,
+	 &file_io_handle,
+	 &file_system,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libfshfs_file_entry_get_number_of_sub_file_entries function in paged mode
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_file_entry_get_number_of_sub_file_entries(
+     void )
+{
+	libbfio_handle_t *file_io_handle                    = NULL;
+	libcerror_error_t *error                            = NULL;
+	libfshfs_directory_entry_t *directory_entry         = NULL;
+	libfshfs_file_entry_t *file_entry                   = NULL;
+	libfshfs_file_entry_t *sub_file_entry               = NULL;
+	libfshfs_file_system_t *file_system                 = NULL;
+	libfshfs_internal_file_entry_t *internal_file_entry = NULL;
+	libfshfs_io_handle_t *io_handle                     = NULL;
+	int number_of_sub_file_entries                      = 0;
+	int result                                          = 0;
+
+	/* Initialize test
+	 */
+	result = fshfs_test_file_entry_initialize_file_system(
+	          &io_handle,
+	          &file_io_handle,
+	          &file_system,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fshfs_test_file_entry_initialize_root_directory(
+	          &file_entry,
+	          io_handle,
+	          file_io_handle,
+	          file_system,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_entry",
+	 file_entry );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_file_entry = (libfshfs_internal_file_entry_t *) file_entry;
+
+	result = libfshfs_file_entry_set_sub_file_entries_page_size(
+	          file_entry,
+	          2,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfshfs_file_entry_get_number_of_sub_file_entries(
+	          file_entry,
+	          &number_of_sub_file_entries,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sub_file_entries",
+	 number_of_sub_file_entries,
+	 3 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT8(
+	 "internal_file_entry->number_of_sub_file_entries_determined",
+	 internal_file_entry->number_of_sub_file_entries_determined,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "internal_file_entry->sub_directory_entries",
+	 internal_file_entry->sub_directory_entries );
+
+	/* Test that the number of sub file entries is counted without
+	 * a number of entries (valence) of the directory record
+	 */
+	directory_entry = internal_file_entry->directory_entry;
+
+	internal_file_entry->directory_entry                       = NULL;
+	internal_file_entry->number_of_sub_file_entries_determined = 0;
+
+	result = libfshfs_internal_file_entry_determine_number_of_sub_file_entries(
+	          internal_file_entry,
+	          &error );
+
+	internal_file_entry->directory_entry = directory_entry;
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "internal_file_entry->number_of_sub_file_entries",
+	 internal_file_entry->number_of_sub_file_entries,
+	 3 );
+
+	/* Test that the last sub directory entries page corrects
+	 * a number of entries (valence) that does not match the catalog records
+	 */
+	internal_file_entry->number_of_sub_file_entries = 5;
+
+	result = libfshfs_file_entry_get_number_of_sub_file_entries(
+	          file_entry,
+	          &number_of_sub_file_entries,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sub_file_entries",
+	 number_of_sub_file_entries,
+	 5 );
+
+	result = libfshfs_file_entry_get_sub_file_entry_by_index(
+	          file_entry,
+	          2,
+	          &sub_file_entry,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_file_entry",
+	 sub_file_entry );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_file_entry_free(
+	          &sub_file_entry,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_file_entry_get_number_of_sub_file_entries(
+	          file_entry,
+	          &number_of_sub_file_entries,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sub_file_entries",
+	 number_of_sub_file_entries,
+	 3 );
+
+	result = libfshfs_file_entry_get_sub_file_entry_by_index(
+	          file_entry,
+	          3,
+	          &sub_file_entry,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "sub_file_entry",
+	 sub_file_entry );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_file_entry_get_number_of_sub_file_entries(
+	          NULL,
+	          &number_of_sub_file_entries,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_file_entry_get_number_of_sub_file_entries(
+	          file_entry,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_internal_file_entry_determine_number_of_sub_file_entries(
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_file_entry_free(
+	          &file_entry,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fshfs_test_file_entry_free_file_system(
+	          &io_handle,
+	          &file_io_handle,
+	          &file_system,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sub_file_entry != NULL )
+	{
+		libfshfs_file_entry_free(
+		 &sub_file_entry,
+		 NULL );
+	}
+	if( file_entry != NULL )
+	{
+		libfshfs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	fshfs_test_file_entry_free_file_system(
+	 &io_handle,
+	 &file_io_handle,
+	 &file_system,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libfshfs_file_entry_get_sub_file_entries_utf8_names_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_file_entry_get_sub_file_entries_utf8_names_size(
+     void )
+{
+	libbfio_handle_t *file_io_handle    = NULL;
+	libcerror_error_t *error            = NULL;
+	libfshfs_file_entry_t *file_entry   = NULL;
+	libfshfs_file_system_t *file_system = NULL;
+	libfshfs_io_handle_t *io_handle     = NULL;
+	size_t utf8_names_size              = 0;
+	int number_of_sub_file_entries      = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = fshfs_test_file_entry_initialize_file_system(
+	          &io_handle,
+	          &file_io_handle,
+	          &file_system,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fshfs_test_file_entry_initialize_root_directory(
+	          &file_entry,
+	          io_handle,
+	          file_io_handle,
+	          file_system,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_entry",
+	 file_entry );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfshfs_file_entry_get_sub_file_entries_utf8_names_size(
+	          file_entry,
+	          &number_of_sub_file_entries,
+	          &utf8_names_size,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sub_file_entries",
+	 number_of_sub_file_entries,
+	 3 );
+
+	/* The names "a", "b" and "cc" including their end of string characters
+	 */
+	FSHFS_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_names_size",
+	 utf8_names_size,
+	 (size_t) 7 );
+
+	/* Test error cases
+	 */
+	result = libfshfs_file_entry_get_sub_file_entries_utf8_names_size(
+	          NULL,
+	          &number_of_sub_file_entries,
+	          &utf8_names_size,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_file_entry_get_sub_file_entries_utf8_names_size(
+	          file_entry,
+	          NULL,
+	          &utf8_names_size,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_file_entry_get_sub_file_entries_utf8_names_size(
+	          file_entry,
+	          &number_of_sub_file_entries,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_file_entry_free(
+	          &file_entry,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fshfs_test_file_entry_free_file_system(
+	          &io_handle,
+	          &file_io_handle,
+	          &file_system,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_entry != NULL )
+	{
+		libfshfs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	fshfs_test_file_entry_free_file_system(
+	 &io_handle,
+	 &file_io_handle,
+	 &file_system,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libfshfs_file_entry_get_sub_file_entries_stat function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_file_entry_get_sub_file_entries_stat(
+     void )
+{
+	libfshfs_file_entry_stat_t stat_values[ 3 ];
+	uint8_t utf8_names[ 7 ];
+
+	libbfio_handle_t *file_io_handle    = NULL;
+	libcerror_error_t *error            = NULL;
+	libfshfs_file_entry_t *file_entry   = NULL;
+	libfshfs_file_system_t *file_system = NULL;
+	libfshfs_io_handle_t *io_handle     = NULL;
+	int number_of_stat_values_filled    = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = fshfs_test_file_entry_initialize_file_system(
+	          &io_handle,
+	          &file_io_handle,
+	          &file_system,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fshfs_test_file_entry_initialize_root_directory(
+	          &file_entry,
+	          io_handle,
+	          file_io_handle,
+	          file_system,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_entry",
+	 file_entry );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfshfs_file_entry_get_sub_file_entries_stat(
+	          file_entry,
+	          stat_values,
+	          3,
+	          utf8_names,
+	          7,
+	          &number_of_stat_values_filled,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_stat_values_filled",
+	 number_of_stat_values_filled,
+	 3 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "stat_values[ 0 ].identifier",
+	 stat_values[ 0 ].identifier,
+	 16 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT16(
+	 "stat_values[ 0 ].file_mode",
+	 stat_values[ 0 ].file_mode,
+	 0x81a4 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT64(
+	 "stat_values[ 0 ].data_fork_size",
+	 stat_values[ 0 ].data_fork_size,
+	 (uint64_t) 5 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "stat_values[ 0 ].name_offset",
+	 stat_values[ 0 ].name_offset,
+	 0 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "stat_values[ 0 ].name_size",
+	 stat_values[ 0 ].name_size,
+	 2 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "stat_values[ 1 ].identifier",
+	 stat_values[ 1 ].identifier,
+	 17 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT16(
+	 "stat_values[ 1 ].file_mode",
+	 stat_values[ 1 ].file_mode,
+	 0x41ed );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "stat_values[ 1 ].name_offset",
+	 stat_values[ 1 ].name_offset,
+	 2 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "stat_values[ 2 ].identifier",
+	 stat_values[ 2 ].identifier,
+	 18 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT64(
+	 "stat_values[ 2 ].resource_fork_size",
+	 stat_values[ 2 ].resource_fork_size,
+	 (uint64_t) 10 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "stat_values[ 2 ].name_offset",
+	 stat_values[ 2 ].name_offset,
+	 4 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "stat_values[ 2 ].name_size",
+	 stat_values[ 2 ].name_size,
+	 3 );
+
+	result = memory_compare(
+	          utf8_names,
+	          "a\0b\0cc",
+	          7 );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfshfs_file_entry_get_sub_file_entries_stat(
+	          NULL,
+	          stat_values,
+	          3,
+	          utf8_names,
+	          7,
+	          &number_of_stat_values_filled,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_file_entry_get_sub_file_entries_stat(
+	          file_entry,
+	          NULL,
+	          3,
+	          utf8_names,
+	          7,
+	          &number_of_stat_values_filled,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_file_entry_get_sub_file_entries_stat(
+	          file_entry,
+	          stat_values,
+	          -1,
+	          utf8_names,
+	          7,
+	          &number_of_stat_values_filled,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_file_entry_get_sub_file_entries_stat(
+	          file_entry,
+	          stat_values,
+	          3,
+	          NULL,
+	          7,
+	          &number_of_stat_values_filled,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_file_entry_get_sub_file_entries_stat(
+	          file_entry,
+	          stat_values,
+	          3,
+	          utf8_names,
+	          (size_t) SSIZE_MAX + 1,
+	          &number_of_stat_values_filled,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_file_entry_get_sub_file_entries_stat(
+	          file_entry,
+	          stat_values,
+	          3,
+	          utf8_names,
+	          7,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a stat values array that is too small
+	 */
+	number_of_stat_values_filled = 0;
+
+	result = libfshfs_file_entry_get_sub_file_entries_stat(
+	          file_entry,
+	          stat_values,
+	          2,
+	          utf8_names,
+	          7,
+	          &number_of_stat_values_filled,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_stat_values_filled",
+	 number_of_stat_values_filled,
+	 0 );
+
+	/* Test a names buffer that is too small
+	 */
+	result = libfshfs_file_entry_get_sub_file_entries_stat(
+	          file_entry,
+	          stat_values,
+	          3,
+	          utf8_names,
+	          6,
+	          &number_of_stat_values_filled,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_stat_values_filled",
+	 number_of_stat_values_filled,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libfshfs_file_entry_free(
+	          &file_entry,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fshfs_test_file_entry_free_file_system(
+	          &io_handle,
+	          &file_io_handle,
+	          &file_system,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_entry != NULL )
+	{
+		libfshfs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	fshfs_test_file_entry_free_file_system(
+	 &io_handle,
+	 &file_io_handle,
+	 &file_system,
+	 NULL );
+
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
 
 /* Tests the libfshfs_file_entry_free function
@@ -148,9 +5191,13 @@ int main(
 
 	/* TODO: add tests for libfshfs_internal_file_entry_get_sub_directory_entries */
 
+	FSHFS_TEST_RUN(
+	 "libfshfs_internal_file_entry_get_sub_directory_entry_from_page",
+	 fshfs_test_internal_file_entry_get_sub_directory_entry_from_page );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
 
-	/* TODO: add tests for libfshfs_file_entry_get_number_of_sub_file_entries */
+	/* TODO: add tests for libfshfs_file_entry_set_sub_file_entries_page_size */
 
 	/* TODO: add tests for libfshfs_file_entry_get_sub_file_entry_by_index */
 
@@ -158,16 +5205,84 @@ int main(
 
 	/* TODO: add tests for libfshfs_file_entry_get_sub_file_entry_by_utf16_name */
 
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_catalog_btree_file_get_stat_from_key",
+	 fshfs_test_catalog_btree_file_get_stat_from_key );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_catalog_btree_file_iterate_sub_records",
+	 fshfs_test_catalog_btree_file_iterate_sub_records );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_file_system_iterate_catalog_records",
+	 fshfs_test_file_system_iterate_catalog_records );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_catalog_btree_file_get_number_of_sub_records",
+	 fshfs_test_catalog_btree_file_get_number_of_sub_records );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_file_entry_get_number_of_sub_file_entries",
+	 fshfs_test_file_entry_get_number_of_sub_file_entries );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_file_entry_get_sub_file_entries_utf8_names_size",
+	 fshfs_test_file_entry_get_sub_file_entries_utf8_names_size );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_file_entry_get_sub_file_entries_stat",
+	 fshfs_test_file_entry_get_sub_file_entries_stat );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+
 	/* TODO: add tests for libfshfs_file_entry_read_buffer */
 
 	/* TODO: add tests for libfshfs_file_entry_read_buffer_at_offset */
 
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_internal_file_entry_read_ranges",
+	 fshfs_test_internal_file_entry_read_ranges );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_file_entry_read_buffers_at_offsets",
+	 fshfs_test_file_entry_read_buffers_at_offsets );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+
 	/* TODO: add tests for libfshfs_file_entry_seek_offset */
 
 	/* TODO: add tests for libfshfs_file_entry_get_offset */
 
 	/* TODO: add tests for libfshfs_file_entry_get_size */
 
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_internal_file_entry_determine_read_runs",
+	 fshfs_test_internal_file_entry_determine_read_runs );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_internal_file_entry_get_number_of_read_runs",
+	 fshfs_test_internal_file_entry_get_number_of_read_runs );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_internal_file_entry_get_read_run_by_index",
+	 fshfs_test_internal_file_entry_get_read_run_by_index );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_file_entry_get_number_of_read_runs",
+	 fshfs_test_file_entry_get_number_of_read_runs );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_file_entry_get_read_run_by_index",
+	 fshfs_test_file_entry_get_read_run_by_index );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -0,0 +1,921 @@
+/*
+ * Library lookup_target type test program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fshfs_test_libcerror.h"
+#include "fshfs_test_libfshfs.h"
+#include "fshfs_test_libuna.h"
+#include "fshfs_test_macros.h"
+#include "fshfs_test_memory.h"
+#include "fshfs_test_unused.h"
+
+#include "../libfshfs/libfshfs_lookup_target.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+/* Tests the libfshfs_lookup_target_set_thread_record_key function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_lookup_target_set_thread_record_key(
+     void )
+{
+	libfshfs_lookup_target_t lookup_target;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &lookup_target,
+	 0,
+	 sizeof( libfshfs_lookup_target_t ) );
+
+	/* Test regular cases
+	 */
+	result = libfshfs_lookup_target_set_thread_record_key(
+	          &lookup_target,
+	          16,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "lookup_target.parent_identifier",
+	 lookup_target.parent_identifier,
+	 (uint32_t) 16 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "lookup_target.folded_name",
+	 lookup_target.folded_name );
+
+	FSHFS_TEST_ASSERT_EQUAL_SIZE(
+	 "lookup_target.folded_name_length",
+	 lookup_target.folded_name_length,
+	 (size_t) 0 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT8(
+	 "lookup_target.is_pending",
+	 lookup_target.is_pending,
+	 (uint8_t) 1 );
+
+	/* Test error cases
+	 */
+	result = libfshfs_lookup_target_set_thread_record_key(
+	          NULL,
+	          16,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_lookup_target_set_name_key function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_lookup_target_set_name_key(
+     void )
+{
+	uint8_t name[ 6 ] = {
+		0x00, 'R', 0x00, 'e', 0x00, 'A' };
+
+	libfshfs_lookup_target_t lookup_target;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &lookup_target,
+	 0,
+	 sizeof( libfshfs_lookup_target_t ) );
+
+	/* Test regular cases
+	 */
+	result = libfshfs_lookup_target_set_name_key(
+	          &lookup_target,
+	          24,
+	          name,
+	          6,
+	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
+	          1,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "lookup_target.parent_identifier",
+	 lookup_target.parent_identifier,
+	 (uint32_t) 24 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "lookup_target.folded_name",
+	 lookup_target.folded_name );
+
+	FSHFS_TEST_ASSERT_EQUAL_SIZE(
+	 "lookup_target.folded_name_length",
+	 lookup_target.folded_name_length,
+	 (size_t) 3 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "lookup_target.folded_name[ 0 ]",
+	 lookup_target.folded_name[ 0 ],
+	 (uint32_t) 'r' );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "lookup_target.folded_name[ 2 ]",
+	 lookup_target.folded_name[ 2 ],
+	 (uint32_t) 'a' );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT8(
+	 "lookup_target.is_pending",
+	 lookup_target.is_pending,
+	 (uint8_t) 1 );
+
+	result = libfshfs_lookup_target_clear(
+	          &lookup_target,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "lookup_target.folded_name",
+	 lookup_target.folded_name );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT8(
+	 "lookup_target.is_pending",
+	 lookup_target.is_pending,
+	 (uint8_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libfshfs_lookup_target_set_name_key(
+	          NULL,
+	          24,
+	          name,
+	          6,
+	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
+	          1,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_lookup_target_set_name_key(
+	          &lookup_target,
+	          24,
+	          name,
+	          0,
+	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
+	          1,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libfshfs_lookup_target_clear(
+	 &lookup_target,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libfshfs_lookup_target_set_utf8_name_key function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_lookup_target_set_utf8_name_key(
+     void )
+{
+	uint8_t utf8_string[ 5 ] = {
+		'A', ':', 'b', 0xc3, 0xa9 };
+
+	libfshfs_lookup_target_t lookup_target;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &lookup_target,
+	 0,
+	 sizeof( libfshfs_lookup_target_t ) );
+
+	/* Test regular cases
+	 */
+	result = libfshfs_lookup_target_set_utf8_name_key(
+	          &lookup_target,
+	          24,
+	          utf8_string,
+	          5,
+	          1,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "lookup_target.parent_identifier",
+	 lookup_target.parent_identifier,
+	 (uint32_t) 24 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "lookup_target.folded_name",
+	 lookup_target.folded_name );
+
+	/* The 'é' is stored decomposed and ':' is stored as '/'
+	 */
+	FSHFS_TEST_ASSERT_EQUAL_SIZE(
+	 "lookup_target.folded_name_length",
+	 lookup_target.folded_name_length,
+	 (size_t) 5 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "lookup_target.folded_name[ 0 ]",
+	 lookup_target.folded_name[ 0 ],
+	 (uint32_t) 'a' );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "lookup_target.folded_name[ 1 ]",
+	 lookup_target.folded_name[ 1 ],
+	 (uint32_t) '/' );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "lookup_target.folded_name[ 3 ]",
+	 lookup_target.folded_name[ 3 ],
+	 (uint32_t) 'e' );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "lookup_target.folded_name[ 4 ]",
+	 lookup_target.folded_name[ 4 ],
+	 (uint32_t) 0x0301 );
+
+	/* Test that setting the thread record key frees the folded name
+	 */
+	result = libfshfs_lookup_target_set_thread_record_key(
+	          &lookup_target,
+	          24,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "lookup_target.folded_name",
+	 lookup_target.folded_name );
+
+	/* Test error cases
+	 */
+	result = libfshfs_lookup_target_set_utf8_name_key(
+	          NULL,
+	          24,
+	          utf8_string,
+	          5,
+	          1,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_lookup_target_set_utf8_name_key(
+	          &lookup_target,
+	          24,
+	          utf8_string,
+	          0,
+	          1,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libfshfs_lookup_target_clear(
+	 &lookup_target,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libfshfs_lookup_target_get_utf8_path_segment function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_lookup_target_get_utf8_path_segment(
+     void )
+{
+	libfshfs_lookup_target_t lookup_target;
+
+	const uint8_t *utf8_string_segment = NULL;
+	libcerror_error_t *error           = NULL;
+	size_t utf8_string_segment_length  = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &lookup_target,
+	 0,
+	 sizeof( libfshfs_lookup_target_t ) );
+
+	lookup_target.utf8_path        = (uint8_t *) "/Users//test";
+	lookup_target.utf8_path_length = 12;
+	lookup_target.utf8_path_index  = 1;
+
+	/* Test regular cases
+	 */
+	result = libfshfs_lookup_target_get_utf8_path_segment(
+	          &lookup_target,
+	          &utf8_string_segment,
+	          &utf8_string_segment_length,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_segment_length",
+	 utf8_string_segment_length,
+	 (size_t) 5 );
+
+	result = memory_compare(
+	          utf8_string_segment,
+	          "Users",
+	          5 );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that an empty segment is returned
+	 */
+	result = libfshfs_lookup_target_get_utf8_path_segment(
+	          &lookup_target,
+	          &utf8_string_segment,
+	          &utf8_string_segment_length,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_segment_length",
+	 utf8_string_segment_length,
+	 (size_t) 0 );
+
+	result = libfshfs_lookup_target_get_utf8_path_segment(
+	          &lookup_target,
+	          &utf8_string_segment,
+	          &utf8_string_segment_length,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_segment_length",
+	 utf8_string_segment_length,
+	 (size_t) 4 );
+
+	result = memory_compare(
+	          utf8_string_segment,
+	          "test",
+	          4 );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that there are no more segments
+	 */
+	result = libfshfs_lookup_target_get_utf8_path_segment(
+	          &lookup_target,
+	          &utf8_string_segment,
+	          &utf8_string_segment_length,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_lookup_target_get_utf8_path_segment(
+	          NULL,
+	          &utf8_string_segment,
+	          &utf8_string_segment_length,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_lookup_target_get_utf8_path_segment(
+	          &lookup_target,
+	          NULL,
+	          &utf8_string_segment_length,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	lookup_target.utf8_path = NULL;
+
+	result = libfshfs_lookup_target_get_utf8_path_segment(
+	          &lookup_target,
+	          &utf8_string_segment,
+	          &utf8_string_segment_length,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_lookup_target_compare_by_key function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_lookup_target_compare_by_key(
+     void )
+{
+	libfshfs_lookup_target_t first_lookup_target;
+	libfshfs_lookup_target_t second_lookup_target;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &first_lookup_target,
+	 0,
+	 sizeof( libfshfs_lookup_target_t ) );
+
+	memory_set(
+	 &second_lookup_target,
+	 0,
+	 sizeof( libfshfs_lookup_target_t ) );
+
+	first_lookup_target.index  = 1;
+	second_lookup_target.index = 0;
+
+	/* Test that the parent identifier takes precedence over the name
+	 */
+	result = libfshfs_lookup_target_set_utf8_name_key(
+	          &first_lookup_target,
+	          16,
+	          (uint8_t *) "zzz",
+	          3,
+	          1,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_lookup_target_set_utf8_name_key(
+	          &second_lookup_target,
+	          24,
+	          (uint8_t *) "aaa",
+	          3,
+	          1,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_lookup_target_compare_by_key(
+	          &first_lookup_target,
+	          &second_lookup_target );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	result = libfshfs_lookup_target_compare_by_key(
+	          &second_lookup_target,
+	          &first_lookup_target );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test that the thread record key sorts before the other keys of the parent
+	 */
+	result = libfshfs_lookup_target_set_thread_record_key(
+	          &second_lookup_target,
+	          16,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_lookup_target_compare_by_key(
+	          &first_lookup_target,
+	          &second_lookup_target );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test that the names are compared case folded instead of bytewise
+	 */
+	result = libfshfs_lookup_target_set_utf8_name_key(
+	          &second_lookup_target,
+	          16,
+	          (uint8_t *) "Users",
+	          5,
+	          1,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_lookup_target_set_utf8_name_key(
+	          &first_lookup_target,
+	          16,
+	          (uint8_t *) "tmp",
+	          3,
+	          1,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_lookup_target_compare_by_key(
+	          &first_lookup_target,
+	          &second_lookup_target );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	/* Test that equal keys are ordered by the index of the request
+	 */
+	result = libfshfs_lookup_target_set_utf8_name_key(
+	          &first_lookup_target,
+	          16,
+	          (uint8_t *) "USERS",
+	          5,
+	          1,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_lookup_target_compare_by_key(
+	          &first_lookup_target,
+	          &second_lookup_target );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfshfs_lookup_target_compare_by_key(
+	          &first_lookup_target,
+	          &first_lookup_target );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that pending targets sort before the other targets
+	 */
+	second_lookup_target.is_pending = 0;
+
+	result = libfshfs_lookup_target_compare_by_key(
+	          &first_lookup_target,
+	          &second_lookup_target );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	/* Clean up
+	 */
+	result = libfshfs_lookup_target_clear(
+	          &second_lookup_target,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_lookup_target_clear(
+	          &first_lookup_target,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libfshfs_lookup_target_clear(
+	 &second_lookup_target,
+	 NULL );
+
+	libfshfs_lookup_target_clear(
+	 &first_lookup_target,
+	 NULL );
+
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSHFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSHFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSHFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSHFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSHFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSHFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_lookup_target_set_thread_record_key",
+	 fshfs_test_lookup_target_set_thread_record_key );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_lookup_target_set_name_key",
+	 fshfs_test_lookup_target_set_name_key );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_lookup_target_set_utf8_name_key",
+	 fshfs_test_lookup_target_set_utf8_name_key );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_lookup_target_get_utf8_path_segment",
+	 fshfs_test_lookup_target_get_utf8_path_segment );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_lookup_target_compare_by_key",
+	 fshfs_test_lookup_target_compare_by_key );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+}
+
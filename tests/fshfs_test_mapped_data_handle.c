@@ -0,0 +1,869 @@
+/*
+ * Library mapped_data_handle type test program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fshfs_test_libcerror.h"
+#include "fshfs_test_libfdata.h"
+#include "fshfs_test_libfshfs.h"
+#include "fshfs_test_macros.h"
+#include "fshfs_test_memory.h"
+#include "fshfs_test_unused.h"
+
+#include "../libfshfs/libfshfs_definitions.h"
+#include "../libfshfs/libfshfs_mapped_data_handle.h"
+#include "../libfshfs/libfshfs_statistics.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+/* Tests the libfshfs_mapped_data_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_mapped_data_handle_initialize(
+     void )
+{
+	uint8_t data[ 1024 ];
+
+	libcerror_error_t *error                          = NULL;
+	libfshfs_mapped_data_handle_t *mapped_data_handle = NULL;
+	int result                                        = 0;
+
+#if defined( HAVE_FSHFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests                   = 1;
+	int number_of_memset_fail_tests                   = 1;
+	int test_number                                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfshfs_mapped_data_handle_initialize(
+	          &mapped_data_handle,
+	          data,
+	          1024,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "mapped_data_handle",
+	 mapped_data_handle );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_mapped_data_handle_free(
+	          &mapped_data_handle,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "mapped_data_handle",
+	 mapped_data_handle );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_mapped_data_handle_initialize(
+	          NULL,
+	          data,
+	          1024,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	mapped_data_handle = (libfshfs_mapped_data_handle_t *) 0x12345678UL;
+
+	result = libfshfs_mapped_data_handle_initialize(
+	          &mapped_data_handle,
+	          data,
+	          1024,
+	          &error );
+
+	mapped_data_handle = NULL;
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_mapped_data_handle_initialize(
+	          &mapped_data_handle,
+	          NULL,
+	          1024,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_mapped_data_handle_initialize(
+	          &mapped_data_handle,
+	          data,
+	          (size64_t) INT64_MAX + 1,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSHFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfshfs_mapped_data_handle_initialize with malloc failing
+		 */
+		fshfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfshfs_mapped_data_handle_initialize(
+		          &mapped_data_handle,
+		          data,
+		          1024,
+		          &error );
+
+		if( fshfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fshfs_test_malloc_attempts_before_fail = -1;
+
+			if( mapped_data_handle != NULL )
+			{
+				libfshfs_mapped_data_handle_free(
+				 &mapped_data_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSHFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSHFS_TEST_ASSERT_IS_NULL(
+			 "mapped_data_handle",
+			 mapped_data_handle );
+
+			FSHFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfshfs_mapped_data_handle_initialize with memset failing
+		 */
+		fshfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfshfs_mapped_data_handle_initialize(
+		          &mapped_data_handle,
+		          data,
+		          1024,
+		          &error );
+
+		if( fshfs_test_memset_attempts_before_fail != -1 )
+		{
+			fshfs_test_memset_attempts_before_fail = -1;
+
+			if( mapped_data_handle != NULL )
+			{
+				libfshfs_mapped_data_handle_free(
+				 &mapped_data_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSHFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSHFS_TEST_ASSERT_IS_NULL(
+			 "mapped_data_handle",
+			 mapped_data_handle );
+
+			FSHFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSHFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( mapped_data_handle != NULL )
+	{
+		libfshfs_mapped_data_handle_free(
+		 &mapped_data_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_mapped_data_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_mapped_data_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfshfs_mapped_data_handle_free(
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_mapped_data_handle_read_segment_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_mapped_data_handle_read_segment_data(
+     void )
+{
+	uint8_t data[ 1024 ];
+	uint8_t segment_data[ 512 ];
+
+	libfshfs_volume_statistics_t volume_statistics;
+
+	libcerror_error_t *error                          = NULL;
+	libfshfs_mapped_data_handle_t *mapped_data_handle = NULL;
+	libfshfs_statistics_t *statistics                 = NULL;
+	ssize_t read_count                                = 0;
+	off64_t offset                                    = 0;
+	size_t data_offset                                = 0;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 1024;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) ( data_offset % 251 );
+	}
+	result = libfshfs_mapped_data_handle_initialize(
+	          &mapped_data_handle,
+	          data,
+	          1024,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "mapped_data_handle",
+	 mapped_data_handle );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_statistics_initialize(
+	          &statistics,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "statistics",
+	 statistics );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	mapped_data_handle->statistics = statistics;
+
+	/* Test regular cases
+	 */
+	offset = libfshfs_mapped_data_handle_seek_segment_offset(
+	          mapped_data_handle,
+	          NULL,
+	          0,
+	          0,
+	          256,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 256 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libfshfs_mapped_data_handle_read_segment_data(
+	              mapped_data_handle,
+	              NULL,
+	              0,
+	              0,
+	              segment_data,
+	              512,
+	              0,
+	              0,
+	              &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          segment_data,
+	          &( data[ 256 ] ),
+	          512 );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test reading beyond the end of the mapped data
+	 */
+	read_count = libfshfs_mapped_data_handle_read_segment_data(
+	              mapped_data_handle,
+	              NULL,
+	              0,
+	              0,
+	              segment_data,
+	              512,
+	              0,
+	              0,
+	              &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 256 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          segment_data,
+	          &( data[ 768 ] ),
+	          256 );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	read_count = libfshfs_mapped_data_handle_read_segment_data(
+	              mapped_data_handle,
+	              NULL,
+	              0,
+	              0,
+	              segment_data,
+	              512,
+	              0,
+	              0,
+	              &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test reading sparse data
+	 */
+	offset = libfshfs_mapped_data_handle_seek_segment_offset(
+	          mapped_data_handle,
+	          NULL,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 0 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libfshfs_mapped_data_handle_read_segment_data(
+	              mapped_data_handle,
+	              NULL,
+	              0,
+	              0,
+	              segment_data,
+	              512,
+	              LIBFDATA_RANGE_FLAG_IS_SPARSE,
+	              0,
+	              &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT8(
+	 "segment_data[ 511 ]",
+	 segment_data[ 511 ],
+	 0 );
+
+	/* Test the reads of mapped data were added to the statistics
+	 * and that sparse data was not
+	 */
+	result = libfshfs_statistics_get_values(
+	          statistics,
+	          &volume_statistics,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT64(
+	 "volume_statistics.number_of_reads[ LIBFSHFS_STATISTICS_REGION_DATA ]",
+	 volume_statistics.number_of_reads[ LIBFSHFS_STATISTICS_REGION_DATA ],
+	 (uint64_t) 2 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT64(
+	 "volume_statistics.read_sizes[ LIBFSHFS_STATISTICS_REGION_DATA ]",
+	 volume_statistics.read_sizes[ LIBFSHFS_STATISTICS_REGION_DATA ],
+	 (uint64_t) 768 );
+
+	/* Test error cases
+	 */
+	read_count = libfshfs_mapped_data_handle_read_segment_data(
+	              NULL,
+	              NULL,
+	              0,
+	              0,
+	              segment_data,
+	              512,
+	              0,
+	              0,
+	              &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfshfs_mapped_data_handle_read_segment_data(
+	              mapped_data_handle,
+	              NULL,
+	              0,
+	              0,
+	              NULL,
+	              512,
+	              0,
+	              0,
+	              &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfshfs_mapped_data_handle_read_segment_data(
+	              mapped_data_handle,
+	              NULL,
+	              0,
+	              0,
+	              segment_data,
+	              (size_t) SSIZE_MAX + 1,
+	              0,
+	              0,
+	              &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_mapped_data_handle_free(
+	          &mapped_data_handle,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "mapped_data_handle",
+	 mapped_data_handle );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_statistics_free(
+	          &statistics,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "statistics",
+	 statistics );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( mapped_data_handle != NULL )
+	{
+		libfshfs_mapped_data_handle_free(
+		 &mapped_data_handle,
+		 NULL );
+	}
+	if( statistics != NULL )
+	{
+		libfshfs_statistics_free(
+		 &statistics,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_mapped_data_handle_seek_segment_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_mapped_data_handle_seek_segment_offset(
+     void )
+{
+	uint8_t data[ 1024 ];
+
+	libcerror_error_t *error                          = NULL;
+	libfshfs_mapped_data_handle_t *mapped_data_handle = NULL;
+	off64_t offset                                    = 0;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfshfs_mapped_data_handle_initialize(
+	          &mapped_data_handle,
+	          data,
+	          1024,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "mapped_data_handle",
+	 mapped_data_handle );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	offset = libfshfs_mapped_data_handle_seek_segment_offset(
+	          mapped_data_handle,
+	          NULL,
+	          0,
+	          0,
+	          512,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 512 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	offset = libfshfs_mapped_data_handle_seek_segment_offset(
+	          NULL,
+	          NULL,
+	          0,
+	          0,
+	          512,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset = libfshfs_mapped_data_handle_seek_segment_offset(
+	          mapped_data_handle,
+	          NULL,
+	          0,
+	          0,
+	          -1,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_mapped_data_handle_free(
+	          &mapped_data_handle,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "mapped_data_handle",
+	 mapped_data_handle );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( mapped_data_handle != NULL )
+	{
+		libfshfs_mapped_data_handle_free(
+		 &mapped_data_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSHFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSHFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSHFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSHFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSHFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSHFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_mapped_data_handle_initialize",
+	 fshfs_test_mapped_data_handle_initialize );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_mapped_data_handle_free",
+	 fshfs_test_mapped_data_handle_free );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_mapped_data_handle_read_segment_data",
+	 fshfs_test_mapped_data_handle_read_segment_data );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_mapped_data_handle_seek_segment_offset",
+	 fshfs_test_mapped_data_handle_seek_segment_offset );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+}
+
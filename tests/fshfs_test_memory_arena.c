@@ -0,0 +1,606 @@
+/*
+ * Library memory_arena type test program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fshfs_test_libcerror.h"
+#include "fshfs_test_libfshfs.h"
+#include "fshfs_test_macros.h"
+#include "fshfs_test_memory.h"
+#include "fshfs_test_unused.h"
+
+#include "../libfshfs/libfshfs_definitions.h"
+#include "../libfshfs/libfshfs_memory_arena.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+/* Tests the libfshfs_memory_arena_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_memory_arena_initialize(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libfshfs_memory_arena_t *memory_arena = NULL;
+	int result                            = 0;
+
+#if defined( HAVE_FSHFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests       = 1;
+	int number_of_memset_fail_tests       = 1;
+	int test_number                       = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfshfs_memory_arena_initialize(
+	          &memory_arena,
+	          1024,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_arena",
+	 memory_arena );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_memory_arena_free(
+	          &memory_arena,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "memory_arena",
+	 memory_arena );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_memory_arena_initialize(
+	          NULL,
+	          1024,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	memory_arena = (libfshfs_memory_arena_t *) 0x12345678UL;
+
+	result = libfshfs_memory_arena_initialize(
+	          &memory_arena,
+	          1024,
+	          &error );
+
+	memory_arena = NULL;
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_memory_arena_initialize(
+	          &memory_arena,
+	          0,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "memory_arena",
+	 memory_arena );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSHFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfshfs_memory_arena_initialize with malloc failing
+		 */
+		fshfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfshfs_memory_arena_initialize(
+		          &memory_arena,
+		          1024,
+		          &error );
+
+		if( fshfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fshfs_test_malloc_attempts_before_fail = -1;
+
+			if( memory_arena != NULL )
+			{
+				libfshfs_memory_arena_free(
+				 &memory_arena,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSHFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSHFS_TEST_ASSERT_IS_NULL(
+			 "memory_arena",
+			 memory_arena );
+
+			FSHFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfshfs_memory_arena_initialize with memset failing
+		 */
+		fshfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfshfs_memory_arena_initialize(
+		          &memory_arena,
+		          1024,
+		          &error );
+
+		if( fshfs_test_memset_attempts_before_fail != -1 )
+		{
+			fshfs_test_memset_attempts_before_fail = -1;
+
+			if( memory_arena != NULL )
+			{
+				libfshfs_memory_arena_free(
+				 &memory_arena,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSHFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSHFS_TEST_ASSERT_IS_NULL(
+			 "memory_arena",
+			 memory_arena );
+
+			FSHFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSHFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_arena != NULL )
+	{
+		libfshfs_memory_arena_free(
+		 &memory_arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_memory_arena_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_memory_arena_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfshfs_memory_arena_free(
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_memory_arena_allocate function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_memory_arena_allocate(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libfshfs_memory_arena_t *memory_arena = NULL;
+	intptr_t *first_memory                = NULL;
+	intptr_t *memory                      = NULL;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfshfs_memory_arena_initialize(
+	          &memory_arena,
+	          64,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_arena",
+	 memory_arena );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfshfs_memory_arena_allocate(
+	          memory_arena,
+	          5,
+	          &first_memory,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "first_memory",
+	 first_memory );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "memory_arena->number_of_chunks",
+	 memory_arena->number_of_chunks,
+	 1 );
+
+	result = libfshfs_memory_arena_allocate(
+	          memory_arena,
+	          8,
+	          &memory,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "memory_arena->number_of_chunks",
+	 memory_arena->number_of_chunks,
+	 1 );
+
+	/* The allocations are aligned
+	 */
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "memory - first_memory",
+	 (int) ( (uint8_t *) memory - (uint8_t *) first_memory ),
+	 LIBFSHFS_MEMORY_ARENA_ALIGNMENT );
+
+	/* Test an allocation that does not fit in the remainder of the chunk
+	 */
+	result = libfshfs_memory_arena_allocate(
+	          memory_arena,
+	          40,
+	          &memory,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "memory_arena->number_of_chunks",
+	 memory_arena->number_of_chunks,
+	 2 );
+
+	/* Test an allocation that is larger than the chunk size
+	 */
+	result = libfshfs_memory_arena_allocate(
+	          memory_arena,
+	          256,
+	          &memory,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memory",
+	 memory );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "memory_arena->number_of_chunks",
+	 memory_arena->number_of_chunks,
+	 3 );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "memory[ 31 ]",
+	 (int) ( (uint64_t *) memory )[ 31 ],
+	 0 );
+
+	/* Test error cases
+	 */
+	memory = NULL;
+
+	result = libfshfs_memory_arena_allocate(
+	          NULL,
+	          8,
+	          &memory,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_memory_arena_allocate(
+	          memory_arena,
+	          0,
+	          &memory,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_memory_arena_allocate(
+	          memory_arena,
+	          8,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSHFS_TEST_MEMORY )
+
+	/* Test libfshfs_memory_arena_allocate with malloc failing
+	 */
+	fshfs_test_malloc_attempts_before_fail = 0;
+
+	result = libfshfs_memory_arena_allocate(
+	          memory_arena,
+	          256,
+	          &memory,
+	          &error );
+
+	if( fshfs_test_malloc_attempts_before_fail != -1 )
+	{
+		fshfs_test_malloc_attempts_before_fail = -1;
+	}
+	else
+	{
+		FSHFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FSHFS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_FSHFS_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libfshfs_memory_arena_free(
+	          &memory_arena,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "memory_arena",
+	 memory_arena );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_arena != NULL )
+	{
+		libfshfs_memory_arena_free(
+		 &memory_arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSHFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSHFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSHFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSHFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSHFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSHFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_memory_arena_initialize",
+	 fshfs_test_memory_arena_initialize );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_memory_arena_free",
+	 fshfs_test_memory_arena_free );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_memory_arena_allocate",
+	 fshfs_test_memory_arena_allocate );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+}
+
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -117,25 +118,853 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfshfs_name_get_utf16_stream_ascii_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_name_get_utf16_stream_ascii_size(
+     void )
+{
+        uint8_t name_utf16_stream_ascii[ 20 ]     = { 0, 'L', 0, 'o', 0, 'n', 0, 'g', 0, ' ', 0, 'n', 0, 'a', 0, 'm', 0, 'e', 0, 's' };
+        uint8_t name_utf16_stream_non_ascii[ 20 ] = { 0, 'L', 0, 'o', 0, 'n', 0, 'g', 0, ' ', 0, 'n', 0xe4, 0, 0, 'm', 0, 'e', 0, 's' };
+        uint8_t name_utf16_stream_latin1[ 20 ]    = { 0, 'L', 0, 'o', 0, 'n', 0, 'g', 0, ' ', 0, 'n', 0, 0xe4, 0, 'm', 0, 'e', 0, 's' };
+        uint8_t name_utf16_stream_nul[ 20 ]       = { 0, 'L', 0, 'o', 0, 'n', 0, 0, 0, ' ', 0, 'n', 0, 'a', 0, 'm', 0, 'e', 0, 's' };
+	libcerror_error_t *error                  = NULL;
+	size_t ascii_size                         = 0;
+	int result                                = 0;
+
+	/* Test regular cases
+	 */
+	result = libfshfs_name_get_utf16_stream_ascii_size(
+	          name_utf16_stream_ascii,
+	          20,
+	          0,
+	          &ascii_size,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_EQUAL_SIZE(
+	 "ascii_size",
+	 ascii_size,
+	 (size_t) 20 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_name_get_utf16_stream_ascii_size(
+	          name_utf16_stream_ascii,
+	          20,
+	          6,
+	          &ascii_size,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_EQUAL_SIZE(
+	 "ascii_size",
+	 ascii_size,
+	 (size_t) 14 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_name_get_utf16_stream_ascii_size(
+	          name_utf16_stream_non_ascii,
+	          20,
+	          0,
+	          &ascii_size,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_EQUAL_SIZE(
+	 "ascii_size",
+	 ascii_size,
+	 (size_t) 12 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_name_get_utf16_stream_ascii_size(
+	          name_utf16_stream_latin1,
+	          20,
+	          0,
+	          &ascii_size,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_EQUAL_SIZE(
+	 "ascii_size",
+	 ascii_size,
+	 (size_t) 12 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_name_get_utf16_stream_ascii_size(
+	          name_utf16_stream_nul,
+	          20,
+	          0,
+	          &ascii_size,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_EQUAL_SIZE(
+	 "ascii_size",
+	 ascii_size,
+	 (size_t) 6 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_name_get_utf16_stream_ascii_size(
+	          name_utf16_stream_ascii,
+	          20,
+	          20,
+	          &ascii_size,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_EQUAL_SIZE(
+	 "ascii_size",
+	 ascii_size,
+	 (size_t) 0 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_name_get_utf16_stream_ascii_size(
+	          NULL,
+	          20,
+	          0,
+	          &ascii_size,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_name_get_utf16_stream_ascii_size(
+	          name_utf16_stream_ascii,
+	          20,
+	          22,
+	          &ascii_size,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_name_get_utf16_stream_ascii_size(
+	          name_utf16_stream_ascii,
+	          20,
+	          0,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_name_compare function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_name_compare(
+     void )
+{
+        uint8_t name_utf16_stream_lower[ 28 ]     = { 0, 'l', 0, 'o', 0, 'n', 0, 'g', 0, ' ', 0, 'f', 0, 'i', 0, 'l', 0, 'e', 0, ' ', 0, 'n', 0, 'a', 0, 'm', 0, 'e' };
+        uint8_t name_utf16_stream_mixed[ 28 ]     = { 0, 'L', 0, 'o', 0, 'n', 0, 'g', 0, ' ', 0, 'F', 0, 'I', 0, 'L', 0, 'E', 0, ' ', 0, 'n', 0, 'a', 0, 'm', 0, 'e' };
+        uint8_t name_utf16_stream_non_ascii[ 28 ] = { 0, 'l', 0, 'o', 0, 'n', 0, 'g', 0, ' ', 0, 'f', 0, 'i', 0, 'l', 0, 'e', 0, ' ', 0, 'n', 0, 0xe4, 0, 'm', 0, 'e' };
+        uint8_t name_utf16_stream_longer[ 32 ]    = { 0, 'l', 0, 'o', 0, 'n', 0, 'g', 0, ' ', 0, 'f', 0, 'i', 0, 'l', 0, 'e', 0, ' ', 0, 'n', 0, 'a', 0, 'm', 0, 'e', 0, 's' };
+        uint8_t name_utf16_stream_at_sign[ 8 ]    = { 0, 'a', 0, 'b', 0, 'c', 0, '@' };
+        uint8_t name_utf16_stream_grave[ 8 ]      = { 0, 'a', 0, 'b', 0, 'c', 0, '`' };
+        uint8_t name_utf16_stream_bracket[ 8 ]    = { 0, 'a', 0, 'b', 0, 'c', 0, '[' };
+        uint8_t name_utf16_stream_brace[ 8 ]      = { 0, 'a', 0, 'b', 0, 'c', 0, '{' };
+	libcerror_error_t *error                  = NULL;
+	int result                                = 0;
+
+	/* Test regular cases
+	 */
+	result = libfshfs_name_compare(
+	          name_utf16_stream_lower,
+	          28,
+	          name_utf16_stream_lower,
+	          28,
+	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
+	          0,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBUNA_COMPARE_EQUAL );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test case folding of characters that differ after the first 4 characters
+	 */
+	result = libfshfs_name_compare(
+	          name_utf16_stream_lower,
+	          28,
+	          name_utf16_stream_mixed,
+	          28,
+	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
+	          1,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBUNA_COMPARE_EQUAL );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_name_compare(
+	          name_utf16_stream_lower,
+	          28,
+	          name_utf16_stream_mixed,
+	          28,
+	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
+	          0,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBUNA_COMPARE_GREATER );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a name with a non-ASCII character after the first 8 characters
+	 */
+	result = libfshfs_name_compare(
+	          name_utf16_stream_non_ascii,
+	          28,
+	          name_utf16_stream_mixed,
+	          28,
+	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
+	          1,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBUNA_COMPARE_GREATER );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_name_compare(
+	          name_utf16_stream_mixed,
+	          28,
+	          name_utf16_stream_non_ascii,
+	          28,
+	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
+	          1,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBUNA_COMPARE_LESS );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_name_compare(
+	          name_utf16_stream_mixed,
+	          28,
+	          name_utf16_stream_longer,
+	          32,
+	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
+	          1,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBUNA_COMPARE_LESS );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that case folding only affects A to Z and not the characters next to them
+	 */
+	result = libfshfs_name_compare(
+	          name_utf16_stream_at_sign,
+	          8,
+	          name_utf16_stream_grave,
+	          8,
+	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
+	          1,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBUNA_COMPARE_LESS );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_name_compare(
+	          name_utf16_stream_bracket,
+	          8,
+	          name_utf16_stream_brace,
+	          8,
+	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
+	          1,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBUNA_COMPARE_LESS );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_name_compare(
+	          NULL,
+	          28,
+	          name_utf16_stream_lower,
+	          28,
+	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
+	          0,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_name_compare(
+	          name_utf16_stream_lower,
+	          28,
+	          NULL,
+	          28,
+	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
+	          0,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libfshfs_name_get_utf8_string_size function
  * Returns 1 if successful or 0 if not
  */
-int fshfs_test_name_get_utf8_string_size(
+int fshfs_test_name_get_utf8_string_size(
+     void )
+{
+        uint8_t name_utf16_stream_long[ 20 ] = { 0, 'd', 0, 'i', 0, 'r', 0, '/', 0, 'n', 0, 'a', 0, 'm', 0, 'e', 0, ' ', 0, 0xe9 };
+        uint8_t name_byte_stream[ 4 ]        = { 'T', 'e', 's', 't' };
+        uint8_t name_utf16_stream[ 8 ]       = { 0, 'T', 0, 'e', 0, 's', 0, 't' };
+	libcerror_error_t *error             = NULL;
+	size_t utf8_string_size              = 0;
+	int result                           = 0;
+
+	/* Test regular cases
+	 */
+	result = libfshfs_name_get_utf8_string_size(
+	          name_byte_stream,
+	          4,
+	          LIBUNA_CODEPAGE_MAC_ROMAN,
+	          &utf8_string_size,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBUNA_COMPARE_EQUAL );
+
+	FSHFS_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 5 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_name_get_utf8_string_size(
+	          name_utf16_stream,
+	          8,
+	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
+	          &utf8_string_size,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBUNA_COMPARE_EQUAL );
+
+	FSHFS_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 5 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a name that starts with more than 4 ASCII characters
+	 */
+	result = libfshfs_name_get_utf8_string_size(
+	          name_utf16_stream_long,
+	          20,
+	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
+	          &utf8_string_size,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 12 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_name_get_utf8_string_size(
+	          NULL,
+	          8,
+	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
+	          &utf8_string_size,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_name_get_utf8_string_size(
+	          name_utf16_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
+	          &utf8_string_size,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_name_get_utf8_string_size(
+	          name_utf16_stream,
+	          8,
+	          -1,
+	          &utf8_string_size,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_name_get_utf8_string_size(
+	          name_utf16_stream,
+	          8,
+	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_name_get_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_name_get_utf8_string(
+     void )
+{
+	uint8_t utf8_string[ 32 ];
+
+        uint8_t expected_utf8_string[ 12 ]   = { 'd', 'i', 'r', ':', 'n', 'a', 'm', 'e', ' ', 0xc3, 0xa9, 0 };
+        uint8_t name_utf16_stream_long[ 20 ] = { 0, 'd', 0, 'i', 0, 'r', 0, '/', 0, 'n', 0, 'a', 0, 'm', 0, 'e', 0, ' ', 0, 0xe9 };
+        uint8_t name_byte_stream[ 4 ]        = { 'T', 'e', 's', 't' };
+        uint8_t name_utf16_stream[ 8 ]       = { 0, 'T', 0, 'e', 0, 's', 0, 't' };
+	libcerror_error_t *error             = NULL;
+	int result                           = 0;
+
+	/* Test regular cases
+	 */
+	result = libfshfs_name_get_utf8_string(
+	          name_byte_stream,
+	          4,
+	          LIBUNA_CODEPAGE_MAC_ROMAN,
+	          utf8_string,
+	          32,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBUNA_COMPARE_EQUAL );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_name_get_utf8_string(
+	          name_utf16_stream,
+	          8,
+	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
+	          utf8_string,
+	          32,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBUNA_COMPARE_EQUAL );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a name that starts with more than 4 ASCII characters
+	 */
+	result = libfshfs_name_get_utf8_string(
+	          name_utf16_stream_long,
+	          20,
+	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
+	          utf8_string,
+	          32,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          expected_utf8_string,
+	          12 );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a name that does not fit in the UTF-8 string
+	 */
+	result = libfshfs_name_get_utf8_string(
+	          name_utf16_stream_long,
+	          20,
+	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
+	          utf8_string,
+	          6,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_name_get_utf8_string(
+	          NULL,
+	          8,
+	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
+	          utf8_string,
+	          32,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_name_get_utf8_string(
+	          name_utf16_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
+	          utf8_string,
+	          32,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_name_get_utf8_string(
+	          name_utf16_stream,
+	          8,
+	          -1,
+	          utf8_string,
+	          32,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_name_get_utf8_string(
+	          name_utf16_stream,
+	          8,
+	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
+	          NULL,
+	          32,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_name_get_utf8_string(
+	          name_utf16_stream,
+	          8,
+	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
+	          utf8_string,
+	          0,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_name_compare_with_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_name_compare_with_utf8_string(
      void )
 {
-        uint8_t name_byte_stream[ 4 ]  = { 'T', 'e', 's', 't' };
-        uint8_t name_utf16_stream[ 8 ] = { 0, 'T', 0, 'e', 0, 's', 0, 't' };
-	libcerror_error_t *error       = NULL;
-	size_t utf8_string_size        = 0;
-	int result                     = 0;
+        uint8_t utf8_string_equal[ 6 ]         = { 'e', 'q', 'u', 'a', 'l', 0 };
+        uint8_t utf8_string_greater[ 7 ]       = { 'g', 'r', 'e', 'a', 't', 'e', 'r' };
+        uint8_t utf8_string_less[ 4 ]          = { 'l', 'e', 's', 's' };
+        uint8_t utf8_string_more[ 4 ]          = { 'm', 'o', 'r', 'e' };
+        uint8_t name_utf16_stream_equal[ 10 ]  = { 0, 'e', 0, 'q', 0, 'u', 0, 'a', 0, 'l' };
+        uint8_t name_utf16_stream_great[ 10 ]  = { 0, 'g', 0, 'r', 0, 'e', 0, 'a', 0, 't' };
+        uint8_t name_utf16_stream_less[ 8 ]    = { 0, 'l', 0, 'e', 0, 's', 0, 's' };
+        uint8_t name_utf16_stream_lesser[ 12 ] = { 0, 'l', 0, 'e', 0, 's', 0, 's', 0, 'e', 0, 'r' };
+        uint8_t name_utf16_stream_more[ 8 ]    = { 0, 'm', 0, 'o', 0, 'r', 0, 'e' };
+	libcerror_error_t *error               = NULL;
+	int result                             = 0;
 
 	/* Test regular cases
 	 */
-	result = libfshfs_name_get_utf8_string_size(
-	          name_byte_stream,
-	          4,
-	          LIBUNA_CODEPAGE_MAC_ROMAN,
-	          &utf8_string_size,
+	result = libfshfs_name_compare_with_utf8_string(
+	          name_utf16_stream_equal,
+	          10,
+	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
+	          utf8_string_equal,
+	          5,
+	          0,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
@@ -143,31 +972,95 @@ int fshfs_test_name_get_utf8_string_size(
 	 result,
 	 LIBUNA_COMPARE_EQUAL );
 
-	FSHFS_TEST_ASSERT_EQUAL_SIZE(
-	 "utf8_string_size",
-	 utf8_string_size,
-	 (size_t) 5 );
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_name_compare_with_utf8_string(
+	          name_utf16_stream_equal,
+	          10,
+	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
+	          utf8_string_equal,
+	          6,
+	          0,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBUNA_COMPARE_EQUAL );
 
 	FSHFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfshfs_name_get_utf8_string_size(
-	          name_utf16_stream,
+	result = libfshfs_name_compare_with_utf8_string(
+	          name_utf16_stream_great,
+	          10,
+	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
+	          utf8_string_greater,
+	          7,
+	          0,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBUNA_COMPARE_LESS );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_name_compare_with_utf8_string(
+	          name_utf16_stream_less,
 	          8,
 	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
-	          &utf8_string_size,
+	          utf8_string_more,
+	          4,
+	          0,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBUNA_COMPARE_LESS );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_name_compare_with_utf8_string(
+	          name_utf16_stream_more,
+	          8,
+	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
+	          utf8_string_less,
+	          4,
+	          0,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBUNA_COMPARE_GREATER );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_name_compare_with_utf8_string(
+	          name_utf16_stream_lesser,
+	          12,
+	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
+	          utf8_string_less,
+	          4,
+	          0,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 LIBUNA_COMPARE_EQUAL );
-
-	FSHFS_TEST_ASSERT_EQUAL_SIZE(
-	 "utf8_string_size",
-	 utf8_string_size,
-	 (size_t) 5 );
+	 LIBUNA_COMPARE_GREATER );
 
 	FSHFS_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -175,11 +1068,13 @@ int fshfs_test_name_get_utf8_string_size(
 
 	/* Test error cases
 	 */
-	result = libfshfs_name_get_utf8_string_size(
+	result = libfshfs_name_compare_with_utf8_string(
 	          NULL,
-	          8,
+	          6,
 	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
-	          &utf8_string_size,
+	          utf8_string_equal,
+	          5,
+	          0,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
@@ -194,11 +1089,13 @@ int fshfs_test_name_get_utf8_string_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libfshfs_name_get_utf8_string_size(
-	          name_utf16_stream,
+	result = libfshfs_name_compare_with_utf8_string(
+	          name_utf16_stream_equal,
 	          (size_t) SSIZE_MAX + 1,
 	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
-	          &utf8_string_size,
+	          utf8_string_equal,
+	          5,
+	          0,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
@@ -213,11 +1110,13 @@ int fshfs_test_name_get_utf8_string_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libfshfs_name_get_utf8_string_size(
-	          name_utf16_stream,
-	          8,
-	          -1,
-	          &utf8_string_size,
+	result = libfshfs_name_compare_with_utf8_string(
+	          name_utf16_stream_equal,
+	          10,
+	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
+	          NULL,
+	          5,
+	          0,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
@@ -232,11 +1131,13 @@ int fshfs_test_name_get_utf8_string_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libfshfs_name_get_utf8_string_size(
-	          name_utf16_stream,
-	          8,
+	result = libfshfs_name_compare_with_utf8_string(
+	          name_utf16_stream_equal,
+	          10,
 	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
-	          NULL,
+	          utf8_string_equal,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
@@ -262,44 +1163,54 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfshfs_name_get_utf8_string function
+/* Tests the libfshfs_name_get_folded_name and libfshfs_name_compare_folded_name_with_utf8_string functions
  * Returns 1 if successful or 0 if not
  */
-int fshfs_test_name_get_utf8_string(
+int fshfs_test_name_compare_folded_name_with_utf8_string(
      void )
 {
-	uint8_t utf8_string[ 32 ];
+	libuna_unicode_character_t folded_name[ 8 ];
 
-        uint8_t name_byte_stream[ 4 ]  = { 'T', 'e', 's', 't' };
-        uint8_t name_utf16_stream[ 8 ] = { 0, 'T', 0, 'e', 0, 's', 0, 't' };
-	libcerror_error_t *error       = NULL;
-	int result                     = 0;
+	uint8_t utf8_string_equal[ 6 ]         = { 'e', 'q', 'u', 'a', 'l', 0 };
+	uint8_t utf8_string_less[ 4 ]          = { 'l', 'e', 's', 's' };
+	uint8_t name_utf16_stream_equal[ 10 ]  = { 0, 'E', 0, 'q', 0, 'U', 0, 'a', 0, 'l' };
+	uint8_t name_utf16_stream_lesser[ 12 ] = { 0, 'l', 0, 'e', 0, 's', 0, 's', 0, 'e', 0, 'r' };
+	libcerror_error_t *error               = NULL;
+	size_t folded_name_length              = 0;
+	int result                             = 0;
 
 	/* Test regular cases
 	 */
-	result = libfshfs_name_get_utf8_string(
-	          name_byte_stream,
-	          4,
-	          LIBUNA_CODEPAGE_MAC_ROMAN,
-	          utf8_string,
-	          32,
+	result = libfshfs_name_get_folded_name(
+	          name_utf16_stream_equal,
+	          10,
+	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
+	          1,
+	          folded_name,
+	          8,
+	          &folded_name_length,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 LIBUNA_COMPARE_EQUAL );
+	 1 );
 
 	FSHFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfshfs_name_get_utf8_string(
-	          name_utf16_stream,
-	          8,
-	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
-	          utf8_string,
-	          32,
+	FSHFS_TEST_ASSERT_EQUAL_SIZE(
+	 "folded_name_length",
+	 folded_name_length,
+	 (size_t) 5 );
+
+	result = libfshfs_name_compare_folded_name_with_utf8_string(
+	          folded_name,
+	          folded_name_length,
+	          utf8_string_equal,
+	          6,
+	          1,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
@@ -311,54 +1222,52 @@ int fshfs_test_name_get_utf8_string(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libfshfs_name_get_utf8_string(
-	          NULL,
-	          8,
+	result = libfshfs_name_get_folded_name(
+	          name_utf16_stream_lesser,
+	          12,
 	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
-	          utf8_string,
-	          32,
+	          0,
+	          folded_name,
+	          8,
+	          &folded_name_length,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	FSHFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libfshfs_name_get_utf8_string(
-	          name_utf16_stream,
-	          (size_t) SSIZE_MAX + 1,
-	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
-	          utf8_string,
-	          32,
+	result = libfshfs_name_compare_folded_name_with_utf8_string(
+	          folded_name,
+	          folded_name_length,
+	          utf8_string_less,
+	          4,
+	          0,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 LIBUNA_COMPARE_GREATER );
 
-	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	FSHFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libfshfs_name_get_utf8_string(
-	          name_utf16_stream,
-	          8,
-	          -1,
-	          utf8_string,
-	          32,
+	/* Test error cases
+	 */
+	result = libfshfs_name_get_folded_name(
+	          name_utf16_stream_lesser,
+	          12,
+	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
+	          0,
+	          folded_name,
+	          4,
+	          &folded_name_length,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
@@ -373,12 +1282,12 @@ int fshfs_test_name_get_utf8_string(
 	libcerror_error_free(
 	 &error );
 
-	result = libfshfs_name_get_utf8_string(
-	          name_utf16_stream,
-	          8,
-	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
+	result = libfshfs_name_compare_folded_name_with_utf8_string(
 	          NULL,
-	          32,
+	          5,
+	          utf8_string_equal,
+	          6,
+	          0,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
@@ -393,11 +1302,11 @@ int fshfs_test_name_get_utf8_string(
 	libcerror_error_free(
 	 &error );
 
-	result = libfshfs_name_get_utf8_string(
-	          name_utf16_stream,
-	          8,
-	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
-	          utf8_string,
+	result = libfshfs_name_compare_folded_name_with_utf8_string(
+	          folded_name,
+	          5,
+	          NULL,
+	          6,
 	          0,
 	          &error );
 
@@ -424,123 +1333,124 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfshfs_name_compare_with_utf8_string function
+/* Tests the libfshfs_name_get_folded_name_from_utf8_string and libfshfs_name_compare_folded_names functions
  * Returns 1 if successful or 0 if not
  */
-int fshfs_test_name_compare_with_utf8_string(
+int fshfs_test_name_compare_folded_names(
      void )
 {
-        uint8_t utf8_string_equal[ 6 ]         = { 'e', 'q', 'u', 'a', 'l', 0 };
-        uint8_t utf8_string_greater[ 7 ]       = { 'g', 'r', 'e', 'a', 't', 'e', 'r' };
-        uint8_t utf8_string_less[ 4 ]          = { 'l', 'e', 's', 's' };
-        uint8_t utf8_string_more[ 4 ]          = { 'm', 'o', 'r', 'e' };
-        uint8_t name_utf16_stream_equal[ 10 ]  = { 0, 'e', 0, 'q', 0, 'u', 0, 'a', 0, 'l' };
-        uint8_t name_utf16_stream_great[ 10 ]  = { 0, 'g', 0, 'r', 0, 'e', 0, 'a', 0, 't' };
-        uint8_t name_utf16_stream_less[ 8 ]    = { 0, 'l', 0, 'e', 0, 's', 0, 's' };
-        uint8_t name_utf16_stream_lesser[ 12 ] = { 0, 'l', 0, 'e', 0, 's', 0, 's', 0, 'e', 0, 'r' };
-        uint8_t name_utf16_stream_more[ 8 ]    = { 0, 'm', 0, 'o', 0, 'r', 0, 'e' };
-	libcerror_error_t *error               = NULL;
-	int result                             = 0;
+	libuna_unicode_character_t folded_name[ 8 ];
+	libuna_unicode_character_t utf8_folded_name[ 24 ];
+
+	uint8_t utf8_string_equal[ 6 ]        = { 'E', 'Q', 'U', 'A', 'L', 0 };
+	uint8_t utf8_string_less[ 4 ]         = { 'l', 'e', 's', 's' };
+	uint8_t name_utf16_stream_equal[ 10 ] = { 0, 'E', 0, 'q', 0, 'U', 0, 'a', 0, 'l' };
+	libcerror_error_t *error              = NULL;
+	size_t folded_name_length             = 0;
+	size_t utf8_folded_name_length        = 0;
+	int result                            = 0;
 
 	/* Test regular cases
 	 */
-	result = libfshfs_name_compare_with_utf8_string(
+	result = libfshfs_name_get_folded_name(
 	          name_utf16_stream_equal,
 	          10,
 	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
-	          utf8_string_equal,
-	          5,
-	          0,
+	          1,
+	          folded_name,
+	          8,
+	          &folded_name_length,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 LIBUNA_COMPARE_EQUAL );
+	 1 );
 
 	FSHFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfshfs_name_compare_with_utf8_string(
-	          name_utf16_stream_equal,
-	          10,
-	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
+	result = libfshfs_name_get_folded_name_from_utf8_string(
 	          utf8_string_equal,
 	          6,
-	          0,
+	          1,
+	          utf8_folded_name,
+	          24,
+	          &utf8_folded_name_length,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 LIBUNA_COMPARE_EQUAL );
+	 1 );
 
 	FSHFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfshfs_name_compare_with_utf8_string(
-	          name_utf16_stream_great,
-	          10,
-	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
-	          utf8_string_greater,
-	          7,
-	          0,
+	FSHFS_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_folded_name_length",
+	 utf8_folded_name_length,
+	 (size_t) 5 );
+
+	result = libfshfs_name_compare_folded_names(
+	          folded_name,
+	          folded_name_length,
+	          utf8_folded_name,
+	          utf8_folded_name_length,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 LIBUNA_COMPARE_LESS );
+	 LIBUNA_COMPARE_EQUAL );
 
 	FSHFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfshfs_name_compare_with_utf8_string(
-	          name_utf16_stream_less,
-	          8,
-	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
-	          utf8_string_more,
+	result = libfshfs_name_get_folded_name_from_utf8_string(
+	          utf8_string_less,
 	          4,
-	          0,
+	          1,
+	          utf8_folded_name,
+	          24,
+	          &utf8_folded_name_length,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 LIBUNA_COMPARE_LESS );
+	 1 );
 
 	FSHFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfshfs_name_compare_with_utf8_string(
-	          name_utf16_stream_more,
-	          8,
-	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
-	          utf8_string_less,
-	          4,
-	          0,
+	result = libfshfs_name_compare_folded_names(
+	          folded_name,
+	          folded_name_length,
+	          utf8_folded_name,
+	          utf8_folded_name_length,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 LIBUNA_COMPARE_GREATER );
+	 LIBUNA_COMPARE_LESS );
 
 	FSHFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfshfs_name_compare_with_utf8_string(
-	          name_utf16_stream_lesser,
-	          12,
-	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
-	          utf8_string_less,
-	          4,
-	          0,
+	/* Test that a prefix sorts before the longer name
+	 */
+	result = libfshfs_name_compare_folded_names(
+	          utf8_folded_name,
+	          utf8_folded_name_length,
+	          utf8_folded_name,
+	          utf8_folded_name_length - 1,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
@@ -552,36 +1462,33 @@ int fshfs_test_name_compare_with_utf8_string(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Test that an empty name sorts before any other name
 	 */
-	result = libfshfs_name_compare_with_utf8_string(
+	result = libfshfs_name_compare_folded_names(
 	          NULL,
-	          6,
-	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
-	          utf8_string_equal,
-	          5,
 	          0,
+	          utf8_folded_name,
+	          utf8_folded_name_length,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 LIBUNA_COMPARE_LESS );
 
-	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	FSHFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libfshfs_name_compare_with_utf8_string(
-	          name_utf16_stream_equal,
-	          (size_t) SSIZE_MAX + 1,
-	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
-	          utf8_string_equal,
-	          5,
-	          0,
+	/* Test error cases
+	 */
+	result = libfshfs_name_get_folded_name_from_utf8_string(
+	          NULL,
+	          6,
+	          1,
+	          utf8_folded_name,
+	          24,
+	          &utf8_folded_name_length,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
@@ -596,13 +1503,13 @@ int fshfs_test_name_compare_with_utf8_string(
 	libcerror_error_free(
 	 &error );
 
-	result = libfshfs_name_compare_with_utf8_string(
-	          name_utf16_stream_equal,
-	          10,
-	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
-	          NULL,
-	          5,
-	          0,
+	result = libfshfs_name_get_folded_name_from_utf8_string(
+	          utf8_string_equal,
+	          6,
+	          1,
+	          utf8_folded_name,
+	          4,
+	          &utf8_folded_name_length,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
@@ -617,13 +1524,11 @@ int fshfs_test_name_compare_with_utf8_string(
 	libcerror_error_free(
 	 &error );
 
-	result = libfshfs_name_compare_with_utf8_string(
-	          name_utf16_stream_equal,
-	          10,
-	          LIBUNA_CODEPAGE_UTF16_BIG_ENDIAN,
-	          utf8_string_equal,
-	          (size_t) SSIZE_MAX + 1,
-	          0,
+	result = libfshfs_name_compare_folded_names(
+	          NULL,
+	          5,
+	          utf8_folded_name,
+	          utf8_folded_name_length,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
@@ -1587,6 +2492,14 @@ int main(
 	 "libfshfs_name_decomposition_mappings",
 	 fshfs_test_name_decomposition_mappings );
 
+	FSHFS_TEST_RUN(
+	 "libfshfs_name_get_utf16_stream_ascii_size",
+	 fshfs_test_name_get_utf16_stream_ascii_size );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_name_compare",
+	 fshfs_test_name_compare );
+
 	FSHFS_TEST_RUN(
 	 "libfshfs_name_get_utf8_string_size",
 	 fshfs_test_name_get_utf8_string_size );
@@ -1599,6 +2512,14 @@ int main(
 	 "libfshfs_name_compare_with_utf8_string",
 	 fshfs_test_name_compare_with_utf8_string );
 
+	FSHFS_TEST_RUN(
+	 "libfshfs_name_compare_folded_name_with_utf8_string",
+	 fshfs_test_name_compare_folded_name_with_utf8_string );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_name_compare_folded_names",
+	 fshfs_test_name_compare_folded_names );
+
 	FSHFS_TEST_RUN(
 	 "libfshfs_name_get_utf16_string_size",
 	 fshfs_test_name_get_utf16_string_size );
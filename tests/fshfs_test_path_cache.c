@@ -0,0 +1,613 @@
+/*
+ * Library path_cache type test program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fshfs_test_libcerror.h"
+#include "fshfs_test_libfshfs.h"
+#include "fshfs_test_macros.h"
+#include "fshfs_test_memory.h"
+#include "fshfs_test_unused.h"
+
+#include "../libfshfs/libfshfs_definitions.h"
+#include "../libfshfs/libfshfs_path_cache.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+/* Tests the libfshfs_path_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_path_cache_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libfshfs_path_cache_t *path_cache = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_FSHFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 2;
+	int number_of_memset_fail_tests   = 2;
+	int test_number                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfshfs_path_cache_initialize(
+	          &path_cache,
+	          16,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "path_cache",
+	 path_cache );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_path_cache_free(
+	          &path_cache,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "path_cache",
+	 path_cache );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_path_cache_initialize(
+	          NULL,
+	          16,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	path_cache = (libfshfs_path_cache_t *) 0x12345678UL;
+
+	result = libfshfs_path_cache_initialize(
+	          &path_cache,
+	          16,
+	          &error );
+
+	path_cache = NULL;
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_path_cache_initialize(
+	          &path_cache,
+	          0,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "path_cache",
+	 path_cache );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSHFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfshfs_path_cache_initialize with malloc failing
+		 */
+		fshfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfshfs_path_cache_initialize(
+		          &path_cache,
+		          16,
+		          &error );
+
+		if( fshfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fshfs_test_malloc_attempts_before_fail = -1;
+
+			if( path_cache != NULL )
+			{
+				libfshfs_path_cache_free(
+				 &path_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSHFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSHFS_TEST_ASSERT_IS_NULL(
+			 "path_cache",
+			 path_cache );
+
+			FSHFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfshfs_path_cache_initialize with memset failing
+		 */
+		fshfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfshfs_path_cache_initialize(
+		          &path_cache,
+		          16,
+		          &error );
+
+		if( fshfs_test_memset_attempts_before_fail != -1 )
+		{
+			fshfs_test_memset_attempts_before_fail = -1;
+
+			if( path_cache != NULL )
+			{
+				libfshfs_path_cache_free(
+				 &path_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSHFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSHFS_TEST_ASSERT_IS_NULL(
+			 "path_cache",
+			 path_cache );
+
+			FSHFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSHFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path_cache != NULL )
+	{
+		libfshfs_path_cache_free(
+		 &path_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_path_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_path_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfshfs_path_cache_free(
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_path_cache_get_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_path_cache_get_identifier(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libfshfs_path_cache_t *path_cache = NULL;
+	uint32_t identifier               = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfshfs_path_cache_initialize(
+	          &path_cache,
+	          16,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "path_cache",
+	 path_cache );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_path_cache_set_identifier(
+	          path_cache,
+	          2,
+	          0x12345678UL,
+	          LIBFSHFS_PATH_CACHE_NAME_TYPE_UTF8,
+	          (uint8_t *) "Users",
+	          5,
+	          21,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_path_cache_set_identifier(
+	          path_cache,
+	          16,
+	          0x12345678UL,
+	          LIBFSHFS_PATH_CACHE_NAME_TYPE_UTF8,
+	          (uint8_t *) "Users",
+	          5,
+	          0,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfshfs_path_cache_get_identifier(
+	          path_cache,
+	          2,
+	          0x12345678UL,
+	          LIBFSHFS_PATH_CACHE_NAME_TYPE_UTF8,
+	          (uint8_t *) "Users",
+	          5,
+	          &identifier,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "identifier",
+	 identifier,
+	 21 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a name that was cached as not found
+	 */
+	identifier = 21;
+
+	result = libfshfs_path_cache_get_identifier(
+	          path_cache,
+	          16,
+	          0x12345678UL,
+	          LIBFSHFS_PATH_CACHE_NAME_TYPE_UTF8,
+	          (uint8_t *) "Users",
+	          5,
+	          &identifier,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "identifier",
+	 identifier,
+	 0 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a name that is not cached
+	 */
+	result = libfshfs_path_cache_get_identifier(
+	          path_cache,
+	          2,
+	          0x12345678UL,
+	          LIBFSHFS_PATH_CACHE_NAME_TYPE_UTF8,
+	          (uint8_t *) "users",
+	          5,
+	          &identifier,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_path_cache_get_identifier(
+	          path_cache,
+	          2,
+	          0x12345678UL,
+	          LIBFSHFS_PATH_CACHE_NAME_TYPE_UTF16,
+	          (uint8_t *) "Users",
+	          5,
+	          &identifier,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_path_cache_get_identifier(
+	          NULL,
+	          2,
+	          0x12345678UL,
+	          LIBFSHFS_PATH_CACHE_NAME_TYPE_UTF8,
+	          (uint8_t *) "Users",
+	          5,
+	          &identifier,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_path_cache_get_identifier(
+	          path_cache,
+	          2,
+	          0x12345678UL,
+	          LIBFSHFS_PATH_CACHE_NAME_TYPE_UTF8,
+	          NULL,
+	          5,
+	          &identifier,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_path_cache_get_identifier(
+	          path_cache,
+	          2,
+	          0x12345678UL,
+	          LIBFSHFS_PATH_CACHE_NAME_TYPE_UTF8,
+	          (uint8_t *) "Users",
+	          5,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_path_cache_free(
+	          &path_cache,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "path_cache",
+	 path_cache );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path_cache != NULL )
+	{
+		libfshfs_path_cache_free(
+		 &path_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSHFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSHFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSHFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSHFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSHFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSHFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_path_cache_initialize",
+	 fshfs_test_path_cache_initialize );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_path_cache_free",
+	 fshfs_test_path_cache_free );
+
+	/* TODO: add tests for libfshfs_path_cache_entry_clear */
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_path_cache_get_identifier",
+	 fshfs_test_path_cache_get_identifier );
+
+	/* TODO: add tests for libfshfs_path_cache_set_identifier */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,1522 @@
+/*
+ * Library read_queue type test program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fshfs_test_libcerror.h"
+#include "fshfs_test_libfshfs.h"
+#include "fshfs_test_macros.h"
+#include "fshfs_test_memory.h"
+#include "fshfs_test_unused.h"
+
+#include "../libfshfs/libfshfs_definitions.h"
+#include "../libfshfs/libfshfs_file_entry.h"
+#include "../libfshfs/libfshfs_read_queue.h"
+
+/* Completion function used by the tests
+ * Returns 1 if successful or -1 on error
+ */
+int fshfs_test_read_queue_completion_function(
+     uint8_t *buffer FSHFS_TEST_ATTRIBUTE_UNUSED,
+     ssize_t read_count FSHFS_TEST_ATTRIBUTE_UNUSED,
+     void *completion_data FSHFS_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error FSHFS_TEST_ATTRIBUTE_UNUSED )
+{
+	FSHFS_TEST_UNREFERENCED_PARAMETER( buffer )
+	FSHFS_TEST_UNREFERENCED_PARAMETER( read_count )
+	FSHFS_TEST_UNREFERENCED_PARAMETER( completion_data )
+	FSHFS_TEST_UNREFERENCED_PARAMETER( error )
+
+	return( 1 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+/* Completion function that counts the failed reads used by the tests
+ * Returns 1 if successful or -1 on error
+ */
+int fshfs_test_read_queue_count_failed_reads_function(
+     uint8_t *buffer FSHFS_TEST_ATTRIBUTE_UNUSED,
+     ssize_t read_count,
+     void *completion_data,
+     libcerror_error_t **error FSHFS_TEST_ATTRIBUTE_UNUSED )
+{
+	FSHFS_TEST_UNREFERENCED_PARAMETER( buffer )
+	FSHFS_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( read_count == -1 )
+	{
+		*( (int *) completion_data ) += 1;
+	}
+	return( 1 );
+}
+
+typedef struct fshfs_test_read_queue_resubmit fshfs_test_read_queue_resubmit_t;
+
+struct fshfs_test_read_queue_resubmit
+{
+	/* The read queue
+	 */
+	libfshfs_read_queue_t *read_queue;
+
+	/* The file entry
+	 */
+	libfshfs_file_entry_t *file_entry;
+
+	/* The buffer
+	 */
+	uint8_t *buffer;
+
+	/* The number of reads
+	 */
+	int number_of_reads;
+};
+
+/* Completion function that submits a next read used by the tests
+ * Returns 1 if successful or -1 on error
+ */
+int fshfs_test_read_queue_resubmit_function(
+     uint8_t *buffer FSHFS_TEST_ATTRIBUTE_UNUSED,
+     ssize_t read_count FSHFS_TEST_ATTRIBUTE_UNUSED,
+     void *completion_data,
+     libcerror_error_t **error )
+{
+	fshfs_test_read_queue_resubmit_t *resubmit = NULL;
+
+	FSHFS_TEST_UNREFERENCED_PARAMETER( buffer )
+	FSHFS_TEST_UNREFERENCED_PARAMETER( read_count )
+
+	resubmit = (fshfs_test_read_queue_resubmit_t *) completion_data;
+
+	resubmit->number_of_reads += 1;
+
+	if( resubmit->number_of_reads < 3 )
+	{
+		return( libfshfs_read_queue_submit_file_entry_read(
+		         resubmit->read_queue,
+		         resubmit->file_entry,
+		         resubmit->buffer,
+		         16,
+		         0,
+		         &fshfs_test_read_queue_resubmit_function,
+		         completion_data,
+		         error ) );
+	}
+	return( 1 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+
+/* Tests the libfshfs_read_queue_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_read_queue_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libfshfs_read_queue_t *read_queue = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_FSHFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 1;
+	int number_of_memset_fail_tests   = 1;
+	int test_number                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfshfs_read_queue_initialize(
+	          &read_queue,
+	          0,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "read_queue",
+	 read_queue );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_read_queue_free(
+	          &read_queue,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "read_queue",
+	 read_queue );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_read_queue_initialize(
+	          &read_queue,
+	          2,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "read_queue",
+	 read_queue );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_read_queue_free(
+	          &read_queue,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "read_queue",
+	 read_queue );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_read_queue_initialize(
+	          NULL,
+	          0,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_queue = (libfshfs_read_queue_t *) 0x12345678UL;
+
+	result = libfshfs_read_queue_initialize(
+	          &read_queue,
+	          0,
+	          &error );
+
+	read_queue = NULL;
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_read_queue_initialize(
+	          &read_queue,
+	          -1,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_read_queue_initialize(
+	          &read_queue,
+	          65,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSHFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfshfs_read_queue_initialize with malloc failing
+		 */
+		fshfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfshfs_read_queue_initialize(
+		          &read_queue,
+		          0,
+		          &error );
+
+		if( fshfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fshfs_test_malloc_attempts_before_fail = -1;
+
+			if( read_queue != NULL )
+			{
+				libfshfs_read_queue_free(
+				 &read_queue,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSHFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSHFS_TEST_ASSERT_IS_NULL(
+			 "read_queue",
+			 read_queue );
+
+			FSHFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfshfs_read_queue_initialize with memset failing
+		 */
+		fshfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfshfs_read_queue_initialize(
+		          &read_queue,
+		          0,
+		          &error );
+
+		if( fshfs_test_memset_attempts_before_fail != -1 )
+		{
+			fshfs_test_memset_attempts_before_fail = -1;
+
+			if( read_queue != NULL )
+			{
+				libfshfs_read_queue_free(
+				 &read_queue,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSHFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSHFS_TEST_ASSERT_IS_NULL(
+			 "read_queue",
+			 read_queue );
+
+			FSHFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSHFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_queue != NULL )
+	{
+		libfshfs_read_queue_free(
+		 &read_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_read_queue_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_read_queue_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfshfs_read_queue_free(
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_read_queue_submit_file_entry_read function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_read_queue_submit_file_entry_read(
+     void )
+{
+	uint8_t buffer[ 16 ];
+
+	libcerror_error_t *error                = NULL;
+	libfshfs_read_queue_t *read_queue       = NULL;
+	int number_of_outstanding_requests      = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libfshfs_read_queue_initialize(
+	          &read_queue,
+	          0,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "read_queue",
+	 read_queue );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_read_queue_submit_file_entry_read(
+	          NULL,
+	          (libfshfs_file_entry_t *) 0x12345678UL,
+	          buffer,
+	          16,
+	          0,
+	          &fshfs_test_read_queue_completion_function,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_read_queue_submit_file_entry_read(
+	          read_queue,
+	          NULL,
+	          buffer,
+	          16,
+	          0,
+	          &fshfs_test_read_queue_completion_function,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_read_queue_submit_file_entry_read(
+	          read_queue,
+	          (libfshfs_file_entry_t *) 0x12345678UL,
+	          NULL,
+	          16,
+	          0,
+	          &fshfs_test_read_queue_completion_function,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_read_queue_submit_file_entry_read(
+	          read_queue,
+	          (libfshfs_file_entry_t *) 0x12345678UL,
+	          buffer,
+	          16,
+	          0,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_read_queue_get_number_of_outstanding_requests(
+	          read_queue,
+	          &number_of_outstanding_requests,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_outstanding_requests",
+	 number_of_outstanding_requests,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libfshfs_read_queue_free(
+	          &read_queue,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "read_queue",
+	 read_queue );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_queue != NULL )
+	{
+		libfshfs_read_queue_free(
+		 &read_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_read_queue_submit_extended_attribute_read function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_read_queue_submit_extended_attribute_read(
+     void )
+{
+	uint8_t buffer[ 16 ];
+
+	libcerror_error_t *error                = NULL;
+	libfshfs_read_queue_t *read_queue       = NULL;
+	int number_of_outstanding_requests      = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libfshfs_read_queue_initialize(
+	          &read_queue,
+	          0,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "read_queue",
+	 read_queue );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_read_queue_submit_extended_attribute_read(
+	          NULL,
+	          (libfshfs_extended_attribute_t *) 0x12345678UL,
+	          buffer,
+	          16,
+	          0,
+	          &fshfs_test_read_queue_completion_function,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_read_queue_submit_extended_attribute_read(
+	          read_queue,
+	          NULL,
+	          buffer,
+	          16,
+	          0,
+	          &fshfs_test_read_queue_completion_function,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_read_queue_submit_extended_attribute_read(
+	          read_queue,
+	          (libfshfs_extended_attribute_t *) 0x12345678UL,
+	          NULL,
+	          16,
+	          0,
+	          &fshfs_test_read_queue_completion_function,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_read_queue_submit_extended_attribute_read(
+	          read_queue,
+	          (libfshfs_extended_attribute_t *) 0x12345678UL,
+	          buffer,
+	          16,
+	          0,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_read_queue_get_number_of_outstanding_requests(
+	          read_queue,
+	          &number_of_outstanding_requests,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_outstanding_requests",
+	 number_of_outstanding_requests,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libfshfs_read_queue_free(
+	          &read_queue,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "read_queue",
+	 read_queue );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_queue != NULL )
+	{
+		libfshfs_read_queue_free(
+		 &read_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+/* Tests the libfshfs_internal_read_queue_complete_requests function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_internal_read_queue_complete_requests(
+     void )
+{
+	fshfs_test_read_queue_resubmit_t resubmit;
+	uint8_t buffer[ 16 ];
+
+	libcerror_error_t *error                            = NULL;
+	libfshfs_internal_file_entry_t *internal_file_entry = NULL;
+	libfshfs_read_queue_t *read_queue                   = NULL;
+	int number_of_completed_requests                    = 0;
+	int number_of_failed_reads                          = 0;
+	int number_of_outstanding_requests                  = 0;
+	int result                                          = 0;
+
+	/* Initialize test
+	 */
+	result = libfshfs_read_queue_initialize(
+	          &read_queue,
+	          0,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "read_queue",
+	 read_queue );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A file entry that is not a regular file, reading its data fails
+	 */
+	internal_file_entry = memory_allocate_structure(
+	                       libfshfs_internal_file_entry_t );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_file_entry",
+	 internal_file_entry );
+
+	memory_set(
+	 internal_file_entry,
+	 0,
+	 sizeof( libfshfs_internal_file_entry_t ) );
+
+	internal_file_entry->file_mode = LIBFSHFS_FILE_TYPE_DIRECTORY;
+
+	result = libfshfs_read_queue_submit_file_entry_read(
+	          read_queue,
+	          (libfshfs_file_entry_t *) internal_file_entry,
+	          buffer,
+	          16,
+	          0,
+	          &fshfs_test_read_queue_count_failed_reads_function,
+	          (void *) &number_of_failed_reads,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_read_queue_submit_file_entry_read(
+	          read_queue,
+	          (libfshfs_file_entry_t *) internal_file_entry,
+	          buffer,
+	          16,
+	          8,
+	          &fshfs_test_read_queue_count_failed_reads_function,
+	          (void *) &number_of_failed_reads,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that failed reads are reported and returned as an error
+	 */
+	result = libfshfs_internal_read_queue_complete_requests(
+	          (libfshfs_internal_read_queue_t *) read_queue,
+	          1,
+	          &number_of_completed_requests,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_completed_requests",
+	 number_of_completed_requests,
+	 2 );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_failed_reads",
+	 number_of_failed_reads,
+	 2 );
+
+	result = libfshfs_read_queue_get_number_of_outstanding_requests(
+	          read_queue,
+	          &number_of_outstanding_requests,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_outstanding_requests",
+	 number_of_outstanding_requests,
+	 0 );
+
+	/* Test that a next wait succeeds
+	 */
+	result = libfshfs_internal_read_queue_complete_requests(
+	          (libfshfs_internal_read_queue_t *) read_queue,
+	          1,
+	          &number_of_completed_requests,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_completed_requests",
+	 number_of_completed_requests,
+	 0 );
+
+	/* Test that reads submitted by a completion function are reported by the same wait
+	 */
+	resubmit.read_queue      = read_queue;
+	resubmit.file_entry      = (libfshfs_file_entry_t *) internal_file_entry;
+	resubmit.buffer          = buffer;
+	resubmit.number_of_reads = 0;
+
+	result = libfshfs_read_queue_submit_file_entry_read(
+	          read_queue,
+	          (libfshfs_file_entry_t *) internal_file_entry,
+	          buffer,
+	          16,
+	          0,
+	          &fshfs_test_read_queue_resubmit_function,
+	          (void *) &resubmit,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_internal_read_queue_complete_requests(
+	          (libfshfs_internal_read_queue_t *) read_queue,
+	          1,
+	          &number_of_completed_requests,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_completed_requests",
+	 number_of_completed_requests,
+	 3 );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "resubmit.number_of_reads",
+	 resubmit.number_of_reads,
+	 3 );
+
+	/* Test error cases
+	 */
+	result = libfshfs_internal_read_queue_complete_requests(
+	          NULL,
+	          1,
+	          &number_of_completed_requests,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_read_queue_free(
+	          &read_queue,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "read_queue",
+	 read_queue );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 internal_file_entry );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_queue != NULL )
+	{
+		libfshfs_read_queue_free(
+		 &read_queue,
+		 NULL );
+	}
+	if( internal_file_entry != NULL )
+	{
+		memory_free(
+		 internal_file_entry );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+
+/* Tests the libfshfs_read_queue_poll function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_read_queue_poll(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libfshfs_read_queue_t *read_queue = NULL;
+	int number_of_completed_requests  = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfshfs_read_queue_initialize(
+	          &read_queue,
+	          0,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "read_queue",
+	 read_queue );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfshfs_read_queue_poll(
+	          read_queue,
+	          &number_of_completed_requests,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_completed_requests",
+	 number_of_completed_requests,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfshfs_read_queue_poll(
+	          NULL,
+	          &number_of_completed_requests,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_read_queue_poll(
+	          read_queue,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_read_queue_free(
+	          &read_queue,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "read_queue",
+	 read_queue );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_queue != NULL )
+	{
+		libfshfs_read_queue_free(
+		 &read_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_read_queue_wait function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_read_queue_wait(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libfshfs_read_queue_t *read_queue = NULL;
+	int number_of_completed_requests  = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfshfs_read_queue_initialize(
+	          &read_queue,
+	          0,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "read_queue",
+	 read_queue );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfshfs_read_queue_wait(
+	          read_queue,
+	          &number_of_completed_requests,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_completed_requests",
+	 number_of_completed_requests,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfshfs_read_queue_wait(
+	          NULL,
+	          &number_of_completed_requests,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_read_queue_wait(
+	          read_queue,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_read_queue_free(
+	          &read_queue,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "read_queue",
+	 read_queue );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_queue != NULL )
+	{
+		libfshfs_read_queue_free(
+		 &read_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_read_queue_get_number_of_outstanding_requests function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_read_queue_get_number_of_outstanding_requests(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libfshfs_read_queue_t *read_queue  = NULL;
+	int number_of_outstanding_requests = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfshfs_read_queue_initialize(
+	          &read_queue,
+	          0,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "read_queue",
+	 read_queue );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfshfs_read_queue_get_number_of_outstanding_requests(
+	          read_queue,
+	          &number_of_outstanding_requests,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_outstanding_requests",
+	 number_of_outstanding_requests,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfshfs_read_queue_get_number_of_outstanding_requests(
+	          NULL,
+	          &number_of_outstanding_requests,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_read_queue_get_number_of_outstanding_requests(
+	          read_queue,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_read_queue_free(
+	          &read_queue,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "read_queue",
+	 read_queue );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_queue != NULL )
+	{
+		libfshfs_read_queue_free(
+		 &read_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSHFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSHFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSHFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSHFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSHFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSHFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_read_queue_initialize",
+	 fshfs_test_read_queue_initialize );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_read_queue_free",
+	 fshfs_test_read_queue_free );
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+	/* TODO: add tests for libfshfs_internal_read_queue_pop_request */
+
+	/* TODO: add tests for libfshfs_internal_read_queue_append_completed_request */
+
+	/* TODO: add tests for libfshfs_read_queue_process_request_callback */
+
+	/* TODO: add tests for libfshfs_internal_read_queue_submit_request */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_read_queue_submit_file_entry_read",
+	 fshfs_test_read_queue_submit_file_entry_read );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_read_queue_submit_extended_attribute_read",
+	 fshfs_test_read_queue_submit_extended_attribute_read );
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_internal_read_queue_complete_requests",
+	 fshfs_test_internal_read_queue_complete_requests );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_read_queue_poll",
+	 fshfs_test_read_queue_poll );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_read_queue_wait",
+	 fshfs_test_read_queue_wait );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_read_queue_get_number_of_outstanding_requests",
+	 fshfs_test_read_queue_get_number_of_outstanding_requests );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
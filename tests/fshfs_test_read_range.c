@@ -0,0 +1,517 @@
+/*
+ * Library read_range type test program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fshfs_test_libcerror.h"
+#include "fshfs_test_libfshfs.h"
+#include "fshfs_test_macros.h"
+#include "fshfs_test_memory.h"
+#include "fshfs_test_unused.h"
+
+#include "../libfshfs/libfshfs_definitions.h"
+#include "../libfshfs/libfshfs_read_range.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+/* Tests the libfshfs_read_range_compare_by_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_read_range_compare_by_offset(
+     void )
+{
+	libfshfs_read_range_t first_read_range;
+	libfshfs_read_range_t second_read_range;
+
+	int result = 0;
+
+	first_read_range.offset = 512;
+	first_read_range.size   = 16;
+	first_read_range.buffer = NULL;
+	first_read_range.index  = 1;
+
+	second_read_range.offset = 4096;
+	second_read_range.size   = 16;
+	second_read_range.buffer = NULL;
+	second_read_range.index  = 0;
+
+	/* Test regular cases
+	 */
+	result = libfshfs_read_range_compare_by_offset(
+	          &first_read_range,
+	          &second_read_range );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	result = libfshfs_read_range_compare_by_offset(
+	          &second_read_range,
+	          &first_read_range );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test ranges at the same offset are ordered by index
+	 */
+	second_read_range.offset = 512;
+
+	result = libfshfs_read_range_compare_by_offset(
+	          &first_read_range,
+	          &second_read_range );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfshfs_read_range_compare_by_offset(
+	          &first_read_range,
+	          &first_read_range );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfshfs_read_range_get_span function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_read_range_get_span(
+     void )
+{
+	libfshfs_read_range_t read_ranges[ 3 ];
+
+	libcerror_error_t *error = NULL;
+	size_t span_size         = 0;
+	off64_t span_offset      = 0;
+	int last_range_index     = 0;
+	int result               = 0;
+
+	read_ranges[ 0 ].offset = 0;
+	read_ranges[ 0 ].size   = 16;
+	read_ranges[ 0 ].buffer = NULL;
+	read_ranges[ 0 ].index  = 2;
+
+	read_ranges[ 1 ].offset = 16;
+	read_ranges[ 1 ].size   = 16;
+	read_ranges[ 1 ].buffer = NULL;
+	read_ranges[ 1 ].index  = 0;
+
+	read_ranges[ 2 ].offset = 24;
+	read_ranges[ 2 ].size   = 4;
+	read_ranges[ 2 ].buffer = NULL;
+	read_ranges[ 2 ].index  = 1;
+
+	/* Test adjacent and overlapping ranges are coalesced and that a range
+	 * contained in the span does not shrink the span
+	 */
+	result = libfshfs_read_range_get_span(
+	          read_ranges,
+	          3,
+	          0,
+	          &last_range_index,
+	          &span_offset,
+	          &span_size,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "last_range_index",
+	 last_range_index,
+	 2 );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT64(
+	 "span_offset",
+	 (int64_t) span_offset,
+	 (int64_t) 0 );
+
+	FSHFS_TEST_ASSERT_EQUAL_SIZE(
+	 "span_size",
+	 span_size,
+	 (size_t) 32 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a span that starts at a range other than the first
+	 */
+	result = libfshfs_read_range_get_span(
+	          read_ranges,
+	          3,
+	          2,
+	          &last_range_index,
+	          &span_offset,
+	          &span_size,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "last_range_index",
+	 last_range_index,
+	 2 );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT64(
+	 "span_offset",
+	 (int64_t) span_offset,
+	 (int64_t) 24 );
+
+	FSHFS_TEST_ASSERT_EQUAL_SIZE(
+	 "span_size",
+	 span_size,
+	 (size_t) 4 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test ranges separated by the maximum gap size are coalesced
+	 */
+	read_ranges[ 1 ].offset = 16 + LIBFSHFS_READ_RANGES_MAXIMUM_GAP_SIZE;
+
+	result = libfshfs_read_range_get_span(
+	          read_ranges,
+	          2,
+	          0,
+	          &last_range_index,
+	          &span_offset,
+	          &span_size,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "last_range_index",
+	 last_range_index,
+	 1 );
+
+	FSHFS_TEST_ASSERT_EQUAL_SIZE(
+	 "span_size",
+	 span_size,
+	 (size_t) ( 32 + LIBFSHFS_READ_RANGES_MAXIMUM_GAP_SIZE ) );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test ranges separated by more than the maximum gap size are not coalesced
+	 */
+	read_ranges[ 1 ].offset = 16 + LIBFSHFS_READ_RANGES_MAXIMUM_GAP_SIZE + 1;
+
+	result = libfshfs_read_range_get_span(
+	          read_ranges,
+	          2,
+	          0,
+	          &last_range_index,
+	          &span_offset,
+	          &span_size,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "last_range_index",
+	 last_range_index,
+	 0 );
+
+	FSHFS_TEST_ASSERT_EQUAL_SIZE(
+	 "span_size",
+	 span_size,
+	 (size_t) 16 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test ranges that fill the maximum span size are coalesced
+	 */
+	read_ranges[ 0 ].size   = LIBFSHFS_READ_RANGES_MAXIMUM_SPAN_SIZE - 16;
+	read_ranges[ 1 ].offset = LIBFSHFS_READ_RANGES_MAXIMUM_SPAN_SIZE - 16;
+	read_ranges[ 1 ].size   = 16;
+
+	result = libfshfs_read_range_get_span(
+	          read_ranges,
+	          2,
+	          0,
+	          &last_range_index,
+	          &span_offset,
+	          &span_size,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "last_range_index",
+	 last_range_index,
+	 1 );
+
+	FSHFS_TEST_ASSERT_EQUAL_SIZE(
+	 "span_size",
+	 span_size,
+	 (size_t) LIBFSHFS_READ_RANGES_MAXIMUM_SPAN_SIZE );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test ranges that exceed the maximum span size are not coalesced
+	 */
+	read_ranges[ 1 ].size = 17;
+
+	result = libfshfs_read_range_get_span(
+	          read_ranges,
+	          2,
+	          0,
+	          &last_range_index,
+	          &span_offset,
+	          &span_size,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "last_range_index",
+	 last_range_index,
+	 0 );
+
+	FSHFS_TEST_ASSERT_EQUAL_SIZE(
+	 "span_size",
+	 span_size,
+	 (size_t) ( LIBFSHFS_READ_RANGES_MAXIMUM_SPAN_SIZE - 16 ) );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_read_range_get_span(
+	          NULL,
+	          2,
+	          0,
+	          &last_range_index,
+	          &span_offset,
+	          &span_size,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_read_range_get_span(
+	          read_ranges,
+	          2,
+	          -1,
+	          &last_range_index,
+	          &span_offset,
+	          &span_size,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_read_range_get_span(
+	          read_ranges,
+	          2,
+	          2,
+	          &last_range_index,
+	          &span_offset,
+	          &span_size,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_read_range_get_span(
+	          read_ranges,
+	          2,
+	          0,
+	          NULL,
+	          &span_offset,
+	          &span_size,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_read_range_get_span(
+	          read_ranges,
+	          2,
+	          0,
+	          &last_range_index,
+	          NULL,
+	          &span_size,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_read_range_get_span(
+	          read_ranges,
+	          2,
+	          0,
+	          &last_range_index,
+	          &span_offset,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSHFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSHFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSHFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSHFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSHFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSHFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_read_range_compare_by_offset",
+	 fshfs_test_read_range_compare_by_offset );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_read_range_get_span",
+	 fshfs_test_read_range_get_span );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,822 @@
+/*
+ * Library read_request type test program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fshfs_test_libcerror.h"
+#include "fshfs_test_libfshfs.h"
+#include "fshfs_test_macros.h"
+#include "fshfs_test_memory.h"
+#include "fshfs_test_unused.h"
+
+#include "../libfshfs/libfshfs_definitions.h"
+#include "../libfshfs/libfshfs_file_entry.h"
+#include "../libfshfs/libfshfs_read_request.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+/* Completion function used by the tests
+ * Returns 1 if successful or -1 on error
+ */
+int fshfs_test_read_request_completion_function(
+     uint8_t *buffer FSHFS_TEST_ATTRIBUTE_UNUSED,
+     ssize_t read_count,
+     void *completion_data,
+     libcerror_error_t **error FSHFS_TEST_ATTRIBUTE_UNUSED )
+{
+	FSHFS_TEST_UNREFERENCED_PARAMETER( buffer )
+	FSHFS_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( read_count < 0 )
+	{
+		return( -1 );
+	}
+	*( (int *) completion_data ) += 1;
+
+	return( 1 );
+}
+
+/* Tests the libfshfs_read_request_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_read_request_initialize(
+     void )
+{
+	uint8_t buffer[ 16 ];
+
+	libcerror_error_t *error              = NULL;
+	libfshfs_file_entry_t *file_entry     = (libfshfs_file_entry_t *) 0x12345678UL;
+	libfshfs_read_request_t *read_request = NULL;
+	int completion_count                  = 0;
+	int result                            = 0;
+
+#if defined( HAVE_FSHFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests       = 1;
+	int number_of_memset_fail_tests       = 1;
+	int test_number                       = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfshfs_read_request_initialize(
+	          &read_request,
+	          file_entry,
+	          NULL,
+	          buffer,
+	          16,
+	          0,
+	          &fshfs_test_read_request_completion_function,
+	          (void *) &completion_count,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "read_request",
+	 read_request );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_read_request_free(
+	          &read_request,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "read_request",
+	 read_request );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_read_request_initialize(
+	          NULL,
+	          file_entry,
+	          NULL,
+	          buffer,
+	          16,
+	          0,
+	          &fshfs_test_read_request_completion_function,
+	          (void *) &completion_count,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_request = (libfshfs_read_request_t *) 0x12345678UL;
+
+	result = libfshfs_read_request_initialize(
+	          &read_request,
+	          file_entry,
+	          NULL,
+	          buffer,
+	          16,
+	          0,
+	          &fshfs_test_read_request_completion_function,
+	          (void *) &completion_count,
+	          &error );
+
+	read_request = NULL;
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_read_request_initialize(
+	          &read_request,
+	          NULL,
+	          NULL,
+	          buffer,
+	          16,
+	          0,
+	          &fshfs_test_read_request_completion_function,
+	          (void *) &completion_count,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_read_request_initialize(
+	          &read_request,
+	          file_entry,
+	          (libfshfs_extended_attribute_t *) 0x12345678UL,
+	          buffer,
+	          16,
+	          0,
+	          &fshfs_test_read_request_completion_function,
+	          (void *) &completion_count,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_read_request_initialize(
+	          &read_request,
+	          file_entry,
+	          NULL,
+	          NULL,
+	          16,
+	          0,
+	          &fshfs_test_read_request_completion_function,
+	          (void *) &completion_count,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_read_request_initialize(
+	          &read_request,
+	          file_entry,
+	          NULL,
+	          buffer,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &fshfs_test_read_request_completion_function,
+	          (void *) &completion_count,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_read_request_initialize(
+	          &read_request,
+	          file_entry,
+	          NULL,
+	          buffer,
+	          16,
+	          -1,
+	          &fshfs_test_read_request_completion_function,
+	          (void *) &completion_count,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_read_request_initialize(
+	          &read_request,
+	          file_entry,
+	          NULL,
+	          buffer,
+	          16,
+	          0,
+	          NULL,
+	          (void *) &completion_count,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSHFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfshfs_read_request_initialize with malloc failing
+		 */
+		fshfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfshfs_read_request_initialize(
+		          &read_request,
+		          file_entry,
+		          NULL,
+		          buffer,
+		          16,
+		          0,
+		          &fshfs_test_read_request_completion_function,
+		          (void *) &completion_count,
+		          &error );
+
+		if( fshfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fshfs_test_malloc_attempts_before_fail = -1;
+
+			if( read_request != NULL )
+			{
+				libfshfs_read_request_free(
+				 &read_request,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSHFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSHFS_TEST_ASSERT_IS_NULL(
+			 "read_request",
+			 read_request );
+
+			FSHFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfshfs_read_request_initialize with memset failing
+		 */
+		fshfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfshfs_read_request_initialize(
+		          &read_request,
+		          file_entry,
+		          NULL,
+		          buffer,
+		          16,
+		          0,
+		          &fshfs_test_read_request_completion_function,
+		          (void *) &completion_count,
+		          &error );
+
+		if( fshfs_test_memset_attempts_before_fail != -1 )
+		{
+			fshfs_test_memset_attempts_before_fail = -1;
+
+			if( read_request != NULL )
+			{
+				libfshfs_read_request_free(
+				 &read_request,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSHFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSHFS_TEST_ASSERT_IS_NULL(
+			 "read_request",
+			 read_request );
+
+			FSHFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSHFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_request != NULL )
+	{
+		libfshfs_read_request_free(
+		 &read_request,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_read_request_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_read_request_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfshfs_read_request_free(
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_read_request_process function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_read_request_process(
+     void )
+{
+	uint8_t buffer[ 16 ];
+
+	libcerror_error_t *error                            = NULL;
+	libfshfs_internal_file_entry_t *internal_file_entry = NULL;
+	libfshfs_read_request_t *read_request               = NULL;
+	int completion_count                                = 0;
+	int result                                          = 0;
+
+	/* Initialize test
+	 */
+	internal_file_entry = memory_allocate_structure(
+	                       libfshfs_internal_file_entry_t );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_file_entry",
+	 internal_file_entry );
+
+	memory_set(
+	 internal_file_entry,
+	 0,
+	 sizeof( libfshfs_internal_file_entry_t ) );
+
+	internal_file_entry->file_mode = LIBFSHFS_FILE_TYPE_DIRECTORY;
+
+	result = libfshfs_read_request_initialize(
+	          &read_request,
+	          (libfshfs_file_entry_t *) internal_file_entry,
+	          NULL,
+	          buffer,
+	          16,
+	          0,
+	          &fshfs_test_read_request_completion_function,
+	          (void *) &completion_count,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "read_request",
+	 read_request );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a read error is stored in the read request
+	 */
+	result = libfshfs_read_request_process(
+	          read_request,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_request->read_count",
+	 read_request->read_count,
+	 (ssize_t) -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "read_request->read_error",
+	 read_request->read_error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_read_request_process(
+	          NULL,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test processing a read request that already has a read error
+	 */
+	result = libfshfs_read_request_process(
+	          read_request,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_read_request_free(
+	          &read_request,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "read_request",
+	 read_request );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 internal_file_entry );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_request != NULL )
+	{
+		libfshfs_read_request_free(
+		 &read_request,
+		 NULL );
+	}
+	if( internal_file_entry != NULL )
+	{
+		memory_free(
+		 internal_file_entry );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_read_request_complete function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_read_request_complete(
+     void )
+{
+	uint8_t buffer[ 16 ];
+
+	libcerror_error_t *error              = NULL;
+	libfshfs_file_entry_t *file_entry     = (libfshfs_file_entry_t *) 0x12345678UL;
+	libfshfs_read_request_t *read_request = NULL;
+	int completion_count                  = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfshfs_read_request_initialize(
+	          &read_request,
+	          file_entry,
+	          NULL,
+	          buffer,
+	          16,
+	          0,
+	          &fshfs_test_read_request_completion_function,
+	          (void *) &completion_count,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "read_request",
+	 read_request );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	read_request->read_count = 16;
+
+	result = libfshfs_read_request_complete(
+	          read_request,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "completion_count",
+	 completion_count,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libfshfs_read_request_complete(
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libfshfs_read_request_complete with a failing completion function
+	 */
+	read_request->read_count = -1;
+
+	result = libfshfs_read_request_complete(
+	          read_request,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "completion_count",
+	 completion_count,
+	 1 );
+
+	/* Clean up
+	 */
+	result = libfshfs_read_request_free(
+	          &read_request,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "read_request",
+	 read_request );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_request != NULL )
+	{
+		libfshfs_read_request_free(
+		 &read_request,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSHFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSHFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSHFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSHFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSHFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSHFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_read_request_initialize",
+	 fshfs_test_read_request_initialize );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_read_request_free",
+	 fshfs_test_read_request_free );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_read_request_process",
+	 fshfs_test_read_request_process );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_read_request_complete",
+	 fshfs_test_read_request_complete );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+}
+
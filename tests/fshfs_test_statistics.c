@@ -0,0 +1,1080 @@
+/*
+ * Library statistics functions test program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fshfs_test_libcerror.h"
+#include "fshfs_test_libfshfs.h"
+#include "fshfs_test_macros.h"
+#include "fshfs_test_memory.h"
+#include "fshfs_test_unused.h"
+
+#include "../libfshfs/libfshfs_statistics.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+/* Tests the libfshfs_statistics_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_statistics_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libfshfs_statistics_t *statistics = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_FSHFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests     = 1;
+	int number_of_memset_fail_tests     = 1;
+	int test_number                     = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfshfs_statistics_initialize(
+	          &statistics,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "statistics",
+	 statistics );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_statistics_free(
+	          &statistics,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "statistics",
+	 statistics );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_statistics_initialize(
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	statistics = (libfshfs_statistics_t *) 0x12345678UL;
+
+	result = libfshfs_statistics_initialize(
+	          &statistics,
+	          &error );
+
+	statistics = NULL;
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSHFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfshfs_statistics_initialize with malloc failing
+		 */
+		fshfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfshfs_statistics_initialize(
+		          &statistics,
+		          &error );
+
+		if( fshfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fshfs_test_malloc_attempts_before_fail = -1;
+
+			if( statistics != NULL )
+			{
+				libfshfs_statistics_free(
+				 &statistics,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSHFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSHFS_TEST_ASSERT_IS_NULL(
+			 "statistics",
+			 statistics );
+
+			FSHFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfshfs_statistics_initialize with memset failing
+		 */
+		fshfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfshfs_statistics_initialize(
+		          &statistics,
+		          &error );
+
+		if( fshfs_test_memset_attempts_before_fail != -1 )
+		{
+			fshfs_test_memset_attempts_before_fail = -1;
+
+			if( statistics != NULL )
+			{
+				libfshfs_statistics_free(
+				 &statistics,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSHFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSHFS_TEST_ASSERT_IS_NULL(
+			 "statistics",
+			 statistics );
+
+			FSHFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSHFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( statistics != NULL )
+	{
+		libfshfs_statistics_free(
+		 &statistics,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_statistics_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_statistics_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfshfs_statistics_free(
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_statistics_reset function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_statistics_reset(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libfshfs_statistics_t *statistics = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfshfs_statistics_initialize(
+	          &statistics,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "statistics",
+	 statistics );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	statistics->values.read_sizes[ LIBFSHFS_STATISTICS_REGION_CATALOG ]                  = 4096;
+	statistics->values.number_of_node_cache_misses[ LIBFSHFS_STATISTICS_REGION_EXTENTS ] = 1;
+	statistics->values.decompression_time                                                = 1000;
+
+	/* Test regular cases
+	 */
+	result = libfshfs_statistics_reset(
+	          statistics,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics->values.read_sizes[ LIBFSHFS_STATISTICS_REGION_CATALOG ]",
+	 statistics->values.read_sizes[ LIBFSHFS_STATISTICS_REGION_CATALOG ],
+	 (uint64_t) 0 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics->values.number_of_node_cache_misses[ LIBFSHFS_STATISTICS_REGION_EXTENTS ]",
+	 statistics->values.number_of_node_cache_misses[ LIBFSHFS_STATISTICS_REGION_EXTENTS ],
+	 (uint64_t) 0 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics->values.decompression_time",
+	 statistics->values.decompression_time,
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libfshfs_statistics_reset(
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_statistics_free(
+	          &statistics,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "statistics",
+	 statistics );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( statistics != NULL )
+	{
+		libfshfs_statistics_free(
+		 &statistics,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_statistics_get_values function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_statistics_get_values(
+     void )
+{
+	libfshfs_volume_statistics_t volume_statistics;
+
+	libcerror_error_t *error          = NULL;
+	libfshfs_statistics_t *statistics = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfshfs_statistics_initialize(
+	          &statistics,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "statistics",
+	 statistics );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	statistics->values.read_sizes[ LIBFSHFS_STATISTICS_REGION_CATALOG ] = 4096;
+	statistics->values.decompression_time                            = 1000;
+
+	/* Test regular cases
+	 */
+	result = libfshfs_statistics_get_values(
+	          statistics,
+	          &volume_statistics,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT64(
+	 "volume_statistics.read_sizes[ LIBFSHFS_STATISTICS_REGION_CATALOG ]",
+	 volume_statistics.read_sizes[ LIBFSHFS_STATISTICS_REGION_CATALOG ],
+	 (uint64_t) 4096 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT64(
+	 "volume_statistics.decompression_time",
+	 volume_statistics.decompression_time,
+	 (uint64_t) 1000 );
+
+	/* Test error cases
+	 */
+	result = libfshfs_statistics_get_values(
+	          NULL,
+	          &volume_statistics,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_statistics_get_values(
+	          statistics,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_statistics_free(
+	          &statistics,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "statistics",
+	 statistics );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( statistics != NULL )
+	{
+		libfshfs_statistics_free(
+		 &statistics,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_statistics_add_read function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_statistics_add_read(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libfshfs_statistics_t *statistics = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfshfs_statistics_initialize(
+	          &statistics,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "statistics",
+	 statistics );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfshfs_statistics_add_read(
+	          statistics,
+	          LIBFSHFS_STATISTICS_REGION_DATA,
+	          4096,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_statistics_add_read(
+	          statistics,
+	          LIBFSHFS_STATISTICS_REGION_DATA,
+	          512,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics->values.number_of_reads[ LIBFSHFS_STATISTICS_REGION_DATA ]",
+	 statistics->values.number_of_reads[ LIBFSHFS_STATISTICS_REGION_DATA ],
+	 (uint64_t) 2 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics->values.read_sizes[ LIBFSHFS_STATISTICS_REGION_DATA ]",
+	 statistics->values.read_sizes[ LIBFSHFS_STATISTICS_REGION_DATA ],
+	 (uint64_t) 4608 );
+
+	/* Test error cases
+	 */
+	result = libfshfs_statistics_add_read(
+	          NULL,
+	          LIBFSHFS_STATISTICS_REGION_DATA,
+	          4096,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_statistics_add_read(
+	          statistics,
+	          -1,
+	          4096,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_statistics_add_read(
+	          statistics,
+	          LIBFSHFS_STATISTICS_NUMBER_OF_REGIONS,
+	          4096,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_statistics_free(
+	          &statistics,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "statistics",
+	 statistics );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( statistics != NULL )
+	{
+		libfshfs_statistics_free(
+		 &statistics,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_statistics_add_node_cache_values function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_statistics_add_node_cache_values(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libfshfs_statistics_t *statistics = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfshfs_statistics_initialize(
+	          &statistics,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "statistics",
+	 statistics );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfshfs_statistics_add_node_cache_values(
+	          statistics,
+	          LIBFSHFS_STATISTICS_REGION_EXTENTS,
+	          3,
+	          2,
+	          1,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics->values.number_of_node_cache_hits[ LIBFSHFS_STATISTICS_REGION_EXTENTS ]",
+	 statistics->values.number_of_node_cache_hits[ LIBFSHFS_STATISTICS_REGION_EXTENTS ],
+	 (uint64_t) 3 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics->values.number_of_node_cache_misses[ LIBFSHFS_STATISTICS_REGION_EXTENTS ]",
+	 statistics->values.number_of_node_cache_misses[ LIBFSHFS_STATISTICS_REGION_EXTENTS ],
+	 (uint64_t) 2 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics->values.number_of_node_cache_evictions[ LIBFSHFS_STATISTICS_REGION_EXTENTS ]",
+	 statistics->values.number_of_node_cache_evictions[ LIBFSHFS_STATISTICS_REGION_EXTENTS ],
+	 (uint64_t) 1 );
+
+	/* Test error cases
+	 */
+	result = libfshfs_statistics_add_node_cache_values(
+	          NULL,
+	          LIBFSHFS_STATISTICS_REGION_EXTENTS,
+	          1,
+	          0,
+	          0,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_statistics_add_node_cache_values(
+	          statistics,
+	          LIBFSHFS_STATISTICS_REGION_DATA,
+	          1,
+	          0,
+	          0,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_statistics_free(
+	          &statistics,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "statistics",
+	 statistics );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( statistics != NULL )
+	{
+		libfshfs_statistics_free(
+		 &statistics,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_statistics_add_decompression function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_statistics_add_decompression(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libfshfs_statistics_t *statistics = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfshfs_statistics_initialize(
+	          &statistics,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "statistics",
+	 statistics );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfshfs_statistics_add_decompression(
+	          statistics,
+	          LIBFSHFS_STATISTICS_COMPRESSION_METHOD_LZVN,
+	          65536,
+	          1000,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics->values.number_of_decompressed_blocks[ LIBFSHFS_STATISTICS_COMPRESSION_METHOD_LZVN ]",
+	 statistics->values.number_of_decompressed_blocks[ LIBFSHFS_STATISTICS_COMPRESSION_METHOD_LZVN ],
+	 (uint64_t) 1 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics->values.decompressed_sizes[ LIBFSHFS_STATISTICS_COMPRESSION_METHOD_LZVN ]",
+	 statistics->values.decompressed_sizes[ LIBFSHFS_STATISTICS_COMPRESSION_METHOD_LZVN ],
+	 (uint64_t) 65536 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics->values.decompression_time",
+	 statistics->values.decompression_time,
+	 (uint64_t) 1000 );
+
+	/* Test error cases
+	 */
+	result = libfshfs_statistics_add_decompression(
+	          NULL,
+	          LIBFSHFS_STATISTICS_COMPRESSION_METHOD_LZVN,
+	          65536,
+	          1000,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_statistics_add_decompression(
+	          statistics,
+	          LIBFSHFS_STATISTICS_NUMBER_OF_COMPRESSION_METHODS,
+	          65536,
+	          1000,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_statistics_free(
+	          &statistics,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "statistics",
+	 statistics );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( statistics != NULL )
+	{
+		libfshfs_statistics_free(
+		 &statistics,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_statistics_get_timestamp function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_statistics_get_timestamp(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int64_t timestamp        = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfshfs_statistics_get_timestamp(
+	          &timestamp,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_statistics_get_timestamp(
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSHFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSHFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSHFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSHFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSHFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSHFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_statistics_initialize",
+	 fshfs_test_statistics_initialize );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_statistics_free",
+	 fshfs_test_statistics_free );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_statistics_reset",
+	 fshfs_test_statistics_reset );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_statistics_get_values",
+	 fshfs_test_statistics_get_values );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_statistics_add_read",
+	 fshfs_test_statistics_add_read );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_statistics_add_node_cache_values",
+	 fshfs_test_statistics_add_node_cache_values );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_statistics_add_decompression",
+	 fshfs_test_statistics_add_decompression );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_statistics_get_timestamp",
+	 fshfs_test_statistics_get_timestamp );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+}
+
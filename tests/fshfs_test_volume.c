@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -37,7 +38,9 @@
 #include "fshfs_test_libfshfs.h"
 #include "fshfs_test_macros.h"
 #include "fshfs_test_memory.h"
+#include "fshfs_test_unused.h"
 
+#include "../libfshfs/libfshfs_definitions.h"
 #include "../libfshfs/libfshfs_volume.h"
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER ) && SIZEOF_WCHAR_T != 2 && SIZEOF_WCHAR_T != 4
@@ -64,6 +67,303 @@ int libfshfs_volume_open_file_io_handle(
 
 #endif /* !defined( LIBFSHFS_HAVE_BFIO ) */
 
+#define FSHFS_TEST_VOLUME_IMAGE_DATA_SIZE	65536
+
+/* The HFS+ volume header of the test volume image, with a block size of 4096
+ * and 16 blocks of which blocks 0 to 5 are allocated. The allocation file is
+ * stored in block 1, the extents file in block 2, the catalog file in blocks
+ * 3 and 4 and the attributes file in block 5
+ */
+uint8_t fshfs_test_volume_header_data1[ 512 ] = {
+	0x48, 0x2b, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x31, 0x30, 0x2e, 0x30, 0x00, 0x00, 0x00, 0x00,
+	0xdc, 0x3e, 0x12, 0x00, 0xdc, 0x3e, 0x12, 0x01, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x3e, 0x12, 0x02,
+	0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10,
+	0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+	0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* The extents B-tree header node descriptor and header record of an empty B-tree
+ */
+uint8_t fshfs_test_volume_extents_header_node_data1[ 120 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* The attributes B-tree header node descriptor and header record of an empty B-tree
+ */
+uint8_t fshfs_test_volume_attributes_header_node_data1[ 120 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x00, 0x01, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* The catalog B-tree header node descriptor and header record
+ */
+uint8_t fshfs_test_volume_catalog_header_node_data1[ 120 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+	0x10, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* The catalog B-tree leaf node descriptor and records, the record offsets
+ * are stored at the end of the node
+ */
+uint8_t fshfs_test_volume_catalog_leaf_node_data1[ 1018 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0e,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x72, 0x00, 0x6f, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0xdc, 0x3e, 0x12, 0x00, 0xdc, 0x3e,
+	0x12, 0x01, 0xdc, 0x3e, 0x12, 0x02, 0xdc, 0x3e, 0x12, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x41, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x72, 0x00, 0x6f, 0x00, 0x6f, 0x00, 0x74,
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x61, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xdc, 0x3e, 0x12, 0x10, 0xdc, 0x3e, 0x12, 0x11, 0xdc, 0x3e,
+	0x12, 0x12, 0xdc, 0x3e, 0x12, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf5, 0x00, 0x00,
+	0x00, 0x14, 0x00, 0x00, 0x81, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x62, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0xdc, 0x3e, 0x12, 0x20, 0xdc, 0x3e, 0x12, 0x21,
+	0xdc, 0x3e, 0x12, 0x22, 0xdc, 0x3e, 0x12, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf5,
+	0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x41, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x63, 0x00, 0x63,
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xdc, 0x3e, 0x12, 0x30,
+	0xdc, 0x3e, 0x12, 0x31, 0xdc, 0x3e, 0x12, 0x32, 0xdc, 0x3e, 0x12, 0x33, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0xf5, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x81, 0xa4, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x11, 0x00, 0x01,
+	0x00, 0x64, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xdc, 0x3e,
+	0x12, 0x40, 0xdc, 0x3e, 0x12, 0x41, 0xdc, 0x3e, 0x12, 0x42, 0xdc, 0x3e, 0x12, 0x43, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0xf5, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x81, 0xa4, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint16_t fshfs_test_volume_catalog_leaf_node_record_offsets1[ 7 ] = {
+	14, 118, 144, 402, 500, 760, 1018 };
+
+uint8_t fshfs_test_volume_image_data[ FSHFS_TEST_VOLUME_IMAGE_DATA_SIZE ];
+
+typedef struct fshfs_test_volume_records fshfs_test_volume_records_t;
+
+struct fshfs_test_volume_records
+{
+	/* The parent identifiers
+	 */
+	uint32_t parent_identifiers[ 8 ];
+
+	/* The identifiers
+	 */
+	uint32_t identifiers[ 8 ];
+
+	/* The number of records
+	 */
+	int number_of_records;
+
+	/* The maximum number of records to iterate
+	 */
+	int maximum_number_of_records;
+};
+
+typedef struct fshfs_test_volume_unallocated_reads fshfs_test_volume_unallocated_reads_t;
+
+struct fshfs_test_volume_unallocated_reads
+{
+	/* The volume offset of the first read
+	 */
+	off64_t first_volume_offset;
+
+	/* The total size of the reads
+	 */
+	size64_t read_size;
+
+	/* The number of reads
+	 */
+	int number_of_reads;
+
+	/* The maximum number of reads
+	 */
+	int maximum_number_of_reads;
+};
+
+/* Initializes the test volume image data
+ * Returns 1 if successful or -1 on error
+ */
+int fshfs_test_volume_initialize_image_data(
+     void )
+{
+	size_t data_offset     = 0;
+	uint16_t record_offset = 0;
+	int record_index       = 0;
+
+	if( memory_set(
+	     fshfs_test_volume_image_data,
+	     0,
+	     FSHFS_TEST_VOLUME_IMAGE_DATA_SIZE ) == NULL )
+	{
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( fshfs_test_volume_image_data[ 1024 ] ),
+	     fshfs_test_volume_header_data1,
+	     512 ) == NULL )
+	{
+		return( -1 );
+	}
+	/* The allocation bitmap marks blocks 0 to 5 as allocated
+	 */
+	fshfs_test_volume_image_data[ 4096 ] = 0xfc;
+
+	if( memory_copy(
+	     &( fshfs_test_volume_image_data[ 8192 ] ),
+	     fshfs_test_volume_extents_header_node_data1,
+	     120 ) == NULL )
+	{
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( fshfs_test_volume_image_data[ 12288 ] ),
+	     fshfs_test_volume_catalog_header_node_data1,
+	     120 ) == NULL )
+	{
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( fshfs_test_volume_image_data[ 16384 ] ),
+	     fshfs_test_volume_catalog_leaf_node_data1,
+	     1018 ) == NULL )
+	{
+		return( -1 );
+	}
+	/* The record offsets are stored in reverse order at the end of the leaf node
+	 */
+	for( record_index = 0;
+	     record_index < 7;
+	     record_index++ )
+	{
+		data_offset   = 20480 - ( ( record_index + 1 ) * 2 );
+		record_offset = fshfs_test_volume_catalog_leaf_node_record_offsets1[ record_index ];
+
+		fshfs_test_volume_image_data[ data_offset ]     = (uint8_t) ( record_offset >> 8 );
+		fshfs_test_volume_image_data[ data_offset + 1 ] = (uint8_t) ( record_offset & 0xff );
+	}
+	if( memory_copy(
+	     &( fshfs_test_volume_image_data[ 20480 ] ),
+	     fshfs_test_volume_attributes_header_node_data1,
+	     120 ) == NULL )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates and opens the test volume image
+ * Returns 1 if successful or -1 on error
+ */
+int fshfs_test_volume_open_image(
+     libfshfs_volume_t **volume,
+     libcerror_error_t **error )
+{
+	if( fshfs_test_volume_initialize_image_data() != 1 )
+	{
+		return( -1 );
+	}
+	if( libfshfs_volume_initialize(
+	     volume,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libfshfs_volume_open_memory(
+	     *volume,
+	     fshfs_test_volume_image_data,
+	     FSHFS_TEST_VOLUME_IMAGE_DATA_SIZE,
+	     LIBFSHFS_OPEN_READ,
+	     error ) != 1 )
+	{
+		libfshfs_volume_free(
+		 volume,
+		 NULL );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Creates and opens a source volume
  * Returns 1 if successful or -1 on error
  */
@@ -422,35 +722,19 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfshfs_volume_open function
+/* Tests the libfshfs_volume_get_maximum_read_ahead_size function
  * Returns 1 if successful or 0 if not
  */
-int fshfs_test_volume_open(
-     const system_character_t *source )
+int fshfs_test_volume_get_maximum_read_ahead_size(
+     void )
 {
-	char narrow_source[ 256 ];
-
-	libcerror_error_t *error  = NULL;
-	libfshfs_volume_t *volume = NULL;
-	int result                = 0;
+	libcerror_error_t *error       = NULL;
+	libfshfs_volume_t *volume      = NULL;
+	size_t maximum_read_ahead_size = 0;
+	int result                     = 0;
 
 	/* Initialize test
 	 */
-	result = fshfs_test_get_narrow_source(
-	          source,
-	          narrow_source,
-	          256,
-	          &error );
-
-	FSHFS_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	FSHFS_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
 	result = libfshfs_volume_initialize(
 	          &volume,
 	          &error );
@@ -468,12 +752,11 @@ int fshfs_test_volume_open(
 	 "error",
 	 error );
 
-	/* Test open
+	/* Test regular cases
 	 */
-	result = libfshfs_volume_open(
+	result = libfshfs_volume_get_maximum_read_ahead_size(
 	          volume,
-	          narrow_source,
-	          LIBFSHFS_OPEN_READ,
+	          &maximum_read_ahead_size,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
@@ -485,12 +768,16 @@ int fshfs_test_volume_open(
 	 "error",
 	 error );
 
+	FSHFS_TEST_ASSERT_EQUAL_SIZE(
+	 "maximum_read_ahead_size",
+	 maximum_read_ahead_size,
+	 (size_t) LIBFSHFS_READ_AHEAD_DEFAULT_MAXIMUM_WINDOW_SIZE );
+
 	/* Test error cases
 	 */
-	result = libfshfs_volume_open(
+	result = libfshfs_volume_get_maximum_read_ahead_size(
 	          NULL,
-	          narrow_source,
-	          LIBFSHFS_OPEN_READ,
+	          &maximum_read_ahead_size,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
@@ -505,48 +792,9 @@ int fshfs_test_volume_open(
 	libcerror_error_free(
 	 &error );
 
-	result = libfshfs_volume_open(
+	result = libfshfs_volume_get_maximum_read_ahead_size(
 	          volume,
 	          NULL,
-	          LIBFSHFS_OPEN_READ,
-	          &error );
-
-	FSHFS_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	FSHFS_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	result = libfshfs_volume_open(
-	          volume,
-	          narrow_source,
-	          -1,
-	          &error );
-
-	FSHFS_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	FSHFS_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	/* Test open when already opened
-	 */
-	result = libfshfs_volume_open(
-	          volume,
-	          narrow_source,
-	          LIBFSHFS_OPEN_READ,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
@@ -597,26 +845,21 @@ on_error:
 	return( 0 );
 }
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
-
-/* Tests the libfshfs_volume_open_wide function
+/* Tests the libfshfs_volume_set_maximum_read_ahead_size function
  * Returns 1 if successful or 0 if not
  */
-int fshfs_test_volume_open_wide(
-     const system_character_t *source )
+int fshfs_test_volume_set_maximum_read_ahead_size(
+     void )
 {
-	wchar_t wide_source[ 256 ];
-
-	libcerror_error_t *error  = NULL;
-	libfshfs_volume_t *volume = NULL;
-	int result                = 0;
+	libcerror_error_t *error       = NULL;
+	libfshfs_volume_t *volume      = NULL;
+	size_t maximum_read_ahead_size = 0;
+	int result                     = 0;
 
 	/* Initialize test
 	 */
-	result = fshfs_test_get_wide_source(
-	          source,
-	          wide_source,
-	          256,
+	result = libfshfs_volume_initialize(
+	          &volume,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
@@ -624,12 +867,19 @@ int fshfs_test_volume_open_wide(
 	 result,
 	 1 );
 
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
 	FSHFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfshfs_volume_initialize(
-	          &volume,
+	/* Test regular cases
+	 */
+	result = libfshfs_volume_set_maximum_read_ahead_size(
+	          volume,
+	          65536,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
@@ -637,20 +887,34 @@ int fshfs_test_volume_open_wide(
 	 result,
 	 1 );
 
-	FSHFS_TEST_ASSERT_IS_NOT_NULL(
-	 "volume",
-	 volume );
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_volume_get_maximum_read_ahead_size(
+	          volume,
+	          &maximum_read_ahead_size,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	FSHFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test open
+	FSHFS_TEST_ASSERT_EQUAL_SIZE(
+	 "maximum_read_ahead_size",
+	 maximum_read_ahead_size,
+	 (size_t) 65536 );
+
+	/* Test set maximum read-ahead size with the maximum value
 	 */
-	result = libfshfs_volume_open_wide(
+	result = libfshfs_volume_set_maximum_read_ahead_size(
 	          volume,
-	          wide_source,
-	          LIBFSHFS_OPEN_READ,
+	          (size_t) LIBFSHFS_READ_AHEAD_MAXIMUM_WINDOW_SIZE,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
@@ -662,30 +926,63 @@ int fshfs_test_volume_open_wide(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libfshfs_volume_open_wide(
-	          NULL,
-	          wide_source,
-	          LIBFSHFS_OPEN_READ,
+	result = libfshfs_volume_get_maximum_read_ahead_size(
+	          volume,
+	          &maximum_read_ahead_size,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	FSHFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	FSHFS_TEST_ASSERT_EQUAL_SIZE(
+	 "maximum_read_ahead_size",
+	 maximum_read_ahead_size,
+	 (size_t) LIBFSHFS_READ_AHEAD_MAXIMUM_WINDOW_SIZE );
 
-	result = libfshfs_volume_open_wide(
+	result = libfshfs_volume_set_maximum_read_ahead_size(
+	          volume,
+	          0,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_volume_get_maximum_read_ahead_size(
 	          volume,
+	          &maximum_read_ahead_size,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_SIZE(
+	 "maximum_read_ahead_size",
+	 maximum_read_ahead_size,
+	 (size_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libfshfs_volume_set_maximum_read_ahead_size(
 	          NULL,
-	          LIBFSHFS_OPEN_READ,
+	          65536,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
@@ -700,10 +997,9 @@ int fshfs_test_volume_open_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libfshfs_volume_open_wide(
+	result = libfshfs_volume_set_maximum_read_ahead_size(
 	          volume,
-	          wide_source,
-	          -1,
+	          (size_t) LIBFSHFS_READ_AHEAD_MAXIMUM_WINDOW_SIZE + 1,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
@@ -718,25 +1014,26 @@ int fshfs_test_volume_open_wide(
 	libcerror_error_free(
 	 &error );
 
-	/* Test open when already opened
+	/* Test the maximum read-ahead size is unchanged after a failed set
 	 */
-	result = libfshfs_volume_open_wide(
+	result = libfshfs_volume_get_maximum_read_ahead_size(
 	          volume,
-	          wide_source,
-	          LIBFSHFS_OPEN_READ,
+	          &maximum_read_ahead_size,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	FSHFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	FSHFS_TEST_ASSERT_EQUAL_SIZE(
+	 "maximum_read_ahead_size",
+	 maximum_read_ahead_size,
+	 (size_t) 0 );
 
 	/* Clean up
 	 */
@@ -774,68 +1071,19 @@ on_error:
 	return( 0 );
 }
 
-#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
-
-/* Tests the libfshfs_volume_open_file_io_handle function
+/* Tests the libfshfs_volume_get_use_memory_mapping function
  * Returns 1 if successful or 0 if not
  */
-int fshfs_test_volume_open_file_io_handle(
-     const system_character_t *source )
+int fshfs_test_volume_get_use_memory_mapping(
+     void )
 {
-	libbfio_handle_t *file_io_handle = NULL;
-	libcerror_error_t *error         = NULL;
-	libfshfs_volume_t *volume        = NULL;
-	size_t string_length             = 0;
-	int result                       = 0;
-
-	FSHFS_TEST_ASSERT_IS_NOT_NULL(
-	 "source",
-	 source );
+	libcerror_error_t *error   = NULL;
+	libfshfs_volume_t *volume  = NULL;
+	uint8_t use_memory_mapping = 0;
+	int result                 = 0;
 
 	/* Initialize test
 	 */
-	result = libbfio_file_initialize(
-	          &file_io_handle,
-	          &error );
-
-	FSHFS_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	FSHFS_TEST_ASSERT_IS_NOT_NULL(
-	 "file_io_handle",
-	 file_io_handle );
-
-	FSHFS_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	string_length = system_string_length(
-	                 source );
-
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libbfio_file_set_name_wide(
-	          file_io_handle,
-	          source,
-	          string_length,
-	          &error );
-#else
-	result = libbfio_file_set_name(
-	          file_io_handle,
-	          source,
-	          string_length,
-	          &error );
-#endif
-	FSHFS_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	FSHFS_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
 	result = libfshfs_volume_initialize(
 	          &volume,
 	          &error );
@@ -853,12 +1101,11 @@ int fshfs_test_volume_open_file_io_handle(
 	 "error",
 	 error );
 
-	/* Test open
+	/* Test regular cases
 	 */
-	result = libfshfs_volume_open_file_io_handle(
+	result = libfshfs_volume_get_use_memory_mapping(
 	          volume,
-	          file_io_handle,
-	          LIBFSHFS_OPEN_READ,
+	          &use_memory_mapping,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
@@ -870,12 +1117,16 @@ int fshfs_test_volume_open_file_io_handle(
 	 "error",
 	 error );
 
+	FSHFS_TEST_ASSERT_EQUAL_UINT8(
+	 "use_memory_mapping",
+	 use_memory_mapping,
+	 0 );
+
 	/* Test error cases
 	 */
-	result = libfshfs_volume_open_file_io_handle(
+	result = libfshfs_volume_get_use_memory_mapping(
 	          NULL,
-	          file_io_handle,
-	          LIBFSHFS_OPEN_READ,
+	          &use_memory_mapping,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
@@ -890,48 +1141,9 @@ int fshfs_test_volume_open_file_io_handle(
 	libcerror_error_free(
 	 &error );
 
-	result = libfshfs_volume_open_file_io_handle(
+	result = libfshfs_volume_get_use_memory_mapping(
 	          volume,
 	          NULL,
-	          LIBFSHFS_OPEN_READ,
-	          &error );
-
-	FSHFS_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	FSHFS_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	result = libfshfs_volume_open_file_io_handle(
-	          volume,
-	          file_io_handle,
-	          -1,
-	          &error );
-
-	FSHFS_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	FSHFS_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	/* Test open when already opened
-	 */
-	result = libfshfs_volume_open_file_io_handle(
-	          volume,
-	          file_io_handle,
-	          LIBFSHFS_OPEN_READ,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
@@ -965,23 +1177,6 @@ int fshfs_test_volume_open_file_io_handle(
 	 "error",
 	 error );
 
-	result = libbfio_handle_free(
-	          &file_io_handle,
-	          &error );
-
-	FSHFS_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	FSHFS_TEST_ASSERT_IS_NULL(
-	 "file_io_handle",
-	 file_io_handle );
-
-	FSHFS_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
 	return( 1 );
 
 on_error:
@@ -996,67 +1191,58 @@ on_error:
 		 &volume,
 		 NULL );
 	}
-	if( file_io_handle != NULL )
-	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
-	}
 	return( 0 );
 }
 
-/* Tests the libfshfs_volume_close function
+/* Tests the libfshfs_volume_set_use_memory_mapping function
  * Returns 1 if successful or 0 if not
  */
-int fshfs_test_volume_close(
+int fshfs_test_volume_set_use_memory_mapping(
      void )
 {
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	libcerror_error_t *error   = NULL;
+	libfshfs_volume_t *volume  = NULL;
+	uint8_t use_memory_mapping = 0;
+	int result                 = 0;
 
-	/* Test error cases
+	/* Initialize test
 	 */
-	result = libfshfs_volume_close(
-	          NULL,
+	result = libfshfs_volume_initialize(
+	          &volume,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	return( 1 );
+	/* Test regular cases
+	 */
+	result = libfshfs_volume_set_use_memory_mapping(
+	          volume,
+	          1,
+	          &error );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-/* Tests the libfshfs_volume_open and libfshfs_volume_close functions
- * Returns 1 if successful or 0 if not
- */
-int fshfs_test_volume_open_close(
-     const system_character_t *source )
-{
-	libcerror_error_t *error  = NULL;
-	libfshfs_volume_t *volume = NULL;
-	int result                = 0;
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Initialize test
-	 */
-	result = libfshfs_volume_initialize(
-	          &volume,
+	result = libfshfs_volume_get_use_memory_mapping(
+	          volume,
+	          &use_memory_mapping,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
@@ -1064,29 +1250,21 @@ int fshfs_test_volume_open_close(
 	 result,
 	 1 );
 
-	FSHFS_TEST_ASSERT_IS_NOT_NULL(
-	 "volume",
-	 volume );
-
 	FSHFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test open and close
+	FSHFS_TEST_ASSERT_EQUAL_UINT8(
+	 "use_memory_mapping",
+	 use_memory_mapping,
+	 1 );
+
+	/* Test set use memory mapping with a non-zero value other than 1
 	 */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libfshfs_volume_open_wide(
-	          volume,
-	          source,
-	          LIBFSHFS_OPEN_READ,
-	          &error );
-#else
-	result = libfshfs_volume_open(
+	result = libfshfs_volume_set_use_memory_mapping(
 	          volume,
-	          source,
-	          LIBFSHFS_OPEN_READ,
+	          0xff,
 	          &error );
-#endif
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1097,34 +1275,29 @@ int fshfs_test_volume_open_close(
 	 "error",
 	 error );
 
-	result = libfshfs_volume_close(
+	result = libfshfs_volume_get_use_memory_mapping(
 	          volume,
+	          &use_memory_mapping,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
 
 	FSHFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test open and close a second time to validate clean up on close
-	 */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libfshfs_volume_open_wide(
-	          volume,
-	          source,
-	          LIBFSHFS_OPEN_READ,
-	          &error );
-#else
-	result = libfshfs_volume_open(
+	FSHFS_TEST_ASSERT_EQUAL_UINT8(
+	 "use_memory_mapping",
+	 use_memory_mapping,
+	 1 );
+
+	result = libfshfs_volume_set_use_memory_mapping(
 	          volume,
-	          source,
-	          LIBFSHFS_OPEN_READ,
+	          0,
 	          &error );
-#endif
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1135,19 +1308,44 @@ int fshfs_test_volume_open_close(
 	 "error",
 	 error );
 
-	result = libfshfs_volume_close(
+	result = libfshfs_volume_get_use_memory_mapping(
 	          volume,
+	          &use_memory_mapping,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
 
 	FSHFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	FSHFS_TEST_ASSERT_EQUAL_UINT8(
+	 "use_memory_mapping",
+	 use_memory_mapping,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfshfs_volume_set_use_memory_mapping(
+	          NULL,
+	          1,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
 	/* Clean up
 	 */
 	result = libfshfs_volume_free(
@@ -1184,19 +1382,21 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfshfs_volume_signal_abort function
+/* Tests the libfshfs_volume_get_use_lazy_open function
  * Returns 1 if successful or 0 if not
  */
-int fshfs_test_volume_signal_abort(
-     libfshfs_volume_t *volume )
+int fshfs_test_volume_get_use_lazy_open(
+     void )
 {
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	libcerror_error_t *error  = NULL;
+	libfshfs_volume_t *volume = NULL;
+	uint8_t use_lazy_open     = 0;
+	int result                = 0;
 
-	/* Test regular cases
+	/* Initialize test
 	 */
-	result = libfshfs_volume_signal_abort(
-	          volume,
+	result = libfshfs_volume_initialize(
+	          &volume,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
@@ -1204,14 +1404,3864 @@ int fshfs_test_volume_signal_abort(
 	 result,
 	 1 );
 
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfshfs_volume_get_use_lazy_open(
+	          volume,
+	          &use_lazy_open,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT8(
+	 "use_lazy_open",
+	 use_lazy_open,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfshfs_volume_get_use_lazy_open(
+	          NULL,
+	          &use_lazy_open,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_volume_get_use_lazy_open(
+	          volume,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfshfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_volume_set_use_lazy_open function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_volume_set_use_lazy_open(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libfshfs_volume_t *volume = NULL;
+	uint8_t use_lazy_open     = 0;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libfshfs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfshfs_volume_set_use_lazy_open(
+	          volume,
+	          1,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_volume_get_use_lazy_open(
+	          volume,
+	          &use_lazy_open,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT8(
+	 "use_lazy_open",
+	 use_lazy_open,
+	 1 );
+
+	/* Test set use lazy open with a non-zero value other than 1
+	 */
+	result = libfshfs_volume_set_use_lazy_open(
+	          volume,
+	          0xff,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_volume_get_use_lazy_open(
+	          volume,
+	          &use_lazy_open,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT8(
+	 "use_lazy_open",
+	 use_lazy_open,
+	 1 );
+
+	result = libfshfs_volume_set_use_lazy_open(
+	          volume,
+	          0,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_volume_get_use_lazy_open(
+	          volume,
+	          &use_lazy_open,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT8(
+	 "use_lazy_open",
+	 use_lazy_open,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfshfs_volume_set_use_lazy_open(
+	          NULL,
+	          1,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfshfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_volume_open function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_volume_open(
+     const system_character_t *source )
+{
+	char narrow_source[ 256 ];
+
+	libcerror_error_t *error  = NULL;
+	libfshfs_volume_t *volume = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = fshfs_test_get_narrow_source(
+	          source,
+	          narrow_source,
+	          256,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open
+	 */
+	result = libfshfs_volume_open(
+	          volume,
+	          narrow_source,
+	          LIBFSHFS_OPEN_READ,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_volume_open(
+	          NULL,
+	          narrow_source,
+	          LIBFSHFS_OPEN_READ,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_volume_open(
+	          volume,
+	          NULL,
+	          LIBFSHFS_OPEN_READ,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_volume_open(
+	          volume,
+	          narrow_source,
+	          -1,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test open when already opened
+	 */
+	result = libfshfs_volume_open(
+	          volume,
+	          narrow_source,
+	          LIBFSHFS_OPEN_READ,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfshfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Tests the libfshfs_volume_open_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_volume_open_wide(
+     const system_character_t *source )
+{
+	wchar_t wide_source[ 256 ];
+
+	libcerror_error_t *error  = NULL;
+	libfshfs_volume_t *volume = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = fshfs_test_get_wide_source(
+	          source,
+	          wide_source,
+	          256,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open
+	 */
+	result = libfshfs_volume_open_wide(
+	          volume,
+	          wide_source,
+	          LIBFSHFS_OPEN_READ,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_volume_open_wide(
+	          NULL,
+	          wide_source,
+	          LIBFSHFS_OPEN_READ,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_volume_open_wide(
+	          volume,
+	          NULL,
+	          LIBFSHFS_OPEN_READ,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_volume_open_wide(
+	          volume,
+	          wide_source,
+	          -1,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test open when already opened
+	 */
+	result = libfshfs_volume_open_wide(
+	          volume,
+	          wide_source,
+	          LIBFSHFS_OPEN_READ,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfshfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Tests the libfshfs_volume_open_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_volume_open_file_io_handle(
+     const system_character_t *source )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libfshfs_volume_t *volume        = NULL;
+	size_t string_length             = 0;
+	int result                       = 0;
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "source",
+	 source );
+
+	/* Initialize test
+	 */
+	result = libbfio_file_initialize(
+	          &file_io_handle,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_length = system_string_length(
+	                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libbfio_file_set_name_wide(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#else
+	result = libbfio_file_set_name(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#endif
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open
+	 */
+	result = libfshfs_volume_open_file_io_handle(
+	          volume,
+	          file_io_handle,
+	          LIBFSHFS_OPEN_READ,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_volume_open_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          LIBFSHFS_OPEN_READ,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_volume_open_file_io_handle(
+	          volume,
+	          NULL,
+	          LIBFSHFS_OPEN_READ,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_volume_open_file_io_handle(
+	          volume,
+	          file_io_handle,
+	          -1,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test open when already opened
+	 */
+	result = libfshfs_volume_open_file_io_handle(
+	          volume,
+	          file_io_handle,
+	          LIBFSHFS_OPEN_READ,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfshfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_volume_open_memory function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_volume_open_memory(
+     void )
+{
+	uint8_t data[ 4096 ];
+
+	libcerror_error_t *error  = NULL;
+	libfshfs_volume_t *volume = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libfshfs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_volume_open_memory(
+	          NULL,
+	          data,
+	          4096,
+	          LIBFSHFS_OPEN_READ,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_volume_open_memory(
+	          volume,
+	          NULL,
+	          4096,
+	          LIBFSHFS_OPEN_READ,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_volume_open_memory(
+	          volume,
+	          data,
+	          0,
+	          LIBFSHFS_OPEN_READ,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_volume_open_memory(
+	          volume,
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBFSHFS_OPEN_READ,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_volume_open_memory(
+	          volume,
+	          data,
+	          4096,
+	          -1,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_volume_open_memory(
+	          volume,
+	          data,
+	          4096,
+	          LIBFSHFS_OPEN_WRITE,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test open with data that does not contain a volume
+	 */
+	if( memory_set(
+	     data,
+	     0,
+	     4096 ) == NULL )
+	{
+		goto on_error;
+	}
+	result = libfshfs_volume_open_memory(
+	          volume,
+	          data,
+	          4096,
+	          LIBFSHFS_OPEN_READ,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfshfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+/* Tests opening a volume with lazy open enabled
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_volume_open_lazy(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libfshfs_file_system_t *file_system         = NULL;
+	libfshfs_internal_volume_t *internal_volume = NULL;
+	libfshfs_volume_t *volume                   = NULL;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = fshfs_test_volume_initialize_image_data();
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfshfs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_volume_set_use_lazy_open(
+	          volume,
+	          1,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open defers reading the extents and attributes B-tree files
+	 */
+	result = libfshfs_volume_open_memory(
+	          volume,
+	          fshfs_test_volume_image_data,
+	          FSHFS_TEST_VOLUME_IMAGE_DATA_SIZE,
+	          LIBFSHFS_OPEN_READ,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_volume = (libfshfs_internal_volume_t *) volume;
+	file_system     = internal_volume->file_system;
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_system",
+	 file_system );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_system->catalog_btree_file",
+	 file_system->catalog_btree_file );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "file_system->extents_btree_file",
+	 file_system->extents_btree_file );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_system->deferred_extents_file_fork_descriptor",
+	 file_system->deferred_extents_file_fork_descriptor );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "file_system->attributes_btree_file",
+	 file_system->attributes_btree_file );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_system->deferred_attributes_file_fork_descriptor",
+	 file_system->deferred_attributes_file_fork_descriptor );
+
+	/* Test the deferred B-tree files are read on first use
+	 */
+	result = libfshfs_volume_read_attributes_index(
+	          volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_system->extents_btree_file",
+	 file_system->extents_btree_file );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "file_system->deferred_extents_file_fork_descriptor",
+	 file_system->deferred_extents_file_fork_descriptor );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_system->attributes_btree_file",
+	 file_system->attributes_btree_file );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "file_system->deferred_attributes_file_fork_descriptor",
+	 file_system->deferred_attributes_file_fork_descriptor );
+
+	/* Clean up
+	 */
+	result = libfshfs_volume_close(
+	          volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfshfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+
+/* Tests the libfshfs_volume_close function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_volume_close(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfshfs_volume_close(
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_volume_open and libfshfs_volume_close functions
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_volume_open_close(
+     const system_character_t *source )
+{
+	libcerror_error_t *error  = NULL;
+	libfshfs_volume_t *volume = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libfshfs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfshfs_volume_open_wide(
+	          volume,
+	          source,
+	          LIBFSHFS_OPEN_READ,
+	          &error );
+#else
+	result = libfshfs_volume_open(
+	          volume,
+	          source,
+	          LIBFSHFS_OPEN_READ,
+	          &error );
+#endif
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_volume_close(
+	          volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close a second time to validate clean up on close
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfshfs_volume_open_wide(
+	          volume,
+	          source,
+	          LIBFSHFS_OPEN_READ,
+	          &error );
+#else
+	result = libfshfs_volume_open(
+	          volume,
+	          source,
+	          LIBFSHFS_OPEN_READ,
+	          &error );
+#endif
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_volume_close(
+	          volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfshfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfshfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_volume_signal_abort function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_volume_signal_abort(
+     libfshfs_volume_t *volume )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfshfs_volume_signal_abort(
+	          volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_volume_signal_abort(
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_volume_get_utf8_name_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_volume_get_utf8_name_size(
+     libfshfs_volume_t *volume )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfshfs_volume_get_utf8_name_size(
+	          volume,
+	          &utf8_string_size,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_volume_get_utf8_name_size(
+	          NULL,
+	          &utf8_string_size,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_volume_get_utf8_name_size(
+	          volume,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_volume_get_utf8_name function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_volume_get_utf8_name(
+     libfshfs_volume_t *volume )
+{
+	uint8_t utf8_string[ 512 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfshfs_volume_get_utf8_name(
+	          volume,
+	          utf8_string,
+	          512,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_volume_get_utf8_name(
+	          NULL,
+	          utf8_string,
+	          512,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_volume_get_utf8_name(
+	          volume,
+	          NULL,
+	          512,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_volume_get_utf8_name(
+	          volume,
+	          utf8_string,
+	          0,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_volume_get_utf8_name(
+	          volume,
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_volume_get_utf16_name_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_volume_get_utf16_name_size(
+     libfshfs_volume_t *volume )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf16_string_size = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfshfs_volume_get_utf16_name_size(
+	          volume,
+	          &utf16_string_size,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_volume_get_utf16_name_size(
+	          NULL,
+	          &utf16_string_size,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_volume_get_utf16_name_size(
+	          volume,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_volume_get_utf16_name function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_volume_get_utf16_name(
+     libfshfs_volume_t *volume )
+{
+	uint16_t utf16_string[ 512 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfshfs_volume_get_utf16_name(
+	          volume,
+	          utf16_string,
+	          512,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_volume_get_utf16_name(
+	          NULL,
+	          utf16_string,
+	          512,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_volume_get_utf16_name(
+	          volume,
+	          NULL,
+	          512,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_volume_get_utf16_name(
+	          volume,
+	          utf16_string,
+	          0,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_volume_get_utf16_name(
+	          volume,
+	          utf16_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_volume_get_root_directory function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_volume_get_root_directory(
+     libfshfs_volume_t *volume )
+{
+	libcerror_error_t *error              = NULL;
+	libfshfs_file_entry_t *root_directory = NULL;
+	int result                            = 0;
+
+	/* Test regular cases
+	 */
+	result = libfshfs_volume_get_root_directory(
+	          volume,
+	          &root_directory,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "root_directory",
+	 root_directory );
+
+	result = libfshfs_file_entry_free(
+	          &root_directory,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_volume_get_root_directory(
+	          NULL,
+	          &root_directory,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "root_directory",
+	 root_directory );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_volume_get_root_directory(
+	          volume,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "root_directory",
+	 root_directory );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( root_directory != NULL )
+	{
+		libfshfs_file_entry_free(
+		 &root_directory,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_volume_get_file_entries_by_identifiers function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_volume_get_file_entries_by_identifiers(
+     libfshfs_volume_t *volume )
+{
+	libfshfs_file_entry_t *file_entries[ 3 ] = { NULL, NULL, NULL };
+	uint32_t identifiers[ 3 ]                = { 0x7ffffff0UL, 2, 2 };
+	libcerror_error_t *error                 = NULL;
+	uint32_t identifier                      = 0;
+	int file_entry_index                     = 0;
+	int result                               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfshfs_volume_get_file_entries_by_identifiers(
+	          volume,
+	          identifiers,
+	          3,
+	          file_entries,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "file_entries[ 0 ]",
+	 file_entries[ 0 ] );
+
+	for( file_entry_index = 1;
+	     file_entry_index < 3;
+	     file_entry_index++ )
+	{
+		FSHFS_TEST_ASSERT_IS_NOT_NULL(
+		 "file_entries[ file_entry_index ]",
+		 file_entries[ file_entry_index ] );
+
+		result = libfshfs_file_entry_get_identifier(
+		          file_entries[ file_entry_index ],
+		          &identifier,
+		          &error );
+
+		FSHFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSHFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FSHFS_TEST_ASSERT_EQUAL_UINT32(
+		 "identifier",
+		 identifier,
+		 (uint32_t) 2 );
+
+		result = libfshfs_file_entry_free(
+		          &( file_entries[ file_entry_index ] ),
+		          &error );
+
+		FSHFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSHFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libfshfs_volume_get_file_entries_by_identifiers(
+	          NULL,
+	          identifiers,
+	          3,
+	          file_entries,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_volume_get_file_entries_by_identifiers(
+	          volume,
+	          NULL,
+	          3,
+	          file_entries,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_volume_get_file_entries_by_identifiers(
+	          volume,
+	          identifiers,
+	          -1,
+	          file_entries,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_volume_get_file_entries_by_identifiers(
+	          volume,
+	          identifiers,
+	          3,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( file_entry_index = 0;
+	     file_entry_index < 3;
+	     file_entry_index++ )
+	{
+		if( file_entries[ file_entry_index ] != NULL )
+		{
+			libfshfs_file_entry_free(
+			 &( file_entries[ file_entry_index ] ),
+			 NULL );
+		}
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_volume_get_file_entries_by_utf8_paths function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_volume_get_file_entries_by_utf8_paths(
+     libfshfs_volume_t *volume )
+{
+	libfshfs_file_entry_t *file_entries[ 4 ] = { NULL, NULL, NULL, NULL };
+	const uint8_t *utf8_strings[ 4 ]         = { (uint8_t *) "/", (uint8_t *) "/nonexistent/name", (uint8_t *) "//", (uint8_t *) "" };
+	size_t utf8_string_lengths[ 4 ]          = { 1, 17, 2, 0 };
+	libcerror_error_t *error                 = NULL;
+	uint32_t identifier                      = 0;
+	int file_entry_index                     = 0;
+	int result                               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfshfs_volume_get_file_entries_by_utf8_paths(
+	          volume,
+	          utf8_strings,
+	          utf8_string_lengths,
+	          4,
+	          file_entries,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "file_entries[ 1 ]",
+	 file_entries[ 1 ] );
+
+	/* An empty path segment is not available
+	 */
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "file_entries[ 2 ]",
+	 file_entries[ 2 ] );
+
+	for( file_entry_index = 0;
+	     file_entry_index < 4;
+	     file_entry_index += 3 )
+	{
+		FSHFS_TEST_ASSERT_IS_NOT_NULL(
+		 "file_entries[ file_entry_index ]",
+		 file_entries[ file_entry_index ] );
+
+		result = libfshfs_file_entry_get_identifier(
+		          file_entries[ file_entry_index ],
+		          &identifier,
+		          &error );
+
+		FSHFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSHFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FSHFS_TEST_ASSERT_EQUAL_UINT32(
+		 "identifier",
+		 identifier,
+		 (uint32_t) 2 );
+
+		result = libfshfs_file_entry_free(
+		          &( file_entries[ file_entry_index ] ),
+		          &error );
+
+		FSHFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSHFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libfshfs_volume_get_file_entries_by_utf8_paths(
+	          NULL,
+	          utf8_strings,
+	          utf8_string_lengths,
+	          4,
+	          file_entries,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_volume_get_file_entries_by_utf8_paths(
+	          volume,
+	          NULL,
+	          utf8_string_lengths,
+	          4,
+	          file_entries,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_volume_get_file_entries_by_utf8_paths(
+	          volume,
+	          utf8_strings,
+	          NULL,
+	          4,
+	          file_entries,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_volume_get_file_entries_by_utf8_paths(
+	          volume,
+	          utf8_strings,
+	          utf8_string_lengths,
+	          4,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( file_entry_index = 0;
+	     file_entry_index < 4;
+	     file_entry_index++ )
+	{
+		if( file_entries[ file_entry_index ] != NULL )
+		{
+			libfshfs_file_entry_free(
+			 &( file_entries[ file_entry_index ] ),
+			 NULL );
+		}
+	}
+	return( 0 );
+}
+
+/* Callback function used by the libfshfs_volume_read_unallocated_blocks tests
+ * The callback function uses the volume to test that the volume is not locked
+ * during the callback
+ * Returns 1 to continue, 0 to stop or -1 on error
+ */
+int fshfs_test_volume_read_unallocated_blocks_callback_function(
+     off64_t volume_offset,
+     const uint8_t *data,
+     size_t data_size,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	uint32_t number_of_free_blocks = 0;
+
+	if( ( volume_offset < 0 )
+	 || ( data == NULL )
+	 || ( data_size == 0 ) )
+	{
+		return( -1 );
+	}
+	if( libfshfs_volume_get_number_of_free_blocks(
+	     (libfshfs_volume_t *) callback_data,
+	     &number_of_free_blocks,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	/* Stop after the first read
+	 */
+	return( 0 );
+}
+
+/* Tests the libfshfs_volume_read_unallocated_blocks function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_volume_read_unallocated_blocks(
+     libfshfs_volume_t *volume )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfshfs_volume_read_unallocated_blocks(
+	          volume,
+	          65536,
+	          &fshfs_test_volume_read_unallocated_blocks_callback_function,
+	          (void *) volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_volume_read_unallocated_blocks(
+	          NULL,
+	          65536,
+	          &fshfs_test_volume_read_unallocated_blocks_callback_function,
+	          (void *) volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_volume_read_unallocated_blocks(
+	          volume,
+	          0,
+	          &fshfs_test_volume_read_unallocated_blocks_callback_function,
+	          (void *) volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_volume_read_unallocated_blocks(
+	          volume,
+	          65536,
+	          NULL,
+	          (void *) volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_volume_read_indirect_node_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_volume_read_indirect_node_index(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libfshfs_volume_t *volume = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = fshfs_test_volume_open_image(
+	          &volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfshfs_volume_read_indirect_node_index(
+	          volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "indirect_node_index",
+	 ( (libfshfs_internal_volume_t *) volume )->file_system->indirect_node_index );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+
+	/* Test read indirect node index when the index was already read
+	 */
+	result = libfshfs_volume_read_indirect_node_index(
+	          volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_volume_read_indirect_node_index(
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_volume_close(
+	          volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read indirect node index on a volume that is not open
+	 */
+	result = libfshfs_volume_read_indirect_node_index(
+	          volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfshfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Collects the catalog records of libfshfs_volume_iterate_catalog_records
+ * Returns 1 to continue, 0 to stop or -1 on error
+ */
+int fshfs_test_volume_collect_catalog_record(
+     uint32_t parent_identifier,
+     const uint8_t *name_data FSHFS_TEST_ATTRIBUTE_UNUSED,
+     size_t name_size FSHFS_TEST_ATTRIBUTE_UNUSED,
+     const libfshfs_file_entry_stat_t *stat_value,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	fshfs_test_volume_records_t *records = NULL;
+	static char *function                = "fshfs_test_volume_collect_catalog_record";
+
+	FSHFS_TEST_UNREFERENCED_PARAMETER( name_data )
+	FSHFS_TEST_UNREFERENCED_PARAMETER( name_size )
+
+	if( ( callback_data == NULL )
+	 || ( stat_value == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback data.",
+		 function );
+
+		return( -1 );
+	}
+	records = (fshfs_test_volume_records_t *) callback_data;
+
+	if( records->number_of_records < 8 )
+	{
+		records->parent_identifiers[ records->number_of_records ] = parent_identifier;
+		records->identifiers[ records->number_of_records ]        = stat_value->identifier;
+	}
+	records->number_of_records += 1;
+
+	if( records->number_of_records >= records->maximum_number_of_records )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Tests the libfshfs_volume_iterate_catalog_records function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_volume_iterate_catalog_records(
+     void )
+{
+	fshfs_test_volume_records_t records;
+
+	libcerror_error_t *error  = NULL;
+	libfshfs_volume_t *volume = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = fshfs_test_volume_open_image(
+	          &volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	records.number_of_records         = 0;
+	records.maximum_number_of_records = 8;
+
+	result = libfshfs_volume_iterate_catalog_records(
+	          volume,
+	          &fshfs_test_volume_collect_catalog_record,
+	          (void *) &records,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "records.number_of_records",
+	 records.number_of_records,
+	 5 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "records.parent_identifiers[ 0 ]",
+	 records.parent_identifiers[ 0 ],
+	 (uint32_t) 1 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "records.identifiers[ 0 ]",
+	 records.identifiers[ 0 ],
+	 (uint32_t) 2 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "records.parent_identifiers[ 1 ]",
+	 records.parent_identifiers[ 1 ],
+	 (uint32_t) 2 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "records.identifiers[ 1 ]",
+	 records.identifiers[ 1 ],
+	 (uint32_t) 16 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "records.parent_identifiers[ 4 ]",
+	 records.parent_identifiers[ 4 ],
+	 (uint32_t) 17 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "records.identifiers[ 4 ]",
+	 records.identifiers[ 4 ],
+	 (uint32_t) 19 );
+
+	/* Test stopping the iteration from the callback
+	 */
+	records.number_of_records         = 0;
+	records.maximum_number_of_records = 2;
+
+	result = libfshfs_volume_iterate_catalog_records(
+	          volume,
+	          &fshfs_test_volume_collect_catalog_record,
+	          (void *) &records,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "records.number_of_records",
+	 records.number_of_records,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libfshfs_volume_iterate_catalog_records(
+	          NULL,
+	          &fshfs_test_volume_collect_catalog_record,
+	          (void *) &records,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_volume_iterate_catalog_records(
+	          volume,
+	          NULL,
+	          (void *) &records,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test iterate catalog records with a callback that fails
+	 */
+	result = libfshfs_volume_iterate_catalog_records(
+	          volume,
+	          &fshfs_test_volume_collect_catalog_record,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_volume_close(
+	          volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test iterate catalog records on a volume that is not open
+	 */
+	result = libfshfs_volume_iterate_catalog_records(
+	          volume,
+	          &fshfs_test_volume_collect_catalog_record,
+	          (void *) &records,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfshfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+/* Tests the libfshfs_internal_volume_read_allocation_bitmap function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_internal_volume_read_allocation_bitmap(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libfshfs_volume_t *volume = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = fshfs_test_volume_open_image(
+	          &volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfshfs_internal_volume_read_allocation_bitmap(
+	          (libfshfs_internal_volume_t *) volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "allocation_bitmap",
+	 ( (libfshfs_internal_volume_t *) volume )->allocation_bitmap );
+
+	/* Test read allocation bitmap when the allocation bitmap was already read
+	 */
+	result = libfshfs_internal_volume_read_allocation_bitmap(
+	          (libfshfs_internal_volume_t *) volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_internal_volume_read_allocation_bitmap(
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_volume_close(
+	          volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read allocation bitmap on a volume that is not open
+	 */
+	result = libfshfs_internal_volume_read_allocation_bitmap(
+	          (libfshfs_internal_volume_t *) volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfshfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+
+/* Tests the libfshfs_volume_get_number_of_free_blocks function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_volume_get_number_of_free_blocks(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libfshfs_volume_t *volume      = NULL;
+	uint32_t number_of_free_blocks = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = fshfs_test_volume_open_image(
+	          &volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfshfs_volume_get_number_of_free_blocks(
+	          volume,
+	          &number_of_free_blocks,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_free_blocks",
+	 number_of_free_blocks,
+	 (uint32_t) 10 );
+
+	/* Test error cases
+	 */
+	result = libfshfs_volume_get_number_of_free_blocks(
+	          NULL,
+	          &number_of_free_blocks,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_volume_get_number_of_free_blocks(
+	          volume,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_volume_close(
+	          volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test get number of free blocks on a volume that is not open
+	 */
+	result = libfshfs_volume_get_number_of_free_blocks(
+	          volume,
+	          &number_of_free_blocks,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfshfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_volume_is_block_allocated function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_volume_is_block_allocated(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libfshfs_volume_t *volume = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = fshfs_test_volume_open_image(
+	          &volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfshfs_volume_is_block_allocated(
+	          volume,
+	          0,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_volume_is_block_allocated(
+	          volume,
+	          5,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_volume_is_block_allocated(
+	          volume,
+	          6,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_volume_is_block_allocated(
+	          volume,
+	          15,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_volume_is_block_allocated(
+	          NULL,
+	          0,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_volume_is_block_allocated(
+	          volume,
+	          16,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_volume_close(
+	          volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test is block allocated on a volume that is not open
+	 */
+	result = libfshfs_volume_is_block_allocated(
+	          volume,
+	          0,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfshfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfshfs_volume_get_next_block_run function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_volume_get_next_block_run(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	libfshfs_volume_t *volume     = NULL;
+	uint32_t run_block_number     = 0;
+	uint32_t run_number_of_blocks = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = fshfs_test_volume_open_image(
+	          &volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfshfs_volume_get_next_block_run(
+	          volume,
+	          0,
+	          1,
+	          &run_block_number,
+	          &run_number_of_blocks,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "run_block_number",
+	 run_block_number,
+	 (uint32_t) 0 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "run_number_of_blocks",
+	 run_number_of_blocks,
+	 (uint32_t) 6 );
+
+	result = libfshfs_volume_get_next_block_run(
+	          volume,
+	          3,
+	          1,
+	          &run_block_number,
+	          &run_number_of_blocks,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "run_block_number",
+	 run_block_number,
+	 (uint32_t) 3 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "run_number_of_blocks",
+	 run_number_of_blocks,
+	 (uint32_t) 3 );
+
+	result = libfshfs_volume_get_next_block_run(
+	          volume,
+	          0,
+	          0,
+	          &run_block_number,
+	          &run_number_of_blocks,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "run_block_number",
+	 run_block_number,
+	 (uint32_t) 6 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "run_number_of_blocks",
+	 run_number_of_blocks,
+	 (uint32_t) 10 );
+
+	/* Test get next block run when there is no such run
+	 */
+	result = libfshfs_volume_get_next_block_run(
+	          volume,
+	          6,
+	          1,
+	          &run_block_number,
+	          &run_number_of_blocks,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_volume_get_next_block_run(
+	          volume,
+	          16,
+	          0,
+	          &run_block_number,
+	          &run_number_of_blocks,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_volume_get_next_block_run(
+	          NULL,
+	          0,
+	          0,
+	          &run_block_number,
+	          &run_number_of_blocks,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_volume_get_next_block_run(
+	          volume,
+	          0,
+	          0,
+	          NULL,
+	          &run_number_of_blocks,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_volume_get_next_block_run(
+	          volume,
+	          0,
+	          0,
+	          &run_block_number,
+	          NULL,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_volume_close(
+	          volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test get next block run on a volume that is not open
+	 */
+	result = libfshfs_volume_get_next_block_run(
+	          volume,
+	          0,
+	          0,
+	          &run_block_number,
+	          &run_number_of_blocks,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfshfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+/* Tests the libfshfs_internal_volume_get_next_unallocated_block_run function
+ * Returns 1 if successful or 0 if not
+ */
+int fshfs_test_internal_volume_get_next_unallocated_block_run(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	libfshfs_volume_t *volume     = NULL;
+	uint32_t run_block_number     = 0;
+	uint32_t run_number_of_blocks = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = fshfs_test_volume_open_image(
+	          &volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfshfs_internal_volume_get_next_unallocated_block_run(
+	          (libfshfs_internal_volume_t *) volume,
+	          0,
+	          &run_block_number,
+	          &run_number_of_blocks,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "run_block_number",
+	 run_block_number,
+	 (uint32_t) 6 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "run_number_of_blocks",
+	 run_number_of_blocks,
+	 (uint32_t) 10 );
+
+	result = libfshfs_internal_volume_get_next_unallocated_block_run(
+	          (libfshfs_internal_volume_t *) volume,
+	          7,
+	          &run_block_number,
+	          &run_number_of_blocks,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "run_block_number",
+	 run_block_number,
+	 (uint32_t) 7 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT32(
+	 "run_number_of_blocks",
+	 run_number_of_blocks,
+	 (uint32_t) 9 );
+
+	/* Test get next unallocated block run when there is no such run
+	 */
+	result = libfshfs_internal_volume_get_next_unallocated_block_run(
+	          (libfshfs_internal_volume_t *) volume,
+	          16,
+	          &run_block_number,
+	          &run_number_of_blocks,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfshfs_internal_volume_get_next_unallocated_block_run(
+	          NULL,
+	          0,
+	          &run_block_number,
+	          &run_number_of_blocks,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfshfs_internal_volume_get_next_unallocated_block_run(
+	          (libfshfs_internal_volume_t *) volume,
+	          0,
+	          NULL,
+	          &run_number_of_blocks,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfshfs_volume_close(
+	          volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
 	FSHFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Test get next unallocated block run on a volume that is not open
 	 */
-	result = libfshfs_volume_signal_abort(
-	          NULL,
+	result = libfshfs_internal_volume_get_next_unallocated_block_run(
+	          (libfshfs_internal_volume_t *) volume,
+	          0,
+	          &run_block_number,
+	          &run_number_of_blocks,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
@@ -1226,6 +5276,25 @@ int fshfs_test_volume_signal_abort(
 	libcerror_error_free(
 	 &error );
 
+	/* Clean up
+	 */
+	result = libfshfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
@@ -1234,24 +5303,93 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( volume != NULL )
+	{
+		libfshfs_volume_free(
+		 &volume,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libfshfs_volume_get_utf8_name_size function
+/* Collects the reads of libfshfs_internal_volume_read_unallocated_blocks
+ * Returns 1 to continue, 0 to stop or -1 on error
+ */
+int fshfs_test_internal_volume_collect_unallocated_read(
+     off64_t volume_offset,
+     const uint8_t *data,
+     size_t data_size,
+     void *callback_data,
+     libcerror_error_t **error FSHFS_TEST_ATTRIBUTE_UNUSED )
+{
+	fshfs_test_volume_unallocated_reads_t *reads = NULL;
+
+	FSHFS_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( ( data == NULL )
+	 || ( callback_data == NULL ) )
+	{
+		return( -1 );
+	}
+	reads = (fshfs_test_volume_unallocated_reads_t *) callback_data;
+
+	if( reads->number_of_reads == 0 )
+	{
+		reads->first_volume_offset = volume_offset;
+	}
+	reads->number_of_reads += 1;
+	reads->read_size       += (size64_t) data_size;
+
+	if( reads->number_of_reads >= reads->maximum_number_of_reads )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Tests the libfshfs_internal_volume_read_unallocated_blocks function
  * Returns 1 if successful or 0 if not
  */
-int fshfs_test_volume_get_utf8_name_size(
-     libfshfs_volume_t *volume )
+int fshfs_test_internal_volume_read_unallocated_blocks(
+     void )
 {
-	libcerror_error_t *error = NULL;
-	size_t utf8_string_size  = 0;
-	int result               = 0;
+	fshfs_test_volume_unallocated_reads_t reads;
+
+	libcerror_error_t *error  = NULL;
+	libfshfs_volume_t *volume = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = fshfs_test_volume_open_image(
+	          &volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test regular cases
 	 */
-	result = libfshfs_volume_get_utf8_name_size(
-	          volume,
-	          &utf8_string_size,
+	reads.first_volume_offset     = 0;
+	reads.read_size               = 0;
+	reads.number_of_reads         = 0;
+	reads.maximum_number_of_reads = 16;
+
+	result = libfshfs_internal_volume_read_unallocated_blocks(
+	          (libfshfs_internal_volume_t *) volume,
+	          16384,
+	          &fshfs_test_internal_volume_collect_unallocated_read,
+	          (void *) &reads,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
@@ -1263,72 +5401,143 @@ int fshfs_test_volume_get_utf8_name_size(
 	 "error",
 	 error );
 
-	/* Test error cases
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "reads.number_of_reads",
+	 reads.number_of_reads,
+	 3 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT64(
+	 "reads.read_size",
+	 (uint64_t) reads.read_size,
+	 (uint64_t) 40960 );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT64(
+	 "reads.first_volume_offset",
+	 (int64_t) reads.first_volume_offset,
+	 (int64_t) 24576 );
+
+	/* Test read unallocated blocks with a maximum read size larger than the unallocated blocks
 	 */
-	result = libfshfs_volume_get_utf8_name_size(
-	          NULL,
-	          &utf8_string_size,
+	reads.first_volume_offset     = 0;
+	reads.read_size               = 0;
+	reads.number_of_reads         = 0;
+	reads.maximum_number_of_reads = 16;
+
+	result = libfshfs_internal_volume_read_unallocated_blocks(
+	          (libfshfs_internal_volume_t *) volume,
+	          65536,
+	          &fshfs_test_internal_volume_collect_unallocated_read,
+	          (void *) &reads,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	FSHFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "reads.number_of_reads",
+	 reads.number_of_reads,
+	 1 );
 
-	result = libfshfs_volume_get_utf8_name_size(
-	          volume,
-	          NULL,
+	FSHFS_TEST_ASSERT_EQUAL_UINT64(
+	 "reads.read_size",
+	 (uint64_t) reads.read_size,
+	 (uint64_t) 40960 );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT64(
+	 "reads.first_volume_offset",
+	 (int64_t) reads.first_volume_offset,
+	 (int64_t) 24576 );
+
+	/* Test read unallocated blocks with a maximum read size smaller than the block size
+	 */
+	reads.first_volume_offset     = 0;
+	reads.read_size               = 0;
+	reads.number_of_reads         = 0;
+	reads.maximum_number_of_reads = 16;
+
+	result = libfshfs_internal_volume_read_unallocated_blocks(
+	          (libfshfs_internal_volume_t *) volume,
+	          1000,
+	          &fshfs_test_internal_volume_collect_unallocated_read,
+	          (void *) &reads,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	FSHFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "reads.number_of_reads",
+	 reads.number_of_reads,
+	 10 );
 
-	return( 1 );
+	FSHFS_TEST_ASSERT_EQUAL_UINT64(
+	 "reads.read_size",
+	 (uint64_t) reads.read_size,
+	 (uint64_t) 40960 );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	/* Test stopping the read from the callback
+	 */
+	reads.first_volume_offset     = 0;
+	reads.read_size               = 0;
+	reads.number_of_reads         = 0;
+	reads.maximum_number_of_reads = 2;
+
+	result = libfshfs_internal_volume_read_unallocated_blocks(
+	          (libfshfs_internal_volume_t *) volume,
+	          4096,
+	          &fshfs_test_internal_volume_collect_unallocated_read,
+	          (void *) &reads,
+	          &error );
 
-/* Tests the libfshfs_volume_get_utf8_name function
- * Returns 1 if successful or 0 if not
- */
-int fshfs_test_volume_get_utf8_name(
-     libfshfs_volume_t *volume )
-{
-	uint8_t utf8_string[ 512 ];
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Test regular cases
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "reads.number_of_reads",
+	 reads.number_of_reads,
+	 2 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT64(
+	 "reads.read_size",
+	 (uint64_t) reads.read_size,
+	 (uint64_t) 8192 );
+
+	/* Test read unallocated blocks with abort set
 	 */
-	result = libfshfs_volume_get_utf8_name(
-	          volume,
-	          utf8_string,
-	          512,
+	reads.first_volume_offset     = 0;
+	reads.read_size               = 0;
+	reads.number_of_reads         = 0;
+	reads.maximum_number_of_reads = 16;
+
+	( (libfshfs_internal_volume_t *) volume )->io_handle->abort = 1;
+
+	result = libfshfs_internal_volume_read_unallocated_blocks(
+	          (libfshfs_internal_volume_t *) volume,
+	          4096,
+	          &fshfs_test_internal_volume_collect_unallocated_read,
+	          (void *) &reads,
 	          &error );
 
+	( (libfshfs_internal_volume_t *) volume )->io_handle->abort = 0;
+
 	FSHFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -1338,12 +5547,18 @@ int fshfs_test_volume_get_utf8_name(
 	 "error",
 	 error );
 
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "reads.number_of_reads",
+	 reads.number_of_reads,
+	 0 );
+
 	/* Test error cases
 	 */
-	result = libfshfs_volume_get_utf8_name(
+	result = libfshfs_internal_volume_read_unallocated_blocks(
 	          NULL,
-	          utf8_string,
-	          512,
+	          4096,
+	          &fshfs_test_internal_volume_collect_unallocated_read,
+	          (void *) &reads,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
@@ -1358,10 +5573,11 @@ int fshfs_test_volume_get_utf8_name(
 	libcerror_error_free(
 	 &error );
 
-	result = libfshfs_volume_get_utf8_name(
-	          volume,
-	          NULL,
-	          512,
+	result = libfshfs_internal_volume_read_unallocated_blocks(
+	          (libfshfs_internal_volume_t *) volume,
+	          0,
+	          &fshfs_test_internal_volume_collect_unallocated_read,
+	          (void *) &reads,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
@@ -1376,10 +5592,11 @@ int fshfs_test_volume_get_utf8_name(
 	libcerror_error_free(
 	 &error );
 
-	result = libfshfs_volume_get_utf8_name(
-	          volume,
-	          utf8_string,
-	          0,
+	result = libfshfs_internal_volume_read_unallocated_blocks(
+	          (libfshfs_internal_volume_t *) volume,
+	          4096,
+	          NULL,
+	          (void *) &reads,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
@@ -1394,10 +5611,13 @@ int fshfs_test_volume_get_utf8_name(
 	libcerror_error_free(
 	 &error );
 
-	result = libfshfs_volume_get_utf8_name(
-	          volume,
-	          utf8_string,
-	          (size_t) SSIZE_MAX + 1,
+	/* Test read unallocated blocks with a callback that fails
+	 */
+	result = libfshfs_internal_volume_read_unallocated_blocks(
+	          (libfshfs_internal_volume_t *) volume,
+	          4096,
+	          &fshfs_test_internal_volume_collect_unallocated_read,
+	          NULL,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
@@ -1412,6 +5632,40 @@ int fshfs_test_volume_get_utf8_name(
 	libcerror_error_free(
 	 &error );
 
+	/* Clean up
+	 */
+	result = libfshfs_volume_close(
+	          volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfshfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
@@ -1420,24 +5674,55 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( volume != NULL )
+	{
+		libfshfs_volume_free(
+		 &volume,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libfshfs_volume_get_utf16_name_size function
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+
+/* Tests the libfshfs_volume_get_statistics function
  * Returns 1 if successful or 0 if not
  */
-int fshfs_test_volume_get_utf16_name_size(
-     libfshfs_volume_t *volume )
+int fshfs_test_volume_get_statistics(
+     void )
 {
-	libcerror_error_t *error = NULL;
-	size_t utf16_string_size = 0;
-	int result               = 0;
+	libfshfs_volume_statistics_t statistics_after;
+	libfshfs_volume_statistics_t statistics_before;
 
-	/* Test regular cases
+	libcerror_error_t *error       = NULL;
+	libfshfs_volume_t *volume      = NULL;
+	uint32_t number_of_free_blocks = 0;
+	int result                     = 0;
+
+	/* Initialize test
 	 */
-	result = libfshfs_volume_get_utf16_name_size(
+	result = fshfs_test_volume_open_image(
+	          &volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Read the allocation bitmap so that it is not read by libfshfs_volume_read_unallocated_blocks
+	 */
+	result = libfshfs_volume_get_number_of_free_blocks(
 	          volume,
-	          &utf16_string_size,
+	          &number_of_free_blocks,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
@@ -1449,70 +5734,41 @@ int fshfs_test_volume_get_utf16_name_size(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Test regular cases
 	 */
-	result = libfshfs_volume_get_utf16_name_size(
-	          NULL,
-	          &utf16_string_size,
+	result = libfshfs_volume_get_statistics(
+	          volume,
+	          &statistics_before,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	FSHFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libfshfs_volume_get_utf16_name_size(
+	result = libfshfs_volume_read_unallocated_blocks(
 	          volume,
-	          NULL,
+	          65536,
+	          &fshfs_test_volume_read_unallocated_blocks_callback_function,
+	          (void *) volume,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	FSHFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libfshfs_volume_get_utf16_name function
- * Returns 1 if successful or 0 if not
- */
-int fshfs_test_volume_get_utf16_name(
-     libfshfs_volume_t *volume )
-{
-	uint16_t utf16_string[ 512 ];
-
-	libcerror_error_t *error = NULL;
-	int result               = 0;
-
-	/* Test regular cases
-	 */
-	result = libfshfs_volume_get_utf16_name(
+	result = libfshfs_volume_get_statistics(
 	          volume,
-	          utf16_string,
-	          512,
+	          &statistics_after,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
@@ -1524,12 +5780,23 @@ int fshfs_test_volume_get_utf16_name(
 	 "error",
 	 error );
 
+	/* The unallocated blocks 6 to 15 are read with a single read
+	 */
+	FSHFS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_reads",
+	 statistics_after.number_of_reads[ LIBFSHFS_STATISTICS_REGION_DATA ] - statistics_before.number_of_reads[ LIBFSHFS_STATISTICS_REGION_DATA ],
+	 (uint64_t) 1 );
+
+	FSHFS_TEST_ASSERT_EQUAL_UINT64(
+	 "read_size",
+	 statistics_after.read_sizes[ LIBFSHFS_STATISTICS_REGION_DATA ] - statistics_before.read_sizes[ LIBFSHFS_STATISTICS_REGION_DATA ],
+	 (uint64_t) 40960 );
+
 	/* Test error cases
 	 */
-	result = libfshfs_volume_get_utf16_name(
+	result = libfshfs_volume_get_statistics(
 	          NULL,
-	          utf16_string,
-	          512,
+	          &statistics_after,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
@@ -1544,10 +5811,9 @@ int fshfs_test_volume_get_utf16_name(
 	libcerror_error_free(
 	 &error );
 
-	result = libfshfs_volume_get_utf16_name(
+	result = libfshfs_volume_get_statistics(
 	          volume,
 	          NULL,
-	          512,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
@@ -1562,41 +5828,60 @@ int fshfs_test_volume_get_utf16_name(
 	libcerror_error_free(
 	 &error );
 
-	result = libfshfs_volume_get_utf16_name(
+	/* Clean up
+	 */
+	result = libfshfs_volume_close(
 	          volume,
-	          utf16_string,
-	          0,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 0 );
 
-	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	FSHFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libfshfs_volume_get_utf16_name(
+	/* Test get statistics on a volume that is closed
+	 */
+	result = libfshfs_volume_get_statistics(
 	          volume,
-	          utf16_string,
-	          (size_t) SSIZE_MAX + 1,
+	          &statistics_before,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	FSHFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	FSHFS_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics_before.read_sizes[ LIBFSHFS_STATISTICS_REGION_DATA ]",
+	 statistics_before.read_sizes[ LIBFSHFS_STATISTICS_REGION_DATA ],
+	 statistics_after.read_sizes[ LIBFSHFS_STATISTICS_REGION_DATA ] );
+
+	/* Clean up
+	 */
+	result = libfshfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	return( 1 );
 
@@ -1606,24 +5891,52 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( volume != NULL )
+	{
+		libfshfs_volume_free(
+		 &volume,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libfshfs_volume_get_root_directory function
+/* Tests the libfshfs_volume_reset_statistics function
  * Returns 1 if successful or 0 if not
  */
-int fshfs_test_volume_get_root_directory(
-     libfshfs_volume_t *volume )
+int fshfs_test_volume_reset_statistics(
+     void )
 {
-	libcerror_error_t *error              = NULL;
-	libfshfs_file_entry_t *root_directory = NULL;
-	int result                            = 0;
+	libfshfs_volume_statistics_t volume_statistics;
 
-	/* Test regular cases
+	libcerror_error_t *error  = NULL;
+	libfshfs_volume_t *volume = NULL;
+	int region_index          = 0;
+	int result                = 0;
+
+	/* Initialize test
 	 */
-	result = libfshfs_volume_get_root_directory(
+	result = fshfs_test_volume_open_image(
+	          &volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_volume_read_unallocated_blocks(
 	          volume,
-	          &root_directory,
+	          65536,
+	          &fshfs_test_volume_read_unallocated_blocks_callback_function,
+	          (void *) volume,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
@@ -1635,12 +5948,24 @@ int fshfs_test_volume_get_root_directory(
 	 "error",
 	 error );
 
-	FSHFS_TEST_ASSERT_IS_NOT_NULL(
-	 "root_directory",
-	 root_directory );
+	/* Test regular cases
+	 */
+	result = libfshfs_volume_reset_statistics(
+	          volume,
+	          &error );
 
-	result = libfshfs_file_entry_free(
-	          &root_directory,
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfshfs_volume_get_statistics(
+	          volume,
+	          &volume_statistics,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
@@ -1652,11 +5977,24 @@ int fshfs_test_volume_get_root_directory(
 	 "error",
 	 error );
 
+	for( region_index = 0;
+	     region_index < LIBFSHFS_STATISTICS_NUMBER_OF_REGIONS;
+	     region_index++ )
+	{
+		FSHFS_TEST_ASSERT_EQUAL_UINT64(
+		 "volume_statistics.number_of_reads[ region_index ]",
+		 volume_statistics.number_of_reads[ region_index ],
+		 (uint64_t) 0 );
+
+		FSHFS_TEST_ASSERT_EQUAL_UINT64(
+		 "volume_statistics.read_sizes[ region_index ]",
+		 volume_statistics.read_sizes[ region_index ],
+		 (uint64_t) 0 );
+	}
 	/* Test error cases
 	 */
-	result = libfshfs_volume_get_root_directory(
+	result = libfshfs_volume_reset_statistics(
 	          NULL,
-	          &root_directory,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
@@ -1664,10 +6002,6 @@ int fshfs_test_volume_get_root_directory(
 	 result,
 	 -1 );
 
-	FSHFS_TEST_ASSERT_IS_NULL(
-	 "root_directory",
-	 root_directory );
-
 	FSHFS_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1675,26 +6009,39 @@ int fshfs_test_volume_get_root_directory(
 	libcerror_error_free(
 	 &error );
 
-	result = libfshfs_volume_get_root_directory(
+	/* Clean up
+	 */
+	result = libfshfs_volume_close(
 	          volume,
-	          NULL,
 	          &error );
 
 	FSHFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 0 );
 
 	FSHFS_TEST_ASSERT_IS_NULL(
-	 "root_directory",
-	 root_directory );
-
-	FSHFS_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	/* Clean up
+	 */
+	result = libfshfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSHFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSHFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	return( 1 );
 
@@ -1704,10 +6051,10 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( root_directory != NULL )
+	if( volume != NULL )
 	{
-		libfshfs_file_entry_free(
-		 &root_directory,
+		libfshfs_volume_free(
+		 &volume,
 		 NULL );
 	}
 	return( 0 );
@@ -1797,6 +6144,90 @@ int main(
 	 "libfshfs_volume_free",
 	 fshfs_test_volume_free );
 
+	FSHFS_TEST_RUN(
+	 "libfshfs_volume_get_maximum_read_ahead_size",
+	 fshfs_test_volume_get_maximum_read_ahead_size );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_volume_set_maximum_read_ahead_size",
+	 fshfs_test_volume_set_maximum_read_ahead_size );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_volume_get_use_memory_mapping",
+	 fshfs_test_volume_get_use_memory_mapping );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_volume_set_use_memory_mapping",
+	 fshfs_test_volume_set_use_memory_mapping );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_volume_get_use_lazy_open",
+	 fshfs_test_volume_get_use_lazy_open );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_volume_set_use_lazy_open",
+	 fshfs_test_volume_set_use_lazy_open );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_volume_open_memory",
+	 fshfs_test_volume_open_memory );
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_volume_open_lazy",
+	 fshfs_test_volume_open_lazy );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_volume_read_indirect_node_index",
+	 fshfs_test_volume_read_indirect_node_index );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_volume_iterate_catalog_records",
+	 fshfs_test_volume_iterate_catalog_records );
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_internal_volume_read_allocation_bitmap",
+	 fshfs_test_internal_volume_read_allocation_bitmap );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_volume_get_number_of_free_blocks",
+	 fshfs_test_volume_get_number_of_free_blocks );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_volume_is_block_allocated",
+	 fshfs_test_volume_is_block_allocated );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_volume_get_next_block_run",
+	 fshfs_test_volume_get_next_block_run );
+
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_internal_volume_get_next_unallocated_block_run",
+	 fshfs_test_internal_volume_get_next_unallocated_block_run );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_internal_volume_read_unallocated_blocks",
+	 fshfs_test_internal_volume_read_unallocated_blocks );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_volume_get_statistics",
+	 fshfs_test_volume_get_statistics );
+
+	FSHFS_TEST_RUN(
+	 "libfshfs_volume_reset_statistics",
+	 fshfs_test_volume_reset_statistics );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 	if( source != NULL )
 	{
@@ -1978,6 +6409,27 @@ int main(
 
 		/* TODO: add tests for libfshfs_volume_get_file_entry_by_utf16_path */
 
+#if defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT )
+
+		/* TODO: add tests for libfshfs_internal_volume_get_file_entries_by_lookup_targets */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSHFS_DLL_IMPORT ) */
+
+		FSHFS_TEST_RUN_WITH_ARGS(
+		 "libfshfs_volume_get_file_entries_by_identifiers",
+		 fshfs_test_volume_get_file_entries_by_identifiers,
+		 volume );
+
+		FSHFS_TEST_RUN_WITH_ARGS(
+		 "libfshfs_volume_get_file_entries_by_utf8_paths",
+		 fshfs_test_volume_get_file_entries_by_utf8_paths,
+		 volume );
+
+		FSHFS_TEST_RUN_WITH_ARGS(
+		 "libfshfs_volume_read_unallocated_blocks",
+		 fshfs_test_volume_read_unallocated_blocks,
+		 volume );
+
 		/* Clean up
 		 */
 		result = fshfs_test_volume_close_source(
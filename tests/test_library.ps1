@@ -1,6 +1,6 @@
 # Tests library functions and types.
 
-$LibraryTests = "attribute_record attributes_btree_key bit_stream btree_file btree_header btree_node btree_node_descriptor btree_node_record buffer_data_handle catalog_btree_key compressed_data_handle compression deflate directory_entry directory_record error extent extents_btree_key file_entry file_record file_system fork_descriptor huffman_tree io_handle master_directory_block name notify profiler thread_record volume_header"
+$LibraryTests = "allocation_bitmap attribute_record attributes_btree_key attributes_index bit_stream btree_file btree_header btree_node btree_node_descriptor btree_node_record buffer_data_handle catalog_btree_key catalog_index compressed_data_handle compression deflate directory_entries_page directory_entry directory_record error extent extents_btree_key file_entry file_record file_system fork_descriptor huffman_tree io_handle lookup_target mapped_data_handle master_directory_block memory_arena memory_map name notify path_cache profiler read_ahead_data_handle read_queue read_range read_request statistics thread_record volume_header"
 $LibraryTestsWithInput = "support volume"
 $OptionSets = "offset" -split " "
 